@@ -0,0 +1,316 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ao.h section <ao_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @warning @ref ecu_ao is not thread-safe. Every function must be
+ * called from the same context, or the user must serialize access.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_AO_H_
+#define ECU_AO_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ECU. */
+#include "ecu/event.h"
+#include "ecu/fsm.h"
+#include "ecu/hsm.h"
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+#ifndef ECU_AO_ALIGNMENT
+/**
+ * @brief Every queued event starts on a multiple of this many
+ * bytes so handlers can read it in place. Defaults to 8, which
+ * covers every scalar type on common targets. Override it with
+ * a compiler flag (i.e. -DECU_AO_ALIGNMENT=16) so every translation
+ * unit sees the same value. Must be a power of two.
+ */
+#define ECU_AO_ALIGNMENT \
+    ((size_t)8)
+#endif
+
+/**
+ * @brief Number of bytes between the start of two consecutive
+ * event slots in an @ref ecu_ao queue.
+ *
+ * @param event_size_ Size of the largest event that will be posted.
+ */
+#define ECU_AO_SLOT_SIZE(event_size_) \
+    ((((size_t)(event_size_) + ECU_AO_ALIGNMENT - 1) / ECU_AO_ALIGNMENT) * ECU_AO_ALIGNMENT)
+
+/**
+ * @brief Number of bytes an @ref ecu_ao buffer needs to queue
+ * a number of events regardless of how the buffer is aligned.
+ * Includes one extra slot that holds the event being dispatched.
+ * Can be used to size buffers at compile-time.
+ *
+ * @param event_size_ Size of the largest event that will be posted.
+ * @param events_ Number of events that can be queued at once.
+ */
+#define ECU_AO_BUFFER_SIZE(event_size_, events_) \
+    ((ECU_AO_SLOT_SIZE(event_size_) * ((size_t)(events_) + 1)) + ECU_AO_ALIGNMENT - 1)
+
+/**
+ * @brief Convenience define for @ref ecu_ao_set_post_hook().
+ * Pass this value to remove a hook.
+ */
+#define ECU_AO_POST_HOOK_UNUSED \
+    ((void (*)(struct ecu_ao *, void *))0)
+
+/**
+ * @brief Convenience define for @ref ecu_ao_set_post_hook().
+ * Pass this value if the hook's object is unused.
+ */
+#define ECU_AO_OBJ_UNUSED \
+    ((void *)0)
+
+/*------------------------------------------------------------*/
+/*---------------------------- AO ----------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Active object. Pairs an @ref ecu_fsm or @ref ecu_hsm with
+ * a bounded FIFO of events that are copied in by value. Producers
+ * post events and return immediately. Events are later dispatched
+ * to the state machine one at a time, each running to completion.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ao
+{
+    /// @brief State machine events are dispatched to. NULL if
+    /// this object runs an hsm.
+    struct ecu_fsm *fsm;
+
+    /// @brief State machine events are dispatched to. NULL if
+    /// this object runs an fsm.
+    struct ecu_hsm *hsm;
+
+    /// @brief First slot. Aligned to @ref ECU_AO_ALIGNMENT.
+    /// The slot after the last queue slot holds the event
+    /// being dispatched.
+    uint8_t *slots;
+
+    /// @brief Number of bytes between consecutive slots.
+    size_t slot_size;
+
+    /// @brief Maximum number of events that can be queued.
+    size_t capacity;
+
+    /// @brief Slot index of the oldest queued event.
+    size_t head;
+
+    /// @brief Number of queued events.
+    size_t count;
+
+    /// @brief True while an event is being dispatched. Used to
+    /// detect a handler that tries to run the queue recursively.
+    bool dispatching;
+
+    /// @brief Optional function called after every successful post.
+    /// Lets a scheduler learn this object has work without polling it.
+    void (*post_hook)(struct ecu_ao *me, void *obj);
+
+    /// @brief Optional object passed to @ref ecu_ao.post_hook.
+    void *post_hook_obj;
+};
+
+/*------------------------------------------------------------*/
+/*--------------------- AO MEMBER FUNCTIONS ------------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Ao Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p fsm constructed via @ref ecu_fsm_ctor().
+ * @brief Active object constructor for a flat state machine.
+ * Splits @p buffer into as many event slots as fit after aligning
+ * it to @ref ECU_AO_ALIGNMENT. The queue starts out empty.
+ *
+ * @warning @p me and @p buffer must not be an active object with
+ * queued events, otherwise behavior is undefined.
+ *
+ * @param me Active object to construct.
+ * @param fsm State machine to dispatch events to. Must stay valid
+ * for the lifetime of @p me and should only be run through it.
+ * @param buffer Memory events are queued in. Must stay valid for
+ * the lifetime of @p me. Use @ref ECU_AO_BUFFER_SIZE() to size it.
+ * @param size Number of bytes in @p buffer. Must hold at least
+ * two slots, one queue slot and the dispatch slot.
+ * @param event_size Size of the largest event that will be posted.
+ * Must be at least sizeof(struct ecu_event).
+ */
+extern void ecu_ao_fsm_ctor(struct ecu_ao *me,
+                            struct ecu_fsm *fsm,
+                            void *buffer,
+                            size_t size,
+                            size_t event_size);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p hsm constructed via @ref ecu_hsm_ctor().
+ * @brief Same as @ref ecu_ao_fsm_ctor() but events are dispatched
+ * to a hierarchical state machine.
+ *
+ * @param me Active object to construct.
+ * @param hsm State machine to dispatch events to. Must stay valid
+ * for the lifetime of @p me and should only be run through it.
+ * @param buffer Memory events are queued in. Must stay valid for
+ * the lifetime of @p me. Use @ref ECU_AO_BUFFER_SIZE() to size it.
+ * @param size Number of bytes in @p buffer. Must hold at least
+ * two slots, one queue slot and the dispatch slot.
+ * @param event_size Size of the largest event that will be posted.
+ * Must be at least sizeof(struct ecu_event).
+ */
+extern void ecu_ao_hsm_ctor(struct ecu_ao *me,
+                            struct ecu_hsm *hsm,
+                            void *buffer,
+                            size_t size,
+                            size_t event_size);
+/**@}*/
+
+/**
+ * @name Ao Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me constructed via @ref ecu_ao_fsm_ctor() or
+ * @ref ecu_ao_hsm_ctor().
+ * @brief Returns the maximum number of events that can be queued.
+ *
+ * @param me Active object to check.
+ */
+extern size_t ecu_ao_capacity(const struct ecu_ao *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_ao_fsm_ctor() or
+ * @ref ecu_ao_hsm_ctor().
+ * @brief Returns the number of events waiting to be dispatched.
+ *
+ * @param me Active object to check.
+ */
+extern size_t ecu_ao_count(const struct ecu_ao *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_ao_fsm_ctor() or
+ * @ref ecu_ao_hsm_ctor().
+ * @brief Copies @p event to the back of the queue. Returns false
+ * without copying if the queue is full. O(event size).
+ *
+ * @details Can be called from a state handler of this object's
+ * own state machine. The event is dispatched after the current
+ * event runs to completion.
+ *
+ * @param me Active object to post to.
+ * @param event Event to copy. Its @ref ecu_event.size bytes are
+ * copied, which must be between sizeof(struct ecu_event) and the
+ * event size given to the constructor.
+ */
+extern bool ecu_ao_post(struct ecu_ao *me, const struct ecu_event *event);
+
+/**
+ * @pre @p me constructed via @ref ecu_ao_fsm_ctor() or
+ * @ref ecu_ao_hsm_ctor().
+ * @brief Same as @ref ecu_ao_post() except the event is copied
+ * to the front of the queue so it is dispatched next. Urgent events
+ * posted back to back are therefore dispatched in LIFO order.
+ *
+ * @param me Active object to post to.
+ * @param event Event to copy. Same requirements as @ref ecu_ao_post().
+ */
+extern bool ecu_ao_post_urgent(struct ecu_ao *me, const struct ecu_event *event);
+
+/**
+ * @pre @p me constructed via @ref ecu_ao_fsm_ctor() or
+ * @ref ecu_ao_hsm_ctor().
+ * @brief Dispatches the oldest queued event, or the newest urgent
+ * one, to the state machine. Returns false if the queue was empty.
+ *
+ * @warning Cannot be called from a state handler of this object's
+ * own state machine since every event must run to completion.
+ *
+ * @param me Active object to run.
+ */
+extern bool ecu_ao_run_once(struct ecu_ao *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_ao_fsm_ctor() or
+ * @ref ecu_ao_hsm_ctor().
+ * @brief Dispatches queued events until the queue is empty, including
+ * events posted by the handlers themselves. Returns the number of
+ * events dispatched. Cheaper per event than calling @ref ecu_ao_run_once()
+ * in a loop.
+ *
+ * @warning Cannot be called from a state handler of this object's
+ * own state machine since every event must run to completion. Does
+ * not return if handlers keep posting events.
+ *
+ * @param me Active object to run.
+ */
+extern size_t ecu_ao_run_until_empty(struct ecu_ao *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_ao_fsm_ctor() or
+ * @ref ecu_ao_hsm_ctor().
+ * @brief Installs a function that is called after every event
+ * successfully posted to this object, including urgent events and
+ * events posted by its own handlers. Replaces any previous hook.
+ * Used by schedulers that run many active objects, so this is
+ * usually not called directly.
+ *
+ * @param me Active object to hook.
+ * @param hook Called with @p me and @p obj after the event is
+ * queued. Supply @ref ECU_AO_POST_HOOK_UNUSED to remove the hook.
+ * @param obj Optional object passed to @p hook. Supply
+ * @ref ECU_AO_OBJ_UNUSED if unused.
+ */
+extern void ecu_ao_set_post_hook(struct ecu_ao *me,
+                                 void (*hook)(struct ecu_ao *me, void *obj),
+                                 void *obj);
+
+/**
+ * @pre @p me constructed via @ref ecu_ao_fsm_ctor() or
+ * @ref ecu_ao_hsm_ctor().
+ * @brief Starts the state machine via @ref ecu_fsm_start() or
+ * @ref ecu_hsm_start(). Events can be posted before this is
+ * called but must not be dispatched until it is.
+ *
+ * @warning This function should only be called once on
+ * startup and must run to completion.
+ *
+ * @param me Active object to start.
+ */
+extern void ecu_ao_start(struct ecu_ao *me);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_AO_H_ */
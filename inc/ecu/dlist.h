@@ -151,6 +151,48 @@
          var_ != ecu_dlist_iterator_cend(citer_);                                 \
          var_ = ecu_dlist_iterator_cnext(citer_))
 
+/**
+ * @brief Same as @ref ECU_DLIST_FOR_EACH() but software prefetches the node
+ * @p distance_ positions ahead of the current node. Use when iterating long
+ * lists whose nodes are scattered in memory and iteration is bound by cache
+ * misses. It is safe to remove the current node in the iteration. No other
+ * nodes should be added or removed, which is the same restriction as
+ * @ref ECU_DLIST_FOR_EACH().
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to @ref ecu_dnode.
+ * @param iter_ Iterator to initialize. This will be a pointer to
+ * @ref ecu_dlist_prefetch_iterator.
+ * @param list_ List to iterate over. This will be a pointer to @ref ecu_dlist.
+ * The iteration will immediately exit if this list is empty.
+ * @param distance_ Number of nodes ahead of the current node to prefetch.
+ * Larger values hide more memory latency but prefetch nodes that may be
+ * evicted before they are used if per-node work is small. Values between
+ * 2 and 8 are typical. 0 disables prefetching.
+ */
+#define ECU_DLIST_FOR_EACH_PREFETCH(var_, iter_, list_, distance_)                            \
+    for (struct ecu_dnode *var_ = ecu_dlist_prefetch_iterator_begin(iter_, list_, distance_); \
+         var_ != ecu_dlist_prefetch_iterator_end(iter_);                                      \
+         var_ = ecu_dlist_prefetch_iterator_next(iter_))
+
+/**
+ * @brief Const-qualified version of @ref ECU_DLIST_FOR_EACH_PREFETCH().
+ * Returned nodes are read-only.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to const @ref ecu_dnode.
+ * @param citer_ Iterator to initialize. This will be a pointer to
+ * @ref ecu_dlist_prefetch_citerator.
+ * @param list_ List to iterate over. This will be a pointer to const @ref ecu_dlist.
+ * The iteration will immediately exit if this list is empty.
+ * @param distance_ Number of nodes ahead of the current node to prefetch.
+ * 0 disables prefetching.
+ */
+#define ECU_DLIST_CONST_FOR_EACH_PREFETCH(var_, citer_, list_, distance_)                              \
+    for (const struct ecu_dnode *var_ = ecu_dlist_prefetch_iterator_cbegin(citer_, list_, distance_); \
+         var_ != ecu_dlist_prefetch_iterator_cend(citer_);                                            \
+         var_ = ecu_dlist_prefetch_iterator_cnext(citer_))
+
 /*------------------------------------------------------------*/
 /*-------------------------- DLIST ---------------------------*/
 /*------------------------------------------------------------*/
@@ -239,6 +281,44 @@ struct ecu_dlist_citerator
     const struct ecu_dnode *next;
 };
 
+/**
+ * @brief Non-const list iterator that software prefetches
+ * nodes ahead of the current position.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_dlist_prefetch_iterator
+{
+    /// @brief Iterator that walks the list. Prefetching
+    /// never affects which nodes it returns.
+    struct ecu_dlist_iterator iterator;
+
+    /// @brief Node that was last prefetched. Kept a fixed
+    /// distance ahead of @ref ecu_dlist_iterator.current.
+    /// Stops at HEAD once the end of the list is reached.
+    struct ecu_dnode *ahead;
+};
+
+/**
+ * @brief Const list iterator that software prefetches
+ * nodes ahead of the current position.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_dlist_prefetch_citerator
+{
+    /// @brief Iterator that walks the list. Prefetching
+    /// never affects which nodes it returns.
+    struct ecu_dlist_citerator citerator;
+
+    /// @brief Node that was last prefetched. Kept a fixed
+    /// distance ahead of @ref ecu_dlist_citerator.current.
+    /// Stops at HEAD once the end of the list is reached.
+    const struct ecu_dnode *ahead;
+};
+
 /*------------------------------------------------------------*/
 /*------------------ DNODE MEMBER FUNCTIONS ------------------*/
 /*------------------------------------------------------------*/
@@ -514,6 +594,26 @@ extern void ecu_dlist_insert_before(struct ecu_dlist *me,
                                     bool (*condition)(const struct ecu_dnode *node, const struct ecu_dnode *position, void *data),
                                     void *data);
 
+/**
+ * @pre @p me and @p other previously constructed via call to @ref ecu_dlist_ctor().
+ * @pre @p me and @p other are already sorted by @p lhs_less_than_rhs.
+ * @brief Merges all nodes in @p other into @p me by relinking them. No nodes are
+ * copied or allocated. @p me remains sorted and @p other becomes empty. The merge
+ * is stable. Nodes in @p me are placed before equal nodes from @p other.
+ *
+ * @param me List to merge into. This cannot equal @p other.
+ * @param other List to merge from. This cannot equal @p me. Becomes empty.
+ * @param lhs_less_than_rhs Mandatory function that defines sorting condition.
+ * Return true if left node (lhs) is less than right node (rhs). Otherwise return
+ * false. Must be the same condition both lists were sorted with.
+ * @param data Optional object to pass to @p lhs_less_than_rhs. Supply
+ * @ref ECU_DNODE_OBJ_UNUSED if unused.
+ */
+extern void ecu_dlist_merge(struct ecu_dlist *me,
+                            struct ecu_dlist *other,
+                            bool (*lhs_less_than_rhs)(const struct ecu_dnode *lhs, const struct ecu_dnode *rhs, void *data),
+                            void *data);
+
 /**
  * @pre @p me previously constructed via call to @ref ecu_dlist_ctor().
  * @pre @p node previously constructed via call to @ref ecu_dnode_ctor().
@@ -578,6 +678,81 @@ extern void ecu_dlist_sort(struct ecu_dlist *me,
                            bool (*lhs_less_than_rhs)(const struct ecu_dnode *lhs, const struct ecu_dnode *rhs, void *data),
                            void *data);
 
+/**
+ * @pre @p me previously constructed via call to @ref ecu_dlist_ctor().
+ * @pre Every list in @p chunks previously constructed via call to @ref ecu_dlist_ctor()
+ * and empty.
+ * @brief Stable merge sort that lets the application sort large lists on
+ * multiple cores. The list is split into @p count contiguous chunks in O(n).
+ * The chunks are handed to @p sort_chunks, which sorts them concurrently on the
+ * application's workers. They are then merged back into @p me by relinking.
+ * No memory is allocated. If the list has fewer than @p cutover nodes it is
+ * sorted in place with @ref ecu_dlist_sort() and @p sort_chunks is not called.
+ *
+ * @warning ECU does not create threads. @p sort_chunks must call @ref ecu_dlist_sort()
+ * on every chunk with the supplied comparator and only return once all chunks are
+ * sorted. Each chunk is an independent list so chunks can be sorted concurrently
+ * without locking. No other list functions can be called on @p me until this
+ * function returns.
+ *
+ * @param me List to sort.
+ * @param chunks Caller-provided array of empty lists used as scratch space.
+ * All lists are empty again when this function returns. The number of lists
+ * determines the number of concurrent sorts, usually the number of workers.
+ * @param count Number of lists in @p chunks. Must be at least 1.
+ * @param cutover Lists smaller than this are sorted serially. Splitting
+ * small lists costs more than it saves.
+ * @param lhs_less_than_rhs Mandatory function that defines sorting condition.
+ * Return true if left node (lhs) is less than right node (rhs). Otherwise return
+ * false. Can be called concurrently from multiple workers.
+ * @param data Optional object to pass to @p lhs_less_than_rhs. Supply
+ * @ref ECU_DNODE_OBJ_UNUSED if unused.
+ * @param sort_chunks Mandatory function that sorts all chunks. First two
+ * parameters are @p chunks and the number of chunks to sort. Followed by
+ * @p lhs_less_than_rhs and @p data which must be passed to @ref ecu_dlist_sort().
+ * Last parameter is @p obj.
+ * @param obj Optional object to pass to @p sort_chunks, such as the application's
+ * worker pool. Supply @ref ECU_DNODE_OBJ_UNUSED if unused.
+ */
+extern void ecu_dlist_sort_parallel(struct ecu_dlist *me,
+                                    struct ecu_dlist *chunks,
+                                    size_t count,
+                                    size_t cutover,
+                                    bool (*lhs_less_than_rhs)(const struct ecu_dnode *lhs, const struct ecu_dnode *rhs, void *data),
+                                    void *data,
+                                    void (*sort_chunks)(struct ecu_dlist *chunks,
+                                                        size_t count,
+                                                        bool (*lhs_less_than_rhs)(const struct ecu_dnode *lhs, const struct ecu_dnode *rhs, void *data),
+                                                        void *data,
+                                                        void *obj),
+                                    void *obj);
+
+/**
+ * @pre @p me and @p other previously constructed via call to @ref ecu_dlist_ctor().
+ * @brief Moves all nodes in @p other to the back of @p me in O(1) by relinking
+ * the ends of both lists. Node order is preserved. @p other becomes empty.
+ *
+ * @param me List to add to. This cannot equal @p other.
+ * @param other List to move nodes from. This cannot equal @p me. Becomes empty.
+ */
+extern void ecu_dlist_splice(struct ecu_dlist *me, struct ecu_dlist *other);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_dlist_ctor().
+ * @pre Every list in @p chunks previously constructed via call to @ref ecu_dlist_ctor()
+ * and empty.
+ * @brief Moves all nodes in @p me into @p count contiguous chunks of nearly equal
+ * size in O(n). Node order is preserved. I.e. concatenating the chunks in order
+ * recreates the original list. @p me becomes empty. Returns the number of chunks
+ * that received nodes, which is less than @p count if the list has fewer than
+ * @p count nodes.
+ *
+ * @param me List to split.
+ * @param chunks Array of empty lists to move nodes into.
+ * @param count Number of lists in @p chunks. Must be at least 1.
+ */
+extern size_t ecu_dlist_split(struct ecu_dlist *me, struct ecu_dlist *chunks, size_t count);
+
 /**
  * @pre @p me and @p other previously constructed via call to @ref ecu_dlist_ctor().
  * @brief Swaps nodes between two lists. If one list is empty, the swapped
@@ -731,6 +906,95 @@ extern const struct ecu_dnode *ecu_dlist_iterator_cend(struct ecu_dlist_citerato
  * @param me Const iterator.
  */
 extern const struct ecu_dnode *ecu_dlist_iterator_cnext(struct ecu_dlist_citerator *me);
+
+/*------------------------------------------------------------*/
+/*------------ PREFETCH ITERATOR MEMBER FUNCTIONS ------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @pre Memory already allocated for @p me
+ * @pre @p list previously constructed via call to @ref ecu_dlist_ctor().
+ * @brief Same as @ref ecu_dlist_iterator_begin() but also prefetches
+ * the first @p distance nodes in the list.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_DLIST_FOR_EACH_PREFETCH()
+ * instead.
+ *
+ * @param me Non-const prefetch iterator to initialize.
+ * @param list List to iterate over.
+ * @param distance Number of nodes ahead of the current node to prefetch.
+ * 0 disables prefetching.
+ */
+extern struct ecu_dnode *ecu_dlist_prefetch_iterator_begin(struct ecu_dlist_prefetch_iterator *me,
+                                                           struct ecu_dlist *list,
+                                                           size_t distance);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_dlist_prefetch_iterator_begin().
+ * @brief Same as @ref ecu_dlist_iterator_end(). Returns list's terminal
+ * node, which is HEAD (@ref ecu_dlist.head).
+ *
+ * @warning The node returned by this function should never be used
+ * since it is HEAD(@ref ecu_dlist.head) which is a dummy delimiter.
+ * @warning Not meant to be used directly. Use @ref ECU_DLIST_FOR_EACH_PREFETCH()
+ * instead.
+ *
+ * @param me Non-const prefetch iterator.
+ */
+extern struct ecu_dnode *ecu_dlist_prefetch_iterator_end(struct ecu_dlist_prefetch_iterator *me);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_dlist_prefetch_iterator_begin().
+ * @brief Same as @ref ecu_dlist_iterator_next() but also advances the
+ * prefetch position by one node.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_DLIST_FOR_EACH_PREFETCH()
+ * instead.
+ *
+ * @param me Non-const prefetch iterator.
+ */
+extern struct ecu_dnode *ecu_dlist_prefetch_iterator_next(struct ecu_dlist_prefetch_iterator *me);
+
+/**
+ * @pre Memory already allocated for @p me
+ * @pre @p list previously constructed via call to @ref ecu_dlist_ctor().
+ * @brief Const-qualified version of @ref ecu_dlist_prefetch_iterator_begin().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_DLIST_CONST_FOR_EACH_PREFETCH()
+ * instead.
+ *
+ * @param me Const prefetch iterator to initialize.
+ * @param list List to iterate over.
+ * @param distance Number of nodes ahead of the current node to prefetch.
+ * 0 disables prefetching.
+ */
+extern const struct ecu_dnode *ecu_dlist_prefetch_iterator_cbegin(struct ecu_dlist_prefetch_citerator *me,
+                                                                  const struct ecu_dlist *list,
+                                                                  size_t distance);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_dlist_prefetch_iterator_cbegin().
+ * @brief Const-qualified version of @ref ecu_dlist_prefetch_iterator_end().
+ *
+ * @warning The node returned by this function should never be used
+ * since it is HEAD(@ref ecu_dlist.head) which is a dummy delimiter.
+ * @warning Not meant to be used directly. Use @ref ECU_DLIST_CONST_FOR_EACH_PREFETCH()
+ * instead.
+ *
+ * @param me Const prefetch iterator.
+ */
+extern const struct ecu_dnode *ecu_dlist_prefetch_iterator_cend(struct ecu_dlist_prefetch_citerator *me);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_dlist_prefetch_iterator_cbegin().
+ * @brief Const-qualified version of @ref ecu_dlist_prefetch_iterator_next().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_DLIST_CONST_FOR_EACH_PREFETCH()
+ * instead.
+ *
+ * @param me Const prefetch iterator.
+ */
+extern const struct ecu_dnode *ecu_dlist_prefetch_iterator_cnext(struct ecu_dlist_prefetch_citerator *me);
 /**@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,372 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`exec.h section <exec_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @warning ECU does not create threads. The user creates one thread
+ * per worker and calls @ref ecu_exec_run_once() from it in a loop.
+ *
+ * @warning Requires GNU atomic builtins (GCC and Clang). The
+ * functions in this file are not compiled by other compilers.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_EXEC_H_
+#define ECU_EXEC_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ECU. */
+#include "ecu/ao.h"
+#include "ecu/dlist.h"
+#include "ecu/event.h"
+#include "ecu/fsm.h"
+#include "ecu/hsm.h"
+#include "ecu/mpsc.h"
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Number of bytes between the start of two consecutive
+ * event slots in an @ref ecu_exec_ao mailbox. Every slot holds a
+ * sequence number followed by the event, both aligned to
+ * @ref ECU_AO_ALIGNMENT.
+ *
+ * @param event_size_ Size of the largest event that will be posted.
+ */
+#define ECU_EXEC_SLOT_SIZE(event_size_) \
+    (ECU_AO_SLOT_SIZE(sizeof(size_t)) + ECU_AO_SLOT_SIZE(event_size_))
+
+/**
+ * @brief Number of bytes an @ref ecu_exec_ao buffer needs to queue
+ * a number of events regardless of how the buffer is aligned.
+ * Includes one extra slot that holds the event being dispatched.
+ * Can be used to size buffers at compile-time.
+ *
+ * @param event_size_ Size of the largest event that will be posted.
+ * @param events_ Number of events that can be queued at once.
+ * Should be a power of two, otherwise the remaining slots are unused.
+ */
+#define ECU_EXEC_BUFFER_SIZE(event_size_, events_) \
+    ((ECU_EXEC_SLOT_SIZE(event_size_) * ((size_t)(events_) + 1)) + ECU_AO_ALIGNMENT - 1)
+
+/*------------------------------------------------------------*/
+/*--------------------------- EXEC ---------------------------*/
+/*------------------------------------------------------------*/
+
+/* Forward declaration for ecu_exec_ao. */
+struct ecu_exec_worker;
+
+/**
+ * @brief Active object run by an @ref ecu_exec. Same as @ref ecu_ao
+ * except its mailbox is a lock-free multi-producer queue, so any
+ * thread can post to it while a worker thread dispatches it.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_exec_ao
+{
+    /// @brief Links this object into its home worker's inbox
+    /// when it is scheduled.
+    struct ecu_dnode node;
+
+    /// @brief State machine events are dispatched to. NULL if
+    /// this object runs an hsm.
+    struct ecu_fsm *fsm;
+
+    /// @brief State machine events are dispatched to. NULL if
+    /// this object runs an fsm.
+    struct ecu_hsm *hsm;
+
+    /// @brief First slot. Aligned to @ref ECU_AO_ALIGNMENT.
+    /// The slot after the last mailbox slot holds the event
+    /// being dispatched.
+    uint8_t *slots;
+
+    /// @brief Number of bytes between consecutive slots.
+    size_t slot_size;
+
+    /// @brief Number of mailbox slots minus 1. Capacity is
+    /// always a power of two.
+    size_t mask;
+
+    /// @brief Position of the oldest event. Only accessed by
+    /// the worker currently running this object.
+    size_t head;
+
+    /// @brief Position the next post is written to. Reserved
+    /// by producers with compare-and-swap.
+    size_t tail;
+
+    /// @brief True from the moment this object is scheduled
+    /// until a worker finds its mailbox empty. Guarantees it is
+    /// in at most one run queue and on at most one thread.
+    bool scheduled;
+
+    /// @brief Worker whose inbox this object is scheduled on.
+    /// NULL until added to an executor.
+    struct ecu_exec_worker *home;
+};
+
+/**
+ * @brief One worker of an @ref ecu_exec. Run by a single user
+ * thread. Holds a work-stealing deque of scheduled active objects
+ * and an inbox other threads schedule onto.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_exec_worker
+{
+    /// @brief User-supplied ring of scheduled active objects.
+    struct ecu_exec_ao **deque;
+
+    /// @brief Number of elements in @ref deque minus 1.
+    /// Capacity is always a power of two.
+    size_t mask;
+
+    /// @brief Position one past the newest object. Only
+    /// written by the owning thread.
+    size_t bottom;
+
+    /// @brief Position of the oldest object. Advanced with
+    /// compare-and-swap by the owner and thieves, which both
+    /// take from this end so every object gets a turn.
+    size_t top;
+
+    /// @brief Active objects scheduled by posts. Any thread
+    /// pushes. Only the owning thread pops.
+    struct ecu_mpsc inbox;
+
+    /// @brief Next worker to steal from. Only accessed by the
+    /// owning thread.
+    size_t victim;
+};
+
+/**
+ * @brief Multi-threaded executor for active objects. Every active
+ * object is assigned a home worker. Posting to an idle object
+ * schedules it on its home worker's inbox. Idle workers steal
+ * scheduled objects from other workers' deques. An object is
+ * only ever dispatched by one worker at a time, so run-to-completion
+ * holds without locking the state machine.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_exec
+{
+    /// @brief User-supplied workers.
+    struct ecu_exec_worker *workers;
+
+    /// @brief Number of elements in @ref workers.
+    size_t count;
+
+    /// @brief Maximum number of events dispatched to an object
+    /// before it is rescheduled behind other work.
+    size_t budget;
+
+    /// @brief Home worker assigned to the next added object.
+    size_t next;
+};
+
+/*------------------------------------------------------------*/
+/*------------------- EXEC MEMBER FUNCTIONS ------------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Exec Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me, @p workers and @p deques.
+ * @brief Executor constructor. Every worker starts out with an
+ * empty deque and inbox.
+ *
+ * @warning No worker thread can be running while @p me is constructed.
+ *
+ * @param me Executor to construct.
+ * @param workers Array of @p count workers. Must stay valid for the
+ * lifetime of @p me.
+ * @param count Number of elements in @p workers. Must be greater than 0.
+ * @param deques Array of @p count * @p capacity elements split evenly
+ * between workers. Must stay valid for the lifetime of @p me.
+ * @param capacity Number of scheduled objects each worker's deque
+ * holds. Must be a power of two. Objects that do not fit wait in
+ * the worker's inbox instead, so this only limits how much work can
+ * be stolen at once.
+ * @param budget Maximum number of events dispatched to an object per
+ * turn. Must be greater than 0. Lower values are fairer, higher
+ * values have less scheduling overhead.
+ */
+extern void ecu_exec_ctor(struct ecu_exec *me,
+                          struct ecu_exec_worker *workers,
+                          size_t count,
+                          struct ecu_exec_ao **deques,
+                          size_t capacity,
+                          size_t budget);
+/**@}*/
+
+/**
+ * @name Exec Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me constructed via @ref ecu_exec_ctor().
+ * @pre @p ao constructed via @ref ecu_exec_ao_fsm_ctor() or
+ * @ref ecu_exec_ao_hsm_ctor().
+ * @brief Assigns @p ao a home worker. Objects are spread over the
+ * workers round-robin. Events already posted are scheduled.
+ *
+ * @warning Must be called before worker threads are started.
+ *
+ * @param me Executor to add to.
+ * @param ao Active object to run. Cannot be in another executor.
+ */
+extern void ecu_exec_add(struct ecu_exec *me, struct ecu_exec_ao *ao);
+
+/**
+ * @pre @p me constructed via @ref ecu_exec_ctor().
+ * @brief Worker thread function. Runs up to one turn of one
+ * scheduled active object, dispatching at most the executor's budget
+ * of events. Objects scheduled on the worker's inbox are first moved
+ * into its deque so idle workers can steal them. The oldest object in
+ * the deque is run, or one is stolen from another worker if the deque
+ * is empty. Objects that use up the budget go to the back of the
+ * deque. Returns true if an object was run. False if no work was
+ * found, in which case the caller can yield or sleep before trying
+ * again.
+ *
+ * @warning Each worker index can only be run by one thread.
+ *
+ * @param me Executor to run.
+ * @param worker Index of the calling thread's worker. Must be
+ * less than the number of workers.
+ */
+extern bool ecu_exec_run_once(struct ecu_exec *me, size_t worker);
+/**@}*/
+
+/*------------------------------------------------------------*/
+/*----------------- EXEC AO MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Exec Ao Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p fsm constructed via @ref ecu_fsm_ctor().
+ * @brief Active object constructor for a flat state machine.
+ * Splits @p buffer into the largest power of two number of event
+ * slots that fit after aligning it to @ref ECU_AO_ALIGNMENT, plus
+ * the dispatch slot. The mailbox starts out empty.
+ *
+ * @warning @p me and @p buffer must not be an active object with
+ * queued events, otherwise behavior is undefined.
+ *
+ * @param me Active object to construct.
+ * @param fsm State machine to dispatch events to. Must stay valid
+ * for the lifetime of @p me and should only be run through it.
+ * @param buffer Memory events are queued in. Must stay valid for
+ * the lifetime of @p me. Use @ref ECU_EXEC_BUFFER_SIZE() to size it.
+ * @param size Number of bytes in @p buffer. Must hold at least
+ * two slots, one mailbox slot and the dispatch slot.
+ * @param event_size Size of the largest event that will be posted.
+ * Must be at least sizeof(struct ecu_event).
+ */
+extern void ecu_exec_ao_fsm_ctor(struct ecu_exec_ao *me,
+                                 struct ecu_fsm *fsm,
+                                 void *buffer,
+                                 size_t size,
+                                 size_t event_size);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p hsm constructed via @ref ecu_hsm_ctor().
+ * @brief Same as @ref ecu_exec_ao_fsm_ctor() but events are
+ * dispatched to a hierarchical state machine.
+ *
+ * @param me Active object to construct.
+ * @param hsm State machine to dispatch events to. Must stay valid
+ * for the lifetime of @p me and should only be run through it.
+ * @param buffer Memory events are queued in. Must stay valid for
+ * the lifetime of @p me. Use @ref ECU_EXEC_BUFFER_SIZE() to size it.
+ * @param size Number of bytes in @p buffer. Must hold at least
+ * two slots, one mailbox slot and the dispatch slot.
+ * @param event_size Size of the largest event that will be posted.
+ * Must be at least sizeof(struct ecu_event).
+ */
+extern void ecu_exec_ao_hsm_ctor(struct ecu_exec_ao *me,
+                                 struct ecu_hsm *hsm,
+                                 void *buffer,
+                                 size_t size,
+                                 size_t event_size);
+/**@}*/
+
+/**
+ * @name Exec Ao Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me constructed via @ref ecu_exec_ao_fsm_ctor() or
+ * @ref ecu_exec_ao_hsm_ctor().
+ * @brief Returns the maximum number of events that can be queued.
+ *
+ * @param me Active object to check.
+ */
+extern size_t ecu_exec_ao_capacity(const struct ecu_exec_ao *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_exec_ao_fsm_ctor() or
+ * @ref ecu_exec_ao_hsm_ctor().
+ * @brief Copies @p event into the mailbox and schedules the object
+ * if it was idle. Lock-free and safe to call concurrently from any
+ * thread, including handlers running on a worker. Returns false
+ * without copying anything if the mailbox is full. Events from the
+ * same thread are dispatched in the order they were posted.
+ *
+ * @param me Active object to post to. Must have been added to an
+ * executor if any worker is running.
+ * @param event Event to copy. Its size must be set and cannot exceed
+ * the event size given to the constructor.
+ */
+extern bool ecu_exec_ao_post(struct ecu_exec_ao *me, const struct ecu_event *event);
+
+/**
+ * @pre @p me constructed via @ref ecu_exec_ao_fsm_ctor() or
+ * @ref ecu_exec_ao_hsm_ctor().
+ * @brief Starts the active object's state machine.
+ *
+ * @warning Must be called once, before worker threads are started.
+ *
+ * @param me Active object to start.
+ */
+extern void ecu_exec_ao_start(struct ecu_exec_ao *me);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_EXEC_H_ */
@@ -24,6 +24,7 @@
 #include <stdint.h>
 
 /* ECU. */
+#include "ecu/dlist.h"
 #include "ecu/utils.h"
 
 /*------------------------------------------------------------*/
@@ -200,6 +201,47 @@ extern void ecu_fsm_change_state(struct ecu_fsm *me, const struct ecu_fsm_state
  */
 extern void ecu_fsm_dispatch(struct ecu_fsm *me, const void *event);
 
+/**
+ * @pre @p me constructed via @ref ecu_fsm_ctor().
+ * @brief Dispatches @p count events stored back-to-back in
+ * @p events, in order. Same as calling @ref ecu_fsm_dispatch()
+ * on each event except the fsm is only validated once for the
+ * whole batch. State transitions are still handled after every
+ * event.
+ *
+ * @warning This function must run to completion. Handlers
+ * cannot modify @p events.
+ *
+ * @param me Fsm to run.
+ * @param events Array of events to dispatch. This cannot be NULL.
+ * @param count Number of events in @p events. Nothing is dispatched
+ * if this is 0.
+ * @param size Number of bytes between the start of two consecutive
+ * events. I.e. sizeof() the array's element type. Must be greater than 0.
+ */
+extern void ecu_fsm_dispatch_array(struct ecu_fsm *me, const void *events, size_t count, size_t size);
+
+/**
+ * @pre @p me constructed via @ref ecu_fsm_ctor().
+ * @pre @p events constructed via @ref ecu_dlist_ctor().
+ * @brief Dispatches every event in @p events from front to
+ * back. Same as @ref ecu_fsm_dispatch_array() except events
+ * are linked through an intrusive @ref ecu_dnode member. Each
+ * handler receives the event containing the node, not the node
+ * itself, so the same handler works with every dispatch function.
+ *
+ * @warning This function must run to completion. Handlers
+ * cannot add or remove nodes in @p events.
+ *
+ * @param me Fsm to run.
+ * @param events List of events to dispatch. Nothing is dispatched
+ * if the list is empty.
+ * @param node_offset Offset of the @ref ecu_dnode member within
+ * the user's event type. I.e. offsetof(struct my_event, node).
+ * Every event in @p events must be the same type.
+ */
+extern void ecu_fsm_dispatch_list(struct ecu_fsm *me, const struct ecu_dlist *events, size_t node_offset);
+
 /**
  * @pre @p me constructed via @ref ecu_fsm_ctor().
  * @brief Runs the initial state's entry handler and manages
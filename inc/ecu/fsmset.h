@@ -0,0 +1,311 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`fsmset.h section <fsmset_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_FSMSET_H_
+#define ECU_FSMSET_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stddef.h>
+#include <stdint.h>
+
+/* ECU. */
+#include "ecu/utils.h"
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Converts intrusive @ref ecu_fsmset member into the
+ * user's type. This should be used inside each state's handlers.
+ *
+ * @param ecu_fsmset_ptr_ Pointer to intrusive @ref ecu_fsmset.
+ * This must be pointer to non-const. I.e. (struct ecu_fsmset *).
+ * @param type_ User's type containing the intrusive
+ * @ref ecu_fsmset member. Do not use const specifier. I.e.
+ * (struct my_type), never (const struct my_type).
+ * @param member_ Name of @ref ecu_fsmset member within user's
+ * type.
+ */
+#define ECU_FSMSET_GET_CONTEXT(ecu_fsmset_ptr_, type_, member_) \
+    ECU_CONTAINER_OF(ecu_fsmset_ptr_, type_, member_)
+
+/**
+ * @brief Helper macro supplied to @ref ECU_FSMSET_STATE_CTOR()
+ * if the state's entry handler is unused.
+ */
+#define ECU_FSMSET_STATE_ENTRY_UNUSED \
+    ((void (*)(struct ecu_fsmset *, size_t))0)
+
+/**
+ * @brief Helper macro supplied to @ref ECU_FSMSET_STATE_CTOR()
+ * if the state's exit handler is unused.
+ */
+#define ECU_FSMSET_STATE_EXIT_UNUSED \
+    ((void (*)(struct ecu_fsmset *, size_t))0)
+
+/**
+ * @brief Creates an @ref ecu_fsmset_state at compile-time.
+ * States are stored in an array and referred to by their
+ * index in it.
+ *
+ * @param entry_ Optional function that executes when an instance
+ * enters this state. Of type (void (*)(struct ecu_fsmset *, size_t)).
+ * Supply @ref ECU_FSMSET_STATE_ENTRY_UNUSED if unused.
+ * @param exit_ Optional function that executes when an instance
+ * exits this state. Of type (void (*)(struct ecu_fsmset *, size_t)).
+ * Supply @ref ECU_FSMSET_STATE_EXIT_UNUSED if unused.
+ * @param handler_ Mandatory function that processes an event for
+ * a batch of instances in this state. Of type
+ * (void (*)(struct ecu_fsmset *, const size_t *, size_t, const void *)).
+ */
+#define ECU_FSMSET_STATE_CTOR(entry_, exit_, handler_) \
+    {                                                  \
+        .entry = (entry_),                             \
+        .exit = (exit_),                               \
+        .handler = (handler_)                          \
+    }
+
+/**
+ * @brief Number of bytes the buffer supplied to
+ * @ref ecu_fsmset_ctor() needs, regardless of how it is aligned.
+ * Can be used to size buffers at compile-time.
+ *
+ * @param instances_ Number of instances in the set.
+ * @param states_ Number of states in the state array.
+ */
+#define ECU_FSMSET_BUFFER_SIZE(instances_, states_)                      \
+    ((sizeof(size_t) * ((size_t)(instances_) + (size_t)(states_) + 1)) + \
+     (sizeof(ecu_fsmset_state_t) * (size_t)(instances_)) +               \
+     (sizeof(uint8_t) * (size_t)(instances_)) +                          \
+     sizeof(size_t) - 1)
+
+/*------------------------------------------------------------*/
+/*-------------------------- FSMSET --------------------------*/
+/*------------------------------------------------------------*/
+
+/* Forward declaration for ecu_fsmset_state. */
+struct ecu_fsmset;
+
+/**
+ * @brief Index of a state in the array supplied to
+ * @ref ecu_fsmset_ctor().
+ */
+typedef uint16_t ecu_fsmset_state_t;
+
+/**
+ * @brief Single state shared by every instance in an
+ * @ref ecu_fsmset. Handlers receive instance indices instead
+ * of objects, so the user stores per-instance data in arrays
+ * indexed the same way.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_fsmset_state
+{
+    /// @brief Executes when an instance enters this state. Optional.
+    void (*entry)(struct ecu_fsmset *me, size_t instance);
+
+    /// @brief Executes when an instance exits this state. Optional.
+    void (*exit)(struct ecu_fsmset *me, size_t instance);
+
+    /// @brief Processes an event for every instance in the batch.
+    /// Instances are in ascending order and all in this state. Mandatory.
+    void (*handler)(struct ecu_fsmset *me, const size_t *instances, size_t count, const void *event);
+};
+
+/**
+ * @brief Set of identical finite state machines. Every
+ * instance's state and transition flags are stored in
+ * separate contiguous arrays so a broadcast scans them
+ * sequentially. Instances are grouped by state and each
+ * state's handler runs once per group.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_fsmset
+{
+    /// @brief User-supplied array of states.
+    const struct ecu_fsmset_state *states;
+
+    /// @brief Number of elements in @ref states.
+    ecu_fsmset_state_t state_count;
+
+    /// @brief Current state of every instance.
+    ecu_fsmset_state_t *state;
+
+    /// @brief Transition bitmap of every instance.
+    uint8_t *transition;
+
+    /// @brief Instance indices grouped by state. Built by
+    /// @ref ecu_fsmset_group().
+    size_t *order;
+
+    /// @brief Start of each state's group in @ref order.
+    /// Has @ref state_count + 1 elements.
+    size_t *offsets;
+
+    /// @brief Number of instances.
+    size_t count;
+};
+
+/*------------------------------------------------------------*/
+/*------------------ FSMSET MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me and @p buffer.
+ * @pre Every element in @p states constructed via @ref ECU_FSMSET_STATE_CTOR().
+ * @brief Fsmset constructor. Every instance starts in @p initial.
+ * Entry handlers do not run until @ref ecu_fsmset_start().
+ *
+ * @param me Set to construct.
+ * @param states Array of states. Must stay valid for the lifetime
+ * of @p me.
+ * @param state_count Number of elements in @p states. Must be
+ * greater than 0.
+ * @param initial Index of every instance's initial state.
+ * @param buffer Memory the instances' state and scratch space is
+ * stored in. Must stay valid for the lifetime of @p me.
+ * @param size Number of bytes in @p buffer. Use
+ * @ref ECU_FSMSET_BUFFER_SIZE() to size it.
+ * @param count Number of instances. Must be greater than 0.
+ */
+extern void ecu_fsmset_ctor(struct ecu_fsmset *me,
+                            const struct ecu_fsmset_state *states,
+                            ecu_fsmset_state_t state_count,
+                            ecu_fsmset_state_t initial,
+                            void *buffer,
+                            size_t size,
+                            size_t count);
+/**@}*/
+
+/**
+ * @name Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me constructed via @ref ecu_fsmset_ctor().
+ * @brief Transitions one instance into a new state. Same rules
+ * as @ref ecu_fsm_change_state(). Exit and entry handlers run
+ * once the handler that called this returns.
+ *
+ * @warning This must only be called within a state's handler
+ * or entry handler, once per instance.
+ *
+ * @param me Set that contains the instance.
+ * @param instance Instance to transition. Must be less than
+ * @ref ecu_fsmset_count().
+ * @param state State to transition into. If it is the instance's
+ * current state a self-transition occurs.
+ */
+extern void ecu_fsmset_change_state(struct ecu_fsmset *me, size_t instance, ecu_fsmset_state_t state);
+
+/**
+ * @pre @p me constructed via @ref ecu_fsmset_ctor().
+ * @brief Returns the current state of an instance.
+ *
+ * @param me Set that contains the instance.
+ * @param instance Instance to check. Must be less than
+ * @ref ecu_fsmset_count().
+ */
+extern ecu_fsmset_state_t ecu_fsmset_current_state(const struct ecu_fsmset *me, size_t instance);
+
+/**
+ * @pre @p me constructed via @ref ecu_fsmset_ctor().
+ * @brief Returns the number of instances in the set.
+ *
+ * @param me Set to check.
+ */
+extern size_t ecu_fsmset_count(const struct ecu_fsmset *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_fsmset_ctor().
+ * @brief Dispatches @p event to every instance. Same as
+ * @ref ecu_fsmset_group() followed by @ref ecu_fsmset_run()
+ * with a single slice.
+ *
+ * @warning This function must run to completion.
+ *
+ * @param me Set to run.
+ * @param event Event to dispatch. This cannot be NULL.
+ */
+extern void ecu_fsmset_broadcast(struct ecu_fsmset *me, const void *event);
+
+/**
+ * @pre @p me constructed via @ref ecu_fsmset_ctor().
+ * @brief Groups instances by their current state in O(n + states).
+ * Must be called before @ref ecu_fsmset_run(). The grouping is a
+ * snapshot, so an instance that changes state during a run still
+ * only receives the event once.
+ *
+ * @param me Set to group.
+ */
+extern void ecu_fsmset_group(struct ecu_fsmset *me);
+
+/**
+ * @pre @p me grouped via @ref ecu_fsmset_group().
+ * @brief Dispatches @p event to one slice of every group. Each
+ * state's group is split into @p slices contiguous parts and the
+ * state's handler runs once on part @p slice, followed by the exit
+ * and entry handlers of every instance that transitioned. For each
+ * instance the handlers run in the same order as
+ * @ref ecu_fsm_dispatch(). Slices do not share instances, so
+ * different slices can be run on different threads at the same time.
+ *
+ * @warning ECU does not create threads. Every slice must be run
+ * exactly once before the set is grouped again. Handlers running
+ * on different threads can only edit data of their own instances.
+ *
+ * @param me Set to run.
+ * @param event Event to dispatch. This cannot be NULL.
+ * @param slice Slice to run. Must be less than @p slices.
+ * @param slices Number of slices. Usually the number of threads.
+ * Must be greater than 0.
+ */
+extern void ecu_fsmset_run(struct ecu_fsmset *me, const void *event, size_t slice, size_t slices);
+
+/**
+ * @pre @p me constructed via @ref ecu_fsmset_ctor().
+ * @brief Runs the initial state's entry handler of every instance
+ * and manages all state transitions it signals. Same as
+ * @ref ecu_fsm_start() for each instance. Does nothing if the
+ * initial state's entry handler is unused.
+ *
+ * @warning This function should only be called once on
+ * startup and must run to completion.
+ *
+ * @param me Set to start.
+ */
+extern void ecu_fsmset_start(struct ecu_fsmset *me);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_FSMSET_H_ */
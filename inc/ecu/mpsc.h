@@ -0,0 +1,155 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`mpsc.h section <mpsc_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @warning Any number of producers (threads, ISRs) can push to the
+ * same queue concurrently. However only one consumer is allowed. It is
+ * the user's responsibility to ensure all consumer functions are called
+ * from a single context.
+ *
+ * @warning Requires GNU atomic builtins (GCC and Clang). The
+ * functions in this file are not compiled by other compilers.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_MPSC_H_
+#define ECU_MPSC_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Queued nodes and consumer-side list. */
+#include "ecu/dlist.h"
+
+/*------------------------------------------------------------*/
+/*--------------------------- MPSC ---------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Intrusive, lock-free, multi-producer single-consumer queue.
+ * Nodes are regular @ref ecu_dnode objects so user-defined types
+ * are embedded and retrieved the same way as @ref ecu_dlist, via
+ * @ref ECU_DNODE_GET_ENTRY(). Push is wait-free. Nodes are
+ * consumed in FIFO order.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_mpsc
+{
+    /// @brief Most recently pushed node. Atomically exchanged
+    /// by producers. Equals @ref ecu_mpsc.stub when the queue
+    /// is constructed.
+    struct ecu_dnode *head;
+
+    /// @brief Oldest node that has not been consumed yet. Only
+    /// accessed by the consumer.
+    struct ecu_dnode *tail;
+
+    /// @brief Dummy node that is never returned to the user.
+    /// Allows producers and the consumer to work on opposite
+    /// ends of the queue without sharing state when the queue
+    /// is not empty.
+    struct ecu_dnode stub;
+};
+
+/*------------------------------------------------------------*/
+/*-------------------- MPSC MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Mpsc Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @brief MPSC queue constructor.
+ *
+ * @warning @p me must not be an active queue with nodes pushed
+ * to it, otherwise behavior is undefined. No producer or consumer
+ * can access @p me while it is being constructed.
+ *
+ * @param me Queue to construct.
+ */
+extern void ecu_mpsc_ctor(struct ecu_mpsc *me);
+/**@}*/
+
+/**
+ * @name Mpsc Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me previously constructed via @ref ecu_mpsc_ctor().
+ * @brief Consumer-side function. Pops every node that is currently
+ * visible in the queue and pushes them to the back of @p list, in
+ * FIFO order. Nodes pushed concurrently with this call may or may
+ * not be drained. They are returned by the next drain if not.
+ * Returns the number of nodes added to @p list.
+ *
+ * @param me Queue to drain.
+ * @param list List to move popped nodes into. Nodes currently
+ * in this list are kept.
+ */
+extern size_t ecu_mpsc_drain(struct ecu_mpsc *me, struct ecu_dlist *list);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_mpsc_ctor().
+ * @brief Consumer-side function. Returns true if no nodes are
+ * in the queue. False otherwise. A push that has not fully
+ * completed is reported as a non-empty queue.
+ *
+ * @param me Queue to check.
+ */
+extern bool ecu_mpsc_empty(const struct ecu_mpsc *me);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_mpsc_ctor().
+ * @brief Consumer-side function. Removes and returns the oldest
+ * node in the queue. The returned node is no longer in the queue
+ * and can be pushed into any @ref ecu_dlist or @ref ecu_mpsc.
+ * Returns NULL if the queue is empty. NULL is also returned if the
+ * next node in line is still being linked in by a producer that
+ * was preempted during @ref ecu_mpsc_push(). It is returned in a
+ * future call once the producer resumes.
+ *
+ * @param me Queue to pop from.
+ */
+extern struct ecu_dnode *ecu_mpsc_pop(struct ecu_mpsc *me);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_mpsc_ctor().
+ * @pre @p node previously constructed via @ref ecu_dnode_ctor().
+ * @brief Producer-side function. Adds a node to the back of the
+ * queue. Wait-free and safe to call concurrently from any number
+ * of threads or ISRs.
+ *
+ * @warning @p node cannot be in a list and is owned by the queue
+ * until it is popped. The user must not access it until then.
+ *
+ * @param me Queue to push to.
+ * @param node Node to add.
+ */
+extern void ecu_mpsc_push(struct ecu_mpsc *me, struct ecu_dnode *node);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_MPSC_H_ */
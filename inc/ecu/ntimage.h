@@ -0,0 +1,193 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ntimage.h section <ntimage_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_NTIMAGE_H_
+#define ECU_NTIMAGE_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stddef.h>
+#include <stdint.h>
+
+/* ECU. */
+#include "ecu/ntnode.h"
+#include "ecu/object_id.h"
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Number of bytes at the start of every image, before
+ * the first node record.
+ */
+#define ECU_NTIMAGE_HEADER_SIZE \
+    ((size_t)12)
+
+/**
+ * @brief Number of bytes every node takes up in an image.
+ *
+ * @param payload_size_ Number of payload bytes stored with each node.
+ */
+#define ECU_NTIMAGE_RECORD_SIZE(payload_size_) \
+    ((size_t)8 + (size_t)(payload_size_))
+
+/**
+ * @brief Number of bytes required to store an image of a tree.
+ * Can be used to size buffers at compile-time if the number of
+ * nodes is known.
+ *
+ * @param nodes_ Number of nodes in the tree, including the root.
+ * @param payload_size_ Number of payload bytes stored with each node.
+ */
+#define ECU_NTIMAGE_SIZE(nodes_, payload_size_) \
+    (ECU_NTIMAGE_HEADER_SIZE + ((size_t)(nodes_) * ECU_NTIMAGE_RECORD_SIZE(payload_size_)))
+
+/**
+ * @brief Convenience define for @ref ecu_ntimage_save() and
+ * @ref ecu_ntimage_load(). Pass this value if optional
+ * callback object is not needed.
+ */
+#define ECU_NTIMAGE_OBJ_UNUSED \
+    ((void *)0)
+
+/**
+ * @brief Convenience define for @ref ecu_ntimage_save(). Pass
+ * this value if nodes have no payload.
+ */
+#define ECU_NTIMAGE_SAVE_UNUSED \
+    ((void (*)(const struct ecu_ntnode *, void *, void *))0)
+
+/**
+ * @brief Convenience define for @ref ecu_ntimage_load(). Pass
+ * this value if nodes have no payload or it is not needed.
+ */
+#define ECU_NTIMAGE_LOAD_UNUSED \
+    ((void (*)(struct ecu_ntnode *, const void *, void *))0)
+
+/*------------------------------------------------------------*/
+/*----------------- NTIMAGE MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Ntimage Member Functions
+ */
+/**@{*/
+/**
+ * @brief Returns the number of nodes stored in an image. Used to
+ * check that enough nodes are available before calling
+ * @ref ecu_ntimage_load(). Returns 0 if @p image is not an image,
+ * i.e. @p size is smaller than the header or the header was not
+ * written by @ref ecu_ntimage_save().
+ *
+ * @param image Image to read. This cannot be NULL.
+ * @param size Number of bytes in @p image.
+ */
+extern size_t ecu_ntimage_count(const void *image, size_t size);
+
+/**
+ * @pre @p image previously created via @ref ecu_ntimage_save().
+ * @pre Every node in @p nodes is not in a tree or was destroyed.
+ * @brief Reconstructs a saved tree in one linear pass over the image.
+ * Node i of the image is constructed in nodes[i] and linked under its
+ * parent. Nodes are stored in preorder so a parent is always loaded
+ * before its children. Returns the root, which is nodes[0]. Returns
+ * NULL without touching @p nodes if the header is invalid, @p size
+ * is too small for the number of records the header lists, or
+ * @p capacity is less than @ref ecu_ntimage_count().
+ *
+ * @details The image is checked once up front, even if asserts are
+ * disabled. Records are trusted after that, so the cost of loading
+ * is dominated by reading the image and writing the nodes.
+ *
+ * @warning Only load images created by @ref ecu_ntimage_save().
+ * Parent indexes within records are only checked by asserts.
+ *
+ * @param image Image to load. Must stay valid for as long as the
+ * payloads passed to @p load are used.
+ * @param size Number of bytes in @p image.
+ * @param nodes Array of node pointers the tree is built in. Nodes do
+ * not have to be constructed. Usually points to members of an array of
+ * the user's node type.
+ * @param capacity Number of elements in @p nodes. NULL is returned
+ * if this is less than @ref ecu_ntimage_count().
+ * @param destroy Optional destroy callback assigned to every node. See
+ * @ref ecu_ntnode_ctor(). Supply @ref ECU_NTNODE_DESTROY_UNUSED if unused.
+ * @param load Optional callback that executes once for every node after
+ * it is linked. @p payload points directly into @p image so it can be
+ * used without copying. Supply @ref ECU_NTIMAGE_LOAD_UNUSED if unused.
+ * @param obj Optional object to pass to @p load. Supply
+ * @ref ECU_NTIMAGE_OBJ_UNUSED if unused.
+ */
+extern struct ecu_ntnode *ecu_ntimage_load(const void *image,
+                                           size_t size,
+                                           struct ecu_ntnode *const *nodes,
+                                           size_t capacity,
+                                           void (*destroy)(struct ecu_ntnode *me, ecu_object_id_t id),
+                                           void (*load)(struct ecu_ntnode *node, const void *payload, void *obj),
+                                           void *obj);
+
+/**
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Saves a tree as a compact image that can be stored and
+ * reloaded later via @ref ecu_ntimage_load(). Returns the number of
+ * bytes written, which is always @ref ecu_ntimage_size(). Returns 0
+ * if @p capacity is too small, in which case the contents of @p image
+ * are unspecified and must not be loaded. The image is little endian
+ * regardless of the target.
+ *
+ * @param image Buffer the image is written to.
+ * @param capacity Number of bytes in @p image. 0 is returned if
+ * this is less than @ref ecu_ntimage_size().
+ * @param root Root of tree to save. This does not have to be the
+ * root of the entire tree. It becomes the root of the loaded tree.
+ * @param payload_size Number of payload bytes stored with each node.
+ * Can be 0.
+ * @param save Callback that writes @p payload_size bytes of user data
+ * for each node into @p payload. Payload bytes are stored as is, so the
+ * callback chooses their endianness. Supply @ref ECU_NTIMAGE_SAVE_UNUSED
+ * only if @p payload_size is 0.
+ * @param obj Optional object to pass to @p save. Supply
+ * @ref ECU_NTIMAGE_OBJ_UNUSED if unused.
+ */
+extern size_t ecu_ntimage_save(void *image,
+                               size_t capacity,
+                               const struct ecu_ntnode *root,
+                               size_t payload_size,
+                               void (*save)(const struct ecu_ntnode *node, void *payload, void *obj),
+                               void *obj);
+
+/**
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Returns the number of bytes required to save a tree via
+ * @ref ecu_ntimage_save(). O(1) if @ref ECU_NTNODE_COUNTED is defined.
+ * Otherwise O(n).
+ *
+ * @param root Root of tree to save.
+ * @param payload_size Number of payload bytes stored with each node.
+ */
+extern size_t ecu_ntimage_size(const struct ecu_ntnode *root, size_t payload_size);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_NTIMAGE_H_ */
@@ -0,0 +1,488 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ntindex.h section <ntindex_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_NTINDEX_H_
+#define ECU_NTINDEX_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ECU. */
+#include "ecu/ntnode.h"
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Index returned by @ref ecu_ntindex_parent() for the
+ * root, which has no parent. Also returned by iterators once
+ * the iteration is finished.
+ */
+#define ECU_NTINDEX_NONE \
+    ((size_t)-1)
+
+/**
+ * @brief Convenience define for @ref ecu_ntindex_build(). Pass
+ * this value if optional callback object is not needed.
+ */
+#define ECU_NTINDEX_OBJ_UNUSED \
+    ((void *)0)
+
+/**
+ * @brief Convenience define for @ref ecu_ntindex_build(). Pass
+ * this value if the index of each node does not need to be
+ * reported back to the user.
+ */
+#define ECU_NTINDEX_ASSIGN_UNUSED \
+    ((void (*)(struct ecu_ntnode *, size_t, void *))0)
+
+/**
+ * @brief Iterates (for-loops) over a subtree of an index in preorder.
+ * @p root_ is included in the iteration. Use
+ * @ref ecu_ntindex_preorder_iterator_skip() to skip the descendants
+ * of the current node.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node's index in the iteration and will be a size_t.
+ * @param iter_ Iterator to initialize. This will be a pointer to @ref ecu_ntindex_iterator.
+ * @param index_ Index to iterate over. This will be a pointer to const @ref ecu_ntindex.
+ * @param root_ Index of subtree root.
+ */
+#define ECU_NTINDEX_PREORDER_FOR_EACH(var_, iter_, index_, root_)                    \
+    for (size_t var_ = ecu_ntindex_preorder_iterator_begin(iter_, index_, root_);   \
+         var_ != ECU_NTINDEX_NONE;                                                  \
+         var_ = ecu_ntindex_preorder_iterator_next(iter_))
+
+/**
+ * @brief Iterates (for-loops) over a subtree of an index in postorder.
+ * @p root_ is included in the iteration and is returned last.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node's index in the iteration and will be a size_t.
+ * @param iter_ Iterator to initialize. This will be a pointer to @ref ecu_ntindex_iterator.
+ * @param index_ Index to iterate over. This will be a pointer to const @ref ecu_ntindex.
+ * @param root_ Index of subtree root.
+ */
+#define ECU_NTINDEX_POSTORDER_FOR_EACH(var_, iter_, index_, root_)                   \
+    for (size_t var_ = ecu_ntindex_postorder_iterator_begin(iter_, index_, root_);  \
+         var_ != ECU_NTINDEX_NONE;                                                  \
+         var_ = ecu_ntindex_postorder_iterator_next(iter_))
+
+/**
+ * @brief Iterates (for-loops) over the direct children of a node,
+ * first to last. Iteration immediately exits if the node is a leaf.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * child's index in the iteration and will be a size_t.
+ * @param iter_ Iterator to initialize. This will be a pointer to @ref ecu_ntindex_iterator.
+ * @param index_ Index to iterate over. This will be a pointer to const @ref ecu_ntindex.
+ * @param parent_ Index of node whose children are iterated over.
+ */
+#define ECU_NTINDEX_CHILD_FOR_EACH(var_, iter_, index_, parent_)                 \
+    for (size_t var_ = ecu_ntindex_child_iterator_begin(iter_, index_, parent_); \
+         var_ != ECU_NTINDEX_NONE;                                              \
+         var_ = ecu_ntindex_child_iterator_next(iter_))
+
+/**
+ * @brief Iterates (for-loops) over a node's parent, grandparent,
+ * great-grandparent, etc up to the indexed root. The starting node
+ * is not included. Iteration immediately exits if the starting node
+ * is the indexed root.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * ancestor's index in the iteration and will be a size_t.
+ * @param iter_ Iterator to initialize. This will be a pointer to @ref ecu_ntindex_iterator.
+ * @param index_ Index to iterate over. This will be a pointer to const @ref ecu_ntindex.
+ * @param start_ Index of starting node.
+ */
+#define ECU_NTINDEX_PARENT_FOR_EACH(var_, iter_, index_, start_)                 \
+    for (size_t var_ = ecu_ntindex_parent_iterator_begin(iter_, index_, start_); \
+         var_ != ECU_NTINDEX_NONE;                                              \
+         var_ = ecu_ntindex_parent_iterator_next(iter_))
+
+/*------------------------------------------------------------*/
+/*-------------------------- NTINDEX -------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Read-only index of a tree that no longer changes. Nodes
+ * are numbered in preorder, with the root at index 0, and every
+ * query is answered by index. Node data is stored as separate
+ * user-supplied arrays so queries only touch the arrays they need.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntindex
+{
+    /// @brief Node at each preorder index.
+    struct ecu_ntnode **nodes;
+
+    /// @brief One past the last index in each node's subtree.
+    /// Index j is in the subtree of index i if i <= j < ends[i].
+    size_t *ends;
+
+    /// @brief Parent index of each node. The root is its own
+    /// parent so upward walks always stop there.
+    size_t *parents;
+
+    /// @brief Level of each node relative to the indexed root.
+    size_t *depths;
+
+    /// @brief Optional binary lifting table. Row k holds the
+    /// 2^(k+1)th ancestor of each node. NULL if unused.
+    size_t *jumps;
+
+    /// @brief Number of rows in @ref jumps.
+    size_t levels;
+
+    /// @brief Number of elements in each user-supplied array.
+    size_t capacity;
+
+    /// @brief Number of nodes currently indexed.
+    size_t size;
+};
+
+/*------------------------------------------------------------*/
+/*--------------------- NTINDEX ITERATORS --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Read-only iterator over an index. Shared by all
+ * iteration orders since each order only needs the current
+ * position and the subtree it is confined to.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntindex_iterator
+{
+    /// @brief Index that is being iterated.
+    const struct ecu_ntindex *index;
+
+    /// @brief Node the iteration is confined to. Subtree root
+    /// for preorder and postorder. Parent for child iteration.
+    size_t root;
+
+    /// @brief Current position. @ref ECU_NTINDEX_NONE once
+    /// the iteration is finished.
+    size_t current;
+
+    /// @brief Next position in a preorder iteration. Lets
+    /// the current node's subtree be skipped.
+    size_t next;
+};
+
+/*------------------------------------------------------------*/
+/*----------------- NTINDEX MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Ntindex Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me and all supplied arrays.
+ * @brief Index constructor. Index is empty until
+ * @ref ecu_ntindex_build() is called.
+ *
+ * @param me Index to construct. This cannot be NULL.
+ * @param nodes Array of @p capacity node pointers.
+ * @param ends Array of @p capacity elements.
+ * @param parents Array of @p capacity elements.
+ * @param depths Array of @p capacity elements.
+ * @param capacity Number of elements in each array. Must be
+ * greater than 0. Limits the number of nodes that can be indexed.
+ */
+extern void ecu_ntindex_ctor(struct ecu_ntindex *me,
+                             struct ecu_ntnode **nodes,
+                             size_t *ends,
+                             size_t *parents,
+                             size_t *depths,
+                             size_t capacity);
+/**@}*/
+
+/**
+ * @name Ntindex Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me previously constructed via @ref ecu_ntindex_ctor().
+ * @brief Indexes the tree rooted at @p root in O(n). Any previous
+ * contents of the index are replaced. Returns the number of nodes
+ * indexed, which includes @p root.
+ *
+ * @warning The index is a snapshot. Adding, removing or moving
+ * nodes in the tree afterwards is not detected and leaves the
+ * index stale until it is rebuilt.
+ *
+ * @param me Index to build.
+ * @param root Root of tree to index. This does not have to be the
+ * root of the entire tree. Number of nodes in this subtree, including
+ * itself, cannot exceed the index's capacity.
+ * @param assign Optional callback that executes once for every
+ * node, in preorder, with the node's index. Lets the user store
+ * each index in their own node type so later queries do not have
+ * to search for it. Do not edit the tree within this callback.
+ * Supply @ref ECU_NTINDEX_ASSIGN_UNUSED if unused.
+ * @param obj Optional object to pass to @p assign. Supply
+ * @ref ECU_NTINDEX_OBJ_UNUSED if unused.
+ */
+extern size_t ecu_ntindex_build(struct ecu_ntindex *me,
+                                struct ecu_ntnode *root,
+                                void (*assign)(struct ecu_ntnode *node, size_t index, void *obj),
+                                void *obj);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntindex_ctor().
+ * @brief Returns the level of node @p i relative to the indexed
+ * root. The root is at level 0. O(1).
+ *
+ * @param me Index to query.
+ * @param i Node index. Must be less than @ref ecu_ntindex_size().
+ */
+extern size_t ecu_ntindex_depth(const struct ecu_ntindex *me, size_t i);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntindex_ctor().
+ * @brief Returns one past the last index in node @p i's subtree.
+ * Node @p i's descendants are exactly the indices in the range
+ * (@p i, returned value). Jumping to this index skips the whole
+ * subtree in a preorder walk. O(1).
+ *
+ * @param me Index to query.
+ * @param i Node index. Must be less than @ref ecu_ntindex_size().
+ */
+extern size_t ecu_ntindex_end(const struct ecu_ntindex *me, size_t i);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntindex_ctor().
+ * @brief Returns true if node @p a is a parent, grandparent,
+ * great-grandparent, etc of node @p i. False otherwise, including
+ * when @p a and @p i are the same node. O(1).
+ *
+ * @param me Index to query.
+ * @param a Possible ancestor index. Must be less than @ref ecu_ntindex_size().
+ * @param i Node index. Must be less than @ref ecu_ntindex_size().
+ */
+extern bool ecu_ntindex_is_ancestor(const struct ecu_ntindex *me, size_t a, size_t i);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntindex_ctor().
+ * @brief Returns the index of the least common ancestor of nodes
+ * @p i and @p j. O(log(level)) if a jump table with at least
+ * log2(max level) rows was supplied via @ref ecu_ntindex_set_jump_table().
+ * Otherwise O(level).
+ *
+ * @param me Index to query.
+ * @param i First node index. Must be less than @ref ecu_ntindex_size().
+ * @param j Second node index. Must be less than @ref ecu_ntindex_size().
+ */
+extern size_t ecu_ntindex_lca(const struct ecu_ntindex *me, size_t i, size_t j);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntindex_ctor().
+ * @brief Returns the node stored at index @p i. O(1).
+ *
+ * @param me Index to query.
+ * @param i Node index. Must be less than @ref ecu_ntindex_size().
+ */
+extern struct ecu_ntnode *ecu_ntindex_node(const struct ecu_ntindex *me, size_t i);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntindex_ctor().
+ * @brief Returns the index of node @p i's parent. Returns
+ * @ref ECU_NTINDEX_NONE if @p i is the indexed root. O(1).
+ *
+ * @param me Index to query.
+ * @param i Node index. Must be less than @ref ecu_ntindex_size().
+ */
+extern size_t ecu_ntindex_parent(const struct ecu_ntindex *me, size_t i);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntindex_ctor().
+ * @brief Supplies a binary lifting table that lets @ref ecu_ntindex_lca()
+ * skip up the tree in powers of two. Table is filled immediately if
+ * the index is already built, and on every following call to
+ * @ref ecu_ntindex_build(). O(n * @p levels).
+ *
+ * @param me Index to attach table to.
+ * @param jumps Array of (@p levels * capacity) elements, where capacity is
+ * the value supplied to @ref ecu_ntindex_ctor(). Row k of the table holds
+ * the 2^(k+1)th ancestor of each node.
+ * @param levels Number of rows in @p jumps. Must be greater than 0.
+ * Supplying ceil(log2(max level)) rows gives O(log(level)) LCA queries.
+ * Fewer rows still work but some queries fall back to walking up
+ * one parent at a time.
+ */
+extern void ecu_ntindex_set_jump_table(struct ecu_ntindex *me, size_t *jumps, size_t levels);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntindex_ctor().
+ * @brief Returns the number of nodes currently indexed.
+ * Returns 0 if @ref ecu_ntindex_build() has not been called.
+ *
+ * @param me Index to query.
+ */
+extern size_t ecu_ntindex_size(const struct ecu_ntindex *me);
+/**@}*/
+
+/**
+ * @name Iterators
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me. @p index previously
+ * built via @ref ecu_ntindex_build().
+ * @brief Initializes a preorder iteration over the subtree rooted
+ * at @p root and returns @p root.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTINDEX_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Iterator to initialize.
+ * @param index Index to iterate over.
+ * @param root Index of subtree root. Must be less than @ref ecu_ntindex_size().
+ */
+extern size_t ecu_ntindex_preorder_iterator_begin(struct ecu_ntindex_iterator *me,
+                                                  const struct ecu_ntindex *index,
+                                                  size_t root);
+
+/**
+ * @pre @p me previously initialized via @ref ecu_ntindex_preorder_iterator_begin().
+ * @brief Returns the next index in the preorder iteration.
+ * Returns @ref ECU_NTINDEX_NONE once the subtree is exhausted.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTINDEX_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Preorder iterator.
+ */
+extern size_t ecu_ntindex_preorder_iterator_next(struct ecu_ntindex_iterator *me);
+
+/**
+ * @pre @p me previously initialized via @ref ecu_ntindex_preorder_iterator_begin().
+ * @brief Skips the descendants of the current node. The next call to
+ * @ref ecu_ntindex_preorder_iterator_next() returns the first node
+ * after the current node's subtree. O(1).
+ *
+ * @param me Preorder iterator. Iteration must not be finished.
+ */
+extern void ecu_ntindex_preorder_iterator_skip(struct ecu_ntindex_iterator *me);
+
+/**
+ * @pre Memory already allocated for @p me. @p index previously
+ * built via @ref ecu_ntindex_build().
+ * @brief Initializes a postorder iteration over the subtree rooted
+ * at @p root and returns the first node in postorder.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTINDEX_POSTORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Iterator to initialize.
+ * @param index Index to iterate over.
+ * @param root Index of subtree root. Must be less than @ref ecu_ntindex_size().
+ */
+extern size_t ecu_ntindex_postorder_iterator_begin(struct ecu_ntindex_iterator *me,
+                                                   const struct ecu_ntindex *index,
+                                                   size_t root);
+
+/**
+ * @pre @p me previously initialized via @ref ecu_ntindex_postorder_iterator_begin().
+ * @brief Returns the next index in the postorder iteration.
+ * Returns @ref ECU_NTINDEX_NONE once the subtree root has been
+ * returned.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTINDEX_POSTORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Postorder iterator.
+ */
+extern size_t ecu_ntindex_postorder_iterator_next(struct ecu_ntindex_iterator *me);
+
+/**
+ * @pre Memory already allocated for @p me. @p index previously
+ * built via @ref ecu_ntindex_build().
+ * @brief Initializes an iteration over the children of @p parent
+ * and returns the first child. Returns @ref ECU_NTINDEX_NONE if
+ * @p parent is a leaf.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTINDEX_CHILD_FOR_EACH()
+ * instead.
+ *
+ * @param me Iterator to initialize.
+ * @param index Index to iterate over.
+ * @param parent Index of parent node. Must be less than @ref ecu_ntindex_size().
+ */
+extern size_t ecu_ntindex_child_iterator_begin(struct ecu_ntindex_iterator *me,
+                                               const struct ecu_ntindex *index,
+                                               size_t parent);
+
+/**
+ * @pre @p me previously initialized via @ref ecu_ntindex_child_iterator_begin().
+ * @brief Returns the next child. Returns @ref ECU_NTINDEX_NONE
+ * once all children have been returned.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTINDEX_CHILD_FOR_EACH()
+ * instead.
+ *
+ * @param me Child iterator.
+ */
+extern size_t ecu_ntindex_child_iterator_next(struct ecu_ntindex_iterator *me);
+
+/**
+ * @pre Memory already allocated for @p me. @p index previously
+ * built via @ref ecu_ntindex_build().
+ * @brief Initializes an iteration over the ancestors of @p start
+ * and returns its parent. Returns @ref ECU_NTINDEX_NONE if @p start
+ * is the indexed root.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTINDEX_PARENT_FOR_EACH()
+ * instead.
+ *
+ * @param me Iterator to initialize.
+ * @param index Index to iterate over.
+ * @param start Index of starting node. Must be less than @ref ecu_ntindex_size().
+ */
+extern size_t ecu_ntindex_parent_iterator_begin(struct ecu_ntindex_iterator *me,
+                                                const struct ecu_ntindex *index,
+                                                size_t start);
+
+/**
+ * @pre @p me previously initialized via @ref ecu_ntindex_parent_iterator_begin().
+ * @brief Returns the next ancestor. Returns @ref ECU_NTINDEX_NONE
+ * once the indexed root has been returned.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTINDEX_PARENT_FOR_EACH()
+ * instead.
+ *
+ * @param me Parent iterator.
+ */
+extern size_t ecu_ntindex_parent_iterator_next(struct ecu_ntindex_iterator *me);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_NTINDEX_H_ */
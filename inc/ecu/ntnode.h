@@ -32,6 +32,66 @@
 /*---------------------- DEFINES AND MACROS ------------------*/
 /*------------------------------------------------------------*/
 
+#if defined(ECU_DOXYGEN)
+    /**
+     * @brief Opt-in counted mode. Define this to cache each node's
+     * child count, descendant count, and level. @ref ecu_ntnode_count(),
+     * @ref ecu_ntnode_size(), and @ref ecu_ntnode_level() become O(1).
+     * In exchange, every node is three words larger, inserting or
+     * removing a subtree updates its ancestors (O(level)), and
+     * relevels the moved subtree (O(subtree size)).
+     *
+     * Must be defined identically for ECU and the application since
+     * it changes the layout of @ref ecu_ntnode. If using CMake, set the
+     * ECU_NTNODE_COUNTED option to ON.
+     */
+    #define ECU_NTNODE_COUNTED
+
+    /**
+     * @brief Opt-in dirty tracking mode. Define this to store a
+     * dirty flag in every node so aggregate values (sums, worst
+     * severity, etc) can be recomputed incrementally via
+     * @ref ecu_ntnode_refresh(). Inserting or removing a subtree
+     * automatically marks its new or old parent dirty, which is
+     * O(level) in the worst case.
+     *
+     * Must be defined identically for ECU and the application since
+     * it changes the layout of @ref ecu_ntnode. If using CMake, set the
+     * ECU_NTNODE_DIRTY option to ON.
+     */
+    #define ECU_NTNODE_DIRTY
+
+    /**
+     * @brief Opt-in child index mode. Define this to let a node keep
+     * a hash table of its children keyed by object ID, supplied via
+     * @ref ecu_ntnode_attach_index(). @ref ecu_ntnode_find_child_by_id()
+     * and @ref ecu_ntnode_resolve() become O(1) per level on average
+     * for indexed nodes. In exchange, every node is one word larger and
+     * inserting or removing a child of an indexed node updates its table.
+     *
+     * Must be defined identically for ECU and the application since
+     * it changes the layout of @ref ecu_ntnode. If using CMake, set the
+     * ECU_NTNODE_INDEXED option to ON.
+     */
+    #define ECU_NTNODE_INDEXED
+
+    /**
+     * @brief Opt-in fast clear mode. Define this to stamp every node
+     * with the generation of the tree it is in, supplied via
+     * @ref ecu_ntnode_attach_epoch(). @ref ecu_ntnode_fast_clear()
+     * then empties the tree in O(1) by starting a new generation.
+     * Former nodes are detached lazily the next time they are used.
+     * In exchange, every node grows by a pointer and a 64-bit
+     * generation, and inserting or removing a subtree that moves
+     * between generations restamps it (O(subtree size)).
+     *
+     * Must be defined identically for ECU and the application since
+     * it changes the layout of @ref ecu_ntnode. If using CMake, set the
+     * ECU_NTNODE_FAST_CLEAR option to ON.
+     */
+    #define ECU_NTNODE_FAST_CLEAR
+#endif /* ECU_DOXYGEN */
+
 /**
  * @brief Convenience macro passed to API if optional
  * callback objects are unused.
@@ -337,6 +397,229 @@
          var_ != ecu_ntnode_preorder_iterator_cend(citer_);                                  \
          var_ = ecu_ntnode_preorder_iterator_cnext(citer_))
 
+/**
+ * @brief Same as @ref ECU_NTNODE_POSTORDER_FOR_EACH() but uses
+ * @ref ecu_ntnode_compact_postorder_iterator, which is three pointers
+ * instead of a full delimiter node. The end of the iteration is
+ * detected by comparing against the root. It is safe to remove
+ * or destroy the current node in the iteration.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to @ref ecu_ntnode.
+ * @param iter_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_compact_postorder_iterator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to @ref ecu_ntnode.
+ */
+#define ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(var_, iter_, root_)                             \
+    for (struct ecu_ntnode *var_ = ecu_ntnode_compact_postorder_iterator_begin(iter_, root_); \
+         var_ != ecu_ntnode_compact_postorder_iterator_end(iter_);                            \
+         var_ = ecu_ntnode_compact_postorder_iterator_next(iter_))
+
+/**
+ * @brief Const-qualified version of @ref ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH().
+ * Returned nodes are read-only.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to const @ref ecu_ntnode.
+ * @param citer_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_compact_postorder_citerator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to const @ref ecu_ntnode.
+ */
+#define ECU_NTNODE_CONST_COMPACT_POSTORDER_FOR_EACH(var_, citer_, root_)                              \
+    for (const struct ecu_ntnode *var_ = ecu_ntnode_compact_postorder_iterator_cbegin(citer_, root_); \
+         var_ != ecu_ntnode_compact_postorder_iterator_cend(citer_);                                  \
+         var_ = ecu_ntnode_compact_postorder_iterator_cnext(citer_))
+
+/**
+ * @brief Same as @ref ECU_NTNODE_PREORDER_FOR_EACH() but uses
+ * @ref ecu_ntnode_compact_preorder_iterator, which is two pointers
+ * instead of a full delimiter node. The end of the iteration is
+ * detected by comparing against the root. Removing or destroying
+ * the current node in the iteration is NOT allowed.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to @ref ecu_ntnode.
+ * @param iter_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_compact_preorder_iterator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to @ref ecu_ntnode.
+ */
+#define ECU_NTNODE_COMPACT_PREORDER_FOR_EACH(var_, iter_, root_)                             \
+    for (struct ecu_ntnode *var_ = ecu_ntnode_compact_preorder_iterator_begin(iter_, root_); \
+         var_ != ecu_ntnode_compact_preorder_iterator_end(iter_);                            \
+         var_ = ecu_ntnode_compact_preorder_iterator_next(iter_))
+
+/**
+ * @brief Const-qualified version of @ref ECU_NTNODE_COMPACT_PREORDER_FOR_EACH().
+ * Returned nodes are read-only.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to const @ref ecu_ntnode.
+ * @param citer_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_compact_preorder_citerator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to const @ref ecu_ntnode.
+ */
+#define ECU_NTNODE_CONST_COMPACT_PREORDER_FOR_EACH(var_, citer_, root_)                              \
+    for (const struct ecu_ntnode *var_ = ecu_ntnode_compact_preorder_iterator_cbegin(citer_, root_); \
+         var_ != ecu_ntnode_compact_preorder_iterator_cend(citer_);                                  \
+         var_ = ecu_ntnode_compact_preorder_iterator_cnext(citer_))
+
+/**
+ * @brief Preorder iteration that can prune subtrees. Same order as
+ * @ref ECU_NTNODE_PREORDER_FOR_EACH(), but calling
+ * @ref ecu_ntnode_pruned_preorder_iterator_skip() inside the loop
+ * skips the current node's descendants, and
+ * @ref ecu_ntnode_pruned_preorder_iterator_level() returns the current
+ * node's level relative to @p root_. Uses
+ * @ref ecu_ntnode_pruned_preorder_iterator, which has no delimiter node.
+ * Removing or destroying the current node in the iteration is NOT allowed.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to @ref ecu_ntnode.
+ * @param iter_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_pruned_preorder_iterator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to @ref ecu_ntnode.
+ */
+#define ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(var_, iter_, root_)                             \
+    for (struct ecu_ntnode *var_ = ecu_ntnode_pruned_preorder_iterator_begin(iter_, root_); \
+         var_ != ecu_ntnode_pruned_preorder_iterator_end(iter_);                            \
+         var_ = ecu_ntnode_pruned_preorder_iterator_next(iter_))
+
+/**
+ * @brief Const-qualified version of @ref ECU_NTNODE_PRUNED_PREORDER_FOR_EACH().
+ * Returned nodes are read-only.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to const @ref ecu_ntnode.
+ * @param citer_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_pruned_preorder_citerator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to const @ref ecu_ntnode.
+ */
+#define ECU_NTNODE_CONST_PRUNED_PREORDER_FOR_EACH(var_, citer_, root_)                              \
+    for (const struct ecu_ntnode *var_ = ecu_ntnode_pruned_preorder_iterator_cbegin(citer_, root_); \
+         var_ != ecu_ntnode_pruned_preorder_iterator_cend(citer_);                                  \
+         var_ = ecu_ntnode_pruned_preorder_iterator_cnext(citer_))
+
+/**
+ * @brief Same as @ref ECU_NTNODE_PRUNED_PREORDER_FOR_EACH() but nodes
+ * deeper than @p max_level_ are never visited.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to @ref ecu_ntnode.
+ * @param iter_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_pruned_preorder_iterator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to @ref ecu_ntnode.
+ * @param max_level_ Deepest level to iterate over, relative to
+ * @p root_. 0 only returns @p root_, 1 also returns its children, etc.
+ */
+#define ECU_NTNODE_PRUNED_PREORDER_LIMIT_FOR_EACH(var_, iter_, root_, max_level_)                       \
+    for (struct ecu_ntnode *var_ = ecu_ntnode_pruned_preorder_iterator_limit(iter_, root_, max_level_); \
+         var_ != ecu_ntnode_pruned_preorder_iterator_end(iter_);                                        \
+         var_ = ecu_ntnode_pruned_preorder_iterator_next(iter_))
+
+/**
+ * @brief Const-qualified version of @ref ECU_NTNODE_PRUNED_PREORDER_LIMIT_FOR_EACH().
+ * Returned nodes are read-only.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to const @ref ecu_ntnode.
+ * @param citer_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_pruned_preorder_citerator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to const @ref ecu_ntnode.
+ * @param max_level_ Deepest level to iterate over, relative to
+ * @p root_. 0 only returns @p root_, 1 also returns its children, etc.
+ */
+#define ECU_NTNODE_CONST_PRUNED_PREORDER_LIMIT_FOR_EACH(var_, citer_, root_, max_level_)                        \
+    for (const struct ecu_ntnode *var_ = ecu_ntnode_pruned_preorder_iterator_climit(citer_, root_, max_level_); \
+         var_ != ecu_ntnode_pruned_preorder_iterator_cend(citer_);                                              \
+         var_ = ecu_ntnode_pruned_preorder_iterator_cnext(citer_))
+
+/**
+ * @brief Performs a level-order (breadth-first) iteration over a tree.
+ * The root is returned first, followed by all of its children, then all
+ * of its grandchildren, etc. Uses no memory besides the iterator.
+ * Removing or destroying the current node in the iteration is NOT allowed.
+ *
+ * @warning Without a queue, the next node in a level is found by walking
+ * up to the closest ancestor with a next sibling and back down, which
+ * revisits upper levels. A full iteration is O(n * height) in the worst
+ * case, i.e. O(n^2) if the tree is a single chain. Use
+ * @ref ECU_NTNODE_PREORDER_FOR_EACH() if the order does not matter, or
+ * @ref ECU_NTNODE_LEVELORDER_LIMIT_FOR_EACH() to bound the height.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to @ref ecu_ntnode.
+ * @param iter_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_levelorder_iterator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to @ref ecu_ntnode.
+ */
+#define ECU_NTNODE_LEVELORDER_FOR_EACH(var_, iter_, root_)                             \
+    for (struct ecu_ntnode *var_ = ecu_ntnode_levelorder_iterator_begin(iter_, root_); \
+         var_ != ecu_ntnode_levelorder_iterator_end(iter_);                            \
+         var_ = ecu_ntnode_levelorder_iterator_next(iter_))
+
+/**
+ * @brief Const-qualified version of @ref ECU_NTNODE_LEVELORDER_FOR_EACH().
+ * Returned nodes are read-only.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to const @ref ecu_ntnode.
+ * @param citer_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_levelorder_citerator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to const @ref ecu_ntnode.
+ */
+#define ECU_NTNODE_CONST_LEVELORDER_FOR_EACH(var_, citer_, root_)                              \
+    for (const struct ecu_ntnode *var_ = ecu_ntnode_levelorder_iterator_cbegin(citer_, root_); \
+         var_ != ecu_ntnode_levelorder_iterator_cend(citer_);                                  \
+         var_ = ecu_ntnode_levelorder_iterator_cnext(citer_))
+
+/**
+ * @brief Same as @ref ECU_NTNODE_LEVELORDER_FOR_EACH() but stops
+ * after the supplied level. Nodes deeper than @p max_level_ are
+ * never visited, so the iteration is O(n * max_level_) in the
+ * worst case, where n only counts the nodes that are visited.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to @ref ecu_ntnode.
+ * @param iter_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_levelorder_iterator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to @ref ecu_ntnode.
+ * @param max_level_ Deepest level to iterate over, relative to
+ * @p root_. 0 only returns @p root_, 1 also returns its children, etc.
+ */
+#define ECU_NTNODE_LEVELORDER_LIMIT_FOR_EACH(var_, iter_, root_, max_level_)                       \
+    for (struct ecu_ntnode *var_ = ecu_ntnode_levelorder_iterator_limit(iter_, root_, max_level_); \
+         var_ != ecu_ntnode_levelorder_iterator_end(iter_);                                        \
+         var_ = ecu_ntnode_levelorder_iterator_next(iter_))
+
+/**
+ * @brief Const-qualified version of @ref ECU_NTNODE_LEVELORDER_LIMIT_FOR_EACH().
+ * Returned nodes are read-only.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to const @ref ecu_ntnode.
+ * @param citer_ Iterator to initialize. This will be a pointer
+ * to @ref ecu_ntnode_levelorder_citerator.
+ * @param root_ Tree to iterate over. This node will be included in
+ * the iteration, and will be a pointer to const @ref ecu_ntnode.
+ * @param max_level_ Deepest level to iterate over, relative to
+ * @p root_. 0 only returns @p root_, 1 also returns its children, etc.
+ */
+#define ECU_NTNODE_CONST_LEVELORDER_LIMIT_FOR_EACH(var_, citer_, root_, max_level_)                        \
+    for (const struct ecu_ntnode *var_ = ecu_ntnode_levelorder_iterator_climit(citer_, root_, max_level_); \
+         var_ != ecu_ntnode_levelorder_iterator_cend(citer_);                                              \
+         var_ = ecu_ntnode_levelorder_iterator_cnext(citer_))
+
 /**
  * @brief Iterates (for-loops) over all previous (left) siblings,
  * including the supplied starting node. Terminates after the
@@ -461,6 +744,47 @@
 /*--------------------------- NTNODE -------------------------*/
 /*------------------------------------------------------------*/
 
+#if defined(ECU_NTNODE_INDEXED)
+/**
+ * @brief Hash table of a node's children keyed by object ID.
+ * Open addressing with linear probing over a user-supplied slot
+ * array, so no memory is allocated. Only present if
+ * @ref ECU_NTNODE_INDEXED is defined.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntnode_index
+{
+    /// @brief User-supplied slot array. NULL if slot is empty.
+    struct ecu_ntnode **slots;
+
+    /// @brief Number of slots. Always a power of two.
+    size_t capacity;
+
+    /// @brief Number of children currently stored.
+    size_t count;
+};
+#endif /* ECU_NTNODE_INDEXED */
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+/**
+ * @brief Generation counter shared by every node in a tree.
+ * Only present if @ref ECU_NTNODE_FAST_CLEAR is defined.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntnode_epoch
+{
+    /// @brief Current generation. Incremented every time the
+    /// tree is cleared via @ref ecu_ntnode_fast_clear(). 64 bits
+    /// on every target so it never wraps back to a stale node's
+    /// stamp in practice.
+    uint64_t generation;
+};
+#endif /* ECU_NTNODE_FAST_CLEAR */
+
 /**
  * @brief Single node within a tree. Intrusive, so
  * user-defined types contain this node as a member.
@@ -486,6 +810,44 @@ struct ecu_ntnode
     /// when @ref ecu_ntnode_destroy() is called or if this
     /// node was in a tree that was destroyed by @ref ecu_ntnode_destroy().
     void (*destroy)(struct ecu_ntnode *me, ecu_object_id_t id);
+
+#if defined(ECU_NTNODE_COUNTED)
+    /// @brief Cached number of direct children. Only
+    /// present if @ref ECU_NTNODE_COUNTED is defined.
+    size_t count;
+
+    /// @brief Cached number of descendants. Only present
+    /// if @ref ECU_NTNODE_COUNTED is defined.
+    size_t size;
+
+    /// @brief Cached level in the tree. 0 if this is a root.
+    /// Only present if @ref ECU_NTNODE_COUNTED is defined.
+    size_t level;
+#endif
+
+#if defined(ECU_NTNODE_DIRTY)
+    /// @brief True if this node's aggregate value is stale. If a
+    /// node is dirty, all of its ancestors are also dirty. Only
+    /// present if @ref ECU_NTNODE_DIRTY is defined.
+    bool dirty;
+#endif
+
+#if defined(ECU_NTNODE_INDEXED)
+    /// @brief Optional index of this node's children. NULL if
+    /// unused. Only present if @ref ECU_NTNODE_INDEXED is defined.
+    struct ecu_ntnode_index *index;
+#endif
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    /// @brief Epoch of the tree this node is in. NULL if the tree
+    /// has none. Only present if @ref ECU_NTNODE_FAST_CLEAR is defined.
+    struct ecu_ntnode_epoch *epoch;
+
+    /// @brief Epoch's generation when this node was stamped. The node
+    /// belongs to a cleared tree if this no longer matches. Only present
+    /// if @ref ECU_NTNODE_FAST_CLEAR is defined.
+    uint64_t generation;
+#endif
 };
 
 /*------------------------------------------------------------*/
@@ -692,6 +1054,208 @@ struct ecu_ntnode_preorder_citerator
     const struct ecu_ntnode *current;
 };
 
+/*------------------------------------------------------------*/
+/*--------------- NTNODE COMPACT TREE ITERATORS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Non-const postorder iterator without a delimiter node.
+ * End of iteration is NULL.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntnode_compact_postorder_iterator
+{
+    /// @brief Root of tree being iterated over. Included
+    /// in iteration and returned last.
+    struct ecu_ntnode *root;
+
+    /// @brief Current node in the iteration. NULL once
+    /// the iteration is finished.
+    struct ecu_ntnode *current;
+
+    /// @brief Next node in the iteration to allow safe removal
+    /// of current node. NULL if current node is the root.
+    struct ecu_ntnode *next;
+};
+
+/**
+ * @brief Const postorder iterator without a delimiter node.
+ * End of iteration is NULL.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntnode_compact_postorder_citerator
+{
+    /// @brief Root of tree being iterated over. Included
+    /// in iteration and returned last.
+    const struct ecu_ntnode *root;
+
+    /// @brief Current node in the iteration. NULL once
+    /// the iteration is finished.
+    const struct ecu_ntnode *current;
+
+    /// @brief Next node in the iteration. Kept to remain
+    /// consistent with non-const iterator implementation.
+    const struct ecu_ntnode *next;
+};
+
+/**
+ * @brief Non-const preorder iterator without a delimiter node.
+ * End of iteration is NULL.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntnode_compact_preorder_iterator
+{
+    /// @brief Root of tree being iterated over. Included
+    /// in iteration and returned first.
+    struct ecu_ntnode *root;
+
+    /// @brief Current node in the iteration. NULL once
+    /// the iteration is finished.
+    struct ecu_ntnode *current;
+};
+
+/**
+ * @brief Const preorder iterator without a delimiter node.
+ * End of iteration is NULL.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntnode_compact_preorder_citerator
+{
+    /// @brief Root of tree being iterated over. Included
+    /// in iteration and returned first.
+    const struct ecu_ntnode *root;
+
+    /// @brief Current node in the iteration. NULL once
+    /// the iteration is finished.
+    const struct ecu_ntnode *current;
+};
+
+/**
+ * @brief Non-const preorder iterator that can skip subtrees and
+ * stop at a maximum level. Kept separate from
+ * @ref ecu_ntnode_preorder_iterator so the common iterator stays
+ * small. End of iteration is NULL.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntnode_pruned_preorder_iterator
+{
+    /// @brief Root of tree being iterated over. Included
+    /// in iteration and returned first.
+    struct ecu_ntnode *root;
+
+    /// @brief Current node in the iteration. NULL once
+    /// the iteration is finished.
+    struct ecu_ntnode *current;
+
+    /// @brief Level of current node relative to root.
+    size_t level;
+
+    /// @brief Deepest level to iterate over, relative to root.
+    size_t max_level;
+
+    /// @brief True if the current node's descendants should
+    /// not be returned by the next call to next().
+    bool skip;
+};
+
+/**
+ * @brief Const preorder iterator that can skip subtrees and
+ * stop at a maximum level. End of iteration is NULL.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntnode_pruned_preorder_citerator
+{
+    /// @brief Root of tree being iterated over. Included
+    /// in iteration and returned first.
+    const struct ecu_ntnode *root;
+
+    /// @brief Current node in the iteration. NULL once
+    /// the iteration is finished.
+    const struct ecu_ntnode *current;
+
+    /// @brief Level of current node relative to root.
+    size_t level;
+
+    /// @brief Deepest level to iterate over, relative to root.
+    size_t max_level;
+
+    /// @brief True if the current node's descendants should
+    /// not be returned by the next call to next().
+    bool skip;
+};
+
+/*------------------------------------------------------------*/
+/*---------------- NTNODE LEVELORDER ITERATOR ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Non-const level-order iterator. End of iteration is NULL.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntnode_levelorder_iterator
+{
+    /// @brief Root of tree being iterated over. Included
+    /// in iteration and returned first.
+    struct ecu_ntnode *root;
+
+    /// @brief Current node in the iteration. NULL once
+    /// the iteration is finished.
+    struct ecu_ntnode *current;
+
+    /// @brief First node in the level below the current node.
+    /// NULL until a node in the current level with children
+    /// has been returned.
+    struct ecu_ntnode *next_level;
+
+    /// @brief Level of current node relative to root.
+    size_t level;
+
+    /// @brief Deepest level to iterate over, relative to root.
+    size_t max_level;
+};
+
+/**
+ * @brief Const level-order iterator. End of iteration is NULL.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntnode_levelorder_citerator
+{
+    /// @brief Root of tree being iterated over. Included
+    /// in iteration and returned first.
+    const struct ecu_ntnode *root;
+
+    /// @brief Current node in the iteration. NULL once
+    /// the iteration is finished.
+    const struct ecu_ntnode *current;
+
+    /// @brief First node in the level below the current node.
+    /// NULL until a node in the current level with children
+    /// has been returned.
+    const struct ecu_ntnode *next_level;
+
+    /// @brief Level of current node relative to root.
+    size_t level;
+
+    /// @brief Deepest level to iterate over, relative to root.
+    size_t max_level;
+};
+
 /*------------------------------------------------------------*/
 /*--------------- NTNODE PREV SIBLING ITERATOR ---------------*/
 /*------------------------------------------------------------*/
@@ -845,12 +1409,38 @@ extern void ecu_ntnode_clear(struct ecu_ntnode *me);
  * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
  * @brief Returns the number of direct children the supplied node
  * has. Grandchildren, great-granchildren, etc are not counted.
- * Returns 0 if the node has no children.
+ * Returns 0 if the node has no children. O(1) if @ref ECU_NTNODE_COUNTED
+ * is defined. Otherwise O(number of children).
  *
  * @param me Node to check.
  */
 extern size_t ecu_ntnode_count(const struct ecu_ntnode *me);
 
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Returns the child with the supplied object ID. NULL is
+ * returned if no child has this ID. If multiple children share the
+ * ID, which one is returned is unspecified. Grandchildren, etc are
+ * not searched. O(1) on average if @ref ECU_NTNODE_INDEXED is defined
+ * and an index was attached via @ref ecu_ntnode_attach_index().
+ * Otherwise O(number of children).
+ *
+ * @param me Node whose children are searched.
+ * @param id Object ID to find.
+ */
+extern struct ecu_ntnode *ecu_ntnode_find_child_by_id(struct ecu_ntnode *me, ecu_object_id_t id);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Const-qualified version of @ref ecu_ntnode_find_child_by_id().
+ * Returns the child with the supplied object ID. NULL is returned
+ * if no child has this ID.
+ *
+ * @param me Node whose children are searched.
+ * @param id Object ID to find.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_find_cchild_by_id(const struct ecu_ntnode *me, ecu_object_id_t id);
+
 /**
  * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
  * @brief Returns the node's first (leftmost) child. NULL is returned
@@ -889,13 +1479,40 @@ extern ecu_object_id_t ecu_ntnode_id(const struct ecu_ntnode *me);
 extern bool ecu_ntnode_in_tree(const struct ecu_ntnode *me);
 
 /**
- * @pre @p pos and @p sibling previously constructed via @ref ecu_ntnode_ctor().
- * @brief Inserts a sibling node into the tree after the specified position.
- * @p sibling becomes @p pos's next sibling.
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Returns the node's position among its siblings. The first
+ * (leftmost) child is at index 0. O(index). Use @ref ecu_ntrank
+ * for nodes with many children that are accessed by position.
  *
- * @param pos Position node. Node is inserted after this position.
- * This cannot be a root.
- * @param sibling Node to insert. This cannot already be within a tree
+ * @param me Node to check. This cannot be a root.
+ */
+extern size_t ecu_ntnode_index_of(const struct ecu_ntnode *me);
+
+/**
+ * @pre @p parent and @p child previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Inserts a child node into the tree at the specified position.
+ * @p child becomes @p parent's child at index @p index and every child
+ * previously at or after @p index moves one position to the right.
+ * O(index). Use @ref ecu_ntrank for nodes with many children that are
+ * accessed by position.
+ *
+ * @param parent Parent node to add child to.
+ * @param child Node to insert. This cannot already be within a tree
+ * unless this is a root node.
+ * @param index Position to insert at. Must be less than or equal to
+ * @p parent's number of children. Equal appends @p child like
+ * @ref ecu_ntnode_push_child_back().
+ */
+extern void ecu_ntnode_insert_child_at(struct ecu_ntnode *parent, struct ecu_ntnode *child, size_t index);
+
+/**
+ * @pre @p pos and @p sibling previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Inserts a sibling node into the tree after the specified position.
+ * @p sibling becomes @p pos's next sibling.
+ *
+ * @param pos Position node. Node is inserted after this position.
+ * This cannot be a root.
+ * @param sibling Node to insert. This cannot already be within a tree
  * unless this is a root node. If this is a root of an existing tree,
  * its tree remains intact.
  */
@@ -914,6 +1531,18 @@ extern void ecu_ntnode_insert_sibling_after(struct ecu_ntnode *pos, struct ecu_n
  */
 extern void ecu_ntnode_insert_sibling_before(struct ecu_ntnode *pos, struct ecu_ntnode *sibling);
 
+/**
+ * @pre @p me and @p node previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Returns true if @p me is a parent, grandparent, great-grandparent,
+ * etc of @p node. False otherwise, including when @p me and @p node
+ * are the same node. O(level difference) if @ref ECU_NTNODE_COUNTED
+ * is defined. Otherwise O(level of @p node).
+ *
+ * @param me Function returns true if this node is an ancestor of @p node.
+ * @param node Node to check.
+ */
+extern bool ecu_ntnode_is_ancestor(const struct ecu_ntnode *me, const struct ecu_ntnode *node);
+
 /**
  * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
  * @brief Returns true if the node is in a tree and is not the
@@ -966,7 +1595,10 @@ extern const struct ecu_ntnode *ecu_ntnode_last_cchild(const struct ecu_ntnode *
  * @pre @p n1 and @p n2 previously constructed via @ref ecu_ntnode_ctor().
  * @brief Returns the least common ancestor of @p n1 and @p n2.
  * Returns NULL if nodes are in separate trees and do not have
- * an LCA.
+ * an LCA. The deeper node is first lifted to the level of the
+ * other, then both are walked up together, so this is O(level).
+ * Use @ref ecu_ntindex_lca() for repeated queries on a tree that
+ * no longer changes.
  *
  * @param n1 First node to check.
  * @param n2 Second node to check.
@@ -978,7 +1610,7 @@ extern struct ecu_ntnode *ecu_ntnode_lca(struct ecu_ntnode *n1, struct ecu_ntnod
  * @brief Const-qualified version of @ref ecu_ntnode_lca().
  * Returns the least common ancestor of @p n1 and @p n2.
  * Returns NULL if nodes are in separate trees and do not have
- * an LCA.
+ * an LCA. O(level).
  *
  * @param n1 First node to check.
  * @param n2 Second node to check.
@@ -988,12 +1620,82 @@ extern const struct ecu_ntnode *ecu_ntnode_clca(const struct ecu_ntnode *n1, con
 /**
  * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
  * @brief Returns which level of the tree the supplied node is in.
- * Returns 0 if the supplied node is a root.
+ * Returns 0 if the supplied node is a root. O(1) if @ref ECU_NTNODE_COUNTED
+ * is defined. Otherwise O(level).
  *
  * @param me Node to check.
  */
 extern size_t ecu_ntnode_level(const struct ecu_ntnode *me);
 
+/**
+ * @pre @p parent and @p child previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Moves a subtree so @p child becomes @p parent's last (rightmost)
+ * child. Unlike @ref ecu_ntnode_push_child_back(), @p child can already be
+ * in a tree. It is removed from its current position first and its subtree
+ * stays intact. Relinking is O(1). The check that @p parent is not in
+ * @p child's subtree is O(level of @p parent). If @ref ECU_NTNODE_COUNTED
+ * is defined, cached counts of both old and new ancestors are updated and
+ * every node in the subtree is releveled if its level changes.
+ *
+ * @param parent Parent node to move child to. This cannot be in
+ * @p child's subtree.
+ * @param child Root of subtree to move. This will become @p parent's
+ * last child.
+ */
+extern void ecu_ntnode_move_child_back(struct ecu_ntnode *parent, struct ecu_ntnode *child);
+
+/**
+ * @pre @p parent and @p child previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Same as @ref ecu_ntnode_move_child_back() but @p child becomes
+ * @p parent's first (leftmost) child.
+ *
+ * @param parent Parent node to move child to. This cannot be in
+ * @p child's subtree.
+ * @param child Root of subtree to move. This will become @p parent's
+ * first child.
+ */
+extern void ecu_ntnode_move_child_front(struct ecu_ntnode *parent, struct ecu_ntnode *child);
+
+/**
+ * @pre @p parent and @p from previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Moves every child of @p from, along with their subtrees, to the
+ * back of @p parent's children. Child order is preserved and @p from becomes
+ * a leaf. The sibling lists are spliced together in O(1). Only each moved
+ * child's parent is updated, so the cost is O(number of children moved)
+ * regardless of how large their subtrees are. If @ref ECU_NTNODE_COUNTED is
+ * defined, moved subtrees are also releveled if their level changes.
+ *
+ * @param parent Parent node to move children to. This cannot be in
+ * @p from's subtree.
+ * @param from Node whose children are moved. Nothing happens if this
+ * is a leaf.
+ */
+extern void ecu_ntnode_move_children(struct ecu_ntnode *parent, struct ecu_ntnode *from);
+
+/**
+ * @pre @p pos and @p sibling previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Moves a subtree so @p sibling becomes @p pos's next sibling.
+ * Unlike @ref ecu_ntnode_insert_sibling_after(), @p sibling can already
+ * be in a tree. Same cost as @ref ecu_ntnode_move_child_back().
+ *
+ * @param pos Position node. Subtree is moved after this position. This
+ * cannot be a root and cannot be in @p sibling's subtree.
+ * @param sibling Root of subtree to move.
+ */
+extern void ecu_ntnode_move_sibling_after(struct ecu_ntnode *pos, struct ecu_ntnode *sibling);
+
+/**
+ * @pre @p pos and @p sibling previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Moves a subtree so @p sibling becomes @p pos's previous sibling.
+ * Unlike @ref ecu_ntnode_insert_sibling_before(), @p sibling can already
+ * be in a tree. Same cost as @ref ecu_ntnode_move_child_back().
+ *
+ * @param pos Position node. Subtree is moved before this position. This
+ * cannot be a root and cannot be in @p sibling's subtree.
+ * @param sibling Root of subtree to move.
+ */
+extern void ecu_ntnode_move_sibling_before(struct ecu_ntnode *pos, struct ecu_ntnode *sibling);
+
 /**
  * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
  * @brief Returns the node's next (right) sibling. NULL is returned
@@ -1013,6 +1715,31 @@ extern struct ecu_ntnode *ecu_ntnode_next(struct ecu_ntnode *me);
  */
 extern const struct ecu_ntnode *ecu_ntnode_cnext(const struct ecu_ntnode *me);
 
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Returns the node's child at the specified position. The
+ * first (leftmost) child is at index 0. NULL is returned if @p index
+ * is greater than or equal to the number of children. O(index). Use
+ * @ref ecu_ntrank for nodes with many children that are accessed by
+ * position.
+ *
+ * @param me Node whose children are searched.
+ * @param index Position of child to return.
+ */
+extern struct ecu_ntnode *ecu_ntnode_nth_child(struct ecu_ntnode *me, size_t index);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Const-qualified version of @ref ecu_ntnode_nth_child().
+ * Returns the node's child at the specified position. NULL is
+ * returned if @p index is greater than or equal to the number of
+ * children.
+ *
+ * @param me Node whose children are searched.
+ * @param index Position of child to return.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_nth_cchild(const struct ecu_ntnode *me, size_t index);
+
 /**
  * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
  * @brief Returns the supplied node's parent. NULL is returned
@@ -1083,10 +1810,46 @@ extern void ecu_ntnode_push_child_front(struct ecu_ntnode *parent, struct ecu_nt
  */
 extern void ecu_ntnode_remove(struct ecu_ntnode *me);
 
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Follows a path of object IDs down the tree and returns
+ * the node at the end of it. I.e. path {A, B} returns the child with
+ * ID B of the child with ID A of @p me. NULL is returned if any step
+ * of the path does not exist. Each step is a call to
+ * @ref ecu_ntnode_find_child_by_id() so resolving is O(1) per level
+ * on average if every node on the path has an index attached.
+ *
+ * @param me Node the path starts at. Returned if @p length is 0.
+ * @param path Array of object IDs, one per level. Can only be
+ * NULL if @p length is 0.
+ * @param length Number of IDs in @p path.
+ */
+extern struct ecu_ntnode *ecu_ntnode_resolve(struct ecu_ntnode *me,
+                                             const ecu_object_id_t *path,
+                                             size_t length);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Const-qualified version of @ref ecu_ntnode_resolve().
+ * Follows a path of object IDs down the tree and returns the node
+ * at the end of it. NULL is returned if any step of the path does
+ * not exist.
+ *
+ * @param me Node the path starts at. Returned if @p length is 0.
+ * @param path Array of object IDs, one per level. Can only be
+ * NULL if @p length is 0.
+ * @param length Number of IDs in @p path.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_cresolve(const struct ecu_ntnode *me,
+                                                    const ecu_object_id_t *path,
+                                                    size_t length);
+
 /**
  * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
  * @brief Returns the total number of descendants (children, grandchildren,
  * etc) the node has. Returns 0 if the node has no descendants.
+ * O(1) if @ref ECU_NTNODE_COUNTED is defined. Otherwise O(number
+ * of descendants).
  *
  * @param me Node to check.
  */
@@ -1101,6 +1864,186 @@ extern size_t ecu_ntnode_size(const struct ecu_ntnode *me);
 extern bool ecu_ntnode_valid(const struct ecu_ntnode *me);
 /**@}*/
 
+#if defined(ECU_NTNODE_DIRTY)
+/*------------------------------------------------------------*/
+/*----------------------- DIRTY TRACKING ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Dirty Tracking
+ * Only available if @ref ECU_NTNODE_DIRTY is defined.
+ */
+/**@{*/
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Returns true if the node's aggregate value is stale and
+ * will be recomputed on the next @ref ecu_ntnode_refresh(). Newly
+ * constructed nodes are dirty. O(1).
+ *
+ * @param me Node to check.
+ */
+extern bool ecu_ntnode_is_dirty(const struct ecu_ntnode *me);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Marks the node and all of its ancestors dirty. Call this
+ * after editing the user's data stored with a node. Stops at the first
+ * ancestor that is already dirty since everything above it is dirty
+ * too, so marking many nodes in the same branch is cheap. O(level)
+ * in the worst case.
+ *
+ * @param me Node whose value changed.
+ */
+extern void ecu_ntnode_mark_dirty(struct ecu_ntnode *me);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Recomputes every dirty node in @p me's subtree in postorder,
+ * so each node is combined after its dirty children. Clean subtrees
+ * are not entered since none of their values changed. Returns the
+ * number of nodes recomputed. O(number of dirty nodes and their
+ * children).
+ *
+ * @warning @p combine must not add, remove or move nodes. It can
+ * only edit the user's data stored with each node.
+ *
+ * @param me Root of subtree to refresh. This does not have to be
+ * the root of the entire tree. Its ancestors stay dirty.
+ * @param combine Callback that executes once for every dirty node.
+ * Recomputes the node's aggregate value from its own data and its
+ * children's aggregate values. The node is marked clean afterwards.
+ * Cannot be NULL.
+ * @param obj Optional object to pass to @p combine. Supply
+ * @ref ECU_NTNODE_OBJ_UNUSED if unused.
+ */
+extern size_t ecu_ntnode_refresh(struct ecu_ntnode *me,
+                                 void (*combine)(struct ecu_ntnode *node, void *obj),
+                                 void *obj);
+/**@}*/
+#endif /* ECU_NTNODE_DIRTY */
+
+#if defined(ECU_NTNODE_INDEXED)
+/*------------------------------------------------------------*/
+/*------------------------- CHILD INDEX ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Child Index
+ * Only available if @ref ECU_NTNODE_INDEXED is defined.
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me and @p slots.
+ * @brief Child index constructor. Index is empty and unused
+ * until attached via @ref ecu_ntnode_attach_index().
+ *
+ * @param me Index to construct. This cannot be NULL.
+ * @param slots Array of @p capacity node pointers.
+ * @param capacity Number of elements in @p slots. Must be a power
+ * of two. Must be greater than the number of children the node
+ * will ever have, since at least one slot is always left empty.
+ * Lookups slow down as the index fills up so twice the number of
+ * children is recommended.
+ */
+extern void ecu_ntnode_index_ctor(struct ecu_ntnode_index *me,
+                                  struct ecu_ntnode **slots,
+                                  size_t capacity);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @pre @p index previously constructed via @ref ecu_ntnode_index_ctor().
+ * @brief Attaches an index to a node so its children can be found
+ * by object ID in O(1) on average. The node's existing children are
+ * added to the index immediately. Afterwards the index is kept in
+ * sync automatically whenever a child is inserted or removed.
+ *
+ * @warning @p index cannot be attached to more than one node
+ * at a time.
+ *
+ * @param me Node whose children are indexed. Cannot already have
+ * an index attached.
+ * @param index Index to attach. Its contents are replaced.
+ */
+extern void ecu_ntnode_attach_index(struct ecu_ntnode *me, struct ecu_ntnode_index *index);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Detaches the node's index. Lookups go back to scanning
+ * the children. Does nothing if the node has no index.
+ *
+ * @param me Node whose index is detached.
+ */
+extern void ecu_ntnode_detach_index(struct ecu_ntnode *me);
+/**@}*/
+#endif /* ECU_NTNODE_INDEXED */
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+/*------------------------------------------------------------*/
+/*------------------------- FAST CLEAR -----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Fast Clear
+ * Only available if @ref ECU_NTNODE_FAST_CLEAR is defined.
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @brief Epoch constructor. Epoch is unused until attached
+ * via @ref ecu_ntnode_attach_epoch().
+ *
+ * @param me Epoch to construct. This cannot be NULL.
+ */
+extern void ecu_ntnode_epoch_ctor(struct ecu_ntnode_epoch *me);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @pre @p epoch previously constructed via @ref ecu_ntnode_epoch_ctor().
+ * @brief Attaches an epoch to a tree so it can be cleared via
+ * @ref ecu_ntnode_fast_clear(). Every node already in the tree is
+ * stamped, which is O(n). Afterwards nodes are stamped automatically
+ * as they are inserted. The epoch is lost if @p me is later inserted
+ * into another tree.
+ *
+ * @warning @p epoch cannot be attached to more than one tree
+ * at a time.
+ *
+ * @param me Root of the tree. Cannot be in another epoch's tree.
+ * @param epoch Epoch to attach.
+ */
+extern void ecu_ntnode_attach_epoch(struct ecu_ntnode *me, struct ecu_ntnode_epoch *epoch);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Removes every descendant of @p me in O(1). The descendants
+ * are not visited. Instead the epoch's generation is incremented so
+ * their stamps become stale. The generation is 64 bits on every
+ * target, so it cannot wrap back to an old stamp even at one clear
+ * per microsecond for centuries. Asserts instead of wrapping. Stale
+ * nodes are treated as empty roots by @ref ecu_ntnode_in_tree(),
+ * @ref ecu_ntnode_is_descendant(), @ref ecu_ntnode_is_leaf() and
+ * @ref ecu_ntnode_is_root(). They are detached in O(1) the first
+ * time they are passed to
+ * @ref ecu_ntnode_push_child_back(), @ref ecu_ntnode_insert_sibling_after(),
+ * @ref ecu_ntnode_move_child_back(), @ref ecu_ntnode_remove(),
+ * @ref ecu_ntnode_clear(), @ref ecu_ntnode_destroy(), etc. If the root
+ * has a child index, it is emptied, which is O(index capacity).
+ *
+ * @warning Destroy callbacks do not execute. Only use this on trees
+ * whose nodes have no destroy callback or do not need it to run.
+ * @warning Every other function that follows a node's links, such
+ * as @ref ecu_ntnode_parent(), @ref ecu_ntnode_next(),
+ * @ref ecu_ntnode_first_child() and all iterators, asserts if passed
+ * a stale node since its links still point into the cleared tree.
+ * Detach it first.
+ *
+ * @param me Root the epoch was attached to. Stays in the epoch and
+ * can be refilled immediately.
+ */
+extern void ecu_ntnode_fast_clear(struct ecu_ntnode *me);
+/**@}*/
+#endif /* ECU_NTNODE_FAST_CLEAR */
+
 /*------------------------------------------------------------*/
 /*------------------------ CHILD ITERATOR --------------------*/
 /*------------------------------------------------------------*/
@@ -1621,6 +2564,505 @@ extern const struct ecu_ntnode *ecu_ntnode_preorder_iterator_cend(struct ecu_ntn
 extern const struct ecu_ntnode *ecu_ntnode_preorder_iterator_cnext(struct ecu_ntnode_preorder_citerator *me);
 /**@}*/
 
+/*------------------------------------------------------------*/
+/*--------------------- COMPACT ITERATORS --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Compact Postorder and Preorder Iterators
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Starts a compact postorder iteration over the supplied node's tree.
+ * Returns the first node in the iteration, which is the
+ * leftmost leaf of @p root.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const compact postorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration.
+ */
+extern struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_begin(struct ecu_ntnode_compact_postorder_iterator *me,
+                                                                      struct ecu_ntnode *root);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_compact_postorder_iterator_begin().
+ * @brief Returns the ending node in the iteration, which is
+ * always NULL.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const compact postorder iterator.
+ */
+extern struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_end(struct ecu_ntnode_compact_postorder_iterator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_compact_postorder_iterator_begin().
+ * @brief Returns the next node in the iteration. Returns NULL
+ * once the iteration is finished.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const compact postorder iterator.
+ */
+extern struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_next(struct ecu_ntnode_compact_postorder_iterator *me);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Const-qualified version of @ref ecu_ntnode_compact_postorder_iterator_begin().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_COMPACT_POSTORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const compact postorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_cbegin(struct ecu_ntnode_compact_postorder_citerator *me,
+                                                                             const struct ecu_ntnode *root);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_compact_postorder_iterator_cbegin().
+ * @brief Const-qualified version of @ref ecu_ntnode_compact_postorder_iterator_end().
+ * Always returns NULL.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_COMPACT_POSTORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const compact postorder iterator.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_cend(struct ecu_ntnode_compact_postorder_citerator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_compact_postorder_iterator_cbegin().
+ * @brief Const-qualified version of @ref ecu_ntnode_compact_postorder_iterator_next().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_COMPACT_POSTORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const compact postorder iterator.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_cnext(struct ecu_ntnode_compact_postorder_citerator *me);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Starts a compact preorder iteration over the supplied node's tree.
+ * The supplied @p root is returned, which is the first node in the
+ * iteration.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_COMPACT_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const compact preorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration.
+ */
+extern struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_begin(struct ecu_ntnode_compact_preorder_iterator *me,
+                                                                     struct ecu_ntnode *root);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_compact_preorder_iterator_begin().
+ * @brief Returns the ending node in the iteration, which is
+ * always NULL.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_COMPACT_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const compact preorder iterator.
+ */
+extern struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_end(struct ecu_ntnode_compact_preorder_iterator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_compact_preorder_iterator_begin().
+ * @brief Returns the next node in the iteration. Returns NULL
+ * once the iteration is finished.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_COMPACT_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const compact preorder iterator.
+ */
+extern struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_next(struct ecu_ntnode_compact_preorder_iterator *me);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Const-qualified version of @ref ecu_ntnode_compact_preorder_iterator_begin().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_COMPACT_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const compact preorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_cbegin(struct ecu_ntnode_compact_preorder_citerator *me,
+                                                                            const struct ecu_ntnode *root);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_compact_preorder_iterator_cbegin().
+ * @brief Const-qualified version of @ref ecu_ntnode_compact_preorder_iterator_end().
+ * Always returns NULL.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_COMPACT_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const compact preorder iterator.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_cend(struct ecu_ntnode_compact_preorder_citerator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_compact_preorder_iterator_cbegin().
+ * @brief Const-qualified version of @ref ecu_ntnode_compact_preorder_iterator_next().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_COMPACT_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const compact preorder iterator.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_cnext(struct ecu_ntnode_compact_preorder_citerator *me);
+/**@}*/
+
+/*------------------------------------------------------------*/
+/*------------------ PRUNED PREORDER ITERATOR ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Pruned Preorder Iterator
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Starts a preorder iteration that can skip subtrees.
+ * The supplied @p root is returned, which is the first node in
+ * the iteration.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_PRUNED_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const pruned preorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration and is returned in this function.
+ */
+extern struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_begin(struct ecu_ntnode_pruned_preorder_iterator *me,
+                                                                    struct ecu_ntnode *root);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Same as @ref ecu_ntnode_pruned_preorder_iterator_begin() but
+ * nodes deeper than @p max_level are never returned.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_PRUNED_PREORDER_LIMIT_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const pruned preorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration and is returned in this function.
+ * @param max_level Deepest level to iterate over, relative to @p root.
+ * 0 only returns @p root.
+ */
+extern struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_limit(struct ecu_ntnode_pruned_preorder_iterator *me,
+                                                                    struct ecu_ntnode *root,
+                                                                    size_t max_level);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_pruned_preorder_iterator_begin()
+ * or @ref ecu_ntnode_pruned_preorder_iterator_limit().
+ * @brief Returns the ending node in the iteration, which is
+ * always NULL.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_PRUNED_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const pruned preorder iterator.
+ */
+extern struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_end(struct ecu_ntnode_pruned_preorder_iterator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_pruned_preorder_iterator_begin()
+ * or @ref ecu_ntnode_pruned_preorder_iterator_limit().
+ * @brief Returns the next node in the iteration. Returns NULL
+ * once the iteration is finished.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_PRUNED_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const pruned preorder iterator.
+ */
+extern struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_next(struct ecu_ntnode_pruned_preorder_iterator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_pruned_preorder_iterator_begin()
+ * or @ref ecu_ntnode_pruned_preorder_iterator_limit().
+ * @brief Skips all descendants of the current node. The next node
+ * in the iteration is the current node's next sibling, or the
+ * closest ancestor's next sibling. Meant to be called inside
+ * @ref ECU_NTNODE_PRUNED_PREORDER_FOR_EACH() to prune a subtree that
+ * is known to be irrelevant:
+ * @code{.c}
+ * ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(n, &iter, &root)
+ * {
+ *     if (is_disabled(n))
+ *     {
+ *         ecu_ntnode_pruned_preorder_iterator_skip(&iter);
+ *     }
+ * }
+ * @endcode
+ *
+ * @param me Non-const pruned preorder iterator.
+ */
+extern void ecu_ntnode_pruned_preorder_iterator_skip(struct ecu_ntnode_pruned_preorder_iterator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_pruned_preorder_iterator_begin()
+ * or @ref ecu_ntnode_pruned_preorder_iterator_limit().
+ * @brief Returns the level of the current node in the iteration,
+ * relative to the root being iterated over. The root is level 0.
+ *
+ * @param me Non-const pruned preorder iterator.
+ */
+extern size_t ecu_ntnode_pruned_preorder_iterator_level(const struct ecu_ntnode_pruned_preorder_iterator *me);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Const-qualified version of @ref ecu_ntnode_pruned_preorder_iterator_begin().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_PRUNED_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const pruned preorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration and is returned in this function.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_cbegin(struct ecu_ntnode_pruned_preorder_citerator *me,
+                                                                           const struct ecu_ntnode *root);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Const-qualified version of @ref ecu_ntnode_pruned_preorder_iterator_limit().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_PRUNED_PREORDER_LIMIT_FOR_EACH()
+ * instead.
+ *
+ * @param me Const pruned preorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration and is returned in this function.
+ * @param max_level Deepest level to iterate over, relative to @p root.
+ * 0 only returns @p root.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_climit(struct ecu_ntnode_pruned_preorder_citerator *me,
+                                                                           const struct ecu_ntnode *root,
+                                                                           size_t max_level);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_pruned_preorder_iterator_cbegin()
+ * or @ref ecu_ntnode_pruned_preorder_iterator_climit().
+ * @brief Const-qualified version of @ref ecu_ntnode_pruned_preorder_iterator_end().
+ * Always returns NULL.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_PRUNED_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const pruned preorder iterator.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_cend(struct ecu_ntnode_pruned_preorder_citerator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_pruned_preorder_iterator_cbegin()
+ * or @ref ecu_ntnode_pruned_preorder_iterator_climit().
+ * @brief Const-qualified version of @ref ecu_ntnode_pruned_preorder_iterator_next().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_PRUNED_PREORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const pruned preorder iterator.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_cnext(struct ecu_ntnode_pruned_preorder_citerator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_pruned_preorder_iterator_cbegin()
+ * or @ref ecu_ntnode_pruned_preorder_iterator_climit().
+ * @brief Const-qualified version of @ref ecu_ntnode_pruned_preorder_iterator_skip().
+ *
+ * @param me Const pruned preorder iterator.
+ */
+extern void ecu_ntnode_pruned_preorder_iterator_cskip(struct ecu_ntnode_pruned_preorder_citerator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_pruned_preorder_iterator_cbegin()
+ * or @ref ecu_ntnode_pruned_preorder_iterator_climit().
+ * @brief Const-qualified version of @ref ecu_ntnode_pruned_preorder_iterator_level().
+ *
+ * @param me Const pruned preorder iterator.
+ */
+extern size_t ecu_ntnode_pruned_preorder_iterator_clevel(const struct ecu_ntnode_pruned_preorder_citerator *me);
+/**@}*/
+
+/*------------------------------------------------------------*/
+/*-------------------- LEVELORDER ITERATOR -------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Levelorder Iterator
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Starts a level-order iteration over the supplied node's tree.
+ * The supplied @p root is returned, which is the first node in
+ * the iteration.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_LEVELORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const levelorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration.
+ */
+extern struct ecu_ntnode *ecu_ntnode_levelorder_iterator_begin(struct ecu_ntnode_levelorder_iterator *me,
+                                                               struct ecu_ntnode *root);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Same as @ref ecu_ntnode_levelorder_iterator_begin() but
+ * the iteration stops after @p max_level.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_LEVELORDER_LIMIT_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const levelorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration.
+ * @param max_level Deepest level to iterate over, relative to @p root.
+ * 0 only returns @p root.
+ */
+extern struct ecu_ntnode *ecu_ntnode_levelorder_iterator_limit(struct ecu_ntnode_levelorder_iterator *me,
+                                                               struct ecu_ntnode *root,
+                                                               size_t max_level);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_levelorder_iterator_begin()
+ * or @ref ecu_ntnode_levelorder_iterator_limit().
+ * @brief Returns the ending node in the iteration, which is
+ * always NULL.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_LEVELORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const levelorder iterator.
+ */
+extern struct ecu_ntnode *ecu_ntnode_levelorder_iterator_end(struct ecu_ntnode_levelorder_iterator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_levelorder_iterator_begin()
+ * or @ref ecu_ntnode_levelorder_iterator_limit().
+ * @brief Returns the next node in the iteration. Returns NULL
+ * once the iteration is finished. O(height) in the worst case
+ * since upper levels are walked to reach the next node in a level.
+ * A full iteration is O(n * height), not O(n).
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_LEVELORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const levelorder iterator.
+ */
+extern struct ecu_ntnode *ecu_ntnode_levelorder_iterator_next(struct ecu_ntnode_levelorder_iterator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_levelorder_iterator_begin()
+ * or @ref ecu_ntnode_levelorder_iterator_limit().
+ * @brief Returns the level of the current node in the iteration,
+ * relative to the root being iterated over. The root is level 0.
+ * Can be called inside @ref ECU_NTNODE_LEVELORDER_FOR_EACH(), for
+ * example to get the distance to the first node that matches
+ * a condition.
+ *
+ * @param me Non-const levelorder iterator.
+ */
+extern size_t ecu_ntnode_levelorder_iterator_level(const struct ecu_ntnode_levelorder_iterator *me);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Const-qualified version of @ref ecu_ntnode_levelorder_iterator_begin().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_LEVELORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const levelorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_levelorder_iterator_cbegin(struct ecu_ntnode_levelorder_citerator *me,
+                                                                      const struct ecu_ntnode *root);
+
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p root previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Const-qualified version of @ref ecu_ntnode_levelorder_iterator_limit().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_LEVELORDER_LIMIT_FOR_EACH()
+ * instead.
+ *
+ * @param me Const levelorder iterator to initialize.
+ * @param root Root of tree to iterate over. This root is
+ * included in the iteration.
+ * @param max_level Deepest level to iterate over, relative to @p root.
+ * 0 only returns @p root.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_levelorder_iterator_climit(struct ecu_ntnode_levelorder_citerator *me,
+                                                                      const struct ecu_ntnode *root,
+                                                                      size_t max_level);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_levelorder_iterator_cbegin()
+ * or @ref ecu_ntnode_levelorder_iterator_climit().
+ * @brief Const-qualified version of @ref ecu_ntnode_levelorder_iterator_end().
+ * Always returns NULL.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_LEVELORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const levelorder iterator.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_levelorder_iterator_cend(struct ecu_ntnode_levelorder_citerator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_levelorder_iterator_cbegin()
+ * or @ref ecu_ntnode_levelorder_iterator_climit().
+ * @brief Const-qualified version of @ref ecu_ntnode_levelorder_iterator_next().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_NTNODE_CONST_LEVELORDER_FOR_EACH()
+ * instead.
+ *
+ * @param me Const levelorder iterator.
+ */
+extern const struct ecu_ntnode *ecu_ntnode_levelorder_iterator_cnext(struct ecu_ntnode_levelorder_citerator *me);
+
+/**
+ * @pre @p me started via @ref ecu_ntnode_levelorder_iterator_cbegin()
+ * or @ref ecu_ntnode_levelorder_iterator_climit().
+ * @brief Const-qualified version of @ref ecu_ntnode_levelorder_iterator_level().
+ *
+ * @param me Const levelorder iterator.
+ */
+extern size_t ecu_ntnode_levelorder_iterator_clevel(const struct ecu_ntnode_levelorder_citerator *me);
+/**@}*/
+
 /*------------------------------------------------------------*/
 /*------------------- PREV SIBLING ITERATOR ------------------*/
 /*------------------------------------------------------------*/
@@ -0,0 +1,201 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ntrank.h section <ntrank_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_NTRANK_H_
+#define ECU_NTRANK_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stddef.h>
+
+/* ECU. */
+#include "ecu/ntnode.h"
+
+/*------------------------------------------------------------*/
+/*-------------------------- NTRANK --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Entry of a single ranked child. Slots are addressed
+ * by array index and unused links are (size_t)-1.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntrank_slot
+{
+    /// @brief Ranked child. NULL if slot is empty.
+    struct ecu_ntnode *node;
+
+    /// @brief Slot of left child in the treap. Every child in
+    /// this subtree is an earlier sibling.
+    size_t left;
+
+    /// @brief Slot of right child in the treap. Every child in
+    /// this subtree is a later sibling.
+    size_t right;
+
+    /// @brief Slot of parent in the treap.
+    size_t up;
+
+    /// @brief Number of children in this treap subtree,
+    /// including itself.
+    size_t size;
+};
+
+/**
+ * @brief Positional index of one node's children. Children are
+ * kept in a balanced binary tree (treap) ordered by position so
+ * they can be found by position, and their position can be found,
+ * in O(log n) on average. Treap entries are stored in a user-supplied
+ * hash table keyed by node address, so no memory is allocated and
+ * @ref ecu_ntnode is left unchanged.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntrank
+{
+    /// @brief Node whose children are ranked. NULL until
+    /// @ref ecu_ntrank_build() is called.
+    struct ecu_ntnode *parent;
+
+    /// @brief User-supplied slot array.
+    struct ecu_ntrank_slot *slots;
+
+    /// @brief Number of slots. Always a power of two.
+    size_t capacity;
+
+    /// @brief Slot of the treap's root. (size_t)-1 if
+    /// no children are ranked.
+    size_t root;
+};
+
+/*------------------------------------------------------------*/
+/*------------------ NTRANK MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Ntrank Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me and @p slots.
+ * @brief Rank constructor. Nothing is ranked until
+ * @ref ecu_ntrank_build() is called.
+ *
+ * @param me Rank to construct. This cannot be NULL.
+ * @param slots Array of @p capacity slots.
+ * @param capacity Number of slots. Must be a power of two and
+ * greater than the number of children that will ever be ranked.
+ * Lookups slow down as the table fills up so twice the number of
+ * children is recommended.
+ */
+extern void ecu_ntrank_ctor(struct ecu_ntrank *me,
+                            struct ecu_ntrank_slot *slots,
+                            size_t capacity);
+/**@}*/
+
+/**
+ * @name Ntrank Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me previously constructed via @ref ecu_ntrank_ctor().
+ * @brief Ranks every current child of @p parent. Any previous
+ * contents are replaced. Returns the number of children ranked.
+ * O(n log n) on average.
+ *
+ * @warning Afterwards @p parent's children must only be added and
+ * removed through @ref ecu_ntrank_insert_child_at() and
+ * @ref ecu_ntrank_remove(). Changing them in any other way, such as
+ * through @ref ecu_ntnode_push_child_back() or by clearing or
+ * destroying the tree, is not detected and leaves the rank stale
+ * until it is rebuilt.
+ *
+ * @param me Rank to build.
+ * @param parent Node whose children are ranked.
+ */
+extern size_t ecu_ntrank_build(struct ecu_ntrank *me, struct ecu_ntnode *parent);
+
+/**
+ * @pre @p me previously built via @ref ecu_ntrank_build().
+ * @brief Returns the number of ranked children. O(1).
+ *
+ * @param me Rank to query.
+ */
+extern size_t ecu_ntrank_count(const struct ecu_ntrank *me);
+
+/**
+ * @pre @p me previously built via @ref ecu_ntrank_build().
+ * @brief Returns the child's position among its siblings. The first
+ * (leftmost) child is at index 0. O(log n) on average.
+ *
+ * @param me Rank to query.
+ * @param child Child to find. This must be a child of the ranked node.
+ */
+extern size_t ecu_ntrank_index_of(const struct ecu_ntrank *me, const struct ecu_ntnode *child);
+
+/**
+ * @pre @p me previously built via @ref ecu_ntrank_build(). @p child
+ * previously constructed via @ref ecu_ntnode_ctor().
+ * @brief Inserts a child node into the tree at the specified position
+ * and ranks it. @p child becomes the ranked node's child at index
+ * @p index and every child previously at or after @p index moves one
+ * position to the right. O(log n) on average.
+ *
+ * @param me Rank of node to add child to.
+ * @param child Node to insert. This cannot already be within a tree
+ * unless this is a root node.
+ * @param index Position to insert at. Must be less than or equal to
+ * @ref ecu_ntrank_count(). Equal appends @p child like
+ * @ref ecu_ntnode_push_child_back().
+ */
+extern void ecu_ntrank_insert_child_at(struct ecu_ntrank *me, struct ecu_ntnode *child, size_t index);
+
+/**
+ * @pre @p me previously built via @ref ecu_ntrank_build().
+ * @brief Returns the ranked node's child at the specified position.
+ * The first (leftmost) child is at index 0. NULL is returned if
+ * @p index is greater than or equal to @ref ecu_ntrank_count().
+ * O(log n) on average.
+ *
+ * @param me Rank to query.
+ * @param index Position of child to return.
+ */
+extern struct ecu_ntnode *ecu_ntrank_nth_child(const struct ecu_ntrank *me, size_t index);
+
+/**
+ * @pre @p me previously built via @ref ecu_ntrank_build().
+ * @brief Removes a child, along with its subtree, from the tree
+ * and from the rank. Same as @ref ecu_ntnode_remove() otherwise.
+ * O(log n) on average.
+ *
+ * @param me Rank of node to remove child from.
+ * @param child Child to remove. This must be a child of the ranked node.
+ */
+extern void ecu_ntrank_remove(struct ecu_ntrank *me, struct ecu_ntnode *child);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_NTRANK_H_ */
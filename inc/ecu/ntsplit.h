@@ -0,0 +1,205 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ntsplit.h section <ntsplit_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_NTSPLIT_H_
+#define ECU_NTSPLIT_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stddef.h>
+
+/* ECU. */
+#include "ecu/ntnode.h"
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Convenience define for @ref ecu_ntsplit_run() and
+ * @ref ecu_ntsplit_finish(). Pass this value if optional
+ * callback object is not needed.
+ */
+#define ECU_NTSPLIT_OBJ_UNUSED \
+    ((void *)0)
+
+/*------------------------------------------------------------*/
+/*-------------------------- NTSPLIT -------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Run of consecutive siblings whose subtrees form one
+ * unit of work. The run is [first, last], both inclusive.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntsplit_task
+{
+    /// @brief First sibling in the run.
+    struct ecu_ntnode *first;
+
+    /// @brief Last sibling in the run. Same as @ref first
+    /// if the task is a single subtree.
+    struct ecu_ntnode *last;
+};
+
+/**
+ * @brief Splits a tree into independent tasks so it can be
+ * processed by multiple threads. Every task is a run of whole
+ * subtrees that do not overlap. Nodes that are not in any task
+ * are ancestors of tasks and are processed last, by
+ * @ref ecu_ntsplit_finish().
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ntsplit
+{
+    /// @brief Root of the tree that was split.
+    struct ecu_ntnode *root;
+
+    /// @brief User-supplied task array. Tasks are stored in
+    /// preorder of their first node.
+    struct ecu_ntsplit_task *tasks;
+
+    /// @brief Number of elements in @ref tasks.
+    size_t capacity;
+
+    /// @brief Number of tasks currently stored.
+    size_t count;
+};
+
+/*------------------------------------------------------------*/
+/*----------------- NTSPLIT MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Ntsplit Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me and @p tasks.
+ * @brief Split constructor. Split is empty until
+ * @ref ecu_ntsplit_build() is called.
+ *
+ * @param me Split to construct. This cannot be NULL.
+ * @param tasks Array of @p capacity tasks.
+ * @param capacity Number of elements in @p tasks. Must be
+ * greater than 0. Limits the number of tasks the tree can be
+ * split into.
+ */
+extern void ecu_ntsplit_ctor(struct ecu_ntsplit *me,
+                             struct ecu_ntsplit_task *tasks,
+                             size_t capacity);
+/**@}*/
+
+/**
+ * @name Ntsplit Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me previously constructed via @ref ecu_ntsplit_ctor().
+ * @brief Splits the tree rooted at @p root into tasks of at most
+ * @p grain nodes each. Any previous tasks are replaced. Returns the
+ * number of tasks. O(n) if @ref ECU_NTNODE_COUNTED is defined.
+ * Otherwise subtree sizes are counted up to @p grain nodes, which
+ * adds O(@p grain) for every node whose subtree is too big to be
+ * a task.
+ *
+ * @details Subtrees with more than @p grain nodes are not tasks
+ * themselves. Their root is left for @ref ecu_ntsplit_finish() and
+ * their children are split instead. Consecutive siblings with small
+ * subtrees are packed into the same task. If the task array fills up
+ * the remaining nodes are left for @ref ecu_ntsplit_finish(), so
+ * results are still correct with less parallelism.
+ *
+ * @warning The split is a snapshot. The tree's structure cannot
+ * change until all tasks and @ref ecu_ntsplit_finish() complete.
+ *
+ * @param me Split to build.
+ * @param root Root of tree to split. This does not have to be the
+ * root of the entire tree.
+ * @param grain Maximum number of nodes in a task. Must be greater
+ * than 0. If the whole tree fits, it becomes a single task.
+ */
+extern size_t ecu_ntsplit_build(struct ecu_ntsplit *me,
+                                struct ecu_ntnode *root,
+                                size_t grain);
+
+/**
+ * @pre @p me previously constructed via @ref ecu_ntsplit_ctor().
+ * @brief Returns the number of tasks created by the last call
+ * to @ref ecu_ntsplit_build().
+ *
+ * @param me Split to check.
+ */
+extern size_t ecu_ntsplit_count(const struct ecu_ntsplit *me);
+
+/**
+ * @pre @p me previously built via @ref ecu_ntsplit_build().
+ * @brief Visits every node in task @p i in postorder, so each
+ * node is visited after all of its children. Children are visited
+ * first to last. Tasks do not share nodes so different tasks can
+ * be run on different threads at the same time.
+ *
+ * @warning @p visit must not add, remove or move nodes. It can
+ * only edit the user's data stored with each node.
+ *
+ * @param me Split to run.
+ * @param i Task index. Must be less than @ref ecu_ntsplit_count().
+ * @param visit Callback that executes once for every node in the
+ * task. Cannot be NULL.
+ * @param obj Optional object to pass to @p visit. Supply
+ * @ref ECU_NTSPLIT_OBJ_UNUSED if unused.
+ */
+extern void ecu_ntsplit_run(const struct ecu_ntsplit *me,
+                            size_t i,
+                            void (*visit)(struct ecu_ntnode *node, void *obj),
+                            void *obj);
+
+/**
+ * @pre @p me previously built via @ref ecu_ntsplit_build().
+ * @pre All tasks have completed and their results are visible
+ * to the calling thread, i.e. worker threads were joined.
+ * @brief Visits every node that is not in a task, in postorder.
+ * These are ancestors of tasks, so a bottom-up aggregation is
+ * complete once this returns. Together with the tasks every node
+ * in the tree is visited exactly once.
+ *
+ * @warning @p visit must not add, remove or move nodes. It can
+ * only edit the user's data stored with each node.
+ *
+ * @param me Split to finish.
+ * @param visit Callback that executes once for every node not
+ * in a task. Cannot be NULL.
+ * @param obj Optional object to pass to @p visit. Supply
+ * @ref ECU_NTSPLIT_OBJ_UNUSED if unused.
+ */
+extern void ecu_ntsplit_finish(const struct ecu_ntsplit *me,
+                               void (*visit)(struct ecu_ntnode *node, void *obj),
+                               void *obj);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_NTSPLIT_H_ */
@@ -0,0 +1,368 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`pool.h section <pool_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @warning @ref ecu_pool is not thread-safe. Use @ref ecu_lfpool
+ * if blocks are allocated and freed from multiple threads.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_POOL_H_
+#define ECU_POOL_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+#ifndef ECU_POOL_ALIGNMENT
+/**
+ * @brief Every block starts on a multiple of this many bytes,
+ * and block sizes are rounded up to it so two blocks never share
+ * a cache line. Defaults to a 64 byte cache line. Override it with
+ * a compiler flag (i.e. -DECU_POOL_ALIGNMENT=32) so every translation
+ * unit sees the same value. Must be a power of two that is at least
+ * sizeof(uintptr_t).
+ */
+#define ECU_POOL_ALIGNMENT \
+    ((size_t)64)
+#endif
+
+/**
+ * @brief Number of bytes between the start of two consecutive
+ * blocks in a pool.
+ *
+ * @param block_size_ Number of bytes the user requested per block.
+ */
+#define ECU_POOL_BLOCK_SIZE(block_size_) \
+    ((((size_t)(block_size_) + ECU_POOL_ALIGNMENT - 1) / ECU_POOL_ALIGNMENT) * ECU_POOL_ALIGNMENT)
+
+/**
+ * @brief Number of bytes an @ref ecu_pool buffer needs to hold
+ * a number of blocks regardless of how the buffer is aligned.
+ * Can be used to size buffers at compile-time.
+ *
+ * @param block_size_ Number of bytes the user requested per block.
+ * @param blocks_ Number of blocks.
+ */
+#define ECU_POOL_BUFFER_SIZE(block_size_, blocks_) \
+    ((ECU_POOL_BLOCK_SIZE(block_size_) * (size_t)(blocks_)) + ECU_POOL_ALIGNMENT - 1)
+
+/**
+ * @brief Number of bytes an @ref ecu_lfpool buffer needs to hold
+ * a number of blocks regardless of how the buffer is aligned.
+ * Includes one free list link per block, which is kept outside
+ * of the blocks.
+ *
+ * @param block_size_ Number of bytes the user requested per block.
+ * @param blocks_ Number of blocks.
+ */
+#define ECU_LFPOOL_BUFFER_SIZE(block_size_, blocks_) \
+    (ECU_POOL_BUFFER_SIZE(block_size_, blocks_) + (sizeof(uintptr_t) * (size_t)(blocks_)))
+
+/**
+ * @brief Convenience define for @ref ecu_pool_ctor() and
+ * @ref ecu_lfpool_ctor(). Pass this value if statistics
+ * are not needed.
+ */
+#define ECU_POOL_STATS_UNUSED \
+    ((struct ecu_pool_stats *)0)
+
+/*------------------------------------------------------------*/
+/*-------------------------- POOL STATS ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Optional usage statistics of a single pool. Only
+ * pools that were constructed with statistics pay for them.
+ *
+ * @warning Members can be read directly at any time but can
+ * only be edited by the pool they were given to.
+ */
+struct ecu_pool_stats
+{
+    /// @brief Number of blocks currently allocated.
+    size_t in_use;
+
+    /// @brief Largest value @ref ecu_pool_stats.in_use ever reached.
+    size_t high_water;
+
+    /// @brief Number of allocations that failed because
+    /// the pool was empty.
+    size_t failures;
+};
+
+/*------------------------------------------------------------*/
+/*--------------------------- POOL ---------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Fixed-capacity pool of equally sized blocks carved out of
+ * a user-supplied buffer. Free blocks form an intrusive singly
+ * linked list so allocating and freeing are O(1).
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_pool
+{
+    /// @brief First block. Aligned to @ref ECU_POOL_ALIGNMENT.
+    uint8_t *blocks;
+
+    /// @brief Bytes between consecutive blocks. Multiple of
+    /// @ref ECU_POOL_ALIGNMENT.
+    size_t block_size;
+
+    /// @brief Total number of blocks.
+    size_t capacity;
+
+    /// @brief Number of blocks in the free list.
+    size_t available;
+
+    /// @brief Most recently freed block. The first bytes of every
+    /// free block point to the next free block. NULL if empty.
+    void *free;
+
+    /// @brief Optional statistics. NULL if unused.
+    struct ecu_pool_stats *stats;
+};
+
+/*------------------------------------------------------------*/
+/*-------------------------- LFPOOL --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Lock-free version of @ref ecu_pool. Any number of threads
+ * can allocate and free blocks concurrently. Free blocks form a
+ * Treiber stack whose links are stored outside of the blocks, so
+ * the pool never touches memory a user may still be writing to.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_lfpool
+{
+    /// @brief First block. Aligned to @ref ECU_POOL_ALIGNMENT.
+    uint8_t *blocks;
+
+    /// @brief Next free block of each block, stored as block
+    /// index + 1. 0 terminates the free list.
+    uintptr_t *links;
+
+    /// @brief Bytes between consecutive blocks. Multiple of
+    /// @ref ECU_POOL_ALIGNMENT.
+    size_t block_size;
+
+    /// @brief Total number of blocks.
+    size_t capacity;
+
+    /// @brief Top of the free list. Lower half of the bits is
+    /// the block index + 1. Upper half is a tag that changes with
+    /// every allocation so a stale head is never mistaken for the
+    /// current one (ABA problem). Atomically updated.
+    uintptr_t head;
+
+    /// @brief Optional statistics. NULL if unused. Atomically updated.
+    struct ecu_pool_stats *stats;
+};
+
+/*------------------------------------------------------------*/
+/*-------------------- POOL MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Pool Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @brief Pool constructor. Splits @p buffer into as many blocks
+ * as fit after aligning it to @ref ECU_POOL_ALIGNMENT. All blocks
+ * start out free.
+ *
+ * @warning @p me and @p buffer must not be an active pool,
+ * otherwise behavior is undefined.
+ *
+ * @param me Pool to construct.
+ * @param buffer Memory blocks are carved from. Must stay valid for
+ * the lifetime of the pool. Use @ref ECU_POOL_BUFFER_SIZE() to size it.
+ * @param size Number of bytes in @p buffer. Must hold at least one block.
+ * @param block_size Number of bytes the user needs per block. Rounded
+ * up to a multiple of @ref ECU_POOL_ALIGNMENT. Must be greater than 0.
+ * @param stats Optional statistics updated by this pool. Cleared by
+ * this function. Supply @ref ECU_POOL_STATS_UNUSED if unused.
+ */
+extern void ecu_pool_ctor(struct ecu_pool *me,
+                          void *buffer,
+                          size_t size,
+                          size_t block_size,
+                          struct ecu_pool_stats *stats);
+/**@}*/
+
+/**
+ * @name Pool Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me constructed via @ref ecu_pool_ctor().
+ * @brief Removes a block from the pool and returns it. Returns
+ * NULL if every block is already in use. The block's contents are
+ * unspecified. O(1).
+ *
+ * @param me Pool to allocate from.
+ */
+extern void *ecu_pool_alloc(struct ecu_pool *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_pool_ctor().
+ * @brief Returns the number of blocks that can still be allocated.
+ *
+ * @param me Pool to check.
+ */
+extern size_t ecu_pool_available(const struct ecu_pool *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_pool_ctor().
+ * @brief Returns the total number of blocks in the pool.
+ *
+ * @param me Pool to check.
+ */
+extern size_t ecu_pool_capacity(const struct ecu_pool *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_pool_ctor().
+ * @pre @p ptr points into a block previously returned by
+ * @ref ecu_pool_alloc() that was not freed yet.
+ * @brief Returns a block to the pool. O(1).
+ *
+ * @details @p ptr can point anywhere inside the block. This lets a
+ * destroy callback of an intrusive node hand its node straight back
+ * to the pool without converting it to the user's type first:
+ *
+ * @code{.c}
+ * static void node_destroy(struct ecu_ntnode *me, ecu_object_id_t id)
+ * {
+ *     (void)id;
+ *     ecu_pool_free(&node_pool, me);
+ * }
+ * @endcode
+ *
+ * @param me Pool the block was allocated from.
+ * @param ptr Pointer into the block to free.
+ */
+extern void ecu_pool_free(struct ecu_pool *me, void *ptr);
+
+/**
+ * @pre @p me constructed via @ref ecu_pool_ctor().
+ * @brief Returns true if @p ptr points into a block of this pool.
+ * Does not check if the block is currently allocated. Used to pick
+ * the right pool when one destroy callback serves several pools.
+ *
+ * @param me Pool to check.
+ * @param ptr Pointer to check. Can be NULL.
+ */
+extern bool ecu_pool_owns(const struct ecu_pool *me, const void *ptr);
+/**@}*/
+
+/*------------------------------------------------------------*/
+/*------------------- LFPOOL MEMBER FUNCTIONS ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Lfpool Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @brief Lock-free pool constructor. Same as @ref ecu_pool_ctor()
+ * except one link per block is also stored at the end of @p buffer.
+ * Must complete before the pool is shared with other threads.
+ *
+ * @warning Requires GNU atomic builtins (GCC and Clang). Capacity is
+ * limited to 65535 blocks on targets with 32-bit pointers because
+ * half of the bits of @ref ecu_lfpool.head are used as a tag. Extra
+ * blocks are left unused.
+ *
+ * @param me Pool to construct.
+ * @param buffer Memory blocks are carved from. Must stay valid for
+ * the lifetime of the pool. Use @ref ECU_LFPOOL_BUFFER_SIZE() to size it.
+ * @param size Number of bytes in @p buffer. Must hold at least one
+ * block and its link.
+ * @param block_size Number of bytes the user needs per block. Rounded
+ * up to a multiple of @ref ECU_POOL_ALIGNMENT. Must be greater than 0.
+ * @param stats Optional statistics updated by this pool. Cleared by
+ * this function. Supply @ref ECU_POOL_STATS_UNUSED if unused.
+ */
+extern void ecu_lfpool_ctor(struct ecu_lfpool *me,
+                            void *buffer,
+                            size_t size,
+                            size_t block_size,
+                            struct ecu_pool_stats *stats);
+/**@}*/
+
+/**
+ * @name Lfpool Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me constructed via @ref ecu_lfpool_ctor().
+ * @brief Thread-safe version of @ref ecu_pool_alloc(). Lock-free.
+ *
+ * @param me Pool to allocate from.
+ */
+extern void *ecu_lfpool_alloc(struct ecu_lfpool *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_lfpool_ctor().
+ * @brief Returns the total number of blocks in the pool.
+ *
+ * @param me Pool to check.
+ */
+extern size_t ecu_lfpool_capacity(const struct ecu_lfpool *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_lfpool_ctor().
+ * @pre @p ptr points into a block previously returned by
+ * @ref ecu_lfpool_alloc() that was not freed yet.
+ * @brief Thread-safe version of @ref ecu_pool_free(). Lock-free.
+ * @p ptr can point anywhere inside the block.
+ *
+ * @param me Pool the block was allocated from.
+ * @param ptr Pointer into the block to free.
+ */
+extern void ecu_lfpool_free(struct ecu_lfpool *me, void *ptr);
+
+/**
+ * @pre @p me constructed via @ref ecu_lfpool_ctor().
+ * @brief Same as @ref ecu_pool_owns().
+ *
+ * @param me Pool to check.
+ * @param ptr Pointer to check. Can be NULL.
+ */
+extern bool ecu_lfpool_owns(const struct ecu_lfpool *me, const void *ptr);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_POOL_H_ */
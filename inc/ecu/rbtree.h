@@ -0,0 +1,726 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`rbtree.h section <rbtree_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_RBTREE_H_
+#define ECU_RBTREE_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ECU. */
+#include "ecu/object_id.h"
+#include "ecu/utils.h"
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Convenience define for @ref ecu_rbtree_ctor(). Pass
+ * this value if optional callback object is not needed.
+ */
+#define ECU_RBNODE_OBJ_UNUSED \
+    ((void *)0)
+
+/**
+ * @brief Convenience define for @ref ecu_rbnode_ctor().
+ * Pass this value to @ref ecu_rbnode_ctor() if
+ * a user-defined node destructor is not needed.
+ */
+#define ECU_RBNODE_DESTROY_UNUSED \
+    ((void (*)(struct ecu_rbnode *, ecu_object_id_t))0)
+
+/**
+ * @brief Retrieves user data from an intrusive @ref ecu_rbnode
+ * by converting it back into the user's node type.
+ *
+ * @param ptr_ Pointer to intrusive @ref ecu_rbnode.
+ * This must be pointer to non-const. I.e. (struct ecu_rbnode *).
+ * @param type_ User's node type containing the intrusive
+ * @ref ecu_rbnode. Do not use const specifier. I.e. (struct my_type),
+ * never (const struct my_type).
+ * @param member_ Name of @ref ecu_rbnode member within user's
+ * type.
+ */
+#define ECU_RBNODE_GET_ENTRY(ptr_, type_, member_) \
+    ECU_CONTAINER_OF(ptr_, type_, member_)
+
+/**
+ * @brief Const-qualified version of @ref ECU_RBNODE_GET_ENTRY().
+ * Returned node is read-only.
+ *
+ * @param ptr_ Pointer to intrusive @ref ecu_rbnode. This can be
+ * pointer to const or non-const. I.e. (struct ecu_rbnode *) or
+ * (const struct ecu_rbnode *).
+ * @param type_ User's node type containing the intrusive
+ * @ref ecu_rbnode. Do not use const specifier. I.e. (struct my_type),
+ * never (const struct my_type).
+ * @param member_ Name of @ref ecu_rbnode member within user's
+ * type.
+ */
+#define ECU_RBNODE_GET_CONST_ENTRY(ptr_, type_, member_) \
+    ECU_CONST_CONTAINER_OF(ptr_, type_, member_)
+
+/**
+ * @brief Iterates (for-loops) over tree nodes in sorted order, starting
+ * at the specified position. The specified starting node is included in
+ * the iteration, the iteration terminates after the maximum node is
+ * reached, and it is safe to remove the current node in the iteration.
+ * Commonly used with @ref ecu_rbtree_lower_bound() for range queries.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to @ref ecu_rbnode.
+ * @param iter_ Iterator to initialize. This will be a pointer to @ref ecu_rbtree_iterator.
+ * @param tree_ Tree to iterate over. This will be a pointer to @ref ecu_rbtree.
+ * @param start_ Node in @p tree_ to start iteration at. This will be a pointer
+ * to @ref ecu_rbnode and must be within @p tree_. This node is included in the
+ * iteration.
+ */
+#define ECU_RBTREE_AT_FOR_EACH(var_, iter_, tree_, start_)                        \
+    for (struct ecu_rbnode *var_ = ecu_rbtree_iterator_at(iter_, tree_, start_); \
+         var_ != ecu_rbtree_iterator_end(iter_);                                 \
+         var_ = ecu_rbtree_iterator_next(iter_))
+
+/**
+ * @brief Const-qualified version of @ref ECU_RBTREE_AT_FOR_EACH().
+ * Returned nodes are read-only.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to const @ref ecu_rbnode.
+ * @param citer_ Iterator to initialize. This will be a pointer to @ref ecu_rbtree_citerator.
+ * @param tree_ Tree to iterate over. This will be a pointer to @ref ecu_rbtree.
+ * @param start_ Node in @p tree_ to start iteration at. This will be a pointer
+ * to @ref ecu_rbnode and must be within @p tree_. This node is included in the
+ * iteration.
+ */
+#define ECU_RBTREE_CONST_AT_FOR_EACH(var_, citer_, tree_, start_)                         \
+    for (const struct ecu_rbnode *var_ = ecu_rbtree_iterator_cat(citer_, tree_, start_); \
+         var_ != ecu_rbtree_iterator_cend(citer_);                                       \
+         var_ = ecu_rbtree_iterator_cnext(citer_))
+
+/**
+ * @brief Iterates (for-loops) over all tree nodes in sorted order,
+ * from minimum to maximum. It is safe to remove the current node in
+ * the iteration.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to @ref ecu_rbnode.
+ * @param iter_ Iterator to initialize. This will be a pointer to @ref ecu_rbtree_iterator.
+ * @param tree_ Tree to iterate over. This will be a pointer to @ref ecu_rbtree.
+ * The iteration will immediately exit if this tree is empty.
+ */
+#define ECU_RBTREE_FOR_EACH(var_, iter_, tree_)                              \
+    for (struct ecu_rbnode *var_ = ecu_rbtree_iterator_begin(iter_, tree_); \
+         var_ != ecu_rbtree_iterator_end(iter_);                            \
+         var_ = ecu_rbtree_iterator_next(iter_))
+
+/**
+ * @brief Const-qualified version of @ref ECU_RBTREE_FOR_EACH(). Returned
+ * nodes are read-only.
+ *
+ * @param var_ Loop variable name. This variable will store the current
+ * node in the iteration and will be a pointer to const @ref ecu_rbnode.
+ * @param citer_ Iterator to initialize. This will be a pointer to @ref ecu_rbtree_citerator.
+ * @param tree_ Tree to iterate over. This will be a pointer to @ref ecu_rbtree.
+ * The iteration will immediately exit if this tree is empty.
+ */
+#define ECU_RBTREE_CONST_FOR_EACH(var_, citer_, tree_)                                \
+    for (const struct ecu_rbnode *var_ = ecu_rbtree_iterator_cbegin(citer_, tree_); \
+         var_ != ecu_rbtree_iterator_cend(citer_);                                  \
+         var_ = ecu_rbtree_iterator_cnext(citer_))
+
+/*------------------------------------------------------------*/
+/*-------------------------- RBTREE --------------------------*/
+/*------------------------------------------------------------*/
+
+/* Forward declaration for node's tree pointer. */
+struct ecu_rbtree;
+
+/**
+ * @brief Single node within a red-black tree. Intrusive, so
+ * user-defined types contain this node as a member.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_rbnode
+{
+    /// @brief Parent node. NULL if this is the root. Points
+    /// to itself if the node is not in a tree.
+    struct ecu_rbnode *parent;
+
+    /// @brief Left child. All nodes in this subtree are
+    /// less than or equal to this node. NULL if none.
+    struct ecu_rbnode *left;
+
+    /// @brief Right child. All nodes in this subtree are
+    /// greater than or equal to this node. NULL if none.
+    struct ecu_rbnode *right;
+
+    /// @brief Tree this node is in. NULL if the node is
+    /// not in a tree.
+    struct ecu_rbtree *tree;
+
+    /// @brief Node color. True if red, false if black.
+    bool red;
+
+    /// @brief Optional user-defined node destructor. Executes
+    /// when @ref ecu_rbtree_destroy() or @ref ecu_rbnode_destroy()
+    /// are called.
+    void (*destroy)(struct ecu_rbnode *me, ecu_object_id_t id);
+
+    /// @brief Optional node ID. Helps user identify
+    /// different types stored in the same tree.
+    ecu_object_id_t id;
+};
+
+/**
+ * @brief Intrusive red-black tree. Nodes are kept sorted by a
+ * user-defined condition. Equal nodes are allowed and are
+ * kept in the order they were inserted.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_rbtree
+{
+    /// @brief Root node. NULL if the tree is empty.
+    struct ecu_rbnode *root;
+
+    /// @brief Cached minimum (leftmost) node. NULL if
+    /// the tree is empty.
+    struct ecu_rbnode *min;
+
+    /// @brief Cached maximum (rightmost) node. NULL if
+    /// the tree is empty.
+    struct ecu_rbnode *max;
+
+    /// @brief Number of nodes in the tree.
+    size_t size;
+
+    /// @brief Sorting condition. Returns true if left node
+    /// (lhs) is less than right node (rhs).
+    bool (*lhs_less_than_rhs)(const struct ecu_rbnode *lhs, const struct ecu_rbnode *rhs, void *data);
+
+    /// @brief Optional object passed to @ref lhs_less_than_rhs.
+    void *data;
+};
+
+/*------------------------------------------------------------*/
+/*--------------------- RBTREE ITERATORS ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Non-const tree iterator.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_rbtree_iterator
+{
+    /// @brief Tree that is being iterated.
+    struct ecu_rbtree *tree;
+
+    /// @brief Current position in tree.
+    struct ecu_rbnode *current;
+
+    /// @brief Next position in tree. Allows user to
+    /// safely remove the current node in the middle
+    /// of an iteration.
+    struct ecu_rbnode *next;
+};
+
+/**
+ * @brief Const tree iterator.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_rbtree_citerator
+{
+    /// @brief Tree that is being iterated.
+    const struct ecu_rbtree *tree;
+
+    /// @brief Current position in tree.
+    const struct ecu_rbnode *current;
+
+    /// @brief Next position in tree.
+    const struct ecu_rbnode *next;
+};
+
+/*------------------------------------------------------------*/
+/*------------------ RBNODE MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Rbnode Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @brief Node constructor.
+ *
+ * @warning @p me must not be an active node within a tree, otherwise
+ * behavior is undefined.
+ *
+ * @param me Node to construct. This cannot be NULL.
+ * @param destroy Optional callback. Defines any <b>additional</b> cleanup
+ * needed to fully destroy this user-defined node. Do not use API calls that edit
+ * the ecu_rbnode (node insert, remove, etc) within this callback. Doing so is undefined
+ * behavior. Executes when node is destroyed via @ref ecu_rbnode_destroy(). Also
+ * executes when node is in a tree that is destroyed via @ref ecu_rbtree_destroy().
+ * Supply @ref ECU_RBNODE_DESTROY_UNUSED if unused.
+ * @param id Optional ID to assign to node. Used to identify different user-defined
+ * types stored in the same tree. Supply @ref ECU_OBJECT_ID_UNUSED if unused. This
+ * value must be greater than or equal to @ref ECU_VALID_OBJECT_ID_BEGIN
+ */
+extern void ecu_rbnode_ctor(struct ecu_rbnode *me,
+                            void (*destroy)(struct ecu_rbnode *me, ecu_object_id_t id),
+                            ecu_object_id_t id);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbnode_ctor().
+ * @brief Node destructor.
+ * Removes node if it is in a tree. Executes the user-defined
+ * destructor if one was supplied to @ref ecu_rbnode_ctor(). Node must
+ * be reconstructed via @ref ecu_rbnode_ctor() in order to be used again.
+ *
+ * @warning Memory is not freed since ECU is meant to be used without
+ * dynamic memory allocation. If the supplied node was allocated on the
+ * heap user must free it themselves. It is recommended to do this
+ * inside the user-defined destroy callback passed to @ref ecu_rbnode_ctor().
+ *
+ * @param me Node to destroy.
+ */
+extern void ecu_rbnode_destroy(struct ecu_rbnode *me);
+/**@}*/
+
+/**
+ * @name Rbnode Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbnode_ctor().
+ * @brief Returns node ID. Used to identity different user-defined types
+ * stored in the same tree.
+ *
+ * @param me Node to check.
+ */
+extern ecu_object_id_t ecu_rbnode_id(const struct ecu_rbnode *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbnode_ctor().
+ * @brief Returns true if the node is in a tree. False otherwise.
+ *
+ * @param me Node to check.
+ */
+extern bool ecu_rbnode_in_tree(const struct ecu_rbnode *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbnode_ctor().
+ * @brief Returns the node that follows @p me in sorted order. NULL is
+ * returned if @p me is the maximum node or if @p me is not in a tree.
+ * O(log n) worst case, O(1) amortized over a full traversal.
+ *
+ * @param me Node to check.
+ */
+extern struct ecu_rbnode *ecu_rbnode_next(struct ecu_rbnode *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbnode_ctor().
+ * @brief Const-qualified version of @ref ecu_rbnode_next(). Returned
+ * node is read-only.
+ *
+ * @param me Node to check.
+ */
+extern const struct ecu_rbnode *ecu_rbnode_cnext(const struct ecu_rbnode *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbnode_ctor().
+ * @brief Returns the node that precedes @p me in sorted order. NULL is
+ * returned if @p me is the minimum node or if @p me is not in a tree.
+ *
+ * @param me Node to check.
+ */
+extern struct ecu_rbnode *ecu_rbnode_prev(struct ecu_rbnode *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbnode_ctor().
+ * @brief Const-qualified version of @ref ecu_rbnode_prev(). Returned
+ * node is read-only.
+ *
+ * @param me Node to check.
+ */
+extern const struct ecu_rbnode *ecu_rbnode_cprev(const struct ecu_rbnode *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbnode_ctor().
+ * @brief Removes the node from its tree in O(log n). It can be reused
+ * and added to another tree without reconstruction. If the supplied node
+ * is not in a tree, this function does nothing.
+ *
+ * @param me Node to remove.
+ */
+extern void ecu_rbnode_remove(struct ecu_rbnode *me);
+
+/**
+ * @brief Returns true if the supplied node has been constructed
+ * via @ref ecu_rbnode_ctor(). False otherwise.
+ *
+ * @param me Node to check.
+ */
+extern bool ecu_rbnode_valid(const struct ecu_rbnode *me);
+/**@}*/
+
+/*------------------------------------------------------------*/
+/*------------------ RBTREE MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name RBTree Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @brief Tree constructor.
+ *
+ * @warning @p me must not be an active tree, otherwise
+ * behavior is undefined.
+ *
+ * @param me Tree to construct. This cannot be NULL.
+ * @param lhs_less_than_rhs Mandatory function that defines sorting condition.
+ * Return true if left node (lhs) is less than right node (rhs). Otherwise return
+ * false. Must be a strict weak ordering. I.e. lhs < rhs and rhs < lhs can never
+ * both be true.
+ * @param data Optional object to pass to @p lhs_less_than_rhs. Supply
+ * @ref ECU_RBNODE_OBJ_UNUSED if unused.
+ */
+extern void ecu_rbtree_ctor(struct ecu_rbtree *me,
+                            bool (*lhs_less_than_rhs)(const struct ecu_rbnode *lhs, const struct ecu_rbnode *rhs, void *data),
+                            void *data);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Tree destructor.
+ * Destroys the tree and all nodes within the tree. All destroyed objects
+ * must be reconstructed in order to be used again. The user-supplied
+ * destroy callback for each node executes as they are destroyed.
+ *
+ * @warning Memory is not freed since ECU is meant to be used without
+ * dynamic memory allocation. If the supplied tree or any nodes within the
+ * tree were allocated on the heap, user must free it themselves. It is
+ * recommended to free the nodes inside the destroy callbacks passed to
+ * @ref ecu_rbnode_ctor(). The tree must be freed elsewhere.
+ *
+ * @param me Tree to destroy.
+ */
+extern void ecu_rbtree_destroy(struct ecu_rbtree *me);
+/**@}*/
+
+/**
+ * @name RBTree Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Removes all nodes from the tree in O(n). Tree and nodes can be
+ * reused without reconstruction.
+ *
+ * @param me Tree to clear.
+ */
+extern void ecu_rbtree_clear(struct ecu_rbtree *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Returns true if the tree is empty. False otherwise.
+ *
+ * @param me Tree to check.
+ */
+extern bool ecu_rbtree_empty(const struct ecu_rbtree *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Returns the first node in sorted order that is equal to @p key
+ * in O(log n). Returns NULL if no node is equal. A node is equal if it is
+ * neither less than nor greater than @p key.
+ *
+ * @param me Tree to search.
+ * @param key Node compared against tree nodes with the tree's sorting
+ * condition. Usually a temporary user-defined node that only has its
+ * key members set. It does not have to be constructed or in a tree.
+ */
+extern struct ecu_rbnode *ecu_rbtree_find(struct ecu_rbtree *me, const struct ecu_rbnode *key);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Const-qualified version of @ref ecu_rbtree_find(). Returned
+ * node is read-only.
+ *
+ * @param me Tree to search.
+ * @param key Node compared against tree nodes. See @ref ecu_rbtree_find().
+ */
+extern const struct ecu_rbnode *ecu_rbtree_cfind(const struct ecu_rbtree *me, const struct ecu_rbnode *key);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @pre @p node previously constructed via call to @ref ecu_rbnode_ctor().
+ * @brief Inserts a node at its sorted position in O(log n). The node is
+ * placed after all nodes that are equal to it.
+ *
+ * @param me Tree to add to.
+ * @param node Node to add. This cannot already be within a tree.
+ */
+extern void ecu_rbtree_insert(struct ecu_rbtree *me, struct ecu_rbnode *node);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Returns the first node in sorted order that is not less than
+ * @p key in O(log n). Returns NULL if all nodes are less than @p key.
+ *
+ * @param me Tree to search.
+ * @param key Node compared against tree nodes. See @ref ecu_rbtree_find().
+ */
+extern struct ecu_rbnode *ecu_rbtree_lower_bound(struct ecu_rbtree *me, const struct ecu_rbnode *key);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Const-qualified version of @ref ecu_rbtree_lower_bound(). Returned
+ * node is read-only.
+ *
+ * @param me Tree to search.
+ * @param key Node compared against tree nodes. See @ref ecu_rbtree_find().
+ */
+extern const struct ecu_rbnode *ecu_rbtree_clower_bound(const struct ecu_rbtree *me, const struct ecu_rbnode *key);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Returns the maximum node in O(1). Returns NULL if the tree is
+ * empty.
+ *
+ * @param me Tree to check.
+ */
+extern struct ecu_rbnode *ecu_rbtree_max(struct ecu_rbtree *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Const-qualified version of @ref ecu_rbtree_max(). Returned
+ * node is read-only.
+ *
+ * @param me Tree to check.
+ */
+extern const struct ecu_rbnode *ecu_rbtree_cmax(const struct ecu_rbtree *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Returns the minimum node in O(1). Returns NULL if the tree is
+ * empty.
+ *
+ * @param me Tree to check.
+ */
+extern struct ecu_rbnode *ecu_rbtree_min(struct ecu_rbtree *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Const-qualified version of @ref ecu_rbtree_min(). Returned
+ * node is read-only.
+ *
+ * @param me Tree to check.
+ */
+extern const struct ecu_rbnode *ecu_rbtree_cmin(const struct ecu_rbtree *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Removes and returns the minimum node in O(log n). Returns NULL
+ * if the tree is empty.
+ *
+ * @param me Tree to remove from.
+ */
+extern struct ecu_rbnode *ecu_rbtree_pop_min(struct ecu_rbtree *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Returns the number of nodes in the tree in O(1).
+ *
+ * @param me Tree to check.
+ */
+extern size_t ecu_rbtree_size(const struct ecu_rbtree *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Returns the first node in sorted order that is greater than
+ * @p key in O(log n). Returns NULL if no nodes are greater than @p key.
+ *
+ * @param me Tree to search.
+ * @param key Node compared against tree nodes. See @ref ecu_rbtree_find().
+ */
+extern struct ecu_rbnode *ecu_rbtree_upper_bound(struct ecu_rbtree *me, const struct ecu_rbnode *key);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Const-qualified version of @ref ecu_rbtree_upper_bound(). Returned
+ * node is read-only.
+ *
+ * @param me Tree to search.
+ * @param key Node compared against tree nodes. See @ref ecu_rbtree_find().
+ */
+extern const struct ecu_rbnode *ecu_rbtree_cupper_bound(const struct ecu_rbtree *me, const struct ecu_rbnode *key);
+
+/**
+ * @brief Returns true if the supplied tree has been constructed
+ * via @ref ecu_rbtree_ctor(). False otherwise.
+ *
+ * @param me Tree to check.
+ */
+extern bool ecu_rbtree_valid(const struct ecu_rbtree *me);
+/**@}*/
+
+/*------------------------------------------------------------*/
+/*----------- NON-CONST ITERATOR MEMBER FUNCTIONS ------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Iterators
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me
+ * @pre @p tree previously constructed via call to @ref ecu_rbtree_ctor().
+ * @pre @p start node is in @p tree.
+ * @brief Initializes iterator at the supplied starting node's position.
+ * The supplied starting node is returned.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_RBTREE_AT_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const iterator to initialize.
+ * @param tree Tree to iterate over.
+ * @param start Starting position of the iteration. This node must be
+ * within @p tree.
+ */
+extern struct ecu_rbnode *ecu_rbtree_iterator_at(struct ecu_rbtree_iterator *me,
+                                                 struct ecu_rbtree *tree,
+                                                 struct ecu_rbnode *start);
+
+/**
+ * @pre Memory already allocated for @p me
+ * @pre @p tree previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Initializes iterator and returns the minimum node. Returns
+ * the same terminal value as @ref ecu_rbtree_iterator_end() if the
+ * tree is empty.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_RBTREE_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const iterator to initialize.
+ * @param tree Tree to iterate over.
+ */
+extern struct ecu_rbnode *ecu_rbtree_iterator_begin(struct ecu_rbtree_iterator *me, struct ecu_rbtree *tree);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_rbtree_iterator_begin().
+ * @brief Returns the iteration's terminal value, which is NULL.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_RBTREE_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const iterator.
+ */
+extern struct ecu_rbnode *ecu_rbtree_iterator_end(struct ecu_rbtree_iterator *me);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_rbtree_iterator_begin().
+ * @brief Returns the next node in the iteration.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_RBTREE_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const iterator.
+ */
+extern struct ecu_rbnode *ecu_rbtree_iterator_next(struct ecu_rbtree_iterator *me);
+
+/*------------------------------------------------------------*/
+/*------------- CONST ITERATOR MEMBER FUNCTIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @pre Memory already allocated for @p me
+ * @pre @p tree previously constructed via call to @ref ecu_rbtree_ctor().
+ * @pre @p start node is in @p tree.
+ * @brief Const-qualified version of @ref ecu_rbtree_iterator_at().
+ * Returned node is read-only.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_RBTREE_CONST_AT_FOR_EACH()
+ * instead.
+ *
+ * @param me Const iterator to initialize.
+ * @param tree Tree to iterate over.
+ * @param start Starting position of the iteration. This node must be
+ * within @p tree.
+ */
+extern const struct ecu_rbnode *ecu_rbtree_iterator_cat(struct ecu_rbtree_citerator *me,
+                                                        const struct ecu_rbtree *tree,
+                                                        const struct ecu_rbnode *start);
+
+/**
+ * @pre Memory already allocated for @p me
+ * @pre @p tree previously constructed via call to @ref ecu_rbtree_ctor().
+ * @brief Const-qualified version of @ref ecu_rbtree_iterator_begin().
+ * Returned node is read-only.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_RBTREE_CONST_FOR_EACH()
+ * instead.
+ *
+ * @param me Const iterator to initialize.
+ * @param tree Tree to iterate over.
+ */
+extern const struct ecu_rbnode *ecu_rbtree_iterator_cbegin(struct ecu_rbtree_citerator *me,
+                                                           const struct ecu_rbtree *tree);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_rbtree_iterator_cbegin().
+ * @brief Const-qualified version of @ref ecu_rbtree_iterator_end().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_RBTREE_CONST_FOR_EACH()
+ * instead.
+ *
+ * @param me Const iterator.
+ */
+extern const struct ecu_rbnode *ecu_rbtree_iterator_cend(struct ecu_rbtree_citerator *me);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_rbtree_iterator_cbegin().
+ * @brief Const-qualified version of @ref ecu_rbtree_iterator_next().
+ * Returned node is read-only.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_RBTREE_CONST_FOR_EACH()
+ * instead.
+ *
+ * @param me Const iterator.
+ */
+extern const struct ecu_rbnode *ecu_rbtree_iterator_cnext(struct ecu_rbtree_citerator *me);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_RBTREE_H_ */
@@ -0,0 +1,320 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`sched.h section <sched_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @warning @ref ecu_sched is not thread-safe. Posting from ISRs or
+ * other threads requires the user to serialize access.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_SCHED_H_
+#define ECU_SCHED_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ECU. */
+#include "ecu/ao.h"
+#include "ecu/event.h"
+#include "ecu/timer.h"
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+#ifndef ECU_SCHED_PRIORITIES
+/**
+ * @brief Number of priority levels in every @ref ecu_sched. Each
+ * level runs at most one active object. Defaults to 64. Override it
+ * with a compiler flag (i.e. -DECU_SCHED_PRIORITIES=16) so every
+ * translation unit sees the same value. Must be between 1 and 1024.
+ */
+#define ECU_SCHED_PRIORITIES \
+    ((size_t)64)
+#endif
+
+/**
+ * @brief Number of 32-bit words in the ready bitmap of an
+ * @ref ecu_sched.
+ */
+#define ECU_SCHED_GROUPS \
+    ((ECU_SCHED_PRIORITIES + 31U) / 32U)
+
+/**
+ * @brief Convenience define for @ref ecu_sched_ctor(). Pass
+ * this value if the idle hook is unused.
+ */
+#define ECU_SCHED_IDLE_UNUSED \
+    ((void (*)(struct ecu_sched *, ecu_tick_t, void *))0)
+
+/**
+ * @brief Convenience define for @ref ecu_sched_ctor(). Pass
+ * this value if the idle hook's object is unused.
+ */
+#define ECU_SCHED_OBJ_UNUSED \
+    ((void *)0)
+
+/*------------------------------------------------------------*/
+/*-------------------------- SCHED ---------------------------*/
+/*------------------------------------------------------------*/
+
+/* Forward declaration for ecu_sched_level. */
+struct ecu_sched;
+
+/**
+ * @brief One priority level of an @ref ecu_sched.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_sched_level
+{
+    /// @brief Active object at this level. NULL if unused.
+    struct ecu_ao *ao;
+
+    /// @brief Scheduler this level belongs to. Lets the active
+    /// object's post hook find the ready bitmap.
+    struct ecu_sched *sched;
+};
+
+/**
+ * @brief Cooperative run-to-completion scheduler. Runs one active
+ * object per priority level. A bitmap tracks which levels have
+ * queued events so the highest ready level is found in O(1).
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_sched
+{
+    /// @brief Priority levels. Higher index is higher priority.
+    struct ecu_sched_level levels[ECU_SCHED_PRIORITIES];
+
+    /// @brief Bit n of word g is set if level (g * 32) + n
+    /// has queued events.
+    uint32_t ready[ECU_SCHED_GROUPS];
+
+    /// @brief Bit g is set if word g of @ref ecu_sched.ready
+    /// is non-zero.
+    uint32_t groups;
+
+    /// @brief Time events armed through this scheduler.
+    struct ecu_tlist timers;
+
+    /// @brief Optional function called when no events are ready.
+    void (*idle)(struct ecu_sched *me, ecu_tick_t timeout, void *obj);
+
+    /// @brief Optional object passed to @ref ecu_sched.idle.
+    void *idle_obj;
+};
+
+/**
+ * @brief Time event. Posts an event to an active object every
+ * time it expires.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_sched_timer
+{
+    /// @brief Timer in @ref ecu_sched.timers.
+    struct ecu_timer timer;
+
+    /// @brief Active object the event is posted to.
+    struct ecu_ao *ao;
+
+    /// @brief Event posted on expiry. Copied by the active
+    /// object so it can be shared by many time events.
+    const struct ecu_event *event;
+};
+
+/*------------------------------------------------------------*/
+/*------------------- SCHED MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Sched Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @brief Scheduler constructor. Every priority level starts out
+ * empty and no time events are armed.
+ *
+ * @param me Scheduler to construct.
+ * @param idle Optional function called by @ref ecu_sched_run_until_idle()
+ * once no events are ready. Receives the number of ticks until the next
+ * time event expires, or @ref ECU_TICK_MAX if none are armed, so the
+ * target can sleep without a periodic tick. Supply
+ * @ref ECU_SCHED_IDLE_UNUSED if unused.
+ * @param obj Optional object passed to @p idle. Supply
+ * @ref ECU_SCHED_OBJ_UNUSED if unused.
+ */
+extern void ecu_sched_ctor(struct ecu_sched *me,
+                           void (*idle)(struct ecu_sched *me, ecu_tick_t timeout, void *obj),
+                           void *obj);
+/**@}*/
+
+/**
+ * @name Sched Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me constructed via @ref ecu_sched_ctor().
+ * @pre @p ao constructed via @ref ecu_ao_fsm_ctor() or @ref ecu_ao_hsm_ctor().
+ * @brief Runs @p ao at the given priority level. Installs the
+ * active object's post hook, so events posted to it with
+ * @ref ecu_ao_post() mark it ready. Events already queued are kept.
+ *
+ * @param me Scheduler to add to.
+ * @param ao Active object to run. Cannot be in another scheduler.
+ * @param priority Level to run @p ao at. Must be less than
+ * @ref ECU_SCHED_PRIORITIES and not used by another active object.
+ * Higher values run first.
+ */
+extern void ecu_sched_add(struct ecu_sched *me, struct ecu_ao *ao, size_t priority);
+
+/**
+ * @pre @p me constructed via @ref ecu_sched_ctor().
+ * @brief Returns true if any active object has queued events.
+ * False otherwise. Idle hooks should check this with interrupts
+ * disabled before sleeping.
+ *
+ * @param me Scheduler to check.
+ */
+extern bool ecu_sched_ready(const struct ecu_sched *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_sched_ctor() and
+ * started via @ref ecu_sched_start().
+ * @brief Dispatches one event to the highest-priority active
+ * object that has queued events. Returns false if none do. O(1)
+ * apart from the dispatch itself.
+ *
+ * @param me Scheduler to run.
+ */
+extern bool ecu_sched_run_once(struct ecu_sched *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_sched_ctor() and
+ * started via @ref ecu_sched_start().
+ * @brief Dispatches events one at a time, always from the
+ * highest-priority ready active object, until none are ready.
+ * Then calls the idle hook once. Returns the number of events
+ * dispatched. Usually called forever from the main loop.
+ *
+ * @param me Scheduler to run.
+ */
+extern size_t ecu_sched_run_until_idle(struct ecu_sched *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_sched_ctor().
+ * @brief Starts the state machine of every added active object,
+ * highest priority first.
+ *
+ * @warning This function should only be called once on
+ * startup and must run to completion.
+ *
+ * @param me Scheduler to start.
+ */
+extern void ecu_sched_start(struct ecu_sched *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_sched_ctor().
+ * @brief Advances time. Expired time events post their events,
+ * which makes the receiving active objects ready. Same rules as
+ * @ref ecu_tlist_service(). If a post fails because the queue is
+ * full, it is retried on the next tick.
+ *
+ * @param me Scheduler to advance.
+ * @param elapsed Number of ticks since the last call.
+ */
+extern void ecu_sched_tick(struct ecu_sched *me, ecu_tick_t elapsed);
+/**@}*/
+
+/*------------------------------------------------------------*/
+/*---------------- SCHED TIMER MEMBER FUNCTIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Sched Timer Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @brief Time event constructor. The time event is disarmed.
+ *
+ * @warning @p me must not be an armed time event, otherwise
+ * behavior is undefined.
+ *
+ * @param me Time event to construct.
+ * @param ao Active object the event is posted to.
+ * @param event Event posted every time @p me expires. Must stay
+ * valid while @p me is armed. Same requirements as @ref ecu_ao_post().
+ */
+extern void ecu_sched_timer_ctor(struct ecu_sched_timer *me,
+                                 struct ecu_ao *ao,
+                                 const struct ecu_event *event);
+/**@}*/
+
+/**
+ * @name Sched Timer Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me constructed via @ref ecu_sched_timer_ctor().
+ * @brief Returns true if the time event is armed. False otherwise.
+ *
+ * @param me Time event to check.
+ */
+extern bool ecu_sched_timer_active(const struct ecu_sched_timer *me);
+
+/**
+ * @pre @p sched constructed via @ref ecu_sched_ctor().
+ * @pre @p me constructed via @ref ecu_sched_timer_ctor().
+ * @brief Arms the time event. Restarts it with the new settings
+ * if it was already armed. Can be called from state handlers.
+ *
+ * @param sched Scheduler whose ticks drive the time event.
+ * @param me Time event to arm.
+ * @param period Ticks until expiry. Must be between 1 and
+ * @ref ECU_TICK_MAX.
+ * @param type One-shot or periodic.
+ */
+extern void ecu_sched_timer_arm(struct ecu_sched *sched,
+                                struct ecu_sched_timer *me,
+                                ecu_tick_t period,
+                                enum ecu_timer_type_e type);
+
+/**
+ * @pre @p me constructed via @ref ecu_sched_timer_ctor().
+ * @brief Disarms the time event. Events it already posted
+ * stay queued. Can be called on a disarmed time event.
+ *
+ * @param me Time event to disarm.
+ */
+extern void ecu_sched_timer_disarm(struct ecu_sched_timer *me);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_SCHED_H_ */
@@ -0,0 +1,357 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`tfsm.h section <tfsm_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_TFSM_H_
+#define ECU_TFSM_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stddef.h>
+#include <stdint.h>
+
+/* ECU. */
+#include "ecu/asserter.h"
+#include "ecu/utils.h"
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Converts intrusive @ref ecu_tfsm member into the
+ * user's fsm type. This should be used inside entry, exit,
+ * and action handlers.
+ *
+ * @param ecu_tfsm_ptr_ Pointer to intrusive @ref ecu_tfsm.
+ * This must be pointer to non-const. I.e. (struct ecu_tfsm *).
+ * @param type_ User's fsm type containing the intrusive
+ * @ref ecu_tfsm member. Do not use const specifier. I.e.
+ * (struct my_type), never (const struct my_type).
+ * @param member_ Name of @ref ecu_tfsm member within user's
+ * type.
+ */
+#define ECU_TFSM_GET_CONTEXT(ecu_tfsm_ptr_, type_, member_) \
+    ECU_CONTAINER_OF(ecu_tfsm_ptr_, type_, member_)
+
+/**
+ * @brief Helper macro supplied to a table row if the
+ * state's entry handler is unused.
+ */
+#define ECU_TFSM_ENTRY_UNUSED \
+    ((void (*)(struct ecu_tfsm *))0)
+
+/**
+ * @brief Helper macro supplied to a table row if the
+ * state's exit handler is unused.
+ */
+#define ECU_TFSM_EXIT_UNUSED \
+    ((void (*)(struct ecu_tfsm *))0)
+
+/**
+ * @brief Helper macro supplied to @ref ECU_TFSM_TRANSITION()
+ * if the transition has no action.
+ */
+#define ECU_TFSM_ACTION_UNUSED \
+    ((void (*)(struct ecu_tfsm *, const void *))0)
+
+/**
+ * @brief Target of a cell that does not transition.
+ */
+#define ECU_TFSM_NO_TRANSITION \
+    ((ecu_tfsm_state_t)UINT16_MAX)
+
+/**
+ * @brief Table cell. Event is ignored in this state.
+ */
+#define ECU_TFSM_IGNORE \
+    { ECU_TFSM_ACTION_UNUSED, ECU_TFSM_NO_TRANSITION }
+
+/**
+ * @brief Table cell. Runs @p action_ without leaving the state
+ * (internal transition). @p action_ may still transition via
+ * @ref ecu_tfsm_change_state(), which is how guards are written.
+ *
+ * @param action_ Function of type (void (*)(struct ecu_tfsm *, const void *)).
+ */
+#define ECU_TFSM_ACTION(action_) \
+    { (action_), ECU_TFSM_NO_TRANSITION }
+
+/**
+ * @brief Table cell. Runs @p action_ and then transitions to
+ * @p target_. Exit and entry handlers run exactly like they do
+ * for @ref ecu_fsm_change_state(). If @p target_ is the current
+ * state a self-transition occurs.
+ *
+ * @param action_ Optional function of type
+ * (void (*)(struct ecu_tfsm *, const void *)). Supply
+ * @ref ECU_TFSM_ACTION_UNUSED if unused.
+ * @param target_ State to transition to. Name of another row.
+ */
+#define ECU_TFSM_TRANSITION(action_, target_) \
+    { (action_), (ecu_tfsm_state_t)(target_) }
+
+/**
+ * @brief X-macro callback that expands a table row into its state
+ * name followed by a comma. Used to declare the user's state enum
+ * from the same table, so states are numbered in row order:
+ * @code{.c}
+ * enum light_state
+ * {
+ *     LIGHT_TABLE(ECU_TFSM_X_STATE_ID)
+ *     LIGHT_STATE_COUNT
+ * };
+ * @endcode
+ */
+#define ECU_TFSM_X_STATE_ID(state_, entry_, exit_, ...) \
+    state_,
+
+/**
+ * @brief X-macro callback that expands a table row into its
+ * @ref ecu_tfsm_state initializer. Used by @ref ECU_TFSM_TABLE_DEFINE().
+ */
+#define ECU_TFSM_X_STATE(state_, entry_, exit_, ...) \
+    { (entry_), (exit_) },
+
+/**
+ * @brief X-macro callback that expands a table row into its cells.
+ * Used by @ref ECU_TFSM_TABLE_DEFINE(). Rows are laid out back to back
+ * so the cells of all rows form one row-major array.
+ */
+#define ECU_TFSM_X_CELLS(state_, entry_, exit_, ...) \
+    __VA_ARGS__,
+
+/**
+ * @brief Defines a constant @ref ecu_tfsm_table named @p name_
+ * from an X-macro table. Everything is const so the table is
+ * placed in flash. Example usage:
+ * @code{.c}
+ * enum light_event { PRESS, TIMEOUT, LIGHT_EVENT_COUNT };
+ *
+ * //      State      Entry                  Exit                  PRESS                                     TIMEOUT
+ * #define LIGHT_TABLE(X) \
+ *     X(LIGHT_OFF,   ECU_TFSM_ENTRY_UNUSED, ECU_TFSM_EXIT_UNUSED, ECU_TFSM_TRANSITION(&turn_on, LIGHT_ON),  ECU_TFSM_IGNORE) \
+ *     X(LIGHT_ON,    &start_timer,          &stop_timer,          ECU_TFSM_TRANSITION(&turn_off, LIGHT_OFF), ECU_TFSM_TRANSITION(&turn_off, LIGHT_OFF))
+ *
+ * enum light_state { LIGHT_TABLE(ECU_TFSM_X_STATE_ID) LIGHT_STATE_COUNT };
+ * ECU_TFSM_TABLE_DEFINE(LIGHT, LIGHT_TABLE, LIGHT_EVENT_COUNT);
+ * @endcode
+ *
+ * @warning Every row must have exactly @p event_count_ cells. This
+ * is checked at compile-time when static asserts are available.
+ *
+ * @param name_ Name of the @ref ecu_tfsm_table variable to define.
+ * @param table_ X-macro table. Each row is
+ * X(state, entry, exit, cell for event 0, cell for event 1, ...).
+ * @param event_count_ Number of events, which is the number of
+ * columns after entry and exit.
+ */
+#define ECU_TFSM_TABLE_DEFINE(name_, table_, event_count_)                                       \
+    static const struct ecu_tfsm_state name_##_tfsm_states_[] = { table_(ECU_TFSM_X_STATE) };   \
+    static const struct ecu_tfsm_cell name_##_tfsm_cells_[] = { table_(ECU_TFSM_X_CELLS) };     \
+    ECU_STATIC_ASSERT( ((sizeof(name_##_tfsm_cells_) / sizeof(struct ecu_tfsm_cell)) ==          \
+                        ((sizeof(name_##_tfsm_states_) / sizeof(struct ecu_tfsm_state)) * (size_t)(event_count_))), \
+                       "Every row of " #name_ " must have one cell per event." );               \
+    static const struct ecu_tfsm_table name_ = {                                                 \
+        &name_##_tfsm_states_[0],                                                                \
+        &name_##_tfsm_cells_[0],                                                                 \
+        (ecu_tfsm_state_t)(sizeof(name_##_tfsm_states_) / sizeof(struct ecu_tfsm_state)),      \
+        (size_t)(event_count_)                                                                   \
+    }
+
+/*------------------------------------------------------------*/
+/*--------------------------- TFSM ---------------------------*/
+/*------------------------------------------------------------*/
+
+/* Forward declaration for ecu_tfsm_state and ecu_tfsm_cell. */
+struct ecu_tfsm;
+
+/**
+ * @brief Index of a state in an @ref ecu_tfsm_table. Equals
+ * the state's row in the table.
+ */
+typedef uint16_t ecu_tfsm_state_t;
+
+/**
+ * @brief Entry and exit handlers of a single state. Created
+ * by @ref ECU_TFSM_TABLE_DEFINE().
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_tfsm_state
+{
+    /// @brief Executes when state first entered. Optional.
+    void (*entry)(struct ecu_tfsm *me);
+
+    /// @brief Executes when state exits. Optional.
+    void (*exit)(struct ecu_tfsm *me);
+};
+
+/**
+ * @brief What a state does with an event. Created by
+ * @ref ECU_TFSM_IGNORE, @ref ECU_TFSM_ACTION(), or
+ * @ref ECU_TFSM_TRANSITION().
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_tfsm_cell
+{
+    /// @brief Executes when the event is dispatched. Optional.
+    void (*action)(struct ecu_tfsm *me, const void *data);
+
+    /// @brief State to transition to after the action. Equals
+    /// @ref ECU_TFSM_NO_TRANSITION if none.
+    ecu_tfsm_state_t target;
+};
+
+/**
+ * @brief Constant state x event table. Created by
+ * @ref ECU_TFSM_TABLE_DEFINE().
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_tfsm_table
+{
+    /// @brief Entry and exit handlers. One per state.
+    const struct ecu_tfsm_state *states;
+
+    /// @brief Row-major cells. Cell of a state and event is at
+    /// (state * @ref ecu_tfsm_table.event_count) + event.
+    const struct ecu_tfsm_cell *cells;
+
+    /// @brief Number of states (rows).
+    ecu_tfsm_state_t state_count;
+
+    /// @brief Number of events (columns).
+    size_t event_count;
+};
+
+/**
+ * @brief Table-driven finite state machine. Users create their
+ * own FSMs by containing this as an intrusive member. Any number
+ * of machines can share one table.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_tfsm
+{
+    /// @brief Transition table.
+    const struct ecu_tfsm_table *table;
+
+    /// @brief Current state.
+    ecu_tfsm_state_t state;
+
+    /// @brief Bitmap representing fsm's state transition context.
+    uint8_t transition;
+};
+
+/*------------------------------------------------------------*/
+/*------------------- TFSM MEMBER FUNCTIONS ------------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Tfsm Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @pre @p table defined via @ref ECU_TFSM_TABLE_DEFINE().
+ * @brief Table-driven fsm constructor.
+ *
+ * @warning Supplied fsm cannot be active, otherwise behavior
+ * is undefined.
+ *
+ * @param me Fsm to construct.
+ * @param table Transition table. Must stay valid for the
+ * lifetime of the fsm.
+ * @param state Fsm's initial state.
+ */
+extern void ecu_tfsm_ctor(struct ecu_tfsm *me,
+                          const struct ecu_tfsm_table *table,
+                          ecu_tfsm_state_t state);
+/**@}*/
+
+/**
+ * @name Tfsm Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me constructed via @ref ecu_tfsm_ctor().
+ * @brief Transitions fsm into a new state. Only needed for
+ * transitions that are decided at run-time. I.e. guards inside
+ * an @ref ECU_TFSM_ACTION() cell, or an entry handler that
+ * immediately moves on. Same rules as @ref ecu_fsm_change_state().
+ *
+ * @warning This must only be called within an action of a cell
+ * without a target, or an entry handler. Self-transitions are
+ * not allowed in entry handlers.
+ *
+ * @param me Fsm to transition.
+ * @param state State to transition into. If fsm's current state == @p state
+ * then a self-transition will occur. I.e. @p state::exit then @p state::entry.
+ */
+extern void ecu_tfsm_change_state(struct ecu_tfsm *me, ecu_tfsm_state_t state);
+
+/**
+ * @pre @p me constructed via @ref ecu_tfsm_ctor().
+ * @brief Looks up the cell of the current state and @p event in
+ * O(1), runs its action, and then performs its transition. Entry
+ * and exit handlers, including transitions signalled from entry
+ * handlers, are processed exactly like @ref ecu_fsm_dispatch().
+ *
+ * @warning This function must run to completion.
+ *
+ * @param me Fsm to run.
+ * @param event Column of the table. Must be less than the
+ * table's event count.
+ * @param data Optional event data passed to the action. Can be NULL.
+ */
+extern void ecu_tfsm_dispatch(struct ecu_tfsm *me, size_t event, const void *data);
+
+/**
+ * @pre @p me constructed via @ref ecu_tfsm_ctor().
+ * @brief Runs the initial state's entry handler and processes
+ * any transitions it signals. Same as @ref ecu_fsm_start().
+ *
+ * @warning This function should only be called once on
+ * startup and must run to completion.
+ *
+ * @param me Fsm to start. This should not be an already
+ * running fsm.
+ */
+extern void ecu_tfsm_start(struct ecu_tfsm *me);
+
+/**
+ * @pre @p me constructed via @ref ecu_tfsm_ctor().
+ * @brief Returns the current state.
+ *
+ * @param me Fsm to check.
+ */
+extern ecu_tfsm_state_t ecu_tfsm_current_state(const struct ecu_tfsm *me);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_TFSM_H_ */
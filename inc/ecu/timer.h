@@ -252,6 +252,18 @@ extern void ecu_tlist_ctor(struct ecu_tlist *me);
  * @name Tlist Member Functions
  */
 /**@{*/
+/**
+ * @pre @p me previously constructed via @ref ecu_tlist_ctor().
+ * @brief Returns the number of ticks until the next timer in the
+ * list expires. Returns 0 if a timer is already due, including one
+ * whose callback returned false and is retried on the next service.
+ * Returns @ref ECU_TICK_MAX if the list has no timers. Used to sleep
+ * until the next timeout instead of servicing the list every tick.
+ *
+ * @param me List to check.
+ */
+extern ecu_tick_t ecu_tlist_next_timeout(const struct ecu_tlist *me);
+
 /**
  * @pre @p me previously constructed via @ref ecu_tlist_ctor().
  * @brief Services all software timers (@ref ecu_timer) currently in the
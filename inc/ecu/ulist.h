@@ -0,0 +1,550 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ulist.h section <ulist_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef ECU_ULIST_H_
+#define ECU_ULIST_H_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Blocks are chained in a dlist. */
+#include "ecu/dlist.h"
+
+/*------------------------------------------------------------*/
+/*---------------------- DEFINES AND MACROS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Convenience define for @ref ecu_ulist_ctor() and
+ * @ref ecu_ulist_insert(). Pass to these functions if optional
+ * callback object is not needed.
+ */
+#define ECU_ULIST_OBJ_UNUSED \
+    ((void *)0)
+
+/**
+ * @brief Size of @ref ecu_ulist_block rounded up so the elements
+ * stored after it are suitably aligned for any type.
+ */
+#define ECU_ULIST_BLOCK_HEADER_SIZE                                                     \
+    (((sizeof(struct ecu_ulist_block) + sizeof(union ecu_ulist_max_align) - 1U) /       \
+      sizeof(union ecu_ulist_max_align)) * sizeof(union ecu_ulist_max_align))
+
+/**
+ * @brief Number of @ref ecu_ulist_max_align units required to
+ * store one block. Use this to define static block storage:
+ * @code{.c}
+ * static union ecu_ulist_max_align pool[8][ECU_ULIST_BLOCK_UNITS(sizeof(int), 16)];
+ * @endcode
+ *
+ * @param elem_size_ Size of one element in bytes. Same value
+ * passed to @ref ecu_ulist_ctor().
+ * @param capacity_ Number of elements stored per block. Same
+ * value passed to @ref ecu_ulist_ctor().
+ */
+#define ECU_ULIST_BLOCK_UNITS(elem_size_, capacity_)                                    \
+    ((ECU_ULIST_BLOCK_HEADER_SIZE + ((elem_size_) * (capacity_)) +                      \
+      sizeof(union ecu_ulist_max_align) - 1U) / sizeof(union ecu_ulist_max_align))
+
+/**
+ * @brief Size of one block in bytes. Memory returned by the
+ * block allocator supplied to @ref ecu_ulist_ctor() must be at
+ * least this large.
+ *
+ * @param elem_size_ Size of one element in bytes. Same value
+ * passed to @ref ecu_ulist_ctor().
+ * @param capacity_ Number of elements stored per block. Same
+ * value passed to @ref ecu_ulist_ctor().
+ */
+#define ECU_ULIST_BLOCK_SIZE(elem_size_, capacity_) \
+    (ECU_ULIST_BLOCK_UNITS(elem_size_, capacity_) * sizeof(union ecu_ulist_max_align))
+
+/**
+ * @brief Iterates over all elements in the list from front to back.
+ * It is safe to remove the current element in the iteration via
+ * @ref ecu_ulist_iterator_remove(). No other modifications to the
+ * list are allowed during the iteration.
+ *
+ * @param var_ Loop variable name. This will be a pointer to @p type_
+ * that points to the current element in the iteration.
+ * @param iter_ Iterator to initialize. This will be a pointer to
+ * @ref ecu_ulist_iterator.
+ * @param list_ List to iterate over. This will be a pointer to
+ * @ref ecu_ulist. The iteration will immediately exit if this list
+ * is empty.
+ * @param type_ Element type stored in @p list_. Do not use const
+ * specifier.
+ */
+#define ECU_ULIST_FOR_EACH(var_, iter_, list_, type_)                \
+    for (type_ *var_ = (type_ *)ecu_ulist_iterator_begin(iter_, list_); \
+         var_ != (type_ *)ecu_ulist_iterator_end(iter_);                \
+         var_ = (type_ *)ecu_ulist_iterator_next(iter_))
+
+/**
+ * @brief Const-qualified version of @ref ECU_ULIST_FOR_EACH().
+ * Returned elements are read-only.
+ *
+ * @param var_ Loop variable name. This will be a pointer to
+ * const @p type_ that points to the current element in the iteration.
+ * @param citer_ Iterator to initialize. This will be a pointer to
+ * @ref ecu_ulist_citerator.
+ * @param list_ List to iterate over. This will be a pointer to
+ * @ref ecu_ulist. The iteration will immediately exit if this list
+ * is empty.
+ * @param type_ Element type stored in @p list_. Do not use const
+ * specifier.
+ */
+#define ECU_ULIST_CONST_FOR_EACH(var_, citer_, list_, type_)                        \
+    for (const type_ *var_ = (const type_ *)ecu_ulist_iterator_cbegin(citer_, list_); \
+         var_ != (const type_ *)ecu_ulist_iterator_cend(citer_);                      \
+         var_ = (const type_ *)ecu_ulist_iterator_cnext(citer_))
+
+/*------------------------------------------------------------*/
+/*-------------------------- ULIST ---------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Unit with the strictest alignment of the fundamental
+ * types. Block memory must be aligned to this type, which is
+ * guaranteed if it is declared as an array of it.
+ */
+union ecu_ulist_max_align
+{
+    /// @brief Floating point alignment.
+    long double ld;
+
+    /// @brief Integer alignment.
+    long long ll;
+
+    /// @brief Object pointer alignment.
+    void *p;
+
+    /// @brief Function pointer alignment.
+    void (*fp)(void);
+};
+
+/**
+ * @brief Header placed at the start of every block. Elements
+ * are stored by value directly after it, at an offset of
+ * @ref ECU_ULIST_BLOCK_HEADER_SIZE.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ulist_block
+{
+    /// @brief Links this block into @ref ecu_ulist.blocks.
+    struct ecu_dnode dnode;
+
+    /// @brief Number of elements currently stored in this
+    /// block. Never 0 while the block is in a list.
+    size_t count;
+};
+
+/**
+ * @brief Unrolled linked list. Stores small, fixed-size elements
+ * by value in blocks of @ref ecu_ulist.capacity elements. Blocks
+ * are chained in a @ref ecu_dlist so iteration touches one node
+ * per block instead of one node per element.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ulist
+{
+    /// @brief Blocks in the list, ordered from front to back.
+    struct ecu_dlist blocks;
+
+    /// @brief Total number of elements in the list.
+    size_t size;
+
+    /// @brief Size of one element in bytes.
+    size_t elem_size;
+
+    /// @brief Maximum number of elements per block.
+    size_t capacity;
+
+    /// @brief Returns memory for a new block. Must be at
+    /// least @ref ECU_ULIST_BLOCK_SIZE() bytes. Returns
+    /// NULL if no memory is available.
+    void *(*block_alloc)(void *obj);
+
+    /// @brief Releases memory previously returned by
+    /// @ref ecu_ulist.block_alloc.
+    void (*block_free)(void *block, void *obj);
+
+    /// @brief Optional object passed to the allocator
+    /// callbacks.
+    void *obj;
+};
+
+/*------------------------------------------------------------*/
+/*--------------------- ULIST ITERATORS ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Non-const list iterator.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ulist_iterator
+{
+    /// @brief List that is being iterated.
+    struct ecu_ulist *list;
+
+    /// @brief Block containing the current element. NULL
+    /// once the iteration has finished.
+    struct ecu_ulist_block *block;
+
+    /// @brief Index of the current element in @ref block.
+    size_t index;
+
+    /// @brief True if the current element was removed. The
+    /// following element was shifted into its place so the
+    /// next call to @ref ecu_ulist_iterator_next() does not
+    /// advance @ref index.
+    bool removed;
+};
+
+/**
+ * @brief Const list iterator.
+ *
+ * @warning PRIVATE. Unless otherwise specified, all
+ * members can only be edited via the public API.
+ */
+struct ecu_ulist_citerator
+{
+    /// @brief List that is being iterated.
+    const struct ecu_ulist *list;
+
+    /// @brief Block containing the current element. NULL
+    /// once the iteration has finished.
+    const struct ecu_ulist_block *block;
+
+    /// @brief Index of the current element in @ref block.
+    size_t index;
+};
+
+/*------------------------------------------------------------*/
+/*------------------ ULIST MEMBER FUNCTIONS ------------------*/
+/*------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name UList Constructors
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me.
+ * @brief List constructor. No blocks are allocated until the
+ * first element is added.
+ *
+ * @warning @p me must not be an active list, otherwise
+ * behavior is undefined.
+ *
+ * @param me List to construct. This cannot be NULL.
+ * @param elem_size Size of one element in bytes. Must be greater than 0.
+ * @param capacity Number of elements stored per block. Must be greater than 0.
+ * @param block_alloc Mandatory function that returns memory for a new
+ * block. The memory must be at least @ref ECU_ULIST_BLOCK_SIZE() bytes and
+ * aligned to @ref ecu_ulist_max_align. Return NULL if no memory is available.
+ * @param block_free Mandatory function that releases a block previously
+ * returned by @p block_alloc.
+ * @param obj Optional object to pass to @p block_alloc and @p block_free.
+ * Supply @ref ECU_ULIST_OBJ_UNUSED if unused.
+ */
+extern void ecu_ulist_ctor(struct ecu_ulist *me,
+                           size_t elem_size,
+                           size_t capacity,
+                           void *(*block_alloc)(void *obj),
+                           void (*block_free)(void *block, void *obj),
+                           void *obj);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief List destructor. Releases all blocks back to the user-supplied
+ * allocator. The list must be reconstructed in order to be used again.
+ *
+ * @param me List to destroy.
+ */
+extern void ecu_ulist_destroy(struct ecu_ulist *me);
+/**@}*/
+
+/**
+ * @name UList Member Functions
+ */
+/**@{*/
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Returns the back element but does not remove it. If the list is
+ * empty, NULL is returned.
+ *
+ * @param me List to check.
+ */
+extern void *ecu_ulist_back(struct ecu_ulist *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Const-qualified version of @ref ecu_ulist_back(). Returned
+ * element is read-only.
+ *
+ * @param me List to check.
+ */
+extern const void *ecu_ulist_cback(const struct ecu_ulist *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Removes all elements from the list and releases all blocks
+ * back to the user-supplied allocator. List can be reused without
+ * reconstruction.
+ *
+ * @param me List to clear.
+ */
+extern void ecu_ulist_clear(struct ecu_ulist *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Moves elements towards the front so that every block except
+ * the last is full. Order is preserved. Blocks that become empty are
+ * released back to the user-supplied allocator.
+ *
+ * @param me List to compact.
+ */
+extern void ecu_ulist_compact(struct ecu_ulist *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Returns true if the list is empty. False otherwise.
+ *
+ * @param me List to check.
+ */
+extern bool ecu_ulist_empty(const struct ecu_ulist *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Returns the front element but does not remove it. If the list
+ * is empty, NULL is returned.
+ *
+ * @param me List to check.
+ */
+extern void *ecu_ulist_front(struct ecu_ulist *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Const-qualified version of @ref ecu_ulist_front(). Returned
+ * element is read-only.
+ *
+ * @param me List to check.
+ */
+extern const void *ecu_ulist_cfront(const struct ecu_ulist *me);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @pre @p me is already sorted by @p lhs_less_than_rhs.
+ * @brief Copies an element into the list at its sorted position. The
+ * element is placed after all elements that are equal to it so the
+ * insertion is stable. A full block is split in half to make room.
+ * Returns true if the element was added. Returns false if a new block
+ * was required but the allocator returned NULL. The list is unchanged
+ * in this case.
+ *
+ * @param me List to add to.
+ * @param elem Element to copy into the list.
+ * @param lhs_less_than_rhs Mandatory function that defines sorting condition.
+ * Return true if left element (lhs) is less than right element (rhs).
+ * Otherwise return false.
+ * @param data Optional object to pass to @p lhs_less_than_rhs. Supply
+ * @ref ECU_ULIST_OBJ_UNUSED if unused.
+ */
+extern bool ecu_ulist_insert(struct ecu_ulist *me,
+                             const void *elem,
+                             bool (*lhs_less_than_rhs)(const void *lhs, const void *rhs, void *data),
+                             void *data);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Removes the back element. Returns false if the list is empty.
+ * True otherwise. A block is released back to the user-supplied allocator
+ * once its last element is removed.
+ *
+ * @param me List to remove from.
+ * @param out Optional. Removed element is copied here if this is not NULL.
+ */
+extern bool ecu_ulist_pop_back(struct ecu_ulist *me, void *out);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Removes the front element. Returns false if the list is empty.
+ * True otherwise. A block is released back to the user-supplied allocator
+ * once its last element is removed.
+ *
+ * @param me List to remove from.
+ * @param out Optional. Removed element is copied here if this is not NULL.
+ */
+extern bool ecu_ulist_pop_front(struct ecu_ulist *me, void *out);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Copies an element to the back of the list. Returns true if the
+ * element was added. Returns false if a new block was required but the
+ * allocator returned NULL. The list is unchanged in this case.
+ *
+ * @param me List to add to.
+ * @param elem Element to copy into the list.
+ */
+extern bool ecu_ulist_push_back(struct ecu_ulist *me, const void *elem);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Copies an element to the front of the list. Returns true if the
+ * element was added. Returns false if a new block was required but the
+ * allocator returned NULL. The list is unchanged in this case.
+ *
+ * @param me List to add to.
+ * @param elem Element to copy into the list.
+ */
+extern bool ecu_ulist_push_front(struct ecu_ulist *me, const void *elem);
+
+/**
+ * @pre @p me previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Returns the number of elements in the list.
+ *
+ * @param me List to check.
+ */
+extern size_t ecu_ulist_size(const struct ecu_ulist *me);
+
+/**
+ * @brief Returns true if the supplied list has been constructed.
+ * False otherwise.
+ *
+ * @param me List to check.
+ */
+extern bool ecu_ulist_valid(const struct ecu_ulist *me);
+/**@}*/
+
+/*------------------------------------------------------------*/
+/*----------- NON-CONST ITERATOR MEMBER FUNCTIONS ------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @name Iterators
+ */
+/**@{*/
+/**
+ * @pre Memory already allocated for @p me
+ * @pre @p list previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Initializes iterator and returns the front element. Returns the
+ * same terminal value as @ref ecu_ulist_iterator_end() if the list is empty.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_ULIST_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const iterator to initialize.
+ * @param list List to iterate over.
+ */
+extern void *ecu_ulist_iterator_begin(struct ecu_ulist_iterator *me, struct ecu_ulist *list);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_ulist_iterator_begin().
+ * @brief Returns the iteration's terminal value, which is NULL.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_ULIST_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const iterator.
+ */
+extern void *ecu_ulist_iterator_end(struct ecu_ulist_iterator *me);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_ulist_iterator_begin().
+ * @brief Returns the next element in the iteration.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_ULIST_FOR_EACH()
+ * instead.
+ *
+ * @param me Non-const iterator.
+ */
+extern void *ecu_ulist_iterator_next(struct ecu_ulist_iterator *me);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_ulist_iterator_begin().
+ * @brief Removes the current element in the iteration. The iteration
+ * continues with the element that followed it. If the block holding the
+ * current element falls below half capacity, it absorbs the next block
+ * when both fit in one block. Blocks that become empty are released back
+ * to the user-supplied allocator.
+ *
+ * @warning Pointers to elements in the list are invalidated since
+ * elements are moved.
+ *
+ * @param me Non-const iterator. The current element cannot have
+ * already been removed and the iteration cannot have finished.
+ */
+extern void ecu_ulist_iterator_remove(struct ecu_ulist_iterator *me);
+
+/*------------------------------------------------------------*/
+/*------------- CONST ITERATOR MEMBER FUNCTIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @pre Memory already allocated for @p me
+ * @pre @p list previously constructed via call to @ref ecu_ulist_ctor().
+ * @brief Const-qualified version of @ref ecu_ulist_iterator_begin().
+ * Returned element is read-only.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_ULIST_CONST_FOR_EACH()
+ * instead.
+ *
+ * @param me Const iterator to initialize.
+ * @param list List to iterate over.
+ */
+extern const void *ecu_ulist_iterator_cbegin(struct ecu_ulist_citerator *me, const struct ecu_ulist *list);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_ulist_iterator_cbegin().
+ * @brief Const-qualified version of @ref ecu_ulist_iterator_end().
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_ULIST_CONST_FOR_EACH()
+ * instead.
+ *
+ * @param me Const iterator.
+ */
+extern const void *ecu_ulist_iterator_cend(struct ecu_ulist_citerator *me);
+
+/**
+ * @pre @p me previously initialized via call to @ref ecu_ulist_iterator_cbegin().
+ * @brief Const-qualified version of @ref ecu_ulist_iterator_next().
+ * Returned element is read-only.
+ *
+ * @warning Not meant to be used directly. Use @ref ECU_ULIST_CONST_FOR_EACH()
+ * instead.
+ *
+ * @param me Const iterator.
+ */
+extern const void *ecu_ulist_iterator_cnext(struct ecu_ulist_citerator *me);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECU_ULIST_H_ */
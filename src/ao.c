@@ -0,0 +1,279 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ao.h section <ao_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/ao.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Runtime asserts. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/ao.c")
+
+/*------------------------------------------------------------*/
+/*---------------------- STATIC ASSERTS ----------------------*/
+/*------------------------------------------------------------*/
+
+ECU_STATIC_ASSERT( ((ECU_AO_ALIGNMENT & (ECU_AO_ALIGNMENT - 1U)) == 0), "ECU_AO_ALIGNMENT must be a power of two." );
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Common constructor. Aligns @p buffer and splits it
+ * into queue slots followed by the dispatch slot.
+ */
+static void ctor(struct ecu_ao *me, void *buffer, size_t size, size_t event_size);
+
+/**
+ * @brief Returns the slot at @p index. The dispatch slot
+ * is at index @ref ecu_ao.capacity.
+ */
+static uint8_t *slot(const struct ecu_ao *me, size_t index);
+
+/**
+ * @brief Asserts @p event fits in a slot and returns the
+ * number of bytes to copy.
+ */
+static size_t checked_size(const struct ecu_ao *me, const struct ecu_event *event);
+
+/**
+ * @brief Moves the event at the front of the queue into the
+ * dispatch slot and dispatches it. Copying it out first frees its
+ * queue slot, so handlers can post any event, including an urgent
+ * one that reuses that slot, without overwriting the event they
+ * are processing. Queue must not be empty.
+ */
+static void dispatch_front(struct ecu_ao *me);
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static void ctor(struct ecu_ao *me, void *buffer, size_t size, size_t event_size)
+{
+    ECU_ASSERT( (me && buffer) );
+    ECU_ASSERT( (event_size >= sizeof(struct ecu_event)) );
+    uint8_t *start = (uint8_t *)buffer;
+    size_t padding = (size_t)((ECU_AO_ALIGNMENT - ((uintptr_t)start % ECU_AO_ALIGNMENT)) % ECU_AO_ALIGNMENT);
+    size_t slots = 0;
+
+    ECU_ASSERT( (size > padding) );
+    me->slot_size = ECU_AO_SLOT_SIZE(event_size);
+    slots = (size - padding) / me->slot_size;
+    ECU_ASSERT( (slots >= 2) ); /* At least one queue slot and the dispatch slot. */
+    me->slots = &start[padding];
+    me->capacity = slots - 1;
+    me->head = 0;
+    me->count = 0;
+    me->dispatching = false;
+    me->post_hook = ECU_AO_POST_HOOK_UNUSED;
+    me->post_hook_obj = ECU_AO_OBJ_UNUSED;
+}
+
+static uint8_t *slot(const struct ecu_ao *me, size_t index)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (index <= me->capacity) );
+    return &me->slots[index * me->slot_size];
+}
+
+static size_t checked_size(const struct ecu_ao *me, const struct ecu_event *event)
+{
+    ECU_ASSERT( (me && event) );
+    size_t size = ecu_event_size(event);
+    ECU_ASSERT( (size >= sizeof(struct ecu_event)) ); /* Event's size must be set for it to be copied. */
+    ECU_ASSERT( (size <= me->slot_size) );
+    return size;
+}
+
+static void dispatch_front(struct ecu_ao *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->count > 0) );
+    uint8_t *current = slot(me, me->capacity);
+    const uint8_t *front = slot(me, me->head);
+
+    memcpy(current, front, ((const struct ecu_event *)(const void *)front)->size);
+    me->head = (me->head + 1 == me->capacity) ? 0 : me->head + 1;
+    me->count--;
+
+    me->dispatching = true;
+    if (me->fsm)
+    {
+        ecu_fsm_dispatch(me->fsm, current);
+    }
+    else
+    {
+        ecu_hsm_dispatch(me->hsm, current);
+    }
+    me->dispatching = false;
+}
+
+/*------------------------------------------------------------*/
+/*--------------------- AO MEMBER FUNCTIONS ------------------*/
+/*------------------------------------------------------------*/
+
+void ecu_ao_fsm_ctor(struct ecu_ao *me,
+                     struct ecu_fsm *fsm,
+                     void *buffer,
+                     size_t size,
+                     size_t event_size)
+{
+    ECU_ASSERT( (me && fsm) );
+    ctor(me, buffer, size, event_size);
+    me->fsm = fsm;
+    me->hsm = (struct ecu_hsm *)0;
+}
+
+void ecu_ao_hsm_ctor(struct ecu_ao *me,
+                     struct ecu_hsm *hsm,
+                     void *buffer,
+                     size_t size,
+                     size_t event_size)
+{
+    ECU_ASSERT( (me && hsm) );
+    ctor(me, buffer, size, event_size);
+    me->fsm = (struct ecu_fsm *)0;
+    me->hsm = hsm;
+}
+
+size_t ecu_ao_capacity(const struct ecu_ao *me)
+{
+    ECU_ASSERT( (me) );
+    return me->capacity;
+}
+
+size_t ecu_ao_count(const struct ecu_ao *me)
+{
+    ECU_ASSERT( (me) );
+    return me->count;
+}
+
+bool ecu_ao_post(struct ecu_ao *me, const struct ecu_event *event)
+{
+    ECU_ASSERT( (me && event) );
+    size_t size = checked_size(me, event);
+    bool status = false;
+
+    if (me->count < me->capacity)
+    {
+        size_t tail = me->head + me->count;
+
+        if (tail >= me->capacity)
+        {
+            tail -= me->capacity;
+        }
+
+        memcpy(slot(me, tail), event, size);
+        me->count++;
+        status = true;
+
+        if (me->post_hook)
+        {
+            (*me->post_hook)(me, me->post_hook_obj);
+        }
+    }
+
+    return status;
+}
+
+bool ecu_ao_post_urgent(struct ecu_ao *me, const struct ecu_event *event)
+{
+    ECU_ASSERT( (me && event) );
+    size_t size = checked_size(me, event);
+    bool status = false;
+
+    if (me->count < me->capacity)
+    {
+        me->head = (me->head == 0) ? me->capacity - 1 : me->head - 1;
+        memcpy(slot(me, me->head), event, size);
+        me->count++;
+        status = true;
+
+        if (me->post_hook)
+        {
+            (*me->post_hook)(me, me->post_hook_obj);
+        }
+    }
+
+    return status;
+}
+
+bool ecu_ao_run_once(struct ecu_ao *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (!me->dispatching) ); /* Cannot run the queue from one of its own handlers. */
+    bool status = false;
+
+    if (me->count > 0)
+    {
+        dispatch_front(me);
+        status = true;
+    }
+
+    return status;
+}
+
+size_t ecu_ao_run_until_empty(struct ecu_ao *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (!me->dispatching) ); /* Cannot run the queue from one of its own handlers. */
+    size_t dispatched = 0;
+
+    while (me->count > 0)
+    {
+        dispatch_front(me);
+        dispatched++;
+    }
+
+    return dispatched;
+}
+
+void ecu_ao_set_post_hook(struct ecu_ao *me,
+                          void (*hook)(struct ecu_ao *me, void *obj),
+                          void *obj)
+{
+    ECU_ASSERT( (me) );
+    me->post_hook = hook;
+    me->post_hook_obj = obj;
+}
+
+void ecu_ao_start(struct ecu_ao *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (!me->dispatching) );
+
+    if (me->fsm)
+    {
+        ecu_fsm_start(me->fsm);
+    }
+    else
+    {
+        ecu_hsm_start(me->hsm);
+    }
+}
@@ -49,6 +49,18 @@ ECU_ASSERT_DEFINE_FILE("ecu/dlist.c")
 #define DESTROYED_HEAD_ID \
     (ECU_OBJECT_ID_UNUSED)
 
+/**
+ * @brief Hints to the CPU that the node at @p addr_ will be
+ * read soon. No-op if the compiler has no prefetch builtin.
+ */
+#if defined(__GNUC__)
+    #define PREFETCH(addr_) \
+        (__builtin_prefetch((addr_)))
+#else
+    #define PREFETCH(addr_) \
+        ((void)(addr_))
+#endif
+
 /*------------------------------------------------------------*/
 /*---------------- STATIC FUNCTION DECLARATIONS --------------*/
 /*------------------------------------------------------------*/
@@ -465,6 +477,50 @@ void ecu_dlist_insert_before(struct ecu_dlist *me,
     }
 }
 
+void ecu_dlist_merge(struct ecu_dlist *me,
+                     struct ecu_dlist *other,
+                     bool (*lhs_less_than_rhs)(const struct ecu_dnode *lhs, const struct ecu_dnode *rhs, void *data),
+                     void *data)
+{
+    ECU_ASSERT( (me && other && lhs_less_than_rhs) );
+    ECU_ASSERT( (me != other) );
+    ECU_ASSERT( (ecu_dlist_valid(me) && ecu_dlist_valid(other)) );
+    struct ecu_dnode *pos = me->head.next;
+
+    while (other->head.next != &other->head)
+    {
+        struct ecu_dnode *node = other->head.next;
+        ECU_ASSERT( (ecu_dnode_valid(node)) );
+
+        if (pos == &me->head)
+        {
+            /* Reached end of me. Remaining nodes in other are all greater
+            than or equal to me's nodes so splice them onto the back in O(1). */
+            node->prev = me->head.prev;
+            me->head.prev->next = node;
+            other->head.prev->next = &me->head;
+            me->head.prev = other->head.prev;
+            other->head.next = &other->head;
+            other->head.prev = &other->head;
+        }
+        else if ((*lhs_less_than_rhs)(node, pos, data))
+        {
+            /* Relink node from other in front of pos. Only strictly less than
+            moves the node, which keeps the merge stable. */
+            other->head.next = node->next;
+            node->next->prev = &other->head;
+            node->next = pos;
+            node->prev = pos->prev;
+            pos->prev->next = node;
+            pos->prev = node;
+        }
+        else
+        {
+            pos = pos->next;
+        }
+    }
+}
+
 void ecu_dlist_push_back(struct ecu_dlist *me, struct ecu_dnode *node)
 {
     ECU_ASSERT( (me && node) );
@@ -672,6 +728,104 @@ void ecu_dlist_sort(struct ecu_dlist *me,
     }
 }
 
+void ecu_dlist_sort_parallel(struct ecu_dlist *me,
+                             struct ecu_dlist *chunks,
+                             size_t count,
+                             size_t cutover,
+                             bool (*lhs_less_than_rhs)(const struct ecu_dnode *lhs, const struct ecu_dnode *rhs, void *data),
+                             void *data,
+                             void (*sort_chunks)(struct ecu_dlist *chunks,
+                                                 size_t count,
+                                                 bool (*lhs_less_than_rhs)(const struct ecu_dnode *lhs, const struct ecu_dnode *rhs, void *data),
+                                                 void *data,
+                                                 void *obj),
+                             void *obj)
+{
+    ECU_ASSERT( (me && chunks && lhs_less_than_rhs && sort_chunks) );
+    ECU_ASSERT( (count > 0) );
+    ECU_ASSERT( (ecu_dlist_valid(me)) );
+
+    if ((count == 1) || (ecu_dlist_size(me) < cutover))
+    {
+        ecu_dlist_sort(me, lhs_less_than_rhs, data);
+    }
+    else
+    {
+        size_t used = ecu_dlist_split(me, chunks, count);
+        (*sort_chunks)(chunks, used, lhs_less_than_rhs, data, obj);
+
+        /* Pairwise merge tree. Each chunk is always merged with the chunk
+        that originally came after it so the sort stays stable. */
+        for (size_t stride = 1; stride < used; stride *= 2U)
+        {
+            for (size_t i = 0; (i + stride) < used; i += (2U * stride))
+            {
+                ecu_dlist_merge(&chunks[i], &chunks[i + stride], lhs_less_than_rhs, data);
+            }
+        }
+
+        /* me is empty after the split. Sorted list is in the first chunk. */
+        ecu_dlist_swap(me, &chunks[0]);
+    }
+}
+
+void ecu_dlist_splice(struct ecu_dlist *me, struct ecu_dlist *other)
+{
+    ECU_ASSERT( (me && other) );
+    ECU_ASSERT( (me != other) );
+    ECU_ASSERT( (ecu_dlist_valid(me) && ecu_dlist_valid(other)) );
+
+    if (!ecu_dlist_empty(other))
+    {
+        other->head.next->prev = me->head.prev;
+        me->head.prev->next = other->head.next;
+        other->head.prev->next = &me->head;
+        me->head.prev = other->head.prev;
+        other->head.next = &other->head;
+        other->head.prev = &other->head;
+    }
+}
+
+size_t ecu_dlist_split(struct ecu_dlist *me, struct ecu_dlist *chunks, size_t count)
+{
+    ECU_ASSERT( (me && chunks) );
+    ECU_ASSERT( (count > 0) );
+    ECU_ASSERT( (ecu_dlist_valid(me)) );
+    size_t size = ecu_dlist_size(me);
+    size_t used = (size < count) ? size : count;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        ECU_ASSERT( (&chunks[i] != me) );
+        ECU_ASSERT( (ecu_dlist_empty(&chunks[i])) );
+    }
+
+    for (size_t i = 0; i < used; i++)
+    {
+        /* Spread remainder over the first chunks so sizes differ by at most 1. */
+        size_t n = (size / used) + ((i < (size % used)) ? 1U : 0U);
+        struct ecu_dnode *first = me->head.next;
+        struct ecu_dnode *last = first;
+
+        for (size_t j = 1; j < n; j++)
+        {
+            last = last->next;
+        }
+
+        /* Detach [first, last] from front of me. */
+        me->head.next = last->next;
+        last->next->prev = &me->head;
+
+        /* Attach [first, last] to chunk. */
+        first->prev = &chunks[i].head;
+        last->next = &chunks[i].head;
+        chunks[i].head.next = first;
+        chunks[i].head.prev = last;
+    }
+
+    return used;
+}
+
 void ecu_dlist_swap(struct ecu_dlist *me, struct ecu_dlist *other)
 {
     ECU_ASSERT( (me && other) );
@@ -803,3 +957,90 @@ const struct ecu_dnode *ecu_dlist_iterator_cnext(struct ecu_dlist_citerator *me)
     me->next = me->next->next;
     return (me->current);
 }
+
+/*------------------------------------------------------------*/
+/*------------ PREFETCH ITERATOR MEMBER FUNCTIONS ------------*/
+/*------------------------------------------------------------*/
+
+struct ecu_dnode *ecu_dlist_prefetch_iterator_begin(struct ecu_dlist_prefetch_iterator *me,
+                                                    struct ecu_dlist *list,
+                                                    size_t distance)
+{
+    ECU_ASSERT( (me && list) );
+    struct ecu_dnode *current = ecu_dlist_iterator_begin(&me->iterator, list);
+    me->ahead = (distance > 0) ? current : &list->head;
+
+    /* Loads on this walk are unavoidable. The prefetch distance
+    is only built up once, then maintained by iterator_next(). A
+    distance of 0 parks the ahead node on HEAD so nothing is prefetched. */
+    for (size_t i = 0; (i < distance) && (me->ahead != &list->head); i++)
+    {
+        me->ahead = me->ahead->next;
+        PREFETCH(me->ahead);
+    }
+
+    return current;
+}
+
+struct ecu_dnode *ecu_dlist_prefetch_iterator_end(struct ecu_dlist_prefetch_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    return ecu_dlist_iterator_end(&me->iterator);
+}
+
+struct ecu_dnode *ecu_dlist_prefetch_iterator_next(struct ecu_dlist_prefetch_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    struct ecu_dnode *current = ecu_dlist_iterator_next(&me->iterator);
+
+    /* The ahead node was prefetched in a previous step so reading its next
+    pointer should hit cache. Prefetching is only a hint so the ahead node
+    is not asserted. It stops at HEAD, or at a node that was destroyed (NULL
+    next pointer), without affecting the iteration. */
+    if ((me->ahead != &me->iterator.list->head) &&
+        (me->ahead->next))
+    {
+        me->ahead = me->ahead->next;
+        PREFETCH(me->ahead);
+    }
+
+    return current;
+}
+
+const struct ecu_dnode *ecu_dlist_prefetch_iterator_cbegin(struct ecu_dlist_prefetch_citerator *me,
+                                                           const struct ecu_dlist *list,
+                                                           size_t distance)
+{
+    ECU_ASSERT( (me && list) );
+    const struct ecu_dnode *current = ecu_dlist_iterator_cbegin(&me->citerator, list);
+    me->ahead = (distance > 0) ? current : &list->head;
+
+    for (size_t i = 0; (i < distance) && (me->ahead != &list->head); i++)
+    {
+        me->ahead = me->ahead->next;
+        PREFETCH(me->ahead);
+    }
+
+    return current;
+}
+
+const struct ecu_dnode *ecu_dlist_prefetch_iterator_cend(struct ecu_dlist_prefetch_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    return ecu_dlist_iterator_cend(&me->citerator);
+}
+
+const struct ecu_dnode *ecu_dlist_prefetch_iterator_cnext(struct ecu_dlist_prefetch_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    const struct ecu_dnode *current = ecu_dlist_iterator_cnext(&me->citerator);
+
+    if ((me->ahead != &me->citerator.list->head) &&
+        (me->ahead->next))
+    {
+        me->ahead = me->ahead->next;
+        PREFETCH(me->ahead);
+    }
+
+    return current;
+}
@@ -0,0 +1,579 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`exec.h section <exec_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/exec.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Runtime asserts. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/exec.c")
+
+/* Module requires GNU atomic builtins and mpsc.c, which has the same
+requirement. Nothing is compiled with other compilers so the rest of
+ECU still builds. */
+#if defined(__GNUC__)
+/*------------------------------------------------------------*/
+/*---------------------------- DEFINES -----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Offset of the event within a mailbox slot. The
+ * sequence number comes first.
+ */
+#define EVENT_OFFSET \
+    (ECU_AO_SLOT_SIZE(sizeof(size_t)))
+
+/**
+ * @brief Atomically loads @p ptr_ with acquire ordering.
+ */
+#define ATOMIC_LOAD(ptr_) \
+    (__atomic_load_n((ptr_), __ATOMIC_ACQUIRE))
+
+/**
+ * @brief Atomically loads @p ptr_ without ordering.
+ */
+#define ATOMIC_LOAD_RELAXED(ptr_) \
+    (__atomic_load_n((ptr_), __ATOMIC_RELAXED))
+
+/**
+ * @brief Atomically stores @p val_ into @p ptr_ with release ordering.
+ */
+#define ATOMIC_STORE(ptr_, val_) \
+    (__atomic_store_n((ptr_), (val_), __ATOMIC_RELEASE))
+
+/**
+ * @brief Atomically stores @p val_ into @p ptr_ and returns
+ * the previous value. Full acquire-release ordering.
+ */
+#define ATOMIC_EXCHANGE(ptr_, val_) \
+    (__atomic_exchange_n((ptr_), (val_), __ATOMIC_ACQ_REL))
+
+/**
+ * @brief Atomically replaces @p ptr_ with @p desired_ if it still
+ * equals @p expected_. Otherwise @p expected_ is updated to the
+ * current value. Returns true if replaced. Full acquire-release
+ * ordering on success.
+ */
+#define ATOMIC_CAS(ptr_, expected_, desired_) \
+    (__atomic_compare_exchange_n((ptr_), (expected_), (desired_), false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+
+/**
+ * @brief Same as @ref ATOMIC_CAS() without ordering and allowed
+ * to fail spuriously. Only used to reserve mailbox slots.
+ */
+#define ATOMIC_CAS_RELAXED(ptr_, expected_, desired_) \
+    (__atomic_compare_exchange_n((ptr_), (expected_), (desired_), true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+
+/*------------------------------------------------------------*/
+/*---------------------- STATIC ASSERTS ----------------------*/
+/*------------------------------------------------------------*/
+
+ECU_STATIC_ASSERT( (ECU_AO_ALIGNMENT >= sizeof(size_t)), "ECU_AO_ALIGNMENT must be at least sizeof(size_t)." );
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Common active object constructor. Aligns @p buffer and
+ * splits it into mailbox slots followed by the dispatch slot.
+ */
+static void ao_ctor(struct ecu_exec_ao *me, void *buffer, size_t size, size_t event_size);
+
+/**
+ * @brief Returns the slot at @p index. The dispatch slot is
+ * at index @ref ecu_exec_ao.mask + 1.
+ */
+static uint8_t *slot(const struct ecu_exec_ao *me, size_t index);
+
+/**
+ * @brief Returns the sequence number stored at the start of
+ * @p s. Equals the slot's position + 1 once an event is published,
+ * and the position of the next lap once it is consumed.
+ */
+static size_t *sequence(uint8_t *s);
+
+/**
+ * @brief Returns true if the event at position @p pos of the
+ * mailbox is published.
+ */
+static bool published(const struct ecu_exec_ao *me, size_t pos);
+
+/**
+ * @brief Moves the event at the front of the mailbox into the
+ * dispatch slot, frees its mailbox slot, and dispatches it.
+ * Front event must be published.
+ */
+static void dispatch_front(struct ecu_exec_ao *me);
+
+/**
+ * @brief Pushes @p ao onto @p worker's inbox. Caller must have
+ * set @ref ecu_exec_ao.scheduled.
+ */
+static void schedule(struct ecu_exec_worker *worker, struct ecu_exec_ao *ao);
+
+/**
+ * @brief Owner-side deque function. Adds @p ao to the bottom.
+ * Returns false if the deque is full.
+ */
+static bool deque_push(struct ecu_exec_worker *me, struct ecu_exec_ao *ao);
+
+/**
+ * @brief Owner-side function. Adds @p ao to the bottom of the
+ * deque, or to the inbox if the deque is full.
+ */
+static void requeue(struct ecu_exec_worker *me, struct ecu_exec_ao *ao);
+
+/**
+ * @brief Removes and returns the oldest object. Called by the
+ * owner and by thieves. Returns NULL if the deque is empty.
+ */
+static struct ecu_exec_ao *deque_pop(struct ecu_exec_worker *me);
+
+/**
+ * @brief Moves objects from @p me's inbox into its deque until
+ * either is exhausted.
+ */
+static void refill(struct ecu_exec_worker *me);
+
+/**
+ * @brief Tries to steal one object from every other worker,
+ * starting after the last victim.
+ */
+static struct ecu_exec_ao *steal(struct ecu_exec *exec, struct ecu_exec_worker *me);
+
+/**
+ * @brief Dispatches up to the executor's budget of events to
+ * @p ao on worker @p me. Afterwards @p ao is rescheduled on
+ * @p me if events are left, otherwise it becomes idle.
+ */
+static void run(struct ecu_exec *exec, struct ecu_exec_worker *me, struct ecu_exec_ao *ao);
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static void ao_ctor(struct ecu_exec_ao *me, void *buffer, size_t size, size_t event_size)
+{
+    ECU_ASSERT( (me && buffer) );
+    ECU_ASSERT( (event_size >= sizeof(struct ecu_event)) );
+    uint8_t *start = (uint8_t *)buffer;
+    size_t padding = (size_t)((ECU_AO_ALIGNMENT - ((uintptr_t)start % ECU_AO_ALIGNMENT)) % ECU_AO_ALIGNMENT);
+    size_t slots = 0;
+    size_t capacity = 1;
+
+    ECU_ASSERT( (size > padding) );
+    me->slot_size = ECU_EXEC_SLOT_SIZE(event_size);
+    slots = (size - padding) / me->slot_size;
+    ECU_ASSERT( (slots >= 2) ); /* At least one mailbox slot and the dispatch slot. */
+
+    /* Positions are masked instead of wrapped, so capacity is rounded down to a power of two. */
+    while ((capacity * 2U) <= (slots - 1))
+    {
+        capacity *= 2U;
+    }
+
+    ecu_dnode_ctor(&me->node, ECU_DNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+    me->slots = &start[padding];
+    me->mask = capacity - 1;
+    me->head = 0;
+    me->tail = 0;
+    me->scheduled = false;
+    me->home = (struct ecu_exec_worker *)0;
+
+    for (size_t i = 0; i < capacity; i++)
+    {
+        *sequence(slot(me, i)) = i;
+    }
+}
+
+static uint8_t *slot(const struct ecu_exec_ao *me, size_t index)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (index <= (me->mask + 1)) );
+    return &me->slots[index * me->slot_size];
+}
+
+static size_t *sequence(uint8_t *s)
+{
+    ECU_ASSERT( (s) );
+    return (size_t *)(void *)s;
+}
+
+static bool published(const struct ecu_exec_ao *me, size_t pos)
+{
+    ECU_ASSERT( (me) );
+    const size_t *seq = sequence(slot(me, pos & me->mask));
+    return (ATOMIC_LOAD(seq) == (pos + 1));
+}
+
+static void dispatch_front(struct ecu_exec_ao *me)
+{
+    ECU_ASSERT( (me) );
+    uint8_t *front = slot(me, me->head & me->mask);
+    uint8_t *current = slot(me, me->mask + 1);
+    const struct ecu_event *event = (const struct ecu_event *)(const void *)&front[EVENT_OFFSET];
+
+    memcpy(&current[EVENT_OFFSET], event, event->size);
+
+    /* Slot is free once its sequence number moves on to the next lap. */
+    ATOMIC_STORE(sequence(front), me->head + me->mask + 1);
+    me->head++;
+
+    if (me->fsm)
+    {
+        ecu_fsm_dispatch(me->fsm, &current[EVENT_OFFSET]);
+    }
+    else
+    {
+        ecu_hsm_dispatch(me->hsm, &current[EVENT_OFFSET]);
+    }
+}
+
+static void schedule(struct ecu_exec_worker *worker, struct ecu_exec_ao *ao)
+{
+    ECU_ASSERT( (worker && ao) );
+    ecu_mpsc_push(&worker->inbox, &ao->node);
+}
+
+static bool deque_push(struct ecu_exec_worker *me, struct ecu_exec_ao *ao)
+{
+    ECU_ASSERT( (me && ao) );
+    size_t b = ATOMIC_LOAD_RELAXED(&me->bottom);
+    size_t t = ATOMIC_LOAD(&me->top);
+    bool status = false;
+
+    if ((b - t) <= me->mask)
+    {
+        /* Release so a thief that reads this slot also sees the object's state. */
+        ATOMIC_STORE(&me->deque[b & me->mask], ao);
+        ATOMIC_STORE(&me->bottom, b + 1);
+        status = true;
+    }
+
+    return status;
+}
+
+static void requeue(struct ecu_exec_worker *me, struct ecu_exec_ao *ao)
+{
+    ECU_ASSERT( (me && ao) );
+
+    if (!deque_push(me, ao))
+    {
+        schedule(me, ao);
+    }
+}
+
+static struct ecu_exec_ao *deque_pop(struct ecu_exec_worker *me)
+{
+    ECU_ASSERT( (me) );
+    struct ecu_exec_ao *ao = (struct ecu_exec_ao *)0;
+    size_t t = ATOMIC_LOAD(&me->top);
+    bool done = false;
+
+    while (!done)
+    {
+        if ((ptrdiff_t)(ATOMIC_LOAD(&me->bottom) - t) > 0)
+        {
+            /* Slot may be overwritten by the owner once top moves past it,
+            but then the CAS fails and the stale value is discarded. */
+            ao = ATOMIC_LOAD(&me->deque[t & me->mask]);
+
+            if (ATOMIC_CAS(&me->top, &t, t + 1))
+            {
+                done = true;
+            }
+            else
+            {
+                /* Lost the race and t was reloaded. Try the next object. */
+                ao = (struct ecu_exec_ao *)0;
+            }
+        }
+        else
+        {
+            done = true;
+        }
+    }
+
+    return ao;
+}
+
+static void refill(struct ecu_exec_worker *me)
+{
+    ECU_ASSERT( (me) );
+    bool done = false;
+
+    while (!done)
+    {
+        struct ecu_dnode *node = (struct ecu_dnode *)0;
+
+        /* Only the owner pushes, so a free slot seen here stays free. */
+        if ((ATOMIC_LOAD_RELAXED(&me->bottom) - ATOMIC_LOAD(&me->top)) <= me->mask)
+        {
+            node = ecu_mpsc_pop(&me->inbox);
+        }
+
+        if (node)
+        {
+            bool pushed = deque_push(me, ECU_DNODE_GET_ENTRY(node, struct ecu_exec_ao, node));
+            ECU_ASSERT( (pushed) );
+            (void)pushed;
+        }
+        else
+        {
+            done = true;
+        }
+    }
+}
+
+static struct ecu_exec_ao *steal(struct ecu_exec *exec, struct ecu_exec_worker *me)
+{
+    ECU_ASSERT( (exec && me) );
+    struct ecu_exec_ao *ao = (struct ecu_exec_ao *)0;
+
+    for (size_t i = 1; (i < exec->count) && !ao; i++)
+    {
+        me->victim = (me->victim + 1 == exec->count) ? 0 : me->victim + 1;
+
+        if (&exec->workers[me->victim] != me)
+        {
+            ao = deque_pop(&exec->workers[me->victim]);
+        }
+    }
+
+    return ao;
+}
+
+static void run(struct ecu_exec *exec, struct ecu_exec_worker *me, struct ecu_exec_ao *ao)
+{
+    ECU_ASSERT( (exec && me && ao) );
+    size_t dispatched = 0;
+    size_t head = 0;
+
+    while ((dispatched < exec->budget) && published(ao, ao->head))
+    {
+        dispatch_front(ao);
+        dispatched++;
+    }
+
+    /* Read before the flag is cleared. Another worker may own the object after that. */
+    head = ao->head;
+
+    if ((dispatched == exec->budget) && published(ao, head))
+    {
+        /* Out of budget. Object stays scheduled and goes behind the
+        other work on this worker. */
+        requeue(me, ao);
+    }
+    else
+    {
+        /* Mailbox looked empty. A post that lands after the flag is cleared
+        schedules the object itself. One that landed before it is caught by
+        the second check, since the exchange orders it after the post. */
+        (void)ATOMIC_EXCHANGE(&ao->scheduled, false);
+
+        if (published(ao, head) && !ATOMIC_EXCHANGE(&ao->scheduled, true))
+        {
+            requeue(me, ao);
+        }
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- EXEC MEMBER FUNCTIONS ------------------*/
+/*------------------------------------------------------------*/
+
+void ecu_exec_ctor(struct ecu_exec *me,
+                   struct ecu_exec_worker *workers,
+                   size_t count,
+                   struct ecu_exec_ao **deques,
+                   size_t capacity,
+                   size_t budget)
+{
+    ECU_ASSERT( (me && workers && deques) );
+    ECU_ASSERT( (count > 0 && budget > 0) );
+    ECU_ASSERT( (capacity > 0 && (capacity & (capacity - 1)) == 0) );
+
+    for (size_t i = 0; i < count; i++)
+    {
+        workers[i].deque = &deques[i * capacity];
+        workers[i].mask = capacity - 1;
+        workers[i].bottom = 0;
+        workers[i].top = 0;
+        ecu_mpsc_ctor(&workers[i].inbox);
+        workers[i].victim = i;
+    }
+
+    me->workers = workers;
+    me->count = count;
+    me->budget = budget;
+    me->next = 0;
+}
+
+void ecu_exec_add(struct ecu_exec *me, struct ecu_exec_ao *ao)
+{
+    ECU_ASSERT( (me && ao) );
+    ECU_ASSERT( (!ao->home) );
+    ao->home = &me->workers[me->next];
+    me->next = (me->next + 1 == me->count) ? 0 : me->next + 1;
+
+    /* Events posted before the object had a home could not schedule it. */
+    if (ao->scheduled)
+    {
+        schedule(ao->home, ao);
+    }
+}
+
+bool ecu_exec_run_once(struct ecu_exec *me, size_t worker)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (worker < me->count) );
+    struct ecu_exec_worker *w = &me->workers[worker];
+    struct ecu_exec_ao *ao = (struct ecu_exec_ao *)0;
+    bool status = false;
+
+    /* Inbox is emptied first so its objects can be stolen by idle workers. */
+    refill(w);
+    ao = deque_pop(w);
+
+    if (!ao)
+    {
+        ao = steal(me, w);
+    }
+
+    if (ao)
+    {
+        run(me, w, ao);
+        status = true;
+    }
+
+    return status;
+}
+
+/*------------------------------------------------------------*/
+/*----------------- EXEC AO MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_exec_ao_fsm_ctor(struct ecu_exec_ao *me,
+                          struct ecu_fsm *fsm,
+                          void *buffer,
+                          size_t size,
+                          size_t event_size)
+{
+    ECU_ASSERT( (me && fsm) );
+    ao_ctor(me, buffer, size, event_size);
+    me->fsm = fsm;
+    me->hsm = (struct ecu_hsm *)0;
+}
+
+void ecu_exec_ao_hsm_ctor(struct ecu_exec_ao *me,
+                          struct ecu_hsm *hsm,
+                          void *buffer,
+                          size_t size,
+                          size_t event_size)
+{
+    ECU_ASSERT( (me && hsm) );
+    ao_ctor(me, buffer, size, event_size);
+    me->fsm = (struct ecu_fsm *)0;
+    me->hsm = hsm;
+}
+
+size_t ecu_exec_ao_capacity(const struct ecu_exec_ao *me)
+{
+    ECU_ASSERT( (me) );
+    return me->mask + 1;
+}
+
+bool ecu_exec_ao_post(struct ecu_exec_ao *me, const struct ecu_event *event)
+{
+    ECU_ASSERT( (me && event) );
+    size_t size = ecu_event_size(event);
+    size_t pos = ATOMIC_LOAD_RELAXED(&me->tail);
+    uint8_t *s = (uint8_t *)0;
+    bool done = false;
+    bool status = false;
+
+    ECU_ASSERT( (size >= sizeof(struct ecu_event)) ); /* Event's size must be set for it to be copied. */
+    ECU_ASSERT( ((EVENT_OFFSET + size) <= me->slot_size) );
+
+    while (!done)
+    {
+        s = slot(me, pos & me->mask);
+        ptrdiff_t diff = (ptrdiff_t)(ATOMIC_LOAD(sequence(s)) - pos);
+
+        if (diff == 0)
+        {
+            /* Slot is free for this lap. Reserve it. Pos is reloaded on failure. */
+            if (ATOMIC_CAS_RELAXED(&me->tail, &pos, pos + 1))
+            {
+                status = true;
+                done = true;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* Slot still holds an event from the previous lap. Full. */
+            done = true;
+        }
+        else
+        {
+            /* Another producer reserved this position. */
+            pos = ATOMIC_LOAD_RELAXED(&me->tail);
+        }
+    }
+
+    if (status)
+    {
+        memcpy(&s[EVENT_OFFSET], event, size);
+        ATOMIC_STORE(sequence(s), pos + 1);
+
+        /* Whoever flips the flag from false puts the object in a run queue.
+        It stays set until a worker finds the mailbox empty. */
+        if (!ATOMIC_EXCHANGE(&me->scheduled, true) && me->home)
+        {
+            schedule(me->home, me);
+        }
+    }
+
+    return status;
+}
+
+void ecu_exec_ao_start(struct ecu_exec_ao *me)
+{
+    ECU_ASSERT( (me) );
+
+    if (me->fsm)
+    {
+        ecu_fsm_start(me->fsm);
+    }
+    else
+    {
+        ecu_hsm_start(me->hsm);
+    }
+}
+#endif /* __GNUC__ */
@@ -80,6 +80,13 @@ static void set_transition(struct ecu_fsm *fsm, enum transition_type t);
  */
 static void clear_all_transitions(struct ecu_fsm *fsm);
 
+/**
+ * @brief Relays event to the current state and runs all
+ * state transitions it signals. Preconditions are checked
+ * by the caller so batches are only validated once.
+ */
+static void dispatch(struct ecu_fsm *me, const void *event);
+
 /*------------------------------------------------------------*/
 /*--------------------- STATIC VARIABLES ---------------------*/
 /*------------------------------------------------------------*/
@@ -141,41 +148,9 @@ static void clear_all_transitions(struct ecu_fsm *fsm)
     fsm->transition = 0;
 }
 
-/*------------------------------------------------------------*/
-/*-------------------- FSM MEMBER FUNCTIONS ------------------*/
-/*------------------------------------------------------------*/
-
-void ecu_fsm_ctor(struct ecu_fsm *me, const struct ecu_fsm_state *state)
-{
-    ECU_ASSERT( (me && state) );
-    ECU_ASSERT( (state_is_valid(state)) );
-    me->state = state;
-    clear_all_transitions(me);
-}
-
-void ecu_fsm_change_state(struct ecu_fsm *me, const struct ecu_fsm_state *state)
-{
-    ECU_ASSERT( (me && state) );
-    ECU_ASSERT( (no_transitions_active(me)) ); /* Cannot call ecu_fsm_change_state() multiple times in a row. Only one transition per dispatch. */
-    ECU_ASSERT( (state_is_valid(state)) );
-
-    if (me->state == state)
-    {
-        set_transition(me, FSM_SELF_TRANSITION);
-    }
-    else
-    {
-        set_transition(me, FSM_STATE_TRANSITION);
-        me->state = state;
-    }
-}
-
-void ecu_fsm_dispatch(struct ecu_fsm *me, const void *event)
+static void dispatch(struct ecu_fsm *me, const void *event)
 {
     ECU_ASSERT( (me && event) );
-    ECU_ASSERT( (no_transitions_active(me)) );
-    ECU_ASSERT( (me->state) );
-    ECU_ASSERT( (state_is_valid(me->state)) );
     const struct ecu_fsm_state *prev_state = me->state;
 
     /* Relay event to state. Save previous state in case of transition.
@@ -223,6 +198,79 @@ void ecu_fsm_dispatch(struct ecu_fsm *me, const void *event)
     }
 }
 
+/*------------------------------------------------------------*/
+/*-------------------- FSM MEMBER FUNCTIONS ------------------*/
+/*------------------------------------------------------------*/
+
+void ecu_fsm_ctor(struct ecu_fsm *me, const struct ecu_fsm_state *state)
+{
+    ECU_ASSERT( (me && state) );
+    ECU_ASSERT( (state_is_valid(state)) );
+    me->state = state;
+    clear_all_transitions(me);
+}
+
+void ecu_fsm_change_state(struct ecu_fsm *me, const struct ecu_fsm_state *state)
+{
+    ECU_ASSERT( (me && state) );
+    ECU_ASSERT( (no_transitions_active(me)) ); /* Cannot call ecu_fsm_change_state() multiple times in a row. Only one transition per dispatch. */
+    ECU_ASSERT( (state_is_valid(state)) );
+
+    if (me->state == state)
+    {
+        set_transition(me, FSM_SELF_TRANSITION);
+    }
+    else
+    {
+        set_transition(me, FSM_STATE_TRANSITION);
+        me->state = state;
+    }
+}
+
+void ecu_fsm_dispatch(struct ecu_fsm *me, const void *event)
+{
+    ECU_ASSERT( (me && event) );
+    ECU_ASSERT( (no_transitions_active(me)) );
+    ECU_ASSERT( (me->state) );
+    ECU_ASSERT( (state_is_valid(me->state)) );
+    dispatch(me, event);
+}
+
+void ecu_fsm_dispatch_array(struct ecu_fsm *me, const void *events, size_t count, size_t size)
+{
+    ECU_ASSERT( (me && events) );
+    ECU_ASSERT( (size > 0) );
+    ECU_ASSERT( (no_transitions_active(me)) );
+    ECU_ASSERT( (me->state) );
+    ECU_ASSERT( (state_is_valid(me->state)) );
+    const uint8_t *event = (const uint8_t *)events;
+
+    /* Every dispatch leaves the fsm with no active transitions and
+    a state validated by ecu_fsm_change_state(), so the preconditions
+    checked above still hold for the next event. */
+    for (size_t i = 0; i < count; i++)
+    {
+        dispatch(me, (const void *)event);
+        event += size;
+    }
+}
+
+void ecu_fsm_dispatch_list(struct ecu_fsm *me, const struct ecu_dlist *events, size_t node_offset)
+{
+    ECU_ASSERT( (me && events) );
+    ECU_ASSERT( (no_transitions_active(me)) );
+    ECU_ASSERT( (me->state) );
+    ECU_ASSERT( (state_is_valid(me->state)) );
+    struct ecu_dlist_citerator citerator;
+
+    /* Handlers receive the user's event that contains each node,
+    the same type they receive from the other dispatch functions. */
+    ECU_DLIST_CONST_FOR_EACH(node, &citerator, events)
+    {
+        dispatch(me, (const void *)((const uint8_t *)node - node_offset));
+    }
+}
+
 void ecu_fsm_start(struct ecu_fsm *me)
 {
     ECU_ASSERT( (me) );
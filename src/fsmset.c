@@ -0,0 +1,334 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`fsmset.h section <fsmset_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/fsmset.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ECU. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/fsmset.c")
+
+/*------------------------------------------------------------*/
+/*---------------------- FILE SCOPE TYPES --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Meaning of bits in every element of
+ * @ref ecu_fsmset.transition. A set bit means that type of
+ * state transition is active. Same as fsm.c.
+ */
+enum transition_type
+{
+    FSMSET_SELF_TRANSITION,
+    FSMSET_STATE_TRANSITION,
+    /************************/
+    FSMSET_TRANSITION_TYPE_COUNT
+};
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Returns true if supplied state has a non-NULL
+ * handler function. False otherwise.
+ */
+static bool state_is_valid(const struct ecu_fsmset_state *state);
+
+/**
+ * @brief Returns true if a specific state transition type
+ * has been signalled for @p instance. False otherwise.
+ */
+static bool transition_is_active(const struct ecu_fsmset *me, size_t instance, enum transition_type t);
+
+/**
+ * @brief Runs exit and entry handlers of @p instance for every
+ * transition that was signalled, starting from @p prev. Shared
+ * by run and start so both follow the rules of fsm.c.
+ */
+static void run_transitions(struct ecu_fsmset *me, size_t instance, ecu_fsmset_state_t prev);
+
+/*------------------------------------------------------------*/
+/*---------------------- STATIC ASSERTS ----------------------*/
+/*------------------------------------------------------------*/
+
+ECU_STATIC_ASSERT( (((size_t)FSMSET_TRANSITION_TYPE_COUNT) <= (sizeof(uint8_t) * 8)),
+                    "Max value in transition_type enum exceeds most significant bit of ecu_fsmset::transition elements." );
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static bool state_is_valid(const struct ecu_fsmset_state *state)
+{
+    ECU_ASSERT( (state) );
+    return (state->handler);
+}
+
+static bool transition_is_active(const struct ecu_fsmset *me, size_t instance, enum transition_type t)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (instance < me->count) );
+    ECU_ASSERT( (t < FSMSET_TRANSITION_TYPE_COUNT) );
+    return ((me->transition[instance] & (1U << t)) != 0);
+}
+
+static void run_transitions(struct ecu_fsmset *me, size_t instance, ecu_fsmset_state_t prev)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (instance < me->count) );
+    const struct ecu_fsmset_state *states = me->states;
+
+    /* Same order as fsm.c. Exit handlers cannot transition since the state
+    is already being exited. Entry handlers cannot self-transition since
+    that would loop forever. */
+    if (transition_is_active(me, instance, FSMSET_SELF_TRANSITION))
+    {
+        me->transition[instance] = 0;
+
+        if (states[prev].exit)
+        {
+            (*states[prev].exit)(me, instance);
+            ECU_ASSERT( (me->transition[instance] == 0) ); /* No state transitions allowed in exit handler. */
+        }
+
+        prev = me->state[instance];
+        if (states[prev].entry)
+        {
+            (*states[prev].entry)(me, instance);
+            ECU_ASSERT( (!transition_is_active(me, instance, FSMSET_SELF_TRANSITION)) ); /* Self-transition not allowed in entry handler. */
+        }
+    }
+
+    while (transition_is_active(me, instance, FSMSET_STATE_TRANSITION))
+    {
+        me->transition[instance] = 0;
+
+        if (states[prev].exit)
+        {
+            (*states[prev].exit)(me, instance);
+            ECU_ASSERT( (me->transition[instance] == 0) ); /* No state transitions allowed in exit handler. */
+        }
+
+        prev = me->state[instance];
+        if (states[prev].entry)
+        {
+            (*states[prev].entry)(me, instance);
+            ECU_ASSERT( (!transition_is_active(me, instance, FSMSET_SELF_TRANSITION)) ); /* Self-transition not allowed in entry handler. */
+        }
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------ FSMSET MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_fsmset_ctor(struct ecu_fsmset *me,
+                     const struct ecu_fsmset_state *states,
+                     ecu_fsmset_state_t state_count,
+                     ecu_fsmset_state_t initial,
+                     void *buffer,
+                     size_t size,
+                     size_t count)
+{
+    ECU_ASSERT( (me && states && buffer) );
+    ECU_ASSERT( (state_count > 0 && initial < state_count) );
+    ECU_ASSERT( (count > 0) );
+    ECU_ASSERT( (size >= ECU_FSMSET_BUFFER_SIZE(count, state_count)) );
+    uint8_t *start = (uint8_t *)buffer;
+    size_t padding = (size_t)((sizeof(size_t) - ((uintptr_t)start % sizeof(size_t))) % sizeof(size_t));
+
+    for (ecu_fsmset_state_t s = 0; s < state_count; s++)
+    {
+        ECU_ASSERT( (state_is_valid(&states[s])) );
+    }
+
+    /* Widest arrays first so every array is aligned. Cast through
+    (void *) since the padding already aligned the start. */
+    me->order = (size_t *)(void *)&start[padding];
+    me->offsets = &me->order[count];
+    me->state = (ecu_fsmset_state_t *)(void *)&me->offsets[state_count + 1U];
+    me->transition = (uint8_t *)&me->state[count];
+    me->states = states;
+    me->state_count = state_count;
+    me->count = count;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        me->state[i] = initial;
+        me->transition[i] = 0;
+    }
+
+    ecu_fsmset_group(me);
+}
+
+void ecu_fsmset_change_state(struct ecu_fsmset *me, size_t instance, ecu_fsmset_state_t state)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (instance < me->count) );
+    ECU_ASSERT( (me->transition[instance] == 0) ); /* Cannot call ecu_fsmset_change_state() multiple times in a row. Only one transition per dispatch. */
+    ECU_ASSERT( (state < me->state_count) );
+
+    if (me->state[instance] == state)
+    {
+        me->transition[instance] = (uint8_t)(1U << FSMSET_SELF_TRANSITION);
+    }
+    else
+    {
+        me->transition[instance] = (uint8_t)(1U << FSMSET_STATE_TRANSITION);
+        me->state[instance] = state;
+    }
+}
+
+ecu_fsmset_state_t ecu_fsmset_current_state(const struct ecu_fsmset *me, size_t instance)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (instance < me->count) );
+    return me->state[instance];
+}
+
+size_t ecu_fsmset_count(const struct ecu_fsmset *me)
+{
+    ECU_ASSERT( (me) );
+    return me->count;
+}
+
+void ecu_fsmset_broadcast(struct ecu_fsmset *me, const void *event)
+{
+    ECU_ASSERT( (me && event) );
+    ecu_fsmset_group(me);
+    ecu_fsmset_run(me, event, 0, 1);
+}
+
+void ecu_fsmset_group(struct ecu_fsmset *me)
+{
+    ECU_ASSERT( (me) );
+    const ecu_fsmset_state_t *state = me->state;
+    size_t *order = me->order;
+    size_t *offsets = me->offsets;
+    size_t count = me->count;
+    size_t i = 0;
+
+    /* Counting sort. Count each state into the slot after it, prefix sum
+    into group starts, then place instances while advancing the starts. The
+    starts end up one group ahead, so shift them back. Instances stay in
+    ascending order within every group. Neighbouring instances are usually
+    in the same state, so both passes work on runs of equal states to keep
+    the counters in registers. */
+    for (size_t s = 0; s <= me->state_count; s++)
+    {
+        offsets[s] = 0;
+    }
+
+    while (i < count)
+    {
+        size_t begin = i;
+        ecu_fsmset_state_t s = state[i];
+        ECU_ASSERT( (s < me->state_count) );
+
+        do
+        {
+            i++;
+        } while ((i < count) && (state[i] == s));
+
+        offsets[s + 1U] += i - begin;
+    }
+
+    for (size_t s = 1; s <= me->state_count; s++)
+    {
+        offsets[s] += offsets[s - 1];
+    }
+
+    i = 0;
+    while (i < count)
+    {
+        ecu_fsmset_state_t s = state[i];
+        size_t next = offsets[s];
+
+        do
+        {
+            order[next++] = i++;
+        } while ((i < count) && (state[i] == s));
+
+        offsets[s] = next;
+    }
+
+    for (size_t s = me->state_count; s > 0; s--)
+    {
+        offsets[s] = offsets[s - 1];
+    }
+    offsets[0] = 0;
+}
+
+void ecu_fsmset_run(struct ecu_fsmset *me, const void *event, size_t slice, size_t slices)
+{
+    ECU_ASSERT( (me && event) );
+    ECU_ASSERT( (slices > 0 && slice < slices) );
+
+    for (ecu_fsmset_state_t s = 0; s < me->state_count; s++)
+    {
+        /* Split the group evenly. The first (n % slices) slices get one extra instance. */
+        size_t n = me->offsets[s + 1U] - me->offsets[s];
+        size_t base = n / slices;
+        size_t extra = n % slices;
+        size_t begin = me->offsets[s] + (base * slice) + ((slice < extra) ? slice : extra);
+        size_t end = begin + base + ((slice < extra) ? 1U : 0U);
+
+        if (begin < end)
+        {
+            (*me->states[s].handler)(me, &me->order[begin], end - begin, event);
+
+            /* Most instances usually stay put, so only call into
+            run_transitions() for the ones that signalled something. */
+            for (size_t i = begin; i < end; i++)
+            {
+                if (me->transition[me->order[i]] != 0)
+                {
+                    run_transitions(me, me->order[i], s);
+                }
+            }
+        }
+    }
+}
+
+void ecu_fsmset_start(struct ecu_fsmset *me)
+{
+    ECU_ASSERT( (me) );
+
+    for (size_t i = 0; i < me->count; i++)
+    {
+        ECU_ASSERT( (me->transition[i] == 0) );
+        ecu_fsmset_state_t prev = me->state[i];
+
+        if (me->states[prev].entry)
+        {
+            (*me->states[prev].entry)(me, i);
+            ECU_ASSERT( (!transition_is_active(me, i, FSMSET_SELF_TRANSITION)) ); /* Self-transition not allowed in entry handler. */
+            run_transitions(me, i, prev);
+        }
+    }
+}
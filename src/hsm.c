@@ -112,6 +112,14 @@ static bool hsm_is_valid(const struct ecu_hsm *hsm);
  */
 static bool state_is_valid(const struct ecu_hsm_state *state);
 
+/**
+ * @brief Relays event to the current state, propagates it up
+ * the state hierarchy until handled and runs all state
+ * transitions it signals. Preconditions are checked by the
+ * caller so batches are only validated once.
+ */
+static void dispatch(struct ecu_hsm *me, const void *event);
+
 /*------------------------------------------------------------*/
 /*---------------------- STATIC ASSERTS ----------------------*/
 /*------------------------------------------------------------*/
@@ -252,50 +260,9 @@ static bool state_is_valid(const struct ecu_hsm_state *state)
     return status;
 }
 
-/*------------------------------------------------------------*/
-/*-------------------- HSM MEMBER FUNCTIONS ------------------*/
-/*------------------------------------------------------------*/
-
-void ecu_hsm_ctor(struct ecu_hsm *me,
-                  const struct ecu_hsm_state *state,
-                  uint8_t height)
-{
-    ECU_ASSERT( (me && state) );
-    ECU_ASSERT( (state != &ECU_HSM_TOP_STATE) );
-    ECU_ASSERT( (state_is_valid(state)) );
-    /* Do not assert state->initial == ECU_HSM_STATE_INITIAL since start state does not have to be leaf. */
-    ECU_ASSERT( (height > 0) );
-
-    me->state = state;
-    me->height = height;
-    me->transition = 0;
-}
-
-void ecu_hsm_change_state(struct ecu_hsm *me, const struct ecu_hsm_state *state)
-{
-    ECU_ASSERT( (me && state) );
-    ECU_ASSERT( (hsm_is_valid(me)) );
-    ECU_ASSERT( (0 == me->transition) ); /* Cannot call ecu_hsm_change_state() multiple times in a row. */
-    ECU_ASSERT( (state != &ECU_HSM_TOP_STATE) );
-    ECU_ASSERT( (state_is_valid(state)) );
-
-    if (me->state == state)
-    {
-        me->transition = (1U << HSM_SELF_TRANSITION);
-    }
-    else
-    {
-        me->transition = (1U << HSM_STATE_TRANSITION);
-        me->state = state;
-    }
-}
-
-void ecu_hsm_dispatch(struct ecu_hsm *me, const void *event)
+static void dispatch(struct ecu_hsm *me, const void *event)
 {
     ECU_ASSERT( (me && event) );
-    ECU_ASSERT( (hsm_is_valid(me)) ); /* Also asserts state_is_valid(me->state). */
-    ECU_ASSERT( (0 == me->transition) );
-    ECU_ASSERT( (me->state->initial == ECU_HSM_STATE_INITIAL_UNUSED) ); /* Must be in leaf state. */
     uint8_t height = 0;
     const struct ecu_hsm_state *source = me->state; /* Store starting state so full state trace can be calculated on transitions. */
     const struct ecu_hsm_state *super = me->state;  /* State that handled the event. */
@@ -410,6 +377,88 @@ void ecu_hsm_dispatch(struct ecu_hsm *me, const void *event)
     }
 }
 
+/*------------------------------------------------------------*/
+/*-------------------- HSM MEMBER FUNCTIONS ------------------*/
+/*------------------------------------------------------------*/
+
+void ecu_hsm_ctor(struct ecu_hsm *me,
+                  const struct ecu_hsm_state *state,
+                  uint8_t height)
+{
+    ECU_ASSERT( (me && state) );
+    ECU_ASSERT( (state != &ECU_HSM_TOP_STATE) );
+    ECU_ASSERT( (state_is_valid(state)) );
+    /* Do not assert state->initial == ECU_HSM_STATE_INITIAL since start state does not have to be leaf. */
+    ECU_ASSERT( (height > 0) );
+
+    me->state = state;
+    me->height = height;
+    me->transition = 0;
+}
+
+void ecu_hsm_change_state(struct ecu_hsm *me, const struct ecu_hsm_state *state)
+{
+    ECU_ASSERT( (me && state) );
+    ECU_ASSERT( (hsm_is_valid(me)) );
+    ECU_ASSERT( (0 == me->transition) ); /* Cannot call ecu_hsm_change_state() multiple times in a row. */
+    ECU_ASSERT( (state != &ECU_HSM_TOP_STATE) );
+    ECU_ASSERT( (state_is_valid(state)) );
+
+    if (me->state == state)
+    {
+        me->transition = (1U << HSM_SELF_TRANSITION);
+    }
+    else
+    {
+        me->transition = (1U << HSM_STATE_TRANSITION);
+        me->state = state;
+    }
+}
+
+void ecu_hsm_dispatch(struct ecu_hsm *me, const void *event)
+{
+    ECU_ASSERT( (me && event) );
+    ECU_ASSERT( (hsm_is_valid(me)) ); /* Also asserts state_is_valid(me->state). */
+    ECU_ASSERT( (0 == me->transition) );
+    ECU_ASSERT( (me->state->initial == ECU_HSM_STATE_INITIAL_UNUSED) ); /* Must be in leaf state. */
+    dispatch(me, event);
+}
+
+void ecu_hsm_dispatch_array(struct ecu_hsm *me, const void *events, size_t count, size_t size)
+{
+    ECU_ASSERT( (me && events) );
+    ECU_ASSERT( (size > 0) );
+    ECU_ASSERT( (hsm_is_valid(me)) ); /* Also asserts state_is_valid(me->state). */
+    ECU_ASSERT( (0 == me->transition) );
+    ECU_ASSERT( (me->state->initial == ECU_HSM_STATE_INITIAL_UNUSED) ); /* Must be in leaf state. */
+    const uint8_t *event = (const uint8_t *)events;
+
+    /* Every dispatch leaves the hsm in a valid leaf state with no
+    active transitions, so the preconditions checked above still
+    hold for the next event. */
+    for (size_t i = 0; i < count; i++)
+    {
+        dispatch(me, (const void *)event);
+        event += size;
+    }
+}
+
+void ecu_hsm_dispatch_list(struct ecu_hsm *me, const struct ecu_dlist *events, size_t node_offset)
+{
+    ECU_ASSERT( (me && events) );
+    ECU_ASSERT( (hsm_is_valid(me)) ); /* Also asserts state_is_valid(me->state). */
+    ECU_ASSERT( (0 == me->transition) );
+    ECU_ASSERT( (me->state->initial == ECU_HSM_STATE_INITIAL_UNUSED) ); /* Must be in leaf state. */
+    struct ecu_dlist_citerator citerator;
+
+    /* Handlers receive the user's event that contains each node,
+    the same type they receive from the other dispatch functions. */
+    ECU_DLIST_CONST_FOR_EACH(node, &citerator, events)
+    {
+        dispatch(me, (const void *)((const uint8_t *)node - node_offset));
+    }
+}
+
 void ecu_hsm_start(struct ecu_hsm *me)
 {
     ECU_ASSERT( (me) );
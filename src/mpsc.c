@@ -0,0 +1,201 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`mpsc.h section <mpsc_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/mpsc.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Runtime asserts. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/mpsc.c")
+
+/* Module requires GNU atomic builtins. Nothing is compiled with
+other compilers so the rest of ECU still builds. */
+#if defined(__GNUC__)
+/*------------------------------------------------------------*/
+/*---------------------------- DEFINES -----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Atomically stores @p val_ into @p ptr_ and returns
+ * the previous value. Full acquire-release ordering.
+ */
+#define ATOMIC_EXCHANGE(ptr_, val_) \
+    (__atomic_exchange_n((ptr_), (val_), __ATOMIC_ACQ_REL))
+
+/**
+ * @brief Atomically loads @p ptr_ with acquire ordering.
+ */
+#define ATOMIC_LOAD(ptr_) \
+    (__atomic_load_n((ptr_), __ATOMIC_ACQUIRE))
+
+/**
+ * @brief Atomically stores @p val_ into @p ptr_ with release ordering.
+ */
+#define ATOMIC_STORE(ptr_, val_) \
+    (__atomic_store_n((ptr_), (val_), __ATOMIC_RELEASE))
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Links @p node to the back of the queue. Shared by
+ * @ref ecu_mpsc_push() and the consumer, which re-pushes the
+ * stub node. Does not validate @p node.
+ */
+static void enqueue(struct ecu_mpsc *me, struct ecu_dnode *node);
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static void enqueue(struct ecu_mpsc *me, struct ecu_dnode *node)
+{
+    ECU_ASSERT( (me && node) );
+    struct ecu_dnode *prev = (struct ecu_dnode *)0;
+
+    /* Node becomes the new head before it is linked to the previous head.
+    The consumer sees a NULL next pointer in the meantime and treats the
+    queue as temporarily blocked, which is what keeps push wait-free. */
+    ATOMIC_STORE(&node->next, (struct ecu_dnode *)0);
+    prev = ATOMIC_EXCHANGE(&me->head, node);
+    ATOMIC_STORE(&prev->next, node);
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- MPSC MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_mpsc_ctor(struct ecu_mpsc *me)
+{
+    ECU_ASSERT( (me) );
+
+    /* Do not use ecu_dnode_ctor() on the stub. It is given a reserved ID so
+    it can never be passed into dnode and dlist functions. */
+    me->stub.next = (struct ecu_dnode *)0;
+    me->stub.prev = (struct ecu_dnode *)0;
+    me->stub.destroy = ECU_DNODE_DESTROY_UNUSED;
+    me->stub.id = ECU_OBJECT_ID_RESERVED;
+    me->head = &me->stub;
+    me->tail = &me->stub;
+}
+
+size_t ecu_mpsc_drain(struct ecu_mpsc *me, struct ecu_dlist *list)
+{
+    ECU_ASSERT( (me && list) );
+    ECU_ASSERT( (ecu_dlist_valid(list)) );
+    size_t count = 0;
+    struct ecu_dnode *node = ecu_mpsc_pop(me);
+
+    while (node)
+    {
+        ecu_dlist_push_back(list, node);
+        ++count;
+        node = ecu_mpsc_pop(me);
+    }
+
+    return count;
+}
+
+bool ecu_mpsc_empty(const struct ecu_mpsc *me)
+{
+    ECU_ASSERT( (me) );
+    bool status = false;
+
+    if ((me->tail == &me->stub) &&
+        (ATOMIC_LOAD(&me->stub.next) == (struct ecu_dnode *)0) &&
+        (ATOMIC_LOAD(&me->head) == &me->stub))
+    {
+        status = true;
+    }
+
+    return status;
+}
+
+struct ecu_dnode *ecu_mpsc_pop(struct ecu_mpsc *me)
+{
+    ECU_ASSERT( (me) );
+    struct ecu_dnode *node = (struct ecu_dnode *)0;
+    struct ecu_dnode *tail = me->tail;
+    struct ecu_dnode *next = ATOMIC_LOAD(&tail->next);
+
+    /* Skip over the stub if it is at the front of the queue. */
+    if ((tail == &me->stub) && (next))
+    {
+        me->tail = next;
+        tail = next;
+        next = ATOMIC_LOAD(&next->next);
+    }
+
+    if (tail != &me->stub)
+    {
+        if (next)
+        {
+            /* Common case. Tail has a successor so it can be popped without
+            interacting with producers. */
+            me->tail = next;
+            node = tail;
+        }
+        else if (tail == ATOMIC_LOAD(&me->head))
+        {
+            /* Tail is the last node. Re-push the stub behind it so tail
+            gets a successor and can be detached. */
+            enqueue(me, &me->stub);
+            next = ATOMIC_LOAD(&tail->next);
+
+            if (next)
+            {
+                me->tail = next;
+                node = tail;
+            }
+        }
+        /* Otherwise a producer exchanged head but has not linked it in yet.
+        Report an empty queue. The node is returned on a future call. */
+    }
+
+    if (node)
+    {
+        /* Node is now owned by the user again. Restore it to a
+        valid, not-in-list state. */
+        node->next = node;
+        node->prev = node;
+    }
+
+    return node;
+}
+
+void ecu_mpsc_push(struct ecu_mpsc *me, struct ecu_dnode *node)
+{
+    ECU_ASSERT( (me && node) );
+    ECU_ASSERT( (ecu_dnode_valid(node)) );
+    ECU_ASSERT( (!ecu_dnode_in_list(node)) );
+
+    /* Invalidate while owned by the queue so dnode and dlist functions
+    assert if the user attempts to access it before it is popped. */
+    node->prev = (struct ecu_dnode *)0;
+    enqueue(me, node);
+}
+#endif /* __GNUC__ */
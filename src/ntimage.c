@@ -0,0 +1,263 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ntimage.h section <ntimage_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/ntimage.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* ECU. */
+#include "ecu/asserter.h"
+#include "ecu/endian.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/ntimage.c")
+
+/*------------------------------------------------------------*/
+/*---------------------------- DEFINES -----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief First word of every image. Reads "ECUT" in memory. Change
+ * this if the layout of the image ever changes so old images are
+ * rejected instead of misread.
+ */
+#define MAGIC \
+    ((uint32_t)0x54554345)
+
+/**
+ * @brief Parent index stored in the root's record.
+ */
+#define NO_PARENT \
+    ((uint32_t)0xFFFFFFFF)
+
+/**
+ * @brief Byte offsets of each field in the header.
+ */
+#define HEADER_MAGIC (0U)
+#define HEADER_COUNT (4U)
+#define HEADER_PAYLOAD_SIZE (8U)
+
+/**
+ * @brief Byte offsets of each field in a node record.
+ */
+#define RECORD_ID (0U)
+#define RECORD_PARENT (4U)
+#define RECORD_PAYLOAD (8U)
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Reads a little endian word. @p src does not have to be aligned.
+ */
+static uint32_t get32(const uint8_t *src);
+
+/**
+ * @brief Writes a little endian word. @p dest does not have to be aligned.
+ */
+static void put32(uint8_t *dest, uint32_t value);
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static uint32_t get32(const uint8_t *src)
+{
+    ECU_ASSERT( (src) );
+    uint32_t value = 0;
+
+    /* Compiles down to a single load on targets that allow unaligned access. */
+    memcpy(&value, src, sizeof(value));
+    return ECU_LE32_TO_CPU_RUNTIME(value);
+}
+
+static void put32(uint8_t *dest, uint32_t value)
+{
+    ECU_ASSERT( (dest) );
+    uint32_t le = ECU_CPU_TO_LE32_RUNTIME(value);
+    memcpy(dest, &le, sizeof(le));
+}
+
+/*------------------------------------------------------------*/
+/*----------------- NTIMAGE MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+size_t ecu_ntimage_count(const void *image, size_t size)
+{
+    ECU_ASSERT( (image) );
+    const uint8_t *header = (const uint8_t *)image;
+    size_t count = 0;
+
+    /* Images usually come from storage, so a short or foreign image is a
+    runtime failure instead of an assert. */
+    if ((size >= ECU_NTIMAGE_HEADER_SIZE) && (get32(&header[HEADER_MAGIC]) == MAGIC))
+    {
+        count = (size_t)get32(&header[HEADER_COUNT]);
+    }
+
+    return count;
+}
+
+struct ecu_ntnode *ecu_ntimage_load(const void *image,
+                                    size_t size,
+                                    struct ecu_ntnode *const *nodes,
+                                    size_t capacity,
+                                    void (*destroy)(struct ecu_ntnode *me, ecu_object_id_t id),
+                                    void (*load)(struct ecu_ntnode *node, const void *payload, void *obj),
+                                    void *obj)
+{
+    ECU_ASSERT( (image && nodes) );
+    size_t count = ecu_ntimage_count(image, size);
+    const uint8_t *record = (const uint8_t *)image + ECU_NTIMAGE_HEADER_SIZE;
+    struct ecu_ntnode *root = (struct ecu_ntnode *)0;
+
+    /* Only check the image as a whole, even if asserts are disabled, so nothing
+    is read or written out of bounds. Records are trusted afterwards. */
+    if ((count > 0) && (count <= capacity))
+    {
+        size_t payload_size = (size_t)get32((const uint8_t *)image + HEADER_PAYLOAD_SIZE);
+        size_t available = size - ECU_NTIMAGE_HEADER_SIZE;
+
+        /* Payload size is bounded first so a corrupt value cannot overflow the record size. */
+        if ((payload_size <= available) &&
+            ((available / ECU_NTIMAGE_RECORD_SIZE(payload_size)) >= count))
+        {
+            size_t record_size = ECU_NTIMAGE_RECORD_SIZE(payload_size);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                struct ecu_ntnode *node = nodes[i];
+                ecu_ntnode_ctor(node, destroy, (ecu_object_id_t)(int32_t)get32(&record[RECORD_ID]));
+
+                if (i > 0)
+                {
+                    /* Preorder so parent was already loaded. */
+                    size_t parent = (size_t)get32(&record[RECORD_PARENT]);
+                    ECU_ASSERT( (parent < i) );
+                    ecu_ntnode_push_child_back(nodes[parent], node);
+                }
+
+                if (load)
+                {
+                    (*load)(node, &record[RECORD_PAYLOAD], obj);
+                }
+
+                record += record_size;
+            }
+
+            root = nodes[0];
+        }
+    }
+
+    return root;
+}
+
+size_t ecu_ntimage_save(void *image,
+                        size_t capacity,
+                        const struct ecu_ntnode *root,
+                        size_t payload_size,
+                        void (*save)(const struct ecu_ntnode *node, void *payload, void *obj),
+                        void *obj)
+{
+    ECU_ASSERT( (image && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    ECU_ASSERT( (save || (payload_size == 0)) );
+    ECU_ASSERT( (payload_size <= UINT32_MAX) );
+    uint8_t *start = (uint8_t *)image;
+    uint8_t *records = start + ECU_NTIMAGE_HEADER_SIZE;
+    size_t record_size = ECU_NTIMAGE_RECORD_SIZE(payload_size);
+    size_t available = 0;
+    const struct ecu_ntnode *node = root;
+    uint32_t parent = NO_PARENT;
+    size_t count = 0;
+    size_t bytes = 0;
+    bool done = false;
+
+    if (capacity >= ECU_NTIMAGE_HEADER_SIZE)
+    {
+        available = (capacity - ECU_NTIMAGE_HEADER_SIZE) / record_size;
+    }
+
+    /* Preorder walk. The parent of the next record is tracked as an index. When
+    climbing out of a subtree, the new parent's index is read back from the record
+    of the old parent, so no stack is needed. The walk stops early if the buffer
+    fills up before every node is saved, even if asserts are disabled. */
+    while ((!done) && (count < available))
+    {
+        ECU_ASSERT( (count < NO_PARENT) );
+        uint8_t *record = &records[count * record_size];
+        put32(&record[RECORD_ID], (uint32_t)ecu_ntnode_id(node));
+        put32(&record[RECORD_PARENT], parent);
+
+        if (save)
+        {
+            (*save)(node, &record[RECORD_PAYLOAD], obj);
+        }
+
+        if (!ecu_ntnode_is_leaf(node))
+        {
+            parent = (uint32_t)count;
+            node = ecu_ntnode_first_cchild(node);
+        }
+        else
+        {
+            while ((node != root) && !ecu_ntnode_cnext(node))
+            {
+                node = ecu_ntnode_cparent(node);
+                parent = get32(&records[(size_t)parent * record_size] + RECORD_PARENT);
+            }
+
+            if (node == root)
+            {
+                done = true;
+            }
+            else
+            {
+                node = ecu_ntnode_cnext(node);
+            }
+        }
+
+        count++;
+    }
+
+    /* Header is only written once every node fit. */
+    if (done)
+    {
+        put32(&start[HEADER_MAGIC], MAGIC);
+        put32(&start[HEADER_COUNT], (uint32_t)count);
+        put32(&start[HEADER_PAYLOAD_SIZE], (uint32_t)payload_size);
+        bytes = ECU_NTIMAGE_SIZE(count, payload_size);
+    }
+
+    return bytes;
+}
+
+size_t ecu_ntimage_size(const struct ecu_ntnode *root, size_t payload_size)
+{
+    ECU_ASSERT( (root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    return ECU_NTIMAGE_SIZE(ecu_ntnode_size(root) + 1, payload_size);
+}
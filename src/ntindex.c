@@ -0,0 +1,464 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ntindex.h section <ntindex_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/ntindex.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Runtime asserts. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/ntindex.c")
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Returns true if index @p j is in the subtree of index
+ * @p i. Every index is in its own subtree.
+ */
+static bool covers(const struct ecu_ntindex *me, size_t i, size_t j);
+
+/**
+ * @pre nodes[0] to nodes[i] already stored. Indices 0 to i-1 are placed.
+ * @brief Stores parent and depth of index @p i, and closes the
+ * subtrees of every index passed over while finding its parent.
+ */
+static void place(struct ecu_ntindex *me, size_t i);
+
+/**
+ * @brief Returns the first node of subtree @p i in postorder,
+ * which is reached by following first children down to a leaf.
+ */
+static size_t first_leaf(const struct ecu_ntindex *me, size_t i);
+
+/**
+ * @brief Fills the binary lifting table from the parent array.
+ * Does nothing if no table was supplied.
+ */
+static void fill_jumps(struct ecu_ntindex *me);
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static bool covers(const struct ecu_ntindex *me, size_t i, size_t j)
+{
+    ECU_ASSERT( (me) );
+    return ((i <= j) && (j < me->ends[i]));
+}
+
+static void place(struct ecu_ntindex *me, size_t i)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (i < me->capacity) );
+
+    if (i == 0)
+    {
+        me->parents[0] = 0;
+        me->depths[0] = 0;
+    }
+    else
+    {
+        /* Parent is on the path from the previous node up to the root. Every node stepped
+        over on the way has no more descendants left, so its subtree ends here. Each node
+        is stepped over once so the whole build stays O(n). */
+        const struct ecu_ntnode *parent = ecu_ntnode_cparent(me->nodes[i]);
+        size_t p = i - 1;
+
+        while (me->nodes[p] != parent)
+        {
+            me->ends[p] = i;
+            p = me->parents[p];
+        }
+
+        me->parents[i] = p;
+        me->depths[i] = me->depths[p] + 1;
+    }
+}
+
+static size_t first_leaf(const struct ecu_ntindex *me, size_t i)
+{
+    ECU_ASSERT( (me) );
+    size_t leaf = i;
+
+    /* First child always directly follows its parent in preorder. */
+    while ((leaf + 1) < me->ends[leaf])
+    {
+        leaf++;
+    }
+
+    return leaf;
+}
+
+static void fill_jumps(struct ecu_ntindex *me)
+{
+    ECU_ASSERT( (me) );
+
+    if (me->jumps)
+    {
+        const size_t *prev = me->parents;
+
+        /* Row k is the 2^(k+1)th ancestor, which is two hops along the previous row. */
+        for (size_t k = 0; k < me->levels; k++)
+        {
+            size_t *row = &me->jumps[k * me->capacity];
+
+            for (size_t i = 0; i < me->size; i++)
+            {
+                row[i] = prev[prev[i]];
+            }
+
+            prev = row;
+        }
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------- NTINDEX MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_ntindex_ctor(struct ecu_ntindex *me,
+                      struct ecu_ntnode **nodes,
+                      size_t *ends,
+                      size_t *parents,
+                      size_t *depths,
+                      size_t capacity)
+{
+    ECU_ASSERT( (me && nodes && ends && parents && depths) );
+    ECU_ASSERT( (capacity > 0) );
+
+    me->nodes = nodes;
+    me->ends = ends;
+    me->parents = parents;
+    me->depths = depths;
+    me->jumps = (size_t *)0;
+    me->levels = 0;
+    me->capacity = capacity;
+    me->size = 0;
+}
+
+size_t ecu_ntindex_build(struct ecu_ntindex *me,
+                         struct ecu_ntnode *root,
+                         void (*assign)(struct ecu_ntnode *node, size_t index, void *obj),
+                         void *obj)
+{
+    ECU_ASSERT( (me && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    size_t i = 0;
+    struct ecu_ntnode_compact_preorder_iterator iter;
+
+#if defined(ECU_NTNODE_COUNTED)
+    ECU_ASSERT( (ecu_ntnode_size(root) < me->capacity) );
+#endif
+
+    ECU_NTNODE_COMPACT_PREORDER_FOR_EACH(n, &iter, root)
+    {
+        ECU_ASSERT( (i < me->capacity) );
+        me->nodes[i] = n;
+
+        place(me, i);
+
+        if (assign)
+        {
+            (*assign)(n, i, obj);
+        }
+
+        i++;
+    }
+
+    /* Close subtrees still open on the path from the last node up to the root. */
+    for (size_t p = i - 1; p != 0; p = me->parents[p])
+    {
+        me->ends[p] = i;
+    }
+
+    me->ends[0] = i;
+    me->size = i;
+    fill_jumps(me);
+
+    return i;
+}
+
+size_t ecu_ntindex_end(const struct ecu_ntindex *me, size_t i)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (i < me->size) );
+    return (me->ends[i]);
+}
+
+size_t ecu_ntindex_depth(const struct ecu_ntindex *me, size_t i)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (i < me->size) );
+    return (me->depths[i]);
+}
+
+bool ecu_ntindex_is_ancestor(const struct ecu_ntindex *me, size_t a, size_t i)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (a < me->size && i < me->size) );
+    return ((a != i) && covers(me, a, i));
+}
+
+size_t ecu_ntindex_lca(const struct ecu_ntindex *me, size_t i, size_t j)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (i < me->size && j < me->size) );
+    size_t lca = 0;
+
+    if (covers(me, i, j))
+    {
+        lca = i;
+    }
+    else if (covers(me, j, i))
+    {
+        lca = j;
+    }
+    else
+    {
+        /* Lift i to the highest ancestor that does not contain j. Its parent is the LCA.
+        The root contains every node so each loop is guaranteed to stop. */
+        size_t a = i;
+
+        if (me->jumps)
+        {
+            const size_t *top = &me->jumps[(me->levels - 1) * me->capacity];
+
+            while (!covers(me, top[a], j))
+            {
+                a = top[a];
+            }
+
+            for (size_t k = me->levels - 1; k > 0; k--)
+            {
+                const size_t *row = &me->jumps[(k - 1) * me->capacity];
+
+                if (!covers(me, row[a], j))
+                {
+                    a = row[a];
+                }
+            }
+        }
+
+        /* At most one step if a jump table is used. */
+        while (!covers(me, me->parents[a], j))
+        {
+            a = me->parents[a];
+        }
+
+        lca = me->parents[a];
+    }
+
+    return lca;
+}
+
+struct ecu_ntnode *ecu_ntindex_node(const struct ecu_ntindex *me, size_t i)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (i < me->size) );
+    return (me->nodes[i]);
+}
+
+size_t ecu_ntindex_parent(const struct ecu_ntindex *me, size_t i)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (i < me->size) );
+    size_t parent = ECU_NTINDEX_NONE;
+
+    if (i != 0)
+    {
+        parent = me->parents[i];
+    }
+
+    return parent;
+}
+
+void ecu_ntindex_set_jump_table(struct ecu_ntindex *me, size_t *jumps, size_t levels)
+{
+    ECU_ASSERT( (me && jumps) );
+    ECU_ASSERT( (levels > 0) );
+
+    me->jumps = jumps;
+    me->levels = levels;
+    fill_jumps(me);
+}
+
+size_t ecu_ntindex_size(const struct ecu_ntindex *me)
+{
+    ECU_ASSERT( (me) );
+    return (me->size);
+}
+
+/*------------------------------------------------------------*/
+/*---------------- ITERATOR MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+size_t ecu_ntindex_preorder_iterator_begin(struct ecu_ntindex_iterator *me,
+                                           const struct ecu_ntindex *index,
+                                           size_t root)
+{
+    ECU_ASSERT( (me && index) );
+    ECU_ASSERT( (root < index->size) );
+
+    me->index = index;
+    me->root = root;
+    me->current = root;
+    me->next = root + 1;
+
+    return (me->current);
+}
+
+size_t ecu_ntindex_preorder_iterator_next(struct ecu_ntindex_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current != ECU_NTINDEX_NONE) );
+
+    if (me->next < me->index->ends[me->root])
+    {
+        me->current = me->next;
+        me->next = me->current + 1;
+    }
+    else
+    {
+        me->current = ECU_NTINDEX_NONE;
+    }
+
+    return (me->current);
+}
+
+void ecu_ntindex_preorder_iterator_skip(struct ecu_ntindex_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current != ECU_NTINDEX_NONE) );
+    me->next = me->index->ends[me->current];
+}
+
+size_t ecu_ntindex_postorder_iterator_begin(struct ecu_ntindex_iterator *me,
+                                            const struct ecu_ntindex *index,
+                                            size_t root)
+{
+    ECU_ASSERT( (me && index) );
+    ECU_ASSERT( (root < index->size) );
+
+    me->index = index;
+    me->root = root;
+    me->current = first_leaf(index, root);
+    me->next = ECU_NTINDEX_NONE;
+
+    return (me->current);
+}
+
+size_t ecu_ntindex_postorder_iterator_next(struct ecu_ntindex_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current != ECU_NTINDEX_NONE) );
+    const struct ecu_ntindex *index = me->index;
+
+    if (me->current == me->root)
+    {
+        me->current = ECU_NTINDEX_NONE;
+    }
+    else
+    {
+        /* Next sibling starts where the current subtree ends, if it is still
+        inside the parent's subtree. Otherwise all siblings are done so the
+        parent is next. */
+        size_t parent = index->parents[me->current];
+        size_t sibling = index->ends[me->current];
+
+        if (sibling < index->ends[parent])
+        {
+            me->current = first_leaf(index, sibling);
+        }
+        else
+        {
+            me->current = parent;
+        }
+    }
+
+    return (me->current);
+}
+
+size_t ecu_ntindex_child_iterator_begin(struct ecu_ntindex_iterator *me,
+                                        const struct ecu_ntindex *index,
+                                        size_t parent)
+{
+    ECU_ASSERT( (me && index) );
+    ECU_ASSERT( (parent < index->size) );
+
+    me->index = index;
+    me->root = parent;
+    me->current = ECU_NTINDEX_NONE;
+    me->next = ECU_NTINDEX_NONE;
+
+    if ((parent + 1) < index->ends[parent])
+    {
+        me->current = parent + 1;
+    }
+
+    return (me->current);
+}
+
+size_t ecu_ntindex_child_iterator_next(struct ecu_ntindex_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current != ECU_NTINDEX_NONE) );
+    size_t sibling = me->index->ends[me->current];
+
+    if (sibling < me->index->ends[me->root])
+    {
+        me->current = sibling;
+    }
+    else
+    {
+        me->current = ECU_NTINDEX_NONE;
+    }
+
+    return (me->current);
+}
+
+size_t ecu_ntindex_parent_iterator_begin(struct ecu_ntindex_iterator *me,
+                                         const struct ecu_ntindex *index,
+                                         size_t start)
+{
+    ECU_ASSERT( (me && index) );
+    ECU_ASSERT( (start < index->size) );
+
+    me->index = index;
+    me->root = 0;
+    me->current = ecu_ntindex_parent(index, start);
+    me->next = ECU_NTINDEX_NONE;
+
+    return (me->current);
+}
+
+size_t ecu_ntindex_parent_iterator_next(struct ecu_ntindex_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current != ECU_NTINDEX_NONE) );
+    me->current = ecu_ntindex_parent(me->index, me->current);
+    return (me->current);
+}
@@ -57,17 +57,6 @@ ECU_ASSERT_DEFINE_FILE("ecu/ntnode.c")
  */
 static void invalidate_delimiter(struct ecu_ntnode *ntnode);
 
-/**
- * @pre @p parent and @p child previously constructed via @ref ecu_ntnode_ctor().
- * @brief Returns true if @p parent is a parent, grandparent,
- * great-grandparent, etc of @p child. False otherwise.
- *
- * @param parent Function returns true if this node is a parent,
- * grandparent, great-grandparent, etc of @p child.
- * @param child Child node to check.
- */
-static bool is_parent_of(const struct ecu_ntnode *parent, const struct ecu_ntnode *child);
-
 /**
  * @pre @p ntnode previously constructed via @ref ecu_ntnode_ctor().
  * @brief Returns the left-most leaf of subtree @p ntnode. If @p ntnode
@@ -82,6 +71,163 @@ static struct ecu_ntnode *get_leaf(struct ecu_ntnode *ntnode);
  */
 static const struct ecu_ntnode *get_cleaf(const struct ecu_ntnode *ntnode);
 
+/**
+ * @brief Removes @p ntnode from its sibling list without updating
+ * any cached counts, and makes it a root. Only used when the entire
+ * subtree is being taken apart.
+ */
+static void detach(struct ecu_ntnode *ntnode);
+
+/**
+ * @brief Removes @p ntnode from its parent and makes it a root with
+ * its subtree intact. Cached counts of the old ancestors are updated.
+ * Cached levels of the subtree are left for the caller, which either
+ * relinks the subtree or relevels it.
+ */
+static void unlink_subtree(struct ecu_ntnode *ntnode);
+
+/**
+ * @pre @p child was just linked under its parent.
+ * @brief Updates cached counts and levels, the parent's index and
+ * dirty flags for a subtree that was just linked.
+ */
+static void link_subtree(struct ecu_ntnode *child);
+
+#if defined(ECU_NTNODE_COUNTED)
+/**
+ * @pre @p child was just linked under its parent.
+ * @brief Adds @p child's subtree to the cached counts of its
+ * ancestors and relevels the subtree.
+ */
+static void counted_link(struct ecu_ntnode *child);
+
+/**
+ * @pre @p child is still linked under its parent.
+ * @brief Subtracts @p child's subtree from the cached counts of
+ * its ancestors. Subtree is releveled by caller after @p child
+ * is unlinked.
+ */
+static void counted_unlink(struct ecu_ntnode *child);
+
+/**
+ * @brief Shifts cached levels of every node in subtree @p root
+ * so that @p root is at @p level.
+ */
+static void counted_relevel(struct ecu_ntnode *root, size_t level);
+#endif /* ECU_NTNODE_COUNTED */
+
+#if defined(ECU_NTNODE_DIRTY)
+/**
+ * @brief Returns the first dirty node in the sibling list starting
+ * at @p start, including @p start. Returns NULL if @p start is NULL
+ * or no remaining sibling is dirty.
+ */
+static struct ecu_ntnode *first_dirty(struct ecu_ntnode *start);
+#endif /* ECU_NTNODE_DIRTY */
+
+#if defined(ECU_NTNODE_INDEXED)
+/**
+ * @brief Returns the slot a node with @p id would be stored
+ * in if there were no collisions.
+ */
+static size_t index_home(const struct ecu_ntnode_index *index, ecu_object_id_t id);
+
+/**
+ * @brief Empties every slot of @p index.
+ */
+static void index_clear(struct ecu_ntnode_index *index);
+
+/**
+ * @pre @p child was just linked under its parent.
+ * @brief Adds @p child to its parent's index. Does nothing
+ * if the parent has no index.
+ */
+static void index_link(struct ecu_ntnode *child);
+
+/**
+ * @pre @p child is still linked under its parent.
+ * @brief Removes @p child from its parent's index. Does nothing
+ * if @p child is a root or the parent has no index.
+ */
+static void index_unlink(struct ecu_ntnode *child);
+#endif /* ECU_NTNODE_INDEXED */
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+/**
+ * @brief Returns true if @p ntnode belongs to a tree that was
+ * cleared via @ref ecu_ntnode_fast_clear() and was not used since.
+ * Its links still point into the old tree.
+ */
+static bool stale(const struct ecu_ntnode *ntnode);
+
+/**
+ * @brief Resets a stale node to an empty root so it can be used
+ * again. Its old children are not visited since they are stale too.
+ * Does nothing if @p ntnode is not stale.
+ */
+static void revive(struct ecu_ntnode *ntnode);
+
+/**
+ * @brief Stamps every node in subtree @p root with @p epoch and
+ * @p generation. Skipped if @p root already has this stamp since
+ * all nodes in a subtree always share the same stamp.
+ */
+static void epoch_stamp(struct ecu_ntnode *root,
+                        struct ecu_ntnode_epoch *epoch,
+                        uint64_t generation);
+#endif /* ECU_NTNODE_FAST_CLEAR */
+
+/**
+ * @brief Returns true if the links of @p ntnode can be followed.
+ * False if @p ntnode is stale since its links still point into a
+ * tree cleared via @ref ecu_ntnode_fast_clear(). Always true if
+ * @ref ECU_NTNODE_FAST_CLEAR is not defined.
+ */
+static bool live(const struct ecu_ntnode *ntnode);
+
+/**
+ * @brief Returns the node after @p node in a postorder iteration
+ * over @p root. Returns NULL if @p node is @p root. Used by
+ * the compact postorder iterator.
+ *
+ * @param root Root of tree being iterated over.
+ * @param node Current node in the iteration.
+ */
+static struct ecu_ntnode *compact_postorder_successor(struct ecu_ntnode *root,
+                                                      struct ecu_ntnode *node);
+
+/**
+ * @brief Const-qualified version of @ref compact_postorder_successor().
+ * See @ref compact_postorder_successor().
+ */
+static const struct ecu_ntnode *compact_postorder_csuccessor(const struct ecu_ntnode *root,
+                                                             const struct ecu_ntnode *node);
+
+/**
+ * @brief Returns the node after @p node in a level-order iteration
+ * over @p root that is in the same level as @p node. Returns NULL
+ * if @p node is the last node in its level. Found by walking the
+ * tree in preorder without descending past @p level, so this is
+ * O(level) in the worst case and levels above @p node are walked
+ * again for every level. A full level-order iteration is therefore
+ * O(n * height).
+ *
+ * @param root Root of tree being iterated over.
+ * @param node Current node in the iteration.
+ * @param level Level of @p node relative to @p root.
+ */
+static struct ecu_ntnode *levelorder_successor(struct ecu_ntnode *root,
+                                               struct ecu_ntnode *node,
+                                               size_t level);
+
+/**
+ * @brief Const-qualified version of @ref levelorder_successor().
+ * See @ref levelorder_successor().
+ */
+static const struct ecu_ntnode *levelorder_csuccessor(const struct ecu_ntnode *root,
+                                                      const struct ecu_ntnode *node,
+                                                      size_t level);
+
 /*------------------------------------------------------------*/
 /*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
 /*------------------------------------------------------------*/
@@ -97,27 +243,6 @@ static void invalidate_delimiter(struct ecu_ntnode *ntnode)
     ntnode->destroy = ECU_NTNODE_DESTROY_UNUSED;
 }
 
-static bool is_parent_of(const struct ecu_ntnode *parent, const struct ecu_ntnode *child)
-{
-    ECU_ASSERT( (parent && child) );
-    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
-    ECU_ASSERT( (ecu_ntnode_valid(child)) );
-    bool status = false;
-    struct ecu_ntnode_parent_citerator citer;
-
-    /* Use at iterator to handle the case where child == parent. */
-    ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, child)
-    {
-        if (n == parent)
-        {
-            status = true;
-            break;
-        }
-    }
-
-    return status;
-}
-
 static struct ecu_ntnode *get_leaf(struct ecu_ntnode *ntnode)
 {
     ECU_ASSERT( (ntnode) );
@@ -152,660 +277,2171 @@ static const struct ecu_ntnode *get_cleaf(const struct ecu_ntnode *ntnode)
     return leaf;
 }
 
-/*------------------------------------------------------------*/
-/*------------------ NTNODE MEMBER FUNCTIONS -----------------*/
-/*------------------------------------------------------------*/
-
-void ecu_ntnode_ctor(struct ecu_ntnode *me,
-                     void (*destroy)(struct ecu_ntnode *me, ecu_object_id_t id),
-                     ecu_object_id_t id)
+static struct ecu_ntnode *compact_postorder_successor(struct ecu_ntnode *root,
+                                                      struct ecu_ntnode *node)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (id >= ECU_VALID_OBJECT_ID_BEGIN) );
+    ECU_ASSERT( (root && node) );
+    struct ecu_ntnode *next = NTNODE_NULL;
 
-    ecu_dnode_ctor(&me->dnode, ECU_DNODE_DESTROY_UNUSED, id);
-    ecu_dlist_ctor(&me->children);
-    me->parent = me;
-    me->destroy = destroy;
+    /* Branches MUST be in this order!! */
+    if (node != root)
+    {
+        next = ecu_ntnode_next(node);
+
+        if (next)
+        {
+            next = get_leaf(next);
+        }
+        else
+        {
+            /* It should be impossible for parent to be NULL if this branch enters. */
+            next = ecu_ntnode_parent(node);
+            ECU_ASSERT( (next) );
+        }
+    }
+
+    return next;
 }
 
-void ecu_ntnode_destroy(struct ecu_ntnode *me)
+static const struct ecu_ntnode *compact_postorder_csuccessor(const struct ecu_ntnode *root,
+                                                             const struct ecu_ntnode *node)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    struct ecu_ntnode_postorder_iterator iter;
-    ecu_object_id_t id = ECU_OBJECT_ID_UNUSED;
+    ECU_ASSERT( (root && node) );
+    const struct ecu_ntnode *next = NTNODE_CNULL;
 
-    /* Must be postorder so nodes can be safely destroyed in the middle of
-    an iteration. Force node to be reconstructed in order to be used again
-    by destroying its members (dnode, dlist, etc) and manually invalidating
-    ntnode members (parent, etc). Do this before user's destroy callback to
-    prevent node from being used in the callback. This must also be done
-    BEFORE the callback executes in case user frees the node. Otherwise
-    memory that has already been freed would be accessed. */
-    ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, me)
+    /* Branches MUST be in this order!! */
+    if (node != root)
     {
-        /* Precondition in order to safely destroy children list. Postorder
-        iteratation should guarantee this condition is always met. */
-        ECU_ASSERT( (ecu_ntnode_is_leaf(n)) );
-
-        /* Cache ID since it is cleared in dnode destructor. Begin destroying node. */
-        id = ecu_ntnode_id(n);
-        ecu_dnode_destroy(&n->dnode);
-        ecu_dlist_destroy(&n->children);
-        n->parent = NTNODE_NULL;
+        next = ecu_ntnode_cnext(node);
 
-        /* Execute callback AFTER node is invalidated. */
-        if (n->destroy != ECU_NTNODE_DESTROY_UNUSED)
+        if (next)
         {
-            (*n->destroy)(n, id);
+            next = get_cleaf(next);
+        }
+        else
+        {
+            /* It should be impossible for parent to be NULL if this branch enters. */
+            next = ecu_ntnode_cparent(node);
+            ECU_ASSERT( (next) );
         }
     }
+
+    return next;
 }
 
-void ecu_ntnode_clear(struct ecu_ntnode *me)
+static struct ecu_ntnode *levelorder_successor(struct ecu_ntnode *root,
+                                               struct ecu_ntnode *node,
+                                               size_t level)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    struct ecu_ntnode_postorder_iterator iter;
+    ECU_ASSERT( (root && node) );
+    struct ecu_ntnode *current = node;
+    struct ecu_ntnode *next = NTNODE_NULL;
+    size_t depth = level;
 
-    /* Must be postorder so nodes can be safely removed in the middle of an iteration. */
-    ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, me)
+    do
     {
-        /* Current node must be a leaf since we are removing all nodes in postorder iteration. */
-        ECU_ASSERT( (ecu_ntnode_is_leaf(n)) );
-        ecu_ntnode_remove(n);
-    }
+        /* Preorder step that never goes deeper than the level being iterated over. */
+        next = (depth < level) ? ecu_ntnode_first_child(current) : NTNODE_NULL;
+
+        if (next)
+        {
+            depth++;
+        }
+        else
+        {
+            /* current != root must be condition in case iteration done over subtree. */
+            while ((!next) && (current != root))
+            {
+                next = ecu_ntnode_next(current);
+
+                if (!next)
+                {
+                    current = ecu_ntnode_parent(current);
+                    ECU_ASSERT( (current && depth > 0) );
+                    depth--;
+                }
+            }
+        }
+
+        current = next;
+    } while ((current) && (depth != level));
+
+    return current;
 }
 
-size_t ecu_ntnode_count(const struct ecu_ntnode *me)
+static const struct ecu_ntnode *levelorder_csuccessor(const struct ecu_ntnode *root,
+                                                      const struct ecu_ntnode *node,
+                                                      size_t level)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    return (ecu_dlist_size(&me->children));
+    ECU_ASSERT( (root && node) );
+    const struct ecu_ntnode *current = node;
+    const struct ecu_ntnode *next = NTNODE_CNULL;
+    size_t depth = level;
+
+    do
+    {
+        /* Preorder step that never goes deeper than the level being iterated over. */
+        next = (depth < level) ? ecu_ntnode_first_cchild(current) : NTNODE_CNULL;
+
+        if (next)
+        {
+            depth++;
+        }
+        else
+        {
+            /* current != root must be condition in case iteration done over subtree. */
+            while ((!next) && (current != root))
+            {
+                next = ecu_ntnode_cnext(current);
+
+                if (!next)
+                {
+                    current = ecu_ntnode_cparent(current);
+                    ECU_ASSERT( (current && depth > 0) );
+                    depth--;
+                }
+            }
+        }
+
+        current = next;
+    } while ((current) && (depth != level));
+
+    return current;
 }
 
-struct ecu_ntnode *ecu_ntnode_first_child(struct ecu_ntnode *me)
+static void detach(struct ecu_ntnode *ntnode)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    struct ecu_dnode *dfront = ecu_dlist_front(&me->children);
-    struct ecu_ntnode *ntfront = NTNODE_NULL;
+    ECU_ASSERT( (ntnode) );
+    ECU_ASSERT( (ecu_ntnode_valid(ntnode)) );
 
-    if (dfront)
-    {
-        ntfront = ECU_DNODE_GET_ENTRY(dfront, struct ecu_ntnode, dnode);
-        ECU_ASSERT( (ecu_ntnode_valid(ntfront)) );
-    }
+#if defined(ECU_NTNODE_INDEXED)
+    index_unlink(ntnode);
+#endif
 
-    return ntfront;
+    ecu_dnode_remove(&ntnode->dnode);
+    ntnode->parent = ntnode;
+
+#if defined(ECU_NTNODE_COUNTED)
+    ntnode->count = 0;
+    ntnode->size = 0;
+    ntnode->level = 0;
+#endif
+
+#if defined(ECU_NTNODE_DIRTY)
+    /* Aggregate no longer matches since the node lost its children. */
+    ntnode->dirty = true;
+#endif
 }
 
-const struct ecu_ntnode *ecu_ntnode_first_cchild(const struct ecu_ntnode *me)
+static void unlink_subtree(struct ecu_ntnode *ntnode)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    const struct ecu_dnode *dfront = ecu_dlist_cfront(&me->children);
-    const struct ecu_ntnode *ntfront = NTNODE_CNULL;
+    ECU_ASSERT( (ntnode) );
+    ECU_ASSERT( (ecu_ntnode_valid(ntnode)) );
 
-    if (dfront)
+#if defined(ECU_NTNODE_COUNTED)
+    if (ecu_ntnode_is_descendant(ntnode))
     {
-        ntfront = ECU_DNODE_GET_CONST_ENTRY(dfront, struct ecu_ntnode, dnode);
-        ECU_ASSERT( (ecu_ntnode_valid(ntfront)) );
+        counted_unlink(ntnode);
     }
+#endif
 
-    return ntfront;
+#if defined(ECU_NTNODE_DIRTY)
+    if (ecu_ntnode_is_descendant(ntnode))
+    {
+        ecu_ntnode_mark_dirty(ntnode->parent);
+    }
+#endif
+
+#if defined(ECU_NTNODE_INDEXED)
+    index_unlink(ntnode);
+#endif
+
+    ecu_dnode_remove(&ntnode->dnode);
+    ntnode->parent = ntnode;
 }
 
-ecu_object_id_t ecu_ntnode_id(const struct ecu_ntnode *me)
+static void link_subtree(struct ecu_ntnode *child)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    return (ecu_dnode_id(&me->dnode));
+    ECU_ASSERT( (child) );
+    ECU_ASSERT( (ecu_ntnode_valid(child)) );
+    ECU_ASSERT( (child->parent != child) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    /* Subtree joins the generation of its new tree. */
+    epoch_stamp(child, child->parent->epoch, child->parent->generation);
+#endif
+
+#if defined(ECU_NTNODE_COUNTED)
+    counted_link(child);
+#endif
+
+#if defined(ECU_NTNODE_INDEXED)
+    index_link(child);
+#endif
+
+#if defined(ECU_NTNODE_DIRTY)
+    ecu_ntnode_mark_dirty(child->parent);
+#else
+    (void)child;
+#endif
 }
 
-bool ecu_ntnode_in_tree(const struct ecu_ntnode *me)
+#if defined(ECU_NTNODE_COUNTED)
+static void counted_link(struct ecu_ntnode *child)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    bool status = false;
+    ECU_ASSERT( (child) );
+    ECU_ASSERT( (ecu_ntnode_valid(child)) );
+    ECU_ASSERT( (child->parent != child) );
+    struct ecu_ntnode_parent_iterator iter;
+
+    child->parent->count++;
 
-    /* || !ecu_dlist_empty(&me->children) to handle root node. */
-    if ((ecu_dnode_in_list(&me->dnode)) ||
-        (!ecu_dlist_empty(&me->children)))
+    ECU_NTNODE_PARENT_FOR_EACH(n, &iter, child)
     {
-        /* Node is descendent or non-empty root. */
-        status = true;
+        n->size += (child->size + 1);
     }
 
-    return status;
+    counted_relevel(child, child->parent->level + 1);
 }
 
-void ecu_ntnode_insert_sibling_after(struct ecu_ntnode *pos, struct ecu_ntnode *sibling)
+static void counted_unlink(struct ecu_ntnode *child)
 {
-    ECU_ASSERT( (pos && sibling) );
-    ECU_ASSERT( (pos != sibling) );
-    ECU_ASSERT( (ecu_ntnode_valid(pos)) );
-    ECU_ASSERT( (ecu_ntnode_valid(sibling)) );
-    /* Tree must have a root. Cannot add sibling to a root.
-    Sibling also cannot already be within a tree. */
-    ECU_ASSERT( (!ecu_ntnode_is_root(pos)) );
-    ECU_ASSERT( (!ecu_ntnode_is_descendant(sibling)) );
+    ECU_ASSERT( (child) );
+    ECU_ASSERT( (ecu_ntnode_valid(child)) );
+    ECU_ASSERT( (child->parent != child) );
+    struct ecu_ntnode_parent_iterator iter;
 
-    ecu_dnode_insert_after(&pos->dnode, &sibling->dnode);
-    sibling->parent = pos->parent;
+    ECU_ASSERT( (child->parent->count > 0) );
+    child->parent->count--;
+
+    ECU_NTNODE_PARENT_FOR_EACH(n, &iter, child)
+    {
+        ECU_ASSERT( (n->size > child->size) );
+        n->size -= (child->size + 1);
+    }
 }
 
-void ecu_ntnode_insert_sibling_before(struct ecu_ntnode *pos, struct ecu_ntnode *sibling)
+static void counted_relevel(struct ecu_ntnode *root, size_t level)
 {
-    ECU_ASSERT( (pos && sibling) );
-    ECU_ASSERT( (pos != sibling) );
-    ECU_ASSERT( (ecu_ntnode_valid(pos)) );
-    ECU_ASSERT( (ecu_ntnode_valid(sibling)) );
-    /* Tree must have a root. Cannot add sibling to a root.
-    Sibling also cannot already be within a tree. */
-    ECU_ASSERT( (!ecu_ntnode_is_root(pos)) );
-    ECU_ASSERT( (!ecu_ntnode_is_descendant(sibling)) );
+    ECU_ASSERT( (root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    struct ecu_ntnode_compact_preorder_iterator iter;
+    size_t old_level = root->level;
 
-    ecu_dnode_insert_before(&pos->dnode, &sibling->dnode);
-    sibling->parent = pos->parent;
+    if (old_level != level)
+    {
+        /* Every node in the subtree is at or below root's old level. */
+        ECU_NTNODE_COMPACT_PREORDER_FOR_EACH(n, &iter, root)
+        {
+            n->level = (n->level - old_level) + level;
+        }
+    }
 }
+#endif /* ECU_NTNODE_COUNTED */
 
-bool ecu_ntnode_is_descendant(const struct ecu_ntnode *me)
+#if defined(ECU_NTNODE_DIRTY)
+static struct ecu_ntnode *first_dirty(struct ecu_ntnode *start)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    return (ecu_dnode_in_list(&me->dnode));
+    struct ecu_ntnode *n = start;
+
+    while ((n) && (!n->dirty))
+    {
+        n = ecu_ntnode_next(n);
+    }
+
+    return n;
 }
+#endif /* ECU_NTNODE_DIRTY */
 
-bool ecu_ntnode_is_leaf(const struct ecu_ntnode *me)
+#if defined(ECU_NTNODE_INDEXED)
+static size_t index_home(const struct ecu_ntnode_index *index, ecu_object_id_t id)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    return (ecu_dlist_empty(&me->children));
+    ECU_ASSERT( (index) );
+    /* Fibonacci hashing. Fold high bits down since only the low bits are kept. */
+    uint32_t hash = (uint32_t)id * UINT32_C(2654435769);
+    hash ^= (hash >> 16);
+    return ((size_t)hash & (index->capacity - 1));
 }
 
-bool ecu_ntnode_is_root(const struct ecu_ntnode *me)
+static void index_clear(struct ecu_ntnode_index *index)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    /* Can also check (me->parent == me). Using dlist API since more stable approach. */
-    return (!ecu_dnode_in_list(&me->dnode));
+    ECU_ASSERT( (index) );
+
+    for (size_t i = 0; i < index->capacity; i++)
+    {
+        index->slots[i] = NTNODE_NULL;
+    }
+
+    index->count = 0;
 }
 
-struct ecu_ntnode *ecu_ntnode_last_child(struct ecu_ntnode *me)
+static void index_link(struct ecu_ntnode *child)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    struct ecu_dnode *dback = ecu_dlist_back(&me->children);
-    struct ecu_ntnode *ntback = NTNODE_NULL;
+    ECU_ASSERT( (child) );
+    ECU_ASSERT( (ecu_ntnode_valid(child)) );
+    ECU_ASSERT( (child->parent != child) );
+    struct ecu_ntnode_index *index = child->parent->index;
 
-    if (dback)
+    if (index)
     {
-        ntback = ECU_DNODE_GET_ENTRY(dback, struct ecu_ntnode, dnode);
-        ECU_ASSERT( (ecu_ntnode_valid(ntback)) );
-    }
+        /* Always leave one slot empty so probing terminates. */
+        ECU_ASSERT( ((index->count + 1) < index->capacity) );
+        size_t i = index_home(index, ecu_ntnode_id(child));
 
-    return ntback;
+        while (index->slots[i])
+        {
+            i = (i + 1) & (index->capacity - 1);
+        }
+
+        index->slots[i] = child;
+        index->count++;
+    }
 }
 
-const struct ecu_ntnode *ecu_ntnode_last_cchild(const struct ecu_ntnode *me)
+static void index_unlink(struct ecu_ntnode *child)
 {
-    ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    const struct ecu_dnode *dback = ecu_dlist_cback(&me->children);
-    const struct ecu_ntnode *ntback = NTNODE_CNULL;
+    ECU_ASSERT( (child) );
+    ECU_ASSERT( (ecu_ntnode_valid(child)) );
+    struct ecu_ntnode_index *index = child->parent->index;
 
-    if (dback)
+    if ((child->parent != child) && (index))
     {
-        ntback = ECU_DNODE_GET_CONST_ENTRY(dback, struct ecu_ntnode, dnode);
-        ECU_ASSERT( (ecu_ntnode_valid(ntback)) );
+        size_t mask = index->capacity - 1;
+        size_t i = index_home(index, ecu_ntnode_id(child));
+
+        while (index->slots[i] != child)
+        {
+            ECU_ASSERT( (index->slots[i]) ); /* Child must be in its parent's index. */
+            i = (i + 1) & mask;
+        }
+
+        index->slots[i] = NTNODE_NULL;
+        ECU_ASSERT( (index->count > 0) );
+        index->count--;
+
+        /* Backward shift deletion. Pull later entries of the probe run into the hole
+        unless their home slot is cyclically within (i, j], in which case moving them
+        would place them before their home and make them unreachable. */
+        for (size_t j = (i + 1) & mask; index->slots[j]; j = (j + 1) & mask)
+        {
+            size_t k = index_home(index, ecu_ntnode_id(index->slots[j]));
+            bool reachable = (i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j));
+
+            if (!reachable)
+            {
+                index->slots[i] = index->slots[j];
+                index->slots[j] = NTNODE_NULL;
+                i = j;
+            }
+        }
     }
+}
+#endif /* ECU_NTNODE_INDEXED */
 
-    return ntback;
+#if defined(ECU_NTNODE_FAST_CLEAR)
+static bool stale(const struct ecu_ntnode *ntnode)
+{
+    ECU_ASSERT( (ntnode) );
+    return ((ntnode->epoch) && (ntnode->generation != ntnode->epoch->generation));
 }
 
-struct ecu_ntnode *ecu_ntnode_lca(struct ecu_ntnode *n1, struct ecu_ntnode *n2)
+static void revive(struct ecu_ntnode *ntnode)
 {
-    ECU_ASSERT( (n1 && n2) );
-    ECU_ASSERT( (ecu_ntnode_valid(n1)) );
-    ECU_ASSERT( (ecu_ntnode_valid(n2)) );
-    struct ecu_ntnode *lca = NTNODE_NULL;
-    struct ecu_ntnode_parent_iterator iter;
+    ECU_ASSERT( (ntnode) );
+    ECU_ASSERT( (ecu_ntnode_valid(ntnode)) );
 
-    /* Use at iterator to handle case where n1 == n2. */
-    ECU_NTNODE_PARENT_AT_FOR_EACH(current, &iter, n1)
+    if (stale(ntnode))
     {
-        if (current == n2 || is_parent_of(current, n2))
+        /* Same as the constructor but keeps the ID and destroy callback. */
+        ecu_dnode_ctor(&ntnode->dnode, ECU_DNODE_DESTROY_UNUSED, ecu_ntnode_id(ntnode));
+        ecu_dlist_ctor(&ntnode->children);
+        ntnode->parent = ntnode;
+        ntnode->epoch = (struct ecu_ntnode_epoch *)0;
+        ntnode->generation = 0;
+
+#if defined(ECU_NTNODE_COUNTED)
+        ntnode->count = 0;
+        ntnode->size = 0;
+        ntnode->level = 0;
+#endif
+
+#if defined(ECU_NTNODE_DIRTY)
+        ntnode->dirty = true;
+#endif
+
+#if defined(ECU_NTNODE_INDEXED)
+        if (ntnode->index)
         {
-            lca = current;
-            break;
+            index_clear(ntnode->index);
         }
+#endif
     }
-
-    return lca;
 }
 
-const struct ecu_ntnode *ecu_ntnode_clca(const struct ecu_ntnode *n1, const struct ecu_ntnode *n2)
+static void epoch_stamp(struct ecu_ntnode *root,
+                        struct ecu_ntnode_epoch *epoch,
+                        uint64_t generation)
 {
-    ECU_ASSERT( (n1 && n2) );
-    ECU_ASSERT( (ecu_ntnode_valid(n1)) );
-    ECU_ASSERT( (ecu_ntnode_valid(n2)) );
-    const struct ecu_ntnode *lca = NTNODE_CNULL;
-    struct ecu_ntnode_parent_citerator citer;
+    ECU_ASSERT( (root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    struct ecu_ntnode_compact_preorder_iterator iter;
 
-    /* Use at iterator to handle case where n1 == n2. */
-    ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(current, &citer, n1)
+    if ((root->epoch != epoch) || (root->generation != generation))
     {
-        if (current == n2 || is_parent_of(current, n2))
+        ECU_NTNODE_COMPACT_PREORDER_FOR_EACH(n, &iter, root)
         {
-            lca = current;
-            break;
+            n->epoch = epoch;
+            n->generation = generation;
         }
     }
+}
+#endif /* ECU_NTNODE_FAST_CLEAR */
 
-    return lca;
+static bool live(const struct ecu_ntnode *ntnode)
+{
+    ECU_ASSERT( (ntnode) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    return (!stale(ntnode));
+#else
+    (void)ntnode;
+    return true;
+#endif
 }
 
-size_t ecu_ntnode_level(const struct ecu_ntnode *me)
+/*------------------------------------------------------------*/
+/*------------------ NTNODE MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_ntnode_ctor(struct ecu_ntnode *me,
+                     void (*destroy)(struct ecu_ntnode *me, ecu_object_id_t id),
+                     ecu_object_id_t id)
 {
     ECU_ASSERT( (me) );
-    ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    size_t level = 0;
-    struct ecu_ntnode_parent_citerator citer;
+    ECU_ASSERT( (id >= ECU_VALID_OBJECT_ID_BEGIN) );
 
-    /* Use normal parent iterator so starting node's level not included in level calculation. */
-    ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, me)
-    {
-        (void)n;
-        level++;
-    }
+    ecu_dnode_ctor(&me->dnode, ECU_DNODE_DESTROY_UNUSED, id);
+    ecu_dlist_ctor(&me->children);
+    me->parent = me;
+    me->destroy = destroy;
 
-    return level;
+#if defined(ECU_NTNODE_COUNTED)
+    me->count = 0;
+    me->size = 0;
+    me->level = 0;
+#endif
+
+#if defined(ECU_NTNODE_DIRTY)
+    me->dirty = true;
+#endif
+
+#if defined(ECU_NTNODE_INDEXED)
+    me->index = (struct ecu_ntnode_index *)0;
+#endif
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    me->epoch = (struct ecu_ntnode_epoch *)0;
+    me->generation = 0;
+#endif
 }
 
-struct ecu_ntnode *ecu_ntnode_next(struct ecu_ntnode *me)
+void ecu_ntnode_destroy(struct ecu_ntnode *me)
 {
     ECU_ASSERT( (me) );
     ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    struct ecu_dnode *dnext = ecu_dnode_next(&me->dnode);
-    struct ecu_ntnode *ntnext = NTNODE_NULL;
+    /* Compact iterator since it does not store a delimiter node on the stack. */
+    struct ecu_ntnode_compact_postorder_iterator iter;
+    ecu_object_id_t id = ECU_OBJECT_ID_UNUSED;
 
-    if (dnext)
+    /* Destroying the dnode would also unlink this subtree from its
+    parent. Remove it through the API first so ancestors stay consistent. */
+    ecu_ntnode_remove(me);
+
+    /* Must be postorder so nodes can be safely destroyed in the middle of
+    an iteration. Force node to be reconstructed in order to be used again
+    by destroying its members (dnode, dlist, etc) and manually invalidating
+    ntnode members (parent, etc). Do this before user's destroy callback to
+    prevent node from being used in the callback. This must also be done
+    BEFORE the callback executes in case user frees the node. Otherwise
+    memory that has already been freed would be accessed. */
+    ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(n, &iter, me)
     {
-        ntnext = ECU_DNODE_GET_ENTRY(dnext, struct ecu_ntnode, dnode);
-        ECU_ASSERT( (ecu_ntnode_valid(ntnext)) );
-    }
+        /* Precondition in order to safely destroy children list. Postorder
+        iteratation should guarantee this condition is always met. */
+        ECU_ASSERT( (ecu_ntnode_is_leaf(n)) );
 
-    return ntnext;
+        /* Cache ID since it is cleared in dnode destructor. Begin destroying node. */
+        id = ecu_ntnode_id(n);
+
+#if defined(ECU_NTNODE_INDEXED)
+        /* Destroying the dnode unlinks it, so parent's index must be updated first. */
+        index_unlink(n);
+        n->index = (struct ecu_ntnode_index *)0;
+#endif
+
+        ecu_dnode_destroy(&n->dnode);
+        ecu_dlist_destroy(&n->children);
+        n->parent = NTNODE_NULL;
+
+        /* Execute callback AFTER node is invalidated. */
+        if (n->destroy != ECU_NTNODE_DESTROY_UNUSED)
+        {
+            (*n->destroy)(n, id);
+        }
+    }
 }
 
-const struct ecu_ntnode *ecu_ntnode_cnext(const struct ecu_ntnode *me)
+void ecu_ntnode_clear(struct ecu_ntnode *me)
 {
     ECU_ASSERT( (me) );
     ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    const struct ecu_dnode *dnext = ecu_dnode_cnext(&me->dnode);
-    const struct ecu_ntnode *ntnext = NTNODE_CNULL;
+    struct ecu_ntnode_compact_postorder_iterator iter;
 
-    if (dnext)
+    /* Only this node's ancestors outside of the cleared subtree need
+    their counts updated. Every node inside is reset as it is detached. */
+    ecu_ntnode_remove(me);
+
+    /* Must be postorder so nodes can be safely removed in the middle of an iteration. */
+    ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(n, &iter, me)
     {
-        ntnext = ECU_DNODE_GET_CONST_ENTRY(dnext, struct ecu_ntnode, dnode);
-        ECU_ASSERT( (ecu_ntnode_valid(ntnext)) );
-    }
+        /* Current node must be a leaf since we are removing all nodes in postorder iteration. */
+        ECU_ASSERT( (ecu_ntnode_is_leaf(n)) );
+        detach(n);
 
-    return ntnext;
+#if defined(ECU_NTNODE_FAST_CLEAR)
+        if (n != me)
+        {
+            /* Detached nodes leave the epoch. The root keeps it so its tree can still be fast cleared. */
+            n->epoch = (struct ecu_ntnode_epoch *)0;
+            n->generation = 0;
+        }
+#endif
+    }
 }
 
-struct ecu_ntnode *ecu_ntnode_parent(struct ecu_ntnode *me)
+size_t ecu_ntnode_count(const struct ecu_ntnode *me)
 {
     ECU_ASSERT( (me) );
     ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    struct ecu_ntnode *parent = NTNODE_NULL;
-
-    if (me->parent != me)
-    {
-        parent = me->parent;
-        ECU_ASSERT( (ecu_ntnode_valid(parent)) );
-    }
+    ECU_ASSERT( (live(me)) );
 
-    return parent;
+#if defined(ECU_NTNODE_COUNTED)
+    return (me->count);
+#else
+    return (ecu_dlist_size(&me->children));
+#endif
 }
 
-const struct ecu_ntnode *ecu_ntnode_cparent(const struct ecu_ntnode *me)
+struct ecu_ntnode *ecu_ntnode_find_child_by_id(struct ecu_ntnode *me, ecu_object_id_t id)
 {
     ECU_ASSERT( (me) );
     ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    const struct ecu_ntnode *parent = NTNODE_CNULL;
+    ECU_ASSERT( (live(me)) );
+    struct ecu_ntnode *found = NTNODE_NULL;
 
-    if (me->parent != me)
+#if defined(ECU_NTNODE_INDEXED)
+    if (me->index)
     {
-        parent = me->parent;
-        ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+        size_t i = index_home(me->index, id);
+
+        /* Probe run always ends on an empty slot since index is never full. */
+        while ((!found) && (me->index->slots[i]))
+        {
+            if (ecu_ntnode_id(me->index->slots[i]) == id)
+            {
+                found = me->index->slots[i];
+            }
+
+            i = (i + 1) & (me->index->capacity - 1);
+        }
     }
+    else
+#endif
+    {
+        struct ecu_ntnode *child = ecu_ntnode_first_child(me);
 
-    return parent;
+        while ((!found) && (child))
+        {
+            if (ecu_ntnode_id(child) == id)
+            {
+                found = child;
+            }
+
+            child = ecu_ntnode_next(child);
+        }
+    }
+
+    return found;
 }
 
-struct ecu_ntnode *ecu_ntnode_prev(struct ecu_ntnode *me)
+const struct ecu_ntnode *ecu_ntnode_find_cchild_by_id(const struct ecu_ntnode *me, ecu_object_id_t id)
 {
     ECU_ASSERT( (me) );
     ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    struct ecu_dnode *dprev = ecu_dnode_prev(&me->dnode);
-    struct ecu_ntnode *ntprev = NTNODE_NULL;
+    ECU_ASSERT( (live(me)) );
+    const struct ecu_ntnode *found = NTNODE_CNULL;
 
-    if (dprev)
+#if defined(ECU_NTNODE_INDEXED)
+    if (me->index)
     {
-        ntprev = ECU_DNODE_GET_ENTRY(dprev, struct ecu_ntnode, dnode);
-        ECU_ASSERT( (ecu_ntnode_valid(ntprev)) );
+        size_t i = index_home(me->index, id);
+
+        /* Probe run always ends on an empty slot since index is never full. */
+        while ((!found) && (me->index->slots[i]))
+        {
+            if (ecu_ntnode_id(me->index->slots[i]) == id)
+            {
+                found = me->index->slots[i];
+            }
+
+            i = (i + 1) & (me->index->capacity - 1);
+        }
+    }
+    else
+#endif
+    {
+        const struct ecu_ntnode *child = ecu_ntnode_first_cchild(me);
+
+        while ((!found) && (child))
+        {
+            if (ecu_ntnode_id(child) == id)
+            {
+                found = child;
+            }
+
+            child = ecu_ntnode_cnext(child);
+        }
     }
 
-    return ntprev;
+    return found;
 }
 
-const struct ecu_ntnode *ecu_ntnode_cprev(const struct ecu_ntnode *me)
+struct ecu_ntnode *ecu_ntnode_first_child(struct ecu_ntnode *me)
 {
     ECU_ASSERT( (me) );
     ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    const struct ecu_dnode *dprev = ecu_dnode_cprev(&me->dnode);
-    const struct ecu_ntnode *ntprev = NTNODE_CNULL;
+    ECU_ASSERT( (live(me)) );
+    struct ecu_dnode *dfront = ecu_dlist_front(&me->children);
+    struct ecu_ntnode *ntfront = NTNODE_NULL;
 
-    if (dprev)
+    if (dfront)
     {
-        ntprev = ECU_DNODE_GET_CONST_ENTRY(dprev, struct ecu_ntnode, dnode);
-        ECU_ASSERT( (ecu_ntnode_valid(ntprev)) );
+        ntfront = ECU_DNODE_GET_ENTRY(dfront, struct ecu_ntnode, dnode);
+        ECU_ASSERT( (ecu_ntnode_valid(ntfront)) );
     }
 
-    return ntprev;
+    return ntfront;
 }
 
-void ecu_ntnode_push_child_back(struct ecu_ntnode *parent, struct ecu_ntnode *child)
+const struct ecu_ntnode *ecu_ntnode_first_cchild(const struct ecu_ntnode *me)
 {
-    ECU_ASSERT( (parent && child) );
-    ECU_ASSERT( (parent != child) );
-    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
-    ECU_ASSERT( (ecu_ntnode_valid(child)) );
-    ECU_ASSERT( (!ecu_ntnode_is_descendant(child)) );
-
-    ecu_dlist_push_back(&parent->children, &child->dnode);
-    child->parent = parent;
-}
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    const struct ecu_dnode *dfront = ecu_dlist_cfront(&me->children);
+    const struct ecu_ntnode *ntfront = NTNODE_CNULL;
 
-void ecu_ntnode_push_child_front(struct ecu_ntnode *parent, struct ecu_ntnode *child)
-{
-    ECU_ASSERT( (parent && child) );
-    ECU_ASSERT( (parent != child) );
-    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
-    ECU_ASSERT( (ecu_ntnode_valid(child)) );
-    ECU_ASSERT( (!ecu_ntnode_is_descendant(child)) );
+    if (dfront)
+    {
+        ntfront = ECU_DNODE_GET_CONST_ENTRY(dfront, struct ecu_ntnode, dnode);
+        ECU_ASSERT( (ecu_ntnode_valid(ntfront)) );
+    }
 
-    ecu_dlist_push_front(&parent->children, &child->dnode);
-    child->parent = parent;
+    return ntfront;
 }
 
-void ecu_ntnode_remove(struct ecu_ntnode *me)
+ecu_object_id_t ecu_ntnode_id(const struct ecu_ntnode *me)
 {
     ECU_ASSERT( (me) );
     ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    ecu_dnode_remove(&me->dnode);
-    me->parent = me;
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    /* dnode API would assert since a stale node's links point into the cleared tree. */
+    return ((stale(me)) ? me->dnode.id : ecu_dnode_id(&me->dnode)); /* WARNING: Directly accessing dnode structure. */
+#else
+    return (ecu_dnode_id(&me->dnode));
+#endif
 }
 
-size_t ecu_ntnode_size(const struct ecu_ntnode *me)
+bool ecu_ntnode_in_tree(const struct ecu_ntnode *me)
 {
     ECU_ASSERT( (me) );
     ECU_ASSERT( (ecu_ntnode_valid(me)) );
-    size_t size = 0;
-    struct ecu_ntnode_postorder_citerator citer;
+    bool status = false;
 
-    ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, me)
+    /* || !ecu_ntnode_is_leaf() to handle root node. */
+    if ((ecu_ntnode_is_descendant(me)) ||
+        (!ecu_ntnode_is_leaf(me)))
     {
-        (void)n;
-        size++;
+        /* Node is descendent or non-empty root. */
+        status = true;
     }
 
-    ECU_ASSERT( (size > 0) ); /* Iteration should have gone at least over me. */
-    return (size - 1);
+    return status;
 }
 
-bool ecu_ntnode_valid(const struct ecu_ntnode *me)
+size_t ecu_ntnode_index_of(const struct ecu_ntnode *me)
 {
     ECU_ASSERT( (me) );
-    bool status = false;
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    ECU_ASSERT( (!ecu_ntnode_is_root(me)) );
 
-    if (ecu_dnode_valid(&me->dnode) &&
-        ecu_dlist_valid(&me->children) &&
-        me->parent) /* me->parent == me if node has no parent. Set to NULL when node destroyed. */
+    size_t index = 0;
+
+    for (const struct ecu_ntnode *n = ecu_ntnode_cprev(me); n; n = ecu_ntnode_cprev(n))
     {
-        status = true;
+        index++;
     }
 
-    return status;
+    return index;
 }
 
-/*------------------------------------------------------------*/
-/*------------------------ CHILD ITERATOR --------------------*/
-/*------------------------------------------------------------*/
-
-struct ecu_ntnode *ecu_ntnode_child_iterator_begin(struct ecu_ntnode_child_iterator *me,
-                                                   struct ecu_ntnode *parent)
+void ecu_ntnode_insert_child_at(struct ecu_ntnode *parent, struct ecu_ntnode *child, size_t index)
 {
-    ECU_ASSERT( (me && parent) );
+    ECU_ASSERT( (parent && child) );
     ECU_ASSERT( (ecu_ntnode_valid(parent)) );
 
-    struct ecu_ntnode *current = ecu_ntnode_first_child(parent);
-    struct ecu_ntnode *next = NTNODE_NULL;
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(parent);
+#endif
 
-    if (current) /* Parent has children? */
+    struct ecu_ntnode *pos = ecu_ntnode_nth_child(parent, index);
+
+    if (pos)
     {
-        next = ecu_ntnode_next(current);
+        ecu_ntnode_insert_sibling_before(pos, child);
+    }
+    else
+    {
+        ECU_ASSERT( (index == ecu_ntnode_count(parent)) );
+        ecu_ntnode_push_child_back(parent, child);
     }
+}
 
-    me->current = current;
-    me->next = next;
-    return (me->current);
+void ecu_ntnode_insert_sibling_after(struct ecu_ntnode *pos, struct ecu_ntnode *sibling)
+{
+    ECU_ASSERT( (pos && sibling) );
+    ECU_ASSERT( (pos != sibling) );
+    ECU_ASSERT( (ecu_ntnode_valid(pos)) );
+    ECU_ASSERT( (ecu_ntnode_valid(sibling)) );
+    /* Tree must have a root. Cannot add sibling to a root.
+    Sibling also cannot already be within a tree. */
+    ECU_ASSERT( (!ecu_ntnode_is_root(pos)) );
+    ECU_ASSERT( (!ecu_ntnode_is_descendant(sibling)) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(sibling);
+#endif
+
+    ecu_dnode_insert_after(&pos->dnode, &sibling->dnode);
+    sibling->parent = pos->parent;
+    link_subtree(sibling);
 }
 
-struct ecu_ntnode *ecu_ntnode_child_iterator_end(struct ecu_ntnode_child_iterator *me)
+void ecu_ntnode_insert_sibling_before(struct ecu_ntnode *pos, struct ecu_ntnode *sibling)
 {
-    ECU_ASSERT( (me) );
-    return (NTNODE_NULL);
+    ECU_ASSERT( (pos && sibling) );
+    ECU_ASSERT( (pos != sibling) );
+    ECU_ASSERT( (ecu_ntnode_valid(pos)) );
+    ECU_ASSERT( (ecu_ntnode_valid(sibling)) );
+    /* Tree must have a root. Cannot add sibling to a root.
+    Sibling also cannot already be within a tree. */
+    ECU_ASSERT( (!ecu_ntnode_is_root(pos)) );
+    ECU_ASSERT( (!ecu_ntnode_is_descendant(sibling)) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(sibling);
+#endif
+
+    ecu_dnode_insert_before(&pos->dnode, &sibling->dnode);
+    sibling->parent = pos->parent;
+    link_subtree(sibling);
 }
 
-struct ecu_ntnode *ecu_ntnode_child_iterator_next(struct ecu_ntnode_child_iterator *me)
+bool ecu_ntnode_is_ancestor(const struct ecu_ntnode *me, const struct ecu_ntnode *node)
 {
-    ECU_ASSERT( (me) );
-    /* me->current == NULL once iteration completes.
-    Do not allow this function to be called after iteration completes. Force user to restart iteration.
-    Do not valid assert me->current to allow destruction of current node. Also not necessary since
-    me->next is valid asserted when it is calculated in previous call. */
-    ECU_ASSERT( (me->current) );
-    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
-    Note in_tree() valid asserts me->next. IMPORTANT to check for NULL first before using API. */
-    ECU_ASSERT( ((me->next == NTNODE_NULL) || (ecu_ntnode_in_tree(me->next))) );
+    ECU_ASSERT( (me && node) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    ECU_ASSERT( (ecu_ntnode_valid(node)) );
+    ECU_ASSERT( (live(node)) );
+    bool status = false;
 
-    struct ecu_ntnode *next = NTNODE_NULL;
-    if (me->next) /* Still have children remaining? */
+#if defined(ECU_NTNODE_COUNTED)
+    /* Cached levels tell exactly how far up me must be, so lift node to me's level and compare once. */
+    if (node->level > me->level)
     {
-        next = ecu_ntnode_next(me->next);
+        const struct ecu_ntnode *n = node;
+
+        for (size_t i = node->level - me->level; i > 0; i--)
+        {
+            n = n->parent;
+        }
+
+        status = (n == me);
     }
+#else
+    struct ecu_ntnode_parent_citerator citer;
 
-    me->current = me->next;
-    me->next = next;
-    return (me->current);
+    ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, node)
+    {
+        if (n == me)
+        {
+            status = true;
+            break;
+        }
+    }
+#endif
+
+    return status;
 }
 
-const struct ecu_ntnode *ecu_ntnode_child_iterator_cbegin(struct ecu_ntnode_child_citerator *me,
-                                                          const struct ecu_ntnode *parent)
+bool ecu_ntnode_is_descendant(const struct ecu_ntnode *me)
 {
-    ECU_ASSERT( (me && parent) );
-    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
 
-    const struct ecu_ntnode *current = ecu_ntnode_first_cchild(parent);
-    const struct ecu_ntnode *next = NTNODE_CNULL;
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    return ((!stale(me)) && (ecu_dnode_in_list(&me->dnode)));
+#else
+    return (ecu_dnode_in_list(&me->dnode));
+#endif
+}
 
-    if (current) /* Parent has children? */
-    {
-        next = ecu_ntnode_cnext(current);
-    }
+bool ecu_ntnode_is_leaf(const struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
 
-    me->current = current;
-    me->next = next;
-    return (me->current);
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    return ((stale(me)) || (ecu_dlist_empty(&me->children)));
+#else
+    return (ecu_dlist_empty(&me->children));
+#endif
 }
 
-const struct ecu_ntnode *ecu_ntnode_child_iterator_cend(struct ecu_ntnode_child_citerator *me)
+bool ecu_ntnode_is_root(const struct ecu_ntnode *me)
 {
     ECU_ASSERT( (me) );
-    return (NTNODE_CNULL);
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    /* Can also check (me->parent == me). Using dlist API through is_descendant()
+    since more stable approach, and stale nodes are handled in one place. */
+    return (!ecu_ntnode_is_descendant(me));
 }
 
-const struct ecu_ntnode *ecu_ntnode_child_iterator_cnext(struct ecu_ntnode_child_citerator *me)
+struct ecu_ntnode *ecu_ntnode_last_child(struct ecu_ntnode *me)
 {
     ECU_ASSERT( (me) );
-    /* me->current == NULL once iteration completes.
-    Do not allow this function to be called after iteration completes. Force user to restart iteration.
-    Even though this is a const iterator, do not valid assert me->current to allow destruction of
-    current node to remain consistent with non-const iterator implementation. Also not necessary since
-    me->next is valid asserted when it is calculated in previous call. */
-    ECU_ASSERT( (me->current) );
-    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
-    Note in_tree() valid asserts me->next. IMPORTANT to check for NULL first before using API. */
-    ECU_ASSERT( ((me->next == NTNODE_CNULL) || (ecu_ntnode_in_tree(me->next))) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    struct ecu_dnode *dback = ecu_dlist_back(&me->children);
+    struct ecu_ntnode *ntback = NTNODE_NULL;
 
-    const struct ecu_ntnode *next = NTNODE_CNULL;
-    if (me->next) /* Still have children remaining? */
+    if (dback)
     {
-        next = ecu_ntnode_cnext(me->next);
+        ntback = ECU_DNODE_GET_ENTRY(dback, struct ecu_ntnode, dnode);
+        ECU_ASSERT( (ecu_ntnode_valid(ntback)) );
     }
 
-    me->current = me->next;
-    me->next = next;
-    return (me->current);
+    return ntback;
 }
 
-/*------------------------------------------------------------*/
-/*------------------- NEXT SIBLING ITERATOR ------------------*/
-/*------------------------------------------------------------*/
-
-struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_at(struct ecu_ntnode_next_sibling_iterator *me,
-                                                       struct ecu_ntnode *start)
+const struct ecu_ntnode *ecu_ntnode_last_cchild(const struct ecu_ntnode *me)
 {
-    ECU_ASSERT( (me && start) );
-    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    const struct ecu_dnode *dback = ecu_dlist_cback(&me->children);
+    const struct ecu_ntnode *ntback = NTNODE_CNULL;
 
-    struct ecu_ntnode *next = ecu_ntnode_next(start);
+    if (dback)
+    {
+        ntback = ECU_DNODE_GET_CONST_ENTRY(dback, struct ecu_ntnode, dnode);
+        ECU_ASSERT( (ecu_ntnode_valid(ntback)) );
+    }
 
-    me->current = start;
-    me->next = next;
-    return (me->current);
+    return ntback;
 }
 
-struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_begin(struct ecu_ntnode_next_sibling_iterator *me,
-                                                          struct ecu_ntnode *start)
+struct ecu_ntnode *ecu_ntnode_lca(struct ecu_ntnode *n1, struct ecu_ntnode *n2)
 {
-    ECU_ASSERT( (me && start) );
-    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (n1 && n2) );
+    ECU_ASSERT( (ecu_ntnode_valid(n1)) );
+    ECU_ASSERT( (live(n1)) );
+    ECU_ASSERT( (ecu_ntnode_valid(n2)) );
+    ECU_ASSERT( (live(n2)) );
+    struct ecu_ntnode *lca = NTNODE_NULL;
+    struct ecu_ntnode *a = n1;
+    struct ecu_ntnode *b = n2;
+    size_t level_a = ecu_ntnode_level(a);
+    size_t level_b = ecu_ntnode_level(b);
 
-    struct ecu_ntnode *current = ecu_ntnode_next(start);
-    struct ecu_ntnode *next = NTNODE_NULL;
+    /* Lift the deeper node so both are on the same level. */
+    for (; level_a > level_b; level_a--)
+    {
+        a = a->parent;
+    }
 
-    if (current)
+    for (; level_b > level_a; level_b--)
     {
-        /* current can be NULL if start has no siblings. Get next only if start has 1 or more siblings. */
-        next = ecu_ntnode_next(current);
+        b = b->parent;
     }
 
-    me->current = current;
-    me->next = next;
-    return (me->current);
-}
+    /* Walk up together. Stops at the roots if nodes are in separate trees. */
+    while (a != b && !ecu_ntnode_is_root(a))
+    {
+        a = a->parent;
+        b = b->parent;
+    }
 
-struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_end(struct ecu_ntnode_next_sibling_iterator *me)
-{
-    ECU_ASSERT( (me) );
-    return (NTNODE_NULL);
+    if (a == b)
+    {
+        lca = a;
+    }
+
+    return lca;
 }
 
-struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_next(struct ecu_ntnode_next_sibling_iterator *me)
+const struct ecu_ntnode *ecu_ntnode_clca(const struct ecu_ntnode *n1, const struct ecu_ntnode *n2)
 {
-    ECU_ASSERT( (me) );
-    /* me->current == NULL once iteration completes.
-    Do not allow this function to be called after iteration completes. Force user to restart iteration.
-    Do not valid assert me->current to allow destruction of current node. Also not necessary since
-    me->next is valid asserted when it is calculated in previous call. */
-    ECU_ASSERT( (me->current) );
-    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
-    Note in_tree() valid asserts me->next. IMPORTANT to check for NULL first before using API. */
-    ECU_ASSERT( ((me->next == NTNODE_NULL) || (ecu_ntnode_in_tree(me->next))) );
+    ECU_ASSERT( (n1 && n2) );
+    ECU_ASSERT( (ecu_ntnode_valid(n1)) );
+    ECU_ASSERT( (live(n1)) );
+    ECU_ASSERT( (ecu_ntnode_valid(n2)) );
+    ECU_ASSERT( (live(n2)) );
+    const struct ecu_ntnode *lca = NTNODE_CNULL;
+    const struct ecu_ntnode *a = n1;
+    const struct ecu_ntnode *b = n2;
+    size_t level_a = ecu_ntnode_level(a);
+    size_t level_b = ecu_ntnode_level(b);
 
-    struct ecu_ntnode *next = NTNODE_NULL;
-    if (me->next) /* siblings remaining? */
+    /* Lift the deeper node so both are on the same level. */
+    for (; level_a > level_b; level_a--)
     {
-        next = ecu_ntnode_next(me->next);
+        a = a->parent;
     }
 
-    me->current = me->next;
-    me->next = next;
-    return (me->current);
-}
+    for (; level_b > level_a; level_b--)
+    {
+        b = b->parent;
+    }
 
-const struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_cat(struct ecu_ntnode_next_sibling_citerator *me,
-                                                              const struct ecu_ntnode *start)
-{
-    ECU_ASSERT( (me && start) );
-    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    /* Walk up together. Stops at the roots if nodes are in separate trees. */
+    while (a != b && !ecu_ntnode_is_root(a))
+    {
+        a = a->parent;
+        b = b->parent;
+    }
 
-    const struct ecu_ntnode *next = ecu_ntnode_cnext(start);
+    if (a == b)
+    {
+        lca = a;
+    }
 
-    me->current = start;
-    me->next = next;
-    return (me->current);
+    return lca;
 }
 
-const struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_cbegin(struct ecu_ntnode_next_sibling_citerator *me,
-                                                                 const struct ecu_ntnode *start)
+size_t ecu_ntnode_level(const struct ecu_ntnode *me)
 {
-    ECU_ASSERT( (me && start) );
-    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
 
-    const struct ecu_ntnode *current = ecu_ntnode_cnext(start);
-    const struct ecu_ntnode *next = NTNODE_CNULL;
+#if defined(ECU_NTNODE_COUNTED)
+    return (me->level);
+#else
+    size_t level = 0;
+    struct ecu_ntnode_parent_citerator citer;
 
-    if (current)
+    /* Use normal parent iterator so starting node's level not included in level calculation. */
+    ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, me)
     {
-        /* current can be NULL if start has no siblings. Get next only if start has 1 or more siblings. */
-        next = ecu_ntnode_cnext(current);
+        (void)n;
+        level++;
     }
 
-    me->current = current;
-    me->next = next;
-    return (me->current);
+    return level;
+#endif
 }
 
-const struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_cend(struct ecu_ntnode_next_sibling_citerator *me)
+void ecu_ntnode_move_child_back(struct ecu_ntnode *parent, struct ecu_ntnode *child)
 {
-    ECU_ASSERT( (me) );
-    return (NTNODE_CNULL);
-}
-
-const struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_cnext(struct ecu_ntnode_next_sibling_citerator *me)
+    ECU_ASSERT( (parent && child) );
+    ECU_ASSERT( (parent != child) );
+    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    ECU_ASSERT( (ecu_ntnode_valid(child)) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(parent);
+    revive(child);
+#endif
+
+    /* Moving a node into its own subtree would create a cycle. */
+    ECU_ASSERT( (!ecu_ntnode_is_ancestor(child, parent)) );
+
+    unlink_subtree(child);
+    ecu_dlist_push_back(&parent->children, &child->dnode);
+    child->parent = parent;
+    link_subtree(child);
+}
+
+void ecu_ntnode_move_child_front(struct ecu_ntnode *parent, struct ecu_ntnode *child)
+{
+    ECU_ASSERT( (parent && child) );
+    ECU_ASSERT( (parent != child) );
+    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    ECU_ASSERT( (ecu_ntnode_valid(child)) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(parent);
+    revive(child);
+#endif
+
+    /* Moving a node into its own subtree would create a cycle. */
+    ECU_ASSERT( (!ecu_ntnode_is_ancestor(child, parent)) );
+
+    unlink_subtree(child);
+    ecu_dlist_push_front(&parent->children, &child->dnode);
+    child->parent = parent;
+    link_subtree(child);
+}
+
+void ecu_ntnode_move_children(struct ecu_ntnode *parent, struct ecu_ntnode *from)
+{
+    ECU_ASSERT( (parent && from) );
+    ECU_ASSERT( (parent != from) );
+    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    ECU_ASSERT( (ecu_ntnode_valid(from)) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(parent);
+    revive(from);
+#endif
+
+    /* Moving children into their own subtree would create a cycle. */
+    ECU_ASSERT( (!ecu_ntnode_is_ancestor(from, parent)) );
+    struct ecu_ntnode *first = ecu_ntnode_first_child(from);
+
+    if (first)
+    {
+#if defined(ECU_NTNODE_COUNTED)
+        /* Subtract from every node on from's path to the root and add to every
+        node on parent's path. Shared ancestors cancel out so they stay correct. */
+        struct ecu_ntnode_parent_iterator iter;
+        size_t moved = from->size;
+
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, from)
+        {
+            ECU_ASSERT( (n->size >= moved) );
+            n->size -= moved;
+        }
+
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, parent)
+        {
+            n->size += moved;
+        }
+
+        parent->count += from->count;
+        from->count = 0;
+#endif
+
+        /* Children are relinked in O(1). Only their parent pointers are
+        updated one by one. */
+        ecu_dlist_splice(&parent->children, &from->children);
+
+        for (struct ecu_ntnode *n = first; n; n = ecu_ntnode_next(n))
+        {
+#if defined(ECU_NTNODE_INDEXED)
+            index_unlink(n);
+#endif
+
+            n->parent = parent;
+
+#if defined(ECU_NTNODE_INDEXED)
+            index_link(n);
+#endif
+
+#if defined(ECU_NTNODE_COUNTED)
+            counted_relevel(n, parent->level + 1);
+#endif
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+            epoch_stamp(n, parent->epoch, parent->generation);
+#endif
+        }
+
+#if defined(ECU_NTNODE_DIRTY)
+        ecu_ntnode_mark_dirty(from);
+        ecu_ntnode_mark_dirty(parent);
+#endif
+    }
+}
+
+void ecu_ntnode_move_sibling_after(struct ecu_ntnode *pos, struct ecu_ntnode *sibling)
+{
+    ECU_ASSERT( (pos && sibling) );
+    ECU_ASSERT( (pos != sibling) );
+    ECU_ASSERT( (ecu_ntnode_valid(pos)) );
+    ECU_ASSERT( (ecu_ntnode_valid(sibling)) );
+    ECU_ASSERT( (!ecu_ntnode_is_root(pos)) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(sibling);
+#endif
+
+    /* Moving a node into its own subtree would create a cycle. */
+    ECU_ASSERT( (!ecu_ntnode_is_ancestor(sibling, pos)) );
+
+    unlink_subtree(sibling);
+    ecu_dnode_insert_after(&pos->dnode, &sibling->dnode);
+    sibling->parent = pos->parent;
+    link_subtree(sibling);
+}
+
+void ecu_ntnode_move_sibling_before(struct ecu_ntnode *pos, struct ecu_ntnode *sibling)
+{
+    ECU_ASSERT( (pos && sibling) );
+    ECU_ASSERT( (pos != sibling) );
+    ECU_ASSERT( (ecu_ntnode_valid(pos)) );
+    ECU_ASSERT( (ecu_ntnode_valid(sibling)) );
+    ECU_ASSERT( (!ecu_ntnode_is_root(pos)) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(sibling);
+#endif
+
+    /* Moving a node into its own subtree would create a cycle. */
+    ECU_ASSERT( (!ecu_ntnode_is_ancestor(sibling, pos)) );
+
+    unlink_subtree(sibling);
+    ecu_dnode_insert_before(&pos->dnode, &sibling->dnode);
+    sibling->parent = pos->parent;
+    link_subtree(sibling);
+}
+
+struct ecu_ntnode *ecu_ntnode_next(struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    struct ecu_dnode *dnext = ecu_dnode_next(&me->dnode);
+    struct ecu_ntnode *ntnext = NTNODE_NULL;
+
+    if (dnext)
+    {
+        ntnext = ECU_DNODE_GET_ENTRY(dnext, struct ecu_ntnode, dnode);
+        ECU_ASSERT( (ecu_ntnode_valid(ntnext)) );
+    }
+
+    return ntnext;
+}
+
+const struct ecu_ntnode *ecu_ntnode_cnext(const struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    const struct ecu_dnode *dnext = ecu_dnode_cnext(&me->dnode);
+    const struct ecu_ntnode *ntnext = NTNODE_CNULL;
+
+    if (dnext)
+    {
+        ntnext = ECU_DNODE_GET_CONST_ENTRY(dnext, struct ecu_ntnode, dnode);
+        ECU_ASSERT( (ecu_ntnode_valid(ntnext)) );
+    }
+
+    return ntnext;
+}
+
+struct ecu_ntnode *ecu_ntnode_nth_child(struct ecu_ntnode *me, size_t index)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    size_t i = index;
+
+    struct ecu_ntnode *n = ecu_ntnode_first_child(me);
+
+    for (; (n) && (i > 0); i--)
+    {
+        n = ecu_ntnode_next(n);
+    }
+
+    return n;
+}
+
+const struct ecu_ntnode *ecu_ntnode_nth_cchild(const struct ecu_ntnode *me, size_t index)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    size_t i = index;
+
+    const struct ecu_ntnode *n = ecu_ntnode_first_cchild(me);
+
+    for (; (n) && (i > 0); i--)
+    {
+        n = ecu_ntnode_cnext(n);
+    }
+
+    return n;
+}
+
+struct ecu_ntnode *ecu_ntnode_parent(struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    struct ecu_ntnode *parent = NTNODE_NULL;
+
+    if (me->parent != me)
+    {
+        parent = me->parent;
+        ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    }
+
+    return parent;
+}
+
+const struct ecu_ntnode *ecu_ntnode_cparent(const struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    const struct ecu_ntnode *parent = NTNODE_CNULL;
+
+    if (me->parent != me)
+    {
+        parent = me->parent;
+        ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    }
+
+    return parent;
+}
+
+struct ecu_ntnode *ecu_ntnode_prev(struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    struct ecu_dnode *dprev = ecu_dnode_prev(&me->dnode);
+    struct ecu_ntnode *ntprev = NTNODE_NULL;
+
+    if (dprev)
+    {
+        ntprev = ECU_DNODE_GET_ENTRY(dprev, struct ecu_ntnode, dnode);
+        ECU_ASSERT( (ecu_ntnode_valid(ntprev)) );
+    }
+
+    return ntprev;
+}
+
+const struct ecu_ntnode *ecu_ntnode_cprev(const struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    const struct ecu_dnode *dprev = ecu_dnode_cprev(&me->dnode);
+    const struct ecu_ntnode *ntprev = NTNODE_CNULL;
+
+    if (dprev)
+    {
+        ntprev = ECU_DNODE_GET_CONST_ENTRY(dprev, struct ecu_ntnode, dnode);
+        ECU_ASSERT( (ecu_ntnode_valid(ntprev)) );
+    }
+
+    return ntprev;
+}
+
+void ecu_ntnode_push_child_back(struct ecu_ntnode *parent, struct ecu_ntnode *child)
+{
+    ECU_ASSERT( (parent && child) );
+    ECU_ASSERT( (parent != child) );
+    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    ECU_ASSERT( (ecu_ntnode_valid(child)) );
+    ECU_ASSERT( (!ecu_ntnode_is_descendant(child)) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(parent);
+    revive(child);
+#endif
+
+    ecu_dlist_push_back(&parent->children, &child->dnode);
+    child->parent = parent;
+    link_subtree(child);
+}
+
+void ecu_ntnode_push_child_front(struct ecu_ntnode *parent, struct ecu_ntnode *child)
+{
+    ECU_ASSERT( (parent && child) );
+    ECU_ASSERT( (parent != child) );
+    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    ECU_ASSERT( (ecu_ntnode_valid(child)) );
+    ECU_ASSERT( (!ecu_ntnode_is_descendant(child)) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(parent);
+    revive(child);
+#endif
+
+    ecu_dlist_push_front(&parent->children, &child->dnode);
+    child->parent = parent;
+    link_subtree(child);
+}
+
+void ecu_ntnode_remove(struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    revive(me);
+
+    /* Removed subtree leaves the old tree's generation so clearing that tree
+    does not affect it. A root keeps its stamp since nothing is removed. */
+    if (ecu_ntnode_is_descendant(me))
+    {
+        unlink_subtree(me);
+        epoch_stamp(me, (struct ecu_ntnode_epoch *)0, 0);
+    }
+#else
+    unlink_subtree(me);
+#endif
+
+#if defined(ECU_NTNODE_COUNTED)
+    counted_relevel(me, 0);
+#endif
+}
+
+struct ecu_ntnode *ecu_ntnode_resolve(struct ecu_ntnode *me,
+                                      const ecu_object_id_t *path,
+                                      size_t length)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (path || (length == 0)) );
+    struct ecu_ntnode *node = me;
+
+    for (size_t i = 0; (i < length) && (node); i++)
+    {
+        node = ecu_ntnode_find_child_by_id(node, path[i]);
+    }
+
+    return node;
+}
+
+const struct ecu_ntnode *ecu_ntnode_cresolve(const struct ecu_ntnode *me,
+                                             const ecu_object_id_t *path,
+                                             size_t length)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (path || (length == 0)) );
+    const struct ecu_ntnode *node = me;
+
+    for (size_t i = 0; (i < length) && (node); i++)
+    {
+        node = ecu_ntnode_find_cchild_by_id(node, path[i]);
+    }
+
+    return node;
+}
+
+size_t ecu_ntnode_size(const struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+
+#if defined(ECU_NTNODE_COUNTED)
+    return (me->size);
+#else
+    size_t size = 0;
+    struct ecu_ntnode_postorder_citerator citer;
+
+    ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, me)
+    {
+        (void)n;
+        size++;
+    }
+
+    ECU_ASSERT( (size > 0) ); /* Iteration should have gone at least over me. */
+    return (size - 1);
+#endif
+}
+
+bool ecu_ntnode_valid(const struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    bool status = false;
+
+    if (ecu_dnode_valid(&me->dnode) &&
+        ecu_dlist_valid(&me->children) &&
+        me->parent) /* me->parent == me if node has no parent. Set to NULL when node destroyed. */
+    {
+        status = true;
+    }
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    else if ((me->parent) && (stale(me)))
+    {
+        /* Links of a stale node still point into the cleared tree so they are not checked.
+        Functions that would follow them assert live() instead. */
+        status = true;
+    }
+#endif
+
+    return status;
+}
+
+#if defined(ECU_NTNODE_DIRTY)
+/*------------------------------------------------------------*/
+/*----------------------- DIRTY TRACKING ---------------------*/
+/*------------------------------------------------------------*/
+
+bool ecu_ntnode_is_dirty(const struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    return (me->dirty);
+}
+
+void ecu_ntnode_mark_dirty(struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    struct ecu_ntnode *n = me;
+    bool done = false;
+
+    /* A dirty node's ancestors are always dirty, so stop at the first one found. */
+    while (!done)
+    {
+        if (n->dirty)
+        {
+            done = true;
+        }
+        else
+        {
+            n->dirty = true;
+            done = ecu_ntnode_is_root(n);
+            n = n->parent;
+        }
+    }
+}
+
+size_t ecu_ntnode_refresh(struct ecu_ntnode *me,
+                          void (*combine)(struct ecu_ntnode *node, void *obj),
+                          void *obj)
+{
+    ECU_ASSERT( (me && combine) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (live(me)) );
+    struct ecu_ntnode *node = me;
+    size_t refreshed = 0;
+    bool done = !me->dirty;
+
+    /* Clean nodes only have clean descendants so they are never entered. Descend
+    to a dirty node with no dirty children, combine it, then move on to its next
+    dirty sibling. Once no dirty siblings are left the parent is ready. */
+    while (!done)
+    {
+        struct ecu_ntnode *child = first_dirty(ecu_ntnode_first_child(node));
+
+        if (child)
+        {
+            node = child;
+        }
+        else
+        {
+            (*combine)(node, obj);
+            node->dirty = false;
+            refreshed++;
+
+            if (node == me)
+            {
+                done = true;
+            }
+            else
+            {
+                child = first_dirty(ecu_ntnode_next(node));
+                node = (child) ? child : node->parent;
+            }
+        }
+    }
+
+    return refreshed;
+}
+#endif /* ECU_NTNODE_DIRTY */
+
+#if defined(ECU_NTNODE_INDEXED)
+/*------------------------------------------------------------*/
+/*------------------------- CHILD INDEX ----------------------*/
+/*------------------------------------------------------------*/
+
+void ecu_ntnode_index_ctor(struct ecu_ntnode_index *me,
+                           struct ecu_ntnode **slots,
+                           size_t capacity)
+{
+    ECU_ASSERT( (me && slots) );
+    ECU_ASSERT( ((capacity > 0) && ((capacity & (capacity - 1)) == 0)) );
+
+    me->slots = slots;
+    me->capacity = capacity;
+    me->count = 0;
+
+    for (size_t i = 0; i < capacity; i++)
+    {
+        me->slots[i] = NTNODE_NULL;
+    }
+}
+
+void ecu_ntnode_attach_index(struct ecu_ntnode *me, struct ecu_ntnode_index *index)
+{
+    ECU_ASSERT( (me && index) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    ECU_ASSERT( (!me->index) );
+    struct ecu_ntnode_child_iterator iter;
+
+    index_clear(index);
+    me->index = index;
+
+    ECU_NTNODE_CHILD_FOR_EACH(child, &iter, me)
+    {
+        index_link(child);
+    }
+}
+
+void ecu_ntnode_detach_index(struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    me->index = (struct ecu_ntnode_index *)0;
+}
+#endif /* ECU_NTNODE_INDEXED */
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+/*------------------------------------------------------------*/
+/*------------------------- FAST CLEAR -----------------------*/
+/*------------------------------------------------------------*/
+
+void ecu_ntnode_epoch_ctor(struct ecu_ntnode_epoch *me)
+{
+    ECU_ASSERT( (me) );
+    me->generation = 0;
+}
+
+void ecu_ntnode_attach_epoch(struct ecu_ntnode *me, struct ecu_ntnode_epoch *epoch)
+{
+    ECU_ASSERT( (me && epoch) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    revive(me);
+    ECU_ASSERT( (ecu_ntnode_is_root(me)) );
+    ECU_ASSERT( (!me->epoch) );
+
+    epoch_stamp(me, epoch, epoch->generation);
+}
+
+void ecu_ntnode_fast_clear(struct ecu_ntnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ntnode_valid(me)) );
+    /* Only the root the epoch was attached to can start a new generation
+    since every other node sharing the epoch is in its tree. */
+    ECU_ASSERT( (me->epoch) );
+    ECU_ASSERT( (!stale(me)) );
+    ECU_ASSERT( (ecu_ntnode_is_root(me)) );
+
+    /* A wrapped generation would make nodes stamped at 0 look live
+    again. Unreachable with 64 bits, but never let it happen silently. */
+    ECU_ASSERT( (me->epoch->generation < UINT64_MAX) );
+
+    /* Every descendant is stale from now on. Only the root is restamped. */
+    me->epoch->generation++;
+    me->generation = me->epoch->generation;
+    ecu_dlist_ctor(&me->children);
+
+#if defined(ECU_NTNODE_COUNTED)
+    me->count = 0;
+    me->size = 0;
+#endif
+
+#if defined(ECU_NTNODE_DIRTY)
+    /* Aggregate no longer matches since the node lost its children. */
+    me->dirty = true;
+#endif
+
+#if defined(ECU_NTNODE_INDEXED)
+    if (me->index)
+    {
+        index_clear(me->index);
+    }
+#endif
+}
+#endif /* ECU_NTNODE_FAST_CLEAR */
+
+/*------------------------------------------------------------*/
+/*------------------------ CHILD ITERATOR --------------------*/
+/*------------------------------------------------------------*/
+
+struct ecu_ntnode *ecu_ntnode_child_iterator_begin(struct ecu_ntnode_child_iterator *me,
+                                                   struct ecu_ntnode *parent)
+{
+    ECU_ASSERT( (me && parent) );
+    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    ECU_ASSERT( (live(parent)) );
+
+    struct ecu_ntnode *current = ecu_ntnode_first_child(parent);
+    struct ecu_ntnode *next = NTNODE_NULL;
+
+    if (current) /* Parent has children? */
+    {
+        next = ecu_ntnode_next(current);
+    }
+
+    me->current = current;
+    me->next = next;
+    return (me->current);
+}
+
+struct ecu_ntnode *ecu_ntnode_child_iterator_end(struct ecu_ntnode_child_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    return (NTNODE_NULL);
+}
+
+struct ecu_ntnode *ecu_ntnode_child_iterator_next(struct ecu_ntnode_child_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    /* me->current == NULL once iteration completes.
+    Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    Do not valid assert me->current to allow destruction of current node. Also not necessary since
+    me->next is valid asserted when it is calculated in previous call. */
+    ECU_ASSERT( (me->current) );
+    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
+    Note in_tree() valid asserts me->next. IMPORTANT to check for NULL first before using API. */
+    ECU_ASSERT( ((me->next == NTNODE_NULL) || (ecu_ntnode_in_tree(me->next))) );
+
+    struct ecu_ntnode *next = NTNODE_NULL;
+    if (me->next) /* Still have children remaining? */
+    {
+        next = ecu_ntnode_next(me->next);
+    }
+
+    me->current = me->next;
+    me->next = next;
+    return (me->current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_child_iterator_cbegin(struct ecu_ntnode_child_citerator *me,
+                                                          const struct ecu_ntnode *parent)
+{
+    ECU_ASSERT( (me && parent) );
+    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    ECU_ASSERT( (live(parent)) );
+
+    const struct ecu_ntnode *current = ecu_ntnode_first_cchild(parent);
+    const struct ecu_ntnode *next = NTNODE_CNULL;
+
+    if (current) /* Parent has children? */
+    {
+        next = ecu_ntnode_cnext(current);
+    }
+
+    me->current = current;
+    me->next = next;
+    return (me->current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_child_iterator_cend(struct ecu_ntnode_child_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    return (NTNODE_CNULL);
+}
+
+const struct ecu_ntnode *ecu_ntnode_child_iterator_cnext(struct ecu_ntnode_child_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    /* me->current == NULL once iteration completes.
+    Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    Even though this is a const iterator, do not valid assert me->current to allow destruction of
+    current node to remain consistent with non-const iterator implementation. Also not necessary since
+    me->next is valid asserted when it is calculated in previous call. */
+    ECU_ASSERT( (me->current) );
+    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
+    Note in_tree() valid asserts me->next. IMPORTANT to check for NULL first before using API. */
+    ECU_ASSERT( ((me->next == NTNODE_CNULL) || (ecu_ntnode_in_tree(me->next))) );
+
+    const struct ecu_ntnode *next = NTNODE_CNULL;
+    if (me->next) /* Still have children remaining? */
+    {
+        next = ecu_ntnode_cnext(me->next);
+    }
+
+    me->current = me->next;
+    me->next = next;
+    return (me->current);
+}
+
+/*------------------------------------------------------------*/
+/*------------------- NEXT SIBLING ITERATOR ------------------*/
+/*------------------------------------------------------------*/
+
+struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_at(struct ecu_ntnode_next_sibling_iterator *me,
+                                                       struct ecu_ntnode *start)
+{
+    ECU_ASSERT( (me && start) );
+    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
+
+    struct ecu_ntnode *next = ecu_ntnode_next(start);
+
+    me->current = start;
+    me->next = next;
+    return (me->current);
+}
+
+struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_begin(struct ecu_ntnode_next_sibling_iterator *me,
+                                                          struct ecu_ntnode *start)
+{
+    ECU_ASSERT( (me && start) );
+    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
+
+    struct ecu_ntnode *current = ecu_ntnode_next(start);
+    struct ecu_ntnode *next = NTNODE_NULL;
+
+    if (current)
+    {
+        /* current can be NULL if start has no siblings. Get next only if start has 1 or more siblings. */
+        next = ecu_ntnode_next(current);
+    }
+
+    me->current = current;
+    me->next = next;
+    return (me->current);
+}
+
+struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_end(struct ecu_ntnode_next_sibling_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    return (NTNODE_NULL);
+}
+
+struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_next(struct ecu_ntnode_next_sibling_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    /* me->current == NULL once iteration completes.
+    Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    Do not valid assert me->current to allow destruction of current node. Also not necessary since
+    me->next is valid asserted when it is calculated in previous call. */
+    ECU_ASSERT( (me->current) );
+    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
+    Note in_tree() valid asserts me->next. IMPORTANT to check for NULL first before using API. */
+    ECU_ASSERT( ((me->next == NTNODE_NULL) || (ecu_ntnode_in_tree(me->next))) );
+
+    struct ecu_ntnode *next = NTNODE_NULL;
+    if (me->next) /* siblings remaining? */
+    {
+        next = ecu_ntnode_next(me->next);
+    }
+
+    me->current = me->next;
+    me->next = next;
+    return (me->current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_cat(struct ecu_ntnode_next_sibling_citerator *me,
+                                                              const struct ecu_ntnode *start)
+{
+    ECU_ASSERT( (me && start) );
+    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
+
+    const struct ecu_ntnode *next = ecu_ntnode_cnext(start);
+
+    me->current = start;
+    me->next = next;
+    return (me->current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_cbegin(struct ecu_ntnode_next_sibling_citerator *me,
+                                                                 const struct ecu_ntnode *start)
+{
+    ECU_ASSERT( (me && start) );
+    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
+
+    const struct ecu_ntnode *current = ecu_ntnode_cnext(start);
+    const struct ecu_ntnode *next = NTNODE_CNULL;
+
+    if (current)
+    {
+        /* current can be NULL if start has no siblings. Get next only if start has 1 or more siblings. */
+        next = ecu_ntnode_cnext(current);
+    }
+
+    me->current = current;
+    me->next = next;
+    return (me->current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_cend(struct ecu_ntnode_next_sibling_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    return (NTNODE_CNULL);
+}
+
+const struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_cnext(struct ecu_ntnode_next_sibling_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    /* me->current == NULL once iteration completes.
+    Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    Even though this is a const iteration use same assertions as non-const iterator to remain consistent.
+    Do not valid assert me->current to allow destruction of current node. Also not necessary since
+    me->next is valid asserted when it is calculated in previous call. */
+    ECU_ASSERT( (me->current) );
+    /* Even though this is a const iteration use same assertions as non-const iterator to remain consistent.
+    The current node can be safely removed but removing the next node before it's returned is not allowed.
+    Note in_tree() valid asserts me->next. IMPORTANT to check for NULL first before using API. */
+    ECU_ASSERT( ((me->next == NTNODE_CNULL) || (ecu_ntnode_in_tree(me->next))) );
+
+    const struct ecu_ntnode *next = NTNODE_CNULL;
+    if (me->next) /* siblings remaining? */
+    {
+        next = ecu_ntnode_cnext(me->next);
+    }
+
+    me->current = me->next;
+    me->next = next;
+    return (me->current);
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ PARENT ITERATOR -------------------*/
+/*------------------------------------------------------------*/
+
+struct ecu_ntnode *ecu_ntnode_parent_iterator_at(struct ecu_ntnode_parent_iterator *me,
+                                                 struct ecu_ntnode *start)
+{
+    ECU_ASSERT( (me && start) );
+    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
+
+    struct ecu_ntnode *next = ecu_ntnode_parent(start);
+
+    me->current = start;
+    me->next = next;
+    return (me->current);
+}
+
+struct ecu_ntnode *ecu_ntnode_parent_iterator_begin(struct ecu_ntnode_parent_iterator *me,
+                                                    struct ecu_ntnode *start)
+{
+    ECU_ASSERT( (me && start) );
+    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
+
+    struct ecu_ntnode *current = ecu_ntnode_parent(start);
+    struct ecu_ntnode *next = NTNODE_NULL;
+
+    if (current) /* start has parents? */
+    {
+        next = ecu_ntnode_parent(current);
+    }
+
+    me->current = current;
+    me->next = next;
+    return (me->current);
+}
+
+struct ecu_ntnode *ecu_ntnode_parent_iterator_end(struct ecu_ntnode_parent_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    return (NTNODE_NULL);
+}
+
+struct ecu_ntnode *ecu_ntnode_parent_iterator_next(struct ecu_ntnode_parent_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    /* me->current == NULL once iteration completes.
+    Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    Do not valid assert me->current to allow destruction of current node. Also not necessary since
+    me->next is valid asserted when it is calculated in previous call. */
+    ECU_ASSERT( (me->current) );
+    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
+    This is not directly checked since it is impossible to detect this condition. The next node can be a root,
+    and it is unknown what the root is at the start of the iteration. Therefore just check if the next node
+    is valid when non-NULL. IMPORTANT to check for NULL first before using API. */
+    ECU_ASSERT( ((me->next == NTNODE_NULL) || (ecu_ntnode_valid(me->next))) );
+
+    struct ecu_ntnode *next = NTNODE_NULL;
+    if (me->next) /* Still more parents to go? */
+    {
+        next = ecu_ntnode_parent(me->next);
+    }
+
+    me->current = me->next;
+    me->next = next;
+    return (me->current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_parent_iterator_cat(struct ecu_ntnode_parent_citerator *me,
+                                                        const struct ecu_ntnode *start)
+{
+    ECU_ASSERT( (me && start) );
+    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
+
+    const struct ecu_ntnode *next = ecu_ntnode_cparent(start);
+
+    me->current = start;
+    me->next = next;
+    return (me->current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_parent_iterator_cbegin(struct ecu_ntnode_parent_citerator *me,
+                                                           const struct ecu_ntnode *start)
+{
+    ECU_ASSERT( (me && start) );
+    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
+
+    const struct ecu_ntnode *current = ecu_ntnode_cparent(start);
+    const struct ecu_ntnode *next = NTNODE_CNULL;
+
+    if (current) /* start has parents? */
+    {
+        next = ecu_ntnode_cparent(current);
+    }
+
+    me->current = current;
+    me->next = next;
+    return (me->current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_parent_iterator_cend(struct ecu_ntnode_parent_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    return (NTNODE_CNULL);
+}
+
+const struct ecu_ntnode *ecu_ntnode_parent_iterator_cnext(struct ecu_ntnode_parent_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    /* me->current == NULL once iteration completes.
+    Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    Even though this is a const iterator, do not valid assert me->current to allow destruction of
+    current node to remain consistent with non-const iterator implementation. Also not necessary since
+    me->next is valid asserted when it is calculated in previous call. */
+    ECU_ASSERT( (me->current) );
+    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
+    This is not directly checked since it is impossible to detect this condition. The next node can be a root,
+    and it is unknown what the root is at the start of the iteration. Therefore just check if the next node
+    is valid when non-NULL. IMPORTANT to check for NULL first before using API. */
+    ECU_ASSERT( ((me->next == NTNODE_CNULL) || (ecu_ntnode_valid(me->next))) );
+
+    const struct ecu_ntnode *next = NTNODE_CNULL;
+    if (me->next) /* Still more parents to go? */
+    {
+        next = ecu_ntnode_cparent(me->next);
+    }
+
+    me->current = me->next;
+    me->next = next;
+    return (me->current);
+}
+
+/*------------------------------------------------------------*/
+/*--------------------- POSTORDER ITERATOR -------------------*/
+/*------------------------------------------------------------*/
+
+struct ecu_ntnode *ecu_ntnode_postorder_iterator_begin(struct ecu_ntnode_postorder_iterator *me,
+                                                       struct ecu_ntnode *root)
+{
+    ECU_ASSERT( (me && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    ECU_ASSERT( (live(root)) );
+
+    /* Guarantee delimiter is invalid to prevent it from being used. API asserts if used. */
+    invalidate_delimiter(&me->delimiter);
+
+    struct ecu_ntnode *current = get_leaf(root);
+    struct ecu_ntnode *sibling = ecu_ntnode_next(current);
+    struct ecu_ntnode *next = NTNODE_NULL;
+
+    /* Branches MUST be in this order!! Save next node in case current node removed. */
+    if (current == root)
+    {
+        next = &me->delimiter; /* Done with iteration. */
+    }
+    else if (sibling)
+    {
+        next = get_leaf(sibling);
+    }
+    else /* else if (me->current != me->root) && !sibling */
+    {
+        /* It should be impossible for parent to be NULL if this last branch enters. */
+        next = ecu_ntnode_parent(current);
+        ECU_ASSERT( (next) );
+    }
+
+    me->root = root;
+    me->current = current;
+    me->next = next;
+    return (me->current);
+}
+
+struct ecu_ntnode *ecu_ntnode_postorder_iterator_end(struct ecu_ntnode_postorder_iterator *me)
 {
+    /* Do not valid assert me->delimiter. It is purposefully not valid to prevent it being used. */
     ECU_ASSERT( (me) );
-    /* me->current == NULL once iteration completes.
-    Do not allow this function to be called after iteration completes. Force user to restart iteration.
-    Even though this is a const iteration use same assertions as non-const iterator to remain consistent.
+    return (&me->delimiter);
+}
+
+struct ecu_ntnode *ecu_ntnode_postorder_iterator_next(struct ecu_ntnode_postorder_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    /* Do not assert me->root here to handle edge case of a leaf node being destroyed from other iterations.
+    I.e. see TEST(NtNode, ChildIteratorDestroySome). me->root still NULL asserted since value is cached.
+    Even if user destroys root and sets it to NULL, me->root will always be non-NULL. */
+    ECU_ASSERT( (me->root) );
+    /* Do not allow this function to be called after iteration completes. Force user to restart iteration.
     Do not valid assert me->current to allow destruction of current node. Also not necessary since
-    me->next is valid asserted when it is calculated in previous call. */
+    me->next is either delimiter or valid asserted when it is calculated in previous call. NULL
+    assert me->current since value is cached. Even if user destroys current node and sets it to NULL
+    me->current will always be non-NULL. */
     ECU_ASSERT( (me->current) );
-    /* Even though this is a const iteration use same assertions as non-const iterator to remain consistent.
-    The current node can be safely removed but removing the next node before it's returned is not allowed.
-    Note in_tree() valid asserts me->next. IMPORTANT to check for NULL first before using API. */
-    ECU_ASSERT( ((me->next == NTNODE_CNULL) || (ecu_ntnode_in_tree(me->next))) );
+    ECU_ASSERT( (me->current != &me->delimiter) );
+    /* Next node should always be valid or be a delimiter. IMPORTANT to check for delimiter first before using
+    API since delimiter purposefully made invalid to prevent it from being used. */
+    ECU_ASSERT( (me->next) );
+    ECU_ASSERT( ((me->next == &me->delimiter) || (ecu_ntnode_valid(me->next))) );
+    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
+    IMPORTANT to check for delimiter first before using API. me->next == me->root explicitly checked to handle
+    edge case where all nodes are removed in a postorder iteration. */
+    ECU_ASSERT( ((me->next == &me->delimiter) || (ecu_ntnode_in_tree(me->next)) || (me->next == me->root)) );
+
+    struct ecu_ntnode *next = me->next;
+    if (me->next != &me->delimiter)
+    {
+        /* Only valid assert root node here to handle edge case of a leaf node being destroyed
+        from other iterations. I.e. see TEST(NtNode, ChildIteratorDestroySome). */
+        ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
+        struct ecu_ntnode *sibling = ecu_ntnode_next(me->next);
+
+        /* Branches MUST be in this order!! Save next node in case current node removed. */
+        if (me->next == me->root)
+        {
+            next = &me->delimiter; /* Done with iteration. */
+        }
+        else if (sibling)
+        {
+            next = get_leaf(sibling);
+        }
+        else /* else if (me->next != me->root) && !sibling */
+        {
+            /* It should be impossible for parent to be NULL if this last branch enters. */
+            next = ecu_ntnode_parent(me->next);
+            ECU_ASSERT( (next) );
+        }
+    }
+
+    me->current = me->next;
+    me->next = next;
+    return (me->current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_postorder_iterator_cbegin(struct ecu_ntnode_postorder_citerator *me,
+                                                              const struct ecu_ntnode *root)
+{
+    ECU_ASSERT( (me && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    ECU_ASSERT( (live(root)) );
 
+    /* Guarantee delimiter is invalid to prevent it from being used. API asserts if used. */
+    invalidate_delimiter(&me->delimiter);
+
+    const struct ecu_ntnode *current = get_cleaf(root);
+    const struct ecu_ntnode *sibling = ecu_ntnode_cnext(current);
     const struct ecu_ntnode *next = NTNODE_CNULL;
-    if (me->next) /* siblings remaining? */
+
+    /* Branches MUST be in this order!! Save next node in case current node removed. */
+    if (current == root)
     {
-        next = ecu_ntnode_cnext(me->next);
+        next = &me->delimiter; /* Done with iteration. */
+    }
+    else if (sibling)
+    {
+        next = get_cleaf(sibling);
+    }
+    else /* else if (me->current != me->root) && !sibling */
+    {
+        /* It should be impossible for parent to be NULL if this last branch enters. */
+        next = ecu_ntnode_cparent(current);
+        ECU_ASSERT( (next) );
+    }
+
+    me->root = root;
+    me->current = current;
+    me->next = next;
+    return (me->current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_postorder_iterator_cend(struct ecu_ntnode_postorder_citerator *me)
+{
+    /* Do not valid assert me->delimiter. It is purposefully not valid to prevent it being used. */
+    ECU_ASSERT( (me) );
+    return (&me->delimiter);
+}
+
+const struct ecu_ntnode *ecu_ntnode_postorder_iterator_cnext(struct ecu_ntnode_postorder_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    /* Even though this is a const iteration, do not valid assert me->root here to handle edge case
+    of a leaf node being destroyed from other iterations. I.e. see TEST(NtNode, ChildIteratorDestroySome).
+    Done to remain consistent with non-const iterator implementation. me->root still NULL asserted since
+    value is cached. Even if user destroys root and sets it to NULL, me->root will always be non-NULL. */
+    ECU_ASSERT( (me->root) );
+    /* Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    Even though this is const iteration, do not valid assert me->current to allow destruction of current node
+    to remain consistent with non-const iterator implementation. Also not necessary since
+    me->next is either delimiter or valid asserted when it is calculated in previous call. NULL
+    assert me->current since value is cached. Even if user destroys current node and sets it to NULL
+    me->current will always be non-NULL. */
+    ECU_ASSERT( (me->current) );
+    ECU_ASSERT( (me->current != &me->delimiter) );
+    /* Next node should always be valid or be a delimiter. IMPORTANT to check for delimiter first before using
+    API since delimiter purposefully made invalid to prevent it from being used. */
+    ECU_ASSERT( (me->next) );
+    ECU_ASSERT( ((me->next == &me->delimiter) || (ecu_ntnode_valid(me->next))) );
+    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
+    IMPORTANT to check for delimiter first before using API. me->next == me->root explicitly checked to handle
+    edge case where all nodes are removed in a postorder iteration. */
+    ECU_ASSERT( ((me->next == &me->delimiter) || (ecu_ntnode_in_tree(me->next)) || (me->next == me->root)) );
+
+    const struct ecu_ntnode *next = me->next;
+    if (me->next != &me->delimiter)
+    {
+        /* Only valid assert root node here to handle edge case of a leaf node being destroyed
+        from other iterations. I.e. see TEST(NtNode, ChildIteratorDestroySome). */
+        ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
+        const struct ecu_ntnode *sibling = ecu_ntnode_cnext(me->next);
+
+        /* Branches MUST be in this order!! Save next node in case current node removed. */
+        if (me->next == me->root)
+        {
+            next = &me->delimiter; /* Done with iteration. */
+        }
+        else if (sibling)
+        {
+            next = get_cleaf(sibling);
+        }
+        else /* else if (me->next != me->root) && !sibling */
+        {
+            /* It should be impossible for parent to be NULL if this last branch enters. */
+            next = ecu_ntnode_cparent(me->next);
+            ECU_ASSERT( (next) );
+        }
     }
 
     me->current = me->next;
@@ -814,65 +2450,200 @@ const struct ecu_ntnode *ecu_ntnode_next_sibling_iterator_cnext(struct ecu_ntnod
 }
 
 /*------------------------------------------------------------*/
-/*------------------------ PARENT ITERATOR -------------------*/
+/*----------------------- PREORDER ITERATOR ------------------*/
 /*------------------------------------------------------------*/
 
-struct ecu_ntnode *ecu_ntnode_parent_iterator_at(struct ecu_ntnode_parent_iterator *me,
-                                                 struct ecu_ntnode *start)
+struct ecu_ntnode *ecu_ntnode_preorder_iterator_begin(struct ecu_ntnode_preorder_iterator *me,
+                                                      struct ecu_ntnode *root)
 {
-    ECU_ASSERT( (me && start) );
-    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (me && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    ECU_ASSERT( (live(root)) );
+
+    /* Guarantee delimiter is invalid to prevent it from being used. API asserts if used. */
+    invalidate_delimiter(&me->delimiter);
+
+    me->root = root;
+    me->current = root;
+    return root;
+}
+
+struct ecu_ntnode *ecu_ntnode_preorder_iterator_end(struct ecu_ntnode_preorder_iterator *me)
+{
+    /* Do not valid assert me->delimiter. It is purposefully not valid to prevent it being used. */
+    ECU_ASSERT( (me) );
+    return (&me->delimiter);
+}
+
+struct ecu_ntnode *ecu_ntnode_preorder_iterator_next(struct ecu_ntnode_preorder_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->root && me->current) );
+    ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
+    /* Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    me->current should be valid asserted since nodes cannot be destroyed during preorder iteration. */
+    ECU_ASSERT( ((me->current != &me->delimiter) && (ecu_ntnode_valid(me->current))) );
+    /* Continuing the iteration after removing a node is not allowed. IMPORTANT to
+    check if current == root FIRST to handle case where iteration done on empty root. */
+    ECU_ASSERT( (me->current == me->root || ecu_ntnode_in_tree(me->current)) );
+
+    struct ecu_ntnode *child = ecu_ntnode_first_child(me->current);
+    struct ecu_ntnode *current = NTNODE_NULL;
+
+    if (child)
+    {
+        current = child;
+    }
+    else
+    {
+        /* If current node has no child, the next node is found by traversing up
+        until we reach a node with a next (right) sibling or the root. If a sibling
+        is found, that is the next node in the iteration. Otherwise we are at the
+        root and the iteration is done. */
+        struct ecu_ntnode *sibling = NTNODE_NULL;
+        struct ecu_ntnode *parent = me->current;
+
+        /* parent != me->root must be condition in case iteration done over subtree.
+        parent != NULL asserted as fail-safe to prevent infinite loop. */
+        while ((!sibling) && (parent != me->root))
+        {
+            sibling = ecu_ntnode_next(parent);
+            parent = ecu_ntnode_parent(parent);
+            ECU_ASSERT( (parent) ); /* Loop should exit as soon as root is reached, not one after. */
+        }
+
+        if (sibling)
+        {
+            current = sibling;
+        }
+        else
+        {
+            /* Reached the end of the iteration. */
+            ECU_ASSERT( (parent == me->root) );
+            current = &me->delimiter;
+        }
+    }
+
+    me->current = current;
+    return (current);
+}
+
+const struct ecu_ntnode *ecu_ntnode_preorder_iterator_cbegin(struct ecu_ntnode_preorder_citerator *me,
+                                                             const struct ecu_ntnode *root)
+{
+    ECU_ASSERT( (me && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    ECU_ASSERT( (live(root)) );
 
-    struct ecu_ntnode *next = ecu_ntnode_parent(start);
+    /* Guarantee delimiter is invalid to prevent it from being used. API asserts if used. */
+    invalidate_delimiter(&me->delimiter);
 
-    me->current = start;
-    me->next = next;
-    return (me->current);
+    me->root = root;
+    me->current = root;
+    return root;
 }
 
-struct ecu_ntnode *ecu_ntnode_parent_iterator_begin(struct ecu_ntnode_parent_iterator *me,
-                                                    struct ecu_ntnode *start)
+const struct ecu_ntnode *ecu_ntnode_preorder_iterator_cend(struct ecu_ntnode_preorder_citerator *me)
 {
-    ECU_ASSERT( (me && start) );
-    ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    /* Do not valid assert me->delimiter. It is purposefully not valid to prevent it being used. */
+    ECU_ASSERT( (me) );
+    return (&me->delimiter);
+}
 
-    struct ecu_ntnode *current = ecu_ntnode_parent(start);
-    struct ecu_ntnode *next = NTNODE_NULL;
+const struct ecu_ntnode *ecu_ntnode_preorder_iterator_cnext(struct ecu_ntnode_preorder_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->root && me->current) );
+    ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
+    /* Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    me->current should be valid asserted since nodes cannot be destroyed during preorder iteration. */
+    ECU_ASSERT( ((me->current != &me->delimiter) && (ecu_ntnode_valid(me->current))) );
+    /* Continuing the iteration after removing a node is not allowed. IMPORTANT to
+    check if current == root FIRST to handle case where iteration done on empty root. */
+    ECU_ASSERT( (me->current == me->root || ecu_ntnode_in_tree(me->current)) );
 
-    if (current) /* start has parents? */
+    const struct ecu_ntnode *child = ecu_ntnode_first_cchild(me->current);
+    const struct ecu_ntnode *current = NTNODE_CNULL;
+
+    if (child)
     {
-        next = ecu_ntnode_parent(current);
+        current = child;
+    }
+    else
+    {
+        /* If current node has no child, the next node is found by traversing up
+        until we reach a node with a next (right) sibling or the root. If a sibling
+        is found, that is the next node in the iteration. Otherwise we are at the
+        root and the iteration is done. */
+        const struct ecu_ntnode *sibling = NTNODE_CNULL;
+        const struct ecu_ntnode *parent = me->current;
+
+        /* parent != me->root must be condition in case iteration done over subtree.
+        parent != NULL asserted as fail-safe to prevent infinite loop. */
+        while ((!sibling) && (parent != me->root))
+        {
+            sibling = ecu_ntnode_cnext(parent);
+            parent = ecu_ntnode_cparent(parent);
+            ECU_ASSERT( (parent) ); /* Loop should exit as soon as root is reached, not one after. */
+        }
+
+        if (sibling)
+        {
+            current = sibling;
+        }
+        else
+        {
+            /* Reached the end of the iteration. */
+            ECU_ASSERT( (parent == me->root) );
+            current = &me->delimiter;
+        }
     }
 
     me->current = current;
-    me->next = next;
+    return (current);
+}
+
+/*------------------------------------------------------------*/
+/*--------------------- COMPACT ITERATORS --------------------*/
+/*------------------------------------------------------------*/
+
+struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_begin(struct ecu_ntnode_compact_postorder_iterator *me,
+                                                               struct ecu_ntnode *root)
+{
+    ECU_ASSERT( (me && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    ECU_ASSERT( (live(root)) );
+
+    me->root = root;
+    me->current = get_leaf(root);
+    me->next = compact_postorder_successor(root, me->current);
     return (me->current);
 }
 
-struct ecu_ntnode *ecu_ntnode_parent_iterator_end(struct ecu_ntnode_parent_iterator *me)
+struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_end(struct ecu_ntnode_compact_postorder_iterator *me)
 {
     ECU_ASSERT( (me) );
     return (NTNODE_NULL);
 }
 
-struct ecu_ntnode *ecu_ntnode_parent_iterator_next(struct ecu_ntnode_parent_iterator *me)
+struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_next(struct ecu_ntnode_compact_postorder_iterator *me)
 {
     ECU_ASSERT( (me) );
-    /* me->current == NULL once iteration completes.
-    Do not allow this function to be called after iteration completes. Force user to restart iteration.
-    Do not valid assert me->current to allow destruction of current node. Also not necessary since
-    me->next is valid asserted when it is calculated in previous call. */
-    ECU_ASSERT( (me->current) );
-    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
-    This is not directly checked since it is impossible to detect this condition. The next node can be a root,
-    and it is unknown what the root is at the start of the iteration. Therefore just check if the next node
-    is valid when non-NULL. IMPORTANT to check for NULL first before using API. */
-    ECU_ASSERT( ((me->next == NTNODE_NULL) || (ecu_ntnode_valid(me->next))) );
+    /* Same as ecu_ntnode_postorder_iterator_next(). Only NULL assert root and current since
+    current node is allowed to be destroyed. Do not allow this function to be called after
+    iteration completes. Force user to restart iteration. */
+    ECU_ASSERT( (me->root && me->current) );
+    /* The current node can be safely removed but removing the next node before it's returned is
+    not allowed. me->next == me->root explicitly checked to handle edge case where all nodes are
+    removed in a postorder iteration. */
+    ECU_ASSERT( ((!me->next) || (ecu_ntnode_valid(me->next))) );
+    ECU_ASSERT( ((!me->next) || (me->next == me->root) || (ecu_ntnode_in_tree(me->next))) );
 
     struct ecu_ntnode *next = NTNODE_NULL;
-    if (me->next) /* Still more parents to go? */
+    if (me->next)
     {
-        next = ecu_ntnode_parent(me->next);
+        ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
+        next = compact_postorder_successor(me->root, me->next);
     }
 
     me->current = me->next;
@@ -880,63 +2651,43 @@ struct ecu_ntnode *ecu_ntnode_parent_iterator_next(struct ecu_ntnode_parent_iter
     return (me->current);
 }
 
-const struct ecu_ntnode *ecu_ntnode_parent_iterator_cat(struct ecu_ntnode_parent_citerator *me,
-                                                        const struct ecu_ntnode *start)
-{
-    ECU_ASSERT( (me && start) );
-    ECU_ASSERT( (ecu_ntnode_valid(start)) );
-
-    const struct ecu_ntnode *next = ecu_ntnode_cparent(start);
-
-    me->current = start;
-    me->next = next;
-    return (me->current);
-}
-
-const struct ecu_ntnode *ecu_ntnode_parent_iterator_cbegin(struct ecu_ntnode_parent_citerator *me,
-                                                           const struct ecu_ntnode *start)
+const struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_cbegin(struct ecu_ntnode_compact_postorder_citerator *me,
+                                                                      const struct ecu_ntnode *root)
 {
-    ECU_ASSERT( (me && start) );
-    ECU_ASSERT( (ecu_ntnode_valid(start)) );
-
-    const struct ecu_ntnode *current = ecu_ntnode_cparent(start);
-    const struct ecu_ntnode *next = NTNODE_CNULL;
-
-    if (current) /* start has parents? */
-    {
-        next = ecu_ntnode_cparent(current);
-    }
+    ECU_ASSERT( (me && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    ECU_ASSERT( (live(root)) );
 
-    me->current = current;
-    me->next = next;
+    me->root = root;
+    me->current = get_cleaf(root);
+    me->next = compact_postorder_csuccessor(root, me->current);
     return (me->current);
 }
 
-const struct ecu_ntnode *ecu_ntnode_parent_iterator_cend(struct ecu_ntnode_parent_citerator *me)
+const struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_cend(struct ecu_ntnode_compact_postorder_citerator *me)
 {
     ECU_ASSERT( (me) );
     return (NTNODE_CNULL);
 }
 
-const struct ecu_ntnode *ecu_ntnode_parent_iterator_cnext(struct ecu_ntnode_parent_citerator *me)
+const struct ecu_ntnode *ecu_ntnode_compact_postorder_iterator_cnext(struct ecu_ntnode_compact_postorder_citerator *me)
 {
     ECU_ASSERT( (me) );
-    /* me->current == NULL once iteration completes.
-    Do not allow this function to be called after iteration completes. Force user to restart iteration.
-    Even though this is a const iterator, do not valid assert me->current to allow destruction of
-    current node to remain consistent with non-const iterator implementation. Also not necessary since
-    me->next is valid asserted when it is calculated in previous call. */
-    ECU_ASSERT( (me->current) );
-    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
-    This is not directly checked since it is impossible to detect this condition. The next node can be a root,
-    and it is unknown what the root is at the start of the iteration. Therefore just check if the next node
-    is valid when non-NULL. IMPORTANT to check for NULL first before using API. */
-    ECU_ASSERT( ((me->next == NTNODE_CNULL) || (ecu_ntnode_valid(me->next))) );
+    /* Same as ecu_ntnode_postorder_iterator_cnext(). Only NULL assert root and current since
+    current node is allowed to be destroyed. Do not allow this function to be called after
+    iteration completes. Force user to restart iteration. */
+    ECU_ASSERT( (me->root && me->current) );
+    /* The current node can be safely removed but removing the next node before it's returned is
+    not allowed. me->next == me->root explicitly checked to handle edge case where all nodes are
+    removed in a postorder iteration. */
+    ECU_ASSERT( ((!me->next) || (ecu_ntnode_valid(me->next))) );
+    ECU_ASSERT( ((!me->next) || (me->next == me->root) || (ecu_ntnode_in_tree(me->next))) );
 
     const struct ecu_ntnode *next = NTNODE_CNULL;
-    if (me->next) /* Still more parents to go? */
+    if (me->next)
     {
-        next = ecu_ntnode_cparent(me->next);
+        ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
+        next = compact_postorder_csuccessor(me->root, me->next);
     }
 
     me->current = me->next;
@@ -944,273 +2695,180 @@ const struct ecu_ntnode *ecu_ntnode_parent_iterator_cnext(struct ecu_ntnode_pare
     return (me->current);
 }
 
-/*------------------------------------------------------------*/
-/*--------------------- POSTORDER ITERATOR -------------------*/
-/*------------------------------------------------------------*/
-
-struct ecu_ntnode *ecu_ntnode_postorder_iterator_begin(struct ecu_ntnode_postorder_iterator *me,
-                                                       struct ecu_ntnode *root)
+struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_begin(struct ecu_ntnode_compact_preorder_iterator *me,
+                                                              struct ecu_ntnode *root)
 {
     ECU_ASSERT( (me && root) );
     ECU_ASSERT( (ecu_ntnode_valid(root)) );
-
-    /* Guarantee delimiter is invalid to prevent it from being used. API asserts if used. */
-    invalidate_delimiter(&me->delimiter);
-
-    struct ecu_ntnode *current = get_leaf(root);
-    struct ecu_ntnode *sibling = ecu_ntnode_next(current);
-    struct ecu_ntnode *next = NTNODE_NULL;
-
-    /* Branches MUST be in this order!! Save next node in case current node removed. */
-    if (current == root)
-    {
-        next = &me->delimiter; /* Done with iteration. */
-    }
-    else if (sibling)
-    {
-        next = get_leaf(sibling);
-    }
-    else /* else if (me->current != me->root) && !sibling */
-    {
-        /* It should be impossible for parent to be NULL if this last branch enters. */
-        next = ecu_ntnode_parent(current);
-        ECU_ASSERT( (next) );
-    }
+    ECU_ASSERT( (live(root)) );
 
     me->root = root;
-    me->current = current;
-    me->next = next;
-    return (me->current);
+    me->current = root;
+    return root;
 }
 
-struct ecu_ntnode *ecu_ntnode_postorder_iterator_end(struct ecu_ntnode_postorder_iterator *me)
+struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_end(struct ecu_ntnode_compact_preorder_iterator *me)
 {
-    /* Do not valid assert me->delimiter. It is purposefully not valid to prevent it being used. */
     ECU_ASSERT( (me) );
-    return (&me->delimiter);
+    return (NTNODE_NULL);
 }
 
-struct ecu_ntnode *ecu_ntnode_postorder_iterator_next(struct ecu_ntnode_postorder_iterator *me)
+struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_next(struct ecu_ntnode_compact_preorder_iterator *me)
 {
     ECU_ASSERT( (me) );
-    /* Do not assert me->root here to handle edge case of a leaf node being destroyed from other iterations.
-    I.e. see TEST(NtNode, ChildIteratorDestroySome). me->root still NULL asserted since value is cached.
-    Even if user destroys root and sets it to NULL, me->root will always be non-NULL. */
     ECU_ASSERT( (me->root) );
+    ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
     /* Do not allow this function to be called after iteration completes. Force user to restart iteration.
-    Do not valid assert me->current to allow destruction of current node. Also not necessary since
-    me->next is either delimiter or valid asserted when it is calculated in previous call. NULL
-    assert me->current since value is cached. Even if user destroys current node and sets it to NULL
-    me->current will always be non-NULL. */
-    ECU_ASSERT( (me->current) );
-    ECU_ASSERT( (me->current != &me->delimiter) );
-    /* Next node should always be valid or be a delimiter. IMPORTANT to check for delimiter first before using
-    API since delimiter purposefully made invalid to prevent it from being used. */
-    ECU_ASSERT( (me->next) );
-    ECU_ASSERT( ((me->next == &me->delimiter) || (ecu_ntnode_valid(me->next))) );
-    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
-    IMPORTANT to check for delimiter first before using API. me->next == me->root explicitly checked to handle
-    edge case where all nodes are removed in a postorder iteration. */
-    ECU_ASSERT( ((me->next == &me->delimiter) || (ecu_ntnode_in_tree(me->next)) || (me->next == me->root)) );
+    me->current should be valid asserted since nodes cannot be destroyed during preorder iteration. */
+    ECU_ASSERT( ((me->current) && (ecu_ntnode_valid(me->current))) );
+    /* Continuing the iteration after removing a node is not allowed. IMPORTANT to
+    check if current == root FIRST to handle case where iteration done on empty root. */
+    ECU_ASSERT( (me->current == me->root || ecu_ntnode_in_tree(me->current)) );
 
-    struct ecu_ntnode *next = me->next;
-    if (me->next != &me->delimiter)
+    struct ecu_ntnode *current = ecu_ntnode_first_child(me->current);
+
+    if (!current)
     {
-        /* Only valid assert root node here to handle edge case of a leaf node being destroyed
-        from other iterations. I.e. see TEST(NtNode, ChildIteratorDestroySome). */
-        ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
-        struct ecu_ntnode *sibling = ecu_ntnode_next(me->next);
+        /* Same traversal as ecu_ntnode_preorder_iterator_next() except reaching
+        the root returns NULL instead of a delimiter. */
+        struct ecu_ntnode *parent = me->current;
 
-        /* Branches MUST be in this order!! Save next node in case current node removed. */
-        if (me->next == me->root)
-        {
-            next = &me->delimiter; /* Done with iteration. */
-        }
-        else if (sibling)
-        {
-            next = get_leaf(sibling);
-        }
-        else /* else if (me->next != me->root) && !sibling */
+        while ((!current) && (parent != me->root))
         {
-            /* It should be impossible for parent to be NULL if this last branch enters. */
-            next = ecu_ntnode_parent(me->next);
-            ECU_ASSERT( (next) );
+            current = ecu_ntnode_next(parent);
+            parent = ecu_ntnode_parent(parent);
+            ECU_ASSERT( (parent) ); /* Loop should exit as soon as root is reached, not one after. */
         }
     }
 
-    me->current = me->next;
-    me->next = next;
-    return (me->current);
+    me->current = current;
+    return (current);
 }
 
-const struct ecu_ntnode *ecu_ntnode_postorder_iterator_cbegin(struct ecu_ntnode_postorder_citerator *me,
-                                                              const struct ecu_ntnode *root)
+const struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_cbegin(struct ecu_ntnode_compact_preorder_citerator *me,
+                                                                     const struct ecu_ntnode *root)
 {
     ECU_ASSERT( (me && root) );
     ECU_ASSERT( (ecu_ntnode_valid(root)) );
-
-    /* Guarantee delimiter is invalid to prevent it from being used. API asserts if used. */
-    invalidate_delimiter(&me->delimiter);
-
-    const struct ecu_ntnode *current = get_cleaf(root);
-    const struct ecu_ntnode *sibling = ecu_ntnode_cnext(current);
-    const struct ecu_ntnode *next = NTNODE_CNULL;
-
-    /* Branches MUST be in this order!! Save next node in case current node removed. */
-    if (current == root)
-    {
-        next = &me->delimiter; /* Done with iteration. */
-    }
-    else if (sibling)
-    {
-        next = get_cleaf(sibling);
-    }
-    else /* else if (me->current != me->root) && !sibling */
-    {
-        /* It should be impossible for parent to be NULL if this last branch enters. */
-        next = ecu_ntnode_cparent(current);
-        ECU_ASSERT( (next) );
-    }
+    ECU_ASSERT( (live(root)) );
 
     me->root = root;
-    me->current = current;
-    me->next = next;
-    return (me->current);
+    me->current = root;
+    return root;
 }
 
-const struct ecu_ntnode *ecu_ntnode_postorder_iterator_cend(struct ecu_ntnode_postorder_citerator *me)
+const struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_cend(struct ecu_ntnode_compact_preorder_citerator *me)
 {
-    /* Do not valid assert me->delimiter. It is purposefully not valid to prevent it being used. */
     ECU_ASSERT( (me) );
-    return (&me->delimiter);
+    return (NTNODE_CNULL);
 }
 
-const struct ecu_ntnode *ecu_ntnode_postorder_iterator_cnext(struct ecu_ntnode_postorder_citerator *me)
+const struct ecu_ntnode *ecu_ntnode_compact_preorder_iterator_cnext(struct ecu_ntnode_compact_preorder_citerator *me)
 {
     ECU_ASSERT( (me) );
-    /* Even though this is a const iteration, do not valid assert me->root here to handle edge case
-    of a leaf node being destroyed from other iterations. I.e. see TEST(NtNode, ChildIteratorDestroySome).
-    Done to remain consistent with non-const iterator implementation. me->root still NULL asserted since
-    value is cached. Even if user destroys root and sets it to NULL, me->root will always be non-NULL. */
     ECU_ASSERT( (me->root) );
+    ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
     /* Do not allow this function to be called after iteration completes. Force user to restart iteration.
-    Even though this is const iteration, do not valid assert me->current to allow destruction of current node
-    to remain consistent with non-const iterator implementation. Also not necessary since
-    me->next is either delimiter or valid asserted when it is calculated in previous call. NULL
-    assert me->current since value is cached. Even if user destroys current node and sets it to NULL
-    me->current will always be non-NULL. */
-    ECU_ASSERT( (me->current) );
-    ECU_ASSERT( (me->current != &me->delimiter) );
-    /* Next node should always be valid or be a delimiter. IMPORTANT to check for delimiter first before using
-    API since delimiter purposefully made invalid to prevent it from being used. */
-    ECU_ASSERT( (me->next) );
-    ECU_ASSERT( ((me->next == &me->delimiter) || (ecu_ntnode_valid(me->next))) );
-    /* The current node can be safely removed but removing the next node before it's returned is not allowed.
-    IMPORTANT to check for delimiter first before using API. me->next == me->root explicitly checked to handle
-    edge case where all nodes are removed in a postorder iteration. */
-    ECU_ASSERT( ((me->next == &me->delimiter) || (ecu_ntnode_in_tree(me->next)) || (me->next == me->root)) );
+    me->current should be valid asserted since nodes cannot be destroyed during preorder iteration. */
+    ECU_ASSERT( ((me->current) && (ecu_ntnode_valid(me->current))) );
+    /* Continuing the iteration after removing a node is not allowed. IMPORTANT to
+    check if current == root FIRST to handle case where iteration done on empty root. */
+    ECU_ASSERT( (me->current == me->root || ecu_ntnode_in_tree(me->current)) );
 
-    const struct ecu_ntnode *next = me->next;
-    if (me->next != &me->delimiter)
+    const struct ecu_ntnode *current = ecu_ntnode_first_cchild(me->current);
+
+    if (!current)
     {
-        /* Only valid assert root node here to handle edge case of a leaf node being destroyed
-        from other iterations. I.e. see TEST(NtNode, ChildIteratorDestroySome). */
-        ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
-        const struct ecu_ntnode *sibling = ecu_ntnode_cnext(me->next);
+        /* Same traversal as ecu_ntnode_preorder_iterator_cnext() except reaching
+        the root returns NULL instead of a delimiter. */
+        const struct ecu_ntnode *parent = me->current;
 
-        /* Branches MUST be in this order!! Save next node in case current node removed. */
-        if (me->next == me->root)
-        {
-            next = &me->delimiter; /* Done with iteration. */
-        }
-        else if (sibling)
+        while ((!current) && (parent != me->root))
         {
-            next = get_cleaf(sibling);
-        }
-        else /* else if (me->next != me->root) && !sibling */
-        {
-            /* It should be impossible for parent to be NULL if this last branch enters. */
-            next = ecu_ntnode_cparent(me->next);
-            ECU_ASSERT( (next) );
+            current = ecu_ntnode_cnext(parent);
+            parent = ecu_ntnode_cparent(parent);
+            ECU_ASSERT( (parent) ); /* Loop should exit as soon as root is reached, not one after. */
         }
     }
 
-    me->current = me->next;
-    me->next = next;
-    return (me->current);
+    me->current = current;
+    return (current);
 }
 
 /*------------------------------------------------------------*/
-/*----------------------- PREORDER ITERATOR ------------------*/
+/*------------------ PRUNED PREORDER ITERATOR ----------------*/
 /*------------------------------------------------------------*/
 
-struct ecu_ntnode *ecu_ntnode_preorder_iterator_begin(struct ecu_ntnode_preorder_iterator *me,
-                                                      struct ecu_ntnode *root)
+struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_begin(struct ecu_ntnode_pruned_preorder_iterator *me,
+                                                             struct ecu_ntnode *root)
+{
+    return ecu_ntnode_pruned_preorder_iterator_limit(me, root, (size_t)-1);
+}
+
+struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_limit(struct ecu_ntnode_pruned_preorder_iterator *me,
+                                                             struct ecu_ntnode *root,
+                                                             size_t max_level)
 {
     ECU_ASSERT( (me && root) );
     ECU_ASSERT( (ecu_ntnode_valid(root)) );
-
-    /* Guarantee delimiter is invalid to prevent it from being used. API asserts if used. */
-    invalidate_delimiter(&me->delimiter);
+    ECU_ASSERT( (live(root)) );
 
     me->root = root;
     me->current = root;
+    me->level = 0;
+    me->max_level = max_level;
+    me->skip = false;
     return root;
 }
 
-struct ecu_ntnode *ecu_ntnode_preorder_iterator_end(struct ecu_ntnode_preorder_iterator *me)
+struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_end(struct ecu_ntnode_pruned_preorder_iterator *me)
 {
-    /* Do not valid assert me->delimiter. It is purposefully not valid to prevent it being used. */
     ECU_ASSERT( (me) );
-    return (&me->delimiter);
+    return (NTNODE_NULL);
 }
 
-struct ecu_ntnode *ecu_ntnode_preorder_iterator_next(struct ecu_ntnode_preorder_iterator *me)
+struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_next(struct ecu_ntnode_pruned_preorder_iterator *me)
 {
     ECU_ASSERT( (me) );
-    ECU_ASSERT( (me->root && me->current) );
+    ECU_ASSERT( (me->root) );
     ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
     /* Do not allow this function to be called after iteration completes. Force user to restart iteration.
     me->current should be valid asserted since nodes cannot be destroyed during preorder iteration. */
-    ECU_ASSERT( ((me->current != &me->delimiter) && (ecu_ntnode_valid(me->current))) );
+    ECU_ASSERT( ((me->current) && (ecu_ntnode_valid(me->current))) );
     /* Continuing the iteration after removing a node is not allowed. IMPORTANT to
     check if current == root FIRST to handle case where iteration done on empty root. */
     ECU_ASSERT( (me->current == me->root || ecu_ntnode_in_tree(me->current)) );
 
-    struct ecu_ntnode *child = ecu_ntnode_first_child(me->current);
     struct ecu_ntnode *current = NTNODE_NULL;
 
-    if (child)
+    /* Do not descend if current node's subtree was skipped or max level was reached. */
+    if ((!me->skip) && (me->level < me->max_level))
     {
-        current = child;
+        current = ecu_ntnode_first_child(me->current);
+    }
+
+    me->skip = false;
+
+    if (current)
+    {
+        me->level++;
     }
     else
     {
-        /* If current node has no child, the next node is found by traversing up
-        until we reach a node with a next (right) sibling or the root. If a sibling
-        is found, that is the next node in the iteration. Otherwise we are at the
-        root and the iteration is done. */
-        struct ecu_ntnode *sibling = NTNODE_NULL;
+        /* Same traversal as ecu_ntnode_compact_preorder_iterator_next(). Every
+        step up without finding a sibling moves one level closer to the root. */
         struct ecu_ntnode *parent = me->current;
 
-        /* parent != me->root must be condition in case iteration done over subtree.
-        parent != NULL asserted as fail-safe to prevent infinite loop. */
-        while ((!sibling) && (parent != me->root))
+        while ((!current) && (parent != me->root))
         {
-            sibling = ecu_ntnode_next(parent);
+            current = ecu_ntnode_next(parent);
             parent = ecu_ntnode_parent(parent);
             ECU_ASSERT( (parent) ); /* Loop should exit as soon as root is reached, not one after. */
-        }
 
-        if (sibling)
-        {
-            current = sibling;
-        }
-        else
-        {
-            /* Reached the end of the iteration. */
-            ECU_ASSERT( (parent == me->root) );
-            current = &me->delimiter;
+            if (!current)
+            {
+                me->level--;
+            }
         }
     }
 
@@ -1218,73 +2876,90 @@ struct ecu_ntnode *ecu_ntnode_preorder_iterator_next(struct ecu_ntnode_preorder_
     return (current);
 }
 
-const struct ecu_ntnode *ecu_ntnode_preorder_iterator_cbegin(struct ecu_ntnode_preorder_citerator *me,
-                                                             const struct ecu_ntnode *root)
+void ecu_ntnode_pruned_preorder_iterator_skip(struct ecu_ntnode_pruned_preorder_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current) );
+    me->skip = true;
+}
+
+size_t ecu_ntnode_pruned_preorder_iterator_level(const struct ecu_ntnode_pruned_preorder_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current) );
+    return (me->level);
+}
+
+const struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_cbegin(struct ecu_ntnode_pruned_preorder_citerator *me,
+                                                                    const struct ecu_ntnode *root)
+{
+    return ecu_ntnode_pruned_preorder_iterator_climit(me, root, (size_t)-1);
+}
+
+const struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_climit(struct ecu_ntnode_pruned_preorder_citerator *me,
+                                                                    const struct ecu_ntnode *root,
+                                                                    size_t max_level)
 {
     ECU_ASSERT( (me && root) );
     ECU_ASSERT( (ecu_ntnode_valid(root)) );
-
-    /* Guarantee delimiter is invalid to prevent it from being used. API asserts if used. */
-    invalidate_delimiter(&me->delimiter);
+    ECU_ASSERT( (live(root)) );
 
     me->root = root;
     me->current = root;
+    me->level = 0;
+    me->max_level = max_level;
+    me->skip = false;
     return root;
 }
 
-const struct ecu_ntnode *ecu_ntnode_preorder_iterator_cend(struct ecu_ntnode_preorder_citerator *me)
+const struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_cend(struct ecu_ntnode_pruned_preorder_citerator *me)
 {
-    /* Do not valid assert me->delimiter. It is purposefully not valid to prevent it being used. */
     ECU_ASSERT( (me) );
-    return (&me->delimiter);
+    return (NTNODE_CNULL);
 }
 
-const struct ecu_ntnode *ecu_ntnode_preorder_iterator_cnext(struct ecu_ntnode_preorder_citerator *me)
+const struct ecu_ntnode *ecu_ntnode_pruned_preorder_iterator_cnext(struct ecu_ntnode_pruned_preorder_citerator *me)
 {
     ECU_ASSERT( (me) );
-    ECU_ASSERT( (me->root && me->current) );
+    ECU_ASSERT( (me->root) );
     ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
     /* Do not allow this function to be called after iteration completes. Force user to restart iteration.
     me->current should be valid asserted since nodes cannot be destroyed during preorder iteration. */
-    ECU_ASSERT( ((me->current != &me->delimiter) && (ecu_ntnode_valid(me->current))) );
+    ECU_ASSERT( ((me->current) && (ecu_ntnode_valid(me->current))) );
     /* Continuing the iteration after removing a node is not allowed. IMPORTANT to
     check if current == root FIRST to handle case where iteration done on empty root. */
     ECU_ASSERT( (me->current == me->root || ecu_ntnode_in_tree(me->current)) );
 
-    const struct ecu_ntnode *child = ecu_ntnode_first_cchild(me->current);
     const struct ecu_ntnode *current = NTNODE_CNULL;
 
-    if (child)
+    /* Do not descend if current node's subtree was skipped or max level was reached. */
+    if ((!me->skip) && (me->level < me->max_level))
     {
-        current = child;
+        current = ecu_ntnode_first_cchild(me->current);
+    }
+
+    me->skip = false;
+
+    if (current)
+    {
+        me->level++;
     }
     else
     {
-        /* If current node has no child, the next node is found by traversing up
-        until we reach a node with a next (right) sibling or the root. If a sibling
-        is found, that is the next node in the iteration. Otherwise we are at the
-        root and the iteration is done. */
-        const struct ecu_ntnode *sibling = NTNODE_CNULL;
+        /* Same traversal as ecu_ntnode_compact_preorder_iterator_cnext(). Every
+        step up without finding a sibling moves one level closer to the root. */
         const struct ecu_ntnode *parent = me->current;
 
-        /* parent != me->root must be condition in case iteration done over subtree.
-        parent != NULL asserted as fail-safe to prevent infinite loop. */
-        while ((!sibling) && (parent != me->root))
+        while ((!current) && (parent != me->root))
         {
-            sibling = ecu_ntnode_cnext(parent);
+            current = ecu_ntnode_cnext(parent);
             parent = ecu_ntnode_cparent(parent);
             ECU_ASSERT( (parent) ); /* Loop should exit as soon as root is reached, not one after. */
-        }
 
-        if (sibling)
-        {
-            current = sibling;
-        }
-        else
-        {
-            /* Reached the end of the iteration. */
-            ECU_ASSERT( (parent == me->root) );
-            current = &me->delimiter;
+            if (!current)
+            {
+                me->level--;
+            }
         }
     }
 
@@ -1292,6 +2967,160 @@ const struct ecu_ntnode *ecu_ntnode_preorder_iterator_cnext(struct ecu_ntnode_pr
     return (current);
 }
 
+void ecu_ntnode_pruned_preorder_iterator_cskip(struct ecu_ntnode_pruned_preorder_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current) );
+    me->skip = true;
+}
+
+size_t ecu_ntnode_pruned_preorder_iterator_clevel(const struct ecu_ntnode_pruned_preorder_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current) );
+    return (me->level);
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- LEVELORDER ITERATOR -------------------*/
+/*------------------------------------------------------------*/
+
+struct ecu_ntnode *ecu_ntnode_levelorder_iterator_begin(struct ecu_ntnode_levelorder_iterator *me,
+                                                        struct ecu_ntnode *root)
+{
+    return ecu_ntnode_levelorder_iterator_limit(me, root, (size_t)-1);
+}
+
+struct ecu_ntnode *ecu_ntnode_levelorder_iterator_limit(struct ecu_ntnode_levelorder_iterator *me,
+                                                        struct ecu_ntnode *root,
+                                                        size_t max_level)
+{
+    ECU_ASSERT( (me && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    ECU_ASSERT( (live(root)) );
+
+    me->root = root;
+    me->current = root;
+    me->next_level = NTNODE_NULL;
+    me->level = 0;
+    me->max_level = max_level;
+    return root;
+}
+
+struct ecu_ntnode *ecu_ntnode_levelorder_iterator_end(struct ecu_ntnode_levelorder_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    return (NTNODE_NULL);
+}
+
+struct ecu_ntnode *ecu_ntnode_levelorder_iterator_next(struct ecu_ntnode_levelorder_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->root) );
+    ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
+    /* Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    me->current should be valid asserted since nodes cannot be destroyed during level-order iteration. */
+    ECU_ASSERT( ((me->current) && (ecu_ntnode_valid(me->current))) );
+    /* Continuing the iteration after removing a node is not allowed. IMPORTANT to
+    check if current == root FIRST to handle case where iteration done on empty root. */
+    ECU_ASSERT( (me->current == me->root || ecu_ntnode_in_tree(me->current)) );
+
+    /* Nodes in a level are returned from left to right, so the first child
+    of the first node in this level that has children starts the next level. */
+    if ((!me->next_level) && (me->level < me->max_level))
+    {
+        me->next_level = ecu_ntnode_first_child(me->current);
+    }
+
+    struct ecu_ntnode *current = levelorder_successor(me->root, me->current, me->level);
+
+    if (!current)
+    {
+        /* Finished current level. NULL if there are no deeper nodes or max_level was reached. */
+        current = me->next_level;
+        me->next_level = NTNODE_NULL;
+        me->level++;
+    }
+
+    me->current = current;
+    return (current);
+}
+
+size_t ecu_ntnode_levelorder_iterator_level(const struct ecu_ntnode_levelorder_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current) );
+    return (me->level);
+}
+
+const struct ecu_ntnode *ecu_ntnode_levelorder_iterator_cbegin(struct ecu_ntnode_levelorder_citerator *me,
+                                                               const struct ecu_ntnode *root)
+{
+    return ecu_ntnode_levelorder_iterator_climit(me, root, (size_t)-1);
+}
+
+const struct ecu_ntnode *ecu_ntnode_levelorder_iterator_climit(struct ecu_ntnode_levelorder_citerator *me,
+                                                               const struct ecu_ntnode *root,
+                                                               size_t max_level)
+{
+    ECU_ASSERT( (me && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    ECU_ASSERT( (live(root)) );
+
+    me->root = root;
+    me->current = root;
+    me->next_level = NTNODE_CNULL;
+    me->level = 0;
+    me->max_level = max_level;
+    return root;
+}
+
+const struct ecu_ntnode *ecu_ntnode_levelorder_iterator_cend(struct ecu_ntnode_levelorder_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    return (NTNODE_CNULL);
+}
+
+const struct ecu_ntnode *ecu_ntnode_levelorder_iterator_cnext(struct ecu_ntnode_levelorder_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->root) );
+    ECU_ASSERT( (ecu_ntnode_valid(me->root)) );
+    /* Do not allow this function to be called after iteration completes. Force user to restart iteration.
+    me->current should be valid asserted since nodes cannot be destroyed during level-order iteration. */
+    ECU_ASSERT( ((me->current) && (ecu_ntnode_valid(me->current))) );
+    /* Continuing the iteration after removing a node is not allowed. IMPORTANT to
+    check if current == root FIRST to handle case where iteration done on empty root. */
+    ECU_ASSERT( (me->current == me->root || ecu_ntnode_in_tree(me->current)) );
+
+    /* Nodes in a level are returned from left to right, so the first child
+    of the first node in this level that has children starts the next level. */
+    if ((!me->next_level) && (me->level < me->max_level))
+    {
+        me->next_level = ecu_ntnode_first_cchild(me->current);
+    }
+
+    const struct ecu_ntnode *current = levelorder_csuccessor(me->root, me->current, me->level);
+
+    if (!current)
+    {
+        /* Finished current level. NULL if there are no deeper nodes or max_level was reached. */
+        current = me->next_level;
+        me->next_level = NTNODE_CNULL;
+        me->level++;
+    }
+
+    me->current = current;
+    return (current);
+}
+
+size_t ecu_ntnode_levelorder_iterator_clevel(const struct ecu_ntnode_levelorder_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->current) );
+    return (me->level);
+}
+
 /*------------------------------------------------------------*/
 /*------------------- PREV SIBLING ITERATOR ------------------*/
 /*------------------------------------------------------------*/
@@ -1301,6 +3130,7 @@ struct ecu_ntnode *ecu_ntnode_prev_sibling_iterator_at(struct ecu_ntnode_prev_si
 {
     ECU_ASSERT( (me && start) );
     ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
 
     struct ecu_ntnode *next = ecu_ntnode_prev(start);
 
@@ -1314,6 +3144,7 @@ struct ecu_ntnode *ecu_ntnode_prev_sibling_iterator_begin(struct ecu_ntnode_prev
 {
     ECU_ASSERT( (me && start) );
     ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
 
     struct ecu_ntnode *current = ecu_ntnode_prev(start);
     struct ecu_ntnode *next = NTNODE_NULL;
@@ -1363,6 +3194,7 @@ const struct ecu_ntnode *ecu_ntnode_prev_sibling_iterator_cat(struct ecu_ntnode_
 {
     ECU_ASSERT( (me && start) );
     ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
 
     const struct ecu_ntnode *next = ecu_ntnode_cprev(start);
 
@@ -1376,6 +3208,7 @@ const struct ecu_ntnode *ecu_ntnode_prev_sibling_iterator_cbegin(struct ecu_ntno
 {
     ECU_ASSERT( (me && start) );
     ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
 
     const struct ecu_ntnode *current = ecu_ntnode_cprev(start);
     const struct ecu_ntnode *next = NTNODE_CNULL;
@@ -1431,6 +3264,7 @@ struct ecu_ntnode *ecu_ntnode_sibling_iterator_begin(struct ecu_ntnode_sibling_i
 {
     ECU_ASSERT( (me && start) );
     ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
 
     struct ecu_ntnode *current = NTNODE_NULL;
     struct ecu_ntnode *next = NTNODE_NULL;
@@ -1511,6 +3345,7 @@ const struct ecu_ntnode *ecu_ntnode_sibling_iterator_cbegin(struct ecu_ntnode_si
 {
     ECU_ASSERT( (me && start) );
     ECU_ASSERT( (ecu_ntnode_valid(start)) );
+    ECU_ASSERT( (live(start)) );
 
     const struct ecu_ntnode *current = NTNODE_CNULL;
     const struct ecu_ntnode *next = NTNODE_CNULL;
@@ -0,0 +1,463 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ntrank.h section <ntrank_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/ntrank.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Runtime asserts. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/ntrank.c")
+
+/*------------------------------------------------------------*/
+/*---------------------------- DEFINES -----------------------*/
+/*------------------------------------------------------------*/
+
+/// @brief Unused treap link.
+#define RANK_NONE \
+    ((size_t)-1)
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Returns the hash of @p node's address. The low bits
+ * pick the node's home slot and the whole value is its treap
+ * priority, so no extra storage is needed for either.
+ */
+static uint32_t rank_hash(const struct ecu_ntnode *node);
+
+/**
+ * @brief Returns the slot @p node is stored in. @p node
+ * must be ranked.
+ */
+static size_t rank_find(const struct ecu_ntrank *me, const struct ecu_ntnode *node);
+
+/**
+ * @brief Returns the number of children in treap subtree
+ * @p s. Returns 0 if @p s is @ref RANK_NONE.
+ */
+static size_t rank_size(const struct ecu_ntrank *me, size_t s);
+
+/**
+ * @pre Slot @p s is not the root of the treap.
+ * @brief Rotates slot @p s above its treap parent. Sibling
+ * order and treap sizes are preserved.
+ */
+static void rank_rotate_up(struct ecu_ntrank *me, size_t s);
+
+/**
+ * @pre Slot @p to is empty.
+ * @brief Moves the entry in slot @p from to slot @p to and
+ * repoints its treap neighbours. Slot @p from becomes empty.
+ */
+static void rank_relocate(struct ecu_ntrank *me, size_t from, size_t to);
+
+/**
+ * @pre @p node was just linked into the ranked node's sibling list.
+ * @brief Adds @p node to the treap at position @p index.
+ */
+static void rank_link(struct ecu_ntrank *me, struct ecu_ntnode *node, size_t index);
+
+/**
+ * @brief Removes the entry in slot @p s from the treap and
+ * the hash table.
+ */
+static void rank_unlink(struct ecu_ntrank *me, size_t s);
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static uint32_t rank_hash(const struct ecu_ntnode *node)
+{
+    ECU_ASSERT( (node) );
+    /* Nodes are usually allocated next to each other so their addresses are
+    mixed (murmur3 finalizer). Priorities are then unrelated to sibling order,
+    which keeps the treap balanced on average however children are inserted. */
+    uint32_t hash = (uint32_t)(uintptr_t)node;
+    hash ^= (hash >> 16);
+    hash *= UINT32_C(0x85EBCA6B);
+    hash ^= (hash >> 13);
+    hash *= UINT32_C(0xC2B2AE35);
+    hash ^= (hash >> 16);
+    return hash;
+}
+
+static size_t rank_find(const struct ecu_ntrank *me, const struct ecu_ntnode *node)
+{
+    ECU_ASSERT( (me && node) );
+    size_t mask = me->capacity - 1;
+    size_t s = (size_t)rank_hash(node) & mask;
+
+    while (me->slots[s].node != node)
+    {
+        ECU_ASSERT( (me->slots[s].node) ); /* Node must be ranked. */
+        s = (s + 1) & mask;
+    }
+
+    return s;
+}
+
+static size_t rank_size(const struct ecu_ntrank *me, size_t s)
+{
+    ECU_ASSERT( (me) );
+    return ((s != RANK_NONE) ? me->slots[s].size : 0);
+}
+
+static void rank_rotate_up(struct ecu_ntrank *me, size_t s)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (s < me->capacity) );
+    struct ecu_ntrank_slot *n = &me->slots[s];
+    ECU_ASSERT( (n->up != RANK_NONE) );
+    size_t u = n->up;
+    struct ecu_ntrank_slot *up = &me->slots[u];
+    size_t g = up->up;
+
+    if (up->left == s)
+    {
+        up->left = n->right;
+
+        if (up->left != RANK_NONE)
+        {
+            me->slots[up->left].up = u;
+        }
+
+        n->right = u;
+    }
+    else
+    {
+        up->right = n->left;
+
+        if (up->right != RANK_NONE)
+        {
+            me->slots[up->right].up = u;
+        }
+
+        n->left = u;
+    }
+
+    up->up = s;
+    n->up = g;
+
+    if (g == RANK_NONE)
+    {
+        me->root = s;
+    }
+    else if (me->slots[g].left == u)
+    {
+        me->slots[g].left = s;
+    }
+    else
+    {
+        me->slots[g].right = s;
+    }
+
+    /* Rotated subtree holds the same children as before. */
+    n->size = up->size;
+    up->size = rank_size(me, up->left) + rank_size(me, up->right) + 1;
+}
+
+static void rank_relocate(struct ecu_ntrank *me, size_t from, size_t to)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (from < me->capacity && to < me->capacity) );
+    ECU_ASSERT( (!me->slots[to].node) );
+    struct ecu_ntrank_slot *e = &me->slots[to];
+
+    *e = me->slots[from];
+    me->slots[from].node = (struct ecu_ntnode *)0;
+
+    if (e->up == RANK_NONE)
+    {
+        me->root = to;
+    }
+    else if (me->slots[e->up].left == from)
+    {
+        me->slots[e->up].left = to;
+    }
+    else
+    {
+        me->slots[e->up].right = to;
+    }
+
+    if (e->left != RANK_NONE)
+    {
+        me->slots[e->left].up = to;
+    }
+
+    if (e->right != RANK_NONE)
+    {
+        me->slots[e->right].up = to;
+    }
+}
+
+static void rank_link(struct ecu_ntrank *me, struct ecu_ntnode *node, size_t index)
+{
+    ECU_ASSERT( (me && node) );
+    ECU_ASSERT( (index <= rank_size(me, me->root)) );
+    /* Always leave one slot empty so probing terminates. */
+    ECU_ASSERT( ((rank_size(me, me->root) + 1) < me->capacity) );
+    size_t mask = me->capacity - 1;
+    uint32_t priority = rank_hash(node);
+    size_t s = (size_t)priority & mask;
+    size_t i = index;
+
+    while (me->slots[s].node)
+    {
+        s = (s + 1) & mask;
+    }
+
+    struct ecu_ntrank_slot *e = &me->slots[s];
+    size_t *link = &me->root;
+    e->node = node;
+    e->left = RANK_NONE;
+    e->right = RANK_NONE;
+    e->up = RANK_NONE;
+    e->size = 1;
+
+    /* Walk down to where position index is a leaf. Every subtree
+    passed on the way gains the new child. */
+    while (*link != RANK_NONE)
+    {
+        struct ecu_ntrank_slot *n = &me->slots[*link];
+        size_t left = rank_size(me, n->left);
+        e->up = *link;
+        n->size++;
+
+        if (i <= left)
+        {
+            link = &n->left;
+        }
+        else
+        {
+            i -= (left + 1);
+            link = &n->right;
+        }
+    }
+
+    *link = s;
+
+    while ((e->up != RANK_NONE) && (priority > rank_hash(me->slots[e->up].node)))
+    {
+        rank_rotate_up(me, s);
+    }
+}
+
+static void rank_unlink(struct ecu_ntrank *me, size_t s)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (s < me->capacity) );
+    struct ecu_ntrank_slot *e = &me->slots[s];
+    size_t mask = me->capacity - 1;
+
+    /* Rotate down until at most one subtree is left, then splice it out. */
+    while ((e->left != RANK_NONE) && (e->right != RANK_NONE))
+    {
+        if (rank_hash(me->slots[e->left].node) > rank_hash(me->slots[e->right].node))
+        {
+            rank_rotate_up(me, e->left);
+        }
+        else
+        {
+            rank_rotate_up(me, e->right);
+        }
+    }
+
+    size_t sub = (e->left != RANK_NONE) ? e->left : e->right;
+
+    if (sub != RANK_NONE)
+    {
+        me->slots[sub].up = e->up;
+    }
+
+    if (e->up == RANK_NONE)
+    {
+        me->root = sub;
+    }
+    else if (me->slots[e->up].left == s)
+    {
+        me->slots[e->up].left = sub;
+    }
+    else
+    {
+        me->slots[e->up].right = sub;
+    }
+
+    for (size_t n = e->up; n != RANK_NONE; n = me->slots[n].up)
+    {
+        ECU_ASSERT( (me->slots[n].size > 1) );
+        me->slots[n].size--;
+    }
+
+    e->node = (struct ecu_ntnode *)0;
+
+    /* Backward shift deletion. Same as the child index in ntnode.c. Pull later
+    entries of the probe run into the hole unless their home slot is cyclically
+    within (s, j], in which case moving them would make them unreachable. */
+    for (size_t j = (s + 1) & mask; me->slots[j].node; j = (j + 1) & mask)
+    {
+        size_t k = (size_t)rank_hash(me->slots[j].node) & mask;
+        bool reachable = (s <= j) ? ((s < k) && (k <= j)) : ((s < k) || (k <= j));
+
+        if (!reachable)
+        {
+            rank_relocate(me, j, s);
+            s = j;
+        }
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------ NTRANK MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_ntrank_ctor(struct ecu_ntrank *me,
+                     struct ecu_ntrank_slot *slots,
+                     size_t capacity)
+{
+    ECU_ASSERT( (me && slots) );
+    ECU_ASSERT( ((capacity > 1) && ((capacity & (capacity - 1)) == 0)) );
+
+    me->parent = (struct ecu_ntnode *)0;
+    me->slots = slots;
+    me->capacity = capacity;
+    me->root = RANK_NONE;
+
+    for (size_t i = 0; i < capacity; i++)
+    {
+        me->slots[i].node = (struct ecu_ntnode *)0;
+    }
+}
+
+size_t ecu_ntrank_build(struct ecu_ntrank *me, struct ecu_ntnode *parent)
+{
+    ECU_ASSERT( (me && parent) );
+    ECU_ASSERT( (ecu_ntnode_valid(parent)) );
+    struct ecu_ntnode_child_iterator iter;
+    size_t i = 0;
+
+    for (size_t s = 0; s < me->capacity; s++)
+    {
+        me->slots[s].node = (struct ecu_ntnode *)0;
+    }
+
+    me->parent = parent;
+    me->root = RANK_NONE;
+
+    ECU_NTNODE_CHILD_FOR_EACH(c, &iter, parent)
+    {
+        rank_link(me, c, i);
+        i++;
+    }
+
+    return i;
+}
+
+size_t ecu_ntrank_count(const struct ecu_ntrank *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->parent) );
+    return (rank_size(me, me->root));
+}
+
+size_t ecu_ntrank_index_of(const struct ecu_ntrank *me, const struct ecu_ntnode *child)
+{
+    ECU_ASSERT( (me && child) );
+    ECU_ASSERT( (me->parent) );
+    ECU_ASSERT( (ecu_ntnode_cparent(child) == me->parent) );
+    size_t s = rank_find(me, child);
+    size_t index = rank_size(me, me->slots[s].left);
+
+    /* Every left subtree passed on the way up to the treap's root holds earlier siblings. */
+    for (size_t n = s; me->slots[n].up != RANK_NONE; n = me->slots[n].up)
+    {
+        const struct ecu_ntrank_slot *up = &me->slots[me->slots[n].up];
+
+        if (up->right == n)
+        {
+            index += rank_size(me, up->left) + 1;
+        }
+    }
+
+    return index;
+}
+
+void ecu_ntrank_insert_child_at(struct ecu_ntrank *me, struct ecu_ntnode *child, size_t index)
+{
+    ECU_ASSERT( (me && child) );
+    ECU_ASSERT( (me->parent) );
+    ECU_ASSERT( (index <= ecu_ntrank_count(me)) );
+    struct ecu_ntnode *pos = ecu_ntrank_nth_child(me, index);
+
+    if (pos)
+    {
+        ecu_ntnode_insert_sibling_before(pos, child);
+    }
+    else
+    {
+        ecu_ntnode_push_child_back(me->parent, child);
+    }
+
+    rank_link(me, child, index);
+}
+
+struct ecu_ntnode *ecu_ntrank_nth_child(const struct ecu_ntrank *me, size_t index)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->parent) );
+    size_t s = me->root;
+    size_t i = index;
+
+    while ((s != RANK_NONE) && (i != rank_size(me, me->slots[s].left)))
+    {
+        size_t left = rank_size(me, me->slots[s].left);
+
+        if (i < left)
+        {
+            s = me->slots[s].left;
+        }
+        else
+        {
+            i -= (left + 1);
+            s = me->slots[s].right;
+        }
+    }
+
+    return ((s != RANK_NONE) ? me->slots[s].node : (struct ecu_ntnode *)0);
+}
+
+void ecu_ntrank_remove(struct ecu_ntrank *me, struct ecu_ntnode *child)
+{
+    ECU_ASSERT( (me && child) );
+    ECU_ASSERT( (me->parent) );
+    ECU_ASSERT( (ecu_ntnode_parent(child) == me->parent) );
+
+    rank_unlink(me, rank_find(me, child));
+    ecu_ntnode_remove(child);
+}
@@ -0,0 +1,303 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ntsplit.h section <ntsplit_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/ntsplit.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Runtime asserts. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/ntsplit.c")
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @pre me->count < me->capacity if @p first is not NULL.
+ * @brief Stores the run [first, last] as the next task. Does
+ * nothing if no run is open, which is when @p first is NULL.
+ */
+static void add_task(struct ecu_ntsplit *me,
+                     struct ecu_ntnode *first,
+                     struct ecu_ntnode *last);
+
+/**
+ * @brief Returns the number of nodes in @p node's subtree, including
+ * itself, but stops counting once the count exceeds @p limit. Only
+ * whether a subtree fits in a task matters, so big subtrees near the
+ * root are not counted in full. O(1) if @ref ECU_NTNODE_COUNTED is
+ * defined. Otherwise O(@p limit).
+ */
+static size_t bounded_size(const struct ecu_ntnode *node, size_t limit);
+
+/**
+ * @brief Returns true if @p node is the first node of task @p k.
+ * False if @p k is past the last task.
+ */
+static bool starts_task(const struct ecu_ntsplit *me,
+                        size_t k,
+                        const struct ecu_ntnode *node);
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static void add_task(struct ecu_ntsplit *me,
+                     struct ecu_ntnode *first,
+                     struct ecu_ntnode *last)
+{
+    ECU_ASSERT( (me) );
+
+    if (first)
+    {
+        ECU_ASSERT( (last) );
+        ECU_ASSERT( (me->count < me->capacity) );
+        me->tasks[me->count].first = first;
+        me->tasks[me->count].last = last;
+        me->count++;
+    }
+}
+
+static size_t bounded_size(const struct ecu_ntnode *node, size_t limit)
+{
+    ECU_ASSERT( (node) );
+    size_t count = 0;
+
+#if defined(ECU_NTNODE_COUNTED)
+    (void)limit;
+    count = ecu_ntnode_size(node) + 1;
+#else
+    struct ecu_ntnode_compact_preorder_citerator iter;
+
+    for (const struct ecu_ntnode *n = ecu_ntnode_compact_preorder_iterator_cbegin(&iter, node);
+         (n != ecu_ntnode_compact_preorder_iterator_cend(&iter)) && (count <= limit);
+         n = ecu_ntnode_compact_preorder_iterator_cnext(&iter))
+    {
+        count++;
+    }
+#endif
+
+    return count;
+}
+
+static bool starts_task(const struct ecu_ntsplit *me,
+                        size_t k,
+                        const struct ecu_ntnode *node)
+{
+    ECU_ASSERT( (me && node) );
+    return ((k < me->count) && (me->tasks[k].first == node));
+}
+
+/*------------------------------------------------------------*/
+/*----------------- NTSPLIT MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_ntsplit_ctor(struct ecu_ntsplit *me,
+                      struct ecu_ntsplit_task *tasks,
+                      size_t capacity)
+{
+    ECU_ASSERT( (me && tasks) );
+    ECU_ASSERT( (capacity > 0) );
+
+    me->root = (struct ecu_ntnode *)0;
+    me->tasks = tasks;
+    me->capacity = capacity;
+    me->count = 0;
+}
+
+size_t ecu_ntsplit_build(struct ecu_ntsplit *me,
+                         struct ecu_ntnode *root,
+                         size_t grain)
+{
+    ECU_ASSERT( (me && root) );
+    ECU_ASSERT( (ecu_ntnode_valid(root)) );
+    ECU_ASSERT( (grain > 0) );
+
+    me->root = root;
+    me->count = 0;
+
+    if (bounded_size(root, grain) <= grain)
+    {
+        add_task(me, root, root);
+    }
+    else
+    {
+        /* Walk down every subtree that is too big to be a task, called the spine. Parent
+        is the spine node whose children are being split and child is the next one to look
+        at. Children small enough to be tasks are packed into runs of consecutive siblings
+        and never entered. */
+        struct ecu_ntnode *parent = root;
+        struct ecu_ntnode *child = ecu_ntnode_first_child(root);
+        struct ecu_ntnode *first = (struct ecu_ntnode *)0;
+        struct ecu_ntnode *last = (struct ecu_ntnode *)0;
+        size_t total = 0;
+        bool done = false;
+
+        while (!done && (me->count < me->capacity))
+        {
+            if (!child)
+            {
+                /* No more children. Close the run and climb back to the parent's next sibling. */
+                add_task(me, first, last);
+                first = (struct ecu_ntnode *)0;
+
+                if (parent == root)
+                {
+                    done = true;
+                }
+                else
+                {
+                    child = ecu_ntnode_next(parent);
+                    parent = ecu_ntnode_parent(parent);
+                }
+            }
+            else
+            {
+                size_t nodes = bounded_size(child, grain);
+
+                if (nodes > grain)
+                {
+                    /* Too big. Child becomes part of the spine and its children are split. */
+                    add_task(me, first, last);
+                    first = (struct ecu_ntnode *)0;
+                    parent = child;
+                    child = ecu_ntnode_first_child(child);
+                }
+                else
+                {
+                    if (first && ((total + nodes) > grain))
+                    {
+                        add_task(me, first, last);
+                        first = (struct ecu_ntnode *)0;
+                    }
+
+                    if (!first)
+                    {
+                        first = child;
+                        total = 0;
+                    }
+
+                    last = child;
+                    total += nodes;
+                    child = ecu_ntnode_next(child);
+                }
+            }
+        }
+    }
+
+    return (me->count);
+}
+
+size_t ecu_ntsplit_count(const struct ecu_ntsplit *me)
+{
+    ECU_ASSERT( (me) );
+    return (me->count);
+}
+
+void ecu_ntsplit_run(const struct ecu_ntsplit *me,
+                     size_t i,
+                     void (*visit)(struct ecu_ntnode *node, void *obj),
+                     void *obj)
+{
+    ECU_ASSERT( (me && visit) );
+    ECU_ASSERT( (i < me->count) );
+    struct ecu_ntnode *sibling = me->tasks[i].first;
+    struct ecu_ntnode_compact_postorder_iterator iter;
+    bool done = false;
+
+    while (!done)
+    {
+        ECU_ASSERT( (sibling) );
+
+        ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(n, &iter, sibling)
+        {
+            (*visit)(n, obj);
+        }
+
+        if (sibling == me->tasks[i].last)
+        {
+            done = true;
+        }
+        else
+        {
+            sibling = ecu_ntnode_next(sibling);
+        }
+    }
+}
+
+void ecu_ntsplit_finish(const struct ecu_ntsplit *me,
+                        void (*visit)(struct ecu_ntnode *node, void *obj),
+                        void *obj)
+{
+    ECU_ASSERT( (me && visit) );
+    ECU_ASSERT( (me->root) );
+    struct ecu_ntnode *node = me->root;
+    size_t k = 0;
+    bool done = false;
+
+    /* Postorder walk that steps over every task. Tasks are stored in preorder so
+    the next task this walk can reach is always tasks[k]. */
+    while (!done)
+    {
+        bool leave = true;
+
+        /* Enter node. */
+        if (starts_task(me, k, node))
+        {
+            /* Continue as if the whole run was already visited. */
+            node = me->tasks[k].last;
+            k++;
+        }
+        else if (ecu_ntnode_is_leaf(node))
+        {
+            (*visit)(node, obj);
+        }
+        else
+        {
+            node = ecu_ntnode_first_child(node);
+            leave = false;
+        }
+
+        /* Leave node. Every parent climbed to has now had all of its children visited. */
+        if (leave)
+        {
+            while ((node != me->root) && !ecu_ntnode_next(node))
+            {
+                node = ecu_ntnode_parent(node);
+                (*visit)(node, obj);
+            }
+
+            if (node == me->root)
+            {
+                done = true;
+            }
+            else
+            {
+                node = ecu_ntnode_next(node);
+            }
+        }
+    }
+}
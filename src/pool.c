@@ -0,0 +1,426 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`pool.h section <pool_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/pool.h"
+
+/* STDLib. */
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Runtime asserts. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/pool.c")
+
+/*------------------------------------------------------------*/
+/*---------------------------- DEFINES -----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Number of bits in the index half of @ref ecu_lfpool.head.
+ */
+#define HEAD_INDEX_BITS \
+    ((sizeof(uintptr_t) * CHAR_BIT) / 2U)
+
+/**
+ * @brief Selects the block index + 1 out of @ref ecu_lfpool.head.
+ * Also the maximum capacity of a lock-free pool.
+ */
+#define HEAD_INDEX_MASK \
+    ((((uintptr_t)1) << HEAD_INDEX_BITS) - 1U)
+
+/**
+ * @brief Added to @ref ecu_lfpool.head to change its tag.
+ */
+#define HEAD_TAG_INCREMENT \
+    (((uintptr_t)1) << HEAD_INDEX_BITS)
+
+#if defined(__GNUC__)
+/**
+ * @brief Atomically loads @p ptr_ with acquire ordering.
+ */
+#define ATOMIC_LOAD(ptr_) \
+    (__atomic_load_n((ptr_), __ATOMIC_ACQUIRE))
+
+/**
+ * @brief Atomically loads @p ptr_ without ordering. Only
+ * used for statistics.
+ */
+#define ATOMIC_LOAD_RELAXED(ptr_) \
+    (__atomic_load_n((ptr_), __ATOMIC_RELAXED))
+
+/**
+ * @brief Atomically stores @p val_ into @p ptr_ with release ordering.
+ */
+#define ATOMIC_STORE(ptr_, val_) \
+    (__atomic_store_n((ptr_), (val_), __ATOMIC_RELEASE))
+
+/**
+ * @brief Atomically replaces @p ptr_ with @p desired_ if it still
+ * equals @p expected_. Otherwise @p expected_ is updated to the
+ * current value. Returns true if replaced. Full acquire-release
+ * ordering on success.
+ */
+#define ATOMIC_CAS(ptr_, expected_, desired_) \
+    (__atomic_compare_exchange_n((ptr_), (expected_), (desired_), true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+
+/**
+ * @brief Same as @ref ATOMIC_CAS() without ordering. Only
+ * used for statistics.
+ */
+#define ATOMIC_CAS_RELAXED(ptr_, expected_, desired_) \
+    (__atomic_compare_exchange_n((ptr_), (expected_), (desired_), true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+
+/**
+ * @brief Atomically adds @p val_ to @p ptr_ and returns the
+ * new value. No ordering. Only used for statistics.
+ */
+#define ATOMIC_ADD_RELAXED(ptr_, val_) \
+    (__atomic_add_fetch((ptr_), (val_), __ATOMIC_RELAXED))
+
+/**
+ * @brief Atomically subtracts @p val_ from @p ptr_. No ordering.
+ * Only used for statistics.
+ */
+#define ATOMIC_SUB_RELAXED(ptr_, val_) \
+    ((void)__atomic_sub_fetch((ptr_), (val_), __ATOMIC_RELAXED))
+#endif
+
+/*------------------------------------------------------------*/
+/*---------------------- STATIC ASSERTS ----------------------*/
+/*------------------------------------------------------------*/
+
+ECU_STATIC_ASSERT( ((ECU_POOL_ALIGNMENT & (ECU_POOL_ALIGNMENT - 1U)) == 0), "ECU_POOL_ALIGNMENT must be a power of two." );
+ECU_STATIC_ASSERT( (ECU_POOL_ALIGNMENT >= sizeof(uintptr_t)), "ECU_POOL_ALIGNMENT must be at least sizeof(uintptr_t)." );
+ECU_STATIC_ASSERT( (ECU_POOL_ALIGNMENT >= sizeof(void *)), "ECU_POOL_ALIGNMENT must be at least sizeof(void *)." );
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Aligns @p buffer and returns how many blocks fit in it.
+ * Every block also needs @p link_size bytes at the end of the buffer.
+ * First aligned block is returned through @p blocks.
+ */
+static size_t carve(void *buffer,
+                    size_t size,
+                    size_t block_size,
+                    size_t link_size,
+                    uint8_t **blocks);
+
+/**
+ * @brief Returns true if @p ptr points into one of @p capacity
+ * blocks starting at @p blocks.
+ */
+static bool contains(const uint8_t *blocks,
+                     size_t block_size,
+                     size_t capacity,
+                     const void *ptr);
+
+/**
+ * @brief Returns the index of the block @p ptr points into.
+ * @p ptr can point anywhere inside the block.
+ */
+static size_t block_index(const uint8_t *blocks,
+                          size_t block_size,
+                          size_t capacity,
+                          const void *ptr);
+
+/**
+ * @brief Resets user's statistics. Does nothing if @p stats is NULL.
+ */
+static void clear_stats(struct ecu_pool_stats *stats);
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static size_t carve(void *buffer,
+                    size_t size,
+                    size_t block_size,
+                    size_t link_size,
+                    uint8_t **blocks)
+{
+    ECU_ASSERT( (buffer && blocks) );
+    ECU_ASSERT( (block_size > 0) );
+    uint8_t *start = (uint8_t *)buffer;
+    size_t padding = (size_t)((ECU_POOL_ALIGNMENT - ((uintptr_t)start % ECU_POOL_ALIGNMENT)) % ECU_POOL_ALIGNMENT);
+    size_t capacity = 0;
+
+    ECU_ASSERT( (size > padding) );
+    capacity = (size - padding) / (ECU_POOL_BLOCK_SIZE(block_size) + link_size);
+    ECU_ASSERT( (capacity > 0) );
+    *blocks = &start[padding];
+    return capacity;
+}
+
+static bool contains(const uint8_t *blocks,
+                     size_t block_size,
+                     size_t capacity,
+                     const void *ptr)
+{
+    ECU_ASSERT( (blocks) );
+    bool status = false;
+
+    /* Compare addresses as integers since ptr may be unrelated to the pool. */
+    if (((uintptr_t)ptr >= (uintptr_t)blocks) &&
+        (((uintptr_t)ptr - (uintptr_t)blocks) < (block_size * capacity)))
+    {
+        status = true;
+    }
+
+    return status;
+}
+
+static size_t block_index(const uint8_t *blocks,
+                          size_t block_size,
+                          size_t capacity,
+                          const void *ptr)
+{
+    ECU_ASSERT( (ptr) );
+    ECU_ASSERT( (contains(blocks, block_size, capacity, ptr)) );
+    return (size_t)(((uintptr_t)ptr - (uintptr_t)blocks) / block_size);
+}
+
+static void clear_stats(struct ecu_pool_stats *stats)
+{
+    if (stats)
+    {
+        stats->in_use = 0;
+        stats->high_water = 0;
+        stats->failures = 0;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- POOL MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_pool_ctor(struct ecu_pool *me,
+                   void *buffer,
+                   size_t size,
+                   size_t block_size,
+                   struct ecu_pool_stats *stats)
+{
+    ECU_ASSERT( (me) );
+    me->block_size = ECU_POOL_BLOCK_SIZE(block_size);
+    me->capacity = carve(buffer, size, block_size, 0, &me->blocks);
+    me->available = me->capacity;
+    me->free = (void *)0;
+    me->stats = stats;
+    clear_stats(stats);
+
+    /* Link back to front so blocks are handed out in address order. */
+    for (size_t i = me->capacity; i > 0; i--)
+    {
+        void *block = &me->blocks[(i - 1) * me->block_size];
+        *(void **)block = me->free;
+        me->free = block;
+    }
+}
+
+void *ecu_pool_alloc(struct ecu_pool *me)
+{
+    ECU_ASSERT( (me) );
+    void *block = me->free;
+
+    if (block)
+    {
+        ECU_ASSERT( (me->available > 0) );
+        me->free = *(void **)block;
+        me->available--;
+
+        if (me->stats)
+        {
+            me->stats->in_use++;
+
+            if (me->stats->in_use > me->stats->high_water)
+            {
+                me->stats->high_water = me->stats->in_use;
+            }
+        }
+    }
+    else if (me->stats)
+    {
+        me->stats->failures++;
+    }
+
+    return block;
+}
+
+size_t ecu_pool_available(const struct ecu_pool *me)
+{
+    ECU_ASSERT( (me) );
+    return me->available;
+}
+
+size_t ecu_pool_capacity(const struct ecu_pool *me)
+{
+    ECU_ASSERT( (me) );
+    return me->capacity;
+}
+
+void ecu_pool_free(struct ecu_pool *me, void *ptr)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->available < me->capacity) );
+    void *block = &me->blocks[block_index(me->blocks, me->block_size, me->capacity, ptr) * me->block_size];
+
+    *(void **)block = me->free;
+    me->free = block;
+    me->available++;
+
+    if (me->stats)
+    {
+        ECU_ASSERT( (me->stats->in_use > 0) );
+        me->stats->in_use--;
+    }
+}
+
+bool ecu_pool_owns(const struct ecu_pool *me, const void *ptr)
+{
+    ECU_ASSERT( (me) );
+    return contains(me->blocks, me->block_size, me->capacity, ptr);
+}
+
+/*------------------------------------------------------------*/
+/*------------------- LFPOOL MEMBER FUNCTIONS ----------------*/
+/*------------------------------------------------------------*/
+
+#if defined(__GNUC__)
+void ecu_lfpool_ctor(struct ecu_lfpool *me,
+                     void *buffer,
+                     size_t size,
+                     size_t block_size,
+                     struct ecu_pool_stats *stats)
+{
+    ECU_ASSERT( (me) );
+    me->block_size = ECU_POOL_BLOCK_SIZE(block_size);
+    me->capacity = carve(buffer, size, block_size, sizeof(uintptr_t), &me->blocks);
+
+    if (me->capacity > HEAD_INDEX_MASK)
+    {
+        me->capacity = HEAD_INDEX_MASK;
+    }
+
+    /* Links start on a block boundary so they are always aligned. */
+    me->links = (uintptr_t *)(void *)&me->blocks[me->capacity * me->block_size];
+    me->stats = stats;
+    clear_stats(stats);
+
+    for (size_t i = 0; i < me->capacity; i++)
+    {
+        me->links[i] = (uintptr_t)(i + 2U);
+    }
+
+    me->links[me->capacity - 1U] = 0;
+    ATOMIC_STORE(&me->head, (uintptr_t)1);
+}
+
+void *ecu_lfpool_alloc(struct ecu_lfpool *me)
+{
+    ECU_ASSERT( (me) );
+    void *block = (void *)0;
+    uintptr_t head = ATOMIC_LOAD(&me->head);
+    bool done = false;
+
+    while (!done)
+    {
+        uintptr_t top = head & HEAD_INDEX_MASK;
+
+        if (top == 0)
+        {
+            done = true;
+        }
+        else
+        {
+            /* Link may be stale if another thread pops this block first. The
+            tag then no longer matches so the CAS fails and the link is reread. */
+            uintptr_t next = ATOMIC_LOAD(&me->links[top - 1U]);
+            uintptr_t desired = ((head & ~HEAD_INDEX_MASK) + HEAD_TAG_INCREMENT) | next;
+
+            if (ATOMIC_CAS(&me->head, &head, desired))
+            {
+                block = &me->blocks[(size_t)(top - 1U) * me->block_size];
+                done = true;
+            }
+        }
+    }
+
+    if (me->stats)
+    {
+        if (block)
+        {
+            size_t in_use = ATOMIC_ADD_RELAXED(&me->stats->in_use, (size_t)1);
+            size_t high_water = ATOMIC_LOAD_RELAXED(&me->stats->high_water);
+            bool updated = false;
+
+            /* Failed CAS reloads high_water. */
+            while (!updated && (in_use > high_water))
+            {
+                updated = ATOMIC_CAS_RELAXED(&me->stats->high_water, &high_water, in_use);
+            }
+        }
+        else
+        {
+            (void)ATOMIC_ADD_RELAXED(&me->stats->failures, (size_t)1);
+        }
+    }
+
+    return block;
+}
+
+size_t ecu_lfpool_capacity(const struct ecu_lfpool *me)
+{
+    ECU_ASSERT( (me) );
+    return me->capacity;
+}
+
+void ecu_lfpool_free(struct ecu_lfpool *me, void *ptr)
+{
+    ECU_ASSERT( (me) );
+    uintptr_t index = (uintptr_t)block_index(me->blocks, me->block_size, me->capacity, ptr) + 1U;
+    uintptr_t head = ATOMIC_LOAD(&me->head);
+    bool done = false;
+
+    if (me->stats)
+    {
+        ATOMIC_SUB_RELAXED(&me->stats->in_use, (size_t)1);
+    }
+
+    /* Tag is kept. Only allocations have to change it. */
+    while (!done)
+    {
+        ATOMIC_STORE(&me->links[index - 1U], head & HEAD_INDEX_MASK);
+        done = ATOMIC_CAS(&me->head, &head, (head & ~HEAD_INDEX_MASK) | index);
+    }
+}
+
+bool ecu_lfpool_owns(const struct ecu_lfpool *me, const void *ptr)
+{
+    ECU_ASSERT( (me) );
+    return contains(me->blocks, me->block_size, me->capacity, ptr);
+}
+#endif /* __GNUC__ */
@@ -0,0 +1,1024 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`rbtree.h section <rbtree_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/rbtree.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Runtime asserts. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/rbtree.c")
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Returns true if @p node is red. NULL leaves are black.
+ */
+static bool is_red(const struct ecu_rbnode *node);
+
+/**
+ * @brief Returns leftmost node in subtree rooted at @p node.
+ */
+static struct ecu_rbnode *leftmost(struct ecu_rbnode *node);
+
+/**
+ * @brief Returns rightmost node in subtree rooted at @p node.
+ */
+static struct ecu_rbnode *rightmost(struct ecu_rbnode *node);
+
+/**
+ * @brief Resets @p node to the constructed, not-in-tree state.
+ */
+static void node_reset(struct ecu_rbnode *node);
+
+/**
+ * @brief Makes @p new_child take the place of @p old_child under
+ * @p parent. Updates the root if @p parent is NULL. Does not
+ * update @p new_child's parent pointer.
+ */
+static void replace_child(struct ecu_rbtree *me,
+                          struct ecu_rbnode *parent,
+                          struct ecu_rbnode *old_child,
+                          struct ecu_rbnode *new_child);
+
+/**
+ * @brief Left rotation about @p node. Its right child becomes
+ * its parent. Sorted order is unchanged.
+ */
+static void rotate_left(struct ecu_rbtree *me, struct ecu_rbnode *node);
+
+/**
+ * @brief Right rotation about @p node. Its left child becomes
+ * its parent. Sorted order is unchanged.
+ */
+static void rotate_right(struct ecu_rbtree *me, struct ecu_rbnode *node);
+
+/**
+ * @brief Restores red-black properties after @p node is
+ * inserted as a red leaf.
+ */
+static void insert_fixup(struct ecu_rbtree *me, struct ecu_rbnode *node);
+
+/**
+ * @brief Restores red-black properties after a black node is
+ * removed. @p node took the removed node's place and may be NULL,
+ * so its parent is supplied separately.
+ */
+static void remove_fixup(struct ecu_rbtree *me, struct ecu_rbnode *node, struct ecu_rbnode *parent);
+
+/**
+ * @brief Removes @p node from tree @p me and rebalances. Shared by
+ * @ref ecu_rbnode_remove() and @ref ecu_rbnode_destroy().
+ */
+static void remove_node(struct ecu_rbtree *me, struct ecu_rbnode *node);
+
+/**
+ * @brief Shared in-order successor implementation. Returns NULL
+ * if @p node is the maximum or not in a tree.
+ */
+static struct ecu_rbnode *successor(const struct ecu_rbnode *node);
+
+/**
+ * @brief Shared in-order predecessor implementation. Returns NULL
+ * if @p node is the minimum or not in a tree.
+ */
+static struct ecu_rbnode *predecessor(const struct ecu_rbnode *node);
+
+/**
+ * @brief Shared find implementation. Returns first node equal to
+ * @p key or NULL if none.
+ */
+static struct ecu_rbnode *find(const struct ecu_rbtree *me, const struct ecu_rbnode *key);
+
+/**
+ * @brief Shared lower bound implementation. Returns first node that
+ * is not less than @p key.
+ */
+static struct ecu_rbnode *lower_bound(const struct ecu_rbtree *me, const struct ecu_rbnode *key);
+
+/**
+ * @brief Shared upper bound implementation. Returns first node that
+ * is greater than @p key.
+ */
+static struct ecu_rbnode *upper_bound(const struct ecu_rbtree *me, const struct ecu_rbnode *key);
+
+/**
+ * @brief Detaches every node from the tree in O(n) without recursion
+ * or rebalancing. Each detached node is passed to @p visit, which is
+ * allowed to destroy it. Tree is empty afterwards.
+ */
+static void dismantle(struct ecu_rbtree *me, void (*visit)(struct ecu_rbnode *node));
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static bool is_red(const struct ecu_rbnode *node)
+{
+    return ((node) && (node->red));
+}
+
+static struct ecu_rbnode *leftmost(struct ecu_rbnode *node)
+{
+    ECU_ASSERT( (node) );
+
+    while (node->left)
+    {
+        node = node->left;
+    }
+
+    return node;
+}
+
+static struct ecu_rbnode *rightmost(struct ecu_rbnode *node)
+{
+    ECU_ASSERT( (node) );
+
+    while (node->right)
+    {
+        node = node->right;
+    }
+
+    return node;
+}
+
+static void node_reset(struct ecu_rbnode *node)
+{
+    ECU_ASSERT( (node) );
+    node->parent = node;
+    node->left = (struct ecu_rbnode *)0;
+    node->right = (struct ecu_rbnode *)0;
+    node->tree = (struct ecu_rbtree *)0;
+    node->red = false;
+}
+
+static void replace_child(struct ecu_rbtree *me,
+                          struct ecu_rbnode *parent,
+                          struct ecu_rbnode *old_child,
+                          struct ecu_rbnode *new_child)
+{
+    ECU_ASSERT( (me && old_child) );
+
+    if (!parent)
+    {
+        me->root = new_child;
+    }
+    else if (parent->left == old_child)
+    {
+        parent->left = new_child;
+    }
+    else
+    {
+        ECU_ASSERT( (parent->right == old_child) );
+        parent->right = new_child;
+    }
+}
+
+static void rotate_left(struct ecu_rbtree *me, struct ecu_rbnode *node)
+{
+    ECU_ASSERT( (me && node && node->right) );
+    struct ecu_rbnode *pivot = node->right;
+
+    node->right = pivot->left;
+    if (pivot->left)
+    {
+        pivot->left->parent = node;
+    }
+
+    pivot->parent = node->parent;
+    replace_child(me, node->parent, node, pivot);
+    pivot->left = node;
+    node->parent = pivot;
+}
+
+static void rotate_right(struct ecu_rbtree *me, struct ecu_rbnode *node)
+{
+    ECU_ASSERT( (me && node && node->left) );
+    struct ecu_rbnode *pivot = node->left;
+
+    node->left = pivot->right;
+    if (pivot->right)
+    {
+        pivot->right->parent = node;
+    }
+
+    pivot->parent = node->parent;
+    replace_child(me, node->parent, node, pivot);
+    pivot->right = node;
+    node->parent = pivot;
+}
+
+static void insert_fixup(struct ecu_rbtree *me, struct ecu_rbnode *node)
+{
+    ECU_ASSERT( (me && node) );
+    struct ecu_rbnode *parent = node->parent;
+
+    /* Only violation possible is a red node with a red parent. Parent
+    cannot be the root since the root is always black, so grandparent exists. */
+    while (is_red(parent))
+    {
+        struct ecu_rbnode *grandparent = parent->parent;
+        ECU_ASSERT( (grandparent) );
+
+        if (parent == grandparent->left)
+        {
+            struct ecu_rbnode *uncle = grandparent->right;
+
+            if (is_red(uncle))
+            {
+                /* Recolor and continue up the tree. */
+                parent->red = false;
+                uncle->red = false;
+                grandparent->red = true;
+                node = grandparent;
+            }
+            else
+            {
+                if (node == parent->right)
+                {
+                    rotate_left(me, parent);
+                    node = parent;
+                    parent = node->parent;
+                }
+
+                parent->red = false;
+                grandparent->red = true;
+                rotate_right(me, grandparent);
+            }
+        }
+        else
+        {
+            struct ecu_rbnode *uncle = grandparent->left;
+
+            if (is_red(uncle))
+            {
+                parent->red = false;
+                uncle->red = false;
+                grandparent->red = true;
+                node = grandparent;
+            }
+            else
+            {
+                if (node == parent->left)
+                {
+                    rotate_right(me, parent);
+                    node = parent;
+                    parent = node->parent;
+                }
+
+                parent->red = false;
+                grandparent->red = true;
+                rotate_left(me, grandparent);
+            }
+        }
+
+        parent = node->parent;
+    }
+
+    me->root->red = false;
+}
+
+static void remove_fixup(struct ecu_rbtree *me, struct ecu_rbnode *node, struct ecu_rbnode *parent)
+{
+    ECU_ASSERT( (me) );
+
+    /* Node carries an extra black. Push it up the tree until it
+    lands on a red node or the root. */
+    while ((node != me->root) && !is_red(node))
+    {
+        ECU_ASSERT( (parent) );
+
+        if (node == parent->left)
+        {
+            struct ecu_rbnode *sibling = parent->right;
+            ECU_ASSERT( (sibling) ); /* Sibling subtree has a black height of at least 1. */
+
+            if (sibling->red)
+            {
+                sibling->red = false;
+                parent->red = true;
+                rotate_left(me, parent);
+                sibling = parent->right;
+                ECU_ASSERT( (sibling) );
+            }
+
+            if (!is_red(sibling->left) && !is_red(sibling->right))
+            {
+                sibling->red = true;
+                node = parent;
+                parent = node->parent;
+            }
+            else
+            {
+                if (!is_red(sibling->right))
+                {
+                    sibling->left->red = false;
+                    sibling->red = true;
+                    rotate_right(me, sibling);
+                    sibling = parent->right;
+                }
+
+                sibling->red = parent->red;
+                parent->red = false;
+                sibling->right->red = false;
+                rotate_left(me, parent);
+                node = me->root;
+                parent = (struct ecu_rbnode *)0;
+            }
+        }
+        else
+        {
+            struct ecu_rbnode *sibling = parent->left;
+            ECU_ASSERT( (sibling) );
+
+            if (sibling->red)
+            {
+                sibling->red = false;
+                parent->red = true;
+                rotate_right(me, parent);
+                sibling = parent->left;
+                ECU_ASSERT( (sibling) );
+            }
+
+            if (!is_red(sibling->left) && !is_red(sibling->right))
+            {
+                sibling->red = true;
+                node = parent;
+                parent = node->parent;
+            }
+            else
+            {
+                if (!is_red(sibling->left))
+                {
+                    sibling->right->red = false;
+                    sibling->red = true;
+                    rotate_left(me, sibling);
+                    sibling = parent->left;
+                }
+
+                sibling->red = parent->red;
+                parent->red = false;
+                sibling->left->red = false;
+                rotate_right(me, parent);
+                node = me->root;
+                parent = (struct ecu_rbnode *)0;
+            }
+        }
+    }
+
+    if (node)
+    {
+        node->red = false;
+    }
+}
+
+static void remove_node(struct ecu_rbtree *me, struct ecu_rbnode *node)
+{
+    ECU_ASSERT( (me && node) );
+    ECU_ASSERT( (node->tree == me) );
+    struct ecu_rbnode *spliced = node; /* Node physically removed from its position. */
+    struct ecu_rbnode *child = (struct ecu_rbnode *)0;
+    struct ecu_rbnode *child_parent = (struct ecu_rbnode *)0;
+    bool spliced_red = false;
+
+    if (me->min == node)
+    {
+        me->min = successor(node);
+    }
+
+    if (me->max == node)
+    {
+        me->max = predecessor(node);
+    }
+
+    /* A node with two children is replaced by its successor, which
+    has at most one child. Nodes are relinked, never copied, since
+    they are embedded in user data. */
+    if (node->left && node->right)
+    {
+        spliced = leftmost(node->right);
+    }
+
+    child = (spliced->left) ? spliced->left : spliced->right;
+    child_parent = spliced->parent;
+    spliced_red = spliced->red;
+
+    if (child)
+    {
+        child->parent = spliced->parent;
+    }
+
+    replace_child(me, spliced->parent, spliced, child);
+
+    if (spliced != node)
+    {
+        if (child_parent == node)
+        {
+            child_parent = spliced;
+        }
+
+        spliced->left = node->left;
+        spliced->right = node->right;
+        spliced->parent = node->parent;
+        spliced->red = node->red;
+        replace_child(me, node->parent, node, spliced);
+
+        if (spliced->left)
+        {
+            spliced->left->parent = spliced;
+        }
+
+        if (spliced->right)
+        {
+            spliced->right->parent = spliced;
+        }
+    }
+
+    if (!spliced_red)
+    {
+        remove_fixup(me, child, child_parent);
+    }
+
+    node_reset(node);
+    me->size--;
+}
+
+static struct ecu_rbnode *successor(const struct ecu_rbnode *node)
+{
+    ECU_ASSERT( (node) );
+    struct ecu_rbnode *next = (struct ecu_rbnode *)0;
+
+    if (node->tree)
+    {
+        if (node->right)
+        {
+            next = leftmost(node->right);
+        }
+        else
+        {
+            /* Climb until we arrive from a left subtree. */
+            next = node->parent;
+
+            while (next && (node == next->right))
+            {
+                node = next;
+                next = next->parent;
+            }
+        }
+    }
+
+    return next;
+}
+
+static struct ecu_rbnode *predecessor(const struct ecu_rbnode *node)
+{
+    ECU_ASSERT( (node) );
+    struct ecu_rbnode *prev = (struct ecu_rbnode *)0;
+
+    if (node->tree)
+    {
+        if (node->left)
+        {
+            prev = rightmost(node->left);
+        }
+        else
+        {
+            /* Climb until we arrive from a right subtree. */
+            prev = node->parent;
+
+            while (prev && (node == prev->left))
+            {
+                node = prev;
+                prev = prev->parent;
+            }
+        }
+    }
+
+    return prev;
+}
+
+static struct ecu_rbnode *find(const struct ecu_rbtree *me, const struct ecu_rbnode *key)
+{
+    ECU_ASSERT( (me && key) );
+    struct ecu_rbnode *node = lower_bound(me, key);
+
+    /* Lower bound is not less than key. Equal if key is not less than it either. */
+    if ((node) && (*me->lhs_less_than_rhs)(key, node, me->data))
+    {
+        node = (struct ecu_rbnode *)0;
+    }
+
+    return node;
+}
+
+static struct ecu_rbnode *lower_bound(const struct ecu_rbtree *me, const struct ecu_rbnode *key)
+{
+    ECU_ASSERT( (me && key) );
+    struct ecu_rbnode *current = me->root;
+    struct ecu_rbnode *result = (struct ecu_rbnode *)0;
+
+    while (current)
+    {
+        if ((*me->lhs_less_than_rhs)(current, key, me->data))
+        {
+            current = current->right;
+        }
+        else
+        {
+            result = current;
+            current = current->left;
+        }
+    }
+
+    return result;
+}
+
+static struct ecu_rbnode *upper_bound(const struct ecu_rbtree *me, const struct ecu_rbnode *key)
+{
+    ECU_ASSERT( (me && key) );
+    struct ecu_rbnode *current = me->root;
+    struct ecu_rbnode *result = (struct ecu_rbnode *)0;
+
+    while (current)
+    {
+        if ((*me->lhs_less_than_rhs)(key, current, me->data))
+        {
+            result = current;
+            current = current->left;
+        }
+        else
+        {
+            current = current->right;
+        }
+    }
+
+    return result;
+}
+
+static void dismantle(struct ecu_rbtree *me, void (*visit)(struct ecu_rbnode *node))
+{
+    ECU_ASSERT( (me && visit) );
+    struct ecu_rbnode *current = me->root;
+
+    /* Postorder walk that detaches leaves as they are reached, so the
+    parent becomes a leaf once both children are gone. */
+    while (current)
+    {
+        if (current->left)
+        {
+            current = current->left;
+        }
+        else if (current->right)
+        {
+            current = current->right;
+        }
+        else
+        {
+            struct ecu_rbnode *parent = current->parent;
+
+            if (parent)
+            {
+                if (parent->left == current)
+                {
+                    parent->left = (struct ecu_rbnode *)0;
+                }
+                else
+                {
+                    parent->right = (struct ecu_rbnode *)0;
+                }
+            }
+
+            node_reset(current);
+            (*visit)(current);
+            current = parent;
+        }
+    }
+
+    me->root = (struct ecu_rbnode *)0;
+    me->min = (struct ecu_rbnode *)0;
+    me->max = (struct ecu_rbnode *)0;
+    me->size = 0;
+}
+
+/*------------------------------------------------------------*/
+/*------------------ RBNODE MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_rbnode_ctor(struct ecu_rbnode *me,
+                     void (*destroy)(struct ecu_rbnode *me, ecu_object_id_t id),
+                     ecu_object_id_t id)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (id >= ECU_VALID_OBJECT_ID_BEGIN) );
+
+    node_reset(me);
+    me->destroy = destroy; /* Optional callback so do not NULL assert. */
+    me->id = id;           /* Optional. */
+}
+
+void ecu_rbnode_destroy(struct ecu_rbnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbnode_valid(me)) );
+
+    /* Save entries since they are reset before destroy callback executes. */
+    void (*destroy)(struct ecu_rbnode *, ecu_object_id_t) = me->destroy;
+    ecu_object_id_t id = me->id;
+
+    ecu_rbnode_remove(me);
+
+    /* Destroy object by setting to NULL values. Forces user to reconstruct
+    node if they want to use it again, assuming asserts are enabled.
+    IMPORTANT: These values are reset before the destroy callback in case
+    the user frees their entire node (including ecu_rbnode). */
+    me->parent = (struct ecu_rbnode *)0;
+    me->destroy = ECU_RBNODE_DESTROY_UNUSED;
+    me->id = ECU_OBJECT_ID_UNUSED;
+
+    if (destroy != ECU_RBNODE_DESTROY_UNUSED)
+    {
+        (*destroy)(me, id);
+    }
+}
+
+ecu_object_id_t ecu_rbnode_id(const struct ecu_rbnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbnode_valid(me)) );
+    return me->id;
+}
+
+bool ecu_rbnode_in_tree(const struct ecu_rbnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbnode_valid(me)) );
+    return (me->tree != (struct ecu_rbtree *)0);
+}
+
+struct ecu_rbnode *ecu_rbnode_next(struct ecu_rbnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbnode_valid(me)) );
+    return successor(me);
+}
+
+const struct ecu_rbnode *ecu_rbnode_cnext(const struct ecu_rbnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbnode_valid(me)) );
+    return successor(me);
+}
+
+struct ecu_rbnode *ecu_rbnode_prev(struct ecu_rbnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbnode_valid(me)) );
+    return predecessor(me);
+}
+
+const struct ecu_rbnode *ecu_rbnode_cprev(const struct ecu_rbnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbnode_valid(me)) );
+    return predecessor(me);
+}
+
+void ecu_rbnode_remove(struct ecu_rbnode *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbnode_valid(me)) );
+
+    if (me->tree)
+    {
+        remove_node(me->tree, me);
+    }
+}
+
+bool ecu_rbnode_valid(const struct ecu_rbnode *me)
+{
+    ECU_ASSERT( (me) );
+    bool status = false;
+
+    /* Node in a tree points to it. Node not in a tree has a self-linked parent.
+    Destroyed node has neither. */
+    if (((me->tree) || (me->parent == me)) &&
+        (me->id >= ECU_VALID_OBJECT_ID_BEGIN))
+    {
+        status = true;
+    }
+
+    return status;
+}
+
+/*------------------------------------------------------------*/
+/*------------------ RBTREE MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_rbtree_ctor(struct ecu_rbtree *me,
+                     bool (*lhs_less_than_rhs)(const struct ecu_rbnode *lhs, const struct ecu_rbnode *rhs, void *data),
+                     void *data)
+{
+    ECU_ASSERT( (me && lhs_less_than_rhs) );
+
+    me->root = (struct ecu_rbnode *)0;
+    me->min = (struct ecu_rbnode *)0;
+    me->max = (struct ecu_rbnode *)0;
+    me->size = 0;
+    me->lhs_less_than_rhs = lhs_less_than_rhs;
+    me->data = data; /* Optional. */
+}
+
+void ecu_rbtree_destroy(struct ecu_rbtree *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+
+    dismantle(me, &ecu_rbnode_destroy);
+
+    /* Setting to NULL values forces user to reconstruct the tree if they
+    want to use it again, assuming asserts are enabled. */
+    me->lhs_less_than_rhs = (bool (*)(const struct ecu_rbnode *, const struct ecu_rbnode *, void *))0;
+    me->data = (void *)0;
+}
+
+void ecu_rbtree_clear(struct ecu_rbtree *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+
+    /* Nodes are already reset to the not-in-tree state by dismantle(). */
+    dismantle(me, &node_reset);
+}
+
+bool ecu_rbtree_empty(const struct ecu_rbtree *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return (me->root == (struct ecu_rbnode *)0);
+}
+
+struct ecu_rbnode *ecu_rbtree_find(struct ecu_rbtree *me, const struct ecu_rbnode *key)
+{
+    ECU_ASSERT( (me && key) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return find(me, key);
+}
+
+const struct ecu_rbnode *ecu_rbtree_cfind(const struct ecu_rbtree *me, const struct ecu_rbnode *key)
+{
+    ECU_ASSERT( (me && key) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return find(me, key);
+}
+
+void ecu_rbtree_insert(struct ecu_rbtree *me, struct ecu_rbnode *node)
+{
+    ECU_ASSERT( (me && node) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    ECU_ASSERT( (ecu_rbnode_valid(node)) );
+    ECU_ASSERT( (!ecu_rbnode_in_tree(node)) );
+    struct ecu_rbnode *parent = (struct ecu_rbnode *)0;
+    struct ecu_rbnode **link = &me->root;
+    bool is_min = true;
+    bool is_max = true;
+
+    /* Equal nodes go right so insertion order is preserved. */
+    while (*link)
+    {
+        parent = *link;
+
+        if ((*me->lhs_less_than_rhs)(node, parent, me->data))
+        {
+            link = &parent->left;
+            is_max = false;
+        }
+        else
+        {
+            link = &parent->right;
+            is_min = false;
+        }
+    }
+
+    node->parent = parent;
+    node->left = (struct ecu_rbnode *)0;
+    node->right = (struct ecu_rbnode *)0;
+    node->tree = me;
+    node->red = true;
+    *link = node;
+
+    if (is_min)
+    {
+        me->min = node;
+    }
+
+    if (is_max)
+    {
+        me->max = node;
+    }
+
+    me->size++;
+    insert_fixup(me, node);
+}
+
+struct ecu_rbnode *ecu_rbtree_lower_bound(struct ecu_rbtree *me, const struct ecu_rbnode *key)
+{
+    ECU_ASSERT( (me && key) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return lower_bound(me, key);
+}
+
+const struct ecu_rbnode *ecu_rbtree_clower_bound(const struct ecu_rbtree *me, const struct ecu_rbnode *key)
+{
+    ECU_ASSERT( (me && key) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return lower_bound(me, key);
+}
+
+struct ecu_rbnode *ecu_rbtree_max(struct ecu_rbtree *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return me->max;
+}
+
+const struct ecu_rbnode *ecu_rbtree_cmax(const struct ecu_rbtree *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return me->max;
+}
+
+struct ecu_rbnode *ecu_rbtree_min(struct ecu_rbtree *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return me->min;
+}
+
+const struct ecu_rbnode *ecu_rbtree_cmin(const struct ecu_rbtree *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return me->min;
+}
+
+struct ecu_rbnode *ecu_rbtree_pop_min(struct ecu_rbtree *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    struct ecu_rbnode *min = me->min;
+
+    if (min)
+    {
+        remove_node(me, min);
+    }
+
+    return min;
+}
+
+size_t ecu_rbtree_size(const struct ecu_rbtree *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return me->size;
+}
+
+struct ecu_rbnode *ecu_rbtree_upper_bound(struct ecu_rbtree *me, const struct ecu_rbnode *key)
+{
+    ECU_ASSERT( (me && key) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return upper_bound(me, key);
+}
+
+const struct ecu_rbnode *ecu_rbtree_cupper_bound(const struct ecu_rbtree *me, const struct ecu_rbnode *key)
+{
+    ECU_ASSERT( (me && key) );
+    ECU_ASSERT( (ecu_rbtree_valid(me)) );
+    return upper_bound(me, key);
+}
+
+bool ecu_rbtree_valid(const struct ecu_rbtree *me)
+{
+    ECU_ASSERT( (me) );
+    return (me->lhs_less_than_rhs != (bool (*)(const struct ecu_rbnode *, const struct ecu_rbnode *, void *))0);
+}
+
+/*------------------------------------------------------------*/
+/*----------- NON-CONST ITERATOR MEMBER FUNCTIONS ------------*/
+/*------------------------------------------------------------*/
+
+struct ecu_rbnode *ecu_rbtree_iterator_at(struct ecu_rbtree_iterator *me,
+                                          struct ecu_rbtree *tree,
+                                          struct ecu_rbnode *start)
+{
+    ECU_ASSERT( (me && tree && start) );
+    ECU_ASSERT( (ecu_rbtree_valid(tree)) );
+    ECU_ASSERT( (ecu_rbnode_valid(start)) );
+    ECU_ASSERT( (start->tree == tree) );
+
+    me->tree = tree;
+    me->current = start;
+    me->next = successor(start);
+    return me->current;
+}
+
+struct ecu_rbnode *ecu_rbtree_iterator_begin(struct ecu_rbtree_iterator *me, struct ecu_rbtree *tree)
+{
+    ECU_ASSERT( (me && tree) );
+    ECU_ASSERT( (ecu_rbtree_valid(tree)) );
+
+    me->tree = tree;
+    me->current = tree->min;
+    me->next = (me->current) ? successor(me->current) : (struct ecu_rbnode *)0;
+    return me->current;
+}
+
+struct ecu_rbnode *ecu_rbtree_iterator_end(struct ecu_rbtree_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    (void)me;
+    return (struct ecu_rbnode *)0;
+}
+
+struct ecu_rbnode *ecu_rbtree_iterator_next(struct ecu_rbtree_iterator *me)
+{
+    ECU_ASSERT( (me && me->tree) );
+
+    /* Successor of the new current node is looked up after the previous
+    current node may have been removed. Rotations never change sorted
+    order so this is still correct. */
+    me->current = me->next;
+    me->next = (me->current) ? successor(me->current) : (struct ecu_rbnode *)0;
+    return me->current;
+}
+
+/*------------------------------------------------------------*/
+/*------------- CONST ITERATOR MEMBER FUNCTIONS --------------*/
+/*------------------------------------------------------------*/
+
+const struct ecu_rbnode *ecu_rbtree_iterator_cat(struct ecu_rbtree_citerator *me,
+                                                 const struct ecu_rbtree *tree,
+                                                 const struct ecu_rbnode *start)
+{
+    ECU_ASSERT( (me && tree && start) );
+    ECU_ASSERT( (ecu_rbtree_valid(tree)) );
+    ECU_ASSERT( (ecu_rbnode_valid(start)) );
+    ECU_ASSERT( (start->tree == tree) );
+
+    me->tree = tree;
+    me->current = start;
+    me->next = successor(start);
+    return me->current;
+}
+
+const struct ecu_rbnode *ecu_rbtree_iterator_cbegin(struct ecu_rbtree_citerator *me,
+                                                    const struct ecu_rbtree *tree)
+{
+    ECU_ASSERT( (me && tree) );
+    ECU_ASSERT( (ecu_rbtree_valid(tree)) );
+
+    me->tree = tree;
+    me->current = tree->min;
+    me->next = (me->current) ? successor(me->current) : (const struct ecu_rbnode *)0;
+    return me->current;
+}
+
+const struct ecu_rbnode *ecu_rbtree_iterator_cend(struct ecu_rbtree_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    (void)me;
+    return (const struct ecu_rbnode *)0;
+}
+
+const struct ecu_rbnode *ecu_rbtree_iterator_cnext(struct ecu_rbtree_citerator *me)
+{
+    ECU_ASSERT( (me && me->tree) );
+
+    me->current = me->next;
+    me->next = (me->current) ? successor(me->current) : (const struct ecu_rbnode *)0;
+    return me->current;
+}
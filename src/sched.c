@@ -0,0 +1,300 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`sched.h section <sched_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/sched.h"
+
+/* STDLib. */
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Runtime asserts. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/sched.c")
+
+/*------------------------------------------------------------*/
+/*---------------------- STATIC ASSERTS ----------------------*/
+/*------------------------------------------------------------*/
+
+ECU_STATIC_ASSERT( (ECU_SCHED_PRIORITIES > 0), "ECU_SCHED_PRIORITIES must be at least 1." );
+ECU_STATIC_ASSERT( (ECU_SCHED_GROUPS <= (ECU_FIELD_SIZEOF(struct ecu_sched, groups) * 8)),
+                    "ECU_SCHED_PRIORITIES exceeds the number of levels ecu_sched::groups can track." );
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Returns the index of the most significant set bit
+ * in @p x. @p x cannot be 0.
+ */
+static unsigned int highest_bit(uint32_t x);
+
+/**
+ * @brief Marks @p priority as having queued events.
+ */
+static void set_ready(struct ecu_sched *me, size_t priority);
+
+/**
+ * @brief Marks @p priority as having no queued events.
+ */
+static void clear_ready(struct ecu_sched *me, size_t priority);
+
+/**
+ * @brief Returns the highest priority with queued events.
+ * At least one priority must be ready.
+ */
+static size_t highest_ready(const struct ecu_sched *me);
+
+/**
+ * @brief Post hook installed in every added active object.
+ * @p obj is the object's @ref ecu_sched_level.
+ */
+static void ao_posted(struct ecu_ao *ao, void *obj);
+
+/**
+ * @brief Timer callback of every time event. Returns false
+ * if the queue was full so the post is retried next tick.
+ */
+static bool timer_expired(struct ecu_timer *timer, void *obj);
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static unsigned int highest_bit(uint32_t x)
+{
+    ECU_ASSERT( (x != 0) );
+#if defined(__GNUC__)
+    /* Count leading zeros. unsigned long is at least 32 bits. */
+    return (unsigned int)(((sizeof(unsigned long) * CHAR_BIT) - 1U) - (unsigned int)__builtin_clzl((unsigned long)x));
+#else
+    unsigned int bit = 0;
+
+    /* Binary search for compilers without a count leading zeros builtin. */
+    for (unsigned int shift = 16U; shift > 0; shift /= 2U)
+    {
+        if ((x >> shift) != 0)
+        {
+            bit += shift;
+            x >>= shift;
+        }
+    }
+
+    return bit;
+#endif
+}
+
+static void set_ready(struct ecu_sched *me, size_t priority)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (priority < ECU_SCHED_PRIORITIES) );
+    size_t group = priority / 32U;
+
+    me->ready[group] |= ((uint32_t)1 << (priority % 32U));
+    me->groups |= ((uint32_t)1 << group);
+}
+
+static void clear_ready(struct ecu_sched *me, size_t priority)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (priority < ECU_SCHED_PRIORITIES) );
+    size_t group = priority / 32U;
+
+    me->ready[group] &= ~((uint32_t)1 << (priority % 32U));
+
+    if (me->ready[group] == 0)
+    {
+        me->groups &= ~((uint32_t)1 << group);
+    }
+}
+
+static size_t highest_ready(const struct ecu_sched *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (me->groups != 0) );
+    unsigned int group = highest_bit(me->groups);
+    return ((size_t)group * 32U) + highest_bit(me->ready[group]);
+}
+
+static void ao_posted(struct ecu_ao *ao, void *obj)
+{
+    ECU_ASSERT( (ao && obj) );
+    struct ecu_sched_level *level = (struct ecu_sched_level *)obj;
+    ECU_ASSERT( (level->ao == ao) );
+    set_ready(level->sched, (size_t)(level - &level->sched->levels[0]));
+}
+
+static bool timer_expired(struct ecu_timer *timer, void *obj)
+{
+    ECU_ASSERT( (timer && obj) );
+    struct ecu_sched_timer *me = (struct ecu_sched_timer *)obj;
+    return ecu_ao_post(me->ao, me->event);
+}
+
+/*------------------------------------------------------------*/
+/*------------------- SCHED MEMBER FUNCTIONS -----------------*/
+/*------------------------------------------------------------*/
+
+void ecu_sched_ctor(struct ecu_sched *me,
+                    void (*idle)(struct ecu_sched *me, ecu_tick_t timeout, void *obj),
+                    void *obj)
+{
+    ECU_ASSERT( (me) );
+
+    for (size_t i = 0; i < ECU_SCHED_PRIORITIES; i++)
+    {
+        me->levels[i].ao = (struct ecu_ao *)0;
+        me->levels[i].sched = me;
+    }
+
+    for (size_t i = 0; i < ECU_SCHED_GROUPS; i++)
+    {
+        me->ready[i] = 0;
+    }
+
+    me->groups = 0;
+    ecu_tlist_ctor(&me->timers);
+    me->idle = idle;
+    me->idle_obj = obj;
+}
+
+void ecu_sched_add(struct ecu_sched *me, struct ecu_ao *ao, size_t priority)
+{
+    ECU_ASSERT( (me && ao) );
+    ECU_ASSERT( (priority < ECU_SCHED_PRIORITIES) );
+    ECU_ASSERT( (!me->levels[priority].ao) ); /* One active object per priority. */
+    me->levels[priority].ao = ao;
+    ecu_ao_set_post_hook(ao, &ao_posted, &me->levels[priority]);
+
+    if (ecu_ao_count(ao) > 0)
+    {
+        set_ready(me, priority);
+    }
+}
+
+bool ecu_sched_ready(const struct ecu_sched *me)
+{
+    ECU_ASSERT( (me) );
+    return (me->groups != 0);
+}
+
+bool ecu_sched_run_once(struct ecu_sched *me)
+{
+    ECU_ASSERT( (me) );
+    bool status = false;
+
+    if (me->groups != 0)
+    {
+        size_t priority = highest_ready(me);
+        struct ecu_ao *ao = me->levels[priority].ao;
+        ECU_ASSERT( (ao) );
+
+        (void)ecu_ao_run_once(ao);
+
+        /* Handler may have posted to its own object, which keeps it ready. */
+        if (ecu_ao_count(ao) == 0)
+        {
+            clear_ready(me, priority);
+        }
+
+        status = true;
+    }
+
+    return status;
+}
+
+size_t ecu_sched_run_until_idle(struct ecu_sched *me)
+{
+    ECU_ASSERT( (me) );
+    size_t dispatched = 0;
+
+    /* Re-select after every event so a higher-priority object
+    made ready by a handler runs before lower ones continue. */
+    while (ecu_sched_run_once(me))
+    {
+        dispatched++;
+    }
+
+    if (me->idle)
+    {
+        (*me->idle)(me, ecu_tlist_next_timeout(&me->timers), me->idle_obj);
+    }
+
+    return dispatched;
+}
+
+void ecu_sched_start(struct ecu_sched *me)
+{
+    ECU_ASSERT( (me) );
+
+    for (size_t i = ECU_SCHED_PRIORITIES; i > 0; i--)
+    {
+        if (me->levels[i - 1].ao)
+        {
+            ecu_ao_start(me->levels[i - 1].ao);
+        }
+    }
+}
+
+void ecu_sched_tick(struct ecu_sched *me, ecu_tick_t elapsed)
+{
+    ECU_ASSERT( (me) );
+    ecu_tlist_service(&me->timers, elapsed);
+}
+
+/*------------------------------------------------------------*/
+/*---------------- SCHED TIMER MEMBER FUNCTIONS --------------*/
+/*------------------------------------------------------------*/
+
+void ecu_sched_timer_ctor(struct ecu_sched_timer *me,
+                          struct ecu_ao *ao,
+                          const struct ecu_event *event)
+{
+    ECU_ASSERT( (me && ao && event) );
+    ecu_timer_ctor(&me->timer, &timer_expired, me);
+    me->ao = ao;
+    me->event = event;
+}
+
+bool ecu_sched_timer_active(const struct ecu_sched_timer *me)
+{
+    ECU_ASSERT( (me) );
+    return ecu_timer_active(&me->timer);
+}
+
+void ecu_sched_timer_arm(struct ecu_sched *sched,
+                         struct ecu_sched_timer *me,
+                         ecu_tick_t period,
+                         enum ecu_timer_type_e type)
+{
+    ECU_ASSERT( (sched && me) );
+    ecu_tlist_timer_arm(&sched->timers, &me->timer, period, type);
+}
+
+void ecu_sched_timer_disarm(struct ecu_sched_timer *me)
+{
+    ECU_ASSERT( (me) );
+    ecu_timer_disarm(&me->timer);
+}
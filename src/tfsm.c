@@ -0,0 +1,244 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`tfsm.h section <tfsm_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/tfsm.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ECU. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/tfsm.c")
+
+/*------------------------------------------------------------*/
+/*---------------------- FILE SCOPE TYPES --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Meaning of bits in @ref ecu_tfsm.transition bitmap.
+ * A set bit means that type of state transition is active.
+ * Same as fsm.c.
+ */
+enum transition_type
+{
+    TFSM_SELF_TRANSITION,
+    TFSM_STATE_TRANSITION,
+    /************************/
+    TFSM_TRANSITION_TYPE_COUNT
+};
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Returns true if no state transitions have
+ * been signalled. False otherwise.
+ */
+static bool no_transitions_active(const struct ecu_tfsm *fsm);
+
+/**
+ * @brief Returns true if a specific state transition
+ * type has been signalled. False otherwise.
+ */
+static bool transition_is_active(const struct ecu_tfsm *fsm, enum transition_type t);
+
+/**
+ * @brief Signals that a specific state transition type
+ * has been requested.
+ */
+static void set_transition(struct ecu_tfsm *fsm, enum transition_type t);
+
+/**
+ * @brief Clears all @ref ecu_tfsm transition bits.
+ */
+static void clear_all_transitions(struct ecu_tfsm *fsm);
+
+/**
+ * @brief Runs exit and entry handlers for every transition that
+ * was signalled, starting from @p prev. Shared by dispatch and
+ * start so both follow the rules of fsm.c.
+ */
+static void run_transitions(struct ecu_tfsm *fsm, ecu_tfsm_state_t prev);
+
+/*------------------------------------------------------------*/
+/*---------------------- STATIC ASSERTS ----------------------*/
+/*------------------------------------------------------------*/
+
+ECU_STATIC_ASSERT( (((size_t)TFSM_TRANSITION_TYPE_COUNT) <= (ECU_FIELD_SIZEOF(struct ecu_tfsm, transition) * 8)),
+                    "Max value in transition_type enum exceeds most significant bit of ecu_tfsm::transition bitfield." );
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static bool no_transitions_active(const struct ecu_tfsm *fsm)
+{
+    ECU_ASSERT( (fsm) );
+    return (fsm->transition == 0);
+}
+
+static bool transition_is_active(const struct ecu_tfsm *fsm, enum transition_type t)
+{
+    ECU_ASSERT( (fsm) );
+    ECU_ASSERT( (t < TFSM_TRANSITION_TYPE_COUNT) );
+    return ((fsm->transition & (1U << t)) != 0);
+}
+
+static void set_transition(struct ecu_tfsm *fsm, enum transition_type t)
+{
+    ECU_ASSERT( (fsm) );
+    ECU_ASSERT( (t < TFSM_TRANSITION_TYPE_COUNT) );
+    fsm->transition = (uint8_t)(fsm->transition | (1U << t));
+}
+
+static void clear_all_transitions(struct ecu_tfsm *fsm)
+{
+    ECU_ASSERT( (fsm) );
+    fsm->transition = 0;
+}
+
+static void run_transitions(struct ecu_tfsm *fsm, ecu_tfsm_state_t prev)
+{
+    ECU_ASSERT( (fsm) );
+    const struct ecu_tfsm_state *states = fsm->table->states;
+
+    /* Same order as fsm.c. Exit handlers cannot transition since the state
+    is already being exited. Entry handlers cannot self-transition since
+    that would loop forever. */
+    if (transition_is_active(fsm, TFSM_SELF_TRANSITION))
+    {
+        clear_all_transitions(fsm);
+
+        if (states[prev].exit)
+        {
+            (*states[prev].exit)(fsm);
+            ECU_ASSERT( (no_transitions_active(fsm)) ); /* No state transitions allowed in exit handler. */
+        }
+
+        prev = fsm->state;
+        if (states[fsm->state].entry)
+        {
+            (*states[fsm->state].entry)(fsm);
+            ECU_ASSERT( (!transition_is_active(fsm, TFSM_SELF_TRANSITION)) ); /* Self-transition not allowed in entry handler. */
+        }
+    }
+
+    while (transition_is_active(fsm, TFSM_STATE_TRANSITION))
+    {
+        clear_all_transitions(fsm);
+
+        if (states[prev].exit)
+        {
+            (*states[prev].exit)(fsm);
+            ECU_ASSERT( (no_transitions_active(fsm)) ); /* No state transitions allowed in exit handler. */
+        }
+
+        prev = fsm->state;
+        if (states[fsm->state].entry)
+        {
+            (*states[fsm->state].entry)(fsm);
+            ECU_ASSERT( (!transition_is_active(fsm, TFSM_SELF_TRANSITION)) ); /* Self-transition not allowed in entry handler. */
+        }
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- TFSM MEMBER FUNCTIONS ------------------*/
+/*------------------------------------------------------------*/
+
+void ecu_tfsm_ctor(struct ecu_tfsm *me,
+                   const struct ecu_tfsm_table *table,
+                   ecu_tfsm_state_t state)
+{
+    ECU_ASSERT( (me && table) );
+    ECU_ASSERT( (table->states && table->cells) );
+    ECU_ASSERT( (table->event_count > 0) );
+    ECU_ASSERT( (table->state_count < ECU_TFSM_NO_TRANSITION) );
+    ECU_ASSERT( (state < table->state_count) );
+    me->table = table;
+    me->state = state;
+    clear_all_transitions(me);
+}
+
+void ecu_tfsm_change_state(struct ecu_tfsm *me, ecu_tfsm_state_t state)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (no_transitions_active(me)) ); /* Cannot call ecu_tfsm_change_state() multiple times in a row. Only one transition per dispatch. */
+    ECU_ASSERT( (state < me->table->state_count) );
+
+    if (me->state == state)
+    {
+        set_transition(me, TFSM_SELF_TRANSITION);
+    }
+    else
+    {
+        set_transition(me, TFSM_STATE_TRANSITION);
+        me->state = state;
+    }
+}
+
+void ecu_tfsm_dispatch(struct ecu_tfsm *me, size_t event, const void *data)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (no_transitions_active(me)) );
+    ECU_ASSERT( (event < me->table->event_count) );
+    ecu_tfsm_state_t prev = me->state;
+    const struct ecu_tfsm_cell *cell = &me->table->cells[((size_t)prev * me->table->event_count) + event];
+
+    if (cell->action)
+    {
+        (*cell->action)(me, data);
+    }
+
+    /* Table transition is applied after the action, like a handler that
+    calls ecu_fsm_change_state(). Asserts if the action also transitioned. */
+    if (cell->target != ECU_TFSM_NO_TRANSITION)
+    {
+        ecu_tfsm_change_state(me, cell->target);
+    }
+
+    run_transitions(me, prev);
+}
+
+void ecu_tfsm_start(struct ecu_tfsm *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (no_transitions_active(me)) );
+    ecu_tfsm_state_t prev = me->state;
+
+    if (me->table->states[me->state].entry)
+    {
+        (*me->table->states[me->state].entry)(me);
+        ECU_ASSERT( (!transition_is_active(me, TFSM_SELF_TRANSITION)) ); /* Self-transition not allowed in entry handler. */
+        run_transitions(me, prev);
+    }
+}
+
+ecu_tfsm_state_t ecu_tfsm_current_state(const struct ecu_tfsm *me)
+{
+    ECU_ASSERT( (me) );
+    return me->state;
+}
@@ -211,6 +211,46 @@ void ecu_tlist_ctor(struct ecu_tlist *me)
     ecu_dlist_ctor(&me->wraparounds);
 }
 
+ecu_tick_t ecu_tlist_next_timeout(const struct ecu_tlist *me)
+{
+    ECU_ASSERT( (me) );
+    ecu_tick_t ticks = ECU_TICK_MAX;
+    const struct ecu_timer *t = (const struct ecu_timer *)0;
+
+    if (!ecu_dlist_empty(&me->timers))
+    {
+        /* Lists are ordered so the front timer expires first. */
+        t = ECU_DNODE_GET_CONST_ENTRY(ecu_dlist_cfront(&me->timers), struct ecu_timer, dnode);
+
+        if (t->expiration > me->current)
+        {
+            ticks = t->expiration - me->current;
+        }
+        else
+        {
+            ticks = 0;
+        }
+    }
+    else if (!ecu_dlist_empty(&me->wraparounds))
+    {
+        t = ECU_DNODE_GET_CONST_ENTRY(ecu_dlist_cfront(&me->wraparounds), struct ecu_timer, dnode);
+
+        if (t->expiration < me->current)
+        {
+            /* Expires after me->current wraps around. */
+            ticks = (ECU_TICK_MAX - me->current) + t->expiration + 1U;
+        }
+        else
+        {
+            /* Only possible if called from a timer callback while me->current
+            has already wrapped around in the middle of ecu_tlist_service(). */
+            ticks = t->expiration - me->current;
+        }
+    }
+
+    return ticks;
+}
+
 void ecu_tlist_service(struct ecu_tlist *me, ecu_tick_t elapsed)
 {
     ECU_ASSERT( (me) );
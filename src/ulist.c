@@ -0,0 +1,716 @@
+/**
+ * @file
+ * @brief
+ * @rst
+ * See :ref:`ulist.h section <ulist_h>` in Sphinx documentation.
+ * @endrst
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Translation unit. */
+#include "ecu/ulist.h"
+
+/* STDLib. */
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Runtime asserts. */
+#include "ecu/asserter.h"
+
+/*------------------------------------------------------------*/
+/*--------------- DEFINE FILE NAME FOR ASSERTER --------------*/
+/*------------------------------------------------------------*/
+
+ECU_ASSERT_DEFINE_FILE("ecu/ulist.c")
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DECLARATIONS --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Converts a node in @ref ecu_ulist.blocks back into its
+ * block. Returns NULL if @p node is NULL.
+ */
+static struct ecu_ulist_block *to_block(struct ecu_dnode *node);
+
+/**
+ * @brief Const-qualified version of @ref to_block().
+ */
+static const struct ecu_ulist_block *to_cblock(const struct ecu_dnode *node);
+
+/**
+ * @brief Returns pointer to element @p index in @p block.
+ */
+static void *element(const struct ecu_ulist *me, struct ecu_ulist_block *block, size_t index);
+
+/**
+ * @brief Const-qualified version of @ref element().
+ */
+static const void *celement(const struct ecu_ulist *me, const struct ecu_ulist_block *block, size_t index);
+
+/**
+ * @brief Allocates and constructs an empty block that is not in
+ * the list yet. Returns NULL if the allocator has no memory.
+ */
+static struct ecu_ulist_block *block_create(struct ecu_ulist *me);
+
+/**
+ * @brief Removes @p block from the list and returns its memory
+ * to the allocator.
+ */
+static void block_destroy(struct ecu_ulist *me, struct ecu_ulist_block *block);
+
+/**
+ * @brief Copies @p elem into @p block at @p index, shifting
+ * subsequent elements up. @p block must not be full.
+ */
+static void block_insert(struct ecu_ulist *me, struct ecu_ulist_block *block, size_t index, const void *elem);
+
+/**
+ * @brief Removes element @p index from @p block, shifting subsequent
+ * elements down. Element is copied into @p out if it is not NULL.
+ * Block is not destroyed if it becomes empty.
+ */
+static void block_erase(struct ecu_ulist *me, struct ecu_ulist_block *block, size_t index, void *out);
+
+/**
+ * @brief Moves the upper half of a full @p block into a new block
+ * inserted after it. Returns the new block or NULL if the allocator
+ * has no memory, in which case @p block is unchanged.
+ */
+static struct ecu_ulist_block *block_split(struct ecu_ulist *me, struct ecu_ulist_block *block);
+
+/**
+ * @brief Copies @p elem into the list at @p index of @p block. Makes
+ * room by using a neighbouring block, allocating a new block, or
+ * splitting @p block if it is full. @p block is NULL if the list is
+ * empty. Returns false if memory was required but not available.
+ */
+static bool insert_at(struct ecu_ulist *me, struct ecu_ulist_block *block, size_t index, const void *elem);
+
+/*------------------------------------------------------------*/
+/*---------------- STATIC FUNCTION DEFINITIONS ---------------*/
+/*------------------------------------------------------------*/
+
+static struct ecu_ulist_block *to_block(struct ecu_dnode *node)
+{
+    struct ecu_ulist_block *block = (struct ecu_ulist_block *)0;
+
+    if (node)
+    {
+        block = ECU_DNODE_GET_ENTRY(node, struct ecu_ulist_block, dnode);
+    }
+
+    return block;
+}
+
+static const struct ecu_ulist_block *to_cblock(const struct ecu_dnode *node)
+{
+    const struct ecu_ulist_block *block = (const struct ecu_ulist_block *)0;
+
+    if (node)
+    {
+        block = ECU_DNODE_GET_CONST_ENTRY(node, struct ecu_ulist_block, dnode);
+    }
+
+    return block;
+}
+
+static void *element(const struct ecu_ulist *me, struct ecu_ulist_block *block, size_t index)
+{
+    ECU_ASSERT( (me && block) );
+    return ((unsigned char *)block + ECU_ULIST_BLOCK_HEADER_SIZE + (index * me->elem_size));
+}
+
+static const void *celement(const struct ecu_ulist *me, const struct ecu_ulist_block *block, size_t index)
+{
+    ECU_ASSERT( (me && block) );
+    return ((const unsigned char *)block + ECU_ULIST_BLOCK_HEADER_SIZE + (index * me->elem_size));
+}
+
+static struct ecu_ulist_block *block_create(struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    struct ecu_ulist_block *block = (struct ecu_ulist_block *)(*me->block_alloc)(me->obj);
+
+    if (block)
+    {
+        ecu_dnode_ctor(&block->dnode, ECU_DNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+        block->count = 0;
+    }
+
+    return block;
+}
+
+static void block_destroy(struct ecu_ulist *me, struct ecu_ulist_block *block)
+{
+    ECU_ASSERT( (me && block) );
+    ecu_dnode_destroy(&block->dnode); /* Removes block from list. */
+    (*me->block_free)(block, me->obj);
+}
+
+static void block_insert(struct ecu_ulist *me, struct ecu_ulist_block *block, size_t index, const void *elem)
+{
+    ECU_ASSERT( (me && block && elem) );
+    ECU_ASSERT( (block->count < me->capacity) );
+    ECU_ASSERT( (index <= block->count) );
+
+    memmove(element(me, block, index + 1U), element(me, block, index), (block->count - index) * me->elem_size);
+    memcpy(element(me, block, index), elem, me->elem_size);
+    block->count++;
+}
+
+static void block_erase(struct ecu_ulist *me, struct ecu_ulist_block *block, size_t index, void *out)
+{
+    ECU_ASSERT( (me && block) );
+    ECU_ASSERT( (index < block->count) );
+
+    if (out)
+    {
+        memcpy(out, element(me, block, index), me->elem_size);
+    }
+
+    memmove(element(me, block, index), element(me, block, index + 1U), (block->count - index - 1U) * me->elem_size);
+    block->count--;
+    me->size--;
+}
+
+static struct ecu_ulist_block *block_split(struct ecu_ulist *me, struct ecu_ulist_block *block)
+{
+    ECU_ASSERT( (me && block) );
+    ECU_ASSERT( (block->count == me->capacity) );
+    size_t keep = block->count - (block->count / 2U);
+    struct ecu_ulist_block *upper = block_create(me);
+
+    if (upper)
+    {
+        memcpy(element(me, upper, 0), element(me, block, keep), (block->count - keep) * me->elem_size);
+        upper->count = block->count - keep;
+        block->count = keep;
+        ecu_dnode_insert_after(&block->dnode, &upper->dnode);
+    }
+
+    return upper;
+}
+
+static bool insert_at(struct ecu_ulist *me, struct ecu_ulist_block *block, size_t index, const void *elem)
+{
+    ECU_ASSERT( (me && elem) );
+    struct ecu_ulist_block *target = block;
+
+    if (!block)
+    {
+        /* List is empty. */
+        target = block_create(me);
+        index = 0;
+
+        if (target)
+        {
+            ecu_dlist_push_back(&me->blocks, &target->dnode);
+        }
+    }
+    else if (block->count < me->capacity)
+    {
+        /* Room in the block. Insert directly. */
+    }
+    else if (index == me->capacity)
+    {
+        /* Appending to a full block. Prepend to the next block if it
+        has room so sequential inserts leave blocks full. */
+        target = to_block(ecu_dnode_next(&block->dnode));
+        index = 0;
+
+        if (!target || target->count == me->capacity)
+        {
+            target = block_create(me);
+
+            if (target)
+            {
+                ecu_dnode_insert_after(&block->dnode, &target->dnode);
+            }
+        }
+    }
+    else if (index == 0)
+    {
+        /* Prepending to a full block. Append to the previous block if
+        it has room so sequential inserts leave blocks full. */
+        target = to_block(ecu_dnode_prev(&block->dnode));
+
+        if (!target || target->count == me->capacity)
+        {
+            target = block_create(me);
+
+            if (target)
+            {
+                ecu_dnode_insert_before(&block->dnode, &target->dnode);
+            }
+        }
+
+        if (target)
+        {
+            index = target->count;
+        }
+    }
+    else
+    {
+        /* Inserting into the middle of a full block. Split it. */
+        target = block_split(me, block);
+
+        if (target)
+        {
+            if (index > block->count)
+            {
+                index -= block->count;
+            }
+            else
+            {
+                target = block;
+            }
+        }
+    }
+
+    if (target)
+    {
+        block_insert(me, target, index, elem);
+        me->size++;
+    }
+
+    return (target != (struct ecu_ulist_block *)0);
+}
+
+/*------------------------------------------------------------*/
+/*------------------ ULIST MEMBER FUNCTIONS ------------------*/
+/*------------------------------------------------------------*/
+
+void ecu_ulist_ctor(struct ecu_ulist *me,
+                    size_t elem_size,
+                    size_t capacity,
+                    void *(*block_alloc)(void *obj),
+                    void (*block_free)(void *block, void *obj),
+                    void *obj)
+{
+    ECU_ASSERT( (me && block_alloc && block_free) );
+    ECU_ASSERT( (elem_size > 0 && capacity > 0) );
+
+    ecu_dlist_ctor(&me->blocks);
+    me->size = 0;
+    me->elem_size = elem_size;
+    me->capacity = capacity;
+    me->block_alloc = block_alloc;
+    me->block_free = block_free;
+    me->obj = obj;
+}
+
+void ecu_ulist_destroy(struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+
+    ecu_ulist_clear(me);
+    ecu_dlist_destroy(&me->blocks);
+
+    /* Setting to NULL values forces user to reconstruct the list if they
+    want to use it again, assuming asserts are enabled. */
+    me->block_alloc = (void *(*)(void *))0;
+    me->block_free = (void (*)(void *, void *))0;
+}
+
+void *ecu_ulist_back(struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    void *elem = (void *)0;
+    struct ecu_ulist_block *block = to_block(ecu_dlist_back(&me->blocks));
+
+    if (block)
+    {
+        elem = element(me, block, block->count - 1U);
+    }
+
+    return elem;
+}
+
+const void *ecu_ulist_cback(const struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    const void *elem = (const void *)0;
+    const struct ecu_ulist_block *block = to_cblock(ecu_dlist_cback(&me->blocks));
+
+    if (block)
+    {
+        elem = celement(me, block, block->count - 1U);
+    }
+
+    return elem;
+}
+
+void ecu_ulist_clear(struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    struct ecu_dlist_iterator iterator;
+
+    ECU_DLIST_FOR_EACH(node, &iterator, &me->blocks)
+    {
+        block_destroy(me, ECU_DNODE_GET_ENTRY(node, struct ecu_ulist_block, dnode));
+    }
+
+    me->size = 0;
+}
+
+void ecu_ulist_compact(struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    struct ecu_ulist_block *dst = to_block(ecu_dlist_front(&me->blocks));
+    size_t dst_index = 0;
+    struct ecu_dlist_iterator iterator;
+
+    if (dst)
+    {
+        /* Elements only ever move towards the front so the destination
+        block is always at or before the source block. */
+        ECU_DLIST_FOR_EACH(node, &iterator, &me->blocks)
+        {
+            struct ecu_ulist_block *src = ECU_DNODE_GET_ENTRY(node, struct ecu_ulist_block, dnode);
+
+            for (size_t i = 0; i < src->count; i++)
+            {
+                if (dst_index == me->capacity)
+                {
+                    dst->count = me->capacity;
+                    dst = to_block(ecu_dnode_next(&dst->dnode));
+                    dst_index = 0;
+                }
+
+                if ((dst != src) || (dst_index != i))
+                {
+                    memcpy(element(me, dst, dst_index), element(me, src, i), me->elem_size);
+                }
+
+                dst_index++;
+            }
+        }
+
+        dst->count = dst_index;
+
+        /* Release blocks after the last one that was filled. */
+        for (struct ecu_ulist_block *block = to_block(ecu_dnode_next(&dst->dnode));
+             block;
+             block = to_block(ecu_dnode_next(&dst->dnode)))
+        {
+            block_destroy(me, block);
+        }
+    }
+}
+
+bool ecu_ulist_empty(const struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    return (me->size == 0);
+}
+
+void *ecu_ulist_front(struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    void *elem = (void *)0;
+    struct ecu_ulist_block *block = to_block(ecu_dlist_front(&me->blocks));
+
+    if (block)
+    {
+        elem = element(me, block, 0);
+    }
+
+    return elem;
+}
+
+const void *ecu_ulist_cfront(const struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    const void *elem = (const void *)0;
+    const struct ecu_ulist_block *block = to_cblock(ecu_dlist_cfront(&me->blocks));
+
+    if (block)
+    {
+        elem = celement(me, block, 0);
+    }
+
+    return elem;
+}
+
+bool ecu_ulist_insert(struct ecu_ulist *me,
+                      const void *elem,
+                      bool (*lhs_less_than_rhs)(const void *lhs, const void *rhs, void *data),
+                      void *data)
+{
+    ECU_ASSERT( (me && elem && lhs_less_than_rhs) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    struct ecu_ulist_block *block = (struct ecu_ulist_block *)0;
+    size_t index = 0;
+    struct ecu_dlist_iterator iterator;
+
+    /* Compare against the last element of each block first so only
+    the block containing the insertion point is scanned. */
+    ECU_DLIST_FOR_EACH(node, &iterator, &me->blocks)
+    {
+        struct ecu_ulist_block *current = ECU_DNODE_GET_ENTRY(node, struct ecu_ulist_block, dnode);
+
+        if ((*lhs_less_than_rhs)(elem, element(me, current, current->count - 1U), data))
+        {
+            block = current;
+            index = 0;
+
+            while (!(*lhs_less_than_rhs)(elem, element(me, block, index), data))
+            {
+                index++;
+            }
+
+            break;
+        }
+    }
+
+    if (!block)
+    {
+        /* Greater than or equal to all elements. Add to back. */
+        block = to_block(ecu_dlist_back(&me->blocks));
+        index = (block) ? block->count : 0;
+    }
+
+    return insert_at(me, block, index, elem);
+}
+
+bool ecu_ulist_pop_back(struct ecu_ulist *me, void *out)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    struct ecu_ulist_block *block = to_block(ecu_dlist_back(&me->blocks));
+
+    if (block)
+    {
+        block_erase(me, block, block->count - 1U, out);
+
+        if (block->count == 0)
+        {
+            block_destroy(me, block);
+        }
+    }
+
+    return (block != (struct ecu_ulist_block *)0);
+}
+
+bool ecu_ulist_pop_front(struct ecu_ulist *me, void *out)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    struct ecu_ulist_block *block = to_block(ecu_dlist_front(&me->blocks));
+
+    if (block)
+    {
+        block_erase(me, block, 0, out);
+
+        if (block->count == 0)
+        {
+            block_destroy(me, block);
+        }
+    }
+
+    return (block != (struct ecu_ulist_block *)0);
+}
+
+bool ecu_ulist_push_back(struct ecu_ulist *me, const void *elem)
+{
+    ECU_ASSERT( (me && elem) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    struct ecu_ulist_block *block = to_block(ecu_dlist_back(&me->blocks));
+    return insert_at(me, block, (block) ? block->count : 0, elem);
+}
+
+bool ecu_ulist_push_front(struct ecu_ulist *me, const void *elem)
+{
+    ECU_ASSERT( (me && elem) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    return insert_at(me, to_block(ecu_dlist_front(&me->blocks)), 0, elem);
+}
+
+size_t ecu_ulist_size(const struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    ECU_ASSERT( (ecu_ulist_valid(me)) );
+    return me->size;
+}
+
+bool ecu_ulist_valid(const struct ecu_ulist *me)
+{
+    ECU_ASSERT( (me) );
+    bool valid = false;
+
+    if (ecu_dlist_valid(&me->blocks) &&
+        me->block_alloc && me->block_free &&
+        (me->elem_size > 0) && (me->capacity > 0))
+    {
+        valid = true;
+    }
+
+    return valid;
+}
+
+/*------------------------------------------------------------*/
+/*----------- NON-CONST ITERATOR MEMBER FUNCTIONS ------------*/
+/*------------------------------------------------------------*/
+
+void *ecu_ulist_iterator_begin(struct ecu_ulist_iterator *me, struct ecu_ulist *list)
+{
+    ECU_ASSERT( (me && list) );
+    ECU_ASSERT( (ecu_ulist_valid(list)) );
+    void *elem = (void *)0;
+
+    me->list = list;
+    me->block = to_block(ecu_dlist_front(&list->blocks));
+    me->index = 0;
+    me->removed = false;
+
+    if (me->block)
+    {
+        elem = element(list, me->block, 0);
+    }
+
+    return elem;
+}
+
+void *ecu_ulist_iterator_end(struct ecu_ulist_iterator *me)
+{
+    ECU_ASSERT( (me) );
+    (void)me;
+    return (void *)0;
+}
+
+void *ecu_ulist_iterator_next(struct ecu_ulist_iterator *me)
+{
+    ECU_ASSERT( (me && me->list) );
+    void *elem = (void *)0;
+
+    if (me->block)
+    {
+        if (me->removed)
+        {
+            /* Next element was already shifted into the current position. */
+            me->removed = false;
+        }
+        else
+        {
+            me->index++;
+        }
+
+        if (me->index >= me->block->count)
+        {
+            me->block = to_block(ecu_dnode_next(&me->block->dnode));
+            me->index = 0;
+        }
+
+        if (me->block)
+        {
+            elem = element(me->list, me->block, me->index);
+        }
+    }
+
+    return elem;
+}
+
+void ecu_ulist_iterator_remove(struct ecu_ulist_iterator *me)
+{
+    ECU_ASSERT( (me && me->list && me->block) );
+    ECU_ASSERT( (!me->removed) );
+    struct ecu_ulist *list = me->list;
+    struct ecu_ulist_block *block = me->block;
+    struct ecu_ulist_block *next = (struct ecu_ulist_block *)0;
+
+    block_erase(list, block, me->index, (void *)0);
+    next = to_block(ecu_dnode_next(&block->dnode));
+
+    /* Absorb the next block if this one is under half full and both fit.
+    Elements are appended so the iterator's index is still correct. */
+    if ((block->count < (list->capacity / 2U)) && next &&
+        ((block->count + next->count) <= list->capacity))
+    {
+        memcpy(element(list, block, block->count), element(list, next, 0), next->count * list->elem_size);
+        block->count += next->count;
+        block_destroy(list, next);
+    }
+
+    if (block->count == 0)
+    {
+        /* Only possible if there was no next block to absorb, or the
+        capacity is 1. Continue the iteration at the next block. */
+        me->block = next;
+        me->index = 0;
+        block_destroy(list, block);
+    }
+
+    me->removed = true;
+}
+
+/*------------------------------------------------------------*/
+/*------------- CONST ITERATOR MEMBER FUNCTIONS --------------*/
+/*------------------------------------------------------------*/
+
+const void *ecu_ulist_iterator_cbegin(struct ecu_ulist_citerator *me, const struct ecu_ulist *list)
+{
+    ECU_ASSERT( (me && list) );
+    ECU_ASSERT( (ecu_ulist_valid(list)) );
+    const void *elem = (const void *)0;
+
+    me->list = list;
+    me->block = to_cblock(ecu_dlist_cfront(&list->blocks));
+    me->index = 0;
+
+    if (me->block)
+    {
+        elem = celement(list, me->block, 0);
+    }
+
+    return elem;
+}
+
+const void *ecu_ulist_iterator_cend(struct ecu_ulist_citerator *me)
+{
+    ECU_ASSERT( (me) );
+    (void)me;
+    return (const void *)0;
+}
+
+const void *ecu_ulist_iterator_cnext(struct ecu_ulist_citerator *me)
+{
+    ECU_ASSERT( (me && me->list) );
+    const void *elem = (const void *)0;
+
+    if (me->block)
+    {
+        me->index++;
+
+        if (me->index >= me->block->count)
+        {
+            me->block = to_cblock(ecu_dnode_cnext(&me->block->dnode));
+            me->index = 0;
+        }
+
+        if (me->block)
+        {
+            elem = celement(me->list, me->block, me->index);
+        }
+    }
+
+    return elem;
+}
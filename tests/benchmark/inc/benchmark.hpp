@@ -0,0 +1,147 @@
+/**
+ * @file
+ * @brief Minimal benchmark harness. Benchmarks are registered with
+ * @ref BENCHMARK() and run by main.cpp. Each measurement is repeated
+ * and the median time per element is reported so results are
+ * comparable across data structures of different sizes.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef BENCHMARK_HPP_
+#define BENCHMARK_HPP_
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* STDLib. */
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+/*------------------------------------------------------------*/
+/*-------------------------- DEFINES -------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Defines and registers a benchmark. Usage:
+ * @code{.cpp}
+ * BENCHMARK(dlist_iterate)
+ * {
+ *     bench::measure("label", elements, setup, body);
+ * }
+ * @endcode
+ */
+#define BENCHMARK(name_)                                                        \
+    static void benchmark_##name_();                                           \
+    static const bench::registrar benchmark_##name_##_registrar_(#name_, &benchmark_##name_); \
+    static void benchmark_##name_()
+
+namespace bench
+{
+/*------------------------------------------------------------*/
+/*------------------------- REGISTRY -------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Registered benchmark.
+ */
+struct entry
+{
+    const char *name;
+    void (*run)();
+};
+
+/**
+ * @brief Returns all registered benchmarks. Function-local static so
+ * registration order across translation units does not matter.
+ */
+inline std::vector<entry>& registry()
+{
+    static std::vector<entry> entries;
+    return entries;
+}
+
+/**
+ * @brief Adds a benchmark to the registry at static initialization.
+ */
+struct registrar
+{
+    registrar(const char *name, void (*run)())
+    {
+        registry().push_back(entry{name, run});
+    }
+};
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Number of times each measurement is repeated. The
+ * median is reported.
+ */
+inline constexpr std::size_t SAMPLES = 11;
+
+/**
+ * @brief Prevents the compiler from optimizing away @p value.
+ */
+template<typename T>
+inline void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Evicts previously touched data from the CPU caches by
+ * writing to a buffer larger than the last level cache. Used to
+ * measure cold, cache-missing workloads.
+ */
+inline void flush_cache()
+{
+    static std::vector<unsigned char> buffer(64U * 1024U * 1024U);
+    static unsigned char value = 0;
+
+    ++value;
+    std::memset(buffer.data(), value, buffer.size());
+    do_not_optimize(buffer.data());
+}
+
+/**
+ * @brief Runs @p setup then times @p body @ref SAMPLES times. Prints
+ * the median time per element. @p setup is not timed.
+ *
+ * @param label Printed alongside the result.
+ * @param elements Number of elements processed by one call to @p body.
+ * @param setup Called before each timed run of @p body. I.e. @ref flush_cache().
+ * @param body Workload being measured.
+ */
+template<typename Setup, typename Body>
+inline void measure(const char *label, std::size_t elements, Setup&& setup, Body&& body)
+{
+    std::vector<double> ns(SAMPLES);
+
+    for (auto& sample : ns)
+    {
+        setup();
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const auto stop = std::chrono::steady_clock::now();
+        sample = std::chrono::duration<double, std::nano>(stop - start).count();
+    }
+
+    std::sort(ns.begin(), ns.end());
+    const double median = ns[ns.size() / 2];
+    std::printf("  %-40s %10.3f ns/element %12.3f ms total\n",
+                label, median / static_cast<double>(elements), median / 1e6);
+}
+} /* namespace bench */
+
+#endif /* BENCHMARK_HPP_ */
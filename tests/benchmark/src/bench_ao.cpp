@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @brief Benchmarks for ao.h. Compares dispatching events straight
+ * to an @ref ecu_fsm against posting them to an @ref ecu_ao and
+ * running its queue after every post, or once per batch.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ao.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Event with a small payload.
+ */
+struct bench_event
+{
+    /// @brief Base class. Must be first.
+    struct ecu_event base;
+
+    /// @brief Summed by the handler.
+    std::uint32_t value;
+};
+
+/**
+ * @brief Sum of every dispatched payload so the handler cannot
+ * be optimized away.
+ */
+static std::uint32_t sum = 0;
+
+/**
+ * @brief Only state's handler.
+ */
+static void handler(struct ecu_fsm *me, const void *event)
+{
+    (void)me;
+    sum += static_cast<const struct bench_event *>(event)->value;
+}
+
+static const struct ecu_fsm_state STATE = ECU_FSM_STATE_CTOR(
+    ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler
+);
+
+/**
+ * @brief Delivers @p n events, @p batch at a time.
+ */
+static void run(std::size_t n, std::size_t batch)
+{
+    std::vector<std::uint8_t> buffer(ECU_AO_BUFFER_SIZE(sizeof(struct bench_event), batch));
+    struct bench_event event;
+    struct ecu_fsm fsm;
+    struct ecu_ao ao;
+    char label[96];
+
+    ecu_event_ctor(&event.base, ECU_USER_EVENT_ID_BEGIN, sizeof(struct bench_event));
+    ecu_fsm_ctor(&fsm, &STATE);
+    ecu_ao_fsm_ctor(&ao, &fsm, buffer.data(), buffer.size(), sizeof(struct bench_event));
+
+    std::snprintf(&label[0], sizeof(label), "ecu_fsm_dispatch (no queue) n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            event.value = static_cast<std::uint32_t>(i);
+            ecu_fsm_dispatch(&fsm, &event);
+        }
+
+        bench::do_not_optimize(sum);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ao_post/run_once n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            event.value = static_cast<std::uint32_t>(i);
+            (void)ecu_ao_post(&ao, &event.base);
+            (void)ecu_ao_run_once(&ao);
+        }
+
+        bench::do_not_optimize(sum);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ao_post/run_until_empty batch=%zu n=%zu", batch, n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 0; i < n; i += batch)
+        {
+            for (std::size_t j = 0; j < batch; j++)
+            {
+                event.value = static_cast<std::uint32_t>(i + j);
+                (void)ecu_ao_post(&ao, &event.base);
+            }
+
+            (void)ecu_ao_run_until_empty(&ao);
+        }
+
+        bench::do_not_optimize(sum);
+    });
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(ao_post_dispatch)
+{
+    run(65536U, 64U);
+}
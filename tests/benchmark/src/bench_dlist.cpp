@@ -0,0 +1,196 @@
+/**
+ * @file
+ * @brief Benchmarks for dlist.h. Measures iteration of cold lists
+ * whose nodes are scattered across memory, which is bound by
+ * pointer-chasing latency. Compares @ref ECU_DLIST_FOR_EACH()
+ * against @ref ECU_DLIST_FOR_EACH_PREFETCH() at various distances.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/dlist.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------- FILE-SCOPE VARIABLES -------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Number of nodes in cold lists. Large enough that the
+ * list does not fit in the last level cache.
+ */
+static constexpr std::size_t COLD_NODES = 1U << 20U;
+
+/**
+ * @brief Number of nodes in warm lists. Small enough that the
+ * list stays in the L1/L2 cache between runs.
+ */
+static constexpr std::size_t WARM_NODES = 1U << 10U;
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief User type stored in the list. Padded to a cache line
+ * so every node visited is a separate cache miss.
+ */
+struct alignas(64) item
+{
+    struct ecu_dnode node;
+    std::uint64_t value;
+};
+
+/**
+ * @brief List whose nodes are linked in a random order relative
+ * to their address, so traversal does not benefit from hardware
+ * stride prefetchers.
+ */
+struct scattered_list
+{
+    explicit scattered_list(std::size_t count)
+        : items(count)
+    {
+        std::vector<std::size_t> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), std::mt19937_64{1234});
+
+        ecu_dlist_ctor(&list);
+        for (std::size_t i : order)
+        {
+            ecu_dnode_ctor(&items[i].node, ECU_DNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+            items[i].value = i;
+            ecu_dlist_push_back(&list, &items[i].node);
+        }
+    }
+
+    ~scattered_list()
+    {
+        ecu_dlist_destroy(&list);
+    }
+
+    std::vector<item> items;
+    struct ecu_dlist list;
+};
+
+/**
+ * @brief Per-node workload. Mixes @p value @p rounds times so the
+ * CPU has independent work to overlap with outstanding prefetches.
+ */
+static std::uint64_t work(std::uint64_t value, unsigned rounds)
+{
+    for (unsigned i = 0; i < rounds; i++)
+    {
+        value ^= value >> 33U;
+        value *= 0xff51afd7ed558ccdULL;
+    }
+
+    return value;
+}
+
+/**
+ * @brief Applies @ref work() to all nodes with @ref ECU_DLIST_FOR_EACH().
+ */
+static std::uint64_t visit(struct ecu_dlist& list, unsigned rounds)
+{
+    std::uint64_t total = 0;
+    struct ecu_dlist_iterator iterator;
+
+    ECU_DLIST_FOR_EACH(n, &iterator, &list)
+    {
+        total += work(ECU_DNODE_GET_ENTRY(n, struct item, node)->value, rounds);
+    }
+
+    return total;
+}
+
+/**
+ * @brief Applies @ref work() to all nodes with @ref ECU_DLIST_FOR_EACH_PREFETCH().
+ */
+static std::uint64_t visit_prefetch(struct ecu_dlist& list, std::size_t distance, unsigned rounds)
+{
+    std::uint64_t total = 0;
+    struct ecu_dlist_prefetch_iterator iterator;
+
+    ECU_DLIST_FOR_EACH_PREFETCH(n, &iterator, &list, distance)
+    {
+        total += work(ECU_DNODE_GET_ENTRY(n, struct item, node)->value, rounds);
+    }
+
+    return total;
+}
+
+/**
+ * @brief Compares plain and prefetching iteration over a cold list.
+ */
+static void compare_cold(unsigned rounds)
+{
+    scattered_list l(COLD_NODES);
+
+    bench::measure("ECU_DLIST_FOR_EACH", COLD_NODES, bench::flush_cache, [&]() {
+        bench::do_not_optimize(visit(l.list, rounds));
+    });
+
+    for (std::size_t distance : {1U, 2U, 4U, 8U, 16U})
+    {
+        char label[64];
+        std::snprintf(&label[0], sizeof(label), "ECU_DLIST_FOR_EACH_PREFETCH distance=%zu", distance);
+
+        bench::measure(&label[0], COLD_NODES, bench::flush_cache, [&]() {
+            bench::do_not_optimize(visit_prefetch(l.list, distance, rounds));
+        });
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(dlist_iterate_cold)
+{
+    /* Pure pointer chase. The prefetch cursor walks the same dependent
+    chain of loads as the iterator, so there is nothing to overlap the
+    misses with. Expect no gain. This is the worst case. */
+    compare_cold(0);
+}
+
+BENCHMARK(dlist_iterate_cold_with_work)
+{
+    /* Per-node work comparable to a cache miss. Prefetches for nodes
+    further ahead are in flight while the current node is processed. */
+    compare_cold(64);
+}
+
+BENCHMARK(dlist_iterate_warm)
+{
+    /* Small enough to stay in cache. Shows the overhead of the
+    prefetch iterator when there is nothing to hide. */
+    scattered_list l(WARM_NODES);
+    auto no_setup = []() {};
+
+    bench::measure("ECU_DLIST_FOR_EACH", WARM_NODES, no_setup, [&]() {
+        bench::do_not_optimize(visit(l.list, 0));
+    });
+
+    bench::measure("ECU_DLIST_FOR_EACH_PREFETCH distance=4", WARM_NODES, no_setup, [&]() {
+        bench::do_not_optimize(visit_prefetch(l.list, 4, 0));
+    });
+}
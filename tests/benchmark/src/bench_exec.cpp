@@ -0,0 +1,214 @@
+/**
+ * @file
+ * @brief Benchmarks for exec.h. Passes tokens around a ring of
+ * active objects run by an @ref ecu_exec with an increasing number
+ * of worker threads. Every hop is a cross-object post, so with more
+ * than one worker most posts cross threads. Throughput should scale
+ * with the number of cores until posting dominates the handler's work.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/exec.h"
+
+/* STDLib. */
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Number of events each mailbox can queue.
+ */
+static constexpr std::size_t EVENTS = 16;
+
+/**
+ * @brief Number of hashing rounds per event. Stands in for the
+ * work a real handler does.
+ */
+static constexpr unsigned ROUNDS = 32;
+
+/**
+ * @brief Deque capacity of each worker.
+ */
+static constexpr std::size_t DEQUE = 1024;
+
+/**
+ * @brief Token passed around the ring.
+ */
+struct bench_event
+{
+    /// @brief Base class. Must be first.
+    struct ecu_event base;
+
+    /// @brief Hops left before the token is retired.
+    std::uint32_t hops;
+};
+
+/**
+ * @brief Active object in the ring.
+ */
+struct bench_ao
+{
+    /// @brief State machine run by @ref ao.
+    struct ecu_fsm fsm;
+
+    /// @brief Active object.
+    struct ecu_exec_ao ao;
+
+    /// @brief Next object in the ring.
+    struct bench_ao *next;
+
+    /// @brief Work result so the handler cannot be optimized away.
+    std::uint64_t value;
+
+    /// @brief Mailbox memory.
+    std::uint8_t buffer[ECU_EXEC_BUFFER_SIZE(sizeof(struct bench_event), EVENTS)];
+};
+
+/**
+ * @brief Number of tokens that have run out of hops.
+ */
+static std::atomic<std::size_t> retired{0};
+
+/**
+ * @brief Number of tokens retired early because both the next
+ * mailbox and the object's own mailbox were full.
+ */
+static std::atomic<std::size_t> dropped{0};
+
+/**
+ * @brief Only state's handler. Does some work and forwards the
+ * token to the next object in the ring.
+ */
+static void handler(struct ecu_fsm *me, const void *event)
+{
+    struct bench_ao *t = ECU_FSM_GET_CONTEXT(me, struct bench_ao, fsm);
+    struct bench_event next = *static_cast<const struct bench_event *>(event);
+    std::uint64_t value = t->value + next.hops;
+
+    for (unsigned r = 0; r < ROUNDS; r++)
+    {
+        value ^= value >> 33U;
+        value *= 0xff51afd7ed558ccdULL;
+    }
+
+    t->value = value;
+
+    if (next.hops == 0)
+    {
+        retired.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        next.hops--;
+
+        /* Tokens can bunch up behind a slow object. Keep the token
+        if the next mailbox is full. */
+        if (!ecu_exec_ao_post(&t->next->ao, &next.base) && !ecu_exec_ao_post(&t->ao, &next.base))
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            retired.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+static const struct ecu_fsm_state STATE = ECU_FSM_STATE_CTOR(
+    ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler
+);
+
+/**
+ * @brief Passes one token per object @p hops times around a ring
+ * of @p n objects on @p threads workers.
+ */
+static void run(std::size_t n, std::uint32_t hops, std::size_t threads)
+{
+    std::vector<struct bench_ao> aos(n);
+    std::vector<struct ecu_exec_worker> workers(threads);
+    std::vector<struct ecu_exec_ao *> deques(threads * DEQUE);
+    struct ecu_exec exec;
+    char label[96];
+
+    auto setup = [&]() {
+        ecu_exec_ctor(&exec, workers.data(), threads, deques.data(), DEQUE, 8);
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            struct bench_event token;
+            ecu_event_ctor(&token.base, ECU_USER_EVENT_ID_BEGIN, sizeof(struct bench_event));
+            token.hops = hops;
+
+            aos[i].next = &aos[(i + 1) % n];
+            aos[i].value = i;
+            ecu_fsm_ctor(&aos[i].fsm, &STATE);
+            ecu_exec_ao_fsm_ctor(&aos[i].ao, &aos[i].fsm, &aos[i].buffer[0], sizeof(aos[i].buffer), sizeof(struct bench_event));
+            ecu_exec_add(&exec, &aos[i].ao);
+            (void)ecu_exec_ao_post(&aos[i].ao, &token.base);
+        }
+
+        retired.store(0);
+        dropped.store(0);
+    };
+
+    std::snprintf(&label[0], sizeof(label), "ecu_exec %zu threads aos=%zu n=%zu", threads, n, n * (hops + 1));
+    bench::measure(&label[0], n * (hops + 1), setup, [&]() {
+        std::vector<std::thread> pool;
+
+        for (std::size_t w = 0; w < threads; w++)
+        {
+            pool.emplace_back([&, w]() {
+                while (retired.load(std::memory_order_relaxed) < n)
+                {
+                    if (!ecu_exec_run_once(&exec, w))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (auto& t : pool)
+        {
+            t.join();
+        }
+
+        bench::do_not_optimize(aos[0].value);
+    });
+
+    if (dropped.load() > 0)
+    {
+        std::printf("  (%zu tokens dropped on full mailboxes)\n", dropped.load());
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(exec_scaling)
+{
+    std::size_t cores = std::max(1U, std::thread::hardware_concurrency());
+
+    for (std::size_t threads = 1; threads <= cores; threads *= 2)
+    {
+        run(4096U, 64U, threads);
+    }
+}
@@ -0,0 +1,279 @@
+/**
+ * @file
+ * @brief Benchmarks for fsmset.h. Broadcasts one event to many
+ * identical state machines, once as separate @ref ecu_fsm objects
+ * dispatched one by one and once as a single @ref ecu_fsmset with
+ * per-instance data stored in arrays. Then splits the set's broadcast
+ * across an increasing number of threads.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/fsm.h"
+#include "ecu/fsmset.h"
+
+/* STDLib. */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Number of state machines.
+ */
+static constexpr std::size_t COUNT = 16384;
+
+/**
+ * @brief Number of broadcasts per measurement.
+ */
+static constexpr std::size_t BROADCASTS = 64;
+
+/**
+ * @brief Readings above this move a device into the alarm state.
+ */
+static constexpr std::uint32_t THRESHOLD = 1000;
+
+/**
+ * @brief Event broadcast to every device.
+ */
+struct bench_event
+{
+    /// @brief Added to every device's reading.
+    std::uint32_t delta;
+};
+
+/*------------------------------------------------------------*/
+/*---------------------- SEPARATE FSMS -----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Device as its own state machine. Data of consecutive
+ * devices is interleaved with their fsm members.
+ */
+struct bench_device
+{
+    /// @brief State machine.
+    struct ecu_fsm fsm;
+
+    /// @brief Accumulated reading.
+    std::uint32_t reading;
+};
+
+static void fsm_alarm(struct ecu_fsm *me, const void *event);
+
+/**
+ * @brief Accumulates readings until the threshold is crossed.
+ */
+static void fsm_normal(struct ecu_fsm *me, const void *event);
+
+static const struct ecu_fsm_state FSM_NORMAL = ECU_FSM_STATE_CTOR(
+    ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &fsm_normal
+);
+
+static const struct ecu_fsm_state FSM_ALARM = ECU_FSM_STATE_CTOR(
+    ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &fsm_alarm
+);
+
+static void fsm_normal(struct ecu_fsm *me, const void *event)
+{
+    struct bench_device *d = ECU_FSM_GET_CONTEXT(me, struct bench_device, fsm);
+    d->reading += static_cast<const struct bench_event *>(event)->delta;
+
+    if (d->reading > THRESHOLD)
+    {
+        ecu_fsm_change_state(me, &FSM_ALARM);
+    }
+}
+
+/**
+ * @brief Resets the reading and returns to the normal state.
+ */
+static void fsm_alarm(struct ecu_fsm *me, const void *event)
+{
+    (void)event;
+    struct bench_device *d = ECU_FSM_GET_CONTEXT(me, struct bench_device, fsm);
+    d->reading = 0;
+    ecu_fsm_change_state(me, &FSM_NORMAL);
+}
+
+/*------------------------------------------------------------*/
+/*-------------------------- FSMSET --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Devices as one set. Readings are stored contiguously.
+ */
+struct bench_devices
+{
+    /// @brief Set of state machines.
+    struct ecu_fsmset set;
+
+    /// @brief Accumulated reading of every instance.
+    std::vector<std::uint32_t> readings;
+};
+
+/**
+ * @brief Indices of the set's states.
+ */
+enum bench_state : ecu_fsmset_state_t
+{
+    SET_NORMAL,
+    SET_ALARM,
+    SET_STATE_COUNT
+};
+
+/**
+ * @brief Accumulates readings until the threshold is crossed.
+ */
+static void set_normal(struct ecu_fsmset *me, const std::size_t *instances, std::size_t count, const void *event)
+{
+    struct bench_devices *d = ECU_FSMSET_GET_CONTEXT(me, struct bench_devices, set);
+    std::uint32_t delta = static_cast<const struct bench_event *>(event)->delta;
+    std::uint32_t *readings = d->readings.data();
+
+    for (std::size_t k = 0; k < count; k++)
+    {
+        std::size_t i = instances[k];
+        readings[i] += delta;
+
+        if (readings[i] > THRESHOLD)
+        {
+            ecu_fsmset_change_state(me, i, SET_ALARM);
+        }
+    }
+}
+
+/**
+ * @brief Resets readings and returns to the normal state.
+ */
+static void set_alarm(struct ecu_fsmset *me, const std::size_t *instances, std::size_t count, const void *event)
+{
+    (void)event;
+    struct bench_devices *d = ECU_FSMSET_GET_CONTEXT(me, struct bench_devices, set);
+    std::uint32_t *readings = d->readings.data();
+
+    for (std::size_t k = 0; k < count; k++)
+    {
+        readings[instances[k]] = 0;
+        ecu_fsmset_change_state(me, instances[k], SET_NORMAL);
+    }
+}
+
+static const struct ecu_fsmset_state SET_STATES[SET_STATE_COUNT] = {
+    ECU_FSMSET_STATE_CTOR(ECU_FSMSET_STATE_ENTRY_UNUSED, ECU_FSMSET_STATE_EXIT_UNUSED, &set_normal),
+    ECU_FSMSET_STATE_CTOR(ECU_FSMSET_STATE_ENTRY_UNUSED, ECU_FSMSET_STATE_EXIT_UNUSED, &set_alarm)
+};
+
+/**
+ * @brief Delta of broadcast @p b. Varies per device so they do
+ * not all alarm at the same time.
+ */
+static std::uint32_t delta(std::size_t b)
+{
+    return static_cast<std::uint32_t>(37U + ((b * 131U) % 97U));
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(fsmset_broadcast)
+{
+    std::vector<struct bench_device> devices(COUNT);
+    struct bench_devices set;
+    std::vector<std::uint8_t> buffer(ECU_FSMSET_BUFFER_SIZE(COUNT, SET_STATE_COUNT));
+
+    bench::measure("ecu_fsm_dispatch per instance", COUNT * BROADCASTS, [&]() {
+        for (std::size_t i = 0; i < COUNT; i++)
+        {
+            devices[i].reading = static_cast<std::uint32_t>(i % THRESHOLD);
+            ecu_fsm_ctor(&devices[i].fsm, &FSM_NORMAL);
+        }
+    }, [&]() {
+        for (std::size_t b = 0; b < BROADCASTS; b++)
+        {
+            const struct bench_event e = {delta(b)};
+
+            for (std::size_t i = 0; i < COUNT; i++)
+            {
+                ecu_fsm_dispatch(&devices[i].fsm, &e);
+            }
+        }
+
+        bench::do_not_optimize(devices[0].reading);
+    });
+
+    bench::measure("ecu_fsmset_broadcast", COUNT * BROADCASTS, [&]() {
+        set.readings.resize(COUNT);
+        for (std::size_t i = 0; i < COUNT; i++)
+        {
+            set.readings[i] = static_cast<std::uint32_t>(i % THRESHOLD);
+        }
+
+        ecu_fsmset_ctor(&set.set, &SET_STATES[0], SET_STATE_COUNT, SET_NORMAL, buffer.data(), buffer.size(), COUNT);
+    }, [&]() {
+        for (std::size_t b = 0; b < BROADCASTS; b++)
+        {
+            const struct bench_event e = {delta(b)};
+            ecu_fsmset_broadcast(&set.set, &e);
+        }
+
+        bench::do_not_optimize(set.readings[0]);
+    });
+}
+
+BENCHMARK(fsmset_scaling)
+{
+    std::size_t cores = std::max(1U, std::thread::hardware_concurrency());
+    struct bench_devices set;
+    std::vector<std::uint8_t> buffer(ECU_FSMSET_BUFFER_SIZE(COUNT, SET_STATE_COUNT));
+    char label[96];
+
+    for (std::size_t threads = 1; threads <= cores; threads *= 2)
+    {
+        std::snprintf(&label[0], sizeof(label), "ecu_fsmset_run %zu threads n=%zu", threads, COUNT * BROADCASTS);
+        bench::measure(&label[0], COUNT * BROADCASTS, [&]() {
+            set.readings.assign(COUNT, 0);
+            ecu_fsmset_ctor(&set.set, &SET_STATES[0], SET_STATE_COUNT, SET_NORMAL, buffer.data(), buffer.size(), COUNT);
+        }, [&]() {
+            for (std::size_t b = 0; b < BROADCASTS; b++)
+            {
+                const struct bench_event e = {delta(b)};
+                std::vector<std::thread> pool;
+                ecu_fsmset_group(&set.set);
+
+                /* Slice 0 runs on this thread. */
+                for (std::size_t t = 1; t < threads; t++)
+                {
+                    pool.emplace_back([&, t]() { ecu_fsmset_run(&set.set, &e, t, threads); });
+                }
+
+                ecu_fsmset_run(&set.set, &e, 0, threads);
+
+                for (auto& t : pool)
+                {
+                    t.join();
+                }
+            }
+
+            bench::do_not_optimize(set.readings[0]);
+        });
+    }
+}
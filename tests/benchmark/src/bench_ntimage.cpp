@@ -0,0 +1,148 @@
+/**
+ * @file
+ * @brief Benchmarks for ntimage.h. Compares loading a tree from an
+ * image against rebuilding the same tree node by node, with a plain
+ * copy of the image as a lower bound on the cost of touching every
+ * byte once.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ntimage.h"
+#include "ecu/ntnode.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Tree node with a small amount of user data that is
+ * saved as its payload.
+ */
+struct node
+{
+    /// @brief Tree linkage.
+    struct ecu_ntnode link;
+
+    /// @brief User data.
+    std::uint32_t value;
+};
+
+/**
+ * @brief Writes a node's value as its payload.
+ */
+static void save(const struct ecu_ntnode *me, void *payload, void *obj)
+{
+    (void)obj;
+    std::memcpy(payload, &ECU_NTNODE_GET_CONST_ENTRY(me, struct node, link)->value, sizeof(std::uint32_t));
+}
+
+/**
+ * @brief Restores a node's value from its payload.
+ */
+static void load(struct ecu_ntnode *me, const void *payload, void *obj)
+{
+    (void)obj;
+    std::memcpy(&ECU_NTNODE_GET_ENTRY(me, struct node, link)->value, payload, sizeof(std::uint32_t));
+}
+
+/**
+ * @brief Saves a random tree of @p n nodes, then measures three ways
+ * of producing it again. Rebuilding replays the parent of every node
+ * from a table, which is what an application without images would
+ * store instead.
+ */
+static void run(std::size_t n)
+{
+    std::deque<struct node> nodes(n);
+    std::vector<struct ecu_ntnode *> pointers;
+    std::vector<std::size_t> parents(n, 0);
+    std::vector<std::uint8_t> image;
+    std::vector<std::uint8_t> copy;
+    std::mt19937 rng{1234};
+    char label[96];
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        ecu_ntnode_ctor(&nodes[i].link, ECU_NTNODE_DESTROY_UNUSED, static_cast<ecu_object_id_t>(i));
+        nodes[i].value = static_cast<std::uint32_t>(i);
+        pointers.push_back(&nodes[i].link);
+
+        if (i > 0)
+        {
+            parents[i] = static_cast<std::size_t>(rng() % i);
+            ecu_ntnode_push_child_back(&nodes[parents[i]].link, &nodes[i].link);
+        }
+    }
+
+    image.resize(ecu_ntimage_size(&nodes[0].link, sizeof(std::uint32_t)));
+    copy.resize(image.size());
+    (void)ecu_ntimage_save(image.data(), image.size(), &nodes[0].link, sizeof(std::uint32_t), &save, ECU_NTIMAGE_OBJ_UNUSED);
+
+    std::snprintf(&label[0], sizeof(label), "memcpy image (%zu bytes) n=%zu", image.size(), n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        std::memcpy(copy.data(), image.data(), image.size());
+        bench::do_not_optimize(copy[copy.size() - 1]);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "rebuild via push_child_back n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            ecu_ntnode_ctor(&nodes[i].link, ECU_NTNODE_DESTROY_UNUSED, static_cast<ecu_object_id_t>(i));
+            nodes[i].value = static_cast<std::uint32_t>(i);
+
+            if (i > 0)
+            {
+                ecu_ntnode_push_child_back(&nodes[parents[i]].link, &nodes[i].link);
+            }
+        }
+
+        bench::do_not_optimize(nodes[0].link);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntimage_save n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        std::size_t bytes = ecu_ntimage_save(copy.data(), copy.size(), &nodes[0].link, sizeof(std::uint32_t), &save, ECU_NTIMAGE_OBJ_UNUSED);
+        bench::do_not_optimize(bytes);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntimage_load n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode *root = ecu_ntimage_load(image.data(), image.size(), pointers.data(), pointers.size(),
+                                                   ECU_NTNODE_DESTROY_UNUSED, &load, ECU_NTIMAGE_OBJ_UNUSED);
+        bench::do_not_optimize(root);
+    });
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(ntimage_load_vs_rebuild)
+{
+    for (std::size_t n : {1024U, 65536U})
+    {
+        run(n);
+    }
+}
@@ -0,0 +1,179 @@
+/**
+ * @file
+ * @brief Benchmarks for ntindex.h. Compares least common ancestor
+ * queries and preorder traversal on a live tree against a frozen
+ * @ref ecu_ntindex.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ntindex.h"
+#include "ecu/ntnode.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <utility>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Number of LCA queries per measurement.
+ */
+static constexpr std::size_t QUERIES = 4096;
+
+/**
+ * @brief Number of jump table rows. Covers trees up to 2^10 levels deep.
+ */
+static constexpr std::size_t JUMP_LEVELS = 10;
+
+/**
+ * @brief Builds a random tree of @p n nodes rooted at nodes[0]. About one
+ * in 32 nodes starts a new branch so the tree has long branches, which
+ * is where walking up one parent at a time is slowest.
+ */
+static void make_tree(std::deque<struct ecu_ntnode>& nodes, std::size_t n)
+{
+    std::mt19937 rng{1234};
+    nodes.resize(n);
+
+    for (auto& node : nodes)
+    {
+        ecu_ntnode_ctor(&node, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+    }
+
+    for (std::size_t i = 1; i < n; i++)
+    {
+        std::size_t parent = (rng() % 32 == 0) ? static_cast<std::size_t>(rng() % i) : (i - 1);
+        ecu_ntnode_push_child_back(&nodes[parent], &nodes[i]);
+    }
+}
+
+/**
+ * @brief Runs @ref QUERIES random LCA queries on a tree of @p n nodes.
+ */
+static void run(std::size_t n)
+{
+    std::deque<struct ecu_ntnode> nodes;
+    std::vector<struct ecu_ntnode *> index_nodes(n);
+    std::vector<std::size_t> ends(n);
+    std::vector<std::size_t> parents(n);
+    std::vector<std::size_t> depths(n);
+    std::vector<std::size_t> jumps(n * JUMP_LEVELS);
+    std::vector<std::pair<std::size_t, std::size_t>> queries(QUERIES);
+    std::mt19937 rng{5678};
+    struct ecu_ntindex index;
+    char label[96];
+
+    make_tree(nodes, n);
+    ecu_ntindex_ctor(&index, index_nodes.data(), ends.data(), parents.data(), depths.data(), n);
+    (void)ecu_ntindex_build(&index, &nodes[0], ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+    for (auto& q : queries)
+    {
+        q.first = static_cast<std::size_t>(rng() % n);
+        q.second = static_cast<std::size_t>(rng() % n);
+    }
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntnode_lca n=%zu", n);
+    bench::measure(&label[0], QUERIES, []() {}, [&]() {
+        for (const auto& q : queries)
+        {
+            bench::do_not_optimize(ecu_ntnode_lca(ecu_ntindex_node(&index, q.first), ecu_ntindex_node(&index, q.second)));
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntindex_lca n=%zu", n);
+    bench::measure(&label[0], QUERIES, []() {}, [&]() {
+        for (const auto& q : queries)
+        {
+            bench::do_not_optimize(ecu_ntindex_lca(&index, q.first, q.second));
+        }
+    });
+
+    ecu_ntindex_set_jump_table(&index, jumps.data(), JUMP_LEVELS);
+    std::snprintf(&label[0], sizeof(label), "ecu_ntindex_lca jump table n=%zu", n);
+    bench::measure(&label[0], QUERIES, []() {}, [&]() {
+        for (const auto& q : queries)
+        {
+            bench::do_not_optimize(ecu_ntindex_lca(&index, q.first, q.second));
+        }
+    });
+}
+
+/**
+ * @brief Walks a tree of @p n nodes in preorder, once through
+ * @ref ecu_ntnode links and once through an @ref ecu_ntindex. Caches
+ * are flushed before each run since snapshots are meant for trees
+ * that are walked occasionally, not kept hot.
+ */
+static void run_preorder(std::size_t n)
+{
+    std::deque<struct ecu_ntnode> nodes;
+    std::vector<struct ecu_ntnode *> index_nodes(n);
+    std::vector<std::size_t> ends(n);
+    std::vector<std::size_t> parents(n);
+    std::vector<std::size_t> depths(n);
+    struct ecu_ntindex index;
+    char label[96];
+
+    make_tree(nodes, n);
+    ecu_ntindex_ctor(&index, index_nodes.data(), ends.data(), parents.data(), depths.data(), n);
+    (void)ecu_ntindex_build(&index, &nodes[0], ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntnode preorder n=%zu", n);
+    bench::measure(&label[0], n, &bench::flush_cache, [&]() {
+        struct ecu_ntnode_preorder_iterator iterator;
+
+        ECU_NTNODE_PREORDER_FOR_EACH(node, &iterator, &nodes[0])
+        {
+            bench::do_not_optimize(node);
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntindex preorder n=%zu", n);
+    bench::measure(&label[0], n, &bench::flush_cache, [&]() {
+        struct ecu_ntindex_iterator iterator;
+
+        ECU_NTINDEX_PREORDER_FOR_EACH(i, &iterator, &index, 0)
+        {
+            bench::do_not_optimize(ecu_ntindex_node(&index, i));
+        }
+    });
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(ntnode_lca_vs_ntindex)
+{
+    for (std::size_t n : {64U, 1024U, 16384U})
+    {
+        run(n);
+    }
+}
+
+BENCHMARK(ntnode_preorder_vs_ntindex)
+{
+    for (std::size_t n : {64U, 1024U, 16384U})
+    {
+        run_preorder(n);
+    }
+}
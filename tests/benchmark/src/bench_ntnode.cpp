@@ -0,0 +1,426 @@
+/**
+ * @file
+ * @brief Benchmarks for ntnode.h. Compares the delimiter-based
+ * preorder and postorder iterators against their compact
+ * counterparts that end on the root instead, measures
+ * preorder searches that skip irrelevant subtrees, and compares
+ * child lookups by ID with and without a child index, compares
+ * moving children one at a time against splicing them all at once,
+ * and compares clearing a tree node by node against a fast clear.
+ * The index is only measured if ECU_NTNODE_INDEXED is defined. The
+ * fast clear is only measured if ECU_NTNODE_FAST_CLEAR is defined.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ntnode.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Object ID of nodes whose subtrees a search can skip.
+ */
+static constexpr ecu_object_id_t DISABLED = ECU_USER_OBJECT_ID_BEGIN;
+
+/**
+ * @brief Builds a random tree of @p n nodes rooted at nodes[0].
+ * Every node picks a uniformly random earlier node as its parent.
+ */
+static void make_tree(std::deque<struct ecu_ntnode>& nodes, std::size_t n)
+{
+    std::mt19937 rng{1234};
+    nodes.resize(n);
+
+    for (auto& node : nodes)
+    {
+        ecu_ntnode_ctor(&node, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+    }
+
+    for (std::size_t i = 1; i < n; i++)
+    {
+        ecu_ntnode_push_child_back(&nodes[static_cast<std::size_t>(rng() % i)], &nodes[i]);
+    }
+}
+
+/**
+ * @brief Builds a complete 4-ary tree of @p n nodes rooted at nodes[0],
+ * similar to a configuration tree of subsystems. The first three children
+ * of the root are given the @ref DISABLED ID, so three quarters of the
+ * tree can be ruled out by a search.
+ */
+static void make_config_tree(std::deque<struct ecu_ntnode>& nodes, std::size_t n)
+{
+    nodes.resize(n);
+    ecu_ntnode_ctor(&nodes[0], ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+
+    for (std::size_t i = 1; i < n; i++)
+    {
+        ecu_ntnode_ctor(&nodes[i], ECU_NTNODE_DESTROY_UNUSED, (i < 4) ? DISABLED : ECU_OBJECT_ID_UNUSED);
+        ecu_ntnode_push_child_back(&nodes[(i - 1) / 4], &nodes[i]);
+    }
+}
+
+/**
+ * @brief Prints the size of an iterator, which is what a
+ * FOR_EACH loop places on the stack.
+ */
+static void report_size(const char *name, std::size_t size)
+{
+    std::printf("  %-40s %10zu bytes\n", name, size);
+}
+
+/**
+ * @brief Walks a tree of @p n nodes in preorder and postorder with
+ * the existing and compact iterators.
+ */
+static void run(std::size_t n)
+{
+    std::deque<struct ecu_ntnode> nodes;
+    char label[96];
+
+    make_tree(nodes, n);
+
+    std::snprintf(&label[0], sizeof(label), "preorder n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode_preorder_iterator iterator;
+
+        ECU_NTNODE_PREORDER_FOR_EACH(node, &iterator, &nodes[0])
+        {
+            bench::do_not_optimize(node);
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "compact preorder n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode_compact_preorder_iterator iterator;
+
+        ECU_NTNODE_COMPACT_PREORDER_FOR_EACH(node, &iterator, &nodes[0])
+        {
+            bench::do_not_optimize(node);
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "postorder n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode_postorder_iterator iterator;
+
+        ECU_NTNODE_POSTORDER_FOR_EACH(node, &iterator, &nodes[0])
+        {
+            bench::do_not_optimize(node);
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "compact postorder n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode_compact_postorder_iterator iterator;
+
+        ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(node, &iterator, &nodes[0])
+        {
+            bench::do_not_optimize(node);
+        }
+    });
+}
+
+/**
+ * @brief Searches a configuration tree of @p n nodes in preorder. The
+ * pruned search skips the subtrees of disabled nodes instead of
+ * visiting every node in them. Time is reported per node in the tree.
+ */
+static void run_pruned(std::size_t n)
+{
+    std::deque<struct ecu_ntnode> nodes;
+    char label[96];
+
+    make_config_tree(nodes, n);
+
+    std::snprintf(&label[0], sizeof(label), "preorder search n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode_preorder_iterator iterator;
+
+        ECU_NTNODE_PREORDER_FOR_EACH(node, &iterator, &nodes[0])
+        {
+            if (ecu_ntnode_id(node) != DISABLED)
+            {
+                bench::do_not_optimize(node);
+            }
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "pruned preorder search n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode_pruned_preorder_iterator iterator;
+
+        ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(node, &iterator, &nodes[0])
+        {
+            if (ecu_ntnode_id(node) == DISABLED)
+            {
+                ecu_ntnode_pruned_preorder_iterator_skip(&iterator);
+            }
+            else
+            {
+                bench::do_not_optimize(node);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Looks up every child of a node with @p n children by ID.
+ * Time is reported per lookup.
+ */
+static void run_find(std::size_t n)
+{
+    std::deque<struct ecu_ntnode> nodes(n + 1);
+    char label[96];
+
+    ecu_ntnode_ctor(&nodes[0], ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+
+    for (std::size_t i = 1; i <= n; i++)
+    {
+        ecu_ntnode_ctor(&nodes[i], ECU_NTNODE_DESTROY_UNUSED, static_cast<ecu_object_id_t>(i));
+        ecu_ntnode_push_child_back(&nodes[0], &nodes[i]);
+    }
+
+    std::snprintf(&label[0], sizeof(label), "find child scan n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 1; i <= n; i++)
+        {
+            bench::do_not_optimize(ecu_ntnode_find_child_by_id(&nodes[0], static_cast<ecu_object_id_t>(i)));
+        }
+    });
+
+#if defined(ECU_NTNODE_INDEXED)
+    std::size_t capacity = 1;
+    struct ecu_ntnode_index index;
+
+    while (capacity < (2 * n))
+    {
+        capacity *= 2;
+    }
+
+    std::vector<struct ecu_ntnode *> slots(capacity);
+    ecu_ntnode_index_ctor(&index, slots.data(), capacity);
+    ecu_ntnode_attach_index(&nodes[0], &index);
+
+    std::snprintf(&label[0], sizeof(label), "find child index n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 1; i <= n; i++)
+        {
+            bench::do_not_optimize(ecu_ntnode_find_child_by_id(&nodes[0], static_cast<ecu_object_id_t>(i)));
+        }
+    });
+
+    ecu_ntnode_detach_index(&nodes[0]);
+#endif
+}
+
+/**
+ * @brief Moves @p n children, each with a small subtree, between two
+ * nodes deep in a tree. Children are moved one at a time via remove
+ * and push, one at a time via move, then all at once via
+ * @ref ecu_ntnode_move_children(). Every run moves the children back
+ * to the other node so runs are identical. Time is reported per child.
+ */
+static void run_move(std::size_t n)
+{
+    static constexpr std::size_t DEPTH = 32;
+    std::deque<struct ecu_ntnode> nodes(DEPTH + 2 + (3 * n));
+    struct ecu_ntnode *a = &nodes[DEPTH];
+    struct ecu_ntnode *b = &nodes[DEPTH + 1];
+    char label[96];
+
+    for (auto& node : nodes)
+    {
+        ecu_ntnode_ctor(&node, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+    }
+
+    for (std::size_t i = 1; i < DEPTH; i++)
+    {
+        ecu_ntnode_push_child_back(&nodes[i - 1], &nodes[i]);
+    }
+
+    ecu_ntnode_push_child_back(&nodes[DEPTH - 1], a);
+    ecu_ntnode_push_child_back(&nodes[DEPTH - 1], b);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        struct ecu_ntnode *child = &nodes[DEPTH + 2 + (3 * i)];
+        ecu_ntnode_push_child_back(a, child);
+        ecu_ntnode_push_child_back(child, &nodes[DEPTH + 3 + (3 * i)]);
+        ecu_ntnode_push_child_back(child, &nodes[DEPTH + 4 + (3 * i)]);
+    }
+
+    std::snprintf(&label[0], sizeof(label), "remove + push_child_back n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode *from = ecu_ntnode_is_leaf(a) ? b : a;
+        struct ecu_ntnode *to = (from == a) ? b : a;
+        struct ecu_ntnode_child_iterator iter;
+
+        ECU_NTNODE_CHILD_FOR_EACH(c, &iter, from)
+        {
+            ecu_ntnode_remove(c);
+            ecu_ntnode_push_child_back(to, c);
+        }
+
+        bench::do_not_optimize(to);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntnode_move_child_back n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode *from = ecu_ntnode_is_leaf(a) ? b : a;
+        struct ecu_ntnode *to = (from == a) ? b : a;
+        struct ecu_ntnode_child_iterator iter;
+
+        ECU_NTNODE_CHILD_FOR_EACH(c, &iter, from)
+        {
+            ecu_ntnode_move_child_back(to, c);
+        }
+
+        bench::do_not_optimize(to);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntnode_move_children n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode *from = ecu_ntnode_is_leaf(a) ? b : a;
+        struct ecu_ntnode *to = (from == a) ? b : a;
+        ecu_ntnode_move_children(to, from);
+        bench::do_not_optimize(to);
+    });
+}
+
+/**
+ * @brief Tears down a random tree of @p n nodes, as a scratch tree
+ * rebuilt every cycle would be. The tree is rebuilt from the same
+ * nodes before every run without reconstructing them. Clearing is
+ * timed on its own, then together with the rebuild since a fast
+ * clear moves part of the cost into the next rebuild. Time is
+ * reported per node.
+ */
+static void run_clear(std::size_t n)
+{
+    std::deque<struct ecu_ntnode> nodes;
+    std::vector<std::size_t> parents(n);
+    std::mt19937 rng{1234};
+    char label[96];
+
+    make_tree(nodes, n);
+
+    for (std::size_t i = 1; i < n; i++)
+    {
+        parents[i] = static_cast<std::size_t>(rng() % i);
+    }
+
+    auto rebuild = [&]() {
+        for (std::size_t i = 1; i < n; i++)
+        {
+            ecu_ntnode_push_child_back(&nodes[parents[i]], &nodes[i]);
+        }
+    };
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntnode_clear n=%zu", n);
+    bench::measure(&label[0], n, [&]() {
+        ecu_ntnode_clear(&nodes[0]);
+        rebuild();
+    }, [&]() {
+        ecu_ntnode_clear(&nodes[0]);
+        bench::do_not_optimize(nodes[0]);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "rebuild + ecu_ntnode_clear n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        ecu_ntnode_clear(&nodes[0]);
+        rebuild();
+        bench::do_not_optimize(nodes[0]);
+    });
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+    struct ecu_ntnode_epoch epoch;
+    ecu_ntnode_epoch_ctor(&epoch);
+    ecu_ntnode_attach_epoch(&nodes[0], &epoch);
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntnode_fast_clear n=%zu", n);
+    bench::measure(&label[0], n, [&]() {
+        ecu_ntnode_fast_clear(&nodes[0]);
+        rebuild();
+    }, [&]() {
+        ecu_ntnode_fast_clear(&nodes[0]);
+        bench::do_not_optimize(nodes[0]);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "rebuild + ecu_ntnode_fast_clear n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        ecu_ntnode_fast_clear(&nodes[0]);
+        rebuild();
+        bench::do_not_optimize(nodes[0]);
+    });
+#endif
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(ntnode_iterator_vs_compact_iterator)
+{
+    report_size("sizeof preorder iterator", sizeof(struct ecu_ntnode_preorder_iterator));
+    report_size("sizeof compact preorder iterator", sizeof(struct ecu_ntnode_compact_preorder_iterator));
+    report_size("sizeof postorder iterator", sizeof(struct ecu_ntnode_postorder_iterator));
+    report_size("sizeof compact postorder iterator", sizeof(struct ecu_ntnode_compact_postorder_iterator));
+
+    for (std::size_t n : {64U, 1024U, 16384U})
+    {
+        run(n);
+    }
+}
+
+BENCHMARK(ntnode_preorder_vs_pruned_preorder)
+{
+    for (std::size_t n : {64U, 1024U, 16384U})
+    {
+        run_pruned(n);
+    }
+}
+
+BENCHMARK(ntnode_find_child_scan_vs_index)
+{
+    for (std::size_t n : {8U, 64U, 1024U})
+    {
+        run_find(n);
+    }
+}
+
+BENCHMARK(ntnode_move_one_at_a_time_vs_move_children)
+{
+    for (std::size_t n : {64U, 4096U})
+    {
+        run_move(n);
+    }
+}
+
+BENCHMARK(ntnode_clear_vs_fast_clear)
+{
+    for (std::size_t n : {1024U, 131072U})
+    {
+        run_clear(n);
+    }
+}
@@ -0,0 +1,143 @@
+/**
+ * @file
+ * @brief Benchmarks for ntrank.h. Compares positional access to
+ * the children of a node by walking its sibling list against an
+ * @ref ecu_ntrank of the same node.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ntnode.h"
+#include "ecu/ntrank.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Accesses children of a node with @p n children by position.
+ * Children are looked up by random index, each child's index is looked
+ * up, and a spare node is inserted at a random index then removed again.
+ * Time is reported per operation.
+ */
+static void run(std::size_t n)
+{
+    std::deque<struct ecu_ntnode> nodes(n + 2);
+    std::vector<std::size_t> indexes(n);
+    std::vector<struct ecu_ntrank_slot> slots;
+    struct ecu_ntrank rank;
+    std::mt19937 rng{1234};
+    struct ecu_ntnode *parent = &nodes[0];
+    struct ecu_ntnode *spare = &nodes[n + 1];
+    std::size_t capacity = 1;
+    char label[96];
+
+    for (auto& node : nodes)
+    {
+        ecu_ntnode_ctor(&node, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+    }
+
+    for (std::size_t i = 1; i <= n; i++)
+    {
+        ecu_ntnode_push_child_back(parent, &nodes[i]);
+    }
+
+    for (auto& index : indexes)
+    {
+        index = static_cast<std::size_t>(rng() % n);
+    }
+
+    /* Twice the number of children, rounded up to a power of two. */
+    while (capacity < (2 * n))
+    {
+        capacity *= 2;
+    }
+
+    slots.resize(capacity);
+    ecu_ntrank_ctor(&rank, slots.data(), capacity);
+    ecu_ntrank_build(&rank, parent);
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntnode_nth_child n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t index : indexes)
+        {
+            bench::do_not_optimize(ecu_ntnode_nth_child(parent, index));
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntrank_nth_child n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t index : indexes)
+        {
+            bench::do_not_optimize(ecu_ntrank_nth_child(&rank, index));
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntnode_index_of n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 1; i <= n; i++)
+        {
+            bench::do_not_optimize(ecu_ntnode_index_of(&nodes[i]));
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntrank_index_of n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 1; i <= n; i++)
+        {
+            bench::do_not_optimize(ecu_ntrank_index_of(&rank, &nodes[i]));
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntnode_insert_child_at + remove n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t index : indexes)
+        {
+            ecu_ntnode_insert_child_at(parent, spare, index);
+            ecu_ntnode_remove(spare);
+        }
+
+        bench::do_not_optimize(parent);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntrank_insert_child_at + remove n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t index : indexes)
+        {
+            ecu_ntrank_insert_child_at(&rank, spare, index);
+            ecu_ntrank_remove(&rank, spare);
+        }
+
+        bench::do_not_optimize(parent);
+    });
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(ntnode_positional_access_vs_ntrank)
+{
+    for (std::size_t n : {64U, 1024U, 16384U})
+    {
+        run(n);
+    }
+}
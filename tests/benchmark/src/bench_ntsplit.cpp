@@ -0,0 +1,182 @@
+/**
+ * @file
+ * @brief Benchmarks for ntsplit.h. Compares a bottom-up aggregation
+ * over a large tree on one thread against the same aggregation split
+ * into tasks and run on a pool of threads. Speedup depends on the
+ * number of cores on the host.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ntnode.h"
+#include "ecu/ntsplit.h"
+
+/* STDLib. */
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <thread>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Tree node that stores the result of the aggregation.
+ */
+struct node
+{
+    /// @brief Tree linkage.
+    struct ecu_ntnode link;
+
+    /// @brief Aggregated value of this node's subtree.
+    std::uint64_t value;
+};
+
+/**
+ * @brief Number of mixing rounds done per node, standing in for
+ * a CPU-heavy per-node computation.
+ */
+static constexpr unsigned ROUNDS = 64;
+
+/**
+ * @brief Maximum number of nodes per task. Small enough that there
+ * are many more tasks than threads so the load stays balanced.
+ */
+static constexpr std::size_t GRAIN = 1024;
+
+/**
+ * @brief Builds a random tree of @p n nodes rooted at nodes[0].
+ * Every node picks a uniformly random earlier node as its parent.
+ */
+static void make_tree(std::deque<struct node>& nodes, std::size_t n)
+{
+    std::mt19937 rng{1234};
+    nodes.resize(n);
+
+    for (auto& node : nodes)
+    {
+        ecu_ntnode_ctor(&node.link, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+    }
+
+    for (std::size_t i = 1; i < n; i++)
+    {
+        ecu_ntnode_push_child_back(&nodes[static_cast<std::size_t>(rng() % i)].link, &nodes[i].link);
+    }
+}
+
+/**
+ * @brief Combines a node's children in order, then does @ref ROUNDS
+ * rounds of integer mixing on the result.
+ */
+static void aggregate(struct ecu_ntnode *me, void *obj)
+{
+    (void)obj;
+    struct node *n = ECU_NTNODE_GET_ENTRY(me, struct node, link);
+    struct ecu_ntnode_child_iterator iterator;
+    std::uint64_t value = reinterpret_cast<std::uintptr_t>(me);
+
+    ECU_NTNODE_CHILD_FOR_EACH(c, &iterator, me)
+    {
+        value = (value * 31U) + ECU_NTNODE_GET_ENTRY(c, struct node, link)->value;
+    }
+
+    for (unsigned r = 0; r < ROUNDS; r++)
+    {
+        value ^= value >> 33U;
+        value *= 0xff51afd7ed558ccdULL;
+    }
+
+    n->value = value;
+}
+
+/**
+ * @brief Aggregates a tree of @p n nodes in postorder on the calling
+ * thread, then split into tasks that worker threads pull from a shared
+ * counter. The tree does not change between runs so the split is built
+ * once and reused, the same way an application would reuse it for
+ * repeated aggregations. Building the split is measured separately.
+ */
+static void run(std::size_t n, std::size_t threads)
+{
+    std::deque<struct node> nodes;
+    std::vector<struct ecu_ntsplit_task> tasks(n / GRAIN * 4);
+    struct ecu_ntsplit split;
+    std::size_t count = 0;
+    char label[96];
+
+    make_tree(nodes, n);
+    ecu_ntsplit_ctor(&split, tasks.data(), tasks.size());
+
+    std::snprintf(&label[0], sizeof(label), "sequential postorder n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        struct ecu_ntnode_compact_postorder_iterator iterator;
+
+        ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(node, &iterator, &nodes[0].link)
+        {
+            aggregate(node, ECU_NTSPLIT_OBJ_UNUSED);
+        }
+
+        bench::do_not_optimize(nodes[0].value);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_ntsplit_build n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        count = ecu_ntsplit_build(&split, &nodes[0].link, GRAIN);
+        bench::do_not_optimize(count);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ntsplit %zu threads %zu tasks n=%zu", threads, count, n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        std::atomic<std::size_t> next{0};
+        std::vector<std::thread> workers;
+
+        for (std::size_t t = 0; t < threads; t++)
+        {
+            workers.emplace_back([&]() {
+                for (std::size_t i = next++; i < count; i = next++)
+                {
+                    ecu_ntsplit_run(&split, i, &aggregate, ECU_NTSPLIT_OBJ_UNUSED);
+                }
+            });
+        }
+
+        for (auto& w : workers)
+        {
+            w.join();
+        }
+
+        ecu_ntsplit_finish(&split, &aggregate, ECU_NTSPLIT_OBJ_UNUSED);
+        bench::do_not_optimize(nodes[0].value);
+    });
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(ntnode_sequential_vs_ntsplit)
+{
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+
+    for (std::size_t n : {16384U, 262144U})
+    {
+        run(n, threads);
+    }
+}
@@ -0,0 +1,166 @@
+/**
+ * @file
+ * @brief Benchmarks for pool.h. Compares allocating and freeing
+ * ntnode-sized blocks from a pool against malloc() and free().
+ * The lock-free pool is measured uncontended and with every
+ * hardware thread allocating from it at once.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ntnode.h"
+#include "ecu/pool.h"
+
+/* STDLib. */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Tree node with a small amount of user data. Blocks
+ * are sized for this type.
+ */
+struct node
+{
+    /// @brief Tree linkage.
+    struct ecu_ntnode link;
+
+    /// @brief User data.
+    std::uint32_t value;
+};
+
+/**
+ * @brief Allocates @p n blocks and then frees all of them, which
+ * is the pattern of building and destroying a tree. Every block
+ * is written once so allocators that hand out cold memory pay for it.
+ */
+static void run(std::size_t n)
+{
+    std::vector<std::uint8_t> buffer(ECU_POOL_BUFFER_SIZE(sizeof(struct node), n));
+    std::vector<std::uint8_t> lfbuffer(ECU_LFPOOL_BUFFER_SIZE(sizeof(struct node), n));
+    std::vector<void *> blocks(n, nullptr);
+    struct ecu_pool pool;
+    struct ecu_lfpool lfpool;
+    char label[96];
+
+    ecu_pool_ctor(&pool, buffer.data(), buffer.size(), sizeof(struct node), ECU_POOL_STATS_UNUSED);
+    ecu_lfpool_ctor(&lfpool, lfbuffer.data(), lfbuffer.size(), sizeof(struct node), ECU_POOL_STATS_UNUSED);
+
+    std::snprintf(&label[0], sizeof(label), "malloc/free n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            blocks[i] = std::malloc(sizeof(struct node));
+            static_cast<struct node *>(blocks[i])->value = static_cast<std::uint32_t>(i);
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            std::free(blocks[i]);
+        }
+
+        bench::do_not_optimize(blocks[0]);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_pool_alloc/free n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            blocks[i] = ecu_pool_alloc(&pool);
+            static_cast<struct node *>(blocks[i])->value = static_cast<std::uint32_t>(i);
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            ecu_pool_free(&pool, blocks[i]);
+        }
+
+        bench::do_not_optimize(blocks[0]);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_lfpool_alloc/free n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            blocks[i] = ecu_lfpool_alloc(&lfpool);
+            static_cast<struct node *>(blocks[i])->value = static_cast<std::uint32_t>(i);
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            ecu_lfpool_free(&lfpool, blocks[i]);
+        }
+
+        bench::do_not_optimize(blocks[0]);
+    });
+}
+
+/**
+ * @brief Every thread repeatedly allocates and frees one block of
+ * a shared lock-free pool, which is the worst case for contention.
+ */
+static void run_contended(std::size_t n, std::size_t threads)
+{
+    std::vector<std::uint8_t> lfbuffer(ECU_LFPOOL_BUFFER_SIZE(sizeof(struct node), threads));
+    struct ecu_lfpool lfpool;
+    char label[96];
+
+    ecu_lfpool_ctor(&lfpool, lfbuffer.data(), lfbuffer.size(), sizeof(struct node), ECU_POOL_STATS_UNUSED);
+
+    std::snprintf(&label[0], sizeof(label), "ecu_lfpool %zu threads n=%zu", threads, n);
+    bench::measure(&label[0], n * threads, []() {}, [&]() {
+        std::vector<std::thread> workers;
+
+        for (std::size_t t = 0; t < threads; t++)
+        {
+            workers.emplace_back([&]() {
+                for (std::size_t i = 0; i < n; i++)
+                {
+                    void *block = ecu_lfpool_alloc(&lfpool);
+                    bench::do_not_optimize(block);
+                    ecu_lfpool_free(&lfpool, block);
+                }
+            });
+        }
+
+        for (auto& w : workers)
+        {
+            w.join();
+        }
+    });
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(pool_alloc_free)
+{
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+
+    for (std::size_t n : {1024U, 65536U})
+    {
+        run(n);
+    }
+
+    run_contended(65536U, threads);
+}
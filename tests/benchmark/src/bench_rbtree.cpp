@@ -0,0 +1,176 @@
+/**
+ * @file
+ * @brief Benchmarks for rbtree.h. Compares maintaining a sorted
+ * set of deadlines in an @ref ecu_rbtree against a sorted
+ * @ref ecu_dlist, which is how timer indexes are kept today.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/dlist.h"
+#include "ecu/rbtree.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Deadline that can be stored in either container.
+ */
+struct deadline
+{
+    struct ecu_dnode dnode;
+    struct ecu_rbnode rbnode;
+    std::uint32_t expires;
+};
+
+/**
+ * @brief Sorted insert condition for @ref ecu_dlist_insert_before().
+ * Equal deadlines go after existing ones, matching @ref ecu_rbtree.
+ */
+static bool dlist_expires_first(const struct ecu_dnode *node, const struct ecu_dnode *position, void *data)
+{
+    (void)data;
+    return (ECU_DNODE_GET_CONST_ENTRY(node, struct deadline, dnode)->expires <
+            ECU_DNODE_GET_CONST_ENTRY(position, struct deadline, dnode)->expires);
+}
+
+/**
+ * @brief Sorting condition for @ref ecu_rbtree.
+ */
+static bool rbtree_expires_first(const struct ecu_rbnode *lhs, const struct ecu_rbnode *rhs, void *data)
+{
+    (void)data;
+    return (ECU_RBNODE_GET_CONST_ENTRY(lhs, struct deadline, rbnode)->expires <
+            ECU_RBNODE_GET_CONST_ENTRY(rhs, struct deadline, rbnode)->expires);
+}
+
+/**
+ * @brief Returns @p n deadlines with random expiry times.
+ */
+static std::vector<deadline> make_deadlines(std::size_t n)
+{
+    std::vector<deadline> deadlines(n);
+    std::mt19937 rng{1234};
+
+    for (auto& d : deadlines)
+    {
+        d.expires = static_cast<std::uint32_t>(rng());
+    }
+
+    return deadlines;
+}
+
+/**
+ * @brief Inserts @p n random deadlines into a sorted @ref ecu_dlist
+ * then removes them all in expiry order.
+ */
+static void run_dlist(std::size_t n)
+{
+    std::vector<deadline> deadlines = make_deadlines(n);
+    struct ecu_dlist list;
+    char label[96];
+
+    auto setup = [&]() {
+        ecu_dlist_ctor(&list);
+
+        for (auto& d : deadlines)
+        {
+            ecu_dnode_ctor(&d.dnode, ECU_DNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+        }
+    };
+
+    std::snprintf(&label[0], sizeof(label), "ecu_dlist insert n=%zu", n);
+    bench::measure(&label[0], n, setup, [&]() {
+        for (auto& d : deadlines)
+        {
+            ecu_dlist_insert_before(&list, &d.dnode, &dlist_expires_first, ECU_DNODE_OBJ_UNUSED);
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_dlist insert + pop n=%zu", n);
+    bench::measure(&label[0], n, setup, [&]() {
+        for (auto& d : deadlines)
+        {
+            ecu_dlist_insert_before(&list, &d.dnode, &dlist_expires_first, ECU_DNODE_OBJ_UNUSED);
+        }
+
+        for (struct ecu_dnode *front = ecu_dlist_front(&list); front; front = ecu_dlist_front(&list))
+        {
+            ecu_dnode_remove(front);
+            bench::do_not_optimize(front);
+        }
+    });
+}
+
+/**
+ * @brief Inserts @p n random deadlines into an @ref ecu_rbtree
+ * then removes them all in expiry order.
+ */
+static void run_rbtree(std::size_t n)
+{
+    std::vector<deadline> deadlines = make_deadlines(n);
+    struct ecu_rbtree tree;
+    char label[96];
+
+    auto setup = [&]() {
+        ecu_rbtree_ctor(&tree, &rbtree_expires_first, ECU_RBNODE_OBJ_UNUSED);
+
+        for (auto& d : deadlines)
+        {
+            ecu_rbnode_ctor(&d.rbnode, ECU_RBNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+        }
+    };
+
+    std::snprintf(&label[0], sizeof(label), "ecu_rbtree insert n=%zu", n);
+    bench::measure(&label[0], n, setup, [&]() {
+        for (auto& d : deadlines)
+        {
+            ecu_rbtree_insert(&tree, &d.rbnode);
+        }
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_rbtree insert + pop n=%zu", n);
+    bench::measure(&label[0], n, setup, [&]() {
+        for (auto& d : deadlines)
+        {
+            ecu_rbtree_insert(&tree, &d.rbnode);
+        }
+
+        for (struct ecu_rbnode *min = ecu_rbtree_pop_min(&tree); min; min = ecu_rbtree_pop_min(&tree))
+        {
+            bench::do_not_optimize(min);
+        }
+    });
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(rbtree_vs_sorted_dlist)
+{
+    for (std::size_t n : {16U, 256U, 4096U})
+    {
+        run_dlist(n);
+        run_rbtree(n);
+    }
+}
@@ -0,0 +1,169 @@
+/**
+ * @file
+ * @brief Benchmarks for sched.h. Compares finding work with a
+ * round-robin poll of every active object's queue against the
+ * ready bitmap of an @ref ecu_sched when only a few of many
+ * active objects have events at a time.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/sched.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Event with a small payload.
+ */
+struct bench_event
+{
+    /// @brief Base class. Must be first.
+    struct ecu_event base;
+
+    /// @brief Summed by the handler.
+    std::uint32_t value;
+};
+
+/**
+ * @brief Number of events each active object can queue.
+ */
+static constexpr std::size_t EVENTS = 4;
+
+/**
+ * @brief Active object with its own queue memory.
+ */
+struct bench_ao
+{
+    /// @brief State machine run by @ref ao.
+    struct ecu_fsm fsm;
+
+    /// @brief Active object.
+    struct ecu_ao ao;
+
+    /// @brief Queue memory.
+    std::uint8_t buffer[ECU_AO_BUFFER_SIZE(sizeof(struct bench_event), EVENTS)];
+};
+
+/**
+ * @brief Sum of every dispatched payload so the handler cannot
+ * be optimized away.
+ */
+static std::uint32_t sum = 0;
+
+/**
+ * @brief Only state's handler.
+ */
+static void handler(struct ecu_fsm *me, const void *event)
+{
+    (void)me;
+    sum += static_cast<const struct bench_event *>(event)->value;
+}
+
+static const struct ecu_fsm_state STATE = ECU_FSM_STATE_CTOR(
+    ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler
+);
+
+/**
+ * @brief Delivers @p n events to @ref ECU_SCHED_PRIORITIES active
+ * objects, @p burst randomly chosen ones at a time.
+ */
+static void run(std::size_t n, std::size_t burst)
+{
+    const std::size_t count = ECU_SCHED_PRIORITIES;
+    std::vector<struct bench_ao> aos(count);
+    std::vector<std::size_t> targets(n);
+    std::mt19937 rng(1234U);
+    struct bench_event event;
+    struct ecu_sched sched;
+    char label[96];
+
+    ecu_event_ctor(&event.base, ECU_USER_EVENT_ID_BEGIN, sizeof(struct bench_event));
+    ecu_sched_ctor(&sched, ECU_SCHED_IDLE_UNUSED, ECU_SCHED_OBJ_UNUSED);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        ecu_fsm_ctor(&aos[i].fsm, &STATE);
+        ecu_ao_fsm_ctor(&aos[i].ao, &aos[i].fsm, &aos[i].buffer[0], sizeof(aos[i].buffer), sizeof(struct bench_event));
+    }
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        targets[i] = static_cast<std::size_t>(rng() % count);
+    }
+
+    std::snprintf(&label[0], sizeof(label), "round-robin ecu_ao_run_once aos=%zu burst=%zu n=%zu", count, burst, n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 0; i < n; i += burst)
+        {
+            for (std::size_t j = 0; j < burst; j++)
+            {
+                event.value = static_cast<std::uint32_t>(i + j);
+                (void)ecu_ao_post(&aos[targets[i + j]].ao, &event.base);
+            }
+
+            bool busy = true;
+            while (busy)
+            {
+                busy = false;
+                for (std::size_t k = count; k > 0; k--)
+                {
+                    busy = ecu_ao_run_once(&aos[k - 1].ao) || busy;
+                }
+            }
+        }
+
+        bench::do_not_optimize(sum);
+    });
+
+    /* Sched installs post hooks, so it is only set up after round-robin is measured. */
+    for (std::size_t i = 0; i < count; i++)
+    {
+        ecu_sched_add(&sched, &aos[i].ao, i);
+    }
+
+    std::snprintf(&label[0], sizeof(label), "ecu_sched_run_until_idle aos=%zu burst=%zu n=%zu", count, burst, n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (std::size_t i = 0; i < n; i += burst)
+        {
+            for (std::size_t j = 0; j < burst; j++)
+            {
+                event.value = static_cast<std::uint32_t>(i + j);
+                (void)ecu_ao_post(&aos[targets[i + j]].ao, &event.base);
+            }
+
+            (void)ecu_sched_run_until_idle(&sched);
+        }
+
+        bench::do_not_optimize(sum);
+    });
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(sched_ready_set)
+{
+    run(65536U, 1U);
+    run(65536U, 4U);
+}
@@ -0,0 +1,168 @@
+/**
+ * @file
+ * @brief Benchmarks for tfsm.h. Compares dispatching through a
+ * state x event table against the same machine written as an
+ * @ref ecu_fsm whose state handlers switch on the event.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/fsm.h"
+#include "ecu/tfsm.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Number of states and events in both machines. Odd
+ * events move state S to (S + event) % STATES. Even events
+ * only run an action.
+ */
+static constexpr int STATES = 8;
+static constexpr int EVENTS = 8;
+
+/**
+ * @brief Incremented by every action so neither machine can be
+ * optimized away.
+ */
+static std::uint32_t actions = 0;
+
+/**
+ * @brief Action shared by both machines.
+ */
+static void count(struct ecu_tfsm *me, const void *data)
+{
+    (void)me;
+    (void)data;
+    actions++;
+}
+
+/**
+ * @brief One row of the table. Same transitions as @ref handler().
+ */
+#define ROW(X, s_)                                                                           \
+    X(T##s_, ECU_TFSM_ENTRY_UNUSED, ECU_TFSM_EXIT_UNUSED,                                    \
+      ECU_TFSM_ACTION(&count), ECU_TFSM_TRANSITION(&count, ((s_) + 1) % STATES),             \
+      ECU_TFSM_ACTION(&count), ECU_TFSM_TRANSITION(&count, ((s_) + 3) % STATES),             \
+      ECU_TFSM_ACTION(&count), ECU_TFSM_TRANSITION(&count, ((s_) + 5) % STATES),             \
+      ECU_TFSM_ACTION(&count), ECU_TFSM_TRANSITION(&count, ((s_) + 7) % STATES))
+
+/**
+ * @brief Table-driven machine.
+ */
+#define BENCH_TABLE(X) \
+    ROW(X, 0) ROW(X, 1) ROW(X, 2) ROW(X, 3) ROW(X, 4) ROW(X, 5) ROW(X, 6) ROW(X, 7)
+
+enum bench_state
+{
+    BENCH_TABLE(ECU_TFSM_X_STATE_ID)
+    BENCH_STATE_COUNT
+};
+
+ECU_TFSM_TABLE_DEFINE(BENCH, BENCH_TABLE, EVENTS);
+
+/**
+ * @brief States of the switch-based machine.
+ */
+extern const struct ecu_fsm_state FSM_STATES[STATES];
+
+/**
+ * @brief Handler of state @p S, written the usual way with
+ * a switch on the event.
+ */
+template<int S>
+static void handler(struct ecu_fsm *me, const void *event)
+{
+    switch (*static_cast<const int *>(event))
+    {
+        case 0: actions++; break;
+        case 1: actions++; ecu_fsm_change_state(me, &FSM_STATES[(S + 1) % STATES]); break;
+        case 2: actions++; break;
+        case 3: actions++; ecu_fsm_change_state(me, &FSM_STATES[(S + 3) % STATES]); break;
+        case 4: actions++; break;
+        case 5: actions++; ecu_fsm_change_state(me, &FSM_STATES[(S + 5) % STATES]); break;
+        case 6: actions++; break;
+        case 7: actions++; ecu_fsm_change_state(me, &FSM_STATES[(S + 7) % STATES]); break;
+        default: break;
+    }
+}
+
+const struct ecu_fsm_state FSM_STATES[STATES] = {
+    ECU_FSM_STATE_CTOR(ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler<0>),
+    ECU_FSM_STATE_CTOR(ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler<1>),
+    ECU_FSM_STATE_CTOR(ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler<2>),
+    ECU_FSM_STATE_CTOR(ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler<3>),
+    ECU_FSM_STATE_CTOR(ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler<4>),
+    ECU_FSM_STATE_CTOR(ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler<5>),
+    ECU_FSM_STATE_CTOR(ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler<6>),
+    ECU_FSM_STATE_CTOR(ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &handler<7>)
+};
+
+/**
+ * @brief Dispatches the same random stream of @p n events to
+ * both machines.
+ */
+static void run(std::size_t n)
+{
+    std::vector<int> events(n, 0);
+    std::mt19937 rng{1234};
+    struct ecu_fsm fsm;
+    struct ecu_tfsm tfsm;
+    char label[96];
+
+    for (auto& e : events)
+    {
+        e = static_cast<int>(rng() % EVENTS);
+    }
+
+    ecu_fsm_ctor(&fsm, &FSM_STATES[0]);
+    ecu_tfsm_ctor(&tfsm, &BENCH, T0);
+
+    std::snprintf(&label[0], sizeof(label), "ecu_fsm_dispatch (switch) n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (const int& e : events)
+        {
+            ecu_fsm_dispatch(&fsm, &e);
+        }
+
+        bench::do_not_optimize(actions);
+    });
+
+    std::snprintf(&label[0], sizeof(label), "ecu_tfsm_dispatch (table) n=%zu", n);
+    bench::measure(&label[0], n, []() {}, [&]() {
+        for (const int& e : events)
+        {
+            ecu_tfsm_dispatch(&tfsm, static_cast<std::size_t>(e), &e);
+        }
+
+        bench::do_not_optimize(actions);
+    });
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(tfsm_dispatch)
+{
+    run(65536U);
+}
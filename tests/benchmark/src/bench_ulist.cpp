@@ -0,0 +1,215 @@
+/**
+ * @file
+ * @brief Benchmarks for ulist.h. Compares iteration throughput of
+ * small elements stored in an @ref ecu_ulist against the same
+ * elements stored in an @ref ecu_dlist.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/dlist.h"
+#include "ecu/ulist.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+/*------------------------------------------------------------*/
+/*------------------- FILE-SCOPE VARIABLES -------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Number of elements in each benchmarked list.
+ */
+static constexpr std::size_t ELEMENTS = 1U << 20U;
+
+/*------------------------------------------------------------*/
+/*------------------------- HELPERS --------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief User type stored in @ref ecu_dlist. One 32-bit value
+ * per node.
+ */
+struct item
+{
+    struct ecu_dnode node;
+    std::uint32_t value;
+};
+
+/**
+ * @brief @ref ecu_dlist of @ref ELEMENTS items. Nodes are either
+ * linked in address order (best case) or in a random order, which
+ * is typical of nodes allocated over the lifetime of a program.
+ */
+struct dlist_fixture
+{
+    explicit dlist_fixture(bool scattered)
+        : items(ELEMENTS)
+    {
+        std::vector<std::size_t> order(ELEMENTS);
+        std::iota(order.begin(), order.end(), 0);
+
+        if (scattered)
+        {
+            std::shuffle(order.begin(), order.end(), std::mt19937_64{1234});
+        }
+
+        ecu_dlist_ctor(&list);
+        for (std::size_t i : order)
+        {
+            ecu_dnode_ctor(&items[i].node, ECU_DNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+            items[i].value = static_cast<std::uint32_t>(i);
+            ecu_dlist_push_back(&list, &items[i].node);
+        }
+    }
+
+    ~dlist_fixture()
+    {
+        ecu_dlist_destroy(&list);
+    }
+
+    std::uint64_t sum()
+    {
+        std::uint64_t total = 0;
+        struct ecu_dlist_iterator iterator;
+
+        ECU_DLIST_FOR_EACH(n, &iterator, &list)
+        {
+            total += ECU_DNODE_GET_ENTRY(n, struct item, node)->value;
+        }
+
+        return total;
+    }
+
+    std::vector<item> items;
+    struct ecu_dlist list;
+};
+
+/**
+ * @brief @ref ecu_ulist of @ref ELEMENTS 32-bit values. Blocks
+ * come from a fixed pool handed out in random order so the
+ * blocks themselves are scattered like the dlist nodes.
+ */
+struct ulist_fixture
+{
+    explicit ulist_fixture(std::size_t capacity)
+        : units(ECU_ULIST_BLOCK_UNITS(sizeof(std::uint32_t), capacity)),
+          storage(units * (ELEMENTS / capacity + 1U))
+    {
+        for (std::size_t i = 0; i < storage.size(); i += units)
+        {
+            available.push_back(&storage[i]);
+        }
+
+        std::shuffle(available.begin(), available.end(), std::mt19937_64{1234});
+        ecu_ulist_ctor(&list, sizeof(std::uint32_t), capacity, &alloc, &release, this);
+
+        for (std::size_t i = 0; i < ELEMENTS; i++)
+        {
+            std::uint32_t value = static_cast<std::uint32_t>(i);
+            ecu_ulist_push_back(&list, &value);
+        }
+    }
+
+    ~ulist_fixture()
+    {
+        ecu_ulist_destroy(&list);
+    }
+
+    static void *alloc(void *obj)
+    {
+        ulist_fixture *me = static_cast<ulist_fixture *>(obj);
+        void *block = nullptr;
+
+        if (!me->available.empty())
+        {
+            block = me->available.back();
+            me->available.pop_back();
+        }
+
+        return block;
+    }
+
+    static void release(void *block, void *obj)
+    {
+        static_cast<ulist_fixture *>(obj)->available.push_back(static_cast<ecu_ulist_max_align *>(block));
+    }
+
+    std::uint64_t sum()
+    {
+        std::uint64_t total = 0;
+        struct ecu_ulist_iterator iterator;
+
+        ECU_ULIST_FOR_EACH(v, &iterator, &list, std::uint32_t)
+        {
+            total += *v;
+        }
+
+        return total;
+    }
+
+    std::size_t units;
+    std::vector<ecu_ulist_max_align> storage;
+    std::vector<ecu_ulist_max_align *> available;
+    struct ecu_ulist list;
+};
+
+/**
+ * @brief Times iteration over @p fixture, with and without
+ * flushing the caches first.
+ */
+template<typename Fixture>
+static void run(const char *label, Fixture& fixture)
+{
+    char cold[96];
+    std::snprintf(&cold[0], sizeof(cold), "%s (cold)", label);
+
+    bench::measure(&cold[0], ELEMENTS, bench::flush_cache, [&]() {
+        bench::do_not_optimize(fixture.sum());
+    });
+
+    bench::measure(label, ELEMENTS, []() {}, [&]() {
+        bench::do_not_optimize(fixture.sum());
+    });
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ BENCHMARKS ------------------------*/
+/*------------------------------------------------------------*/
+
+BENCHMARK(ulist_vs_dlist_iterate)
+{
+    {
+        dlist_fixture f(true);
+        run("ecu_dlist scattered nodes", f);
+    }
+
+    {
+        dlist_fixture f(false);
+        run("ecu_dlist sequential nodes", f);
+    }
+
+    for (std::size_t capacity : {8U, 16U, 64U})
+    {
+        char label[64];
+        std::snprintf(&label[0], sizeof(label), "ecu_ulist capacity=%zu", capacity);
+        ulist_fixture f(capacity);
+        run(&label[0], f);
+    }
+}
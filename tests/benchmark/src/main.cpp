@@ -0,0 +1,33 @@
+/**
+ * @file
+ * @brief Run all benchmarks. Optionally pass a substring as the first
+ * argument to only run benchmarks whose name contains it.
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/* STDLib. */
+#include <cstdio>
+#include <cstring>
+
+/* Benchmark harness. */
+#include "inc/benchmark.hpp"
+
+int main(int ac, char** av)
+{
+    const char *filter = (ac > 1) ? av[1] : "";
+
+    for (const auto& b : bench::registry())
+    {
+        if (std::strstr(b.name, filter))
+        {
+            std::printf("%s\n", b.name);
+            b.run();
+        }
+    }
+
+    return 0;
+}
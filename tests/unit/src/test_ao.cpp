@@ -0,0 +1,887 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref ao.h.
+ * Test summary:
+ *
+ * @ref ecu_ao_fsm_ctor(), @ref ecu_ao_hsm_ctor(), @ref ecu_ao_capacity()
+ *      - TEST(Ao, CtorCapacity)
+ *      - TEST(Ao, CtorMisalignedBuffer)
+ *      - TEST(Ao, CtorBufferTooSmall)
+ *      - TEST(Ao, CtorEventSizeTooSmall)
+ *
+ * @ref ecu_ao_post(), @ref ecu_ao_count()
+ *      - TEST(Ao, PostFifoOrder)
+ *      - TEST(Ao, PostCopiesEvent)
+ *      - TEST(Ao, PostFull)
+ *      - TEST(Ao, PostEventTooLarge)
+ *      - TEST(Ao, PostEventSizeUnset)
+ *      - TEST(Ao, PostWrapsAround)
+ *
+ * @ref ecu_ao_post_urgent()
+ *      - TEST(Ao, PostUrgentDispatchedFirst)
+ *      - TEST(Ao, PostUrgentLifoOrder)
+ *      - TEST(Ao, PostUrgentFull)
+ *
+ * @ref ecu_ao_run_once(), @ref ecu_ao_run_until_empty()
+ *      - TEST(Ao, RunOnceEmpty)
+ *      - TEST(Ao, RunOnceDispatchesOne)
+ *      - TEST(Ao, RunUntilEmptyIncludesPostsFromHandler)
+ *      - TEST(Ao, RunUntilEmptyUrgentPostFromHandlerInFullQueue)
+ *      - TEST(Ao, RunOnceFromHandler)
+ *
+ * @ref ecu_ao_set_post_hook()
+ *      - TEST(Ao, PostHookCalledAfterPost)
+ *      - TEST(Ao, PostHookNotCalledWhenFull)
+ *
+ * @ref ecu_ao_start()
+ *      - TEST(Ao, StartFsm)
+ *      - TEST(Ao, StartAndRunHsm)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ao.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief What the state handlers do with an event.
+ */
+enum event_id
+{
+    RECORD,         /**< Only records the event's value. */
+    POST_NEXT,      /**< Records, then posts a RECORD event with value + 1. */
+    POST_URGENT,    /**< Records, then urgently posts a RECORD event with value + 1. */
+    RUN_ONCE        /**< Runs the queue recursively. Not allowed. */
+};
+
+/**
+ * @brief Event posted in every test.
+ */
+struct test_event
+{
+    /// @brief Base class. Must be first.
+    ecu_event base;
+
+    /// @brief Payload recorded by the handlers.
+    int value;
+};
+
+/**
+ * @brief Event larger than the slots in every test.
+ */
+struct large_event
+{
+    /// @brief Base class. Must be first.
+    ecu_event base;
+
+    /// @brief Makes this event larger than @ref test_event.
+    std::uint8_t payload[64];
+};
+
+/**
+ * @brief Active object under test. Global so handlers can post to it.
+ */
+ecu_ao ao;
+
+/**
+ * @brief Returns a constructed event.
+ */
+test_event make_event(event_id id, int value)
+{
+    test_event e;
+    ecu_event_ctor(&e.base, id, sizeof(test_event));
+    e.value = value;
+    return e;
+}
+
+/**
+ * @brief Records the event, then acts on its ID. Shared by the
+ * fsm and hsm handlers.
+ */
+void process(const void *event)
+{
+    const test_event *e = static_cast<const test_event *>(event);
+    mock().actualCall("handler").withParameter("value", e->value);
+
+    if (e->base.id == POST_NEXT)
+    {
+        test_event next = make_event(RECORD, e->value + 1);
+        (void)ecu_ao_post(&ao, &next.base);
+    }
+    else if (e->base.id == POST_URGENT)
+    {
+        test_event next = make_event(RECORD, e->value + 1);
+        (void)ecu_ao_post_urgent(&ao, &next.base);
+    }
+    else if (e->base.id == RUN_ONCE)
+    {
+        (void)ecu_ao_run_once(&ao);
+    }
+
+    /* Value must be unchanged after posting, even if the
+    post reused the queue slot this event came from. */
+    mock().actualCall("handled").withParameter("value", e->value);
+}
+
+/**
+ * @brief Entry handler of the fsm state.
+ */
+void fsm_entry(ecu_fsm *me)
+{
+    (void)me;
+    mock().actualCall("entry");
+}
+
+/**
+ * @brief Handler of the fsm state.
+ */
+void fsm_handler(ecu_fsm *me, const void *event)
+{
+    (void)me;
+    process(event);
+}
+
+/**
+ * @brief Entry handler of the hsm state.
+ */
+void hsm_entry(ecu_hsm *me)
+{
+    (void)me;
+    mock().actualCall("entry");
+}
+
+/**
+ * @brief Handler of the hsm state.
+ */
+bool hsm_handler(ecu_hsm *me, const void *event)
+{
+    (void)me;
+    process(event);
+    return true;
+}
+
+/**
+ * @brief Post hook that records the object and how many
+ * events were queued when it ran.
+ */
+void post_hook(ecu_ao *me, void *obj)
+{
+    mock().actualCall("post_hook")
+        .withParameter("ao", static_cast<const void *>(me))
+        .withParameter("obj", obj)
+        .withParameter("count", ecu_ao_count(me));
+}
+
+const ecu_fsm_state FSM_STATE = ECU_FSM_STATE_CTOR(
+    &fsm_entry, ECU_FSM_STATE_EXIT_UNUSED, &fsm_handler
+);
+
+const ecu_hsm_state HSM_STATE = ECU_HSM_STATE_CTOR(
+    &hsm_entry, ECU_HSM_STATE_EXIT_UNUSED, ECU_HSM_STATE_INITIAL_UNUSED, &hsm_handler, &ECU_HSM_TOP_STATE
+);
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(Ao)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+        mock().strictOrder();
+        ecu_fsm_ctor(&fsm, &FSM_STATE);
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Expects the handler to process an event with @p value.
+    static void EXPECT_HANDLED(int value)
+    {
+        mock().expectOneCall("handler").withParameter("value", value);
+        mock().expectOneCall("handled").withParameter("value", value);
+    }
+
+    /// @brief Posts a RECORD event and asserts it was queued.
+    static void POST(int value)
+    {
+        test_event e = make_event(RECORD, value);
+        CHECK_TRUE( (ecu_ao_post(&ao, &e.base)) );
+    }
+
+    /// @brief Number of events queued in most tests.
+    static constexpr std::size_t EVENTS = 4;
+
+    /// @brief Queue memory. Extra bytes so tests can misalign it.
+    alignas(ECU_AO_ALIGNMENT) std::uint8_t buffer[ECU_AO_BUFFER_SIZE(sizeof(test_event), EVENTS) + ECU_AO_ALIGNMENT];
+
+    /// @brief State machine run by the active object.
+    ecu_fsm fsm;
+};
+
+/*------------------------------------------------------------*/
+/*---------------------- TESTS - ECU_AO_CTOR -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Buffer sized with ECU_AO_BUFFER_SIZE() queues the
+ * requested number of events.
+ */
+TEST(Ao, CtorCapacity)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], ECU_AO_BUFFER_SIZE(sizeof(test_event), EVENTS), sizeof(test_event));
+
+        /* Steps 2 and 3: Action and assert. */
+        UNSIGNED_LONGS_EQUAL(EVENTS, ecu_ao_capacity(&ao));
+        UNSIGNED_LONGS_EQUAL(0, ecu_ao_count(&ao));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Same capacity when the buffer is not aligned.
+ */
+TEST(Ao, CtorMisalignedBuffer)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[1], ECU_AO_BUFFER_SIZE(sizeof(test_event), EVENTS), sizeof(test_event));
+
+        /* Steps 2 and 3: Action and assert. */
+        UNSIGNED_LONGS_EQUAL(EVENTS, ecu_ao_capacity(&ao));
+        POST(1);
+        EXPECT_HANDLED(1);
+        CHECK_TRUE( (ecu_ao_run_once(&ao)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Buffer must hold a queue slot and
+ * the dispatch slot.
+ */
+TEST(Ao, CtorBufferTooSmall)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], ECU_AO_SLOT_SIZE(sizeof(test_event)), sizeof(test_event));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Slots must hold at least the base event.
+ */
+TEST(Ao, CtorEventSizeTooSmall)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(ecu_event) - 1);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*---------------------- TESTS - ECU_AO_POST -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Events are dispatched in the order they were posted.
+ */
+TEST(Ao, PostFifoOrder)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        POST(1);
+        POST(2);
+        POST(3);
+        UNSIGNED_LONGS_EQUAL(3, ecu_ao_count(&ao));
+        EXPECT_HANDLED(1);
+        EXPECT_HANDLED(2);
+        EXPECT_HANDLED(3);
+
+        /* Step 2: Action. */
+        std::size_t dispatched = ecu_ao_run_until_empty(&ao);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(3, dispatched);
+        UNSIGNED_LONGS_EQUAL(0, ecu_ao_count(&ao));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Event is stored by value. Changing the user's
+ * copy after posting does not affect the queued event.
+ */
+TEST(Ao, PostCopiesEvent)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e = make_event(RECORD, 1);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        CHECK_TRUE( (ecu_ao_post(&ao, &e.base)) );
+        e.value = 2;
+        EXPECT_HANDLED(1);
+
+        /* Step 2: Action. */
+        (void)ecu_ao_run_until_empty(&ao);
+
+        /* Step 3: Assert. Done by mock expectations. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Post fails without changing the queue once it is full.
+ */
+TEST(Ao, PostFull)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e = make_event(RECORD, 100);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], ECU_AO_BUFFER_SIZE(sizeof(test_event), EVENTS), sizeof(test_event));
+
+        for (std::size_t i = 0; i < EVENTS; i++)
+        {
+            POST(static_cast<int>(i));
+        }
+
+        /* Step 2: Action. */
+        bool status = ecu_ao_post(&ao, &e.base);
+
+        /* Step 3: Assert. */
+        CHECK_FALSE(status);
+        UNSIGNED_LONGS_EQUAL(EVENTS, ecu_ao_count(&ao));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Event is larger than a slot.
+ */
+TEST(Ao, PostEventTooLarge)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        large_event e;
+        ecu_event_ctor(&e.base, RECORD, sizeof(large_event));
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_ao_post(&ao, &e.base);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Event's size must be set so it can be copied.
+ */
+TEST(Ao, PostEventSizeUnset)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e;
+        ecu_event_ctor(&e.base, RECORD, ECU_EVENT_SIZE_UNUSED);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_ao_post(&ao, &e.base);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Queue keeps FIFO order after its slots wrap around
+ * several times.
+ */
+TEST(Ao, PostWrapsAround)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], ECU_AO_BUFFER_SIZE(sizeof(test_event), EVENTS), sizeof(test_event));
+
+        for (int i = 0; i < static_cast<int>(EVENTS * 3); i++)
+        {
+            EXPECT_HANDLED(i);
+            EXPECT_HANDLED(i + 100);
+        }
+
+        /* Steps 2 and 3: Action and assert. */
+        for (int i = 0; i < static_cast<int>(EVENTS * 3); i++)
+        {
+            POST(i);
+            POST(i + 100);
+            UNSIGNED_LONGS_EQUAL(2, ecu_ao_run_until_empty(&ao));
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------ TESTS - ECU_AO_POST_URGENT --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Urgent event is dispatched before events already queued.
+ */
+TEST(Ao, PostUrgentDispatchedFirst)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e = make_event(RECORD, 9);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        POST(1);
+        POST(2);
+        CHECK_TRUE( (ecu_ao_post_urgent(&ao, &e.base)) );
+        EXPECT_HANDLED(9);
+        EXPECT_HANDLED(1);
+        EXPECT_HANDLED(2);
+
+        /* Step 2: Action. */
+        (void)ecu_ao_run_until_empty(&ao);
+
+        /* Step 3: Assert. Done by mock expectations. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Urgent events posted back to back are dispatched
+ * newest first.
+ */
+TEST(Ao, PostUrgentLifoOrder)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e1 = make_event(RECORD, 1);
+        test_event e2 = make_event(RECORD, 2);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        CHECK_TRUE( (ecu_ao_post_urgent(&ao, &e1.base)) );
+        CHECK_TRUE( (ecu_ao_post_urgent(&ao, &e2.base)) );
+        EXPECT_HANDLED(2);
+        EXPECT_HANDLED(1);
+
+        /* Step 2: Action. */
+        (void)ecu_ao_run_until_empty(&ao);
+
+        /* Step 3: Assert. Done by mock expectations. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Urgent post fails once the queue is full.
+ */
+TEST(Ao, PostUrgentFull)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e = make_event(RECORD, 100);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], ECU_AO_BUFFER_SIZE(sizeof(test_event), EVENTS), sizeof(test_event));
+
+        for (std::size_t i = 0; i < EVENTS; i++)
+        {
+            POST(static_cast<int>(i));
+        }
+
+        /* Step 2: Action. */
+        bool status = ecu_ao_post_urgent(&ao, &e.base);
+
+        /* Step 3: Assert. */
+        CHECK_FALSE(status);
+        UNSIGNED_LONGS_EQUAL(EVENTS, ecu_ao_count(&ao));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*--------------------- TESTS - ECU_AO_RUN -------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Nothing is dispatched from an empty queue.
+ */
+TEST(Ao, RunOnceEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+
+        /* Steps 2 and 3: Action and assert. No mock calls expected. */
+        CHECK_FALSE( (ecu_ao_run_once(&ao)) );
+        UNSIGNED_LONGS_EQUAL(0, ecu_ao_run_until_empty(&ao));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Only the oldest event is dispatched.
+ */
+TEST(Ao, RunOnceDispatchesOne)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        POST(1);
+        POST(2);
+        EXPECT_HANDLED(1);
+
+        /* Step 2: Action. */
+        bool status = ecu_ao_run_once(&ao);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE(status);
+        UNSIGNED_LONGS_EQUAL(1, ecu_ao_count(&ao));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Events posted by a handler are queued behind the
+ * current event and dispatched in the same run.
+ */
+TEST(Ao, RunUntilEmptyIncludesPostsFromHandler)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e = make_event(POST_NEXT, 1);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        CHECK_TRUE( (ecu_ao_post(&ao, &e.base)) );
+        POST(10);
+        EXPECT_HANDLED(1);
+        EXPECT_HANDLED(10);
+        EXPECT_HANDLED(2);
+
+        /* Step 2: Action. */
+        std::size_t dispatched = ecu_ao_run_until_empty(&ao);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(3, dispatched);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Handler of a full queue urgently posts an event. It
+ * takes the slot the current event was copied out of, which must
+ * not corrupt the event being processed. The urgent event runs next.
+ */
+TEST(Ao, RunUntilEmptyUrgentPostFromHandlerInFullQueue)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e = make_event(POST_URGENT, 1);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], ECU_AO_BUFFER_SIZE(sizeof(test_event), EVENTS), sizeof(test_event));
+        CHECK_TRUE( (ecu_ao_post(&ao, &e.base)) );
+
+        for (std::size_t i = 1; i < EVENTS; i++)
+        {
+            POST(static_cast<int>(i) * 10);
+        }
+
+        EXPECT_HANDLED(1);
+        EXPECT_HANDLED(2);
+
+        for (std::size_t i = 1; i < EVENTS; i++)
+        {
+            EXPECT_HANDLED(static_cast<int>(i) * 10);
+        }
+
+        /* Step 2: Action. */
+        std::size_t dispatched = ecu_ao_run_until_empty(&ao);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(EVENTS + 1, dispatched);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Handler cannot run its own queue since
+ * every event must run to completion.
+ */
+TEST(Ao, RunOnceFromHandler)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e = make_event(RUN_ONCE, 1);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        CHECK_TRUE( (ecu_ao_post(&ao, &e.base)) );
+        POST(2);
+        mock().expectOneCall("handler").withParameter("value", 1);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_ao_run_once(&ao);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------- TESTS - ECU_AO_SET_POST_HOOK -------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Hook runs after each event is queued, for normal
+ * and urgent posts.
+ */
+TEST(Ao, PostHookCalledAfterPost)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        int obj = 0;
+        test_event e = make_event(RECORD, 2);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        ecu_ao_set_post_hook(&ao, &post_hook, &obj);
+        mock().expectOneCall("post_hook").withParameter("ao", static_cast<const void *>(&ao)).withParameter("obj", static_cast<void *>(&obj)).withParameter("count", static_cast<std::size_t>(1));
+        mock().expectOneCall("post_hook").withParameter("ao", static_cast<const void *>(&ao)).withParameter("obj", static_cast<void *>(&obj)).withParameter("count", static_cast<std::size_t>(2));
+
+        /* Step 2: Action. */
+        POST(1);
+        CHECK_TRUE( (ecu_ao_post_urgent(&ao, &e.base)) );
+
+        /* Step 3: Assert. Done by mock expectations. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Hook does not run if the event was not queued.
+ */
+TEST(Ao, PostHookNotCalledWhenFull)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e = make_event(RECORD, 100);
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], ECU_AO_BUFFER_SIZE(sizeof(test_event), EVENTS), sizeof(test_event));
+
+        for (std::size_t i = 0; i < EVENTS; i++)
+        {
+            POST(static_cast<int>(i));
+        }
+
+        ecu_ao_set_post_hook(&ao, &post_hook, ECU_AO_OBJ_UNUSED);
+
+        /* Step 2: Action. */
+        CHECK_FALSE( (ecu_ao_post(&ao, &e.base)) );
+        CHECK_FALSE( (ecu_ao_post_urgent(&ao, &e.base)) );
+
+        /* Step 3: Assert. No mock calls expected. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*--------------------- TESTS - ECU_AO_START -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Fsm's entry handler runs on start.
+ */
+TEST(Ao, StartFsm)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ao_fsm_ctor(&ao, &fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        mock().expectOneCall("entry");
+
+        /* Step 2: Action. */
+        ecu_ao_start(&ao);
+
+        /* Step 3: Assert. Done by mock expectations. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Hsm is started and queued events are dispatched to it.
+ */
+TEST(Ao, StartAndRunHsm)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_hsm hsm;
+        ecu_hsm_ctor(&hsm, &HSM_STATE, 1);
+        ecu_ao_hsm_ctor(&ao, &hsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+        POST(1);
+        POST(2);
+        mock().expectOneCall("entry");
+        EXPECT_HANDLED(1);
+        EXPECT_HANDLED(2);
+
+        /* Step 2: Action. */
+        ecu_ao_start(&ao);
+        std::size_t dispatched = ecu_ao_run_until_empty(&ao);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(2, dispatched);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
@@ -86,6 +86,13 @@
  *      - TEST(DList, DListInsertBeforeNodeInList)
  *      - TEST(DList, DListInsertBeforeNodeIsHead)
  * 
+ * @ref ecu_dlist_merge()
+ *      - TEST(DList, DListMergeInterleaved)
+ *      - TEST(DList, DListMergeStable)
+ *      - TEST(DList, DListMergeMeListEmpty)
+ *      - TEST(DList, DListMergeOtherListEmpty)
+ *      - TEST(DList, DListMergeSameListsSupplied)
+ * 
  * @ref ecu_dlist_push_back()
  *      - TEST(DList, DListPushBack)
  *      - TEST(DList, DListPushBackListIsEmpty)
@@ -118,6 +125,25 @@
  *      - TEST(DList, DListSortNonUniqueSortEven)
  *      - TEST(DList, DListSortNonUniqueSortOdd)
  * 
+ * @ref ecu_dlist_sort_parallel()
+ *      - TEST(DList, DListSortParallelThreaded)
+ *      - TEST(DList, DListSortParallelStable)
+ *      - TEST(DList, DListSortParallelBelowCutover)
+ *      - TEST(DList, DListSortParallelOneChunk)
+ *      - TEST(DList, DListSortParallelMoreChunksThanNodes)
+ * 
+ * @ref ecu_dlist_splice()
+ *      - TEST(DList, DListSpliceBothListsNotEmpty)
+ *      - TEST(DList, DListSpliceMeListEmpty)
+ *      - TEST(DList, DListSpliceOtherListEmpty)
+ *      - TEST(DList, DListSpliceSameListsSupplied)
+ * 
+ * @ref ecu_dlist_split()
+ *      - TEST(DList, DListSplitEvenSize)
+ *      - TEST(DList, DListSplitUnevenSize)
+ *      - TEST(DList, DListSplitFewerNodesThanChunks)
+ *      - TEST(DList, DListSplitChunkNotEmpty)
+ * 
  * @ref ecu_dlist_swap()
  *      - TEST(DList, DListSwapBothListsNotEmpty)
  *      - TEST(DList, DListSwapMeListEmptyOtherListNotEmpty)
@@ -154,6 +180,19 @@
  *      - TEST(DList, AtIteratorRemoveSome)
  *      - TEST(DList, AtIteratorRemoveAll)
  * 
+ * @ref ECU_DLIST_FOR_EACH_PREFETCH(), @ref ECU_DLIST_CONST_FOR_EACH_PREFETCH(),
+ * @ref ecu_dlist_prefetch_iterator_begin(), @ref ecu_dlist_prefetch_iterator_end(),
+ * @ref ecu_dlist_prefetch_iterator_next(), @ref ecu_dlist_prefetch_iterator_cbegin(),
+ * @ref ecu_dlist_prefetch_iterator_cend(), @ref ecu_dlist_prefetch_iterator_cnext()
+ *      - TEST(DList, PrefetchIterator)
+ *      - TEST(DList, ConstPrefetchIterator)
+ *      - TEST(DList, PrefetchIteratorDistanceZero)
+ *      - TEST(DList, PrefetchIteratorDistanceLargerThanList)
+ *      - TEST(DList, PrefetchIteratorListIsEmpty)
+ *      - TEST(DList, ConstPrefetchIteratorListIsEmpty)
+ *      - TEST(DList, PrefetchIteratorRemoveSome)
+ *      - TEST(DList, PrefetchIteratorRemoveAll)
+ * 
  * @author Ian Ress
  * @version 0.1
  * @date 2024-03-02
@@ -170,6 +209,7 @@
 /* STDLib. */
 #include <array>
 #include <cassert>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -869,6 +909,93 @@ TEST_GROUP(DList)
         return status;
     }
 
+    /// @brief Evaluation condition passed into functions under test
+    /// that must be stable. Only compares the tens digit of each node's
+    /// ID so nodes with different IDs can compare equal.
+    static bool sort_tens(const ecu_dnode *lhs, const ecu_dnode *rhs, void *data)
+    {
+        assert( (lhs && rhs) );
+        (void)data;
+        return ((ecu_dnode_id(lhs) / 10) < (ecu_dnode_id(rhs) / 10));
+    }
+
+    /// @brief Same as @ref sort_tens() but only compares digits
+    /// above the ten thousands place.
+    static bool sort_tens_thousands(const ecu_dnode *lhs, const ecu_dnode *rhs, void *data)
+    {
+        assert( (lhs && rhs) );
+        (void)data;
+        return ((ecu_dnode_id(lhs) / 10000) < (ecu_dnode_id(rhs) / 10000));
+    }
+
+    /// @brief Constructs an array of C lists. Used for functions
+    /// under test that take a contiguous array of lists, which
+    /// the @ref dlist wrapper cannot be used for.
+    template<std::size_t N>
+    static void construct(std::array<ecu_dlist, N>& lists)
+    {
+        for (auto& l : lists)
+        {
+            ecu_dlist_ctor(&l);
+        }
+    }
+
+    /// @brief Applies concrete visitor over all nodes in a C list
+    /// that is not wrapped by @ref dlist.
+    template<typename T>
+    requires std::is_base_of_v<visitor, std::remove_reference_t<T>>
+    static void accept(ecu_dlist& list, T&& v)
+    {
+        ecu_dlist_iterator iter;
+
+        ECU_DLIST_FOR_EACH(n, &iter, &list)
+        {
+            convert(n).accept(v);
+        }
+    }
+
+    /// @brief Sorts all chunks on the calling thread. Passed into 
+    /// function under test @ref ecu_dlist_sort_parallel(). Increments
+    /// the std::size_t counter passed as @p obj each time it is called.
+    static void sort_chunks_serial(ecu_dlist *chunks,
+                                   std::size_t count,
+                                   bool (*lhs_less_than_rhs)(const ecu_dnode *, const ecu_dnode *, void *),
+                                   void *data,
+                                   void *obj)
+    {
+        assert( (chunks && lhs_less_than_rhs && obj) );
+        (*static_cast<std::size_t *>(obj))++;
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            ecu_dlist_sort(&chunks[i], lhs_less_than_rhs, data);
+        }
+    }
+
+    /// @brief Sorts each chunk on its own thread. Passed into 
+    /// function under test @ref ecu_dlist_sort_parallel(). Increments
+    /// the std::size_t counter passed as @p obj each time it is called.
+    static void sort_chunks_threaded(ecu_dlist *chunks,
+                                     std::size_t count,
+                                     bool (*lhs_less_than_rhs)(const ecu_dnode *, const ecu_dnode *, void *),
+                                     void *data,
+                                     void *obj)
+    {
+        assert( (chunks && lhs_less_than_rhs && obj) );
+        std::vector<std::thread> workers;
+        (*static_cast<std::size_t *>(obj))++;
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            workers.emplace_back(&ecu_dlist_sort, &chunks[i], lhs_less_than_rhs, data);
+        }
+
+        for (auto& w : workers)
+        {
+            w.join();
+        }
+    }
+
     /**
      * @brief Used to test GET_ENTRY() macros. Types
      * chosen in an attempt to create non-uniform
@@ -2183,6 +2310,139 @@ TEST(DList, DListInsertBeforeNodeIsHead)
     }
 }
 
+/*------------------------------------------------------------*/
+/*--------------------- TESTS - DLIST MERGE ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Nodes from both lists are interleaved. Verify
+ * merged list is sorted and other list is empty.
+ */
+TEST(DList, DListMergeInterleaved)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist me{rw_dnode{1}, rw_dnode{3}, rw_dnode{5}, rw_dnode{6}};
+        dlist other{rw_dnode{0}, rw_dnode{2}, rw_dnode{4}, rw_dnode{7}, rw_dnode{8}};
+        EXPECT_NODES_IN_LIST(0, 1, 2, 3, 4, 5, 6, 7, 8);
+
+        /* Step 2: Action. */
+        ecu_dlist_merge(&me, &other, &sort, ECU_DNODE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        me.accept(node_id_in_list_actual_call());
+        CHECK_TRUE( (ecu_dlist_empty(&other)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Equal nodes in me are placed before equal 
+ * nodes in other.
+ */
+TEST(DList, DListMergeStable)
+{
+    try
+    {
+        /* Step 1: Arrange. Only tens digit compared. */
+        dlist me{rw_dnode{10}, rw_dnode{11}, rw_dnode{30}};
+        dlist other{rw_dnode{12}, rw_dnode{20}, rw_dnode{31}};
+        EXPECT_NODES_IN_LIST(10, 11, 12, 20, 30, 31);
+
+        /* Step 2: Action. */
+        ecu_dlist_merge(&me, &other, &sort_tens, ECU_DNODE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        me.accept(node_id_in_list_actual_call());
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Merging into an empty list moves all nodes 
+ * from other.
+ */
+TEST(DList, DListMergeMeListEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist me;
+        dlist other{RW.at(0), RW.at(1), RW.at(2)};
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2));
+
+        /* Step 2: Action. */
+        ecu_dlist_merge(&me, &other, &sort, ECU_DNODE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        me.accept(node_obj_in_list_actual_call());
+        CHECK_TRUE( (ecu_dlist_empty(&other)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Merging an empty list does nothing.
+ */
+TEST(DList, DListMergeOtherListEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist me{RW.at(0), RW.at(1), RW.at(2)};
+        dlist other;
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2));
+
+        /* Step 2: Action. */
+        ecu_dlist_merge(&me, &other, &sort, ECU_DNODE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        me.accept(node_obj_in_list_actual_call());
+        CHECK_TRUE( (ecu_dlist_empty(&other)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. A list cannot be merged into itself.
+ */
+TEST(DList, DListMergeSameListsSupplied)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist me{RW.at(0), RW.at(1)};
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_dlist_merge(&me, &me, &sort, ECU_DNODE_OBJ_UNUSED);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
 /*------------------------------------------------------------*/
 /*------------------ TESTS - DLIST PUSH BACK -----------------*/
 /*------------------------------------------------------------*/
@@ -2686,30 +2946,53 @@ TEST(DList, DListSortNonUniqueSortOdd)
 }
 
 /*------------------------------------------------------------*/
-/*--------------------- TESTS - DLIST SWAP -------------------*/
+/*----------------- TESTS - DLIST SORT PARALLEL --------------*/
 /*------------------------------------------------------------*/
 
 /**
- * @brief Normal swap.
+ * @brief Large list sorted on multiple threads. Each node's
+ * ID encodes its key (tens digit) and original position
+ * so a sorted and stable result has strictly increasing IDs.
  */
-TEST(DList, DListSwapBothListsNotEmpty)
+TEST(DList, DListSortParallelThreaded)
 {
     try
     {
-        /* Step 1: Arrange. list1 = [0, 1, 2]. list2 = [3, 4]. */
-        dlist me{RW.at(0), RW.at(1), RW.at(2)};
-        dlist other{RW.at(3), RW.at(4)};
-        EXPECT_NODES_IN_LIST(RW.at(3), RW.at(4), /* me list. */
-                             RW.at(0), RW.at(1), RW.at(2) /* other list. */ );
+        /* Step 1: Arrange. Node i has key (i * 7919) % 97. */
+        constexpr std::size_t NODES = 5000;
+        std::vector<rw_dnode> nodes;
+        std::array<ecu_dlist, 4> chunks;
+        construct(chunks);
+        std::size_t calls = 0;
+        dlist list;
+        ecu_dlist_citerator citer;
+        ecu_object_id_t prev = -1;
+        nodes.reserve(NODES);
+
+        for (std::size_t i = 0; i < NODES; i++)
+        {
+            nodes.emplace_back(static_cast<ecu_object_id_t>(((i * 7919U) % 97U) * 10000U + i));
+            ecu_dlist_push_back(&list, &nodes.back());
+        }
 
         /* Step 2: Action. */
-        ecu_dlist_swap(&me, &other);
+        ecu_dlist_sort_parallel(&list, chunks.data(), chunks.size(), 64, &sort_tens_thousands, ECU_DNODE_OBJ_UNUSED,
+                                &sort_chunks_threaded, &calls);
 
         /* Step 3: Assert. */
-        me.accept(node_obj_in_list_actual_call()); /* MUST be first. */
-        other.accept(node_obj_in_list_actual_call());
-        CHECK_TRUE( (ecu_dlist_size(&me) == 2) );
-        CHECK_TRUE( (ecu_dlist_size(&other) == 3) );
+        UNSIGNED_LONGS_EQUAL(1, calls);
+        UNSIGNED_LONGS_EQUAL(NODES, ecu_dlist_size(&list));
+
+        for (auto& c : chunks)
+        {
+            CHECK_TRUE( (ecu_dlist_empty(&c)) );
+        }
+
+        ECU_DLIST_CONST_FOR_EACH(n, &citer, &list)
+        {
+            CHECK_TRUE( (ecu_dnode_id(n) > prev) );
+            prev = ecu_dnode_id(n);
+        }
     }
     catch (const AssertException& e)
     {
@@ -2719,26 +3002,28 @@ TEST(DList, DListSwapBothListsNotEmpty)
 }
 
 /**
- * @brief Me list gets other's contents. Other list 
- * becomes empty.
+ * @brief Nodes that compare equal keep their original
+ * relative order across chunk boundaries.
  */
-TEST(DList, DListSwapMeListEmptyOtherListNotEmpty)
+TEST(DList, DListSortParallelStable)
 {
     try
     {
-        /* Step 1: Arrange. me = []. other = [0, 1]. */
-        dlist me;
-        dlist other{RW.at(0), RW.at(1)};
-        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1));
+        /* Step 1: Arrange. Only tens digit compared. */
+        dlist list{rw_dnode{30}, rw_dnode{10}, rw_dnode{20}, rw_dnode{31}, rw_dnode{11},
+                   rw_dnode{21}, rw_dnode{32}, rw_dnode{12}, rw_dnode{22}, rw_dnode{13}};
+        std::array<ecu_dlist, 3> chunks;
+        construct(chunks);
+        std::size_t calls = 0;
+        EXPECT_NODES_IN_LIST(10, 11, 12, 13, 20, 21, 22, 30, 31, 32);
 
         /* Step 2: Action. */
-        ecu_dlist_swap(&me, &other);
+        ecu_dlist_sort_parallel(&list, chunks.data(), chunks.size(), 0, &sort_tens, ECU_DNODE_OBJ_UNUSED,
+                                &sort_chunks_serial, &calls);
 
         /* Step 3: Assert. */
-        me.accept(node_obj_in_list_actual_call());
-        other.accept(node_obj_in_list_actual_call());
-        CHECK_TRUE( (ecu_dlist_size(&me) == 2) );
-        CHECK_TRUE( (ecu_dlist_size(&other) == 0) );
+        list.accept(node_id_in_list_actual_call());
+        UNSIGNED_LONGS_EQUAL(1, calls);
     }
     catch (const AssertException& e)
     {
@@ -2748,26 +3033,27 @@ TEST(DList, DListSwapMeListEmptyOtherListNotEmpty)
 }
 
 /**
- * @brief Me list becomes empty. Other list gets
- * me's contents.
+ * @brief List smaller than cutover is sorted serially.
+ * Chunk sorter is never called.
  */
-TEST(DList, DListSwapMeListNotEmptyOtherListEmpty)
+TEST(DList, DListSortParallelBelowCutover)
 {
     try
     {
-        /* Step 1: Arrange. me = [1, 2]. other = []. */
-        dlist me{RW.at(0), RW.at(1)};
-        dlist other;
-        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1));
+        /* Step 1: Arrange. */
+        dlist list{rw_dnode{5}, rw_dnode{1}, rw_dnode{3}, rw_dnode{0}, rw_dnode{2}, rw_dnode{4}};
+        std::array<ecu_dlist, 3> chunks;
+        construct(chunks);
+        std::size_t calls = 0;
+        EXPECT_NODES_IN_LIST(0, 1, 2, 3, 4, 5);
 
         /* Step 2: Action. */
-        ecu_dlist_swap(&me, &other);
+        ecu_dlist_sort_parallel(&list, chunks.data(), chunks.size(), 7, &sort, ECU_DNODE_OBJ_UNUSED,
+                                &sort_chunks_serial, &calls);
 
         /* Step 3: Assert. */
-        me.accept(node_obj_in_list_actual_call());
-        other.accept(node_obj_in_list_actual_call());
-        CHECK_TRUE( (ecu_dlist_size(&me) == 0) );
-        CHECK_TRUE( (ecu_dlist_size(&other) == 2) );
+        list.accept(node_id_in_list_actual_call());
+        UNSIGNED_LONGS_EQUAL(0, calls);
     }
     catch (const AssertException& e)
     {
@@ -2777,20 +3063,27 @@ TEST(DList, DListSwapMeListNotEmptyOtherListEmpty)
 }
 
 /**
- * @brief Allowed. Nothing should happen.
+ * @brief Only one chunk supplied. List is sorted serially.
+ * Chunk sorter is never called.
  */
-TEST(DList, DListSwapBothListsEmpty)
+TEST(DList, DListSortParallelOneChunk)
 {
     try
     {
         /* Step 1: Arrange. */
-        dlist me;
-        dlist other;
+        dlist list{rw_dnode{5}, rw_dnode{1}, rw_dnode{3}, rw_dnode{0}, rw_dnode{2}, rw_dnode{4}};
+        ecu_dlist chunk;
+        std::size_t calls = 0;
+        ecu_dlist_ctor(&chunk);
+        EXPECT_NODES_IN_LIST(0, 1, 2, 3, 4, 5);
 
         /* Step 2: Action. */
-        ecu_dlist_swap(&me, &other);
+        ecu_dlist_sort_parallel(&list, &chunk, 1, 0, &sort, ECU_DNODE_OBJ_UNUSED,
+                                &sort_chunks_serial, &calls);
 
-        /* Step 3: Assert. Test fails if assertion fires. */
+        /* Step 3: Assert. */
+        list.accept(node_id_in_list_actual_call());
+        UNSIGNED_LONGS_EQUAL(0, calls);
     }
     catch (const AssertException& e)
     {
@@ -2800,50 +3093,60 @@ TEST(DList, DListSwapBothListsEmpty)
 }
 
 /**
- * @brief Not allowed. The two lists must be unique.
+ * @brief More chunks supplied than nodes in the list.
+ * Only the chunks that receive nodes are sorted.
  */
-TEST(DList, DListSwapSameListsSupplied)
+TEST(DList, DListSortParallelMoreChunksThanNodes)
 {
     try
     {
         /* Step 1: Arrange. */
-        dlist me;
-        EXPECT_ASSERTION();
+        dlist list{rw_dnode{2}, rw_dnode{0}, rw_dnode{1}};
+        std::array<ecu_dlist, 8> chunks;
+        construct(chunks);
+        std::size_t calls = 0;
+        EXPECT_NODES_IN_LIST(0, 1, 2);
 
         /* Step 2: Action. */
-        ecu_dlist_swap(&me, &me);
+        ecu_dlist_sort_parallel(&list, chunks.data(), chunks.size(), 0, &sort, ECU_DNODE_OBJ_UNUSED,
+                                &sort_chunks_serial, &calls);
 
-        /* Step 3: Assert. Test fails if assertion does not fire. */
+        /* Step 3: Assert. */
+        list.accept(node_id_in_list_actual_call());
+        UNSIGNED_LONGS_EQUAL(1, calls);
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /*------------------------------------------------------------*/
-/*--------------------- TESTS - DLIST VALID ------------------*/
+/*-------------------- TESTS - DLIST SPLICE ------------------*/
 /*------------------------------------------------------------*/
 
 /**
- * @brief General test. Dlist is not valid until it 
- * has been constructed.
+ * @brief Other's nodes are appended to me in order.
+ * Other becomes empty.
  */
-TEST(DList, DListValid)
+TEST(DList, DListSpliceBothListsNotEmpty)
 {
     try
     {
-        /* Step 1: Arrange. Create C object, NOT C++ object since 
-        default constructor of C++ object calls C constructor. */
-        ecu_dlist list;
+        /* Step 1: Arrange. me = [0, 1]. other = [2, 3, 4]. */
+        dlist me{RW.at(0), RW.at(1)};
+        dlist other{RW.at(2), RW.at(3), RW.at(4)};
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_FALSE( (ecu_dlist_valid(&list)) );
-        ecu_dlist_ctor(&list);
-        CHECK_TRUE( (ecu_dlist_valid(&list)) );
-        ecu_dlist_destroy(&list);
-        CHECK_FALSE( (ecu_dlist_valid(&list)) );
+        /* Step 2: Action. */
+        ecu_dlist_splice(&me, &other);
+
+        /* Step 3: Assert. */
+        me.accept(node_obj_in_list_actual_call());
+        other.accept(node_obj_in_list_actual_call());
+        CHECK_TRUE( (ecu_dlist_size(&me) == 5) );
+        CHECK_TRUE( (ecu_dlist_empty(&other)) );
     }
     catch (const AssertException& e)
     {
@@ -2852,25 +3155,400 @@ TEST(DList, DListValid)
     }
 }
 
-/*------------------------------------------------------------*/
-/*------------------- TESTS - DLIST ITERATOR -----------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief General test. Verify all nodes in list iterated over.
+ * @brief Me gets other's contents. Other becomes empty.
  */
-TEST(DList, Iterator)
+TEST(DList, DListSpliceMeListEmpty)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_dlist_iterator iter;
-        node_obj_in_list_actual_call visitor;
-        dlist list{RW.at(0), RW.at(1), RW.at(2), RW.at(3)};
-        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-
-        /* Steps 2 and 3: Action and assert. */
-        ECU_DLIST_FOR_EACH(n, &iter, &list)
+        /* Step 1: Arrange. me = []. other = [0, 1]. */
+        dlist me;
+        dlist other{RW.at(0), RW.at(1)};
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1));
+
+        /* Step 2: Action. */
+        ecu_dlist_splice(&me, &other);
+
+        /* Step 3: Assert. */
+        me.accept(node_obj_in_list_actual_call());
+        other.accept(node_obj_in_list_actual_call());
+        CHECK_TRUE( (ecu_dlist_size(&me) == 2) );
+        CHECK_TRUE( (ecu_dlist_empty(&other)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Allowed. Me is unchanged.
+ */
+TEST(DList, DListSpliceOtherListEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. me = [0, 1]. other = []. */
+        dlist me{RW.at(0), RW.at(1)};
+        dlist other;
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1));
+
+        /* Step 2: Action. */
+        ecu_dlist_splice(&me, &other);
+
+        /* Step 3: Assert. */
+        me.accept(node_obj_in_list_actual_call());
+        other.accept(node_obj_in_list_actual_call());
+        CHECK_TRUE( (ecu_dlist_size(&me) == 2) );
+        CHECK_TRUE( (ecu_dlist_empty(&other)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Splicing a list into itself is not allowed.
+ */
+TEST(DList, DListSpliceSameListsSupplied)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist me;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_dlist_splice(&me, &me);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*--------------------- TESTS - DLIST SPLIT ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief List size is a multiple of the number of chunks.
+ * Every chunk receives the same number of nodes in order.
+ */
+TEST(DList, DListSplitEvenSize)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist list{RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5)};
+        std::array<ecu_dlist, 3> chunks;
+        construct(chunks);
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+
+        /* Step 2: Action. */
+        std::size_t used = ecu_dlist_split(&list, chunks.data(), chunks.size());
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(3, used);
+        CHECK_TRUE( (ecu_dlist_empty(&list)) );
+
+        for (auto& c : chunks)
+        {
+            UNSIGNED_LONGS_EQUAL(2, ecu_dlist_size(&c));
+            accept(c, node_obj_in_list_actual_call());
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief List size is not a multiple of the number of chunks.
+ * Chunk sizes differ by at most one and the first chunks are larger.
+ */
+TEST(DList, DListSplitUnevenSize)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist list{RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6), RW.at(7)};
+        std::array<ecu_dlist, 3> chunks;
+        construct(chunks);
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+
+        /* Step 2: Action. */
+        std::size_t used = ecu_dlist_split(&list, chunks.data(), chunks.size());
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(3, used);
+        UNSIGNED_LONGS_EQUAL(3, ecu_dlist_size(&chunks.at(0)));
+        UNSIGNED_LONGS_EQUAL(3, ecu_dlist_size(&chunks.at(1)));
+        UNSIGNED_LONGS_EQUAL(2, ecu_dlist_size(&chunks.at(2)));
+
+        for (auto& c : chunks)
+        {
+            accept(c, node_obj_in_list_actual_call());
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remaining chunks stay empty if the list has fewer
+ * nodes than chunks.
+ */
+TEST(DList, DListSplitFewerNodesThanChunks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist list{RW.at(0), RW.at(1)};
+        std::array<ecu_dlist, 4> chunks;
+        construct(chunks);
+
+        /* Step 2: Action. */
+        std::size_t used = ecu_dlist_split(&list, chunks.data(), chunks.size());
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(2, used);
+        POINTERS_EQUAL( &RW.at(0), &convert(ecu_dlist_front(&chunks.at(0))) );
+        POINTERS_EQUAL( &RW.at(1), &convert(ecu_dlist_front(&chunks.at(1))) );
+        CHECK_TRUE( (ecu_dlist_empty(&chunks.at(2))) );
+        CHECK_TRUE( (ecu_dlist_empty(&chunks.at(3))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. All chunks must be empty.
+ */
+TEST(DList, DListSplitChunkNotEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist list{RW.at(0), RW.at(1)};
+        std::array<ecu_dlist, 2> chunks;
+        construct(chunks);
+        ecu_dlist_push_back(&chunks.at(1), &RW.at(2));
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_dlist_split(&list, chunks.data(), chunks.size());
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*--------------------- TESTS - DLIST SWAP -------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Normal swap.
+ */
+TEST(DList, DListSwapBothListsNotEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. list1 = [0, 1, 2]. list2 = [3, 4]. */
+        dlist me{RW.at(0), RW.at(1), RW.at(2)};
+        dlist other{RW.at(3), RW.at(4)};
+        EXPECT_NODES_IN_LIST(RW.at(3), RW.at(4), /* me list. */
+                             RW.at(0), RW.at(1), RW.at(2) /* other list. */ );
+
+        /* Step 2: Action. */
+        ecu_dlist_swap(&me, &other);
+
+        /* Step 3: Assert. */
+        me.accept(node_obj_in_list_actual_call()); /* MUST be first. */
+        other.accept(node_obj_in_list_actual_call());
+        CHECK_TRUE( (ecu_dlist_size(&me) == 2) );
+        CHECK_TRUE( (ecu_dlist_size(&other) == 3) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Me list gets other's contents. Other list 
+ * becomes empty.
+ */
+TEST(DList, DListSwapMeListEmptyOtherListNotEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. me = []. other = [0, 1]. */
+        dlist me;
+        dlist other{RW.at(0), RW.at(1)};
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1));
+
+        /* Step 2: Action. */
+        ecu_dlist_swap(&me, &other);
+
+        /* Step 3: Assert. */
+        me.accept(node_obj_in_list_actual_call());
+        other.accept(node_obj_in_list_actual_call());
+        CHECK_TRUE( (ecu_dlist_size(&me) == 2) );
+        CHECK_TRUE( (ecu_dlist_size(&other) == 0) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Me list becomes empty. Other list gets
+ * me's contents.
+ */
+TEST(DList, DListSwapMeListNotEmptyOtherListEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. me = [1, 2]. other = []. */
+        dlist me{RW.at(0), RW.at(1)};
+        dlist other;
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1));
+
+        /* Step 2: Action. */
+        ecu_dlist_swap(&me, &other);
+
+        /* Step 3: Assert. */
+        me.accept(node_obj_in_list_actual_call());
+        other.accept(node_obj_in_list_actual_call());
+        CHECK_TRUE( (ecu_dlist_size(&me) == 0) );
+        CHECK_TRUE( (ecu_dlist_size(&other) == 2) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Allowed. Nothing should happen.
+ */
+TEST(DList, DListSwapBothListsEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist me;
+        dlist other;
+
+        /* Step 2: Action. */
+        ecu_dlist_swap(&me, &other);
+
+        /* Step 3: Assert. Test fails if assertion fires. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. The two lists must be unique.
+ */
+TEST(DList, DListSwapSameListsSupplied)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist me;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_dlist_swap(&me, &me);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*--------------------- TESTS - DLIST VALID ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief General test. Dlist is not valid until it 
+ * has been constructed.
+ */
+TEST(DList, DListValid)
+{
+    try
+    {
+        /* Step 1: Arrange. Create C object, NOT C++ object since 
+        default constructor of C++ object calls C constructor. */
+        ecu_dlist list;
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_FALSE( (ecu_dlist_valid(&list)) );
+        ecu_dlist_ctor(&list);
+        CHECK_TRUE( (ecu_dlist_valid(&list)) );
+        ecu_dlist_destroy(&list);
+        CHECK_FALSE( (ecu_dlist_valid(&list)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - DLIST ITERATOR -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief General test. Verify all nodes in list iterated over.
+ */
+TEST(DList, Iterator)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist_iterator iter;
+        node_obj_in_list_actual_call visitor;
+        dlist list{RW.at(0), RW.at(1), RW.at(2), RW.at(3)};
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_DLIST_FOR_EACH(n, &iter, &list)
         {
             convert(n).accept(visitor);
         }
@@ -3349,3 +4027,222 @@ TEST(DList, AtIteratorRemoveAll)
         (void)e;
     }
 }
+
+/*------------------------------------------------------------*/
+/*---------------- TESTS - DLIST PREFETCH ITERATORS ----------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief General test. Verify all nodes in list iterated over.
+ */
+TEST(DList, PrefetchIterator)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist_prefetch_iterator iter;
+        node_obj_in_list_actual_call visitor;
+        dlist list{RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5)};
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_DLIST_FOR_EACH_PREFETCH(n, &iter, &list, 2)
+        {
+            convert(n).accept(visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General test. Verify all nodes in list iterated over.
+ */
+TEST(DList, ConstPrefetchIterator)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist_prefetch_citerator citer;
+        node_obj_in_list_actual_call visitor;
+        dlist list{RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5)};
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_DLIST_CONST_FOR_EACH_PREFETCH(n, &citer, &list, 2)
+        {
+            convert(n).accept(visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Prefetching disabled. Iteration is the same 
+ * as @ref ECU_DLIST_FOR_EACH().
+ */
+TEST(DList, PrefetchIteratorDistanceZero)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist_prefetch_iterator iter;
+        node_obj_in_list_actual_call visitor;
+        dlist list{RW.at(0), RW.at(1), RW.at(2)};
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_DLIST_FOR_EACH_PREFETCH(n, &iter, &list, 0)
+        {
+            convert(n).accept(visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Prefetch distance is larger than the list. Prefetching
+ * stops at the end of the list without affecting the iteration.
+ */
+TEST(DList, PrefetchIteratorDistanceLargerThanList)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist_prefetch_iterator iter;
+        node_obj_in_list_actual_call visitor;
+        dlist list{RW.at(0), RW.at(1), RW.at(2)};
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(1), RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_DLIST_FOR_EACH_PREFETCH(n, &iter, &list, 50)
+        {
+            convert(n).accept(visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iterating over an empty list immediately returns.
+ */
+TEST(DList, PrefetchIteratorListIsEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist_prefetch_iterator iter;
+        node_obj_in_list_actual_call visitor;
+        dlist list;
+
+        /* Steps 2 and 3: Action and assert. Test fails if any nodes iterated over. */
+        ECU_DLIST_FOR_EACH_PREFETCH(n, &iter, &list, 4)
+        {
+            convert(n).accept(visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iterating over an empty list immediately returns.
+ */
+TEST(DList, ConstPrefetchIteratorListIsEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist_prefetch_citerator citer;
+        node_obj_in_list_actual_call visitor;
+        dlist list;
+
+        /* Steps 2 and 3: Action and assert. Test fails if any nodes iterated over. */
+        ECU_DLIST_CONST_FOR_EACH_PREFETCH(n, &citer, &list, 4)
+        {
+            convert(n).accept(visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove some nodes in the middle of an iteration.
+ */
+TEST(DList, PrefetchIteratorRemoveSome)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist_prefetch_iterator iter;
+        dlist list{RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5)};
+        EXPECT_NODES_IN_LIST(RW.at(0), RW.at(2), RW.at(4));
+
+        /* Step 2: Action. */
+        ECU_DLIST_FOR_EACH_PREFETCH(n, &iter, &list, 2)
+        {
+            if (n == &RW.at(1) || n == &RW.at(3) || n == &RW.at(5))
+            {
+                ecu_dnode_remove(n);
+            }
+        }
+
+        /* Step 3: Assert. */
+        list.accept(node_obj_in_list_actual_call());
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove all nodes in the middle of an iteration.
+ */
+TEST(DList, PrefetchIteratorRemoveAll)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist_prefetch_iterator iter;
+        node_remove remove_visitor;
+        dlist list{RW.at(0), RW.at(1), RW.at(2), RW.at(3)};
+
+        /* Step 2: Action. */
+        ECU_DLIST_FOR_EACH_PREFETCH(n, &iter, &list, 1)
+        {
+            convert(n).accept(remove_visitor);
+        }
+
+        /* Step 3: Assert. Test fails if any nodes still in list. */
+        CHECK_TRUE( (ecu_dlist_empty(&list)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
@@ -0,0 +1,873 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref exec.h.
+ * Test summary:
+ *
+ * @ref ecu_exec_ctor(), @ref ecu_exec_add()
+ *      - TEST(Exec, CtorCapacityNotPowerOfTwo)
+ *      - TEST(Exec, AddTwice)
+ *      - TEST(Exec, PostBeforeAdd)
+ *
+ * @ref ecu_exec_ao_fsm_ctor(), @ref ecu_exec_ao_hsm_ctor(), @ref ecu_exec_ao_capacity()
+ *      - TEST(Exec, AoCtorCapacityRoundedDown)
+ *      - TEST(Exec, AoCtorBufferTooSmall)
+ *
+ * @ref ecu_exec_ao_post()
+ *      - TEST(Exec, PostFull)
+ *      - TEST(Exec, PostEventTooLarge)
+ *
+ * @ref ecu_exec_run_once(), @ref ecu_exec_ao_start()
+ *      - TEST(Exec, RunOnceNoWork)
+ *      - TEST(Exec, RunOnceDispatchesInOrder)
+ *      - TEST(Exec, RunOnceBudget)
+ *      - TEST(Exec, RunOnceBudgetTakesTurns)
+ *      - TEST(Exec, RunOnceHandlerPostsToSelf)
+ *      - TEST(Exec, RunOnceSteal)
+ *      - TEST(Exec, StartAndRunHsm)
+ *
+ * Concurrency stress tests. Build with the linux_tsan preset to also
+ * run these under ThreadSanitizer:
+ *      - TEST(Exec, StressProducersAndWorkers)
+ *      - TEST(Exec, StressHandlersPostToEachOther)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/exec.h"
+
+/* STDLib. */
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief Event posted in every test.
+ */
+struct test_event
+{
+    /// @brief Base class. Must be first.
+    ecu_event base;
+
+    /// @brief Payload. In single-threaded tests, the handler posts
+    /// value - 1 to its own object while it is greater than 0.
+    std::size_t value;
+
+    /// @brief Thread that posted the event. Only used by stress tests.
+    std::size_t producer;
+};
+
+/**
+ * @brief Number of events each object can queue in
+ * single-threaded tests.
+ */
+constexpr std::size_t EVENTS = 4;
+
+/**
+ * @brief Number of events each object can queue in stress tests.
+ */
+constexpr std::size_t STRESS_EVENTS = 64;
+
+/**
+ * @brief Active object whose state machine records every event.
+ */
+template<std::size_t N>
+struct test_ao
+{
+    /// @brief State machine run by @ref ao.
+    ecu_fsm fsm;
+
+    /// @brief Object under test.
+    ecu_exec_ao ao;
+
+    /// @brief Reported by the handlers.
+    int id{0};
+
+    /// @brief Set while a stress handler runs. Used to detect
+    /// an object being dispatched on two threads at once.
+    std::atomic<bool> inside{false};
+
+    /// @brief Number of events dispatched in stress tests.
+    std::size_t count{0};
+
+    /// @brief Value of the next event expected from each producer
+    /// in stress tests.
+    std::vector<std::size_t> expected;
+
+    /// @brief Object that stress handlers forward events to.
+    test_ao *next{nullptr};
+
+    /// @brief Mailbox memory.
+    std::uint8_t buffer[ECU_EXEC_BUFFER_SIZE(sizeof(test_event), N)];
+};
+
+/**
+ * @brief Returns a constructed event.
+ */
+test_event make_event(std::size_t value, std::size_t producer)
+{
+    test_event e;
+    ecu_event_ctor(&e.base, ECU_USER_EVENT_ID_BEGIN, sizeof(test_event));
+    e.value = value;
+    e.producer = producer;
+    return e;
+}
+
+/**
+ * @brief Set by stress handlers if an object was dispatched
+ * concurrently or out of order.
+ */
+std::atomic<bool> violation{false};
+
+/**
+ * @brief Total number of events dispatched by stress handlers.
+ */
+std::atomic<std::size_t> dispatched{0};
+
+/**
+ * @brief Entry handler. Records the object.
+ */
+void fsm_entry(ecu_fsm *me)
+{
+    const test_ao<EVENTS> *t = ECU_FSM_GET_CONTEXT(me, test_ao<EVENTS>, fsm);
+    mock().actualCall("entry").withParameter("id", t->id);
+}
+
+/**
+ * @brief Records the event. Posts value - 1 to itself if
+ * value is greater than 0.
+ */
+void fsm_handler(ecu_fsm *me, const void *event)
+{
+    test_ao<EVENTS> *t = ECU_FSM_GET_CONTEXT(me, test_ao<EVENTS>, fsm);
+    const test_event *e = static_cast<const test_event *>(event);
+    mock().actualCall("handler").withParameter("id", t->id).withParameter("value", e->value);
+
+    if (e->value > 0)
+    {
+        test_event next = make_event(e->value - 1, 0);
+        CHECK_TRUE( (ecu_exec_ao_post(&t->ao, &next.base)) );
+    }
+}
+
+/**
+ * @brief Entry handler of the hsm state.
+ */
+void hsm_entry(ecu_hsm *me)
+{
+    (void)me;
+    mock().actualCall("entry").withParameter("id", 0);
+}
+
+/**
+ * @brief Records the event.
+ */
+bool hsm_handler(ecu_hsm *me, const void *event)
+{
+    (void)me;
+    mock().actualCall("handler").withParameter("id", 0).withParameter("value", static_cast<const test_event *>(event)->value);
+    return true;
+}
+
+/**
+ * @brief Stress handler. Flags a violation if the object is
+ * already being dispatched or a producer's events arrive out of
+ * order. Forwards events with a non-zero value to the next object.
+ */
+void stress_handler(ecu_fsm *me, const void *event)
+{
+    test_ao<STRESS_EVENTS> *t = ECU_FSM_GET_CONTEXT(me, test_ao<STRESS_EVENTS>, fsm);
+    const test_event *e = static_cast<const test_event *>(event);
+
+    if (t->inside.exchange(true))
+    {
+        violation.store(true);
+    }
+
+    if (t->next)
+    {
+        if (e->value > 0)
+        {
+            test_event next = make_event(e->value - 1, 0);
+
+            /* Every mailbox holds all tokens, so this cannot fail. */
+            if (!ecu_exec_ao_post(&t->next->ao, &next.base))
+            {
+                violation.store(true);
+            }
+        }
+    }
+    else
+    {
+        if (t->expected.at(e->producer) != e->value)
+        {
+            violation.store(true);
+        }
+
+        t->expected.at(e->producer)++;
+    }
+
+    t->count++;
+    t->inside.store(false);
+    dispatched.fetch_add(1);
+}
+
+const ecu_fsm_state FSM_STATE = ECU_FSM_STATE_CTOR(
+    &fsm_entry, ECU_FSM_STATE_EXIT_UNUSED, &fsm_handler
+);
+
+const ecu_hsm_state HSM_STATE = ECU_HSM_STATE_CTOR(
+    &hsm_entry, ECU_HSM_STATE_EXIT_UNUSED, ECU_HSM_STATE_INITIAL_UNUSED, &hsm_handler, &ECU_HSM_TOP_STATE
+);
+
+const ecu_fsm_state STRESS_STATE = ECU_FSM_STATE_CTOR(
+    ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED, &stress_handler
+);
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(Exec)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+        mock().strictOrder();
+        violation.store(false);
+        dispatched.store(0);
+
+        for (std::size_t i = 0; i < aos.size(); i++)
+        {
+            aos.at(i).id = static_cast<int>(i);
+            ecu_fsm_ctor(&aos.at(i).fsm, &FSM_STATE);
+            ecu_exec_ao_fsm_ctor(&aos.at(i).ao, &aos.at(i).fsm, &aos.at(i).buffer[0], sizeof(aos.at(i).buffer), sizeof(test_event));
+        }
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Constructs the executor with @p count workers.
+    void CTOR(std::size_t count, std::size_t budget)
+    {
+        ecu_exec_ctor(&exec, &workers[0], count, &deques[0], DEQUE, budget);
+    }
+
+    /// @brief Posts an event to object @p i and asserts it was queued.
+    void POST(std::size_t i, std::size_t value)
+    {
+        test_event e = make_event(value, 0);
+        CHECK_TRUE( (ecu_exec_ao_post(&aos.at(i).ao, &e.base)) );
+    }
+
+    /// @brief Expects object @p id to handle an event.
+    static void EXPECT_HANDLED(int id, std::size_t value)
+    {
+        mock().expectOneCall("handler").withParameter("id", id).withParameter("value", value);
+    }
+
+    /// @brief Maximum number of workers.
+    static constexpr std::size_t WORKERS{4};
+
+    /// @brief Deque capacity of each worker.
+    static constexpr std::size_t DEQUE{8};
+
+    /// @brief Executor under test.
+    ecu_exec exec;
+
+    /// @brief Workers of @ref exec.
+    std::array<ecu_exec_worker, WORKERS> workers;
+
+    /// @brief Deque memory of @ref workers.
+    std::array<ecu_exec_ao *, WORKERS * DEQUE> deques;
+
+    /// @brief Objects used in single-threaded tests.
+    std::array<test_ao<EVENTS>, 3> aos;
+};
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - CONSTRUCTORS -------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Not allowed. Deque capacity must be a power of two.
+ */
+TEST(Exec, CtorCapacityNotPowerOfTwo)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_exec_ctor(&exec, &workers[0], 1, &deques[0], 3, 1);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Object is already in an executor.
+ */
+TEST(Exec, AddTwice)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        CTOR(1, 1);
+        ecu_exec_add(&exec, &aos[0].ao);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_exec_add(&exec, &aos[0].ao);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Events posted before the object is added are
+ * dispatched once it is.
+ */
+TEST(Exec, PostBeforeAdd)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        CTOR(1, 4);
+        POST(0, 0);
+        CHECK_FALSE( (ecu_exec_run_once(&exec, 0)) );
+        EXPECT_HANDLED(0, 0);
+
+        /* Step 2: Action. */
+        ecu_exec_add(&exec, &aos[0].ao);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_FALSE( (ecu_exec_run_once(&exec, 0)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Mailbox capacity is rounded down to a power of two.
+ */
+TEST(Exec, AoCtorCapacityRoundedDown)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        alignas(8) std::uint8_t buffer[ECU_EXEC_SLOT_SIZE(sizeof(test_event)) * 7];
+        ecu_exec_ao ao;
+
+        /* Step 2: Action. */
+        ecu_exec_ao_fsm_ctor(&ao, &aos[0].fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+
+        /* Step 3: Assert. Six slots after the dispatch slot. */
+        UNSIGNED_LONGS_EQUAL(4, ecu_exec_ao_capacity(&ao));
+        UNSIGNED_LONGS_EQUAL(EVENTS, ecu_exec_ao_capacity(&aos[0].ao));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Buffer must hold a mailbox slot and
+ * the dispatch slot.
+ */
+TEST(Exec, AoCtorBufferTooSmall)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        alignas(8) std::uint8_t buffer[ECU_EXEC_SLOT_SIZE(sizeof(test_event))];
+        ecu_exec_ao ao;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_exec_ao_fsm_ctor(&ao, &aos[0].fsm, &buffer[0], sizeof(buffer), sizeof(test_event));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*---------------------- TESTS - POST ------------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Post fails once the mailbox is full and succeeds
+ * again once events are dispatched.
+ */
+TEST(Exec, PostFull)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        test_event e = make_event(0, 0);
+        CTOR(1, 1);
+        ecu_exec_add(&exec, &aos[0].ao);
+
+        for (std::size_t i = 0; i < EVENTS; i++)
+        {
+            POST(0, 0);
+        }
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_FALSE( (ecu_exec_ao_post(&aos[0].ao, &e.base)) );
+        EXPECT_HANDLED(0, 0);
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_TRUE( (ecu_exec_ao_post(&aos[0].ao, &e.base)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Event is larger than a slot.
+ */
+TEST(Exec, PostEventTooLarge)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        struct large_event
+        {
+            ecu_event base;
+            std::uint8_t data[64];
+        } e;
+        ecu_event_ctor(&e.base, ECU_USER_EVENT_ID_BEGIN, sizeof(e));
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_exec_ao_post(&aos[0].ao, &e.base);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - RUN ONCE ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Nothing is run if no object has events.
+ */
+TEST(Exec, RunOnceNoWork)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        CTOR(2, 1);
+        ecu_exec_add(&exec, &aos[0].ao);
+        ecu_exec_add(&exec, &aos[1].ao);
+
+        /* Steps 2 and 3: Action and assert. No mock calls expected. */
+        CHECK_FALSE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_FALSE( (ecu_exec_run_once(&exec, 1)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Events are dispatched in the order they were posted.
+ */
+TEST(Exec, RunOnceDispatchesInOrder)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        CTOR(1, EVENTS);
+        ecu_exec_add(&exec, &aos[0].ao);
+        test_event e1 = make_event(0, 1);
+        test_event e2 = make_event(0, 2);
+        POST(0, 0);
+        CHECK_TRUE( (ecu_exec_ao_post(&aos[0].ao, &e1.base)) );
+        CHECK_TRUE( (ecu_exec_ao_post(&aos[0].ao, &e2.base)) );
+        mock().expectNCalls(3, "handler").withParameter("id", 0).withParameter("value", 0);
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_FALSE( (ecu_exec_run_once(&exec, 0)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief At most budget events are dispatched per turn.
+ */
+TEST(Exec, RunOnceBudget)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        CTOR(1, 2);
+        ecu_exec_add(&exec, &aos[0].ao);
+        POST(0, 0);
+        POST(0, 0);
+        POST(0, 0);
+        EXPECT_HANDLED(0, 0);
+        EXPECT_HANDLED(0, 0);
+
+        /* Step 2: Action. */
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+
+        /* Step 3: Assert. */
+        mock().checkExpectations();
+        EXPECT_HANDLED(0, 0);
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_FALSE( (ecu_exec_run_once(&exec, 0)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Object that keeps posting to itself goes behind other
+ * scheduled objects once it uses up its budget.
+ */
+TEST(Exec, RunOnceBudgetTakesTurns)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        CTOR(1, 1);
+        ecu_exec_add(&exec, &aos[0].ao);
+        ecu_exec_add(&exec, &aos[1].ao);
+        POST(0, 2);
+        POST(1, 0);
+        EXPECT_HANDLED(0, 2);
+        EXPECT_HANDLED(1, 0);
+        EXPECT_HANDLED(0, 1);
+        EXPECT_HANDLED(0, 0);
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_FALSE( (ecu_exec_run_once(&exec, 0)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Events a handler posts to its own object are
+ * dispatched in the same turn if the budget allows.
+ */
+TEST(Exec, RunOnceHandlerPostsToSelf)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        CTOR(1, 8);
+        ecu_exec_add(&exec, &aos[0].ao);
+        POST(0, 3);
+        EXPECT_HANDLED(0, 3);
+        EXPECT_HANDLED(0, 2);
+        EXPECT_HANDLED(0, 1);
+        EXPECT_HANDLED(0, 0);
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_FALSE( (ecu_exec_run_once(&exec, 0)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Idle worker steals a scheduled object from a busy one.
+ */
+TEST(Exec, RunOnceSteal)
+{
+    try
+    {
+        /* Step 1: Arrange. Objects 0 and 2 share worker 0. */
+        CTOR(2, 1);
+        ecu_exec_add(&exec, &aos[0].ao);
+        ecu_exec_add(&exec, &aos[1].ao);
+        ecu_exec_add(&exec, &aos[2].ao);
+        POST(0, 0);
+        POST(2, 0);
+        EXPECT_HANDLED(0, 0);
+        EXPECT_HANDLED(2, 0);
+
+        /* Step 2: Action. Worker 0 moves both objects into its deque and runs one. */
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 1)) );
+        CHECK_FALSE( (ecu_exec_run_once(&exec, 0)) );
+        CHECK_FALSE( (ecu_exec_run_once(&exec, 1)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Hsm is started and posted events are dispatched to it.
+ */
+TEST(Exec, StartAndRunHsm)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_hsm hsm;
+        test_ao<EVENTS> t;
+        test_event e = make_event(7, 0);
+        CTOR(1, 1);
+        ecu_hsm_ctor(&hsm, &HSM_STATE, 1);
+        ecu_exec_ao_hsm_ctor(&t.ao, &hsm, &t.buffer[0], sizeof(t.buffer), sizeof(test_event));
+        ecu_exec_add(&exec, &t.ao);
+        mock().expectOneCall("entry").withParameter("id", 0);
+        EXPECT_HANDLED(0, 7);
+
+        /* Step 2: Action. */
+        ecu_exec_ao_start(&t.ao);
+        CHECK_TRUE( (ecu_exec_ao_post(&t.ao, &e.base)) );
+        CHECK_TRUE( (ecu_exec_run_once(&exec, 0)) );
+
+        /* Step 3: Assert. Done by mock expectations. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - STRESS TESTS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Producer threads post to many objects while every worker
+ * runs. No object is dispatched on two threads at once and each
+ * producer's events reach every object in the order they were posted.
+ */
+TEST(Exec, StressProducersAndWorkers)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        constexpr std::size_t OBJECTS = 32;
+        constexpr std::size_t PRODUCERS = 3;
+        constexpr std::size_t POSTS = 500;
+        std::vector<test_ao<STRESS_EVENTS>> objects(OBJECTS);
+        std::vector<std::thread> threads;
+        std::atomic<bool> go{false};
+        CTOR(WORKERS, 4);
+
+        for (auto& o : objects)
+        {
+            o.expected.assign(PRODUCERS, 0);
+            ecu_fsm_ctor(&o.fsm, &STRESS_STATE);
+            ecu_exec_ao_fsm_ctor(&o.ao, &o.fsm, &o.buffer[0], sizeof(o.buffer), sizeof(test_event));
+            ecu_exec_add(&exec, &o.ao);
+        }
+
+        /* Step 2: Action. */
+        for (std::size_t w = 0; w < WORKERS; w++)
+        {
+            threads.emplace_back([&, w]() {
+                while (dispatched.load() < (OBJECTS * PRODUCERS * POSTS))
+                {
+                    if (!ecu_exec_run_once(&exec, w))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (std::size_t p = 0; p < PRODUCERS; p++)
+        {
+            threads.emplace_back([&, p]() {
+                while (!go.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (std::size_t s = 0; s < POSTS; s++)
+                {
+                    for (auto& o : objects)
+                    {
+                        test_event e = make_event(s, p);
+
+                        while (!ecu_exec_ao_post(&o.ao, &e.base))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+            });
+        }
+
+        go.store(true, std::memory_order_release);
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        /* Step 3: Assert. */
+        CHECK_FALSE( (violation.load()) );
+
+        for (const auto& o : objects)
+        {
+            UNSIGNED_LONGS_EQUAL(PRODUCERS * POSTS, o.count);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Handlers pass tokens around a ring of objects while
+ * every worker runs. Every hop is dispatched exactly once and
+ * no object is dispatched on two threads at once.
+ */
+TEST(Exec, StressHandlersPostToEachOther)
+{
+    try
+    {
+        /* Step 1: Arrange. One token per object, so every mailbox
+        can hold all of them. */
+        constexpr std::size_t OBJECTS = STRESS_EVENTS;
+        constexpr std::size_t HOPS = 200;
+        std::vector<test_ao<STRESS_EVENTS>> objects(OBJECTS);
+        std::vector<std::thread> threads;
+        CTOR(WORKERS, 2);
+
+        for (std::size_t i = 0; i < OBJECTS; i++)
+        {
+            objects.at(i).next = &objects.at((i + 1) % OBJECTS);
+            ecu_fsm_ctor(&objects.at(i).fsm, &STRESS_STATE);
+            ecu_exec_ao_fsm_ctor(&objects.at(i).ao, &objects.at(i).fsm, &objects.at(i).buffer[0], sizeof(objects.at(i).buffer), sizeof(test_event));
+            ecu_exec_add(&exec, &objects.at(i).ao);
+        }
+
+        for (auto& o : objects)
+        {
+            test_event e = make_event(HOPS, 0);
+            CHECK_TRUE( (ecu_exec_ao_post(&o.ao, &e.base)) );
+        }
+
+        /* Step 2: Action. */
+        for (std::size_t w = 0; w < WORKERS; w++)
+        {
+            threads.emplace_back([&, w]() {
+                while (dispatched.load() < (OBJECTS * (HOPS + 1)))
+                {
+                    if (!ecu_exec_run_once(&exec, w))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        /* Step 3: Assert. */
+        CHECK_FALSE( (violation.load()) );
+        UNSIGNED_LONGS_EQUAL(OBJECTS * (HOPS + 1), dispatched.load());
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
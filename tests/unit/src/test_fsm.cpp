@@ -18,6 +18,16 @@
  *      - TEST(Fsm, DispatchSingleStateTransitionThenSelfTransitionOnFirstEntry)
  *      - TEST(Fsm, DispatchConsecutiveStateTransitionThenSelfTransitionOnSecondEntry)
  * 
+ * @ref ecu_fsm_dispatch_array()
+ *      - TEST(Fsm, DispatchArrayStateTransitionPerEvent)
+ *      - TEST(Fsm, DispatchArrayEventsInOrder)
+ *      - TEST(Fsm, DispatchArrayNoEvents)
+ *      - TEST(Fsm, DispatchArrayEventSizeZero)
+ * 
+ * @ref ecu_fsm_dispatch_list()
+ *      - TEST(Fsm, DispatchListEventsInOrder)
+ *      - TEST(Fsm, DispatchListEmpty)
+ * 
  * @ref ecu_fsm_change_state(), @ref ecu_fsm_start()
  *      - TEST(Fsm, StartStateHasNoHandler)
  *      - TEST(Fsm, StartNoTransition)
@@ -42,6 +52,7 @@
 
 /* STDLib. */
 #include <cassert>
+#include <cstddef>
 #include <type_traits>
 #include <vector>
 
@@ -879,6 +890,234 @@ TEST(Fsm, DispatchConsecutiveStateTransitionThenSelfTransitionOnSecondEntry)
     }
 }
 
+/*------------------------------------------------------------*/
+/*-------------- TESTS - ECU_FSM_DISPATCH_ARRAY --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Transitions are handled after every event, so each
+ * event is dispatched to the state the previous one entered.
+ *
+ * Expect: handler(S1) -> exit(S1) -> entry(S2) -> handler(S2) -> exit(S2) -> entry(S3) -> handler(S3)
+ */
+TEST(Fsm, DispatchArrayStateTransitionPerEvent)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const std::uint8_t events[3] = {0, 0, 0};
+
+        auto& state1 = state<S1>::get_instance()
+                                .with_handler_to<S2>()
+                                .with_exit()
+                                .with_entry();
+
+        auto& state2 = state<S2>::get_instance()
+                                .with_handler_to<S3>()
+                                .with_exit()
+                                .with_entry();
+
+        auto& state3 = state<S3>::get_instance()
+                                .with_handler()
+                                .with_exit()
+                                .with_entry();
+
+        EXPECT_STATE_PATH(state1.handled(), state1.exited(), state2.entered(),
+                          state2.handled(), state2.exited(), state3.entered(),
+                          state3.handled());
+
+        /* Step 2: Action. */
+        ecu_fsm_ctor(&me, &state1);
+        ecu_fsm_dispatch_array(&me, &events[0], 3, sizeof(events[0]));
+
+        /* Step 3: Assert. Fails if State Path was incorrect. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Every element is dispatched once, front to back,
+ * using the supplied element size.
+ */
+TEST(Fsm, DispatchArrayEventsInOrder)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        struct test_event
+        {
+            std::uint32_t value;
+            std::uint8_t padding[9];
+        };
+
+        static std::vector<std::uint32_t> received;
+        received.clear();
+
+        const test_event events[4] = {{1, {}}, {2, {}}, {3, {}}, {4, {}}};
+        static const ecu_fsm_state RECORD = ECU_FSM_STATE_CTOR(
+            ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED,
+            +[](ecu_fsm *, const void *e) { received.push_back(static_cast<const test_event *>(e)->value); }
+        );
+
+        /* Step 2: Action. */
+        ecu_fsm_ctor(&me, &RECORD);
+        ecu_fsm_dispatch_array(&me, &events[0], 4, sizeof(events[0]));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (received == std::vector<std::uint32_t>{1, 2, 3, 4}) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Dispatching 0 events does nothing.
+ */
+TEST(Fsm, DispatchArrayNoEvents)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        auto& state1 = state<S1>::get_instance()
+                                .with_handler_to<S2>()
+                                .with_exit()
+                                .with_entry();
+
+        mock().expectNoCall("handler");
+        mock().expectNoCall("exit");
+        mock().expectNoCall("entry");
+
+        /* Step 2: Action. */
+        ecu_fsm_ctor(&me, &state1);
+        ecu_fsm_dispatch_array(&me, &DUMMY_EVENT, 0, sizeof(DUMMY_EVENT));
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(&state1, me.state);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Element size must be greater than 0.
+ */
+TEST(Fsm, DispatchArrayEventSizeZero)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        auto& state1 = state<S1>::get_instance()
+                                .with_handler_no_mock();
+
+        ecu_fsm_ctor(&me, &state1);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_fsm_dispatch_array(&me, &DUMMY_EVENT, 1, 0);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*--------------- TESTS - ECU_FSM_DISPATCH_LIST --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Every event is dispatched once, front to back. Handler
+ * receives the event containing the node and reads its fields.
+ * The node is not the first member so handing the node itself
+ * to the handler is caught.
+ */
+TEST(Fsm, DispatchListEventsInOrder)
+{
+    struct listed_event
+    {
+        int value;
+        ecu_dnode node;
+    };
+
+    try
+    {
+        /* Step 1: Arrange. */
+        static std::vector<int> received;
+        received.clear();
+
+        ecu_dlist list;
+        listed_event events[3] = {{10, {}}, {20, {}}, {30, {}}};
+        static const ecu_fsm_state RECORD = ECU_FSM_STATE_CTOR(
+            ECU_FSM_STATE_ENTRY_UNUSED, ECU_FSM_STATE_EXIT_UNUSED,
+            +[](ecu_fsm *, const void *e) { received.push_back(static_cast<const listed_event *>(e)->value); }
+        );
+
+        ecu_dlist_ctor(&list);
+        for (auto& e : events)
+        {
+            ecu_dnode_ctor(&e.node, ECU_DNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+            ecu_dlist_push_back(&list, &e.node);
+        }
+
+        /* Step 2: Action. */
+        ecu_fsm_ctor(&me, &RECORD);
+        ecu_fsm_dispatch_list(&me, &list, offsetof(listed_event, node));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (received == std::vector<int>{10, 20, 30}) );
+        UNSIGNED_LONGS_EQUAL(3, ecu_dlist_size(&list));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Dispatching an empty list does nothing.
+ */
+TEST(Fsm, DispatchListEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist list;
+        auto& state1 = state<S1>::get_instance()
+                                .with_handler_to<S2>()
+                                .with_exit()
+                                .with_entry();
+
+        mock().expectNoCall("handler");
+        ecu_dlist_ctor(&list);
+
+        /* Step 2: Action. */
+        ecu_fsm_ctor(&me, &state1);
+        ecu_fsm_dispatch_list(&me, &list, 0);
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(&state1, me.state);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
 /*------------------------------------------------------------*/
 /*-------------------- TESTS - ECU_FSM_START -----------------*/
 /*------------------------------------------------------------*/
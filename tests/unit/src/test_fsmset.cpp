@@ -0,0 +1,823 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref fsmset.h.
+ * Test summary:
+ *
+ * @ref ECU_FSMSET_GET_CONTEXT()
+ *      - TEST(Fsmset, GetContext)
+ *
+ * @ref ecu_fsmset_ctor()
+ *      - TEST(Fsmset, CtorEveryInstanceInInitialState)
+ *      - TEST(Fsmset, CtorInitialStateOutOfRange)
+ *      - TEST(Fsmset, CtorStateHasNoHandler)
+ *      - TEST(Fsmset, CtorBufferTooSmall)
+ *
+ * @ref ecu_fsmset_start()
+ *      - TEST(Fsmset, StartRunsEntryOfEveryInstance)
+ *      - TEST(Fsmset, StartTransitionOnEntry)
+ *
+ * @ref ecu_fsmset_broadcast(), @ref ecu_fsmset_change_state()
+ *      - TEST(Fsmset, BroadcastGroupsInstancesByState)
+ *      - TEST(Fsmset, BroadcastStateTransition)
+ *      - TEST(Fsmset, BroadcastSelfTransition)
+ *      - TEST(Fsmset, BroadcastTransitionOnEntry)
+ *      - TEST(Fsmset, BroadcastTransitionOnExit)
+ *      - TEST(Fsmset, BroadcastSelfTransitionOnEntry)
+ *      - TEST(Fsmset, BroadcastChangeStateTwice)
+ *
+ * @ref ecu_fsmset_group(), @ref ecu_fsmset_run()
+ *      - TEST(Fsmset, RunSlicesVisitEveryInstanceOnce)
+ *      - TEST(Fsmset, RunSliceOutOfRange)
+ *      - TEST(Fsmset, StressSlicesOnThreads)
+ *
+ * Stress tests use std::thread and are meant to also be run under
+ * ThreadSanitizer (linux_tsan preset).
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/fsmset.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief Events dispatched to the sets under test.
+ */
+enum event_id
+{
+    STAY,       /* Every instance stays in its state. */
+    NEXT,       /* Every instance moves to the next state. */
+    ODD_NEXT,   /* Odd instances move to the next state. */
+    SELF        /* Every instance self-transitions. */
+};
+
+/**
+ * @brief Number of states in @ref STATES and @ref CHAIN_STATES.
+ */
+constexpr ecu_fsmset_state_t STATE_COUNT = 3;
+
+/**
+ * @brief Batches received by every handler, in order.
+ */
+std::vector<std::vector<std::size_t>> batches;
+
+/**
+ * @brief Entry handler that records it ran.
+ */
+template<int STATE>
+void on_entry(ecu_fsmset *me, std::size_t instance)
+{
+    (void)me;
+    mock().actualCall("entry").withParameter("state", STATE).withParameter("instance", static_cast<unsigned long>(instance));
+}
+
+/**
+ * @brief Exit handler that records it ran.
+ */
+template<int STATE>
+void on_exit(ecu_fsmset *me, std::size_t instance)
+{
+    (void)me;
+    mock().actualCall("exit").withParameter("state", STATE).withParameter("instance", static_cast<unsigned long>(instance));
+}
+
+/**
+ * @brief Handler that records every instance it processes and
+ * transitions them according to the event.
+ */
+template<int STATE>
+void on_event(ecu_fsmset *me, const std::size_t *instances, std::size_t count, const void *event)
+{
+    const event_id id = *static_cast<const event_id *>(event);
+    const auto next = static_cast<ecu_fsmset_state_t>((STATE + 1) % STATE_COUNT);
+    batches.emplace_back(instances, instances + count);
+
+    for (std::size_t k = 0; k < count; k++)
+    {
+        std::size_t i = instances[k];
+        CHECK_EQUAL(STATE, ecu_fsmset_current_state(me, i));
+        mock().actualCall("handler").withParameter("state", STATE).withParameter("instance", static_cast<unsigned long>(i));
+
+        if ((id == NEXT) || ((id == ODD_NEXT) && ((i % 2U) == 1U)))
+        {
+            ecu_fsmset_change_state(me, i, next);
+        }
+        else if (id == SELF)
+        {
+            ecu_fsmset_change_state(me, i, static_cast<ecu_fsmset_state_t>(STATE));
+        }
+    }
+}
+
+/**
+ * @brief Handler that transitions every instance twice. Not allowed.
+ */
+void change_twice(ecu_fsmset *me, const std::size_t *instances, std::size_t count, const void *event)
+{
+    (void)event;
+
+    for (std::size_t k = 0; k < count; k++)
+    {
+        ecu_fsmset_change_state(me, instances[k], 1);
+        ecu_fsmset_change_state(me, instances[k], 2);
+    }
+}
+
+/**
+ * @brief Entry handler that immediately transitions to state 2.
+ */
+void entry_then_transition(ecu_fsmset *me, std::size_t instance)
+{
+    on_entry<1>(me, instance);
+    ecu_fsmset_change_state(me, instance, 2);
+}
+
+/**
+ * @brief Entry handler that self-transitions. Not allowed.
+ */
+void entry_then_self_transition(ecu_fsmset *me, std::size_t instance)
+{
+    on_entry<1>(me, instance);
+    ecu_fsmset_change_state(me, instance, 1);
+}
+
+/**
+ * @brief Exit handler that transitions. Not allowed.
+ */
+void exit_then_transition(ecu_fsmset *me, std::size_t instance)
+{
+    on_exit<0>(me, instance);
+    ecu_fsmset_change_state(me, instance, 0);
+}
+
+/**
+ * @brief States 0 -> 1 -> 2 -> 0 with every handler recorded.
+ */
+const ecu_fsmset_state STATES[STATE_COUNT] = {
+    ECU_FSMSET_STATE_CTOR(&on_entry<0>, &on_exit<0>, &on_event<0>),
+    ECU_FSMSET_STATE_CTOR(&on_entry<1>, &on_exit<1>, &on_event<1>),
+    ECU_FSMSET_STATE_CTOR(&on_entry<2>, &on_exit<2>, &on_event<2>)
+};
+
+/**
+ * @brief State 1's entry handler transitions to state 2.
+ */
+const ecu_fsmset_state CHAIN_STATES[STATE_COUNT] = {
+    ECU_FSMSET_STATE_CTOR(&on_entry<0>, &on_exit<0>, &on_event<0>),
+    ECU_FSMSET_STATE_CTOR(&entry_then_transition, &on_exit<1>, &on_event<1>),
+    ECU_FSMSET_STATE_CTOR(&on_entry<2>, ECU_FSMSET_STATE_EXIT_UNUSED, &on_event<2>)
+};
+
+/**
+ * @brief Handlers that break the transition rules.
+ */
+const ecu_fsmset_state BAD_STATES[STATE_COUNT] = {
+    ECU_FSMSET_STATE_CTOR(ECU_FSMSET_STATE_ENTRY_UNUSED, &exit_then_transition, &on_event<0>),
+    ECU_FSMSET_STATE_CTOR(&entry_then_self_transition, ECU_FSMSET_STATE_EXIT_UNUSED, &on_event<1>),
+    ECU_FSMSET_STATE_CTOR(ECU_FSMSET_STATE_ENTRY_UNUSED, ECU_FSMSET_STATE_EXIT_UNUSED, &change_twice)
+};
+
+/**
+ * @brief Per-instance counters of the stress test. Handlers only
+ * touch counters of their own instances.
+ */
+std::vector<std::uint32_t> visits;
+
+/**
+ * @brief Stress handler. Counts the visit and moves every third
+ * visit to the next state so groups keep changing.
+ */
+template<int STATE>
+void stress_event(ecu_fsmset *me, const std::size_t *instances, std::size_t count, const void *event)
+{
+    (void)event;
+
+    for (std::size_t k = 0; k < count; k++)
+    {
+        std::size_t i = instances[k];
+
+        if ((++visits[i] % 3U) == 0)
+        {
+            ecu_fsmset_change_state(me, i, static_cast<ecu_fsmset_state_t>((STATE + 1) % STATE_COUNT));
+        }
+    }
+}
+
+/**
+ * @brief States of the stress test.
+ */
+const ecu_fsmset_state STRESS_STATES[STATE_COUNT] = {
+    ECU_FSMSET_STATE_CTOR(ECU_FSMSET_STATE_ENTRY_UNUSED, ECU_FSMSET_STATE_EXIT_UNUSED, &stress_event<0>),
+    ECU_FSMSET_STATE_CTOR(ECU_FSMSET_STATE_ENTRY_UNUSED, ECU_FSMSET_STATE_EXIT_UNUSED, &stress_event<1>),
+    ECU_FSMSET_STATE_CTOR(ECU_FSMSET_STATE_ENTRY_UNUSED, ECU_FSMSET_STATE_EXIT_UNUSED, &stress_event<2>)
+};
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(Fsmset)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+        mock().strictOrder();
+        batches.clear();
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Expects an entry handler to run for @p instance.
+    static void EXPECT_ENTRY(int state, std::size_t instance)
+    {
+        mock().expectOneCall("entry").withParameter("state", state).withParameter("instance", static_cast<unsigned long>(instance));
+    }
+
+    /// @brief Expects an exit handler to run for @p instance.
+    static void EXPECT_EXIT(int state, std::size_t instance)
+    {
+        mock().expectOneCall("exit").withParameter("state", state).withParameter("instance", static_cast<unsigned long>(instance));
+    }
+
+    /// @brief Expects a main handler to run for @p instance.
+    static void EXPECT_HANDLER(int state, std::size_t instance)
+    {
+        mock().expectOneCall("handler").withParameter("state", state).withParameter("instance", static_cast<unsigned long>(instance));
+    }
+
+    /// @brief Number of instances in @ref me.
+    static constexpr std::size_t INSTANCES = 6;
+
+    /// @brief Memory of @ref me. Offset by one byte in some tests
+    /// to check misaligned buffers.
+    alignas(std::size_t) std::uint8_t buffer[ECU_FSMSET_BUFFER_SIZE(INSTANCES, STATE_COUNT) + 1];
+
+    /// @brief Set under test.
+    ecu_fsmset me;
+};
+
+/*------------------------------------------------------------*/
+/*---------------- TESTS - ECU_FSMSET_GET_CONTEXT ------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Convert intrusive set into application type.
+ * Verifies returned pointer points to start of user's type.
+ */
+TEST(Fsmset, GetContext)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        struct app_t
+        {
+            std::uint8_t a;
+            ecu_fsmset set;
+            int b;
+        } app;
+
+        /* Step 2: Action. */
+        app_t *app_ptr = ECU_FSMSET_GET_CONTEXT(&app.set, app_t, set);
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(&app, app_ptr);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - ECU_FSMSET_CTOR ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Every instance starts in the initial state. Buffer
+ * does not have to be aligned.
+ */
+TEST(Fsmset, CtorEveryInstanceInInitialState)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        mock().expectNoCall("entry");
+
+        /* Step 2: Action. */
+        ecu_fsmset_ctor(&me, &STATES[0], STATE_COUNT, 2, &buffer[1], sizeof(buffer) - 1, INSTANCES);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(INSTANCES, ecu_fsmset_count(&me));
+
+        for (std::size_t i = 0; i < INSTANCES; i++)
+        {
+            UNSIGNED_LONGS_EQUAL(2, ecu_fsmset_current_state(&me, i));
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Initial state must be in the state array.
+ */
+TEST(Fsmset, CtorInitialStateOutOfRange)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_fsmset_ctor(&me, &STATES[0], STATE_COUNT, STATE_COUNT, &buffer[0], sizeof(buffer), INSTANCES);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. All states must have a handler.
+ */
+TEST(Fsmset, CtorStateHasNoHandler)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const ecu_fsmset_state states[2] = {
+            ECU_FSMSET_STATE_CTOR(&on_entry<0>, &on_exit<0>, &on_event<0>),
+            ECU_FSMSET_STATE_CTOR(&on_entry<1>, &on_exit<1>, nullptr)
+        };
+
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_fsmset_ctor(&me, &states[0], 2, 0, &buffer[0], sizeof(buffer), INSTANCES);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Buffer must hold every instance.
+ */
+TEST(Fsmset, CtorBufferTooSmall)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_fsmset_ctor(&me, &STATES[0], STATE_COUNT, 0, &buffer[0], sizeof(buffer), INSTANCES + 1);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - ECU_FSMSET_START ---------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Initial state's entry handler runs once per instance.
+ */
+TEST(Fsmset, StartRunsEntryOfEveryInstance)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_fsmset_ctor(&me, &STATES[0], STATE_COUNT, 1, &buffer[0], sizeof(buffer), INSTANCES);
+
+        for (std::size_t i = 0; i < INSTANCES; i++)
+        {
+            EXPECT_ENTRY(1, i);
+        }
+
+        /* Step 2: Action. */
+        ecu_fsmset_start(&me);
+
+        /* Step 3: Assert. Fails if handlers did not run in order. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Transition in initial entry handler. Same as ecu_fsm_start().
+ *
+ * Expect for every instance: entry(1) -> exit(1) -> entry(2)
+ */
+TEST(Fsmset, StartTransitionOnEntry)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_fsmset_ctor(&me, &CHAIN_STATES[0], STATE_COUNT, 1, &buffer[0], sizeof(buffer), 2);
+        EXPECT_ENTRY(1, 0);
+        EXPECT_EXIT(1, 0);
+        EXPECT_ENTRY(2, 0);
+        EXPECT_ENTRY(1, 1);
+        EXPECT_EXIT(1, 1);
+        EXPECT_ENTRY(2, 1);
+
+        /* Step 2: Action. */
+        ecu_fsmset_start(&me);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(2, ecu_fsmset_current_state(&me, 0));
+        UNSIGNED_LONGS_EQUAL(2, ecu_fsmset_current_state(&me, 1));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------- TESTS - ECU_FSMSET_BROADCAST -------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Each state's handler runs once on all of its instances,
+ * in ascending order. Instances that moved into a later state
+ * during the broadcast do not receive the event twice.
+ */
+TEST(Fsmset, BroadcastGroupsInstancesByState)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const event_id odd_next = ODD_NEXT;
+        const event_id stay = STAY;
+        ecu_fsmset_ctor(&me, &STATES[0], STATE_COUNT, 0, &buffer[0], sizeof(buffer), INSTANCES);
+        mock().disable();
+
+        /* Step 2: Action. */
+        ecu_fsmset_broadcast(&me, &odd_next);
+        ecu_fsmset_broadcast(&me, &stay);
+
+        /* Step 3: Assert. */
+        mock().enable();
+        CHECK_TRUE( (batches.size() == 3) );
+        CHECK_TRUE( (batches[0] == std::vector<std::size_t>{0, 1, 2, 3, 4, 5}) );
+        CHECK_TRUE( (batches[1] == std::vector<std::size_t>{0, 2, 4}) );
+        CHECK_TRUE( (batches[2] == std::vector<std::size_t>{1, 3, 5}) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Every instance transitions. Exit and entry run per
+ * instance once the batch's handler returns.
+ *
+ * Expect: handler(0, 0) -> handler(0, 1) -> exit(0, 0) -> entry(1, 0) -> exit(0, 1) -> entry(1, 1)
+ */
+TEST(Fsmset, BroadcastStateTransition)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const event_id next = NEXT;
+        ecu_fsmset_ctor(&me, &STATES[0], STATE_COUNT, 0, &buffer[0], sizeof(buffer), 2);
+        EXPECT_HANDLER(0, 0);
+        EXPECT_HANDLER(0, 1);
+        EXPECT_EXIT(0, 0);
+        EXPECT_ENTRY(1, 0);
+        EXPECT_EXIT(0, 1);
+        EXPECT_ENTRY(1, 1);
+
+        /* Step 2: Action. */
+        ecu_fsmset_broadcast(&me, &next);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(1, ecu_fsmset_current_state(&me, 0));
+        UNSIGNED_LONGS_EQUAL(1, ecu_fsmset_current_state(&me, 1));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Self-transition exits and re-enters the state.
+ *
+ * Expect: handler(2, 0) -> exit(2, 0) -> entry(2, 0)
+ */
+TEST(Fsmset, BroadcastSelfTransition)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const event_id self = SELF;
+        ecu_fsmset_ctor(&me, &STATES[0], STATE_COUNT, 2, &buffer[0], sizeof(buffer), 1);
+        EXPECT_HANDLER(2, 0);
+        EXPECT_EXIT(2, 0);
+        EXPECT_ENTRY(2, 0);
+
+        /* Step 2: Action. */
+        ecu_fsmset_broadcast(&me, &self);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(2, ecu_fsmset_current_state(&me, 0));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Consecutive transition through an entry handler.
+ *
+ * Expect: handler(0, 0) -> exit(0, 0) -> entry(1, 0) -> exit(1, 0) -> entry(2, 0)
+ */
+TEST(Fsmset, BroadcastTransitionOnEntry)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const event_id next = NEXT;
+        ecu_fsmset_ctor(&me, &CHAIN_STATES[0], STATE_COUNT, 0, &buffer[0], sizeof(buffer), 1);
+        EXPECT_HANDLER(0, 0);
+        EXPECT_EXIT(0, 0);
+        EXPECT_ENTRY(1, 0);
+        EXPECT_EXIT(1, 0);
+        EXPECT_ENTRY(2, 0);
+
+        /* Step 2: Action. */
+        ecu_fsmset_broadcast(&me, &next);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(2, ecu_fsmset_current_state(&me, 0));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Exit handlers cannot transition.
+ */
+TEST(Fsmset, BroadcastTransitionOnExit)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const event_id next = NEXT;
+        ecu_fsmset_ctor(&me, &BAD_STATES[0], STATE_COUNT, 0, &buffer[0], sizeof(buffer), 1);
+        EXPECT_HANDLER(0, 0);
+        EXPECT_EXIT(0, 0);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_fsmset_broadcast(&me, &next);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Entry handlers cannot self-transition.
+ */
+TEST(Fsmset, BroadcastSelfTransitionOnEntry)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_fsmset_ctor(&me, &BAD_STATES[0], STATE_COUNT, 1, &buffer[0], sizeof(buffer), 1);
+        EXPECT_ENTRY(1, 0);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_fsmset_start(&me);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. One transition per instance per event.
+ */
+TEST(Fsmset, BroadcastChangeStateTwice)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const event_id stay = STAY;
+        ecu_fsmset_ctor(&me, &BAD_STATES[0], STATE_COUNT, 2, &buffer[0], sizeof(buffer), 1);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_fsmset_broadcast(&me, &stay);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*---------------------- TESTS - ECU_FSMSET_RUN --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Slices split every group. Together they visit every
+ * instance exactly once, even when there are more slices than
+ * instances in a group.
+ */
+TEST(Fsmset, RunSlicesVisitEveryInstanceOnce)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const event_id odd_next = ODD_NEXT;
+        const event_id stay = STAY;
+        std::vector<unsigned> seen(INSTANCES, 0);
+        ecu_fsmset_ctor(&me, &STATES[0], STATE_COUNT, 0, &buffer[0], sizeof(buffer), INSTANCES);
+        mock().disable();
+        ecu_fsmset_broadcast(&me, &odd_next);
+        batches.clear();
+
+        /* Step 2: Action. Groups have 3 instances each, split into 4 slices. */
+        ecu_fsmset_group(&me);
+        for (std::size_t s = 0; s < 4; s++)
+        {
+            ecu_fsmset_run(&me, &stay, s, 4);
+        }
+
+        /* Step 3: Assert. */
+        mock().enable();
+        for (const auto& batch : batches)
+        {
+            CHECK_TRUE( (!batch.empty()) );
+            for (std::size_t i : batch)
+            {
+                seen[i]++;
+            }
+        }
+
+        CHECK_TRUE( (seen == std::vector<unsigned>(INSTANCES, 1)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Slice must be less than the number of slices.
+ */
+TEST(Fsmset, RunSliceOutOfRange)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const event_id stay = STAY;
+        ecu_fsmset_ctor(&me, &STATES[0], STATE_COUNT, 0, &buffer[0], sizeof(buffer), INSTANCES);
+        ecu_fsmset_group(&me);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_fsmset_run(&me, &stay, 2, 2);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Slices run on separate threads for many broadcasts.
+ * Every instance must be visited once per broadcast and end in
+ * the state its visit count implies.
+ */
+TEST(Fsmset, StressSlicesOnThreads)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        constexpr std::size_t COUNT = 5000;
+        constexpr std::size_t THREADS = 4;
+        constexpr std::uint32_t BROADCASTS = 50;
+        const event_id stay = STAY;
+        std::vector<std::uint8_t> memory(ECU_FSMSET_BUFFER_SIZE(COUNT, STATE_COUNT));
+        ecu_fsmset set;
+
+        visits.assign(COUNT, 0);
+        ecu_fsmset_ctor(&set, &STRESS_STATES[0], STATE_COUNT, 0, memory.data(), memory.size(), COUNT);
+
+        /* Step 2: Action. */
+        for (std::uint32_t b = 0; b < BROADCASTS; b++)
+        {
+            std::vector<std::thread> pool;
+            ecu_fsmset_group(&set);
+
+            for (std::size_t t = 0; t < THREADS; t++)
+            {
+                pool.emplace_back([&set, &stay, t]() { ecu_fsmset_run(&set, &stay, t, THREADS); });
+            }
+
+            for (auto& t : pool)
+            {
+                t.join();
+            }
+        }
+
+        /* Step 3: Assert. */
+        for (std::size_t i = 0; i < COUNT; i++)
+        {
+            UNSIGNED_LONGS_EQUAL(BROADCASTS, visits[i]);
+            UNSIGNED_LONGS_EQUAL((BROADCASTS / 3U) % STATE_COUNT, ecu_fsmset_current_state(&set, i));
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
@@ -65,6 +65,12 @@
  * HsmVariant1 - Misc
  *      - TEST(Hsm, HsmVariant1DispatchMultipleEvents)
  * 
+ * @ref ecu_hsm_dispatch_array(), @ref ecu_hsm_dispatch_list()
+ *      - TEST(Hsm, HsmVariant1DispatchArrayMultipleEvents)
+ *      - TEST(Hsm, HsmVariant1DispatchArrayNotStarted)
+ *      - TEST(Hsm, HsmVariant1DispatchListMultipleEvents)
+ *      - TEST(Hsm, HsmVariant1DispatchListEmpty)
+ * 
  * @author Ian Ress
  * @version 0.1
  * @date 2025-05-12
@@ -77,6 +83,7 @@
 
 /* STDLib. */
 #include <cassert>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -2419,3 +2426,157 @@ TEST(Hsm, HsmVariant1DispatchMultipleEvents)
         (void)e;
     }
 }
+
+/*------------------------------------------------------------*/
+/*-------------- TESTS - ecu_hsm_dispatch_array() ------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Same sequence as HsmVariant1DispatchMultipleEvents
+ * dispatched in one batch. State path must be identical.
+ */
+TEST(Hsm, HsmVariant1DispatchArrayMultipleEvents)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const event events[] = {EVENT_I, EVENT_I, EVENT_A, EVENT_G, EVENT_G, DUMMY_EVENT,
+                                EVENT_E, EVENT_D, EVENT_D, EVENT_D, EVENT_E, EVENT_C};
+        hsm_variant1 me;
+        me.start_s211_no_mock();
+        EXPECT_STATE_PATH(handled<S211>(), handled<S21>(), handled<S2>(), /* In S211. I */
+                          handled<S211>(), handled<S21>(), handled<S2>(), handled<S>(), /* In S211. I */
+                          handled<S211>(), handled<S21>(), exited<S211>(), exited<S21>(), entered<S21>(), init<S21>(), entered<S211>(), /* In S211. A */
+                          handled<S211>(), handled<S21>(), exited<S211>(), exited<S21>(), exited<S2>(), entered<S1>(), init<S1>(), entered<S11>(), /* In S211. G */
+                          handled<S11>(), exited<S11>(), exited<S1>(), entered<S2>(), entered<S21>(), entered<S211>(), /* In S11. G */
+                          handled<S211>(), handled<S21>(), handled<S2>(), handled<S>(), /* In S211. DUMMY_EVENT */
+                          handled<S211>(), handled<S21>(), handled<S2>(), handled<S>(), exited<S211>(), exited<S21>(), exited<S2>(), entered<S1>(), entered<S11>(), /* In S211. E */
+                          handled<S11>(), handled<S1>(), exited<S11>(), exited<S1>(), init<S>(), entered<S1>(), entered<S11>(), /* In S11. D */
+                          handled<S11>(), exited<S11>(), init<S1>(), entered<S11>(), /* In S11. D */
+                          handled<S11>(), handled<S1>(), exited<S11>(), exited<S1>(), init<S>(), entered<S1>(), entered<S11>(), /* In S11. D */
+                          handled<S11>(), handled<S1>(), handled<S>(), exited<S11>(), exited<S1>(), entered<S1>(), entered<S11>(), /* In S11. E. */
+                          handled<S11>(), handled<S1>(), exited<S11>(), exited<S1>(), entered<S2>(), init<S2>(), entered<S21>(), entered<S211>() /* In S11. C */);
+
+        /* Step 2: Action. */
+        ecu_hsm_dispatch_array(&me, &events[0], sizeof(events) / sizeof(events[0]), sizeof(events[0]));
+
+        /* Step 3: Assert. Test fails if expected state path not taken. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Hsm must be in a leaf state, which
+ * is only guaranteed once it is started.
+ */
+TEST(Hsm, HsmVariant1DispatchArrayNotStarted)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        hsm_variant1 me;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_hsm_dispatch_array(&me, &EVENT_A, 1, sizeof(EVENT_A));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------- TESTS - ecu_hsm_dispatch_list() -------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Same sequence as HsmVariant1DispatchArrayMultipleEvents
+ * linked in a list. Handlers read the event containing each node.
+ * The node is not the first member so handing the node itself to
+ * the handlers is caught.
+ */
+TEST(Hsm, HsmVariant1DispatchListMultipleEvents)
+{
+    struct listed_event
+    {
+        event signal;
+        ecu_dnode node;
+    };
+
+    try
+    {
+        /* Step 1: Arrange. */
+        const event signals[] = {EVENT_I, EVENT_I, EVENT_A, EVENT_G, EVENT_G, DUMMY_EVENT,
+                                 EVENT_E, EVENT_D, EVENT_D, EVENT_D, EVENT_E, EVENT_C};
+        listed_event events[sizeof(signals) / sizeof(signals[0])];
+        ecu_dlist list;
+        hsm_variant1 me;
+        me.start_s211_no_mock();
+        ecu_dlist_ctor(&list);
+
+        for (std::size_t i = 0; i < (sizeof(signals) / sizeof(signals[0])); i++)
+        {
+            events[i].signal = signals[i];
+            ecu_dnode_ctor(&events[i].node, ECU_DNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+            ecu_dlist_push_back(&list, &events[i].node);
+        }
+
+        EXPECT_STATE_PATH(handled<S211>(), handled<S21>(), handled<S2>(), /* In S211. I */
+                          handled<S211>(), handled<S21>(), handled<S2>(), handled<S>(), /* In S211. I */
+                          handled<S211>(), handled<S21>(), exited<S211>(), exited<S21>(), entered<S21>(), init<S21>(), entered<S211>(), /* In S211. A */
+                          handled<S211>(), handled<S21>(), exited<S211>(), exited<S21>(), exited<S2>(), entered<S1>(), init<S1>(), entered<S11>(), /* In S211. G */
+                          handled<S11>(), exited<S11>(), exited<S1>(), entered<S2>(), entered<S21>(), entered<S211>(), /* In S11. G */
+                          handled<S211>(), handled<S21>(), handled<S2>(), handled<S>(), /* In S211. DUMMY_EVENT */
+                          handled<S211>(), handled<S21>(), handled<S2>(), handled<S>(), exited<S211>(), exited<S21>(), exited<S2>(), entered<S1>(), entered<S11>(), /* In S211. E */
+                          handled<S11>(), handled<S1>(), exited<S11>(), exited<S1>(), init<S>(), entered<S1>(), entered<S11>(), /* In S11. D */
+                          handled<S11>(), exited<S11>(), init<S1>(), entered<S11>(), /* In S11. D */
+                          handled<S11>(), handled<S1>(), exited<S11>(), exited<S1>(), init<S>(), entered<S1>(), entered<S11>(), /* In S11. D */
+                          handled<S11>(), handled<S1>(), handled<S>(), exited<S11>(), exited<S1>(), entered<S1>(), entered<S11>(), /* In S11. E. */
+                          handled<S11>(), handled<S1>(), exited<S11>(), exited<S1>(), entered<S2>(), init<S2>(), entered<S21>(), entered<S211>() /* In S11. C */);
+
+        /* Step 2: Action. */
+        ecu_hsm_dispatch_list(&me, &list, offsetof(listed_event, node));
+
+        /* Step 3: Assert. Test fails if expected state path not taken. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Dispatching an empty list does nothing.
+ */
+TEST(Hsm, HsmVariant1DispatchListEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_dlist list;
+        hsm_variant1 me;
+        me.start_s211_no_mock();
+        ecu_dlist_ctor(&list);
+        mock().expectNoCall("handled");
+
+        /* Step 2: Action. */
+        ecu_hsm_dispatch_list(&me, &list, 0);
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(state_S211, me.state);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
@@ -0,0 +1,631 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref mpsc.h.
+ * Test summary:
+ *
+ * @ref ecu_mpsc_push(), @ref ecu_mpsc_pop()
+ *      - TEST(Mpsc, PushPopFIFOOrder)
+ *      - TEST(Mpsc, PopEmptyQueue)
+ *      - TEST(Mpsc, PopLastNodeThenPushAgain)
+ *      - TEST(Mpsc, PoppedNodeReusable)
+ *      - TEST(Mpsc, PushNodeInList)
+ *      - TEST(Mpsc, QueuedNodeCannotBeUsedByDList)
+ *      - TEST(Mpsc, GetEntry)
+ *
+ * @ref ecu_mpsc_empty()
+ *      - TEST(Mpsc, Empty)
+ *
+ * @ref ecu_mpsc_drain()
+ *      - TEST(Mpsc, DrainFIFOOrder)
+ *      - TEST(Mpsc, DrainKeepsExistingListNodes)
+ *      - TEST(Mpsc, DrainEmptyQueue)
+ *
+ * Concurrency stress tests. Build with the linux_tsan preset to also
+ * run these under ThreadSanitizer:
+ *      - TEST(Mpsc, StressMultiProducerPop)
+ *      - TEST(Mpsc, StressMultiProducerDrain)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/mpsc.h"
+
+/* STDLib. */
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief User-defined type that embeds an @ref ecu_dnode.
+ * Used to verify nodes are retrieved with @ref ECU_DNODE_GET_ENTRY().
+ */
+struct work_item
+{
+    /// @brief Default constructor.
+    work_item()
+    {
+        ecu_dnode_ctor(&dnode, ECU_DNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+    }
+
+    /// @brief Producer that pushed this item.
+    std::size_t producer{0};
+
+    /// @brief Order this item was pushed in by its producer.
+    std::size_t sequence{0};
+
+    /// @brief Intrusive node placed in the queue.
+    ecu_dnode dnode;
+};
+
+/**
+ * @brief C++ wrapper around C structure under test (@ref ecu_mpsc).
+ */
+struct mpsc : public ecu_mpsc
+{
+    /// @brief Default constructor.
+    mpsc()
+    {
+        ecu_mpsc_ctor(this);
+    }
+};
+
+/**
+ * @brief C++ wrapper around @ref ecu_dlist that the queue is drained into.
+ */
+struct dlist : public ecu_dlist
+{
+    /// @brief Default constructor.
+    dlist()
+    {
+        ecu_dlist_ctor(this);
+    }
+};
+
+/**
+ * @brief Returns the work item a popped node belongs to.
+ */
+work_item& entry(ecu_dnode *n)
+{
+    assert( (n) );
+    return *ECU_DNODE_GET_ENTRY(n, work_item, dnode);
+}
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(Mpsc)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+
+        for (std::size_t i = 0; i < ITEMS.size(); i++)
+        {
+            ITEMS.at(i).sequence = i;
+        }
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Verifies each producer's items were received in the order they were
+    /// pushed, and that every item was received exactly once.
+    ///
+    /// @param received Items in the order the consumer received them.
+    /// @param producers Number of producers used in the test.
+    /// @param items_per_producer Number of items each producer pushed.
+    static void CHECK_PER_PRODUCER_FIFO(const std::vector<const work_item *>& received,
+                                        std::size_t producers,
+                                        std::size_t items_per_producer)
+    {
+        std::vector<std::size_t> expected(producers, 0);
+        UNSIGNED_LONGS_EQUAL(producers * items_per_producer, received.size());
+
+        for (const work_item *item : received)
+        {
+            CHECK_TRUE( (item->producer < producers) );
+            UNSIGNED_LONGS_EQUAL(expected.at(item->producer), item->sequence);
+            expected.at(item->producer)++;
+        }
+    }
+
+    /// @brief Number of producer threads in stress tests.
+    static constexpr std::size_t PRODUCERS{4};
+
+    /// @brief Number of items each producer pushes in stress tests.
+    static constexpr std::size_t ITEMS_PER_PRODUCER{20000};
+
+    /// @brief Queue under test.
+    mpsc queue;
+
+    /// @brief Items pushed in single-threaded tests. Sequence
+    /// set to array index.
+    std::array<work_item, 10> ITEMS;
+};
+
+/*------------------------------------------------------------*/
+/*------------------ TESTS - PUSH AND POP --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Nodes are popped in the order they were pushed.
+ */
+TEST(Mpsc, PushPopFIFOOrder)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        for (auto& i : ITEMS)
+        {
+            ecu_mpsc_push(&queue, &i.dnode);
+        }
+
+        /* Steps 2 and 3: Action and assert. */
+        for (auto& i : ITEMS)
+        {
+            POINTERS_EQUAL(&i.dnode, ecu_mpsc_pop(&queue));
+        }
+
+        POINTERS_EQUAL(nullptr, ecu_mpsc_pop(&queue));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief NULL returned when popping an empty queue.
+ */
+TEST(Mpsc, PopEmptyQueue)
+{
+    try
+    {
+        /* Steps 1, 2, and 3: Arrange, action, and assert. */
+        POINTERS_EQUAL(nullptr, ecu_mpsc_pop(&queue));
+        POINTERS_EQUAL(nullptr, ecu_mpsc_pop(&queue));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Popping the only node in the queue requires the
+ * internal stub to be re-pushed. Verify queue remains usable
+ * afterwards.
+ */
+TEST(Mpsc, PopLastNodeThenPushAgain)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_mpsc_push(&queue, &ITEMS.at(0).dnode);
+
+        /* Steps 2 and 3: Action and assert. */
+        POINTERS_EQUAL(&ITEMS.at(0).dnode, ecu_mpsc_pop(&queue));
+        POINTERS_EQUAL(nullptr, ecu_mpsc_pop(&queue));
+        ecu_mpsc_push(&queue, &ITEMS.at(1).dnode);
+        ecu_mpsc_push(&queue, &ITEMS.at(2).dnode);
+        POINTERS_EQUAL(&ITEMS.at(1).dnode, ecu_mpsc_pop(&queue));
+        POINTERS_EQUAL(&ITEMS.at(2).dnode, ecu_mpsc_pop(&queue));
+        POINTERS_EQUAL(nullptr, ecu_mpsc_pop(&queue));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Popped node is a valid node that is not in
+ * a list. It can be added to a list or pushed again.
+ */
+TEST(Mpsc, PoppedNodeReusable)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist list;
+        ecu_mpsc_push(&queue, &ITEMS.at(0).dnode);
+
+        /* Step 2: Action. */
+        ecu_dnode *n = ecu_mpsc_pop(&queue);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (ecu_dnode_valid(n)) );
+        CHECK_FALSE( (ecu_dnode_in_list(n)) );
+        ecu_dlist_push_back(&list, n);
+        ecu_dnode_remove(n);
+        ecu_mpsc_push(&queue, n);
+        POINTERS_EQUAL(n, ecu_mpsc_pop(&queue));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Node cannot be pushed while it is
+ * in a list.
+ */
+TEST(Mpsc, PushNodeInList)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist list;
+        ecu_dlist_push_back(&list, &ITEMS.at(0).dnode);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_mpsc_push(&queue, &ITEMS.at(0).dnode);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Node is owned by the queue until
+ * it is popped. Passing it into dnode or dlist functions
+ * asserts.
+ */
+TEST(Mpsc, QueuedNodeCannotBeUsedByDList)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist list;
+        ecu_mpsc_push(&queue, &ITEMS.at(0).dnode);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_dlist_push_back(&list, &ITEMS.at(0).dnode);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Popped nodes are converted back into the
+ * user's type with @ref ECU_DNODE_GET_ENTRY().
+ */
+TEST(Mpsc, GetEntry)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_mpsc_push(&queue, &ITEMS.at(3).dnode);
+
+        /* Step 2: Action. */
+        work_item& item = entry(ecu_mpsc_pop(&queue));
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(&ITEMS.at(3), &item);
+        UNSIGNED_LONGS_EQUAL(3, item.sequence);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------------- TESTS - EMPTY ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Queue is only empty when every pushed node
+ * has been popped.
+ */
+TEST(Mpsc, Empty)
+{
+    try
+    {
+        /* Steps 1, 2, and 3: Arrange, action, and assert. */
+        CHECK_TRUE( (ecu_mpsc_empty(&queue)) );
+        ecu_mpsc_push(&queue, &ITEMS.at(0).dnode);
+        CHECK_FALSE( (ecu_mpsc_empty(&queue)) );
+        ecu_mpsc_push(&queue, &ITEMS.at(1).dnode);
+        (void)ecu_mpsc_pop(&queue);
+        CHECK_FALSE( (ecu_mpsc_empty(&queue)) );
+        (void)ecu_mpsc_pop(&queue);
+        CHECK_TRUE( (ecu_mpsc_empty(&queue)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------------- TESTS - DRAIN ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief All nodes are moved into the list in FIFO order.
+ */
+TEST(Mpsc, DrainFIFOOrder)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist list;
+        struct ecu_dlist_iterator iterator;
+        std::size_t i = 0;
+
+        for (auto& item : ITEMS)
+        {
+            ecu_mpsc_push(&queue, &item.dnode);
+        }
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_mpsc_drain(&queue, &list);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(ITEMS.size(), count);
+        UNSIGNED_LONGS_EQUAL(ITEMS.size(), ecu_dlist_size(&list));
+        CHECK_TRUE( (ecu_mpsc_empty(&queue)) );
+
+        ECU_DLIST_FOR_EACH(n, &iterator, &list)
+        {
+            POINTERS_EQUAL(&ITEMS.at(i), &entry(n));
+            i++;
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Drained nodes are added after nodes that
+ * were already in the list.
+ */
+TEST(Mpsc, DrainKeepsExistingListNodes)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist list;
+        ecu_dlist_push_back(&list, &ITEMS.at(0).dnode);
+        ecu_mpsc_push(&queue, &ITEMS.at(1).dnode);
+        ecu_mpsc_push(&queue, &ITEMS.at(2).dnode);
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_mpsc_drain(&queue, &list);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(2, count);
+        POINTERS_EQUAL(&ITEMS.at(0).dnode, ecu_dlist_pop_front(&list));
+        POINTERS_EQUAL(&ITEMS.at(1).dnode, ecu_dlist_pop_front(&list));
+        POINTERS_EQUAL(&ITEMS.at(2).dnode, ecu_dlist_pop_front(&list));
+        CHECK_TRUE( (ecu_dlist_empty(&list)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Draining an empty queue does nothing.
+ */
+TEST(Mpsc, DrainEmptyQueue)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        dlist list;
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_mpsc_drain(&queue, &list);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, count);
+        CHECK_TRUE( (ecu_dlist_empty(&list)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - STRESS TESTS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Multiple producer threads push concurrently while a
+ * single consumer pops. Every node is received exactly once
+ * and each producer's nodes are received in the order it pushed them.
+ */
+TEST(Mpsc, StressMultiProducerPop)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::vector<work_item> items(PRODUCERS * ITEMS_PER_PRODUCER);
+        std::vector<const work_item *> received;
+        std::vector<std::thread> producers;
+        std::atomic<bool> go{false};
+        received.reserve(items.size());
+
+        for (std::size_t p = 0; p < PRODUCERS; p++)
+        {
+            for (std::size_t s = 0; s < ITEMS_PER_PRODUCER; s++)
+            {
+                items.at((p * ITEMS_PER_PRODUCER) + s).producer = p;
+                items.at((p * ITEMS_PER_PRODUCER) + s).sequence = s;
+            }
+        }
+
+        /* Step 2: Action. */
+        for (std::size_t p = 0; p < PRODUCERS; p++)
+        {
+            producers.emplace_back([&, p]() {
+                while (!go.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (std::size_t s = 0; s < ITEMS_PER_PRODUCER; s++)
+                {
+                    ecu_mpsc_push(&queue, &items[(p * ITEMS_PER_PRODUCER) + s].dnode);
+                }
+            });
+        }
+
+        go.store(true, std::memory_order_release);
+
+        while (received.size() < items.size())
+        {
+            ecu_dnode *n = ecu_mpsc_pop(&queue);
+
+            if (n)
+            {
+                received.push_back(&entry(n));
+            }
+        }
+
+        for (auto& t : producers)
+        {
+            t.join();
+        }
+
+        /* Step 3: Assert. */
+        CHECK_PER_PRODUCER_FIFO(received, PRODUCERS, ITEMS_PER_PRODUCER);
+        CHECK_TRUE( (ecu_mpsc_empty(&queue)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Same as StressMultiProducerPop but the consumer
+ * batch drains into a list.
+ */
+TEST(Mpsc, StressMultiProducerDrain)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::vector<work_item> items(PRODUCERS * ITEMS_PER_PRODUCER);
+        std::vector<const work_item *> received;
+        std::vector<std::thread> producers;
+        std::atomic<bool> go{false};
+        dlist list;
+        received.reserve(items.size());
+
+        for (std::size_t p = 0; p < PRODUCERS; p++)
+        {
+            for (std::size_t s = 0; s < ITEMS_PER_PRODUCER; s++)
+            {
+                items.at((p * ITEMS_PER_PRODUCER) + s).producer = p;
+                items.at((p * ITEMS_PER_PRODUCER) + s).sequence = s;
+            }
+        }
+
+        /* Step 2: Action. */
+        for (std::size_t p = 0; p < PRODUCERS; p++)
+        {
+            producers.emplace_back([&, p]() {
+                while (!go.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (std::size_t s = 0; s < ITEMS_PER_PRODUCER; s++)
+                {
+                    ecu_mpsc_push(&queue, &items[(p * ITEMS_PER_PRODUCER) + s].dnode);
+                }
+            });
+        }
+
+        go.store(true, std::memory_order_release);
+
+        while (received.size() < items.size())
+        {
+            (void)ecu_mpsc_drain(&queue, &list);
+
+            for (ecu_dnode *n = ecu_dlist_pop_front(&list); n; n = ecu_dlist_pop_front(&list))
+            {
+                received.push_back(&entry(n));
+            }
+        }
+
+        for (auto& t : producers)
+        {
+            t.join();
+        }
+
+        /* Step 3: Assert. */
+        CHECK_PER_PRODUCER_FIFO(received, PRODUCERS, ITEMS_PER_PRODUCER);
+        CHECK_TRUE( (ecu_mpsc_empty(&queue)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
@@ -0,0 +1,763 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref ntimage.h.
+ * Test summary:
+ *
+ * @ref ecu_ntimage_save(), @ref ecu_ntimage_size()
+ *      - TEST(NtImage, SaveSizeMatches)
+ *      - TEST(NtImage, SaveIsLittleEndian)
+ *      - TEST(NtImage, SaveCapacityTooSmall)
+ *      - TEST(NtImage, SaveCapacitySmallerThanHeader)
+ *      - TEST(NtImage, SaveNullCallbackWithPayload)
+ *
+ * @ref ecu_ntimage_load(), @ref ecu_ntimage_count()
+ *      - TEST(NtImage, LoadSingleNode)
+ *      - TEST(NtImage, LoadRandomTrees)
+ *      - TEST(NtImage, LoadSubtree)
+ *      - TEST(NtImage, LoadPayloadPointsIntoImage)
+ *      - TEST(NtImage, LoadAssignsDestroyCallback)
+ *      - TEST(NtImage, LoadNotEnoughNodes)
+ *      - TEST(NtImage, LoadTruncatedImage)
+ *      - TEST(NtImage, LoadImageSmallerThanHeader)
+ *      - TEST(NtImage, LoadInvalidImage)
+ *      - TEST(NtImage, LoadBadMagic)
+ *      - TEST(NtImage, LoadCorruptPayloadSize)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ntimage.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <vector>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief C++ wrapper around tree node (@ref ecu_ntnode) that
+ * stores a payload saved with the node.
+ */
+struct node : public ecu_ntnode
+{
+    /// @brief Constructor.
+    ///
+    /// @param id_ Node's ID.
+    explicit node(ecu_object_id_t id_ = ECU_OBJECT_ID_UNUSED)
+    {
+        ecu_ntnode_ctor(this, ECU_NTNODE_DESTROY_UNUSED, id_);
+    }
+
+    /// @brief User data saved as the node's payload.
+    std::uint32_t value{0};
+
+    /// @brief Payload passed to the load callback. Points
+    /// into the image.
+    const void *payload{nullptr};
+};
+
+/**
+ * @brief Save callback. Writes the node's value as its payload.
+ */
+void save_value(const ecu_ntnode *me, void *payload, void *obj)
+{
+    (void)obj;
+    std::memcpy(payload, &static_cast<const node *>(me)->value, sizeof(std::uint32_t));
+}
+
+/**
+ * @brief Load callback. Restores the node's value from its payload.
+ */
+void load_value(ecu_ntnode *me, const void *payload, void *obj)
+{
+    (void)obj;
+    node *n = static_cast<node *>(me);
+    std::memcpy(&n->value, payload, sizeof(std::uint32_t));
+    n->payload = payload;
+}
+
+/**
+ * @brief Destroy callback assigned to loaded nodes.
+ */
+void destroy_node(ecu_ntnode *me, ecu_object_id_t id)
+{
+    mock("destroy").actualCall("callback")
+                   .withParameter("node", static_cast<const void *>(me))
+                   .withParameter("id", id);
+}
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(NtImage)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Builds a random tree out of @p count nodes rooted at
+    /// nodes[0]. Half of all nodes extend the previous node so the
+    /// tree also has long branches. Every node's ID and value are
+    /// derived from its position.
+    static void random_tree(std::deque<node>& nodes, std::size_t count, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            nodes.emplace_back(static_cast<ecu_object_id_t>(i % 7));
+            nodes.back().value = static_cast<std::uint32_t>(i * 1000U);
+        }
+
+        for (std::size_t i = 1; i < count; i++)
+        {
+            std::size_t parent = i - 1;
+
+            if (rng() % 2)
+            {
+                parent = static_cast<std::size_t>(rng() % i);
+            }
+
+            ecu_ntnode_push_child_back(&nodes.at(parent), &nodes.at(i));
+        }
+    }
+
+    /// @brief Returns pointers to every node in @p nodes.
+    static std::vector<ecu_ntnode *> pointers(std::deque<node>& nodes)
+    {
+        std::vector<ecu_ntnode *> p;
+
+        for (auto& n : nodes)
+        {
+            p.push_back(&n);
+        }
+
+        return p;
+    }
+
+    /// @brief Verifies two trees have the same shape, IDs, and values
+    /// by walking both in preorder. A preorder sequence of child counts
+    /// uniquely identifies a tree's shape.
+    static void CHECK_SAME_TREE(const ecu_ntnode& expected, const ecu_ntnode& actual)
+    {
+        ecu_ntnode_preorder_citerator eiter;
+        ecu_ntnode_preorder_citerator aiter;
+        const ecu_ntnode *e = ecu_ntnode_preorder_iterator_cbegin(&eiter, &expected);
+        const ecu_ntnode *a = ecu_ntnode_preorder_iterator_cbegin(&aiter, &actual);
+
+        while ((e != ecu_ntnode_preorder_iterator_cend(&eiter)) &&
+               (a != ecu_ntnode_preorder_iterator_cend(&aiter)))
+        {
+            LONGS_EQUAL(ecu_ntnode_id(e), ecu_ntnode_id(a));
+            UNSIGNED_LONGS_EQUAL(ecu_ntnode_count(e), ecu_ntnode_count(a));
+            UNSIGNED_LONGS_EQUAL(static_cast<const node *>(e)->value, static_cast<const node *>(a)->value);
+            e = ecu_ntnode_preorder_iterator_cnext(&eiter);
+            a = ecu_ntnode_preorder_iterator_cnext(&aiter);
+        }
+
+        CHECK_TRUE( (e == ecu_ntnode_preorder_iterator_cend(&eiter)) );
+        CHECK_TRUE( (a == ecu_ntnode_preorder_iterator_cend(&aiter)) );
+        UNSIGNED_LONGS_EQUAL(ecu_ntnode_size(&expected), ecu_ntnode_size(&actual));
+    }
+};
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - SAVE ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Bytes written match the size reported
+ * beforehand and the compile-time macro.
+ */
+TEST(NtImage, SaveSizeMatches)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 50, 1);
+        std::vector<std::uint8_t> image(ecu_ntimage_size(&nodes.at(0), sizeof(std::uint32_t)));
+
+        /* Step 2: Action. */
+        std::size_t written = ecu_ntimage_save(image.data(), image.size(), &nodes.at(0),
+                                               sizeof(std::uint32_t), &save_value, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(ECU_NTIMAGE_SIZE(50, sizeof(std::uint32_t)), image.size());
+        UNSIGNED_LONGS_EQUAL(image.size(), written);
+        UNSIGNED_LONGS_EQUAL(50, ecu_ntimage_count(image.data(), image.size()));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Image has the documented little endian
+ * layout regardless of the target.
+ */
+TEST(NtImage, SaveIsLittleEndian)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        N0 (ID 0x01020304)
+        |
+        N1 (ID 5)
+        */
+        node n0{0x01020304};
+        node n1{5};
+        ecu_ntnode_push_child_back(&n0, &n1);
+        std::uint8_t image[ECU_NTIMAGE_SIZE(2, 0)];
+        const std::uint8_t expected[] = {
+            'E', 'C', 'U', 'T', 2, 0, 0, 0, 0, 0, 0, 0,     /* Header. Magic, count, payload size. */
+            0x04, 0x03, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, /* N0. ID, no parent. */
+            5, 0, 0, 0, 0, 0, 0, 0                          /* N1. ID, parent is N0. */
+        };
+
+        /* Step 2: Action. */
+        std::size_t written = ecu_ntimage_save(&image[0], sizeof(image), &n0, 0,
+                                               ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(sizeof(expected), written);
+        MEMCMP_EQUAL(&expected[0], &image[0], sizeof(expected));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Buffer that cannot hold the whole image is rejected
+ * at runtime. Nothing is written past the buffer and no header
+ * is written, so the buffer is not mistaken for an image.
+ */
+TEST(NtImage, SaveCapacityTooSmall)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node n0{0};
+        node n1{1};
+        node n2{2};
+        ecu_ntnode_push_child_back(&n0, &n1);
+        ecu_ntnode_push_child_back(&n0, &n2);
+        std::uint8_t image[ECU_NTIMAGE_SIZE(3, 0)] = {0};
+        std::size_t bytes;
+
+        /* Step 2: Action. Last byte is a guard. */
+        bytes = ecu_ntimage_save(&image[0], sizeof(image) - 1, &n0, 0,
+                                 ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, bytes);
+        UNSIGNED_LONGS_EQUAL(0, image[sizeof(image) - 1]);
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntimage_count(&image[0], sizeof(image)));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Buffer that cannot even hold the header is
+ * rejected at runtime.
+ */
+TEST(NtImage, SaveCapacitySmallerThanHeader)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node n0{0};
+        std::uint8_t image[ECU_NTIMAGE_HEADER_SIZE] = {0};
+        std::size_t bytes;
+
+        /* Step 2: Action. */
+        bytes = ecu_ntimage_save(&image[0], ECU_NTIMAGE_HEADER_SIZE - 1, &n0, 0,
+                                 ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, bytes);
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntimage_count(&image[0], sizeof(image)));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Save callback is required if nodes have a payload.
+ */
+TEST(NtImage, SaveNullCallbackWithPayload)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node n0{0};
+        std::uint8_t image[ECU_NTIMAGE_SIZE(1, 4)];
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_ntimage_save(&image[0], sizeof(image), &n0, 4,
+                               ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - LOAD ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Tree with one node is reconstructed.
+ */
+TEST(NtImage, LoadSingleNode)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node original{3};
+        node loaded;
+        ecu_ntnode *nodes[] = {&loaded};
+        original.value = 42;
+        std::uint8_t image[ECU_NTIMAGE_SIZE(1, sizeof(std::uint32_t))];
+        (void)ecu_ntimage_save(&image[0], sizeof(image), &original, sizeof(std::uint32_t),
+                               &save_value, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 2: Action. */
+        ecu_ntnode *root = ecu_ntimage_load(&image[0], sizeof(image), &nodes[0], 1,
+                                            ECU_NTNODE_DESTROY_UNUSED, &load_value, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (root == &loaded) );
+        CHECK_TRUE( (ecu_ntnode_is_root(root)) );
+        CHECK_SAME_TREE(original, loaded);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Random trees of different shapes survive a
+ * save and load unchanged.
+ */
+TEST(NtImage, LoadRandomTrees)
+{
+    try
+    {
+        for (unsigned seed = 1; seed <= 5; seed++)
+        {
+            /* Step 1: Arrange. */
+            std::deque<node> original;
+            std::deque<node> loaded(200);
+            std::vector<ecu_ntnode *> nodes = pointers(loaded);
+            random_tree(original, 200, seed);
+            std::vector<std::uint8_t> image(ecu_ntimage_size(&original.at(0), sizeof(std::uint32_t)));
+            (void)ecu_ntimage_save(image.data(), image.size(), &original.at(0), sizeof(std::uint32_t),
+                                   &save_value, ECU_NTIMAGE_OBJ_UNUSED);
+
+            /* Step 2: Action. */
+            ecu_ntnode *root = ecu_ntimage_load(image.data(), image.size(), nodes.data(), nodes.size(),
+                                                ECU_NTNODE_DESTROY_UNUSED, &load_value, ECU_NTIMAGE_OBJ_UNUSED);
+
+            /* Step 3: Assert. */
+            CHECK_TRUE( (root == &loaded.at(0)) );
+            CHECK_SAME_TREE(original.at(0), *root);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Only the saved subtree is reconstructed. Its
+ * root becomes the root of the loaded tree.
+ */
+TEST(NtImage, LoadSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange. Save N1.
+        N0
+        |
+        N1-----------N5
+        |            |
+        N2-----N4    N6
+        |
+        N3
+        */
+        std::deque<node> original;
+        std::deque<node> loaded(4);
+        std::vector<ecu_ntnode *> nodes = pointers(loaded);
+
+        for (ecu_object_id_t i = 0; i < 7; i++)
+        {
+            original.emplace_back(i);
+        }
+
+        ecu_ntnode_push_child_back(&original.at(0), &original.at(1));
+        ecu_ntnode_push_child_back(&original.at(0), &original.at(5));
+        ecu_ntnode_push_child_back(&original.at(1), &original.at(2));
+        ecu_ntnode_push_child_back(&original.at(1), &original.at(4));
+        ecu_ntnode_push_child_back(&original.at(2), &original.at(3));
+        ecu_ntnode_push_child_back(&original.at(5), &original.at(6));
+        std::uint8_t image[ECU_NTIMAGE_SIZE(4, 0)];
+        std::size_t written = ecu_ntimage_save(&image[0], sizeof(image), &original.at(1), 0,
+                                               ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 2: Action. */
+        ecu_ntnode *root = ecu_ntimage_load(&image[0], written, nodes.data(), nodes.size(),
+                                            ECU_NTNODE_DESTROY_UNUSED, ECU_NTIMAGE_LOAD_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(sizeof(image), written);
+        CHECK_TRUE( (ecu_ntnode_is_root(root)) );
+        CHECK_SAME_TREE(original.at(1), *root);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Payload passed to the load callback points
+ * directly into the image.
+ */
+TEST(NtImage, LoadPayloadPointsIntoImage)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> original;
+        std::deque<node> loaded(10);
+        std::vector<ecu_ntnode *> nodes = pointers(loaded);
+        random_tree(original, 10, 2);
+        std::vector<std::uint8_t> image(ecu_ntimage_size(&original.at(0), sizeof(std::uint32_t)));
+        (void)ecu_ntimage_save(image.data(), image.size(), &original.at(0), sizeof(std::uint32_t),
+                               &save_value, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 2: Action. */
+        (void)ecu_ntimage_load(image.data(), image.size(), nodes.data(), nodes.size(),
+                               ECU_NTNODE_DESTROY_UNUSED, &load_value, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. Records are stored in preorder. */
+        ecu_ntnode_preorder_iterator iterator;
+        std::size_t i = 0;
+
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iterator, &loaded.at(0))
+        {
+            const std::uint8_t *expected = image.data() + ECU_NTIMAGE_HEADER_SIZE +
+                                           (i * ECU_NTIMAGE_RECORD_SIZE(sizeof(std::uint32_t))) + 8;
+            CHECK_TRUE( (static_cast<node *>(n)->payload == expected) );
+            i++;
+        }
+
+        UNSIGNED_LONGS_EQUAL(10, i);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Every loaded node is given the supplied destroy
+ * callback and its saved ID.
+ */
+TEST(NtImage, LoadAssignsDestroyCallback)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node n0{7};
+        node n1{8};
+        node l0;
+        node l1;
+        ecu_ntnode *nodes[] = {&l0, &l1};
+        ecu_ntnode_push_child_back(&n0, &n1);
+        std::uint8_t image[ECU_NTIMAGE_SIZE(2, 0)];
+        (void)ecu_ntimage_save(&image[0], sizeof(image), &n0, 0,
+                               ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+        (void)ecu_ntimage_load(&image[0], sizeof(image), &nodes[0], 2,
+                               &destroy_node, ECU_NTIMAGE_LOAD_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+        mock("destroy").expectOneCall("callback")
+                       .withParameter("node", static_cast<const void *>(&l1))
+                       .withParameter("id", 8);
+        mock("destroy").expectOneCall("callback")
+                       .withParameter("node", static_cast<const void *>(&l0))
+                       .withParameter("id", 7);
+
+        /* Step 2: Action. */
+        ecu_ntnode_destroy(&l0);
+
+        /* Step 3: Assert. Test fails if callbacks do not execute. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Node array that cannot hold every node in the image
+ * is rejected at runtime. No node is touched.
+ */
+TEST(NtImage, LoadNotEnoughNodes)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node n0{0};
+        node n1{1};
+        node l0{7};
+        ecu_ntnode *nodes[] = {&l0};
+        ecu_ntnode_push_child_back(&n0, &n1);
+        std::uint8_t image[ECU_NTIMAGE_SIZE(2, 0)];
+        (void)ecu_ntimage_save(&image[0], sizeof(image), &n0, 0,
+                               ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+        ecu_ntnode *root;
+
+        /* Step 2: Action. */
+        root = ecu_ntimage_load(&image[0], sizeof(image), &nodes[0], 1,
+                                ECU_NTNODE_DESTROY_UNUSED, ECU_NTIMAGE_LOAD_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(nullptr, root);
+        LONGS_EQUAL(7, ecu_ntnode_id(&l0));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Image that does not contain every record listed
+ * in its header is rejected at runtime.
+ */
+TEST(NtImage, LoadTruncatedImage)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node n0{0};
+        node n1{1};
+        node l0;
+        node l1;
+        ecu_ntnode *nodes[] = {&l0, &l1};
+        ecu_ntnode_push_child_back(&n0, &n1);
+        std::uint8_t image[ECU_NTIMAGE_SIZE(2, 0)];
+        (void)ecu_ntimage_save(&image[0], sizeof(image), &n0, 0,
+                               ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+        ecu_ntnode *root;
+
+        /* Step 2: Action. */
+        root = ecu_ntimage_load(&image[0], sizeof(image) - 1, &nodes[0], 2,
+                                ECU_NTNODE_DESTROY_UNUSED, ECU_NTIMAGE_LOAD_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(nullptr, root);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Image that cannot even hold the header is rejected
+ * at runtime.
+ */
+TEST(NtImage, LoadImageSmallerThanHeader)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node n0{0};
+        node l0;
+        ecu_ntnode *nodes[] = {&l0};
+        std::uint8_t image[ECU_NTIMAGE_SIZE(1, 0)];
+        (void)ecu_ntimage_save(&image[0], sizeof(image), &n0, 0,
+                               ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+        ecu_ntnode *root;
+
+        /* Step 2: Action. */
+        root = ecu_ntimage_load(&image[0], ECU_NTIMAGE_HEADER_SIZE - 1, &nodes[0], 1,
+                                ECU_NTNODE_DESTROY_UNUSED, ECU_NTIMAGE_LOAD_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(nullptr, root);
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntimage_count(&image[0], ECU_NTIMAGE_HEADER_SIZE - 1));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Data that was not created by @ref ecu_ntimage_save()
+ * is rejected at runtime.
+ */
+TEST(NtImage, LoadInvalidImage)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node l0;
+        ecu_ntnode *nodes[] = {&l0};
+        std::uint8_t image[ECU_NTIMAGE_SIZE(1, 0)] = {0};
+        ecu_ntnode *root;
+
+        /* Step 2: Action. */
+        root = ecu_ntimage_load(&image[0], sizeof(image), &nodes[0], 1,
+                                ECU_NTNODE_DESTROY_UNUSED, ECU_NTIMAGE_LOAD_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(nullptr, root);
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntimage_count(&image[0], sizeof(image)));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Otherwise valid image whose magic number was
+ * corrupted is rejected at runtime.
+ */
+TEST(NtImage, LoadBadMagic)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node n0{0};
+        node n1{1};
+        node l0;
+        node l1;
+        ecu_ntnode *nodes[] = {&l0, &l1};
+        ecu_ntnode_push_child_back(&n0, &n1);
+        std::uint8_t image[ECU_NTIMAGE_SIZE(2, 0)];
+        (void)ecu_ntimage_save(&image[0], sizeof(image), &n0, 0,
+                               ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+        image[0] ^= 0x01;
+        ecu_ntnode *root;
+
+        /* Step 2: Action. */
+        root = ecu_ntimage_load(&image[0], sizeof(image), &nodes[0], 2,
+                                ECU_NTNODE_DESTROY_UNUSED, ECU_NTIMAGE_LOAD_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(nullptr, root);
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntimage_count(&image[0], sizeof(image)));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Payload size in the header larger than the image is
+ * rejected at runtime. Large values must not wrap the record
+ * size around to a small value.
+ */
+TEST(NtImage, LoadCorruptPayloadSize)
+{
+    try
+    {
+        /* Step 1: Arrange. Payload size is bytes 8 to 11 of the header. */
+        node n0{0};
+        node l0;
+        ecu_ntnode *nodes[] = {&l0};
+        std::uint8_t image[ECU_NTIMAGE_SIZE(1, 0)];
+        (void)ecu_ntimage_save(&image[0], sizeof(image), &n0, 0,
+                               ECU_NTIMAGE_SAVE_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+        image[8] = 0xFF;
+        image[9] = 0xFF;
+        image[10] = 0xFF;
+        image[11] = 0xFF;
+        ecu_ntnode *root;
+
+        /* Step 2: Action. */
+        root = ecu_ntimage_load(&image[0], sizeof(image), &nodes[0], 1,
+                                ECU_NTNODE_DESTROY_UNUSED, ECU_NTIMAGE_LOAD_UNUSED, ECU_NTIMAGE_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(nullptr, root);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
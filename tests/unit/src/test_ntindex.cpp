@@ -0,0 +1,924 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref ntindex.h.
+ * Test summary:
+ *
+ * @ref ecu_ntindex_ctor()
+ *      - TEST(NtIndex, CtorZeroCapacity)
+ *
+ * @ref ecu_ntindex_build()
+ *      - TEST(NtIndex, BuildNumbersNodesInPreorder)
+ *      - TEST(NtIndex, BuildSingleNode)
+ *      - TEST(NtIndex, BuildSubtree)
+ *      - TEST(NtIndex, BuildAssignsIndices)
+ *      - TEST(NtIndex, BuildReplacesPreviousContents)
+ *      - TEST(NtIndex, BuildExceedsCapacity)
+ *
+ * @ref ecu_ntindex_depth(), @ref ecu_ntindex_end(), @ref ecu_ntindex_parent(), @ref ecu_ntindex_node()
+ *      - TEST(NtIndex, ParentAndDepth)
+ *      - TEST(NtIndex, QueryOutOfRange)
+ *
+ * @ref ecu_ntindex_is_ancestor()
+ *      - TEST(NtIndex, IsAncestorMatchesTree)
+ *
+ * @ref ecu_ntindex_lca(), @ref ecu_ntindex_set_jump_table()
+ *      - TEST(NtIndex, LCAWithoutJumpTable)
+ *      - TEST(NtIndex, LCAWithJumpTable)
+ *      - TEST(NtIndex, LCAWithShortJumpTable)
+ *      - TEST(NtIndex, SetJumpTableAfterBuild)
+ *
+ * @ref ECU_NTINDEX_PREORDER_FOR_EACH(), @ref ecu_ntindex_preorder_iterator_skip()
+ *      - TEST(NtIndex, PreorderIteratorMatchesTree)
+ *      - TEST(NtIndex, PreorderIteratorSkip)
+ *
+ * @ref ECU_NTINDEX_POSTORDER_FOR_EACH()
+ *      - TEST(NtIndex, PostorderIteratorMatchesTree)
+ *
+ * @ref ECU_NTINDEX_CHILD_FOR_EACH()
+ *      - TEST(NtIndex, ChildIteratorMatchesTree)
+ *
+ * @ref ECU_NTINDEX_PARENT_FOR_EACH()
+ *      - TEST(NtIndex, ParentIteratorMatchesTree)
+ *
+ * All iterators
+ *      - TEST(NtIndex, IteratorsSingleNode)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ntindex.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <deque>
+#include <random>
+#include <vector>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief C++ wrapper around tree node (@ref ecu_ntnode) that
+ * remembers the index it was assigned.
+ */
+struct node : public ecu_ntnode
+{
+    /// @brief Constructor.
+    node()
+    {
+        ecu_ntnode_ctor(this, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+    }
+
+    /// @brief Index assigned by @ref ecu_ntindex_build().
+    std::size_t index{ECU_NTINDEX_NONE};
+};
+
+/**
+ * @brief Assign callback passed to @ref ecu_ntindex_build().
+ */
+void save_index(ecu_ntnode *me, std::size_t index, void *obj)
+{
+    (void)obj;
+    static_cast<node *>(me)->index = index;
+}
+
+/**
+ * @brief C++ wrapper around C structure under test (@ref ecu_ntindex).
+ * Owns its arrays.
+ */
+struct ntindex : public ecu_ntindex
+{
+    /// @brief Constructor.
+    ///
+    /// @param cap Number of nodes that can be indexed.
+    explicit ntindex(std::size_t cap)
+        : nodes_storage(cap),
+          ends_storage(cap),
+          parents_storage(cap),
+          depths_storage(cap)
+    {
+        ecu_ntindex_ctor(this,
+                         nodes_storage.data(),
+                         ends_storage.data(),
+                         parents_storage.data(),
+                         depths_storage.data(),
+                         cap);
+    }
+
+    /// @brief Attaches a jump table with @p rows rows.
+    void use_jump_table(std::size_t rows)
+    {
+        jumps_storage.assign(rows * nodes_storage.size(), 0);
+        ecu_ntindex_set_jump_table(this, jumps_storage.data(), rows);
+    }
+
+    /// @brief Node pointer array.
+    std::vector<ecu_ntnode *> nodes_storage;
+
+    /// @brief Subtree end array.
+    std::vector<std::size_t> ends_storage;
+
+    /// @brief Parent index array.
+    std::vector<std::size_t> parents_storage;
+
+    /// @brief Depth array.
+    std::vector<std::size_t> depths_storage;
+
+    /// @brief Optional jump table.
+    std::vector<std::size_t> jumps_storage;
+};
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(NtIndex)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Builds a random tree out of @p count nodes rooted at
+    /// nodes[0]. Half of all nodes extend the previous node so the
+    /// tree also has long branches.
+    static void random_tree(std::deque<node>& nodes, std::size_t count, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        nodes.resize(count);
+
+        for (std::size_t i = 1; i < count; i++)
+        {
+            std::size_t parent = i - 1;
+
+            if (rng() % 2)
+            {
+                parent = static_cast<std::size_t>(rng() % i);
+            }
+
+            ecu_ntnode_push_child_back(&nodes.at(parent), &nodes.at(i));
+        }
+    }
+
+    /// @brief Compares every pair of indexed nodes against the
+    /// @ref ecu_ntnode_is_ancestor() and @ref ecu_ntnode_lca() results.
+    static void check_against_tree(const ecu_ntindex& index)
+    {
+        std::size_t size = ecu_ntindex_size(&index);
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            for (std::size_t j = 0; j < size; j++)
+            {
+                ecu_ntnode *ni = ecu_ntindex_node(&index, i);
+                ecu_ntnode *nj = ecu_ntindex_node(&index, j);
+                CHECK_EQUAL(ecu_ntnode_is_ancestor(ni, nj), ecu_ntindex_is_ancestor(&index, i, j));
+                POINTERS_EQUAL(ecu_ntnode_lca(ni, nj), ecu_ntindex_node(&index, ecu_ntindex_lca(&index, i, j)));
+            }
+        }
+    }
+};
+
+/*------------------------------------------------------------*/
+/*-------------------------- TESTS - CTOR --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Index must be able to hold at least the root.
+ */
+TEST(NtIndex, CtorZeroCapacity)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntindex index;
+        ecu_ntnode *nodes[1];
+        std::size_t ends[1];
+        std::size_t parents[1];
+        std::size_t depths[1];
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntindex_ctor(&index, nodes, ends, parents, depths, 0);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - BUILD ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Nodes are stored in the same order as the preorder
+ * iterator, and every subtree is a contiguous range.
+ */
+TEST(NtIndex, BuildNumbersNodesInPreorder)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 100, 1U);
+        ntindex index{100};
+        std::size_t expected = 0;
+        ecu_ntnode_preorder_iterator iterator;
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntindex_build(&index, &nodes.at(0), ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(100, count);
+        UNSIGNED_LONGS_EQUAL(100, ecu_ntindex_size(&index));
+
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iterator, &nodes.at(0))
+        {
+            POINTERS_EQUAL(n, ecu_ntindex_node(&index, expected));
+            UNSIGNED_LONGS_EQUAL(ecu_ntnode_size(n) + expected + 1, ecu_ntindex_end(&index, expected));
+            expected++;
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Lone node is indexed as the root.
+ */
+TEST(NtIndex, BuildSingleNode)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node root;
+        ntindex index{1};
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntindex_build(&index, &root, ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(1, count);
+        POINTERS_EQUAL(&root, ecu_ntindex_node(&index, 0));
+        UNSIGNED_LONGS_EQUAL(ECU_NTINDEX_NONE, ecu_ntindex_parent(&index, 0));
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntindex_depth(&index, 0));
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntindex_lca(&index, 0, 0));
+        CHECK_FALSE( (ecu_ntindex_is_ancestor(&index, 0, 0)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Only the supplied subtree is indexed, and depths are
+ * relative to the subtree root.
+ */
+TEST(NtIndex, BuildSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        N0
+        |
+        N1-----N2
+               |
+               N3-----N4
+               |
+               N5
+        */
+        std::deque<node> n(6);
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(2));
+        ecu_ntnode_push_child_back(&n.at(2), &n.at(3));
+        ecu_ntnode_push_child_back(&n.at(2), &n.at(4));
+        ecu_ntnode_push_child_back(&n.at(3), &n.at(5));
+        ntindex index{4};
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntindex_build(&index, &n.at(2), &save_index, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(4, count);
+        UNSIGNED_LONGS_EQUAL(0, n.at(2).index);
+        UNSIGNED_LONGS_EQUAL(1, n.at(3).index);
+        UNSIGNED_LONGS_EQUAL(2, n.at(5).index);
+        UNSIGNED_LONGS_EQUAL(3, n.at(4).index);
+        UNSIGNED_LONGS_EQUAL(ECU_NTINDEX_NONE, n.at(0).index);
+        UNSIGNED_LONGS_EQUAL(ECU_NTINDEX_NONE, n.at(1).index);
+        UNSIGNED_LONGS_EQUAL(ECU_NTINDEX_NONE, ecu_ntindex_parent(&index, 0));
+        UNSIGNED_LONGS_EQUAL(2, ecu_ntindex_depth(&index, n.at(5).index));
+        UNSIGNED_LONGS_EQUAL(n.at(2).index, ecu_ntindex_lca(&index, n.at(5).index, n.at(4).index));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Assign callback runs once per node with its index.
+ */
+TEST(NtIndex, BuildAssignsIndices)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 50, 2U);
+        ntindex index{50};
+
+        /* Step 2: Action. */
+        (void)ecu_ntindex_build(&index, &nodes.at(0), &save_index, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        for (node& n : nodes)
+        {
+            POINTERS_EQUAL(&n, ecu_ntindex_node(&index, n.index));
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Rebuilding after the tree changes replaces the old snapshot.
+ */
+TEST(NtIndex, BuildReplacesPreviousContents)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 40, 3U);
+        ntindex index{40};
+        index.use_jump_table(2);
+        (void)ecu_ntindex_build(&index, &nodes.at(0), ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 2: Action. Move a leaf to the root and drop a subtree. */
+        ecu_ntnode_remove(&nodes.at(39));
+        ecu_ntnode_push_child_front(&nodes.at(0), &nodes.at(39));
+        ecu_ntnode_remove(&nodes.at(20));
+        std::size_t count = ecu_ntindex_build(&index, &nodes.at(0), ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(ecu_ntnode_size(&nodes.at(0)) + 1, count);
+        POINTERS_EQUAL(&nodes.at(39), ecu_ntindex_node(&index, 1));
+        check_against_tree(index);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Tree with more nodes than the index can hold.
+ */
+TEST(NtIndex, BuildExceedsCapacity)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 10, 4U);
+        ntindex index{9};
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_ntindex_build(&index, &nodes.at(0), ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - NODE QUERIES -------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Parent and depth match the tree.
+ */
+TEST(NtIndex, ParentAndDepth)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 100, 5U);
+        ntindex index{100};
+
+        /* Step 2: Action. */
+        (void)ecu_ntindex_build(&index, &nodes.at(0), &save_index, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        for (node& n : nodes)
+        {
+            UNSIGNED_LONGS_EQUAL(ecu_ntnode_level(&n), ecu_ntindex_depth(&index, n.index));
+
+            if (ecu_ntnode_is_root(&n))
+            {
+                UNSIGNED_LONGS_EQUAL(ECU_NTINDEX_NONE, ecu_ntindex_parent(&index, n.index));
+            }
+            else
+            {
+                POINTERS_EQUAL(ecu_ntnode_parent(&n), ecu_ntindex_node(&index, ecu_ntindex_parent(&index, n.index)));
+            }
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Indices past the number of indexed nodes are rejected.
+ */
+TEST(NtIndex, QueryOutOfRange)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node root;
+        ntindex index{4};
+        (void)ecu_ntindex_build(&index, &root, ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_ntindex_lca(&index, 0, 1);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*--------------------- TESTS - IS ANCESTOR ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Every pair agrees with @ref ecu_ntnode_is_ancestor().
+ */
+TEST(NtIndex, IsAncestorMatchesTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 120, 6U);
+        ntindex index{120};
+
+        /* Step 2: Action. */
+        (void)ecu_ntindex_build(&index, &nodes.at(0), ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        check_against_tree(index);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------- TESTS - LCA ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Parent walk agrees with @ref ecu_ntnode_lca().
+ */
+TEST(NtIndex, LCAWithoutJumpTable)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 150, 7U);
+        ntindex index{150};
+
+        /* Step 2: Action. */
+        (void)ecu_ntindex_build(&index, &nodes.at(0), ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        check_against_tree(index);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Jump table covering the full depth agrees with
+ * @ref ecu_ntnode_lca().
+ */
+TEST(NtIndex, LCAWithJumpTable)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 150, 8U);
+        ntindex index{150};
+        index.use_jump_table(8);
+
+        /* Step 2: Action. */
+        (void)ecu_ntindex_build(&index, &nodes.at(0), ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        check_against_tree(index);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Jump tables too short for the tree's depth still give
+ * correct results.
+ */
+TEST(NtIndex, LCAWithShortJumpTable)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 150, 9U);
+
+        for (std::size_t rows = 1; rows <= 3; rows++)
+        {
+            ntindex index{150};
+            index.use_jump_table(rows);
+
+            /* Step 2: Action. */
+            (void)ecu_ntindex_build(&index, &nodes.at(0), ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+            /* Step 3: Assert. */
+            check_against_tree(index);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Table supplied after the index is built is filled immediately.
+ */
+TEST(NtIndex, SetJumpTableAfterBuild)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 80, 10U);
+        ntindex index{80};
+        (void)ecu_ntindex_build(&index, &nodes.at(0), ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+
+        /* Step 2: Action. */
+        index.use_jump_table(4);
+
+        /* Step 3: Assert. */
+        check_against_tree(index);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------------- TESTS - ITERATORS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Every subtree is iterated in the same order as
+ * @ref ECU_NTNODE_PREORDER_FOR_EACH().
+ */
+TEST(NtIndex, PreorderIteratorMatchesTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 60, 11U);
+        ntindex index{60};
+        (void)ecu_ntindex_build(&index, &nodes.at(0), &save_index, ECU_NTINDEX_OBJ_UNUSED);
+
+        for (node& root : nodes)
+        {
+            std::vector<ecu_ntnode *> expected;
+            std::vector<ecu_ntnode *> actual;
+            ecu_ntnode_preorder_iterator niterator;
+            ecu_ntindex_iterator iterator;
+
+            ECU_NTNODE_PREORDER_FOR_EACH(n, &niterator, &root)
+            {
+                expected.push_back(n);
+            }
+
+            /* Step 2: Action. */
+            ECU_NTINDEX_PREORDER_FOR_EACH(i, &iterator, &index, root.index)
+            {
+                actual.push_back(ecu_ntindex_node(&index, i));
+            }
+
+            /* Step 3: Assert. */
+            CHECK_TRUE( (expected == actual) );
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Skipping at a given depth leaves out everything below it.
+ */
+TEST(NtIndex, PreorderIteratorSkip)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 80, 12U);
+        ntindex index{80};
+        (void)ecu_ntindex_build(&index, &nodes.at(0), ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+        std::vector<std::size_t> expected;
+        std::vector<std::size_t> actual;
+        ecu_ntindex_iterator iterator;
+
+        for (std::size_t i = 0; i < ecu_ntindex_size(&index); i++)
+        {
+            if (ecu_ntindex_depth(&index, i) <= 2)
+            {
+                expected.push_back(i);
+            }
+        }
+
+        /* Step 2: Action. */
+        ECU_NTINDEX_PREORDER_FOR_EACH(i, &iterator, &index, 0)
+        {
+            actual.push_back(i);
+
+            if (ecu_ntindex_depth(&index, i) == 2)
+            {
+                ecu_ntindex_preorder_iterator_skip(&iterator);
+            }
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (expected == actual) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Every subtree is iterated in the same order as
+ * @ref ECU_NTNODE_POSTORDER_FOR_EACH().
+ */
+TEST(NtIndex, PostorderIteratorMatchesTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 60, 13U);
+        ntindex index{60};
+        (void)ecu_ntindex_build(&index, &nodes.at(0), &save_index, ECU_NTINDEX_OBJ_UNUSED);
+
+        for (node& root : nodes)
+        {
+            std::vector<ecu_ntnode *> expected;
+            std::vector<ecu_ntnode *> actual;
+            ecu_ntnode_postorder_iterator niterator;
+            ecu_ntindex_iterator iterator;
+
+            ECU_NTNODE_POSTORDER_FOR_EACH(n, &niterator, &root)
+            {
+                expected.push_back(n);
+            }
+
+            /* Step 2: Action. */
+            ECU_NTINDEX_POSTORDER_FOR_EACH(i, &iterator, &index, root.index)
+            {
+                actual.push_back(ecu_ntindex_node(&index, i));
+            }
+
+            /* Step 3: Assert. */
+            CHECK_TRUE( (expected == actual) );
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Children of every node match @ref ECU_NTNODE_CHILD_FOR_EACH().
+ */
+TEST(NtIndex, ChildIteratorMatchesTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 60, 14U);
+        ntindex index{60};
+        (void)ecu_ntindex_build(&index, &nodes.at(0), &save_index, ECU_NTINDEX_OBJ_UNUSED);
+
+        for (node& parent : nodes)
+        {
+            std::vector<ecu_ntnode *> expected;
+            std::vector<ecu_ntnode *> actual;
+            ecu_ntnode_child_iterator niterator;
+            ecu_ntindex_iterator iterator;
+
+            ECU_NTNODE_CHILD_FOR_EACH(n, &niterator, &parent)
+            {
+                expected.push_back(n);
+            }
+
+            /* Step 2: Action. */
+            ECU_NTINDEX_CHILD_FOR_EACH(i, &iterator, &index, parent.index)
+            {
+                actual.push_back(ecu_ntindex_node(&index, i));
+            }
+
+            /* Step 3: Assert. */
+            CHECK_TRUE( (expected == actual) );
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Ancestors of every node match @ref ECU_NTNODE_PARENT_FOR_EACH().
+ */
+TEST(NtIndex, ParentIteratorMatchesTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 60, 15U);
+        ntindex index{60};
+        (void)ecu_ntindex_build(&index, &nodes.at(0), &save_index, ECU_NTINDEX_OBJ_UNUSED);
+
+        for (node& start : nodes)
+        {
+            std::vector<ecu_ntnode *> expected;
+            std::vector<ecu_ntnode *> actual;
+            ecu_ntnode_parent_iterator niterator;
+            ecu_ntindex_iterator iterator;
+
+            ECU_NTNODE_PARENT_FOR_EACH(n, &niterator, &start)
+            {
+                expected.push_back(n);
+            }
+
+            /* Step 2: Action. */
+            ECU_NTINDEX_PARENT_FOR_EACH(i, &iterator, &index, start.index)
+            {
+                actual.push_back(ecu_ntindex_node(&index, i));
+            }
+
+            /* Step 3: Assert. */
+            CHECK_TRUE( (expected == actual) );
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Preorder and postorder return only the node. Child
+ * and parent iterations are empty.
+ */
+TEST(NtIndex, IteratorsSingleNode)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node root;
+        ntindex index{1};
+        (void)ecu_ntindex_build(&index, &root, ECU_NTINDEX_ASSIGN_UNUSED, ECU_NTINDEX_OBJ_UNUSED);
+        std::vector<std::size_t> preorder;
+        std::vector<std::size_t> postorder;
+        std::size_t children = 0;
+        std::size_t parents = 0;
+        ecu_ntindex_iterator iterator;
+
+        /* Step 2: Action. */
+        ECU_NTINDEX_PREORDER_FOR_EACH(i, &iterator, &index, 0)
+        {
+            preorder.push_back(i);
+        }
+
+        ECU_NTINDEX_POSTORDER_FOR_EACH(i, &iterator, &index, 0)
+        {
+            postorder.push_back(i);
+        }
+
+        ECU_NTINDEX_CHILD_FOR_EACH(i, &iterator, &index, 0)
+        {
+            (void)i;
+            children++;
+        }
+
+        ECU_NTINDEX_PARENT_FOR_EACH(i, &iterator, &index, 0)
+        {
+            (void)i;
+            parents++;
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (preorder == std::vector<std::size_t>{0}) );
+        CHECK_TRUE( (postorder == std::vector<std::size_t>{0}) );
+        UNSIGNED_LONGS_EQUAL(0, children);
+        UNSIGNED_LONGS_EQUAL(0, parents);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
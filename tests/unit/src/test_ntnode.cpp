@@ -24,6 +24,11 @@
  *      - TEST(NtNode, CountNodeWithNoChildren)
  *      - TEST(NtNode, CountAddAndRemoveChildren)
  * 
+ * @ref ecu_ntnode_find_child_by_id(), @ref ecu_ntnode_find_cchild_by_id()
+ *      - TEST(NtNode, FindChildByIdChildExists)
+ *      - TEST(NtNode, FindChildByIdChildDoesNotExist)
+ *      - TEST(NtNode, FindChildByIdNodeWithNoChildren)
+ * 
  * @ref ecu_ntnode_first_child(), @ref ecu_ntnode_first_cchild()
  *      - TEST(NtNode, FirstChildNodeWithMultipleChildren)
  *      - TEST(NtNode, FirstChildNodeWithOneChild)
@@ -38,6 +43,21 @@
  *      - TEST(NtNode, InTreeNodeIsNonEmptySubroot)
  *      - TEST(NtNode, InTreeNodeIsLeaf)
  * 
+ * @ref ecu_ntnode_index_of()
+ *      - TEST(NtNode, IndexOfChildren)
+ *      - TEST(NtNode, IndexOfAfterRemove)
+ *      - TEST(NtNode, IndexOfNodeIsRoot)
+ * 
+ * @ref ecu_ntnode_insert_child_at()
+ *      - TEST(NtNode, InsertChildAtFront)
+ *      - TEST(NtNode, InsertChildAtMiddle)
+ *      - TEST(NtNode, InsertChildAtBack)
+ *      - TEST(NtNode, InsertChildAtParentHasNoChildren)
+ *      - TEST(NtNode, InsertChildAtChildIsNonEmptyRoot)
+ *      - TEST(NtNode, InsertChildAtIndexOutOfRange)
+ *      - TEST(NtNode, InsertChildAtChildIsDescendant)
+ *      - TEST(NtNode, InsertChildAtRandomPositions)
+ * 
  * @ref ecu_ntnode_insert_sibling_after()
  *      - TEST(NtNode, InsertSiblingAfterPosIsLeftMostSubroot)
  *      - TEST(NtNode, InsertSiblingAfterPosIsMiddleSubroot)
@@ -60,6 +80,12 @@
  *      - TEST(NtNode, InsertSiblingBeforePosEqualsSibling)
  *      - TEST(NtNode, InsertSiblingBeforeSiblingIsDescendant)
  * 
+ * @ref ecu_ntnode_is_ancestor()
+ *      - TEST(NtNode, IsAncestorNodeIsParentAndGrandparent)
+ *      - TEST(NtNode, IsAncestorNodeIsSelfOrDescendant)
+ *      - TEST(NtNode, IsAncestorNodeIsInOtherBranch)
+ *      - TEST(NtNode, IsAncestorNodesInDifferentTrees)
+ * 
  * @ref ecu_ntnode_is_descendant()
  *      - TEST(NtNode, IsDescendantNodeIsEmptyRoot)
  *      - TEST(NtNode, IsDescendantNodeIsNonEmptyRoot)
@@ -92,6 +118,8 @@
  *      - TEST(NtNode, LCANodesInDifferentTrees)
  *      - TEST(NtNode, LCANode1DirectParentOfNode2)
  *      - TEST(NtNode, LCANode2DirectParentOfNode1)
+ *      - TEST(NtNode, LCANodesInDeepUnevenBranches)
+ *      - TEST(NtNode, LCANodesInDifferentTreesAtDifferentLevels)
  * 
  * @ref ecu_ntnode_level()
  *      - TEST(NtNode, LevelNodeIsEmptyRoot)
@@ -100,6 +128,26 @@
  *      - TEST(NtNode, LevelNodeIsLeaf)
  *      - TEST(NtNode, LevelAddAndRemoveNodeFromTree)
  * 
+ * @ref ecu_ntnode_move_child_back(), @ref ecu_ntnode_move_child_front()
+ *      - TEST(NtNode, MoveChildBackWithinTree)
+ *      - TEST(NtNode, MoveChildFrontSameParent)
+ *      - TEST(NtNode, MoveChildBackToOtherTree)
+ *      - TEST(NtNode, MoveChildFrontChildIsRoot)
+ *      - TEST(NtNode, MoveChildBackIntoOwnSubtree)
+ *      - TEST(NtNode, MoveChildFrontParentEqualsChild)
+ * 
+ * @ref ecu_ntnode_move_children()
+ *      - TEST(NtNode, MoveChildrenToOtherBranch)
+ *      - TEST(NtNode, MoveChildrenToAncestor)
+ *      - TEST(NtNode, MoveChildrenFromLeaf)
+ *      - TEST(NtNode, MoveChildrenIntoOwnSubtree)
+ * 
+ * @ref ecu_ntnode_move_sibling_after(), @ref ecu_ntnode_move_sibling_before()
+ *      - TEST(NtNode, MoveSiblingAfter)
+ *      - TEST(NtNode, MoveSiblingBefore)
+ *      - TEST(NtNode, MoveSiblingAfterPositionIsRoot)
+ *      - TEST(NtNode, MoveSiblingBeforePositionInOwnSubtree)
+ * 
  * @ref ecu_ntnode_next(), @ref ecu_ntnode_cnext()
  *      - TEST(NtNode, NextNodeIsEmptyRoot)
  *      - TEST(NtNode, NextNodeIsNonEmptyRoot)
@@ -108,6 +156,12 @@
  *      - TEST(NtNode, NextNodeIsLastSibling)
  *      - TEST(NtNode, NextNodeWithNoSiblings)
  * 
+ * @ref ecu_ntnode_nth_child(), @ref ecu_ntnode_nth_cchild()
+ *      - TEST(NtNode, NthChildNodeWithMultipleChildren)
+ *      - TEST(NtNode, NthChildIndexOutOfRange)
+ *      - TEST(NtNode, NthChildNodeWithNoChildren)
+ *      - TEST(NtNode, NthChildAfterMovesAndRemoves)
+ * 
  * @ref ecu_ntnode_parent(), @ref ecu_ntnode_cparent()
  *      - TEST(NtNode, ParentNodeIsEmptyRoot)
  *      - TEST(NtNode, ParentNodeIsNonEmptyRoot)
@@ -144,6 +198,12 @@
  *      - TEST(NtNode, RemoveNodeIsNonEmptyRoot)
  *      - TEST(NtNode, RemoveNodeIsEmptyRoot)
  * 
+ * @ref ecu_ntnode_resolve(), @ref ecu_ntnode_cresolve()
+ *      - TEST(NtNode, ResolvePathExists)
+ *      - TEST(NtNode, ResolvePathDoesNotExist)
+ *      - TEST(NtNode, ResolveEmptyPath)
+ *      - TEST(NtNode, ResolveNullPath)
+ * 
  * @ref ecu_ntnode_size()
  *      - TEST(NtNode, SizeNodeIsEmptyRoot)
  *      - TEST(NtNode, SizeNodeIsNonEmptyRoot)
@@ -151,9 +211,69 @@
  *      - TEST(NtNode, SizeNodeIsLeaf)
  *      - TEST(NtNode, SizeAddAndRemoveNodes)
  * 
+ * @ref ecu_ntnode_count(), @ref ecu_ntnode_level(), @ref ecu_ntnode_size()
+ *      - TEST(NtNode, CountLevelAndSizeAfterMovingSubtrees)
+ *      - TEST(NtNode, CountLevelAndSizeAfterClearAndDestroy)
+ * 
  * @ref ecu_ntnode_valid()
  *      - TEST(NtNode, Valid)
  * 
+ * @ref ecu_ntnode_is_dirty(), @ref ecu_ntnode_mark_dirty(), @ref ecu_ntnode_refresh().
+ * Only run if ECU_NTNODE_DIRTY is defined.
+ *      - TEST(NtNode, DirtyNewNodeIsDirty)
+ *      - TEST(NtNode, DirtyRefreshWholeTree)
+ *      - TEST(NtNode, DirtyRefreshCleanTree)
+ *      - TEST(NtNode, DirtyMarkDirtyMarksAncestors)
+ *      - TEST(NtNode, DirtyRefreshOnlyDirtyNodes)
+ *      - TEST(NtNode, DirtyRefreshMultipleBranches)
+ *      - TEST(NtNode, DirtyRefreshSubtree)
+ *      - TEST(NtNode, DirtyPushChildMarksAncestors)
+ *      - TEST(NtNode, DirtyInsertSiblingMarksAncestors)
+ *      - TEST(NtNode, DirtyRemoveMarksOldAncestors)
+ *      - TEST(NtNode, DirtyRemoveRoot)
+ *      - TEST(NtNode, DirtyClearMarksNodes)
+ *      - TEST(NtNode, DirtyRefreshNullCombine)
+ *      - TEST(NtNode, DirtyMoveMarksOldAndNewAncestors)
+ * 
+ * @ref ecu_ntnode_index_ctor(), @ref ecu_ntnode_attach_index(), @ref ecu_ntnode_detach_index().
+ * Only run if ECU_NTNODE_INDEXED is defined.
+ *      - TEST(NtNode, IndexAttachToNodeWithChildren)
+ *      - TEST(NtNode, IndexPushAndInsertChildren)
+ *      - TEST(NtNode, IndexRemoveAndMoveChildren)
+ *      - TEST(NtNode, IndexClearAndDestroy)
+ *      - TEST(NtNode, IndexRemoveFromFullIndex)
+ *      - TEST(NtNode, IndexDuplicateIds)
+ *      - TEST(NtNode, IndexDetach)
+ *      - TEST(NtNode, IndexResolve)
+ *      - TEST(NtNode, IndexFull)
+ *      - TEST(NtNode, IndexCapacityNotPowerOfTwo)
+ *      - TEST(NtNode, IndexAttachTwice)
+ *      - TEST(NtNode, IndexMoveSubtreesAndChildren)
+ * 
+ * @ref ecu_ntnode_epoch_ctor(), @ref ecu_ntnode_attach_epoch(), @ref ecu_ntnode_fast_clear().
+ * Only run if ECU_NTNODE_FAST_CLEAR is defined.
+ *      - TEST(NtNode, FastClearEmptiesTree)
+ *      - TEST(NtNode, FastClearReuseNodesInSameTree)
+ *      - TEST(NtNode, FastClearReuseNodesInOtherTree)
+ *      - TEST(NtNode, FastClearRepeatedly)
+ *      - TEST(NtNode, FastClearGenerationPast32Bits)
+ *      - TEST(NtNode, FastClearGenerationExhausted)
+ *      - TEST(NtNode, FastClearSubtreesTakenOutSurvive)
+ *      - TEST(NtNode, FastClearSubtreesBroughtIn)
+ *      - TEST(NtNode, FastClearRemoveClearAndDestroyFormerNodes)
+ *      - TEST(NtNode, FastClearAfterClear)
+ *      - TEST(NtNode, FastClearInsertSiblingOfFormerNode)
+ *      - TEST(NtNode, FastClearWithoutEpoch)
+ *      - TEST(NtNode, FastClearNodeIsDescendant)
+ *      - TEST(NtNode, FastClearFormerNodeParent)
+ *      - TEST(NtNode, FastClearFormerNodeNext)
+ *      - TEST(NtNode, FastClearFormerNodeFirstChild)
+ *      - TEST(NtNode, FastClearFormerNodeIterator)
+ *      - TEST(NtNode, FastClearAttachEpochTwice)
+ *      - TEST(NtNode, FastClearResetsPositions)
+ *      - TEST(NtNode, FastClearMarksDirty). Only run if ECU_NTNODE_DIRTY is also defined.
+ *      - TEST(NtNode, FastClearEmptiesIndexes). Only run if ECU_NTNODE_INDEXED is also defined.
+ * 
  * Iterators:
  * 
  * @ref ECU_NTNODE_CHILD_FOR_EACH(), @ref ECU_NTNODE_CONST_CHILD_FOR_EACH(),
@@ -328,6 +448,48 @@
  *      - TEST(NtNode, PreorderIteratorMultipleTimes)
  *      - TEST(NtNode, ConstPreorderIteratorMultipleTimes)
  * 
+ * @ref ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(), @ref ECU_NTNODE_CONST_PRUNED_PREORDER_FOR_EACH(),
+ * @ref ECU_NTNODE_PRUNED_PREORDER_LIMIT_FOR_EACH(), @ref ECU_NTNODE_CONST_PRUNED_PREORDER_LIMIT_FOR_EACH(),
+ * @ref ecu_ntnode_pruned_preorder_iterator_skip(), @ref ecu_ntnode_pruned_preorder_iterator_level(),
+ * @ref ecu_ntnode_pruned_preorder_iterator_cskip(), @ref ecu_ntnode_pruned_preorder_iterator_clevel()
+ *      - TEST(NtNode, PrunedPreorderIteratorNoSkip)
+ *      - TEST(NtNode, PrunedPreorderIteratorStartIsMiddleSubtree)
+ *      - TEST(NtNode, PrunedPreorderIteratorNextAfterDone)
+ *      - TEST(NtNode, PrunedPreorderIteratorSkipSubtree)
+ *      - TEST(NtNode, ConstPrunedPreorderIteratorSkipSubtree)
+ *      - TEST(NtNode, PrunedPreorderIteratorSkipLastSubtree)
+ *      - TEST(NtNode, PrunedPreorderIteratorSkipLeaf)
+ *      - TEST(NtNode, PrunedPreorderIteratorSkipRoot)
+ *      - TEST(NtNode, PrunedPreorderIteratorSkipAfterDone)
+ *      - TEST(NtNode, PrunedPreorderIteratorLevel)
+ *      - TEST(NtNode, ConstPrunedPreorderIteratorLevel)
+ *      - TEST(NtNode, PrunedPreorderLimitIterator)
+ *      - TEST(NtNode, ConstPrunedPreorderLimitIterator)
+ *      - TEST(NtNode, PrunedPreorderLimitIteratorMaxLevelIsZero)
+ *      - TEST(NtNode, PrunedPreorderLimitIteratorSkipSubtree)
+ * 
+ * @ref ECU_NTNODE_LEVELORDER_FOR_EACH(), @ref ECU_NTNODE_CONST_LEVELORDER_FOR_EACH(),
+ * @ref ECU_NTNODE_LEVELORDER_LIMIT_FOR_EACH(), @ref ECU_NTNODE_CONST_LEVELORDER_LIMIT_FOR_EACH(),
+ * @ref ecu_ntnode_levelorder_iterator_begin(), @ref ecu_ntnode_levelorder_iterator_limit(),
+ * @ref ecu_ntnode_levelorder_iterator_end(), @ref ecu_ntnode_levelorder_iterator_next(),
+ * @ref ecu_ntnode_levelorder_iterator_level(), @ref ecu_ntnode_levelorder_iterator_cbegin(),
+ * @ref ecu_ntnode_levelorder_iterator_climit(), @ref ecu_ntnode_levelorder_iterator_cend(),
+ * @ref ecu_ntnode_levelorder_iterator_cnext(), @ref ecu_ntnode_levelorder_iterator_clevel()
+ *      - TEST(NtNode, LevelorderIterator)
+ *      - TEST(NtNode, ConstLevelorderIterator)
+ *      - TEST(NtNode, LevelorderIteratorStartIsMiddleSubtree)
+ *      - TEST(NtNode, LevelorderIteratorStartIsEmptyRoot)
+ *      - TEST(NtNode, LevelorderIteratorStartIsRootOfDegenerateTree)
+ *      - TEST(NtNode, LevelorderIteratorLevelStartsInLaterSubtree)
+ *      - TEST(NtNode, LevelorderIteratorLevel)
+ *      - TEST(NtNode, ConstLevelorderIteratorLevel)
+ *      - TEST(NtNode, LevelorderLimitIterator)
+ *      - TEST(NtNode, ConstLevelorderLimitIterator)
+ *      - TEST(NtNode, LevelorderLimitIteratorMaxLevelIsZero)
+ *      - TEST(NtNode, LevelorderLimitIteratorMaxLevelPastLeaves)
+ *      - TEST(NtNode, LevelorderIteratorRemoveNodeInNonEmptyTree)
+ *      - TEST(NtNode, LevelorderIteratorNextAfterDone)
+ * 
  * @ref ECU_NTNODE_PREV_SIBLING_AT_FOR_EACH(), @ref ECU_NTNODE_CONST_PREV_SIBLING_AT_FOR_EACH(),
  * @ref ecu_ntnode_prev_sibling_iterator_at(), @ref ecu_ntnode_prev_sibling_iterator_end(),
  * @ref ecu_ntnode_prev_sibling_iterator_next(), @ref ecu_ntnode_prev_sibling_iterator_cat(),
@@ -414,8 +576,11 @@
 
 /* STDLib. */
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 /* Stubs. */
 #include "stubs/stub_asserter.hpp"
@@ -1053,6 +1218,102 @@ TEST_GROUP(NtNode)
         return status;
     }
 
+    /// @brief Verifies @ref ecu_ntnode_count(), @ref ecu_ntnode_size(),
+    /// and @ref ecu_ntnode_level() of every node in @p root's tree against
+    /// values computed by walking the tree. Catches stale cached values
+    /// if ECU_NTNODE_COUNTED is defined.
+    static void CHECK_COUNTS(const ecu_ntnode& root)
+    {
+        ecu_ntnode_preorder_citerator citer;
+
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &root)
+        {
+            std::size_t count = 0;
+            std::size_t size = 0;
+            std::size_t level = 0;
+            ecu_ntnode_child_citerator child_citer;
+            ecu_ntnode_postorder_citerator postorder_citer;
+            ecu_ntnode_parent_citerator parent_citer;
+
+            ECU_NTNODE_CONST_CHILD_FOR_EACH(c, &child_citer, n)
+            {
+                (void)c;
+                count++;
+            }
+
+            ECU_NTNODE_CONST_POSTORDER_FOR_EACH(d, &postorder_citer, n)
+            {
+                if (d != n)
+                {
+                    size++;
+                }
+            }
+
+            ECU_NTNODE_CONST_PARENT_FOR_EACH(p, &parent_citer, n)
+            {
+                (void)p;
+                level++;
+            }
+
+            UNSIGNED_LONGS_EQUAL(count, ecu_ntnode_count(n));
+            UNSIGNED_LONGS_EQUAL(size, ecu_ntnode_size(n));
+            UNSIGNED_LONGS_EQUAL(level, ecu_ntnode_level(n));
+        }
+    }
+
+    /// @brief Verifies every child of @p parent is found by
+    /// @ref ecu_ntnode_find_child_by_id(). Children must have
+    /// unique IDs. Catches stale entries in the child index
+    /// if ECU_NTNODE_INDEXED is defined.
+    static void CHECK_FINDS_CHILDREN(ecu_ntnode& parent)
+    {
+        ecu_ntnode_child_iterator iter;
+
+        ECU_NTNODE_CHILD_FOR_EACH(c, &iter, &parent)
+        {
+            CHECK_TRUE( (ecu_ntnode_find_child_by_id(&parent, ecu_ntnode_id(c)) == c) );
+            CHECK_TRUE( (ecu_ntnode_find_cchild_by_id(&parent, ecu_ntnode_id(c)) == c) );
+        }
+    }
+
+    /// @brief Verifies @ref ecu_ntnode_nth_child(), @ref ecu_ntnode_nth_cchild(),
+    /// and @ref ecu_ntnode_index_of() of every child of @p parent against
+    /// the sibling list.
+    static void CHECK_POSITIONS(ecu_ntnode& parent)
+    {
+        ecu_ntnode_child_iterator iter;
+        std::size_t i = 0;
+
+        ECU_NTNODE_CHILD_FOR_EACH(c, &iter, &parent)
+        {
+            CHECK_TRUE( (ecu_ntnode_nth_child(&parent, i) == c) );
+            CHECK_TRUE( (ecu_ntnode_nth_cchild(&parent, i) == c) );
+            UNSIGNED_LONGS_EQUAL(i, ecu_ntnode_index_of(c));
+            i++;
+        }
+
+        UNSIGNED_LONGS_EQUAL(i, ecu_ntnode_count(&parent));
+        CHECK_TRUE( (ecu_ntnode_nth_child(&parent, i) == nullptr) );
+    }
+
+    /// @brief Verifies @p parent's children are exactly @p expected,
+    /// in order. Then verifies their positions via @ref CHECK_POSITIONS().
+    static void CHECK_CHILDREN(ecu_ntnode& parent, const std::vector<ecu_ntnode *>& expected)
+    {
+        ecu_ntnode_child_iterator iter;
+        std::size_t i = 0;
+
+        ECU_NTNODE_CHILD_FOR_EACH(c, &iter, &parent)
+        {
+            CHECK_TRUE( (i < expected.size()) );
+            CHECK_TRUE( (c == expected.at(i)) );
+            i++;
+        }
+
+        UNSIGNED_LONGS_EQUAL(expected.size(), i);
+        CHECK_POSITIONS(parent);
+    }
+
     /// @brief Used to verify using ntnode API within destroy
     /// callback is prohibited.
     static void use_api_in_destroy_callback(ecu_ntnode *me, ecu_object_id_t id)
@@ -1062,6 +1323,57 @@ TEST_GROUP(NtNode)
         ecu_ntnode_remove(me);
     }
 
+#if defined(ECU_NTNODE_DIRTY)
+    /// @brief Returns true if all supplied nodes are dirty.
+    /// False otherwise.
+    template<typename... Nodes>
+    requires (std::is_base_of_v<ntnode, Nodes> && ...)
+    static bool is_dirty(const ntnode &n0, const Nodes&... n)
+    {
+        bool status = ecu_ntnode_is_dirty(&n0);
+
+        if constexpr(sizeof...(Nodes) > 0)
+        {
+            status = status && ((ecu_ntnode_is_dirty(&n)) && ...); /* Only keep evaluating if true return. */
+        }
+
+        return status;
+    }
+
+    /// @brief Returns true if all supplied nodes are clean.
+    /// False otherwise.
+    template<typename... Nodes>
+    requires (std::is_base_of_v<ntnode, Nodes> && ...)
+    static bool is_clean(const ntnode &n0, const Nodes&... n)
+    {
+        bool status = !ecu_ntnode_is_dirty(&n0);
+
+        if constexpr(sizeof...(Nodes) > 0)
+        {
+            status = status && ((!ecu_ntnode_is_dirty(&n)) && ...); /* Only keep evaluating if true return. */
+        }
+
+        return status;
+    }
+
+    /// @brief Combine callback passed to @ref ecu_ntnode_refresh().
+    /// Runs the supplied visitor on each combined node so the order
+    /// nodes are combined in can be verified.
+    static void combine_in_tree(ecu_ntnode *me, void *obj)
+    {
+        assert( (me && obj) );
+        convert(me).accept(*static_cast<visitor *>(obj));
+    }
+
+    /// @brief Combine callback passed to @ref ecu_ntnode_refresh()
+    /// when the test only needs the tree to be clean.
+    static void combine_unused(ecu_ntnode *me, void *obj)
+    {
+        (void)me;
+        (void)obj;
+    }
+#endif /* ECU_NTNODE_DIRTY */
+
     node_obj_in_tree_actual_call node_obj_in_tree_visitor;
     node_remove node_remove_visitor;
     node_destroy node_destroy_visitor;
@@ -1474,6 +1786,98 @@ TEST(NtNode, CountAddAndRemoveChildren)
     }
 }
 
+/*------------------------------------------------------------*/
+/*------------ TESTS - ECU_NTNODE_FIND_CHILD_BY_ID -----------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Child with matching ID returned.
+ */
+TEST(NtNode, FindChildByIdChildExists)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        root
+        |
+        n1-----n2-----n3
+        */
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        add_children(root, n1, n2, n3);
+        ecu_ntnode *found;
+        const ecu_ntnode *cfound;
+
+        /* Steps 2 and 3: Action and assert. */
+        found = ecu_ntnode_find_child_by_id(&root, 2);
+        cfound = ecu_ntnode_find_cchild_by_id(&root, 3);
+        CHECK_TRUE( (found == &n2) );
+        CHECK_TRUE( (cfound == &n3) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief NULL returned. Only children are searched,
+ * not grandchildren or the node itself.
+ */
+TEST(NtNode, FindChildByIdChildDoesNotExist)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        root
+        |
+        n1-----n2
+        |
+        n3
+        */
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        add_children(root, n1, n2);
+        add_children(n1, n3);
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&root, 3)) );
+        CHECK_TRUE( (!ecu_ntnode_find_cchild_by_id(&root, 0)) );
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&root, 4)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief NULL returned.
+ */
+TEST(NtNode, FindChildByIdNodeWithNoChildren)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode root{0};
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&root, 0)) );
+        CHECK_TRUE( (!ecu_ntnode_find_cchild_by_id(&root, 0)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
 /*------------------------------------------------------------*/
 /*-------------- TESTS - ECU_NTNODE_FIRST_CHILD --------------*/
 /*------------------------------------------------------------*/
@@ -1714,50 +2118,39 @@ TEST(NtNode, InTreeNodeIsLeaf)
 }
 
 /*------------------------------------------------------------*/
-/*--------- TESTS - ECU_NTNODE_INSERT_SIBLING_AFTER ----------*/
+/*----------------- TESTS - ECU_NTNODE_INDEX_OF --------------*/
 /*------------------------------------------------------------*/
 
 /**
- * @brief Sibling inserted correctly.
- * @warning Test validation requires working postorder iterator.
+ * @brief Position among siblings returned. Only
+ * siblings are counted, not cousins.
  */
-TEST(NtNode, InsertSiblingAfterPosIsLeftMostSubroot)
+TEST(NtNode, IndexOfChildren)
 {
     try
     {
         /* Step 1: Arrange.
-        
-        Before:
-        RW0                             RW8
-        |                               |
-        RW1---------RW2-----RW3         RW9---RW10
-        |           |       |
-        RW4---RW5   RW6     RW7
-
-        After:
-        RW0
+        root
         |
-        RW1---------RW8---------RW2-----RW3
-        |           |           |       |
-        RW4---RW5   RW9---RW10  RW6     RW7
+        n1-----n2-----n3
+        |
+        n4-----n5
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(3), RW.at(7));
-        add_children(RW.at(8), RW.at(9), RW.at(10));
-
-        /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_after(&RW.at(1), &RW.at(8));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        rw_ntnode n5{5};
+        add_children(root, n1, n2, n3);
+        add_children(n1, n4, n5);
 
-        /* Step 3: Assert. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(9), RW.at(10), RW.at(8),
-                             RW.at(6), RW.at(2), RW.at(7), RW.at(3), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Steps 2 and 3: Action and assert. */
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntnode_index_of(&n1));
+        UNSIGNED_LONGS_EQUAL(1, ecu_ntnode_index_of(&n2));
+        UNSIGNED_LONGS_EQUAL(2, ecu_ntnode_index_of(&n3));
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntnode_index_of(&n4));
+        UNSIGNED_LONGS_EQUAL(1, ecu_ntnode_index_of(&n5));
     }
     catch (const AssertException& e)
     {
@@ -1767,46 +2160,36 @@ TEST(NtNode, InsertSiblingAfterPosIsLeftMostSubroot)
 }
 
 /**
- * @brief Sibling inserted correctly.
- * @warning Test validation requires working postorder iterator.
+ * @brief Later siblings shift left after a
+ * sibling is removed.
  */
-TEST(NtNode, InsertSiblingAfterPosIsMiddleSubroot)
+TEST(NtNode, IndexOfAfterRemove)
 {
     try
     {
         /* Step 1: Arrange.
-        
-        Before:
-        RW0                             RW8
-        |                               |
-        RW1---------RW2-----RW3         RW9---RW10
-        |           |       |
-        RW4---RW5   RW6     RW7
-
-        After:
-        RW0
+        root
         |
-        RW1---------RW2-----RW8-------------RW3
-        |           |       |               |
-        RW4---RW5   RW6     RW9---RW10      RW7
+        n1-----n2-----n3-----n4
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(3), RW.at(7));
-        add_children(RW.at(8), RW.at(9), RW.at(10));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        add_children(root, n1, n2, n3, n4);
 
-        /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_after(&RW.at(2), &RW.at(8));
+        /* Step 2: Action.
+        root
+        |
+        n1-----n3-----n4
+        */
+        ecu_ntnode_remove(&n2);
 
         /* Step 3: Assert. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(6), RW.at(2), RW.at(9),
-                             RW.at(10), RW.at(8), RW.at(7), RW.at(3), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntnode_index_of(&n1));
+        UNSIGNED_LONGS_EQUAL(1, ecu_ntnode_index_of(&n3));
+        UNSIGNED_LONGS_EQUAL(2, ecu_ntnode_index_of(&n4));
     }
     catch (const AssertException& e)
     {
@@ -1816,94 +2199,62 @@ TEST(NtNode, InsertSiblingAfterPosIsMiddleSubroot)
 }
 
 /**
- * @brief Sibling inserted correctly.
- * @warning Test validation requires working postorder iterator.
+ * @brief Roots have no siblings so this
+ * is not allowed.
  */
-TEST(NtNode, InsertSiblingAfterPosIsRightMostSubroot)
+TEST(NtNode, IndexOfNodeIsRoot)
 {
     try
     {
-        /* Step 1: Arrange.
-        
-        Before:
-        RW0                             RW8
-        |                               |
-        RW1---------RW2-----RW3         RW9---RW10
-        |           |       |
-        RW4---RW5   RW6     RW7
-
-        After:
-        RW0
-        |
-        RW1---------RW2-----RW3-----RW8
-        |           |       |       |
-        RW4---RW5   RW6     RW7     RW9---RW10
-        */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(3), RW.at(7));
-        add_children(RW.at(8), RW.at(9), RW.at(10));
-
-        /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_after(&RW.at(3), &RW.at(8));
+        /* Step 1: Arrange. */
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        add_children(root, n1);
+        EXPECT_ASSERTION();
 
-        /* Step 3: Assert. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(6), RW.at(2), RW.at(7),
-                             RW.at(3), RW.at(9), RW.at(10), RW.at(8), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Steps 2 and 3: Action and assert. */
+        (void)ecu_ntnode_index_of(&root);
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
+/*------------------------------------------------------------*/
+/*-------------- TESTS - ECU_NTNODE_INSERT_CHILD_AT ----------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Sibling inserted correctly.
- * @warning Test validation requires working postorder iterator.
+ * @brief Child becomes the first child.
  */
-TEST(NtNode, InsertSiblingAfterPosIsLeaf)
+TEST(NtNode, InsertChildAtFront)
 {
     try
     {
         /* Step 1: Arrange.
-        
-        Before:
-        RW0                         RW6
-        |                           |
-        RW1---RW2---RW3             RW7
-                    |
-                    RW4---RW5
-
-        After:
-        RW0
+        root
         |
-        RW1---RW2---RW3
-                    |
-                    RW4---RW5---RW6
-                                |
-                                RW7
+        n1-----n2
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        add_children(root, n1, n2);
 
-        /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_after(&RW.at(5), &RW.at(6));
+        /* Step 2: Action.
+        root
+        |
+        n3-----n1-----n2
+        */
+        ecu_ntnode_insert_child_at(&root, &n3, 0);
 
         /* Step 3: Assert. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(4), RW.at(5), RW.at(7), RW.at(6), RW.at(3), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_first_child(&root) == &n3) );
+        CHECK_TRUE( (ecu_ntnode_next(&n3) == &n1) );
+        CHECK_POSITIONS(root);
     }
     catch (const AssertException& e)
     {
@@ -1913,37 +2264,75 @@ TEST(NtNode, InsertSiblingAfterPosIsLeaf)
 }
 
 /**
- * @brief Sibling inserted correctly.
- * @warning Test validation requires working postorder iterator.
+ * @brief Child is inserted before the child
+ * previously at the index.
  */
-TEST(NtNode, InsertSiblingAfterSiblingIsEmptyRoot)
+TEST(NtNode, InsertChildAtMiddle)
 {
     try
     {
         /* Step 1: Arrange.
+        root
+        |
+        n1-----n2-----n3
+        */
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        add_children(root, n1, n2, n3);
 
-        Before:
-        RW0             RW3
+        /* Step 2: Action.
+        root
         |
-        RW1---RW2
-        
-        After:
-        RW0
+        n1-----n2-----n4-----n3
+        */
+        ecu_ntnode_insert_child_at(&root, &n4, 2);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (ecu_ntnode_next(&n2) == &n4) );
+        CHECK_TRUE( (ecu_ntnode_next(&n4) == &n3) );
+        CHECK_TRUE( (ecu_ntnode_parent(&n4) == &root) );
+        CHECK_POSITIONS(root);
+        CHECK_COUNTS(root);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Index equal to the number of children
+ * appends the child.
+ */
+TEST(NtNode, InsertChildAtBack)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        root
         |
-        RW1---RW2---RW3
+        n1-----n2
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        add_children(root, n1, n2);
 
-        /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_after(&RW.at(2), &RW.at(3));
+        /* Step 2: Action.
+        root
+        |
+        n1-----n2-----n3
+        */
+        ecu_ntnode_insert_child_at(&root, &n3, 2);
 
         /* Step 3: Assert. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_last_child(&root) == &n3) );
+        CHECK_POSITIONS(root);
     }
     catch (const AssertException& e)
     {
@@ -1953,75 +2342,95 @@ TEST(NtNode, InsertSiblingAfterSiblingIsEmptyRoot)
 }
 
 /**
- * @brief Not allowed. Position cannot be root.
+ * @brief Child becomes the only child.
  */
-TEST(NtNode, InsertSiblingAfterPosIsEmptyRoot)
+TEST(NtNode, InsertChildAtParentHasNoChildren)
 {
     try
     {
         /* Step 1: Arrange. */
-        rw_ntnode root;
-        rw_ntnode sibling;
-        EXPECT_ASSERTION();
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
 
         /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_after(&root, &sibling);
+        ecu_ntnode_insert_child_at(&root, &n1, 0);
 
-        /* Step 3: Assert. Test fails if assertion does not fire. */
+        /* Step 3: Assert. */
+        CHECK_TRUE( (ecu_ntnode_first_child(&root) == &n1) );
+        CHECK_TRUE( (ecu_ntnode_last_child(&root) == &n1) );
+        CHECK_POSITIONS(root);
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Not allowed. Position cannot be root.
+ * @brief Child's subtree stays intact.
  */
-TEST(NtNode, InsertSiblingAfterPosIsNonEmptyRoot)
+TEST(NtNode, InsertChildAtChildIsNonEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange. 
-        RW0             RW3
-        |
-        RW1---RW2
+        /* Step 1: Arrange.
+        root        n3
+        |           |
+        n1-----n2   n4-----n5
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        EXPECT_ASSERTION();
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        rw_ntnode n5{5};
+        add_children(root, n1, n2);
+        add_children(n3, n4, n5);
 
-        /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_after(&RW.at(0), &RW.at(3));
+        /* Step 2: Action.
+        root
+        |
+        n1-----n3-----n2
+               |
+               n4-----n5
+        */
+        ecu_ntnode_insert_child_at(&root, &n3, 1);
 
-        /* Step 3: Assert. Test fails if assertion does not fire. */
+        /* Step 3: Assert. */
+        CHECK_TRUE( (ecu_ntnode_nth_child(&root, 1) == &n3) );
+        CHECK_POSITIONS(root);
+        CHECK_POSITIONS(n3);
+        CHECK_COUNTS(root);
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Not allowed.
+ * @brief Index past the end is not allowed.
  */
-TEST(NtNode, InsertSiblingAfterPosEqualsSibling)
+TEST(NtNode, InsertChildAtIndexOutOfRange)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0
+        root
         |
-        RW1
+        n1-----n2
         */
-        add_children(RW.at(0), RW.at(1));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        add_children(root, n1, n2);
         EXPECT_ASSERTION();
 
-        /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_after(&RW.at(1), &RW.at(1));
-
-        /* Step 3: Assert. Test fails if assertion does not fire. */
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_insert_child_at(&root, &n3, 3);
     }
     catch (const AssertException& e)
     {
@@ -2031,25 +2440,26 @@ TEST(NtNode, InsertSiblingAfterPosEqualsSibling)
 }
 
 /**
- * @brief Not allowed.
+ * @brief Node already in a tree must be
+ * removed first.
  */
-TEST(NtNode, InsertSiblingAfterSiblingIsDescendant)
+TEST(NtNode, InsertChildAtChildIsDescendant)
 {
     try
     {
-        /* Step 1: Arrange. Insert RW3 after RW1.
-        RW0     RW2
-        |       |
-        RW1     RW3 
+        /* Step 1: Arrange.
+        root
+        |
+        n1-----n2
         */
-        add_children(RW.at(0), RW.at(1));
-        add_children(RW.at(2), RW.at(3));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        add_children(root, n1, n2);
         EXPECT_ASSERTION();
 
-        /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_after(&RW.at(1), &RW.at(3));
-
-        /* Step 3: Assert. Test fails if assertion does not fire. */
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_insert_child_at(&root, &n2, 0);
     }
     catch (const AssertException& e)
     {
@@ -2058,48 +2468,43 @@ TEST(NtNode, InsertSiblingAfterSiblingIsDescendant)
     }
 }
 
-/*------------------------------------------------------------*/
-/*--------- TESTS - ECU_NTNODE_INSERT_SIBLING_BEFORE ---------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief Sibling inserted correctly.
- * @warning Test validation requires working postorder iterator.
+ * @brief Many children inserted and removed at arbitrary
+ * positions. Sibling order always matches a reference list
+ * and every position lookup agrees with it.
  */
-TEST(NtNode, InsertSiblingBeforePosIsLeftMostSubroot)
+TEST(NtNode, InsertChildAtRandomPositions)
 {
     try
     {
-        /* Step 1: Arrange.
-        
-        Before:
-        RW0         RW4
-        |           |
-        RW1         RW5---RW6
-        |
-        RW2---RW3
+        /* Step 1: Arrange. Fixed seed so failures are reproducible. */
+        std::vector<ecu_ntnode *> expected;
+        std::uint32_t seed = 1;
+        auto random = [&seed](std::size_t max) -> std::size_t {
+            seed = (seed * UINT32_C(1664525)) + UINT32_C(1013904223);
+            return static_cast<std::size_t>(seed >> 8) % max;
+        };
 
-        After:
-        RW0
-        |
-        RW4---------RW1
-        |           |
-        RW5---RW6   RW2---RW3
-        */
-        add_children(RW.at(0), RW.at(1));
-        add_children(RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(4), RW.at(5), RW.at(6));
+        /* Steps 2 and 3: Action and assert. Insert every node, then
+        remove every other one at a random position. */
+        for (std::size_t i = 1; i < RW.size(); i++)
+        {
+            std::size_t index = random(expected.size() + 1);
+            ecu_ntnode_insert_child_at(&RW.at(0), &RW.at(i), index);
+            expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(index), &RW.at(i));
+        }
 
-        /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_before(&RW.at(1), &RW.at(4));
+        CHECK_CHILDREN(RW.at(0), expected);
 
-        /* Step 3: Assert. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6), RW.at(4), RW.at(2), RW.at(3), RW.at(1), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        while (expected.size() > (RW.size() / 2))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            std::size_t index = random(expected.size());
+            CHECK_TRUE( (ecu_ntnode_nth_child(&RW.at(0), index) == expected.at(index)) );
+            ecu_ntnode_remove(expected.at(index));
+            expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(index));
         }
+
+        CHECK_CHILDREN(RW.at(0), expected);
     }
     catch (const AssertException& e)
     {
@@ -2108,40 +2513,47 @@ TEST(NtNode, InsertSiblingBeforePosIsLeftMostSubroot)
     }
 }
 
+/*------------------------------------------------------------*/
+/*--------- TESTS - ECU_NTNODE_INSERT_SIBLING_AFTER ----------*/
+/*------------------------------------------------------------*/
+
 /**
  * @brief Sibling inserted correctly.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, InsertSiblingBeforePosIsMiddleSubroot)
+TEST(NtNode, InsertSiblingAfterPosIsLeftMostSubroot)
 {
     try
     {
         /* Step 1: Arrange.
         
         Before:
-        RW0                     RW5
-        |                       |
-        RW1-----RW2---RW3       RW6
-                |
-                RW4
+        RW0                             RW8
+        |                               |
+        RW1---------RW2-----RW3         RW9---RW10
+        |           |       |
+        RW4---RW5   RW6     RW7
 
         After:
         RW0
         |
-        RW1-----RW5-----RW2---RW3
-                |       |
-                RW6     RW4
+        RW1---------RW8---------RW2-----RW3
+        |           |           |       |
+        RW4---RW5   RW9---RW10  RW6     RW7
         */
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(2), RW.at(4));
-        add_children(RW.at(5), RW.at(6));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(3), RW.at(7));
+        add_children(RW.at(8), RW.at(9), RW.at(10));
 
         /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_before(&RW.at(2), &RW.at(5));
+        ecu_ntnode_insert_sibling_after(&RW.at(1), &RW.at(8));
 
         /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(6), RW.at(5), RW.at(4), RW.at(2), RW.at(3), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(9), RW.at(10), RW.at(8),
+                             RW.at(6), RW.at(2), RW.at(7), RW.at(3), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
@@ -2158,39 +2570,39 @@ TEST(NtNode, InsertSiblingBeforePosIsMiddleSubroot)
  * @brief Sibling inserted correctly.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, InsertSiblingBeforePosIsRightMostSubroot)
+TEST(NtNode, InsertSiblingAfterPosIsMiddleSubroot)
 {
     try
     {
         /* Step 1: Arrange.
         
         Before:
-        RW0                 RW5
-        |                   |
-        RW1-----RW2         RW6
-        |       |           |
-        RW3     RW4         RW7
-        
+        RW0                             RW8
+        |                               |
+        RW1---------RW2-----RW3         RW9---RW10
+        |           |       |
+        RW4---RW5   RW6     RW7
+
         After:
         RW0
         |
-        RW1-----RW5-----RW2
-        |       |       |
-        RW3     RW6     RW4
-                |
-                RW7
+        RW1---------RW2-----RW8-------------RW3
+        |           |       |               |
+        RW4---RW5   RW6     RW9---RW10      RW7
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3));
-        add_children(RW.at(2), RW.at(4));
-        add_branch(RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(3), RW.at(7));
+        add_children(RW.at(8), RW.at(9), RW.at(10));
 
         /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_before(&RW.at(2), &RW.at(5));
+        ecu_ntnode_insert_sibling_after(&RW.at(2), &RW.at(8));
 
         /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(1), RW.at(7), RW.at(6), RW.at(5), RW.at(4), RW.at(2), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(6), RW.at(2), RW.at(9),
+                             RW.at(10), RW.at(8), RW.at(7), RW.at(3), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
@@ -2205,34 +2617,41 @@ TEST(NtNode, InsertSiblingBeforePosIsRightMostSubroot)
 
 /**
  * @brief Sibling inserted correctly.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, InsertSiblingBeforePosIsLeaf)
+TEST(NtNode, InsertSiblingAfterPosIsRightMostSubroot)
 {
     try
     {
         /* Step 1: Arrange.
         
         Before:
-        RW0     RW2
-        |       |
-        RW1     RW3
-        
+        RW0                             RW8
+        |                               |
+        RW1---------RW2-----RW3         RW9---RW10
+        |           |       |
+        RW4---RW5   RW6     RW7
+
         After:
         RW0
         |
-        RW2---RW1
-        |
-        RW3
+        RW1---------RW2-----RW3-----RW8
+        |           |       |       |
+        RW4---RW5   RW6     RW7     RW9---RW10
         */
-        add_children(RW.at(0), RW.at(1));
-        add_children(RW.at(2), RW.at(3));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(3), RW.at(7));
+        add_children(RW.at(8), RW.at(9), RW.at(10));
 
         /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_before(&RW.at(1), &RW.at(2));
+        ecu_ntnode_insert_sibling_after(&RW.at(3), &RW.at(8));
 
         /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(6), RW.at(2), RW.at(7),
+                             RW.at(3), RW.at(9), RW.at(10), RW.at(8), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
@@ -2247,35 +2666,80 @@ TEST(NtNode, InsertSiblingBeforePosIsLeaf)
 
 /**
  * @brief Sibling inserted correctly.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, InsertSiblingBeforeSiblingIsEmptyRoot)
+TEST(NtNode, InsertSiblingAfterPosIsLeaf)
 {
     try
     {
         /* Step 1: Arrange.
         
         Before:
-        RW0         RW3
-        |
-        RW1
+        RW0                         RW6
+        |                           |
+        RW1---RW2---RW3             RW7
+                    |
+                    RW4---RW5
+
+        After:
+        RW0
         |
-        RW2
+        RW1---RW2---RW3
+                    |
+                    RW4---RW5---RW6
+                                |
+                                RW7
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_after(&RW.at(5), &RW.at(6));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(4), RW.at(5), RW.at(7), RW.at(6), RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Sibling inserted correctly.
+ * @warning Test validation requires working postorder iterator.
+ */
+TEST(NtNode, InsertSiblingAfterSiblingIsEmptyRoot)
+{
+    try
+    {
+        /* Step 1: Arrange.
 
+        Before:
+        RW0             RW3
+        |
+        RW1---RW2
+        
         After:
         RW0
         |
-        RW3-----RW1
-                |
-                RW2
+        RW1---RW2---RW3
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
 
         /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_before(&RW.at(1), &RW.at(3));
+        ecu_ntnode_insert_sibling_after(&RW.at(2), &RW.at(3));
 
         /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
@@ -2291,17 +2755,17 @@ TEST(NtNode, InsertSiblingBeforeSiblingIsEmptyRoot)
 /**
  * @brief Not allowed. Position cannot be root.
  */
-TEST(NtNode, InsertSiblingBeforePosIsEmptyRoot)
+TEST(NtNode, InsertSiblingAfterPosIsEmptyRoot)
 {
     try
     {
         /* Step 1: Arrange. */
-        rw_ntnode empty_root;
+        rw_ntnode root;
         rw_ntnode sibling;
         EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_before(&empty_root, &sibling);
+        ecu_ntnode_insert_sibling_after(&root, &sibling);
 
         /* Step 3: Assert. Test fails if assertion does not fire. */
     }
@@ -2315,7 +2779,7 @@ TEST(NtNode, InsertSiblingBeforePosIsEmptyRoot)
 /**
  * @brief Not allowed. Position cannot be root.
  */
-TEST(NtNode, InsertSiblingBeforePosIsNonEmptyRoot)
+TEST(NtNode, InsertSiblingAfterPosIsNonEmptyRoot)
 {
     try
     {
@@ -2328,7 +2792,7 @@ TEST(NtNode, InsertSiblingBeforePosIsNonEmptyRoot)
         EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_before(&RW.at(0), &RW.at(3));
+        ecu_ntnode_insert_sibling_after(&RW.at(0), &RW.at(3));
 
         /* Step 3: Assert. Test fails if assertion does not fire. */
     }
@@ -2342,7 +2806,7 @@ TEST(NtNode, InsertSiblingBeforePosIsNonEmptyRoot)
 /**
  * @brief Not allowed.
  */
-TEST(NtNode, InsertSiblingBeforePosEqualsSibling)
+TEST(NtNode, InsertSiblingAfterPosEqualsSibling)
 {
     try
     {
@@ -2355,7 +2819,7 @@ TEST(NtNode, InsertSiblingBeforePosEqualsSibling)
         EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_before(&RW.at(1), &RW.at(1));
+        ecu_ntnode_insert_sibling_after(&RW.at(1), &RW.at(1));
 
         /* Step 3: Assert. Test fails if assertion does not fire. */
     }
@@ -2369,21 +2833,21 @@ TEST(NtNode, InsertSiblingBeforePosEqualsSibling)
 /**
  * @brief Not allowed.
  */
-TEST(NtNode, InsertSiblingBeforeSiblingIsDescendant)
+TEST(NtNode, InsertSiblingAfterSiblingIsDescendant)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. Insert RW3 after RW1.
         RW0     RW2
         |       |
-        RW1     RW3
+        RW1     RW3 
         */
         add_children(RW.at(0), RW.at(1));
         add_children(RW.at(2), RW.at(3));
         EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_insert_sibling_before(&RW.at(1), &RW.at(3));
+        ecu_ntnode_insert_sibling_after(&RW.at(1), &RW.at(3));
 
         /* Step 3: Assert. Test fails if assertion does not fire. */
     }
@@ -2395,21 +2859,47 @@ TEST(NtNode, InsertSiblingBeforeSiblingIsDescendant)
 }
 
 /*------------------------------------------------------------*/
-/*------------- TESTS - ECU_NTNODE_IS_DESCENDANT -------------*/
+/*--------- TESTS - ECU_NTNODE_INSERT_SIBLING_BEFORE ---------*/
 /*------------------------------------------------------------*/
 
 /**
- * @brief Not descendant returned.
+ * @brief Sibling inserted correctly.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, IsDescendantNodeIsEmptyRoot)
+TEST(NtNode, InsertSiblingBeforePosIsLeftMostSubroot)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
+        /* Step 1: Arrange.
+        
+        Before:
+        RW0         RW4
+        |           |
+        RW1         RW5---RW6
+        |
+        RW2---RW3
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_FALSE( (ecu_ntnode_is_descendant(&empty_root)) );
+        After:
+        RW0
+        |
+        RW4---------RW1
+        |           |
+        RW5---RW6   RW2---RW3
+        */
+        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(4), RW.at(5), RW.at(6));
+
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_before(&RW.at(1), &RW.at(4));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6), RW.at(4), RW.at(2), RW.at(3), RW.at(1), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
     }
     catch (const AssertException& e)
     {
@@ -2419,21 +2909,43 @@ TEST(NtNode, IsDescendantNodeIsEmptyRoot)
 }
 
 /**
- * @brief Not descendant returned.
+ * @brief Sibling inserted correctly.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, IsDescendantNodeIsNonEmptyRoot)
+TEST(NtNode, InsertSiblingBeforePosIsMiddleSubroot)
 {
     try
     {
         /* Step 1: Arrange.
+        
+        Before:
+        RW0                     RW5
+        |                       |
+        RW1-----RW2---RW3       RW6
+                |
+                RW4
+
+        After:
         RW0
         |
-        RW1
+        RW1-----RW5-----RW2---RW3
+                |       |
+                RW6     RW4
         */
-        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(2), RW.at(4));
+        add_children(RW.at(5), RW.at(6));
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_FALSE( (ecu_ntnode_is_descendant(&RW.at(0))) );
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_before(&RW.at(2), &RW.at(5));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(6), RW.at(5), RW.at(4), RW.at(2), RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
     }
     catch (const AssertException& e)
     {
@@ -2443,23 +2955,46 @@ TEST(NtNode, IsDescendantNodeIsNonEmptyRoot)
 }
 
 /**
- * @brief Is descendant returned.
+ * @brief Sibling inserted correctly.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, IsDescendantNodeIsNonEmptySubroot)
+TEST(NtNode, InsertSiblingBeforePosIsRightMostSubroot)
 {
     try
     {
         /* Step 1: Arrange.
+        
+        Before:
+        RW0                 RW5
+        |                   |
+        RW1-----RW2         RW6
+        |       |           |
+        RW3     RW4         RW7
+        
+        After:
         RW0
         |
-        RW1
-        |
-        RW2
+        RW1-----RW5-----RW2
+        |       |       |
+        RW3     RW6     RW4
+                |
+                RW7
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        add_children(RW.at(2), RW.at(4));
+        add_branch(RW.at(5), RW.at(6), RW.at(7));
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_is_descendant(&RW.at(1))) );
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_before(&RW.at(2), &RW.at(5));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(1), RW.at(7), RW.at(6), RW.at(5), RW.at(4), RW.at(2), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
     }
     catch (const AssertException& e)
     {
@@ -2469,23 +3004,39 @@ TEST(NtNode, IsDescendantNodeIsNonEmptySubroot)
 }
 
 /**
- * @brief Is descendant returned.
+ * @brief Sibling inserted correctly.
  */
-TEST(NtNode, IsDescendantNodeIsLeaf)
+TEST(NtNode, InsertSiblingBeforePosIsLeaf)
 {
     try
     {
         /* Step 1: Arrange.
+        
+        Before:
+        RW0     RW2
+        |       |
+        RW1     RW3
+        
+        After:
         RW0
         |
-        RW1
+        RW2---RW1
         |
-        RW2
+        RW3
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(2), RW.at(3));
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_is_descendant(&RW.at(2))) );
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_before(&RW.at(1), &RW.at(2));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
     }
     catch (const AssertException& e)
     {
@@ -2494,58 +3045,104 @@ TEST(NtNode, IsDescendantNodeIsLeaf)
     }
 }
 
-/*------------------------------------------------------------*/
-/*----------------- TESTS - ECU_NTNODE_IS_LEAF ---------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief Is leaf returned.
+ * @brief Sibling inserted correctly.
  */
-TEST(NtNode, IsLeafNodeIsEmptyRoot)
+TEST(NtNode, InsertSiblingBeforeSiblingIsEmptyRoot)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        
+        Before:
+        RW0         RW3
+        |
+        RW1
+        |
+        RW2
+
+        After:
+        RW0
+        |
+        RW3-----RW1
+                |
+                RW2
+        */
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
+
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_before(&RW.at(1), &RW.at(3));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Position cannot be root.
+ */
+TEST(NtNode, InsertSiblingBeforePosIsEmptyRoot)
 {
     try
     {
         /* Step 1: Arrange. */
         rw_ntnode empty_root;
+        rw_ntnode sibling;
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_is_leaf(&empty_root)) );
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_before(&empty_root, &sibling);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Not a leaf returned.
+ * @brief Not allowed. Position cannot be root.
  */
-TEST(NtNode, IsLeafNodeIsNonEmptyRoot)
+TEST(NtNode, InsertSiblingBeforePosIsNonEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange.
-        RW0
+        /* Step 1: Arrange. 
+        RW0             RW3
         |
-        RW1
+        RW1---RW2
         */
-        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_FALSE( (ecu_ntnode_is_leaf(&RW.at(0))) );
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_before(&RW.at(0), &RW.at(3));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Not a leaf returned.
+ * @brief Not allowed.
  */
-TEST(NtNode, IsLeafNodeIsNonEmptySubroot)
+TEST(NtNode, InsertSiblingBeforePosEqualsSibling)
 {
     try
     {
@@ -2553,63 +3150,78 @@ TEST(NtNode, IsLeafNodeIsNonEmptySubroot)
         RW0
         |
         RW1
-        |
-        RW2
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(0), RW.at(1));
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_FALSE( (ecu_ntnode_is_leaf(&RW.at(1))) );
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_before(&RW.at(1), &RW.at(1));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Is leaf returned.
+ * @brief Not allowed.
  */
-TEST(NtNode, IsLeafNodeIsLeaf)
+TEST(NtNode, InsertSiblingBeforeSiblingIsDescendant)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0
-        |
-        RW1
-        |
-        RW2
+        RW0     RW2
+        |       |
+        RW1     RW3
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(2), RW.at(3));
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_is_leaf(&RW.at(2))) );
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_before(&RW.at(1), &RW.at(3));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /*------------------------------------------------------------*/
-/*----------------- TESTS - ECU_NTNODE_IS_ROOT ---------------*/
+/*-------------- TESTS - ECU_NTNODE_IS_ANCESTOR --------------*/
 /*------------------------------------------------------------*/
 
 /**
- * @brief Is root returned.
+ * @brief Every node on the path up to the root is an ancestor.
  */
-TEST(NtNode, IsRootNodeIsEmptyRoot)
+TEST(NtNode, IsAncestorNodeIsParentAndGrandparent)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3
+                |
+                RW4
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_branch(RW.at(2), RW.at(3), RW.at(4));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_is_root(&empty_root)) );
+        CHECK_TRUE( (ecu_ntnode_is_ancestor(&RW.at(3), &RW.at(4))) );
+        CHECK_TRUE( (ecu_ntnode_is_ancestor(&RW.at(2), &RW.at(4))) );
+        CHECK_TRUE( (ecu_ntnode_is_ancestor(&RW.at(0), &RW.at(4))) );
+        CHECK_TRUE( (ecu_ntnode_is_ancestor(&RW.at(0), &RW.at(1))) );
     }
     catch (const AssertException& e)
     {
@@ -2619,21 +3231,29 @@ TEST(NtNode, IsRootNodeIsEmptyRoot)
 }
 
 /**
- * @brief Is root returned.
+ * @brief A node is not its own ancestor, and descendants
+ * are not ancestors.
  */
-TEST(NtNode, IsRootNodeIsNonEmptyRoot)
+TEST(NtNode, IsAncestorNodeIsSelfOrDescendant)
 {
     try
     {
-        /* Step 1: Arrange. 
+        /* Step 1: Arrange.
         RW0
         |
         RW1
+        |
+        RW2
         */
-        add_children(RW.at(0), RW.at(1));
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
+        rw_ntnode empty_root;
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_is_root(&RW.at(0))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(0), &RW.at(0))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(1), &RW.at(1))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(2), &RW.at(1))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(2), &RW.at(0))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&empty_root, &empty_root)) );
     }
     catch (const AssertException& e)
     {
@@ -2643,23 +3263,30 @@ TEST(NtNode, IsRootNodeIsNonEmptyRoot)
 }
 
 /**
- * @brief Not root returned.
+ * @brief Nodes in a sibling's subtree are not descendants.
  */
-TEST(NtNode, IsRootNodeIsNonEmptySubroot)
+TEST(NtNode, IsAncestorNodeIsInOtherBranch)
 {
     try
     {
-        /* Step 1: Arrange. 
+        /* Step 1: Arrange.
         RW0
         |
-        RW1
+        RW1-----RW2
+        |       |
+        RW3     RW4
         |
-        RW2
+        RW5
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_branch(RW.at(1), RW.at(3), RW.at(5));
+        add_children(RW.at(2), RW.at(4));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_FALSE( (ecu_ntnode_is_root(&RW.at(1))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(2), &RW.at(5))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(2), &RW.at(3))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(1), &RW.at(4))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(3), &RW.at(4))) );
     }
     catch (const AssertException& e)
     {
@@ -2669,23 +3296,26 @@ TEST(NtNode, IsRootNodeIsNonEmptySubroot)
 }
 
 /**
- * @brief Not root returned.
+ * @brief Nodes in separate trees are never ancestors.
  */
-TEST(NtNode, IsRootNodeIsLeaf)
+TEST(NtNode, IsAncestorNodesInDifferentTrees)
 {
     try
     {
-        /* Step 1: Arrange. 
-        RW0
-        |
-        RW1
-        |
-        RW2
+        /* Step 1: Arrange.
+        RW0             RW3
+        |               |
+        RW1             RW4
+        |               |
+        RW2             RW5
         */
         add_branch(RW.at(0), RW.at(1), RW.at(2));
+        add_branch(RW.at(3), RW.at(4), RW.at(5));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_FALSE( (ecu_ntnode_is_root(&RW.at(2))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(0), &RW.at(5))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(1), &RW.at(5))) );
+        CHECK_FALSE( (ecu_ntnode_is_ancestor(&RW.at(3), &RW.at(2))) );
     }
     catch (const AssertException& e)
     {
@@ -2695,36 +3325,45 @@ TEST(NtNode, IsRootNodeIsLeaf)
 }
 
 /*------------------------------------------------------------*/
-/*--------------- TESTS - ECU_NTNODE_LAST_CHILD --------------*/
+/*------------- TESTS - ECU_NTNODE_IS_DESCENDANT -------------*/
 /*------------------------------------------------------------*/
 
 /**
- * @brief Last child returned.
+ * @brief Not descendant returned.
  */
-TEST(NtNode, LastChildNodeWithMultipleChildren)
+TEST(NtNode, IsDescendantNodeIsEmptyRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_FALSE( (ecu_ntnode_is_descendant(&empty_root)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not descendant returned.
+ */
+TEST(NtNode, IsDescendantNodeIsNonEmptyRoot)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2
-        |       |
-        RW3     RW4
+        RW1
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3));
-        add_children(RW.at(2), RW.at(4));
-        ntnode *last;
-        const ntnode *clast;
-
-        /* Step 2: Action. */
-        last = &convert(ecu_ntnode_last_child(&RW.at(0)));
-        clast = &convert(ecu_ntnode_last_cchild(&RW.at(0)));
+        add_children(RW.at(0), RW.at(1));
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (last == &RW.at(2)) );
-        CHECK_TRUE( (clast == &RW.at(2)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_FALSE( (ecu_ntnode_is_descendant(&RW.at(0))) );
     }
     catch (const AssertException& e)
     {
@@ -2734,31 +3373,23 @@ TEST(NtNode, LastChildNodeWithMultipleChildren)
 }
 
 /**
- * @brief Last child returned.
+ * @brief Is descendant returned.
  */
-TEST(NtNode, LastChildNodeWithOneChild)
+TEST(NtNode, IsDescendantNodeIsNonEmptySubroot)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2
+        RW1
         |
-        RW3
+        RW2
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3));
-        ntnode *last;
-        const ntnode *clast;
-
-        /* Step 2: Action. */
-        last = &convert(ecu_ntnode_last_child(&RW.at(1)));
-        clast = &convert(ecu_ntnode_last_cchild(&RW.at(1)));
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (last == &RW.at(3)) );
-        CHECK_TRUE( (clast == &RW.at(3)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_is_descendant(&RW.at(1))) );
     }
     catch (const AssertException& e)
     {
@@ -2768,9 +3399,9 @@ TEST(NtNode, LastChildNodeWithOneChild)
 }
 
 /**
- * @brief NULL returned.
+ * @brief Is descendant returned.
  */
-TEST(NtNode, LastChildNodeWithNoChildren)
+TEST(NtNode, IsDescendantNodeIsLeaf)
 {
     try
     {
@@ -2778,12 +3409,13 @@ TEST(NtNode, LastChildNodeWithNoChildren)
         RW0
         |
         RW1
+        |
+        RW2
         */
-        add_children(RW.at(0), RW.at(1));
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_last_child(&RW.at(1)) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_last_cchild(&RW.at(1)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_is_descendant(&RW.at(2))) );
     }
     catch (const AssertException& e)
     {
@@ -2793,38 +3425,21 @@ TEST(NtNode, LastChildNodeWithNoChildren)
 }
 
 /*------------------------------------------------------------*/
-/*------------------- TESTS - ECU_NTNODE_LCA -----------------*/
+/*----------------- TESTS - ECU_NTNODE_IS_LEAF ---------------*/
 /*------------------------------------------------------------*/
 
 /**
- * @brief Correct LCA returned.
+ * @brief Is leaf returned.
  */
-TEST(NtNode, LCANode1LowerLevelThanNode2)
+TEST(NtNode, IsLeafNodeIsEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange.
-        RW0
-        |
-        RW1-----RW2
-                |
-                RW3-----RW4
-                        |
-                        RW5---RW6
-        */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(4), RW.at(5), RW.at(6));
-        ntnode *lca;
-        const ntnode *clca;
-
-        /* Step 2: Action. */
-        lca = &convert(ecu_ntnode_lca(&RW.at(6), &RW.at(3)));
-        clca = &convert(ecu_ntnode_clca(&RW.at(6), &RW.at(3)));
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (lca == &RW.at(2)) );
-        CHECK_TRUE( (clca == &RW.at(2)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_is_leaf(&empty_root)) );
     }
     catch (const AssertException& e)
     {
@@ -2834,34 +3449,21 @@ TEST(NtNode, LCANode1LowerLevelThanNode2)
 }
 
 /**
- * @brief Correct LCA returned.
+ * @brief Not a leaf returned.
  */
-TEST(NtNode, LCANode2LowerLevelThanNode1)
+TEST(NtNode, IsLeafNodeIsNonEmptyRoot)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2
-                |
-                RW3-----RW4
-                        |
-                        RW5---RW6
+        RW1
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(4), RW.at(5), RW.at(6));
-        ntnode *lca;
-        const ntnode *clca;
-
-        /* Step 2: Action. */
-        lca = &convert(ecu_ntnode_lca(&RW.at(3), &RW.at(6)));
-        clca = &convert(ecu_ntnode_clca(&RW.at(3), &RW.at(6)));
+        add_children(RW.at(0), RW.at(1));
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (lca == &RW.at(2)) );
-        CHECK_TRUE( (clca == &RW.at(2)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_FALSE( (ecu_ntnode_is_leaf(&RW.at(0))) );
     }
     catch (const AssertException& e)
     {
@@ -2871,32 +3473,23 @@ TEST(NtNode, LCANode2LowerLevelThanNode1)
 }
 
 /**
- * @brief Correct LCA returned.
+ * @brief Not a leaf returned.
  */
-TEST(NtNode, LCANode1AndNode2SameLevel)
+TEST(NtNode, IsLeafNodeIsNonEmptySubroot)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW3
-                |       |
-                RW4     RW5---RW6---RW7
+        RW1
+        |
+        RW2
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(2), RW.at(4));
-        add_children(RW.at(3), RW.at(5), RW.at(6), RW.at(7));
-        ntnode *lca;
-        const ntnode *clca;
-
-        /* Step 2: Action. */
-        lca = &convert(ecu_ntnode_lca(&RW.at(4), &RW.at(6)));
-        clca = &convert(ecu_ntnode_clca(&RW.at(6), &RW.at(4))); /* Reverse parameters on purpose. */
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (lca == &RW.at(0)) );
-        CHECK_TRUE( (clca == &RW.at(0)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_FALSE( (ecu_ntnode_is_leaf(&RW.at(1))) );
     }
     catch (const AssertException& e)
     {
@@ -2906,9 +3499,9 @@ TEST(NtNode, LCANode1AndNode2SameLevel)
 }
 
 /**
- * @brief Node1/2 returned since they are already LCAs.
+ * @brief Is leaf returned.
  */
-TEST(NtNode, LCANode1EqualsNode2AndNotRoot)
+TEST(NtNode, IsLeafNodeIsLeaf)
 {
     try
     {
@@ -2916,18 +3509,13 @@ TEST(NtNode, LCANode1EqualsNode2AndNotRoot)
         RW0
         |
         RW1
+        |
+        RW2
         */
-        add_children(RW.at(0), RW.at(1));
-        ntnode *lca;
-        const ntnode *clca;
-
-        /* Step 2: Action. */
-        lca = &convert(ecu_ntnode_lca(&RW.at(1), &RW.at(1)));
-        clca = &convert(ecu_ntnode_clca(&RW.at(1), &RW.at(1)));
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (lca == &RW.at(1)) );
-        CHECK_TRUE( (clca == &RW.at(1)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_is_leaf(&RW.at(2))) );
     }
     catch (const AssertException& e)
     {
@@ -2936,29 +3524,22 @@ TEST(NtNode, LCANode1EqualsNode2AndNotRoot)
     }
 }
 
+/*------------------------------------------------------------*/
+/*----------------- TESTS - ECU_NTNODE_IS_ROOT ---------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Node1/2 returned since they are already LCAs.
+ * @brief Is root returned.
  */
-TEST(NtNode, LCANode1AndNode2EqualRoot)
+TEST(NtNode, IsRootNodeIsEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange. 
-        RW0
-        |
-        RW1
-        */
-        add_children(RW.at(0), RW.at(1));
-        ntnode *lca;
-        const ntnode *clca;
-
-        /* Step 2: Action. */
-        lca = &convert(ecu_ntnode_lca(&RW.at(0), &RW.at(0)));
-        clca = &convert(ecu_ntnode_clca(&RW.at(0), &RW.at(0)));
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (lca == &RW.at(0)) );
-        CHECK_TRUE( (clca == &RW.at(0)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_is_root(&empty_root)) );
     }
     catch (const AssertException& e)
     {
@@ -2968,28 +3549,21 @@ TEST(NtNode, LCANode1AndNode2EqualRoot)
 }
 
 /**
- * @brief NULL returned.
+ * @brief Is root returned.
  */
-TEST(NtNode, LCANodesInDifferentTrees)
+TEST(NtNode, IsRootNodeIsNonEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange.
-        RW0             RW5
-        |               |
-        RW1-----RW2     RW6
-                |
-                RW3
-                |
-                RW4
+        /* Step 1: Arrange. 
+        RW0
+        |
+        RW1
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_branch(RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(5), RW.at(6));
+        add_children(RW.at(0), RW.at(1));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_lca(&RW.at(6), &RW.at(4)) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_clca(&RW.at(4), &RW.at(6)) == nullptr) ); /* Reverse parameters on purpose. */
+        CHECK_TRUE( (ecu_ntnode_is_root(&RW.at(0))) );
     }
     catch (const AssertException& e)
     {
@@ -2999,28 +3573,23 @@ TEST(NtNode, LCANodesInDifferentTrees)
 }
 
 /**
- * @brief Node1 returned.
+ * @brief Not root returned.
  */
-TEST(NtNode, LCANode1DirectParentOfNode2)
+TEST(NtNode, IsRootNodeIsNonEmptySubroot)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
         RW1
+        |
+        RW2
         */
-        add_children(RW.at(0), RW.at(1));
-        ntnode *lca;
-        const ntnode *clca;
-
-        /* Step 2: Action. */
-        lca = &convert(ecu_ntnode_lca(&RW.at(0), &RW.at(1)));
-        clca = &convert(ecu_ntnode_clca(&RW.at(0), &RW.at(1)));
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (lca == &RW.at(0)) );
-        CHECK_TRUE( (clca == &RW.at(0)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_FALSE( (ecu_ntnode_is_root(&RW.at(1))) );
     }
     catch (const AssertException& e)
     {
@@ -3030,28 +3599,23 @@ TEST(NtNode, LCANode1DirectParentOfNode2)
 }
 
 /**
- * @brief Node2 returned.
+ * @brief Not root returned.
  */
-TEST(NtNode, LCANode2DirectParentOfNode1)
+TEST(NtNode, IsRootNodeIsLeaf)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
         RW1
+        |
+        RW2
         */
-        add_children(RW.at(0), RW.at(1));
-        ntnode *lca;
-        const ntnode *clca;
-
-        /* Step 2: Action. */
-        lca = &convert(ecu_ntnode_lca(&RW.at(1), &RW.at(0)));
-        clca = &convert(ecu_ntnode_clca(&RW.at(1), &RW.at(0)));
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (lca == &RW.at(0)) );
-        CHECK_TRUE( (clca == &RW.at(0)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_FALSE( (ecu_ntnode_is_root(&RW.at(2))) );
     }
     catch (const AssertException& e)
     {
@@ -3061,21 +3625,36 @@ TEST(NtNode, LCANode2DirectParentOfNode1)
 }
 
 /*------------------------------------------------------------*/
-/*------------------ TESTS - ECU_NTNODE_LEVEL ----------------*/
+/*--------------- TESTS - ECU_NTNODE_LAST_CHILD --------------*/
 /*------------------------------------------------------------*/
 
 /**
- * @brief 0 returned.
+ * @brief Last child returned.
  */
-TEST(NtNode, LevelNodeIsEmptyRoot)
+TEST(NtNode, LastChildNodeWithMultipleChildren)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+        |       |
+        RW3     RW4
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        add_children(RW.at(2), RW.at(4));
+        ntnode *last;
+        const ntnode *clast;
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_level(&empty_root) == 0) );
+        /* Step 2: Action. */
+        last = &convert(ecu_ntnode_last_child(&RW.at(0)));
+        clast = &convert(ecu_ntnode_last_cchild(&RW.at(0)));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (last == &RW.at(2)) );
+        CHECK_TRUE( (clast == &RW.at(2)) );
     }
     catch (const AssertException& e)
     {
@@ -3085,9 +3664,9 @@ TEST(NtNode, LevelNodeIsEmptyRoot)
 }
 
 /**
- * @brief 0 returned.
+ * @brief Last child returned.
  */
-TEST(NtNode, LevelNodeIsNonEmptyRoot)
+TEST(NtNode, LastChildNodeWithOneChild)
 {
     try
     {
@@ -3095,11 +3674,21 @@ TEST(NtNode, LevelNodeIsNonEmptyRoot)
         RW0
         |
         RW1---RW2
+        |
+        RW3
         */
         add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        ntnode *last;
+        const ntnode *clast;
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_level(&RW.at(0)) == 0) );
+        /* Step 2: Action. */
+        last = &convert(ecu_ntnode_last_child(&RW.at(1)));
+        clast = &convert(ecu_ntnode_last_cchild(&RW.at(1)));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (last == &RW.at(3)) );
+        CHECK_TRUE( (clast == &RW.at(3)) );
     }
     catch (const AssertException& e)
     {
@@ -3109,27 +3698,22 @@ TEST(NtNode, LevelNodeIsNonEmptyRoot)
 }
 
 /**
- * @brief Correct level returned.
+ * @brief NULL returned.
  */
-TEST(NtNode, LevelNodeIsNonEmptySubroot)
+TEST(NtNode, LastChildNodeWithNoChildren)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2
-        |
-        RW3
-        |
-        RW4---RW5
+        RW1
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3));
-        add_children(RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(0), RW.at(1));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_level(&RW.at(3)) == 2) );
+        CHECK_TRUE( (ecu_ntnode_last_child(&RW.at(1)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_last_cchild(&RW.at(1)) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -3138,28 +3722,39 @@ TEST(NtNode, LevelNodeIsNonEmptySubroot)
     }
 }
 
+/*------------------------------------------------------------*/
+/*------------------- TESTS - ECU_NTNODE_LCA -----------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Correct level returned.
+ * @brief Correct LCA returned.
  */
-TEST(NtNode, LevelNodeIsLeaf)
+TEST(NtNode, LCANode1LowerLevelThanNode2)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2
-        |
-        RW3
-        |
-        RW4---RW5
+        RW1-----RW2
+                |
+                RW3-----RW4
+                        |
+                        RW5---RW6
         */
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3));
-        add_children(RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(4), RW.at(5), RW.at(6));
+        ntnode *lca;
+        const ntnode *clca;
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_level(&RW.at(5)) == 3) );
+        /* Step 2: Action. */
+        lca = &convert(ecu_ntnode_lca(&RW.at(6), &RW.at(3)));
+        clca = &convert(ecu_ntnode_clca(&RW.at(6), &RW.at(3)));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (lca == &RW.at(2)) );
+        CHECK_TRUE( (clca == &RW.at(2)) );
     }
     catch (const AssertException& e)
     {
@@ -3169,59 +3764,34 @@ TEST(NtNode, LevelNodeIsLeaf)
 }
 
 /**
- * @brief Add node to different levels in tree.
- * Correct level values returned.
+ * @brief Correct LCA returned.
  */
-TEST(NtNode, LevelAddAndRemoveNodeFromTree)
+TEST(NtNode, LCANode2LowerLevelThanNode1)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2
-        |
-        RW3
-        |
-        RW4---RW5
+        RW1-----RW2
+                |
+                RW3-----RW4
+                        |
+                        RW5---RW6
         */
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3));
-        add_children(RW.at(3), RW.at(4), RW.at(5));
-
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_level(&RW.at(3)) == 2) );
-        ecu_ntnode_remove(&RW.at(3));
-        CHECK_TRUE( (ecu_ntnode_level(&RW.at(3)) == 0) );
-        ecu_ntnode_push_child_back(&RW.at(0), &RW.at(3));
-        CHECK_TRUE( (ecu_ntnode_level(&RW.at(3)) == 1) );
-        ecu_ntnode_remove(&RW.at(3));
-        CHECK_TRUE( (ecu_ntnode_level(&RW.at(3)) == 0) );
-    }
-    catch (const AssertException& e)
-    {
-        /* FAIL. */
-        (void)e;
-    }
-}
-
-/*------------------------------------------------------------*/
-/*------------------- TESTS - ECU_NTNODE_NEXT ----------------*/
-/*------------------------------------------------------------*/
+        add_children(RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(4), RW.at(5), RW.at(6));
+        ntnode *lca;
+        const ntnode *clca;
 
-/**
- * @brief NULL returned.
- */
-TEST(NtNode, NextNodeIsEmptyRoot)
-{
-    try
-    {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
+        /* Step 2: Action. */
+        lca = &convert(ecu_ntnode_lca(&RW.at(3), &RW.at(6)));
+        clca = &convert(ecu_ntnode_clca(&RW.at(3), &RW.at(6)));
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_next(&empty_root) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_cnext(&empty_root) == nullptr) );
+        /* Step 3: Assert. */
+        CHECK_TRUE( (lca == &RW.at(2)) );
+        CHECK_TRUE( (clca == &RW.at(2)) );
     }
     catch (const AssertException& e)
     {
@@ -3231,22 +3801,32 @@ TEST(NtNode, NextNodeIsEmptyRoot)
 }
 
 /**
- * @brief NULL returned.
+ * @brief Correct LCA returned.
  */
-TEST(NtNode, NextNodeIsNonEmptyRoot)
+TEST(NtNode, LCANode1AndNode2SameLevel)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2
+        RW1-----RW2-----RW3
+                |       |
+                RW4     RW5---RW6---RW7
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(2), RW.at(4));
+        add_children(RW.at(3), RW.at(5), RW.at(6), RW.at(7));
+        ntnode *lca;
+        const ntnode *clca;
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_next(&RW.at(0)) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_cnext(&RW.at(0)) == nullptr) );
+        /* Step 2: Action. */
+        lca = &convert(ecu_ntnode_lca(&RW.at(4), &RW.at(6)));
+        clca = &convert(ecu_ntnode_clca(&RW.at(6), &RW.at(4))); /* Reverse parameters on purpose. */
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (lca == &RW.at(0)) );
+        CHECK_TRUE( (clca == &RW.at(0)) );
     }
     catch (const AssertException& e)
     {
@@ -3256,33 +3836,28 @@ TEST(NtNode, NextNodeIsNonEmptyRoot)
 }
 
 /**
- * @brief Next sibling returned.
+ * @brief Node1/2 returned since they are already LCAs.
  */
-TEST(NtNode, NextNodeIsFirstSibling)
+TEST(NtNode, LCANode1EqualsNode2AndNotRoot)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW3
-        |       |       |
-        RW4     RW5     RW6
+        RW1
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
-        add_children(RW.at(3), RW.at(6));
-        ntnode *next;
-        const ntnode *cnext;
+        add_children(RW.at(0), RW.at(1));
+        ntnode *lca;
+        const ntnode *clca;
 
         /* Step 2: Action. */
-        next = &convert(ecu_ntnode_next(&RW.at(1)));
-        cnext = &convert(ecu_ntnode_cnext(&RW.at(1)));
+        lca = &convert(ecu_ntnode_lca(&RW.at(1), &RW.at(1)));
+        clca = &convert(ecu_ntnode_clca(&RW.at(1), &RW.at(1)));
 
         /* Step 3: Assert. */
-        CHECK_TRUE( (next == &RW.at(2)) );
-        CHECK_TRUE( (cnext == &RW.at(2)) );
+        CHECK_TRUE( (lca == &RW.at(1)) );
+        CHECK_TRUE( (clca == &RW.at(1)) );
     }
     catch (const AssertException& e)
     {
@@ -3292,33 +3867,28 @@ TEST(NtNode, NextNodeIsFirstSibling)
 }
 
 /**
- * @brief Next sibling returned.
+ * @brief Node1/2 returned since they are already LCAs.
  */
-TEST(NtNode, NextNodeIsMiddleSibling)
+TEST(NtNode, LCANode1AndNode2EqualRoot)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1-----RW2-----RW3
-        |       |       |
-        RW4     RW5     RW6
+        RW1
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
-        add_children(RW.at(3), RW.at(6));
-        ntnode *next;
-        const ntnode *cnext;
+        add_children(RW.at(0), RW.at(1));
+        ntnode *lca;
+        const ntnode *clca;
 
         /* Step 2: Action. */
-        next = &convert(ecu_ntnode_next(&RW.at(2)));
-        cnext = &convert(ecu_ntnode_cnext(&RW.at(2)));
+        lca = &convert(ecu_ntnode_lca(&RW.at(0), &RW.at(0)));
+        clca = &convert(ecu_ntnode_clca(&RW.at(0), &RW.at(0)));
 
         /* Step 3: Assert. */
-        CHECK_TRUE( (next == &RW.at(3)) );
-        CHECK_TRUE( (cnext == &RW.at(3)) );
+        CHECK_TRUE( (lca == &RW.at(0)) );
+        CHECK_TRUE( (clca == &RW.at(0)) );
     }
     catch (const AssertException& e)
     {
@@ -3330,25 +3900,26 @@ TEST(NtNode, NextNodeIsMiddleSibling)
 /**
  * @brief NULL returned.
  */
-TEST(NtNode, NextNodeIsLastSibling)
+TEST(NtNode, LCANodesInDifferentTrees)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0
-        |
-        RW1-----RW2-----RW3
-        |       |       |
-        RW4     RW5     RW6
+        RW0             RW5
+        |               |
+        RW1-----RW2     RW6
+                |
+                RW3
+                |
+                RW4
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
-        add_children(RW.at(3), RW.at(6));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_branch(RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(5), RW.at(6));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_next(&RW.at(3)) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_cnext(&RW.at(3)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_lca(&RW.at(6), &RW.at(4)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_clca(&RW.at(4), &RW.at(6)) == nullptr) ); /* Reverse parameters on purpose. */
     }
     catch (const AssertException& e)
     {
@@ -3358,9 +3929,9 @@ TEST(NtNode, NextNodeIsLastSibling)
 }
 
 /**
- * @brief NULL returned.
+ * @brief Node1 returned.
  */
-TEST(NtNode, NextNodeWithNoSiblings)
+TEST(NtNode, LCANode1DirectParentOfNode2)
 {
     try
     {
@@ -3368,15 +3939,18 @@ TEST(NtNode, NextNodeWithNoSiblings)
         RW0
         |
         RW1
-        |
-        RW2---RW3
         */
         add_children(RW.at(0), RW.at(1));
-        add_children(RW.at(1), RW.at(2), RW.at(3));
+        ntnode *lca;
+        const ntnode *clca;
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_next(&RW.at(1)) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_cnext(&RW.at(1)) == nullptr) );
+        /* Step 2: Action. */
+        lca = &convert(ecu_ntnode_lca(&RW.at(0), &RW.at(1)));
+        clca = &convert(ecu_ntnode_clca(&RW.at(0), &RW.at(1)));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (lca == &RW.at(0)) );
+        CHECK_TRUE( (clca == &RW.at(0)) );
     }
     catch (const AssertException& e)
     {
@@ -3385,23 +3959,29 @@ TEST(NtNode, NextNodeWithNoSiblings)
     }
 }
 
-/*------------------------------------------------------------*/
-/*------------------ TESTS - ECU_NTNODE_PARENT ---------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief NULL returned.
+ * @brief Node2 returned.
  */
-TEST(NtNode, ParentNodeIsEmptyRoot)
+TEST(NtNode, LCANode2DirectParentOfNode1)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1
+        */
+        add_children(RW.at(0), RW.at(1));
+        ntnode *lca;
+        const ntnode *clca;
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_parent(&empty_root) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_cparent(&empty_root) == nullptr) );
+        /* Step 2: Action. */
+        lca = &convert(ecu_ntnode_lca(&RW.at(1), &RW.at(0)));
+        clca = &convert(ecu_ntnode_clca(&RW.at(1), &RW.at(0)));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (lca == &RW.at(0)) );
+        CHECK_TRUE( (clca == &RW.at(0)) );
     }
     catch (const AssertException& e)
     {
@@ -3411,22 +3991,44 @@ TEST(NtNode, ParentNodeIsEmptyRoot)
 }
 
 /**
- * @brief NULL returned.
+ * @brief Deeper node is lifted to the other node's level
+ * before both are walked up together.
  */
-TEST(NtNode, ParentNodeIsNonEmptyRoot)
+TEST(NtNode, LCANodesInDeepUnevenBranches)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2
+        RW1
+        |
+        RW2-----RW3
+        |       |
+        RW4     RW10
+        |
+        RW5
+        |
+        RW6
+        |
+        RW7
+        |
+        RW8
+        |
+        RW9
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_branch(RW.at(0), RW.at(1));
+        add_children(RW.at(1), RW.at(2), RW.at(3));
+        add_branch(RW.at(2), RW.at(4), RW.at(5), RW.at(6), RW.at(7), RW.at(8), RW.at(9));
+        add_branch(RW.at(3), RW.at(10));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_parent(&RW.at(0)) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_cparent(&RW.at(0)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_lca(&RW.at(9), &RW.at(10)) == &RW.at(1)) );
+        CHECK_TRUE( (ecu_ntnode_clca(&RW.at(10), &RW.at(9)) == &RW.at(1)) );
+        CHECK_TRUE( (ecu_ntnode_lca(&RW.at(9), &RW.at(3)) == &RW.at(1)) );
+        CHECK_TRUE( (ecu_ntnode_lca(&RW.at(9), &RW.at(5)) == &RW.at(5)) );
+        CHECK_TRUE( (ecu_ntnode_clca(&RW.at(4), &RW.at(8)) == &RW.at(4)) );
+        CHECK_TRUE( (ecu_ntnode_lca(&RW.at(0), &RW.at(9)) == &RW.at(0)) );
     }
     catch (const AssertException& e)
     {
@@ -3436,71 +4038,29 @@ TEST(NtNode, ParentNodeIsNonEmptyRoot)
 }
 
 /**
- * @brief Parent returned.
+ * @brief NULL returned.
  */
-TEST(NtNode, ParentNodeIsNonEmptySubroot)
+TEST(NtNode, LCANodesInDifferentTreesAtDifferentLevels)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0
+        RW0             RW4
+        |               |
+        RW1             RW5
         |
-        RW1-----RW2---RW3
-                |
-                RW3---RW4
-                |
-                RW5
-        */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(3), RW.at(5));
-        ntnode *parent;
-        const ntnode *cparent;
-
-        /* Step 2: Action. */
-        parent = &convert(ecu_ntnode_parent(&RW.at(3)));
-        cparent = &convert(ecu_ntnode_cparent(&RW.at(3)));
-
-        /* Step 3: Assert. */
-        CHECK_TRUE( (parent == &RW.at(2)) );
-        CHECK_TRUE( (cparent == &RW.at(2)) );
-    }
-    catch (const AssertException& e)
-    {
-        /* FAIL. */
-        (void)e;
-    }
-}
-
-/**
- * @brief Parent returned.
- */
-TEST(NtNode, ParentNodeIsLeaf)
-{
-    try
-    {
-        /* Step 1: Arrange.
-        RW0
+        RW2
         |
-        RW1-----RW2---RW3
-                |
-                RW3---RW4
-                |
-                RW5
+        RW3
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(3), RW.at(5));
-        ntnode *parent;
-        const ntnode *cparent;
-
-        /* Step 2: Action. */
-        parent = &convert(ecu_ntnode_parent(&RW.at(5)));
-        cparent = &convert(ecu_ntnode_cparent(&RW.at(5)));
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_branch(RW.at(4), RW.at(5));
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (parent == &RW.at(3)) );
-        CHECK_TRUE( (cparent == &RW.at(3)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_lca(&RW.at(3), &RW.at(5)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_clca(&RW.at(5), &RW.at(3)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_lca(&RW.at(3), &RW.at(4)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_clca(&RW.at(0), &RW.at(4)) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -3510,13 +4070,13 @@ TEST(NtNode, ParentNodeIsLeaf)
 }
 
 /*------------------------------------------------------------*/
-/*------------------- TESTS - ECU_NTNODE_PREV ----------------*/
+/*------------------ TESTS - ECU_NTNODE_LEVEL ----------------*/
 /*------------------------------------------------------------*/
 
 /**
- * @brief NULL returned.
+ * @brief 0 returned.
  */
-TEST(NtNode, PrevNodeIsEmptyRoot)
+TEST(NtNode, LevelNodeIsEmptyRoot)
 {
     try
     {
@@ -3524,8 +4084,7 @@ TEST(NtNode, PrevNodeIsEmptyRoot)
         rw_ntnode empty_root;
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_prev(&empty_root) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_cprev(&empty_root) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_level(&empty_root) == 0) );
     }
     catch (const AssertException& e)
     {
@@ -3535,13 +4094,13 @@ TEST(NtNode, PrevNodeIsEmptyRoot)
 }
 
 /**
- * @brief NULL returned.
+ * @brief 0 returned.
  */
-TEST(NtNode, PrevNodeIsNonEmptyRoot)
+TEST(NtNode, LevelNodeIsNonEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange. 
+        /* Step 1: Arrange.
         RW0
         |
         RW1---RW2
@@ -3549,8 +4108,7 @@ TEST(NtNode, PrevNodeIsNonEmptyRoot)
         add_children(RW.at(0), RW.at(1), RW.at(2));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_prev(&RW.at(0)) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_cprev(&RW.at(0)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_level(&RW.at(0)) == 0) );
     }
     catch (const AssertException& e)
     {
@@ -3560,29 +4118,27 @@ TEST(NtNode, PrevNodeIsNonEmptyRoot)
 }
 
 /**
- * @brief NULL returned.
+ * @brief Correct level returned.
  */
-TEST(NtNode, PrevNodeIsFirstSibling)
+TEST(NtNode, LevelNodeIsNonEmptySubroot)
 {
     try
     {
-        /* Step 1: Arrange. 
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW3
-        |               |
-        RW4             RW6
-                        |
-                        RW7---RW8
+        RW1---RW2
+        |
+        RW3
+        |
+        RW4---RW5
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(3), RW.at(6));
-        add_children(RW.at(6), RW.at(7), RW.at(8));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        add_children(RW.at(3), RW.at(4), RW.at(5));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_prev(&RW.at(1)) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_cprev(&RW.at(1)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_level(&RW.at(3)) == 2) );
     }
     catch (const AssertException& e)
     {
@@ -3592,35 +4148,27 @@ TEST(NtNode, PrevNodeIsFirstSibling)
 }
 
 /**
- * @brief Previous sibling returned.
+ * @brief Correct level returned.
  */
-TEST(NtNode, PrevNodeIsMiddleSibling)
+TEST(NtNode, LevelNodeIsLeaf)
 {
     try
     {
-        /* Step 1: Arrange. 
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW3
-        |               |
-        RW4             RW6
-                        |
-                        RW7---RW8
+        RW1---RW2
+        |
+        RW3
+        |
+        RW4---RW5
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(3), RW.at(6));
-        add_children(RW.at(6), RW.at(7), RW.at(8));
-        ntnode *prev;
-        const ntnode *cprev;
-
-        /* Step 2: Action. */
-        prev = &convert(ecu_ntnode_prev(&RW.at(2)));
-        cprev = &convert(ecu_ntnode_cprev(&RW.at(2)));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        add_children(RW.at(3), RW.at(4), RW.at(5));
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (prev == &RW.at(1)) );
-        CHECK_TRUE( (cprev == &RW.at(1)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_level(&RW.at(5)) == 3) );
     }
     catch (const AssertException& e)
     {
@@ -3630,35 +4178,34 @@ TEST(NtNode, PrevNodeIsMiddleSibling)
 }
 
 /**
- * @brief Previous sibling returned.
+ * @brief Add node to different levels in tree.
+ * Correct level values returned.
  */
-TEST(NtNode, PrevNodeIsLastSibling)
+TEST(NtNode, LevelAddAndRemoveNodeFromTree)
 {
     try
     {
-        /* Step 1: Arrange. 
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW3
-        |               |
-        RW4             RW6
-                        |
-                        RW7---RW8
+        RW1---RW2
+        |
+        RW3
+        |
+        RW4---RW5
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(3), RW.at(6));
-        add_children(RW.at(6), RW.at(7), RW.at(8));
-        ntnode *prev;
-        const ntnode *cprev;
-
-        /* Step 2: Action. */
-        prev = &convert(ecu_ntnode_prev(&RW.at(3)));
-        cprev = &convert(ecu_ntnode_cprev(&RW.at(3)));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        add_children(RW.at(3), RW.at(4), RW.at(5));
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (prev == &RW.at(2)) );
-        CHECK_TRUE( (cprev == &RW.at(2)) );
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_level(&RW.at(3)) == 2) );
+        ecu_ntnode_remove(&RW.at(3));
+        CHECK_TRUE( (ecu_ntnode_level(&RW.at(3)) == 0) );
+        ecu_ntnode_push_child_back(&RW.at(0), &RW.at(3));
+        CHECK_TRUE( (ecu_ntnode_level(&RW.at(3)) == 1) );
+        ecu_ntnode_remove(&RW.at(3));
+        CHECK_TRUE( (ecu_ntnode_level(&RW.at(3)) == 0) );
     }
     catch (const AssertException& e)
     {
@@ -3667,26 +4214,60 @@ TEST(NtNode, PrevNodeIsLastSibling)
     }
 }
 
+/*------------------------------------------------------------*/
+/*------------------- TESTS - ECU_NTNODE_MOVE ----------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief NULL returned.
+ * @brief Subtree moved to another branch of the same tree
+ * with its descendants intact.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, PrevNodeWithNoSiblings)
+TEST(NtNode, MoveChildBackWithinTree)
 {
     try
     {
         /* Step 1: Arrange.
+
+        Before:
         RW0
         |
-        RW1-----RW2---RW3
-                |
-                RW4
+        RW1-----RW2
+        |       |
+        RW3     RW4
+        |
+        RW5-----RW6
+        |
+        RW7
+
+        After:
+        RW0
+        |
+        RW1-----RW2
+        |       |
+        RW3     RW4-----RW5
+        |               |
+        RW6             RW7
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
         add_children(RW.at(2), RW.at(4));
+        add_children(RW.at(3), RW.at(5), RW.at(6));
+        add_children(RW.at(5), RW.at(7));
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_prev(&RW.at(4)) == nullptr) );
-        CHECK_TRUE( (ecu_ntnode_cprev(&RW.at(4)) == nullptr) );
+        /* Step 2: Action. */
+        ecu_ntnode_move_child_back(&RW.at(2), &RW.at(5));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(3), RW.at(1), RW.at(4), RW.at(7),
+                             RW.at(5), RW.at(2), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        CHECK_COUNTS(RW.at(0));
     }
     catch (const AssertException& e)
     {
@@ -3695,60 +4276,46 @@ TEST(NtNode, PrevNodeWithNoSiblings)
     }
 }
 
-/*------------------------------------------------------------*/
-/*------------ TESTS - ECU_NTNODE_PUSH_CHILD_BACK ------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief Child added to back.
+ * @brief Subtree moved to the front of its own parent's
+ * children. Moving within the same parent reorders it.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, PushChildBackParentWithMultipleChildren)
+TEST(NtNode, MoveChildFrontSameParent)
 {
     try
     {
         /* Step 1: Arrange.
 
         Before:
-        RW0                                 RW11
-        |                                   |
-        RW1-----RW2---RW3                   RW12---RW13
-                |                           |
-                RW4-----RW5---------RW6     RW14
-                |       |           |
-                RW7     RW8---RW9   RW10
+        RW0
+        |
+        RW1-----RW2-----RW3
+                        |
+                        RW4
 
         After:
         RW0
         |
-        RW1-----RW2---RW3
-                |
-                RW4-----RW5---------RW6-----RW11
-                |       |           |       |
-                RW7     RW8---RW9   RW10    RW12---RW13
-                                            |
-                                            RW14
+        RW3-----RW1-----RW2
+        |
+        RW4
         */
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(2), RW.at(4), RW.at(5), RW.at(6));
-        add_children(RW.at(4), RW.at(7));
-        add_children(RW.at(5), RW.at(8), RW.at(9));
-        add_children(RW.at(6), RW.at(10));
-        add_children(RW.at(11), RW.at(12), RW.at(13));
-        add_children(RW.at(12), RW.at(14));
+        add_children(RW.at(3), RW.at(4));
 
         /* Step 2: Action. */
-        ecu_ntnode_push_child_back(&RW.at(2), &RW.at(11));
+        ecu_ntnode_move_child_front(&RW.at(0), &RW.at(3));
 
         /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(7), RW.at(4), RW.at(8), RW.at(9), RW.at(5),
-                             RW.at(10), RW.at(6), RW.at(14), RW.at(12), RW.at(13), RW.at(11),
-                             RW.at(2), RW.at(3), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(3), RW.at(1), RW.at(2), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
+
+        CHECK_COUNTS(RW.at(0));
     }
     catch (const AssertException& e)
     {
@@ -3758,54 +4325,52 @@ TEST(NtNode, PushChildBackParentWithMultipleChildren)
 }
 
 /**
- * @brief Child added to back.
+ * @brief Subtree moved out of one tree into another.
+ * Both trees stay consistent.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, PushChildBackParentWithOneChild)
+TEST(NtNode, MoveChildBackToOtherTree)
 {
     try
     {
         /* Step 1: Arrange.
 
         Before:
-        RW0                     RW9
-        |                       |
-        RW1-----RW2-----RW3     RW10----RW11
-        |       |       |               |
-        RW4     RW5     RW6             RW12
+        RW0             RW4
+        |               |
+        RW1-----RW2     RW5
                 |
-                RW7---RW8
+                RW3
 
         After:
-        RW0
-        |
-        RW1-----RW2-----------------RW3
-        |       |                   |
-        RW4     RW5---------RW9     RW6
-                |           |
-                RW7---RW8   RW10----RW11
-                                    |
-                                    RW12
+        RW0     RW4
+        |       |
+        RW1     RW5-----RW2
+                        |
+                        RW3
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
-        add_children(RW.at(3), RW.at(6));
-        add_children(RW.at(5), RW.at(7), RW.at(8));
-        add_children(RW.at(9), RW.at(10), RW.at(11));
-        add_children(RW.at(11), RW.at(12));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3));
+        add_children(RW.at(4), RW.at(5));
 
         /* Step 2: Action. */
-        ecu_ntnode_push_child_back(&RW.at(2), &RW.at(9));
+        ecu_ntnode_move_child_back(&RW.at(4), &RW.at(2));
 
         /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(7), RW.at(8), RW.at(5), RW.at(10), RW.at(12),
-                             RW.at(11), RW.at(9), RW.at(2), RW.at(6), RW.at(3), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(0), RW.at(5), RW.at(3), RW.at(2), RW.at(4));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
+
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        CHECK_COUNTS(RW.at(0));
+        CHECK_COUNTS(RW.at(4));
     }
     catch (const AssertException& e)
     {
@@ -3815,44 +4380,42 @@ TEST(NtNode, PushChildBackParentWithOneChild)
 }
 
 /**
- * @brief Child added.
+ * @brief Root of a tree can be moved. Same as pushing it.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, PushChildBackParentWithNoChildren)
+TEST(NtNode, MoveChildFrontChildIsRoot)
 {
     try
     {
         /* Step 1: Arrange.
 
         Before:
-        RW0                         RW6
-        |
-        RW1-----RW2-----RW3
-                |       |
-                RW4     RW5
+        RW0             RW2
+        |               |
+        RW1             RW3
 
         After:
         RW0
         |
-        RW1-----RW2-----RW3
-        |       |       |
-        RW6     RW4     RW5
+        RW2-----RW1
+        |
+        RW3
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(2), RW.at(4));
-        add_children(RW.at(3), RW.at(5));
+        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(2), RW.at(3));
 
         /* Step 2: Action. */
-        ecu_ntnode_push_child_back(&RW.at(1), &RW.at(6));
+        ecu_ntnode_move_child_front(&RW.at(0), &RW.at(2));
 
         /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(1), RW.at(4), RW.at(2), RW.at(5),
-                             RW.at(3), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
+
+        CHECK_COUNTS(RW.at(0));
     }
     catch (const AssertException& e)
     {
@@ -3862,19 +4425,26 @@ TEST(NtNode, PushChildBackParentWithNoChildren)
 }
 
 /**
- * @brief Not allowed.
+ * @brief Not allowed. Would create a cycle.
  */
-TEST(NtNode, PushChildBackParentEqualsChild)
+TEST(NtNode, MoveChildBackIntoOwnSubtree)
 {
     try
     {
-        /* Step 1: Arrange. 
+        /* Step 1: Arrange. Move RW1 under RW3.
         RW0
+        |
+        RW1
+        |
+        RW2
+        |
+        RW3
         */
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
         EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_push_child_back(&RW.at(0), &RW.at(0));
+        ecu_ntnode_move_child_back(&RW.at(3), &RW.at(1));
 
         /* Step 3: Assert. Test fails if assertion does not fire. */
     }
@@ -3888,21 +4458,20 @@ TEST(NtNode, PushChildBackParentEqualsChild)
 /**
  * @brief Not allowed.
  */
-TEST(NtNode, PushChildBackChildInTree)
+TEST(NtNode, MoveChildFrontParentEqualsChild)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0         RW3
-        |           |
-        RW1---RW2   RW4
+        RW0
+        |
+        RW1
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(3), RW.at(4));
+        add_children(RW.at(0), RW.at(1));
         EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_push_child_back(&RW.at(1), &RW.at(4));
+        ecu_ntnode_move_child_front(&RW.at(1), &RW.at(1));
 
         /* Step 3: Assert. Test fails if assertion does not fire. */
     }
@@ -3913,60 +4482,56 @@ TEST(NtNode, PushChildBackChildInTree)
     }
 }
 
-/*------------------------------------------------------------*/
-/*------------ TESTS - ECU_NTNODE_PUSH_CHILD_FRONT -----------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief Child added to front.
+ * @brief Every child is moved in order along with its
+ * subtree. Old parent becomes a leaf.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, PushChildFrontParentWithMultipleChildren)
+TEST(NtNode, MoveChildrenToOtherBranch)
 {
     try
     {
         /* Step 1: Arrange.
 
         Before:
-        RW0                                 RW11
-        |                                   |
-        RW1-----RW2---RW3                   RW12---RW13
-                |                           |
-                RW4-----RW5---------RW6     RW14
-                |       |           |
-                RW7     RW8---RW9   RW10
+        RW0
+        |
+        RW1-------------RW2
+        |               |
+        RW3---RW4---RW5 RW6
+              |
+              RW7
 
         After:
         RW0
         |
-        RW1-----RW2---RW3
-                |
-                RW11------------RW4-----RW5---------RW6
-                |               |       |           |
-                RW12---RW13     RW7     RW8---RW9   RW10
+        RW1     RW2
                 |
-                RW14
+                RW6---RW3---RW4---RW5
+                            |
+                            RW7
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(2), RW.at(4), RW.at(5), RW.at(6));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
         add_children(RW.at(4), RW.at(7));
-        add_children(RW.at(5), RW.at(8), RW.at(9));
-        add_children(RW.at(6), RW.at(10));
-        add_children(RW.at(11), RW.at(12), RW.at(13));
-        add_children(RW.at(12), RW.at(14));
 
         /* Step 2: Action. */
-        ecu_ntnode_push_child_front(&RW.at(2), &RW.at(11));
+        ecu_ntnode_move_children(&RW.at(2), &RW.at(1));
 
         /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(14), RW.at(12), RW.at(13), RW.at(11), RW.at(7),
-                             RW.at(4), RW.at(8), RW.at(9), RW.at(5), RW.at(10), RW.at(6),
-                             RW.at(2), RW.at(3), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(6), RW.at(3), RW.at(7), RW.at(4),
+                             RW.at(5), RW.at(2), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
+
+        CHECK_TRUE( (ecu_ntnode_is_leaf(&RW.at(1))) );
+        CHECK_TRUE( (ecu_ntnode_parent(&RW.at(3)) == &RW.at(2)) );
+        CHECK_TRUE( (ecu_ntnode_parent(&RW.at(5)) == &RW.at(2)) );
+        CHECK_COUNTS(RW.at(0));
     }
     catch (const AssertException& e)
     {
@@ -3976,54 +4541,50 @@ TEST(NtNode, PushChildFrontParentWithMultipleChildren)
 }
 
 /**
- * @brief Child added to front.
+ * @brief Children can be moved up to an ancestor, which
+ * flattens the tree. Levels of moved subtrees change.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, PushChildFrontParentWithOneChild)
+TEST(NtNode, MoveChildrenToAncestor)
 {
     try
     {
         /* Step 1: Arrange.
 
         Before:
-        RW0                     RW9
-        |                       |
-        RW1-----RW2-----RW3     RW10----RW11
-        |       |       |               |
-        RW4     RW5     RW6             RW12
-                |
-                RW7---RW8
+        RW0
+        |
+        RW1
+        |
+        RW2
+        |
+        RW3---RW4
+        |
+        RW5
 
         After:
         RW0
         |
-        RW1-----RW2-------------------------RW3
-        |       |                           |
-        RW4     RW9-------------RW5         RW6
-                |               |
-                RW10----RW11    RW7---RW8
-                        |
-                        RW12
+        RW1---RW3---RW4
+        |     |
+        RW2   RW5
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
-        add_children(RW.at(3), RW.at(6));
-        add_children(RW.at(5), RW.at(7), RW.at(8));
-        add_children(RW.at(9), RW.at(10), RW.at(11));
-        add_children(RW.at(11), RW.at(12));
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(3), RW.at(5));
 
         /* Step 2: Action. */
-        ecu_ntnode_push_child_front(&RW.at(2), &RW.at(9));
+        ecu_ntnode_move_children(&RW.at(0), &RW.at(2));
 
         /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(10), RW.at(12), RW.at(11), RW.at(9),
-                             RW.at(7), RW.at(8), RW.at(5), RW.at(2), RW.at(6), RW.at(3), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(1), RW.at(5), RW.at(3), RW.at(4), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
+
+        CHECK_COUNTS(RW.at(0));
     }
     catch (const AssertException& e)
     {
@@ -4033,44 +4594,32 @@ TEST(NtNode, PushChildFrontParentWithOneChild)
 }
 
 /**
- * @brief Child added.
+ * @brief Allowed. Nothing happens.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, PushChildFrontParentWithNoChildren)
+TEST(NtNode, MoveChildrenFromLeaf)
 {
     try
     {
         /* Step 1: Arrange.
-
-        Before:
-        RW0                         RW6
-        |
-        RW1-----RW2-----RW3
-                |       |
-                RW4     RW5
-
-        After:
         RW0
         |
-        RW1-----RW2-----RW3
-        |       |       |
-        RW6     RW4     RW5
+        RW1---RW2
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(2), RW.at(4));
-        add_children(RW.at(3), RW.at(5));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
 
         /* Step 2: Action. */
-        ecu_ntnode_push_child_front(&RW.at(1), &RW.at(6));
+        ecu_ntnode_move_children(&RW.at(2), &RW.at(1));
 
         /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(1), RW.at(4), RW.at(2), RW.at(5),
-                             RW.at(3), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
+
+        CHECK_COUNTS(RW.at(0));
     }
     catch (const AssertException& e)
     {
@@ -4080,19 +4629,24 @@ TEST(NtNode, PushChildFrontParentWithNoChildren)
 }
 
 /**
- * @brief Not allowed.
+ * @brief Not allowed. Would create a cycle.
  */
-TEST(NtNode, PushChildFrontParentEqualsChild)
+TEST(NtNode, MoveChildrenIntoOwnSubtree)
 {
     try
     {
-        /* Step 1: Arrange. 
+        /* Step 1: Arrange. Move RW1's children under RW2.
         RW0
+        |
+        RW1
+        |
+        RW2
         */
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
         EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_push_child_front(&RW.at(0), &RW.at(0));
+        ecu_ntnode_move_children(&RW.at(2), &RW.at(1));
 
         /* Step 3: Assert. Test fails if assertion does not fire. */
     }
@@ -4104,43 +4658,61 @@ TEST(NtNode, PushChildFrontParentEqualsChild)
 }
 
 /**
- * @brief Not allowed.
+ * @brief Subtree moved after a node on a different level.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, PushChildFrontChildInTree)
+TEST(NtNode, MoveSiblingAfter)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0         RW3
-        |           |
-        RW1---RW2   RW4
+
+        Before:
+        RW0
+        |
+        RW1-----RW2
+        |       |
+        RW3     RW4
+                |
+                RW5
+
+        After:
+        RW0
+        |
+        RW1-----RW4-----RW2
+        |       |
+        RW3     RW5
         */
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(3), RW.at(4));
-        EXPECT_ASSERTION();
+        add_children(RW.at(1), RW.at(3));
+        add_branch(RW.at(2), RW.at(4), RW.at(5));
 
         /* Step 2: Action. */
-        ecu_ntnode_push_child_front(&RW.at(1), &RW.at(4));
+        ecu_ntnode_move_sibling_after(&RW.at(1), &RW.at(4));
 
-        /* Step 3: Assert. Test fails if assertion does not fire. */
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(1), RW.at(5), RW.at(4), RW.at(2), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        CHECK_COUNTS(RW.at(0));
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
-/*------------------------------------------------------------*/
-/*----------------- TESTS - ECU_NTNODE_REMOVE ----------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief Node removed correctly. Node's tree and
- * tree it was removed from unharmed.
+ * @brief Subtree moved deeper, before a node in another
+ * branch.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, RemoveNodeIsLeftMostSubroot)
+TEST(NtNode, MoveSiblingBefore)
 {
     try
     {
@@ -4149,39 +4721,39 @@ TEST(NtNode, RemoveNodeIsLeftMostSubroot)
         Before:
         RW0
         |
-        RW1---------RW2-----RW3
-        |           |       |
-        RW4---RW5   RW6     RW7
+        RW1-----RW2
+        |       |
+        RW3     RW4
+        |
+        RW5
 
         After:
-        RW0             RW1
-        |               |
-        RW2-----RW3     RW4---RW5
-        |       |
-        RW6     RW7
+        RW0
+        |
+        RW2
+        |
+        RW1-----RW4
+        |
+        RW3
+        |
+        RW5
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(3), RW.at(7));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_branch(RW.at(1), RW.at(3), RW.at(5));
+        add_children(RW.at(2), RW.at(4));
 
         /* Step 2: Action. */
-        ecu_ntnode_remove(&RW.at(1));
+        ecu_ntnode_move_sibling_before(&RW.at(4), &RW.at(1));
 
-        /* Step 3: Assert. Verify tree still intact. */
+        /* Step 3: Assert. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(2), RW.at(7), RW.at(3), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(3), RW.at(1), RW.at(4), RW.at(2), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
 
-        /* Step 3: Assert: Verify removed tree still intact. */
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_COUNTS(RW.at(0));
     }
     catch (const AssertException& e)
     {
@@ -4191,163 +4763,79 @@ TEST(NtNode, RemoveNodeIsLeftMostSubroot)
 }
 
 /**
- * @brief Node removed correctly. Node's tree and
- * tree it was removed from unharmed.
- * @warning Test validation requires working postorder iterator.
+ * @brief Not allowed. Roots cannot have siblings.
  */
-TEST(NtNode, RemoveNodeIsMiddleSubroot)
+TEST(NtNode, MoveSiblingAfterPositionIsRoot)
 {
     try
     {
         /* Step 1: Arrange.
-        
-        Before:
         RW0
         |
-        RW1---------RW2-----RW3
-        |           |       |
-        RW4---RW5   RW6     RW7
-                    |
-                    RW8
-                    |
-                    RW9
-
-        After:
-        RW0                 RW2
-        |                   |
-        RW1---------RW3     RW6
-        |           |       |
-        RW4---RW5   RW7     RW8
-                            |
-                            RW9
+        RW1
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_branch(RW.at(2), RW.at(6), RW.at(8), RW.at(9));
-        add_children(RW.at(3), RW.at(7));
+        add_children(RW.at(0), RW.at(1));
+        EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_remove(&RW.at(2));
-
-        /* Step 3: Assert. Verify tree still intact. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(7), RW.at(3), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        ecu_ntnode_move_sibling_after(&RW.at(0), &RW.at(1));
 
-        /* Step 3: Assert: Verify removed tree still intact. */
-        EXPECT_NODES_IN_TREE(RW.at(9), RW.at(8), RW.at(6), RW.at(2));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Node removed correctly. Node's tree and
- * tree it was removed from unharmed.
- * @warning Test validation requires working postorder iterator.
+ * @brief Not allowed. Would create a cycle.
  */
-TEST(NtNode, RemoveNodeIsRightMostSubroot)
+TEST(NtNode, MoveSiblingBeforePositionInOwnSubtree)
 {
     try
     {
-        /* Step 1: Arrange.
-
-        Before:
+        /* Step 1: Arrange. Move RW1 before RW3.
         RW0
         |
-        RW1---------RW2-----RW3
-        |           |       |
-        RW4---RW5   RW6     RW7
-
-        After:
-        RW0                 RW3
-        |                   |
-        RW1---------RW2     RW7
-        |           |
-        RW4---RW5   RW6
+        RW1
+        |
+        RW2---RW3
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(3), RW.at(7));
+        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(1), RW.at(2), RW.at(3));
+        EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_remove(&RW.at(3));
-
-        /* Step 3: Assert. Verify tree still intact. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(6), RW.at(2), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        ecu_ntnode_move_sibling_before(&RW.at(3), &RW.at(1));
 
-        /* Step 3: Assert: Verify removed tree still intact. */
-        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(3));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(3))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
+/*------------------------------------------------------------*/
+/*------------------- TESTS - ECU_NTNODE_NEXT ----------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Node removed correctly. Tree node was
- * removed from unharmed.
- * @warning Test validation requires working postorder iterator.
+ * @brief NULL returned.
  */
-TEST(NtNode, RemoveNodeIsLeaf)
+TEST(NtNode, NextNodeIsEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange.
-
-        Before:
-        RW0
-        |
-        RW1
-        |
-        RW2
-
-        After:
-        RW0     RW2
-        |
-        RW1
-        */
-        add_branch(RW.at(0), RW.at(1), RW.at(2));
-
-        /* Step 2: Action. */
-        ecu_ntnode_remove(&RW.at(2));
-
-        /* Step 3: Assert. Verify tree still intact. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
 
-        /* Step 3: Assert: Verify removed tree still intact. */
-        EXPECT_NODES_IN_TREE(RW.at(2));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_next(&empty_root) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_cnext(&empty_root) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4357,10 +4845,9 @@ TEST(NtNode, RemoveNodeIsLeaf)
 }
 
 /**
- * @brief OK. Does nothing.
- * @warning Test validation requires working postorder iterator.
+ * @brief NULL returned.
  */
-TEST(NtNode, RemoveNodeIsNonEmptyRoot)
+TEST(NtNode, NextNodeIsNonEmptyRoot)
 {
     try
     {
@@ -4371,16 +4858,9 @@ TEST(NtNode, RemoveNodeIsNonEmptyRoot)
         */
         add_children(RW.at(0), RW.at(1), RW.at(2));
 
-        /* Step 2: Action. */
-        ecu_ntnode_remove(&RW.at(0));
-
-        /* Step 3: Assert. Verify tree unchanged. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_next(&RW.at(0)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_cnext(&RW.at(0)) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4390,26 +4870,33 @@ TEST(NtNode, RemoveNodeIsNonEmptyRoot)
 }
 
 /**
- * @brief OK. Does nothing.
- * @warning Test validation requires working postorder iterator.
+ * @brief Next sibling returned.
  */
-TEST(NtNode, RemoveNodeIsEmptyRoot)
+TEST(NtNode, NextNodeIsFirstSibling)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
-        
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2-----RW3
+        |       |       |
+        RW4     RW5     RW6
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+        add_children(RW.at(3), RW.at(6));
+        ntnode *next;
+        const ntnode *cnext;
+
         /* Step 2: Action. */
-        ecu_ntnode_remove(&empty_root);
+        next = &convert(ecu_ntnode_next(&RW.at(1)));
+        cnext = &convert(ecu_ntnode_cnext(&RW.at(1)));
 
-        /* Step 3: Assert. Verify tree unchanged. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(empty_root);
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &empty_root)
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. */
+        CHECK_TRUE( (next == &RW.at(2)) );
+        CHECK_TRUE( (cnext == &RW.at(2)) );
     }
     catch (const AssertException& e)
     {
@@ -4418,22 +4905,34 @@ TEST(NtNode, RemoveNodeIsEmptyRoot)
     }
 }
 
-/*------------------------------------------------------------*/
-/*------------------- TESTS - ECU_NTNODE_SIZE ----------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief 0 returned.
+ * @brief Next sibling returned.
  */
-TEST(NtNode, SizeNodeIsEmptyRoot)
+TEST(NtNode, NextNodeIsMiddleSibling)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2-----RW3
+        |       |       |
+        RW4     RW5     RW6
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+        add_children(RW.at(3), RW.at(6));
+        ntnode *next;
+        const ntnode *cnext;
 
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_size(&empty_root) == 0) );
+        /* Step 2: Action. */
+        next = &convert(ecu_ntnode_next(&RW.at(2)));
+        cnext = &convert(ecu_ntnode_cnext(&RW.at(2)));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (next == &RW.at(3)) );
+        CHECK_TRUE( (cnext == &RW.at(3)) );
     }
     catch (const AssertException& e)
     {
@@ -4443,26 +4942,27 @@ TEST(NtNode, SizeNodeIsEmptyRoot)
 }
 
 /**
- * @brief Correct size returned.
+ * @brief NULL returned.
  */
-TEST(NtNode, SizeNodeIsNonEmptyRoot)
+TEST(NtNode, NextNodeIsLastSibling)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2 
-        |
-        RW3
-        |
-        RW4
+        RW1-----RW2-----RW3
+        |       |       |
+        RW4     RW5     RW6
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(3), RW.at(4));
-        add_siblings_after(RW.at(1), RW.at(2));
-
-        /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 4) );
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+        add_children(RW.at(3), RW.at(6));
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_next(&RW.at(3)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_cnext(&RW.at(3)) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4472,24 +4972,25 @@ TEST(NtNode, SizeNodeIsNonEmptyRoot)
 }
 
 /**
- * @brief Correct size returned.
+ * @brief NULL returned.
  */
-TEST(NtNode, SizeNodeIsNonEmptySubroot)
+TEST(NtNode, NextNodeWithNoSiblings)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2---RW3
-                |
-                RW4---RW5
+        RW1
+        |
+        RW2---RW3
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(2), RW.at(4), RW.at(5));
+        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(1), RW.at(2), RW.at(3));
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_size(&RW.at(2)) == 2) );
+        CHECK_TRUE( (ecu_ntnode_next(&RW.at(1)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_cnext(&RW.at(1)) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4498,27 +4999,38 @@ TEST(NtNode, SizeNodeIsNonEmptySubroot)
     }
 }
 
+/*------------------------------------------------------------*/
+/*---------------- TESTS - ECU_NTNODE_NTH_CHILD --------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief 0 returned.
+ * @brief Child at each position returned. Only
+ * children are returned, not grandchildren.
  */
-TEST(NtNode, SizeNodeIsLeaf)
+TEST(NtNode, NthChildNodeWithMultipleChildren)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0
+        root
         |
-        RW1-----RW2---RW3
-                |
-                RW4
+        n1-----n2-----n3
+               |
+               n4
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(2), RW.at(4));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        add_children(root, n1, n2, n3);
+        add_children(n2, n4);
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_size(&RW.at(1)) == 0) );
-        CHECK_TRUE( (ecu_ntnode_size(&RW.at(4)) == 0) );
-        CHECK_TRUE( (ecu_ntnode_size(&RW.at(3)) == 0) );
+        CHECK_TRUE( (ecu_ntnode_nth_child(&root, 0) == &n1) );
+        CHECK_TRUE( (ecu_ntnode_nth_child(&root, 1) == &n2) );
+        CHECK_TRUE( (ecu_ntnode_nth_cchild(&root, 2) == &n3) );
+        CHECK_TRUE( (ecu_ntnode_nth_cchild(&n2, 0) == &n4) );
     }
     catch (const AssertException& e)
     {
@@ -4528,37 +5040,25 @@ TEST(NtNode, SizeNodeIsLeaf)
 }
 
 /**
- * @brief Correct size returned.
+ * @brief NULL returned.
  */
-TEST(NtNode, SizeAddAndRemoveNodes)
+TEST(NtNode, NthChildIndexOutOfRange)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0
-        |
-        RW1-----RW2-----RW3
-        |       |       |
-        RW4     RW7     RW8
+        root
         |
-        RW5---RW6
+        n1-----n2
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(7));
-        add_children(RW.at(3), RW.at(8));
-        add_children(RW.at(4), RW.at(5), RW.at(6));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        add_children(root, n1, n2);
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 8) );
-        ecu_ntnode_remove(&RW.at(3));
-        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 6) );
-        ecu_ntnode_remove(&RW.at(1));
-        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 2) );
-        ecu_ntnode_push_child_back(&RW.at(7), &RW.at(3));
-        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 4) );
-        ecu_ntnode_insert_sibling_after(&RW.at(2), &RW.at(10));
-        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 5) );
+        CHECK_TRUE( (ecu_ntnode_nth_child(&root, 2) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_nth_cchild(&root, 100) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4567,28 +5067,19 @@ TEST(NtNode, SizeAddAndRemoveNodes)
     }
 }
 
-/*------------------------------------------------------------*/
-/*------------------ TESTS - ECU_NTNODE_VALID ----------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief Correct status returned.
+ * @brief NULL returned.
  */
-TEST(NtNode, Valid)
+TEST(NtNode, NthChildNodeWithNoChildren)
 {
     try
     {
         /* Step 1: Arrange. */
-        ecu_ntnode node;
+        rw_ntnode root{0};
 
         /* Steps 2 and 3: Action and assert. */
-        CHECK_FALSE( (ecu_ntnode_valid(&node)) );
-        ecu_ntnode_ctor(&node, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
-        CHECK_TRUE( (ecu_ntnode_valid(&node)) );
-        ecu_ntnode_destroy(&node);
-        CHECK_FALSE( (ecu_ntnode_valid(&node)) );
-        ecu_ntnode_ctor(&node, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
-        CHECK_TRUE( (ecu_ntnode_valid(&node)) );
+        CHECK_TRUE( (ecu_ntnode_nth_child(&root, 0) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_nth_cchild(&root, 0) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4597,35 +5088,47 @@ TEST(NtNode, Valid)
     }
 }
 
-/*------------------------------------------------------------*/
-/*------------------- TESTS - CHILD ITERATOR -----------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief General iteration test. Verify all children
- * iterated over.
+ * @brief Positions stay correct after every function
+ * that adds, moves, or takes away children.
  */
-TEST(NtNode, ChildIterator)
+TEST(NtNode, NthChildAfterMovesAndRemoves)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW0.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2------RW3----RW4
-                |
-                RW5 
+        RW1---RW2---RW3---RW4---RW5---RW6
+                    |
+                    RW7---RW8---RW9
         */
-        ecu_ntnode_child_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6));
+        add_children(RW.at(3), RW.at(7), RW.at(8), RW.at(9));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        ecu_ntnode_move_child_front(&RW.at(0), &RW.at(5));
+        ecu_ntnode_move_child_back(&RW.at(0), &RW.at(1));
+        CHECK_CHILDREN(RW.at(0), {&RW.at(5), &RW.at(2), &RW.at(3), &RW.at(4), &RW.at(6), &RW.at(1)});
+
+        ecu_ntnode_move_sibling_after(&RW.at(2), &RW.at(8));
+        ecu_ntnode_move_sibling_before(&RW.at(9), &RW.at(6));
+        CHECK_CHILDREN(RW.at(0), {&RW.at(5), &RW.at(2), &RW.at(8), &RW.at(3), &RW.at(4), &RW.at(1)});
+        CHECK_CHILDREN(RW.at(3), {&RW.at(7), &RW.at(6), &RW.at(9)});
+
+        ecu_ntnode_move_children(&RW.at(0), &RW.at(3));
+        CHECK_CHILDREN(RW.at(0), {&RW.at(5), &RW.at(2), &RW.at(8), &RW.at(3), &RW.at(4), &RW.at(1), &RW.at(7), &RW.at(6), &RW.at(9)});
+        CHECK_TRUE( (ecu_ntnode_nth_child(&RW.at(3), 0) == nullptr) );
+
+        ecu_ntnode_remove(&RW.at(5));
+        ecu_ntnode_insert_sibling_after(&RW.at(9), &RW.at(10));
+        ecu_ntnode_push_child_front(&RW.at(0), &RW.at(11));
+        CHECK_CHILDREN(RW.at(0), {&RW.at(11), &RW.at(2), &RW.at(8), &RW.at(3), &RW.at(4), &RW.at(1), &RW.at(7), &RW.at(6), &RW.at(9), &RW.at(10)});
+
+        ecu_ntnode_clear(&RW.at(0));
+        CHECK_TRUE( (ecu_ntnode_nth_child(&RW.at(0), 0) == nullptr) );
+        add_children(RW.at(0), RW.at(6), RW.at(2));
+        CHECK_CHILDREN(RW.at(0), {&RW.at(6), &RW.at(2)});
     }
     catch (const AssertException& e)
     {
@@ -4634,31 +5137,23 @@ TEST(NtNode, ChildIterator)
     }
 }
 
+/*------------------------------------------------------------*/
+/*------------------ TESTS - ECU_NTNODE_PARENT ---------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief General iteration test. Verify all children
- * iterated over.
+ * @brief NULL returned.
  */
-TEST(NtNode, ConstChildIterator)
+TEST(NtNode, ParentNodeIsEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW0.
-        RW0
-        |
-        RW1-----RW2------RW3----RW4
-                |
-                RW5 
-        */
-        ecu_ntnode_child_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_parent(&empty_root) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_cparent(&empty_root) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4668,30 +5163,22 @@ TEST(NtNode, ConstChildIterator)
 }
 
 /**
- * @brief Perform a child iteration on a node that has
- * one child.
+ * @brief NULL returned.
  */
-TEST(NtNode, ChildIteratorParentHasOneChild)
+TEST(NtNode, ParentNodeIsNonEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW2.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2------RW3----RW4
-                |
-                RW5 
+        RW1---RW2
         */
-        ecu_ntnode_child_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
-        EXPECT_NODES_IN_TREE(RW.at(5));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_parent(&RW.at(0)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_cparent(&RW.at(0)) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4701,30 +5188,34 @@ TEST(NtNode, ChildIteratorParentHasOneChild)
 }
 
 /**
- * @brief Perform a child iteration on a node that has
- * one child.
+ * @brief Parent returned.
  */
-TEST(NtNode, ConstChildIteratorParentHasOneChild)
+TEST(NtNode, ParentNodeIsNonEmptySubroot)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW2.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2------RW3----RW4
+        RW1-----RW2---RW3
                 |
-                RW5 
+                RW3---RW4
+                |
+                RW5
         */
-        ecu_ntnode_child_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
-        EXPECT_NODES_IN_TREE(RW.at(5));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(3), RW.at(5));
+        ntnode *parent;
+        const ntnode *cparent;
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        parent = &convert(ecu_ntnode_parent(&RW.at(3)));
+        cparent = &convert(ecu_ntnode_cparent(&RW.at(3)));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (parent == &RW.at(2)) );
+        CHECK_TRUE( (cparent == &RW.at(2)) );
     }
     catch (const AssertException& e)
     {
@@ -4734,26 +5225,34 @@ TEST(NtNode, ConstChildIteratorParentHasOneChild)
 }
 
 /**
- * @brief Perform a child iteration on a node that has
- * no children. Iteration should end immediately.
+ * @brief Parent returned.
  */
-TEST(NtNode, ChildIteratorParentHasNoChildren)
+TEST(NtNode, ParentNodeIsLeaf)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1 
+        RW1-----RW2---RW3
+                |
+                RW3---RW4
+                |
+                RW5
         */
-        ecu_ntnode_child_iterator iter;
-        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(3), RW.at(5));
+        ntnode *parent;
+        const ntnode *cparent;
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        parent = &convert(ecu_ntnode_parent(&RW.at(5)));
+        cparent = &convert(ecu_ntnode_cparent(&RW.at(5)));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (parent == &RW.at(3)) );
+        CHECK_TRUE( (cparent == &RW.at(3)) );
     }
     catch (const AssertException& e)
     {
@@ -4762,27 +5261,23 @@ TEST(NtNode, ChildIteratorParentHasNoChildren)
     }
 }
 
+/*------------------------------------------------------------*/
+/*------------------- TESTS - ECU_NTNODE_PREV ----------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Perform a child iteration on a node that has
- * no children. Iteration should end immediately.
+ * @brief NULL returned.
  */
-TEST(NtNode, ConstChildIteratorParentHasNoChildren)
+TEST(NtNode, PrevNodeIsEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
-        RW0
-        |
-        RW1 
-        */
-        ecu_ntnode_child_citerator citer;
-        add_children(RW.at(0), RW.at(1));
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_prev(&empty_root) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_cprev(&empty_root) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4792,45 +5287,54 @@ TEST(NtNode, ConstChildIteratorParentHasNoChildren)
 }
 
 /**
- * @brief Remove some nodes in the middle of a child iteration.
- * @warning Test verification requires working postorder iterator.
+ * @brief NULL returned.
  */
-TEST(NtNode, ChildIteratorRemoveSome)
+TEST(NtNode, PrevNodeIsNonEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW0.
-        Remove RW1 and RW2.
-
-        Before:
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1----RO0----RW2---RO1
-                                        
-        After:
-        RW0             RW1         RW2
-        |
-        RO0-----RO1
+        RW1---RW2
         */
-        ecu_ntnode_child_iterator iter;
-        add_children(RW.at(0), RW.at(1), RO.at(0), RW.at(2), RO.at(1));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
 
-        /* Step 2: Action. */
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_prev(&RW.at(0)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_cprev(&RW.at(0)) == nullptr) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (is_root(RW.at(1), RW.at(2))) );
+/**
+ * @brief NULL returned.
+ */
+TEST(NtNode, PrevNodeIsFirstSibling)
+{
+    try
+    {
+        /* Step 1: Arrange. 
+        RW0
+        |
+        RW1-----RW2-----RW3
+        |               |
+        RW4             RW6
+                        |
+                        RW7---RW8
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(3), RW.at(6));
+        add_children(RW.at(6), RW.at(7), RW.at(8));
 
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_iterator postorder_iter;
-        EXPECT_NODES_IN_TREE(RO.at(0), RO.at(1), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_prev(&RW.at(1)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_cprev(&RW.at(1)) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4840,48 +5344,35 @@ TEST(NtNode, ChildIteratorRemoveSome)
 }
 
 /**
- * @brief Remove all nodes returned by child iteration.
- * @warning Test verification requires working postorder iterator.
+ * @brief Previous sibling returned.
  */
-TEST(NtNode, ChildIteratorRemoveAll)
+TEST(NtNode, PrevNodeIsMiddleSibling)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW2.
-        Remove all children.
-
-        Before:
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1-----RW2---RW3---RW4
-                |
-                RW5---RW6---RW7
-                                        
-        After:
-        RW0                         RW5  RW6  RW7
-        |
-        RW1-----RW2---RW3---RW4
+        RW1-----RW2-----RW3
+        |               |
+        RW4             RW6
+                        |
+                        RW7---RW8
         */
-        ecu_ntnode_child_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(2), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(3), RW.at(6));
+        add_children(RW.at(6), RW.at(7), RW.at(8));
+        ntnode *prev;
+        const ntnode *cprev;
 
         /* Step 2: Action. */
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(2))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
+        prev = &convert(ecu_ntnode_prev(&RW.at(2)));
+        cprev = &convert(ecu_ntnode_cprev(&RW.at(2)));
 
         /* Step 3: Assert. */
-        CHECK_TRUE( (is_root(RW.at(5), RW.at(6), RW.at(7))) );
-
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_iterator postorder_iter;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (prev == &RW.at(1)) );
+        CHECK_TRUE( (cprev == &RW.at(1)) );
     }
     catch (const AssertException& e)
     {
@@ -4891,43 +5382,35 @@ TEST(NtNode, ChildIteratorRemoveAll)
 }
 
 /**
- * @brief Destroy some nodes in the middle of a child iteration.
- * @warning Test verification requires working postorder iterator.
+ * @brief Previous sibling returned.
  */
-TEST(NtNode, ChildIteratorDestroySome)
+TEST(NtNode, PrevNodeIsLastSibling)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW0.
-        Destroy DN nodes.
-
-        Before:
-        RW0
-        |
-        RW1---DN0---RW2---DN1
-                                        
-        After:
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1---RW2
+        RW1-----RW2-----RW3
+        |               |
+        RW4             RW6
+                        |
+                        RW7---RW8
         */
-        ecu_ntnode_child_iterator iter;
-        add_children(RW.at(0), RW.at(1), DN.at(0), RW.at(2), DN.at(1));
-        EXPECT_NODES_DESTROYED(DN.at(0), DN.at(1));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(3), RW.at(6));
+        add_children(RW.at(6), RW.at(7), RW.at(8));
+        ntnode *prev;
+        const ntnode *cprev;
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_destroy_visitor);
-        }
+        /* Step 2: Action. */
+        prev = &convert(ecu_ntnode_prev(&RW.at(3)));
+        cprev = &convert(ecu_ntnode_cprev(&RW.at(3)));
 
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_iterator postorder_iter;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. */
+        CHECK_TRUE( (prev == &RW.at(2)) );
+        CHECK_TRUE( (cprev == &RW.at(2)) );
     }
     catch (const AssertException& e)
     {
@@ -4937,46 +5420,25 @@ TEST(NtNode, ChildIteratorDestroySome)
 }
 
 /**
- * @brief Destroy all nodes returned by child iteration.
- * @warning Test verification requires working postorder iterator.
+ * @brief NULL returned.
  */
-TEST(NtNode, ChildIteratorDestroyAll)
+TEST(NtNode, PrevNodeWithNoSiblings)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW2.
-        Destroy DN nodes.
-
-        Before:
+        /* Step 1: Arrange.
         RW0
         |
         RW1-----RW2---RW3
                 |
-                DN0---DN1---DN2
-                                        
-        After:
-        RW0
-        |
-        RW1-----RW2----RW3
+                RW4
         */
-        ecu_ntnode_child_iterator iter;
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(2), DN.at(0), DN.at(1), DN.at(2));
-        EXPECT_NODES_DESTROYED(DN.at(0), DN.at(1), DN.at(2));
+        add_children(RW.at(2), RW.at(4));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(2))
-        {
-            convert(n).accept(node_destroy_visitor);
-        }
-
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_iterator postorder_iter;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_prev(&RW.at(4)) == nullptr) );
+        CHECK_TRUE( (ecu_ntnode_cprev(&RW.at(4)) == nullptr) );
     }
     catch (const AssertException& e)
     {
@@ -4985,84 +5447,161 @@ TEST(NtNode, ChildIteratorDestroyAll)
     }
 }
 
+/*------------------------------------------------------------*/
+/*------------ TESTS - ECU_NTNODE_PUSH_CHILD_BACK ------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Calling next() after an iteration is finished
- * is not allowed.
+ * @brief Child added to back.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ChildIteratorNextAfterDone)
+TEST(NtNode, PushChildBackParentWithMultipleChildren)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_child_iterator iter;
-        EXPECT_ASSERTION();
+        /* Step 1: Arrange.
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
+        Before:
+        RW0                                 RW11
+        |                                   |
+        RW1-----RW2---RW3                   RW12---RW13
+                |                           |
+                RW4-----RW5---------RW6     RW14
+                |       |           |
+                RW7     RW8---RW9   RW10
+
+        After:
+        RW0
+        |
+        RW1-----RW2---RW3
+                |
+                RW4-----RW5---------RW6-----RW11
+                |       |           |       |
+                RW7     RW8---RW9   RW10    RW12---RW13
+                                            |
+                                            RW14
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(2), RW.at(4), RW.at(5), RW.at(6));
+        add_children(RW.at(4), RW.at(7));
+        add_children(RW.at(5), RW.at(8), RW.at(9));
+        add_children(RW.at(6), RW.at(10));
+        add_children(RW.at(11), RW.at(12), RW.at(13));
+        add_children(RW.at(12), RW.at(14));
+
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_back(&RW.at(2), &RW.at(11));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(7), RW.at(4), RW.at(8), RW.at(9), RW.at(5),
+                             RW.at(10), RW.at(6), RW.at(14), RW.at(12), RW.at(13), RW.at(11),
+                             RW.at(2), RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
-            (void)n;
+            convert(n).accept(node_obj_in_tree_visitor);
         }
-        (void)ecu_ntnode_child_iterator_next(&iter);
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Calling cnext() after an iteration is finished
- * is not allowed.
+ * @brief Child added to back.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ConstChildIteratorNextAfterDone)
+TEST(NtNode, PushChildBackParentWithOneChild)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_child_citerator citer;
-        EXPECT_ASSERTION();
+        /* Step 1: Arrange.
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(0))
+        Before:
+        RW0                     RW9
+        |                       |
+        RW1-----RW2-----RW3     RW10----RW11
+        |       |       |               |
+        RW4     RW5     RW6             RW12
+                |
+                RW7---RW8
+
+        After:
+        RW0
+        |
+        RW1-----RW2-----------------RW3
+        |       |                   |
+        RW4     RW5---------RW9     RW6
+                |           |
+                RW7---RW8   RW10----RW11
+                                    |
+                                    RW12
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+        add_children(RW.at(3), RW.at(6));
+        add_children(RW.at(5), RW.at(7), RW.at(8));
+        add_children(RW.at(9), RW.at(10), RW.at(11));
+        add_children(RW.at(11), RW.at(12));
+
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_back(&RW.at(2), &RW.at(9));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(7), RW.at(8), RW.at(5), RW.at(10), RW.at(12),
+                             RW.at(11), RW.at(9), RW.at(2), RW.at(6), RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
-            (void)n;
+            convert(n).accept(node_obj_in_tree_visitor);
         }
-        (void)ecu_ntnode_child_iterator_cnext(&citer);
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Child added.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ChildIteratorMultipleTimes)
+TEST(NtNode, PushChildBackParentWithNoChildren)
 {
     try
     {
         /* Step 1: Arrange.
+
+        Before:
+        RW0                         RW6
+        |
+        RW1-----RW2-----RW3
+                |       |
+                RW4     RW5
+
+        After:
         RW0
         |
-        RW1---RW2
+        RW1-----RW2-----RW3
+        |       |       |
+        RW6     RW4     RW5
         */
-        ecu_ntnode_child_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(1), RW.at(2), RW.at(1), RW.at(2));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(2), RW.at(4));
+        add_children(RW.at(3), RW.at(5));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_back(&RW.at(1), &RW.at(6));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(1), RW.at(4), RW.at(2), RW.at(5),
+                             RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -5075,73 +5614,108 @@ TEST(NtNode, ChildIteratorMultipleTimes)
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Not allowed.
  */
-TEST(NtNode, ConstChildIteratorMultipleTimes)
+TEST(NtNode, PushChildBackParentEqualsChild)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
-        |
-        RW1---RW2
         */
-        ecu_ntnode_child_citerator citer;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_back(&RW.at(0), &RW.at(0));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed.
+ */
+TEST(NtNode, PushChildBackChildInTree)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0         RW3
+        |           |
+        RW1---RW2   RW4
+        */
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(1), RW.at(2), RW.at(1), RW.at(2));
+        add_children(RW.at(3), RW.at(4));
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_back(&RW.at(1), &RW.at(4));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /*------------------------------------------------------------*/
-/*-------------- TESTS - NEXT SIBLING AT ITERATOR ------------*/
+/*------------ TESTS - ECU_NTNODE_PUSH_CHILD_FRONT -----------*/
 /*------------------------------------------------------------*/
 
 /**
- * @brief Verify correct nodes in iteration returned.
+ * @brief Child added to front.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, NextSiblingAtIteratorStartIsFirstSibling)
+TEST(NtNode, PushChildFrontParentWithMultipleChildren)
 {
     try
     {
         /* Step 1: Arrange.
+
+        Before:
+        RW0                                 RW11
+        |                                   |
+        RW1-----RW2---RW3                   RW12---RW13
+                |                           |
+                RW4-----RW5---------RW6     RW14
+                |       |           |
+                RW7     RW8---RW9   RW10
+
+        After:
         RW0
         |
-        RW1-----RW2---------------------RW3
-        |       |                       |
-        RW4     RW5---RW6---RW7---RW8   RW9---RW10
-                |           |
-                RW11        RW12
+        RW1-----RW2---RW3
+                |
+                RW11------------RW4-----RW5---------RW6
+                |               |       |           |
+                RW12---RW13     RW7     RW8---RW9   RW10
+                |
+                RW14
         */
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5), RW.at(6), RW.at(7), RW.at(8));
-        add_children(RW.at(3), RW.at(9), RW.at(10));
-        add_children(RW.at(5), RW.at(11));
-        add_children(RW.at(7), RW.at(12));
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6), RW.at(7), RW.at(8));
+        add_children(RW.at(2), RW.at(4), RW.at(5), RW.at(6));
+        add_children(RW.at(4), RW.at(7));
+        add_children(RW.at(5), RW.at(8), RW.at(9));
+        add_children(RW.at(6), RW.at(10));
+        add_children(RW.at(11), RW.at(12), RW.at(13));
+        add_children(RW.at(12), RW.at(14));
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(5))
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_front(&RW.at(2), &RW.at(11));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(14), RW.at(12), RW.at(13), RW.at(11), RW.at(7),
+                             RW.at(4), RW.at(8), RW.at(9), RW.at(5), RW.at(10), RW.at(6),
+                             RW.at(2), RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -5154,32 +5728,51 @@ TEST(NtNode, NextSiblingAtIteratorStartIsFirstSibling)
 }
 
 /**
- * @brief Verify correct nodes in iteration returned.
+ * @brief Child added to front.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ConstNextSiblingAtIteratorStartIsFirstSibling)
+TEST(NtNode, PushChildFrontParentWithOneChild)
 {
     try
     {
         /* Step 1: Arrange.
+
+        Before:
+        RW0                     RW9
+        |                       |
+        RW1-----RW2-----RW3     RW10----RW11
+        |       |       |               |
+        RW4     RW5     RW6             RW12
+                |
+                RW7---RW8
+
+        After:
         RW0
         |
-        RW1-----RW2---------------------RW3
-        |       |                       |
-        RW4     RW5---RW6---RW7---RW8   RW9---RW10
-                |           |
-                RW11        RW12
+        RW1-----RW2-------------------------RW3
+        |       |                           |
+        RW4     RW9-------------RW5         RW6
+                |               |
+                RW10----RW11    RW7---RW8
+                        |
+                        RW12
         */
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
         add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5), RW.at(6), RW.at(7), RW.at(8));
-        add_children(RW.at(3), RW.at(9), RW.at(10));
-        add_children(RW.at(5), RW.at(11));
-        add_children(RW.at(7), RW.at(12));
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6), RW.at(7), RW.at(8));
+        add_children(RW.at(2), RW.at(5));
+        add_children(RW.at(3), RW.at(6));
+        add_children(RW.at(5), RW.at(7), RW.at(8));
+        add_children(RW.at(9), RW.at(10), RW.at(11));
+        add_children(RW.at(11), RW.at(12));
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(5))
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_front(&RW.at(2), &RW.at(9));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(10), RW.at(12), RW.at(11), RW.at(9),
+                             RW.at(7), RW.at(8), RW.at(5), RW.at(2), RW.at(6), RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -5192,26 +5785,41 @@ TEST(NtNode, ConstNextSiblingAtIteratorStartIsFirstSibling)
 }
 
 /**
- * @brief Verify correct nodes in iteration returned.
+ * @brief Child added.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, NextSiblingAtIteratorStartIsMiddleSibling)
+TEST(NtNode, PushChildFrontParentWithNoChildren)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0
+
+        Before:
+        RW0                         RW6
         |
-        RW1-----RW2
-                |
-                RW3---RW4---RW5---RW6
+        RW1-----RW2-----RW3
+                |       |
+                RW4     RW5
+
+        After:
+        RW0
+        |
+        RW1-----RW2-----RW3
+        |       |       |
+        RW6     RW4     RW5
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6));
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(6));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(2), RW.at(4));
+        add_children(RW.at(3), RW.at(5));
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(4))
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_front(&RW.at(1), &RW.at(6));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(1), RW.at(4), RW.at(2), RW.at(5),
+                             RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -5224,115 +5832,105 @@ TEST(NtNode, NextSiblingAtIteratorStartIsMiddleSibling)
 }
 
 /**
- * @brief Verify correct nodes in iteration returned.
+ * @brief Not allowed.
  */
-TEST(NtNode, ConstNextSiblingAtIteratorStartIsMiddleSibling)
+TEST(NtNode, PushChildFrontParentEqualsChild)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
-        |
-        RW1-----RW2
-                |
-                RW3---RW4---RW5---RW6
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6));
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(6));
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(4))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_front(&RW.at(0), &RW.at(0));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Last sibling returned then iteration ends.
+ * @brief Not allowed.
  */
-TEST(NtNode, NextSiblingAtIteratorStartIsLastSibling)
+TEST(NtNode, PushChildFrontChildInTree)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0
-        |
-        RW1-----RW2
-                |
-                RW3
+        RW0         RW3
+        |           |
+        RW1---RW2   RW4
         */
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(2));
+        add_children(RW.at(3), RW.at(4));
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_front(&RW.at(1), &RW.at(4));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
+/*------------------------------------------------------------*/
+/*----------------- TESTS - ECU_NTNODE_REMOVE ----------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Last sibling returned then iteration ends.
+ * @brief Node removed correctly. Node's tree and
+ * tree it was removed from unharmed.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ConstNextSiblingAtIteratorStartIsLastSibling)
+TEST(NtNode, RemoveNodeIsLeftMostSubroot)
 {
     try
     {
         /* Step 1: Arrange.
+
+        Before:
         RW0
         |
-        RW1-----RW2
-                |
-                RW3
+        RW1---------RW2-----RW3
+        |           |       |
+        RW4---RW5   RW6     RW7
+
+        After:
+        RW0             RW1
+        |               |
+        RW2-----RW3     RW4---RW5
+        |       |
+        RW6     RW7
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(2));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(3), RW.at(7));
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(2))
+        /* Step 2: Action. */
+        ecu_ntnode_remove(&RW.at(1));
+
+        /* Step 3: Assert. Verify tree still intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(2), RW.at(7), RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
-    }
-    catch (const AssertException& e)
-    {
-        /* FAIL. */
-        (void)e;
-    }
-}
-
-/**
- * @brief Root returned then iteration ends.
- */
-TEST(NtNode, NextSiblingAtIteratorStartIsRoot)
-{
-    try
-    {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
-        EXPECT_NODES_IN_TREE(empty_root);
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &empty_root)
+        /* Step 3: Assert: Verify removed tree still intact. */
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -5345,19 +5943,55 @@ TEST(NtNode, NextSiblingAtIteratorStartIsRoot)
 }
 
 /**
- * @brief Root returned then iteration ends.
+ * @brief Node removed correctly. Node's tree and
+ * tree it was removed from unharmed.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ConstNextSiblingAtIteratorStartIsRoot)
+TEST(NtNode, RemoveNodeIsMiddleSubroot)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
-        EXPECT_NODES_IN_TREE(empty_root);
+        /* Step 1: Arrange.
+        
+        Before:
+        RW0
+        |
+        RW1---------RW2-----RW3
+        |           |       |
+        RW4---RW5   RW6     RW7
+                    |
+                    RW8
+                    |
+                    RW9
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &empty_root)
+        After:
+        RW0                 RW2
+        |                   |
+        RW1---------RW3     RW6
+        |           |       |
+        RW4---RW5   RW7     RW8
+                            |
+                            RW9
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_branch(RW.at(2), RW.at(6), RW.at(8), RW.at(9));
+        add_children(RW.at(3), RW.at(7));
+
+        /* Step 2: Action. */
+        ecu_ntnode_remove(&RW.at(2));
+
+        /* Step 3: Assert. Verify tree still intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(7), RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        /* Step 3: Assert: Verify removed tree still intact. */
+        EXPECT_NODES_IN_TREE(RW.at(9), RW.at(8), RW.at(6), RW.at(2));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(2))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -5370,26 +6004,49 @@ TEST(NtNode, ConstNextSiblingAtIteratorStartIsRoot)
 }
 
 /**
- * @brief Verify correct nodes in iteration returned.
+ * @brief Node removed correctly. Node's tree and
+ * tree it was removed from unharmed.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, NextSiblingAtIteratorStartHasOneSibling)
+TEST(NtNode, RemoveNodeIsRightMostSubroot)
 {
     try
     {
         /* Step 1: Arrange.
+
+        Before:
         RW0
         |
-        RW1---RW2
-        |
-        RW3
+        RW1---------RW2-----RW3
+        |           |       |
+        RW4---RW5   RW6     RW7
+
+        After:
+        RW0                 RW3
+        |                   |
+        RW1---------RW2     RW7
+        |           |
+        RW4---RW5   RW6
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(3), RW.at(7));
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(1))
+        /* Step 2: Action. */
+        ecu_ntnode_remove(&RW.at(3));
+
+        /* Step 3: Assert. Verify tree still intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(6), RW.at(2), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        /* Step 3: Assert: Verify removed tree still intact. */
+        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(3));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(3))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -5402,89 +6059,47 @@ TEST(NtNode, NextSiblingAtIteratorStartHasOneSibling)
 }
 
 /**
- * @brief Verify correct nodes in iteration returned.
+ * @brief Node removed correctly. Tree node was
+ * removed from unharmed.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ConstNextSiblingAtIteratorStartHasOneSibling)
+TEST(NtNode, RemoveNodeIsLeaf)
 {
     try
     {
         /* Step 1: Arrange.
+
+        Before:
         RW0
         |
-        RW1---RW2
+        RW1
         |
-        RW3
-        */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2));
-
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-    }
-    catch (const AssertException& e)
-    {
-        /* FAIL. */
-        (void)e;
-    }
-}
-
-/**
- * @brief Remove some nodes in the middle of an iteration. 
- * Verify trees intact.
- * @warning Test validation requires working postorder iterator.
- */
-TEST(NtNode, NextSiblingAtIteratorRemoveSome)
-{
-    try
-    {
-        /* Step 1: Arrange.
+        RW2
 
-        Before:
-        RW0
-        |
-        RW1---RW2---RO0-----RO1
-        |           |       |
-        RW3---RW4   RW5     RW6---RW7
-        
         After:
-        RW0                 RW1         RW2
-        |                   |
-        RO0-----RO1         RW3---RW4
-        |       |
-        RW5     RW6---RW7
+        RW0     RW2
+        |
+        RW1
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RO.at(0), RO.at(1));
-        add_children(RW.at(1), RW.at(3), RW.at(4));
-        add_children(RO.at(0), RW.at(5));
-        add_children(RO.at(1), RW.at(6), RW.at(7));
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
 
         /* Step 2: Action. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
+        ecu_ntnode_remove(&RW.at(2));
 
-        /* Step 3: Assert. Verify remaining tree intact. */
+        /* Step 3: Assert. Verify tree still intact. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(5), RO.at(0), RW.at(6), RW.at(7), RO.at(1), RW.at(0));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(0));
         ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
 
-        /* Step 3: Assert. Verify removed trees intact. */
-        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(4), RW.at(1));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
+        /* Step 3: Assert: Verify removed tree still intact. */
+        EXPECT_NODES_IN_TREE(RW.at(2));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(2))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
-        CHECK_TRUE( (not_in_tree(RW.at(2))) );
     }
     catch (const AssertException& e)
     {
@@ -5494,55 +6109,30 @@ TEST(NtNode, NextSiblingAtIteratorRemoveSome)
 }
 
 /**
- * @brief Remove all nodes in the iteration. Verify
- * trees intact.
+ * @brief OK. Does nothing.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, NextSiblingAtIteratorRemoveAll)
+TEST(NtNode, RemoveNodeIsNonEmptyRoot)
 {
     try
     {
         /* Step 1: Arrange.
-
-        Before:
         RW0
         |
-        RW1---RW2---RW3-----RW4
-        |                   |
-        RW5---RW6           RW8---RW9
-        
-        After:
-        RW0     RW1         RW2     RW3     RW4
-                |                           |
-                RW5---RW6                   RW8---RW9
+        RW1---RW2
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(1), RW.at(5), RW.at(6));
-        add_children(RW.at(4), RW.at(8), RW.at(9));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
 
         /* Step 2: Action. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
-
-        /* Step 3: Assert. Verify remaining tree intact. */
-        CHECK_TRUE( (not_in_tree(RW.at(0))) );
+        ecu_ntnode_remove(&RW.at(0));
 
-        /* Step 3: Assert. Verify removed trees intact. */
+        /* Step 3: Assert. Verify tree unchanged. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6), RW.at(1));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        EXPECT_NODES_IN_TREE(RW.at(8), RW.at(9), RW.at(4));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(4))
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
-        CHECK_TRUE( (not_in_tree(RW.at(2), RW.at(3))) );
     }
     catch (const AssertException& e)
     {
@@ -5552,31 +6142,23 @@ TEST(NtNode, NextSiblingAtIteratorRemoveAll)
 }
 
 /**
- * @brief Nothing happens to tree.
+ * @brief OK. Does nothing.
  * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, NextSiblingAtIteratorStartIsRootRemoveRoot)
+TEST(NtNode, RemoveNodeIsEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange.
-        RW0
-        |
-        RW1---RW2
-        */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        
         /* Step 2: Action. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
+        ecu_ntnode_remove(&empty_root);
 
-        /* Step 3: Assert. Verify remaining tree intact. */
+        /* Step 3: Assert. Verify tree unchanged. */
         ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        EXPECT_NODES_IN_TREE(empty_root);
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &empty_root)
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -5588,57 +6170,49 @@ TEST(NtNode, NextSiblingAtIteratorStartIsRootRemoveRoot)
     }
 }
 
+/*------------------------------------------------------------*/
+/*----------------- TESTS - ECU_NTNODE_RESOLVE ---------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Destroy some nodes in the middle of an iteration. 
- * Verify remaining tree intact.
- * @warning Test validation requires working postorder iterator.
+ * @brief Node at the end of the path returned.
  */
-TEST(NtNode, NextSiblingAtIteratorDestroySome)
+TEST(NtNode, ResolvePathExists)
 {
     try
     {
         /* Step 1: Arrange.
-
-        Before:
-        RW0
-        |
-        DN0-----DN1---------DN2-----DN3
-        |       |           |       |
-        RW1     RW2---RW3   RW4     RW5
-        |
-        RW6 
-        
-        After:
-        RW0
-        |
-        DN0-----DN1
-        |       |
-        RW1     RW2---RW3
+        root
         |
-        RW6
+        n1-----n2
+        |      |
+        n3     n4-----n5
+                      |
+                      n6
         */
-        add_children(RW.at(0), DN.at(0), DN.at(1), DN.at(2), DN.at(3));
-        add_children(DN.at(0), RW.at(1));
-        add_children(DN.at(1), RW.at(2), RW.at(3));
-        add_children(DN.at(2), RW.at(4));
-        add_children(DN.at(3), RW.at(5));
-        add_children(RW.at(1), RW.at(6));
-        EXPECT_NODES_DESTROYED(DN.at(2), RW.at(4), DN.at(3), RW.at(5));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        rw_ntnode n5{5};
+        rw_ntnode n6{6};
+        add_children(root, n1, n2);
+        add_children(n1, n3);
+        add_children(n2, n4, n5);
+        add_children(n5, n6);
+        const ecu_object_id_t path1[] = {2, 5, 6};
+        const ecu_object_id_t path2[] = {1, 3};
+        ecu_ntnode *node;
+        const ecu_ntnode *cnode;
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &DN.at(2))
-        {
-            convert(n).accept(node_destroy_visitor);
-        }
-
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(1), DN.at(0), RW.at(2), RW.at(3), DN.at(1), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        node = ecu_ntnode_resolve(&root, &path1[0], 3);
+        cnode = ecu_ntnode_cresolve(&root, &path2[0], 2);
+        CHECK_TRUE( (node == &n6) );
+        CHECK_TRUE( (cnode == &n3) );
+        node = ecu_ntnode_resolve(&n2, &path1[1], 1);
+        CHECK_TRUE( (node == &n5) );
     }
     catch (const AssertException& e)
     {
@@ -5648,56 +6222,33 @@ TEST(NtNode, NextSiblingAtIteratorDestroySome)
 }
 
 /**
- * @brief Destroy all nodes in the iteration. Verify
- * remaining tree intact.
- * @warning Test validation requires working postorder iterator.
+ * @brief NULL returned if any step of the path is missing.
  */
-TEST(NtNode, NextSiblingAtIteratorDestroyAll)
+TEST(NtNode, ResolvePathDoesNotExist)
 {
     try
     {
         /* Step 1: Arrange.
-
-        Before:
-        RW0
-        |
-        RW1
-        |
-        DN0-----DN1---------DN2-----DN3
-        |       |           |       |
-        RW2     RW3---RW4   RW5     RW6
+        root
         |
-        RW7 
-        
-        After:
-        RW0
+        n1-----n2
         |
-        RW1
+        n3
         */
-        add_children(RW.at(0), RW.at(1));
-        add_children(RW.at(1), DN.at(0), DN.at(1), DN.at(2), DN.at(3));
-        add_children(DN.at(0), RW.at(2));
-        add_children(DN.at(1), RW.at(3), RW.at(4));
-        add_children(DN.at(2), RW.at(5));
-        add_children(DN.at(3), RW.at(6));
-        add_children(RW.at(2), RW.at(7));
-        EXPECT_NODES_DESTROYED(DN.at(0), RW.at(2), RW.at(7), DN.at(1), RW.at(3), RW.at(4), DN.at(2),
-                               RW.at(5), DN.at(3), RW.at(6));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        add_children(root, n1, n2);
+        add_children(n1, n3);
+        const ecu_object_id_t missing_first[] = {4, 3};
+        const ecu_object_id_t missing_last[] = {1, 4};
+        const ecu_object_id_t too_long[] = {1, 3, 3};
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &DN.at(0))
-        {
-            convert(n).accept(node_destroy_visitor);
-        }
-
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (!ecu_ntnode_resolve(&root, &missing_first[0], 2)) );
+        CHECK_TRUE( (!ecu_ntnode_cresolve(&root, &missing_last[0], 2)) );
+        CHECK_TRUE( (!ecu_ntnode_resolve(&root, &too_long[0], 3)) );
     }
     catch (const AssertException& e)
     {
@@ -5707,26 +6258,20 @@ TEST(NtNode, NextSiblingAtIteratorDestroyAll)
 }
 
 /**
- * @brief Iteration should be able to exit after root destroyed.
+ * @brief Starting node returned. Path can be NULL.
  */
-TEST(NtNode, NextSiblingAtIteratorStartIsRootDestroyRoot)
+TEST(NtNode, ResolveEmptyPath)
 {
     try
     {
-        /* Step 1: Arrange.
-        RW0
-        |
-        RW1---RW2
-        */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        EXPECT_NODES_DESTROYED(RW.at(0), RW.at(1), RW.at(2));
+        /* Step 1: Arrange. */
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        add_children(root, n1);
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            ecu_ntnode_destroy(n);
-        }
+        CHECK_TRUE( (ecu_ntnode_resolve(&root, nullptr, 0) == &root) );
+        CHECK_TRUE( (ecu_ntnode_cresolve(&n1, nullptr, 0) == &n1) );
     }
     catch (const AssertException& e)
     {
@@ -5736,24 +6281,18 @@ TEST(NtNode, NextSiblingAtIteratorStartIsRootDestroyRoot)
 }
 
 /**
- * @brief Calling next() after an iteration is finished
- * is not allowed.
+ * @brief Path cannot be NULL if it has a length.
  */
-TEST(NtNode, NextSiblingAtIteratorNextAfterDone)
+TEST(NtNode, ResolveNullPath)
 {
     try
     {
         /* Step 1: Arrange. */
-        rw_ntnode empty_root;
+        rw_ntnode root{0};
         EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &empty_root)
-        {
-            (void)n;
-        }
-        (void)ecu_ntnode_next_sibling_iterator_next(&iter);
+        (void)ecu_ntnode_resolve(&root, nullptr, 1);
 
         /* Step 3: Assert. Test fails if assertion does not fire. */
     }
@@ -5764,64 +6303,51 @@ TEST(NtNode, NextSiblingAtIteratorNextAfterDone)
     }
 }
 
+/*------------------------------------------------------------*/
+/*------------------- TESTS - ECU_NTNODE_SIZE ----------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Calling cnext() after an iteration is finished
- * is not allowed.
+ * @brief 0 returned.
  */
-TEST(NtNode, ConstNextSiblingAtIteratorNextAfterDone)
+TEST(NtNode, SizeNodeIsEmptyRoot)
 {
     try
     {
         /* Step 1: Arrange. */
         rw_ntnode empty_root;
-        EXPECT_ASSERTION();
-
-        /* Step 2: Action. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &empty_root)
-        {
-            (void)n;
-        }
-        (void)ecu_ntnode_next_sibling_iterator_cnext(&citer);
 
-        /* Step 3: Assert. Test fails if assertion does not fire. */
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ntnode_size(&empty_root) == 0) );
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Correct size returned.
  */
-TEST(NtNode, NextSiblingAtIteratorMultipleTimes)
+TEST(NtNode, SizeNodeIsNonEmptyRoot)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2---RW3
+        RW1---RW2 
+        |
+        RW3
+        |
+        RW4
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(2), RW.at(3), RW.at(3));
-        ecu_ntnode_next_sibling_iterator iter;
+        add_branch(RW.at(0), RW.at(1), RW.at(3), RW.at(4));
+        add_siblings_after(RW.at(1), RW.at(2));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(3))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 4) );
     }
     catch (const AssertException& e)
     {
@@ -5831,34 +6357,24 @@ TEST(NtNode, NextSiblingAtIteratorMultipleTimes)
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Correct size returned.
  */
-TEST(NtNode, ConstNextSiblingAtIteratorMultipleTimes)
+TEST(NtNode, SizeNodeIsNonEmptySubroot)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2---RW3
+        RW1-----RW2---RW3
+                |
+                RW4---RW5
         */
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(2), RW.at(3), RW.at(3));
-        ecu_ntnode_next_sibling_citerator citer;
+        add_children(RW.at(2), RW.at(4), RW.at(5));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(3))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_size(&RW.at(2)) == 2) );
     }
     catch (const AssertException& e)
     {
@@ -5867,40 +6383,27 @@ TEST(NtNode, ConstNextSiblingAtIteratorMultipleTimes)
     }
 }
 
-/*------------------------------------------------------------*/
-/*--------------- TESTS - NEXT SIBLING ITERATOR --------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief Verify correct nodes in iteration returned.
+ * @brief 0 returned.
  */
-TEST(NtNode, NextSiblingIteratorStartIsFirstSibling)
+TEST(NtNode, SizeNodeIsLeaf)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2---------------------RW3
-        |       |                       |
-        RW4     RW5---RW6---RW7---RW8   RW9---RW10
-                |           |
-                RW11        RW12
+        RW1-----RW2---RW3
+                |
+                RW4
         */
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5), RW.at(6), RW.at(7), RW.at(8));
-        add_children(RW.at(3), RW.at(9), RW.at(10));
-        add_children(RW.at(5), RW.at(11));
-        add_children(RW.at(7), RW.at(12));
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(8));
+        add_children(RW.at(2), RW.at(4));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(5))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_size(&RW.at(1)) == 0) );
+        CHECK_TRUE( (ecu_ntnode_size(&RW.at(4)) == 0) );
+        CHECK_TRUE( (ecu_ntnode_size(&RW.at(3)) == 0) );
     }
     catch (const AssertException& e)
     {
@@ -5910,35 +6413,37 @@ TEST(NtNode, NextSiblingIteratorStartIsFirstSibling)
 }
 
 /**
- * @brief Verify correct nodes in iteration returned.
+ * @brief Correct size returned.
  */
-TEST(NtNode, ConstNextSiblingIteratorStartIsFirstSibling)
+TEST(NtNode, SizeAddAndRemoveNodes)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2---------------------RW3
-        |       |                       |
-        RW4     RW5---RW6---RW7---RW8   RW9---RW10
-                |           |
-                RW11        RW12
+        RW1-----RW2-----RW3
+        |       |       |
+        RW4     RW7     RW8
+        |
+        RW5---RW6
         */
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
         add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5), RW.at(6), RW.at(7), RW.at(8));
-        add_children(RW.at(3), RW.at(9), RW.at(10));
-        add_children(RW.at(5), RW.at(11));
-        add_children(RW.at(7), RW.at(12));
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(8));
+        add_children(RW.at(2), RW.at(7));
+        add_children(RW.at(3), RW.at(8));
+        add_children(RW.at(4), RW.at(5), RW.at(6));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(5))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 8) );
+        ecu_ntnode_remove(&RW.at(3));
+        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 6) );
+        ecu_ntnode_remove(&RW.at(1));
+        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 2) );
+        ecu_ntnode_push_child_back(&RW.at(7), &RW.at(3));
+        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 4) );
+        ecu_ntnode_insert_sibling_after(&RW.at(2), &RW.at(10));
+        CHECK_TRUE( (ecu_ntnode_size(&RW.at(0)) == 5) );
     }
     catch (const AssertException& e)
     {
@@ -5948,29 +6453,52 @@ TEST(NtNode, ConstNextSiblingIteratorStartIsFirstSibling)
 }
 
 /**
- * @brief Verify correct nodes in iteration returned.
+ * @brief Child counts, sizes, and levels of every node stay correct
+ * as subtrees are moved between levels and trees.
  */
-TEST(NtNode, NextSiblingIteratorStartIsMiddleSibling)
+TEST(NtNode, CountLevelAndSizeAfterMovingSubtrees)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0
+        RW0                     RW20
+        |                       |
+        RW1-----RW2-----RW3     RW21
+        |       |       |
+        RW4     RW7     RW8
         |
-        RW1-----RW2
-                |
-                RW3---RW4---RW5---RW6
+        RW5---RW6
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6));
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(7));
+        add_children(RW.at(3), RW.at(8));
+        add_children(RW.at(4), RW.at(5), RW.at(6));
+        add_children(RW.at(20), RW.at(21));
+        CHECK_COUNTS(RW.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(4))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Steps 2 and 3: Action and assert. Move RW1 subtree deeper. */
+        ecu_ntnode_remove(&RW.at(1));
+        CHECK_COUNTS(RW.at(0));
+        CHECK_COUNTS(RW.at(1));
+        ecu_ntnode_push_child_front(&RW.at(8), &RW.at(1));
+        CHECK_COUNTS(RW.at(0));
+        UNSIGNED_LONGS_EQUAL(5, ecu_ntnode_level(&RW.at(5)));
+
+        /* Move RW3 subtree (contains RW1 subtree) into the other tree. */
+        ecu_ntnode_remove(&RW.at(3));
+        ecu_ntnode_insert_sibling_before(&RW.at(21), &RW.at(3));
+        CHECK_COUNTS(RW.at(0));
+        CHECK_COUNTS(RW.at(20));
+        UNSIGNED_LONGS_EQUAL(7, ecu_ntnode_size(&RW.at(20)));
+        UNSIGNED_LONGS_EQUAL(2, ecu_ntnode_count(&RW.at(20)));
+
+        /* Graft whole second tree under a leaf of the first. */
+        ecu_ntnode_insert_sibling_after(&RW.at(7), &RW.at(22));
+        ecu_ntnode_push_child_back(&RW.at(22), &RW.at(20));
+        CHECK_COUNTS(RW.at(0));
+        UNSIGNED_LONGS_EQUAL(11, ecu_ntnode_size(&RW.at(0)));
+        UNSIGNED_LONGS_EQUAL(8, ecu_ntnode_level(&RW.at(5)));
     }
     catch (const AssertException& e)
     {
@@ -5980,29 +6508,43 @@ TEST(NtNode, NextSiblingIteratorStartIsMiddleSibling)
 }
 
 /**
- * @brief Verify correct nodes in iteration returned.
+ * @brief Ancestors of a cleared or destroyed subtree are updated.
+ * Cleared nodes are reset and can be reused.
  */
-TEST(NtNode, ConstNextSiblingIteratorStartIsMiddleSibling)
+TEST(NtNode, CountLevelAndSizeAfterClearAndDestroy)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2
-                |
-                RW3---RW4---RW5---RW6
+        RW1-----RW2-----DN0
+        |       |       |
+        RW3     RW5     DN1
+        |
+        RW4
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6));
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6));
+        add_children(RW.at(0), RW.at(1), RW.at(2), DN.at(0));
+        add_children(RW.at(1), RW.at(3));
+        add_children(RW.at(3), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+        add_children(DN.at(0), DN.at(1));
+        EXPECT_NODES_DESTROYED(DN.at(0), DN.at(1));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(4))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        ecu_ntnode_clear(&RW.at(1));
+        CHECK_COUNTS(RW.at(0));
+        CHECK_TRUE( (not_in_tree(RW.at(1), RW.at(3), RW.at(4))) );
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntnode_level(&RW.at(4)));
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntnode_size(&RW.at(1)));
+
+        ecu_ntnode_destroy(&DN.at(0));
+        CHECK_COUNTS(RW.at(0));
+        UNSIGNED_LONGS_EQUAL(2, ecu_ntnode_size(&RW.at(0)));
+
+        add_branch(RW.at(5), RW.at(1), RW.at(3), RW.at(4));
+        CHECK_COUNTS(RW.at(0));
+        UNSIGNED_LONGS_EQUAL(5, ecu_ntnode_level(&RW.at(4)));
     }
     catch (const AssertException& e)
     {
@@ -6011,29 +6553,28 @@ TEST(NtNode, ConstNextSiblingIteratorStartIsMiddleSibling)
     }
 }
 
+/*------------------------------------------------------------*/
+/*------------------ TESTS - ECU_NTNODE_VALID ----------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Iteration immediately exits.
+ * @brief Correct status returned.
  */
-TEST(NtNode, NextSiblingIteratorStartIsLastSibling)
+TEST(NtNode, Valid)
 {
     try
     {
-        /* Step 1: Arrange.
-        RW0
-        |
-        RW1-----RW2
-                |
-                RW3
-        */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3));
+        /* Step 1: Arrange. */
+        ecu_ntnode node{}; /* Zeroed. Unconstructed garbage pointers would be dereferenced. */
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_FALSE( (ecu_ntnode_valid(&node)) );
+        ecu_ntnode_ctor(&node, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+        CHECK_TRUE( (ecu_ntnode_valid(&node)) );
+        ecu_ntnode_destroy(&node);
+        CHECK_FALSE( (ecu_ntnode_valid(&node)) );
+        ecu_ntnode_ctor(&node, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+        CHECK_TRUE( (ecu_ntnode_valid(&node)) );
     }
     catch (const AssertException& e)
     {
@@ -6042,29 +6583,29 @@ TEST(NtNode, NextSiblingIteratorStartIsLastSibling)
     }
 }
 
+#if defined(ECU_NTNODE_DIRTY)
+/*------------------------------------------------------------*/
+/*------------------- TESTS - DIRTY TRACKING -----------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Iteration immediately exits.
+ * @brief Newly constructed node has never been computed so it
+ * is dirty. Refreshing it combines it once and cleans it.
  */
-TEST(NtNode, ConstNextSiblingIteratorStartIsLastSibling)
+TEST(NtNode, DirtyNewNodeIsDirty)
 {
     try
     {
-        /* Step 1: Arrange.
-        RW0
-        |
-        RW1-----RW2
-                |
-                RW3
-        */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3));
+        /* Step 1: Arrange. */
+        EXPECT_NODES_IN_TREE(RW.at(0));
+        CHECK_TRUE( (ecu_ntnode_is_dirty(&RW.at(0))) );
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        std::size_t refreshed = ecu_ntnode_refresh(&RW.at(0), &combine_in_tree, &node_obj_in_tree_visitor);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(1, refreshed);
+        CHECK_FALSE( (ecu_ntnode_is_dirty(&RW.at(0))) );
     }
     catch (const AssertException& e)
     {
@@ -6074,21 +6615,30 @@ TEST(NtNode, ConstNextSiblingIteratorStartIsLastSibling)
 }
 
 /**
- * @brief Iteration immediately exits.
+ * @brief First refresh combines every node in postorder.
  */
-TEST(NtNode, NextSiblingIteratorStartIsRoot)
+TEST(NtNode, DirtyRefreshWholeTree)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2---RW3
+        |       |
+        RW4     RW5---RW6
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(5), RW.at(6), RW.at(2), RW.at(3), RW.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &empty_root)
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        std::size_t refreshed = ecu_ntnode_refresh(&RW.at(0), &combine_in_tree, &node_obj_in_tree_visitor);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(7, refreshed);
+        CHECK_TRUE( (is_clean(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6))) );
     }
     catch (const AssertException& e)
     {
@@ -6098,21 +6648,25 @@ TEST(NtNode, NextSiblingIteratorStartIsRoot)
 }
 
 /**
- * @brief Iteration immediately exits.
+ * @brief Refreshing a clean tree does nothing.
  */
-TEST(NtNode, ConstNextSiblingIteratorStartIsRoot)
+TEST(NtNode, DirtyRefreshCleanTree)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &empty_root)
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        std::size_t refreshed = ecu_ntnode_refresh(&RW.at(0), &combine_in_tree, &node_obj_in_tree_visitor);
+
+        /* Step 3: Assert. No combine calls expected. */
+        UNSIGNED_LONGS_EQUAL(0, refreshed);
     }
     catch (const AssertException& e)
     {
@@ -6122,29 +6676,34 @@ TEST(NtNode, ConstNextSiblingIteratorStartIsRoot)
 }
 
 /**
- * @brief Next sibling returned then iteration exits.
+ * @brief Marking a node dirty marks its ancestors, but not
+ * its siblings or descendants.
  */
-TEST(NtNode, NextSiblingIteratorStartHasOneSibling)
+TEST(NtNode, DirtyMarkDirtyMarksAncestors)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2
-        |
-        RW3
+        RW1-----RW2---RW3
+        |       |
+        RW4     RW5---RW6
+                |
+                RW7
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(2));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6));
+        add_children(RW.at(5), RW.at(7));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_mark_dirty(&RW.at(5));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_dirty(RW.at(5), RW.at(2), RW.at(0))) );
+        CHECK_TRUE( (is_clean(RW.at(1), RW.at(3), RW.at(4), RW.at(6), RW.at(7))) );
     }
     catch (const AssertException& e)
     {
@@ -6154,29 +6713,36 @@ TEST(NtNode, NextSiblingIteratorStartHasOneSibling)
 }
 
 /**
- * @brief Next sibling returned then iteration exits.
+ * @brief Only the changed node and its ancestors are combined,
+ * children before parents.
  */
-TEST(NtNode, ConstNextSiblingIteratorStartHasOneSibling)
+TEST(NtNode, DirtyRefreshOnlyDirtyNodes)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2
-        |
-        RW3
+        RW1-----RW2---RW3
+        |       |
+        RW4     RW5---RW6
+                |
+                RW7
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(2));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6));
+        add_children(RW.at(5), RW.at(7));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+        ecu_ntnode_mark_dirty(&RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(5), RW.at(2), RW.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        std::size_t refreshed = ecu_ntnode_refresh(&RW.at(0), &combine_in_tree, &node_obj_in_tree_visitor);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(4, refreshed);
+        CHECK_TRUE( (is_clean(RW.at(0), RW.at(2), RW.at(5), RW.at(7))) );
     }
     catch (const AssertException& e)
     {
@@ -6186,57 +6752,38 @@ TEST(NtNode, ConstNextSiblingIteratorStartHasOneSibling)
 }
 
 /**
- * @brief Remove some nodes in the middle of an iteration. 
- * Verify trees intact.
- * @warning Test validation requires working postorder iterator.
+ * @brief Several dirty branches are combined once each, and
+ * their shared ancestors are only combined once.
  */
-TEST(NtNode, NextSiblingIteratorRemoveSome)
+TEST(NtNode, DirtyRefreshMultipleBranches)
 {
     try
     {
         /* Step 1: Arrange.
-
-        Before:
         RW0
         |
-        RW1---RW2---RO0-----RW3
-        |           |       |
-        RW4---RW5   RW6     RW7---RW8
-        
-        After:
-        RW0                 RW2     RW3
-        |                           |
-        RW1---------RO0             RW7---RW8
-        |           |
-        RW4---RW5   RW6
+        RW1-----RW2---RW3
+        |       |
+        RW4     RW5---RW6
+                |
+                RW7
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RO.at(0), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RO.at(0), RW.at(6));
-        add_children(RW.at(3), RW.at(7), RW.at(8));
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6));
+        add_children(RW.at(5), RW.at(7));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+        ecu_ntnode_mark_dirty(&RW.at(6));
+        ecu_ntnode_mark_dirty(&RW.at(4));
+        ecu_ntnode_mark_dirty(&RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(7), RW.at(5), RW.at(6), RW.at(2), RW.at(0));
 
         /* Step 2: Action. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
-
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(6), RO.at(0), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        std::size_t refreshed = ecu_ntnode_refresh(&RW.at(0), &combine_in_tree, &node_obj_in_tree_visitor);
 
-        /* Step 3: Assert. Verify removed trees intact. */
-        CHECK_TRUE( (not_in_tree(RW.at(2))) );
-        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(8), RW.at(3));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(3))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(7, refreshed);
+        CHECK_TRUE( (is_clean(RW.at(3))) );
     }
     catch (const AssertException& e)
     {
@@ -6246,62 +6793,35 @@ TEST(NtNode, NextSiblingIteratorRemoveSome)
 }
 
 /**
- * @brief Remove all nodes in the iteration. Verify
- * trees intact.
- * @warning Test validation requires working postorder iterator.
+ * @brief Refreshing a subtree leaves its ancestors dirty so
+ * they are still combined by a later refresh.
  */
-TEST(NtNode, NextSiblingIteratorRemoveAll)
+TEST(NtNode, DirtyRefreshSubtree)
 {
     try
     {
         /* Step 1: Arrange.
-
-        Before:
         RW0
         |
-        RW1---RW2---RW3-----RW4
-        |           |       |
-        RW5---RW6   RW7     RW8---RW9
-        
-        After:
-        RW0         RW2     RW3     RW4
-        |                   |       |
-        RW1                 RW7     RW8---RW9
-        |
-        RW5---RW6
+        RW1-----RW2
+        |       |
+        RW3     RW4
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_children(RW.at(1), RW.at(5), RW.at(6));
-        add_children(RW.at(3), RW.at(7));
-        add_children(RW.at(4), RW.at(8), RW.at(9));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        add_children(RW.at(2), RW.at(4));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+        ecu_ntnode_mark_dirty(&RW.at(3));
+        ecu_ntnode_mark_dirty(&RW.at(4));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(2));
 
         /* Step 2: Action. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
-
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6), RW.at(1), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        std::size_t refreshed = ecu_ntnode_refresh(&RW.at(2), &combine_in_tree, &node_obj_in_tree_visitor);
 
-        /* Step 3: Assert. Verify removed trees intact. */
-        CHECK_TRUE( (not_in_tree(RW.at(2))) );
-        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(3));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(3))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        EXPECT_NODES_IN_TREE(RW.at(8), RW.at(9), RW.at(4));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(4))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(2, refreshed);
+        CHECK_TRUE( (is_dirty(RW.at(0), RW.at(1), RW.at(3))) );
+        CHECK_TRUE( (is_clean(RW.at(2), RW.at(4))) );
     }
     catch (const AssertException& e)
     {
@@ -6311,56 +6831,69 @@ TEST(NtNode, NextSiblingIteratorRemoveAll)
 }
 
 /**
- * @brief Destroy some nodes in the middle of an iteration. 
- * Verify remaining tree intact.
- * @warning Test validation requires working postorder iterator.
+ * @brief Adding a child marks its new parent and ancestors dirty.
+ * Child subtree keeps its own state.
  */
-TEST(NtNode, NextSiblingIteratorDestroySome)
+TEST(NtNode, DirtyPushChildMarksAncestors)
 {
     try
     {
         /* Step 1: Arrange.
-
-        Before:
-        RW0
-        |
-        DN0-----DN1---------DN2-----DN3
-        |       |           |       |
-        RW1     RW2---RW3   RW4     RW5
+        RW0             RW5
+        |               |
+        RW1-----RW2     RW6
         |
-        RW6 
-        
-        After:
+        RW3---RW4
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
+        add_children(RW.at(5), RW.at(6));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+        (void)ecu_ntnode_refresh(&RW.at(5), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_front(&RW.at(3), &RW.at(5));
+        ecu_ntnode_push_child_back(&RW.at(4), &RW.at(7));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_dirty(RW.at(0), RW.at(1), RW.at(3), RW.at(4), RW.at(7))) );
+        CHECK_TRUE( (is_clean(RW.at(2), RW.at(5), RW.at(6))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Adding a sibling marks the shared parent and its
+ * ancestors dirty.
+ */
+TEST(NtNode, DirtyInsertSiblingMarksAncestors)
+{
+    try
+    {
+        /* Step 1: Arrange.
         RW0
         |
-        DN0-----DN1
-        |       |
-        RW1     RW2---RW3
+        RW1-----RW2
         |
-        RW6
+        RW3
         */
-        add_children(RW.at(0), DN.at(0), DN.at(1), DN.at(2), DN.at(3));
-        add_children(DN.at(0), RW.at(1));
-        add_children(DN.at(1), RW.at(2), RW.at(3));
-        add_children(DN.at(2), RW.at(4));
-        add_children(DN.at(3), RW.at(5));
-        add_children(RW.at(1), RW.at(6));
-        EXPECT_NODES_DESTROYED(DN.at(2), RW.at(4), DN.at(3), RW.at(5));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+        (void)ecu_ntnode_refresh(&RW.at(4), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &DN.at(1))
-        {
-            convert(n).accept(node_destroy_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_insert_sibling_before(&RW.at(3), &RW.at(4));
 
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(1), DN.at(0), RW.at(2), RW.at(3), DN.at(1), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_dirty(RW.at(0), RW.at(1))) );
+        CHECK_TRUE( (is_clean(RW.at(2), RW.at(3), RW.at(4))) );
+        UNSIGNED_LONGS_EQUAL(2, ecu_ntnode_refresh(&RW.at(0), &combine_in_tree, &node_obj_in_tree_visitor));
     }
     catch (const AssertException& e)
     {
@@ -6370,61 +6903,60 @@ TEST(NtNode, NextSiblingIteratorDestroySome)
 }
 
 /**
- * @brief Destroy all nodes in the iteration. Verify
- * remaining tree intact.
- * @warning Test validation requires working postorder iterator.
+ * @brief Removing a subtree marks its old parent and ancestors
+ * dirty. Removed subtree keeps its own state.
  */
-TEST(NtNode, NextSiblingIteratorDestroyAll)
+TEST(NtNode, DirtyRemoveMarksOldAncestors)
 {
     try
     {
         /* Step 1: Arrange.
-
-        Before:
         RW0
         |
-        RW1
+        RW1-----RW2
         |
-        DN0-----DN1---------DN2-----DN3
-        |       |           |       |
-        RW2     RW3---RW4   RW5     RW6
+        RW3
         |
-        RW7 
-        
-        After:
+        RW4
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_branch(RW.at(1), RW.at(3), RW.at(4));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+
+        /* Step 2: Action. */
+        ecu_ntnode_remove(&RW.at(3));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_dirty(RW.at(0), RW.at(1))) );
+        CHECK_TRUE( (is_clean(RW.at(2), RW.at(3), RW.at(4))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Removing a root changes nothing.
+ */
+TEST(NtNode, DirtyRemoveRoot)
+{
+    try
+    {
+        /* Step 1: Arrange.
         RW0
         |
         RW1
-        |
-        DN0
-        |
-        RW2
-        |
-        RW7
         */
         add_children(RW.at(0), RW.at(1));
-        add_children(RW.at(1), DN.at(0), DN.at(1), DN.at(2), DN.at(3));
-        add_children(DN.at(0), RW.at(2));
-        add_children(DN.at(1), RW.at(3), RW.at(4));
-        add_children(DN.at(2), RW.at(5));
-        add_children(DN.at(3), RW.at(6));
-        add_children(RW.at(2), RW.at(7));
-        EXPECT_NODES_DESTROYED(DN.at(1), RW.at(3), RW.at(4), DN.at(2), RW.at(5), DN.at(3), RW.at(6));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &DN.at(0))
-        {
-            convert(n).accept(node_destroy_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_remove(&RW.at(0));
 
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(2), DN.at(0), RW.at(1), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_clean(RW.at(0), RW.at(1))) );
     }
     catch (const AssertException& e)
     {
@@ -6434,53 +6966,50 @@ TEST(NtNode, NextSiblingIteratorDestroyAll)
 }
 
 /**
- * @brief Calling next() after an iteration is finished
- * is not allowed.
+ * @brief Every node taken apart by a clear lost its children,
+ * so all of them are dirty. Old ancestors are also dirty.
  */
-TEST(NtNode, NextSiblingIteratorNextAfterDone)
+TEST(NtNode, DirtyClearMarksNodes)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
-        EXPECT_ASSERTION();
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+        |
+        RW3---RW4
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
 
         /* Step 2: Action. */
-        ecu_ntnode_next_sibling_iterator iter;
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &empty_root)
-        {
-            (void)n;
-        }
-        (void)ecu_ntnode_next_sibling_iterator_next(&iter);
+        ecu_ntnode_clear(&RW.at(1));
 
-        /* Step 3: Assert. Test fails if assertion does not fire. */
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_dirty(RW.at(0), RW.at(1), RW.at(3), RW.at(4))) );
+        CHECK_TRUE( (is_clean(RW.at(2))) );
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Calling cnext() after an iteration is finished
- * is not allowed.
+ * @brief Combine callback is required.
  */
-TEST(NtNode, ConstNextSiblingIteratorNextAfterDone)
+TEST(NtNode, DirtyRefreshNullCombine)
 {
     try
     {
         /* Step 1: Arrange. */
-        rw_ntnode empty_root;
         EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ecu_ntnode_next_sibling_citerator citer;
-        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &empty_root)
-        {
-            (void)n;
-        }
-        (void)ecu_ntnode_next_sibling_iterator_cnext(&citer);
+        (void)ecu_ntnode_refresh(&RW.at(0), nullptr, ECU_NTNODE_OBJ_UNUSED);
 
         /* Step 3: Assert. Test fails if assertion does not fire. */
     }
@@ -6490,36 +7019,38 @@ TEST(NtNode, ConstNextSiblingIteratorNextAfterDone)
         (void)e;
     }
 }
-
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Moving a subtree marks the old and new parents
+ * and their ancestors dirty. The moved subtree stays clean.
  */
-TEST(NtNode, NextSiblingIteratorMultipleTimes)
+TEST(NtNode, DirtyMoveMarksOldAndNewAncestors)
 {
     try
     {
-        /* Step 1: Arrange.
-        RW0
+        /* Step 1: Arrange. Move RW4 under RW2, then move
+        RW2's children under RW5.
+        RW0             RW5
         |
-        RW1---RW2---RW3---RW4
+        RW1-----RW2
+        |
+        RW3
+        |
+        RW4
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(3), RW.at(4), RW.at(3), RW.at(4), RW.at(4));
-        ecu_ntnode_next_sibling_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_branch(RW.at(1), RW.at(3), RW.at(4));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+        (void)ecu_ntnode_refresh(&RW.at(5), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(3))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        ecu_ntnode_move_child_back(&RW.at(2), &RW.at(4));
+        CHECK_TRUE( (is_dirty(RW.at(0), RW.at(1), RW.at(2), RW.at(3))) );
+        CHECK_TRUE( (is_clean(RW.at(4), RW.at(5))) );
+
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+        ecu_ntnode_move_children(&RW.at(5), &RW.at(2));
+        CHECK_TRUE( (is_dirty(RW.at(0), RW.at(2), RW.at(5))) );
+        CHECK_TRUE( (is_clean(RW.at(1), RW.at(3), RW.at(4))) );
     }
     catch (const AssertException& e)
     {
@@ -6528,35 +7059,41 @@ TEST(NtNode, NextSiblingIteratorMultipleTimes)
     }
 }
 
+#endif /* ECU_NTNODE_DIRTY */
+
+#if defined(ECU_NTNODE_INDEXED)
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - CHILD INDEX -------------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Children that existed before the index was
+ * attached are found through the index.
  */
-TEST(NtNode, ConstNextSiblingIteratorMultipleTimes)
+TEST(NtNode, IndexAttachToNodeWithChildren)
 {
     try
     {
         /* Step 1: Arrange.
-        RW0
+        root
         |
-        RW1---RW2---RW3---RW4
+        n1-----n2-----n3
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(3), RW.at(4), RW.at(3), RW.at(4), RW.at(4));
-        ecu_ntnode_next_sibling_citerator citer;
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        ecu_ntnode *slots[8];
+        ecu_ntnode_index index;
+        add_children(root, n1, n2, n3);
+        ecu_ntnode_index_ctor(&index, &slots[0], 8);
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(2))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(3))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_attach_index(&root, &index);
+
+        /* Step 3: Assert. */
+        CHECK_FINDS_CHILDREN(root);
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&root, 4)) );
     }
     catch (const AssertException& e)
     {
@@ -6565,40 +7102,38 @@ TEST(NtNode, ConstNextSiblingIteratorMultipleTimes)
     }
 }
 
-/*------------------------------------------------------------*/
-/*------------------ TESTS - PARENT AT ITERATOR --------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief General iteration test where starting node
- * is a leaf.
+ * @brief Children added through every insertion
+ * function are found through the index.
  */
-TEST(NtNode, ParentAtIteratorStartIsLeaf)
+TEST(NtNode, IndexPushAndInsertChildren)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW5.
-        RW0
+        /* Step 1: Arrange. */
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        ecu_ntnode *slots[8];
+        ecu_ntnode_index index;
+        ecu_ntnode_index_ctor(&index, &slots[0], 8);
+        ecu_ntnode_attach_index(&root, &index);
+
+        /* Step 2: Action.
+        root
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
+        n2-----n4-----n1-----n3
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(4), RW.at(3), RW.at(2), RW.at(0));
+        ecu_ntnode_push_child_back(&root, &n1);
+        ecu_ntnode_push_child_front(&root, &n2);
+        ecu_ntnode_insert_sibling_after(&n1, &n3);
+        ecu_ntnode_insert_sibling_before(&n1, &n4);
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(5))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. */
+        CHECK_FINDS_CHILDREN(root);
+        CHECK_TRUE( (ecu_ntnode_find_cchild_by_id(&root, 4) == &n4) );
     }
     catch (const AssertException& e)
     {
@@ -6608,35 +7143,61 @@ TEST(NtNode, ParentAtIteratorStartIsLeaf)
 }
 
 /**
- * @brief General iteration test where starting node
- * is a leaf.
+ * @brief Removed children are no longer found. Remaining
+ * children are still found. Moving a child between indexed
+ * parents updates both indexes.
  */
-TEST(NtNode, ConstParentAtIteratorStartIsLeaf)
+TEST(NtNode, IndexRemoveAndMoveChildren)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW5.
-        RW0
+        /* Step 1: Arrange.
+        root
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
+        n1-----n2
+        |      |
+        n3     n4---n5
         */
-        ecu_ntnode_parent_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(4), RW.at(3), RW.at(2), RW.at(0));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        rw_ntnode n5{5};
+        ecu_ntnode *root_slots[4];
+        ecu_ntnode *n1_slots[4];
+        ecu_ntnode *n2_slots[4];
+        ecu_ntnode_index root_index;
+        ecu_ntnode_index n1_index;
+        ecu_ntnode_index n2_index;
+        add_children(root, n1, n2);
+        add_children(n1, n3);
+        add_children(n2, n4, n5);
+        ecu_ntnode_index_ctor(&root_index, &root_slots[0], 4);
+        ecu_ntnode_index_ctor(&n1_index, &n1_slots[0], 4);
+        ecu_ntnode_index_ctor(&n2_index, &n2_slots[0], 4);
+        ecu_ntnode_attach_index(&root, &root_index);
+        ecu_ntnode_attach_index(&n1, &n1_index);
+        ecu_ntnode_attach_index(&n2, &n2_index);
+
+        /* Step 2: Action. Remove n2's subtree and move n4 under n1.
+        root        n2
+        |           |
+        n1          n5
+        |
+        n3---n4
+        */
+        ecu_ntnode_remove(&n2);
+        ecu_ntnode_remove(&n4);
+        ecu_ntnode_push_child_back(&n1, &n4);
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(5))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. */
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&root, 2)) );
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&n2, 4)) );
+        CHECK_TRUE( (ecu_ntnode_find_child_by_id(&n1, 4) == &n4) );
+        CHECK_FINDS_CHILDREN(root);
+        CHECK_FINDS_CHILDREN(n1);
+        CHECK_FINDS_CHILDREN(n2);
     }
     catch (const AssertException& e)
     {
@@ -6646,34 +7207,92 @@ TEST(NtNode, ConstParentAtIteratorStartIsLeaf)
 }
 
 /**
- * @brief General iteration test where starting node
- * is a middle child.
+ * @brief Index is emptied when the node is cleared but stays
+ * attached. Destroyed children are removed from the index.
  */
-TEST(NtNode, ParentAtIteratorStartIsMiddleChild)
+TEST(NtNode, IndexClearAndDestroy)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW3.
-        RW0
+        /* Step 1: Arrange. Clear n1 and destroy n2.
+        root
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
+        n1-----n2
+        |      |
+        n3     n4
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(0));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        rw_ntnode n5{5};
+        ecu_ntnode *root_slots[4];
+        ecu_ntnode *n1_slots[4];
+        ecu_ntnode *n2_slots[4];
+        ecu_ntnode_index root_index;
+        ecu_ntnode_index n1_index;
+        ecu_ntnode_index n2_index;
+        add_children(root, n1, n2);
+        add_children(n1, n3);
+        add_children(n2, n4);
+        ecu_ntnode_index_ctor(&root_index, &root_slots[0], 4);
+        ecu_ntnode_index_ctor(&n1_index, &n1_slots[0], 4);
+        ecu_ntnode_index_ctor(&n2_index, &n2_slots[0], 4);
+        ecu_ntnode_attach_index(&root, &root_index);
+        ecu_ntnode_attach_index(&n1, &n1_index);
+        ecu_ntnode_attach_index(&n2, &n2_index);
+        EXPECT_NODES_DESTROYED(n2, n4);
+
+        /* Step 2: Action. */
+        ecu_ntnode_clear(&n1);
+        ecu_ntnode_destroy(&n2);
+        ecu_ntnode_push_child_back(&n1, &n5);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&root, 1)) );
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&root, 2)) );
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&n1, 3)) );
+        CHECK_TRUE( (ecu_ntnode_find_child_by_id(&n1, 5) == &n5) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Fill the index to capacity with colliding IDs then
+ * remove children in scrambled order. Every remaining child must
+ * still be found after each removal shifts entries back.
+ */
+TEST(NtNode, IndexRemoveFromFullIndex)
+{
+    try
+    {
+        /* Step 1: Arrange. IDs are multiples of the capacity. */
+        rw_ntnode root{0};
+        rw_ntnode c[15] = {0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224};
+        const std::size_t order[15] = {7, 0, 14, 3, 11, 1, 9, 5, 13, 2, 12, 6, 10, 4, 8};
+        ecu_ntnode *slots[16];
+        ecu_ntnode_index index;
+        ecu_ntnode_index_ctor(&index, &slots[0], 16);
+        ecu_ntnode_attach_index(&root, &index);
+
+        for (auto& n : c)
+        {
+            ecu_ntnode_push_child_back(&root, &n);
+        }
+
+        CHECK_FINDS_CHILDREN(root);
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(3))
+        for (std::size_t i : order)
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            ecu_ntnode_remove(&c[i]);
+            CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&root, ecu_ntnode_id(&c[i]))) );
+            CHECK_FINDS_CHILDREN(root);
         }
     }
     catch (const AssertException& e)
@@ -6684,35 +7303,29 @@ TEST(NtNode, ParentAtIteratorStartIsMiddleChild)
 }
 
 /**
- * @brief General iteration test where starting node
- * is a middle child.
+ * @brief One of the children with a duplicated ID is found.
+ * The other one is found after the first is removed.
  */
-TEST(NtNode, ConstParentAtIteratorStartIsMiddleChild)
+TEST(NtNode, IndexDuplicateIds)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW3.
-        RW0
-        |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
-        */
-        ecu_ntnode_parent_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(0));
+        /* Step 1: Arrange. */
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{1};
+        ecu_ntnode *slots[4];
+        ecu_ntnode_index index;
+        ecu_ntnode_index_ctor(&index, &slots[0], 4);
+        ecu_ntnode_attach_index(&root, &index);
+        add_children(root, n1, n2);
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(3))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        ecu_ntnode *found = ecu_ntnode_find_child_by_id(&root, 1);
+        CHECK_TRUE( (found == &n1 || found == &n2) );
+        ecu_ntnode_remove(found);
+        ecu_ntnode *other = ecu_ntnode_find_child_by_id(&root, 1);
+        CHECK_TRUE( (other && other != found) );
     }
     catch (const AssertException& e)
     {
@@ -6722,35 +7335,31 @@ TEST(NtNode, ConstParentAtIteratorStartIsMiddleChild)
 }
 
 /**
- * @brief Perform a parent iteration on a node that has
- * one parent (direct child of a root).
+ * @brief Detached index is no longer used. Children are
+ * still found by scanning. Reattaching indexes new children.
  */
-TEST(NtNode, ParentAtIteratorStartsParentIsRoot)
+TEST(NtNode, IndexDetach)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
-        RW0
-        |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
-        */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(0));
+        /* Step 1: Arrange. */
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        ecu_ntnode *slots[4];
+        ecu_ntnode_index index;
+        ecu_ntnode_index_ctor(&index, &slots[0], 4);
+        ecu_ntnode_attach_index(&root, &index);
+        add_children(root, n1);
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_detach_index(&root);
+        ecu_ntnode_push_child_back(&root, &n2);
+
+        /* Step 3: Assert. */
+        CHECK_FINDS_CHILDREN(root);
+        ecu_ntnode_attach_index(&root, &index);
+        CHECK_FINDS_CHILDREN(root);
     }
     catch (const AssertException& e)
     {
@@ -6760,35 +7369,36 @@ TEST(NtNode, ParentAtIteratorStartsParentIsRoot)
 }
 
 /**
- * @brief Perform a parent iteration on a node that has
- * one parent (direct child of a root).
+ * @brief Path resolves through indexed and
+ * unindexed nodes.
  */
-TEST(NtNode, ConstParentAtIteratorStartsParentIsRoot)
+TEST(NtNode, IndexResolve)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
-        RW0
+        /* Step 1: Arrange.
+        root
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
+        n1-----n2
+               |
+               n3-----n4
         */
-        ecu_ntnode_parent_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(0));
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        ecu_ntnode *slots[4];
+        ecu_ntnode_index index;
+        const ecu_object_id_t path[] = {2, 4};
+        add_children(root, n1, n2);
+        add_children(n2, n3, n4);
+        ecu_ntnode_index_ctor(&index, &slots[0], 4);
+        ecu_ntnode_attach_index(&root, &index);
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (ecu_ntnode_resolve(&root, &path[0], 2) == &n4) );
+        CHECK_TRUE( (ecu_ntnode_cresolve(&root, &path[0], 1) == &n2) );
     }
     catch (const AssertException& e)
     {
@@ -6798,172 +7408,149 @@ TEST(NtNode, ConstParentAtIteratorStartsParentIsRoot)
 }
 
 /**
- * @brief Perform a parent iteration on a node that has
- * no parent. Iteration should return only root node.
+ * @brief One slot must always stay empty, so adding a
+ * child to a full index is not allowed.
  */
-TEST(NtNode, ParentAtIteratorStartIsRoot)
+TEST(NtNode, IndexFull)
 {
     try
     {
-        /* Step 1: Arrrange. Start iteration at RW0.
-        RW0
-        |
-        RW1 
-        */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1));
-        EXPECT_NODES_IN_TREE(RW.at(0));
+        /* Step 1: Arrange. */
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        ecu_ntnode *slots[4];
+        ecu_ntnode_index index;
+        ecu_ntnode_index_ctor(&index, &slots[0], 4);
+        ecu_ntnode_attach_index(&root, &index);
+        add_children(root, n1, n2, n3);
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_push_child_back(&root, &n4);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Perform a parent iteration on a node that has
- * no parent. Iteration should return only root node.
+ * @brief Capacity must be a power of two.
  */
-TEST(NtNode, ConstParentAtIteratorStartIsRoot)
+TEST(NtNode, IndexCapacityNotPowerOfTwo)
 {
     try
     {
-        /* Step 1: Arrrange. Start iteration at RW0.
-        RW0
-        |
-        RW1 
-        */
-        ecu_ntnode_parent_citerator citer;
-        add_children(RW.at(0), RW.at(1));
-        EXPECT_NODES_IN_TREE(RW.at(0));
+        /* Step 1: Arrange. */
+        ecu_ntnode *slots[6];
+        ecu_ntnode_index index;
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_index_ctor(&index, &slots[0], 6);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Remove some nodes in the middle of a parent iteration.
- * @warning Test verification requires working postorder iterator.
+ * @brief Node cannot have two indexes attached.
  */
-TEST(NtNode, ParentAtIteratorRemoveSome)
+TEST(NtNode, IndexAttachTwice)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW3.
-        Remove read-write nodes.
-
-        Before:
-        RO0
-        |
-        RW0-----RW1-----RW4
-                |       |
-                RO1     RW5
-                |
-                RW2
-                |
-                RW3 
-                
-        After:
-        RO0             RW3     RW2     RW1
-        |                               |
-        RW0-----RW4                     RO1
-                |
-                RW5 
-        */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RO.at(0), RW.at(0), RW.at(1), RW.at(4));
-        add_branch(RW.at(1), RO.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(4), RW.at(5));
+        /* Step 1: Arrange. */
+        rw_ntnode root{0};
+        ecu_ntnode *slots1[4];
+        ecu_ntnode *slots2[4];
+        ecu_ntnode_index index1;
+        ecu_ntnode_index index2;
+        ecu_ntnode_index_ctor(&index1, &slots1[0], 4);
+        ecu_ntnode_index_ctor(&index2, &slots2[0], 4);
+        ecu_ntnode_attach_index(&root, &index1);
+        EXPECT_ASSERTION();
 
         /* Step 2: Action. */
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(3))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
-
-        /* Step 3: Assert. */
-        ecu_ntnode_postorder_iterator postorder_iter;
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(5), RW.at(4), RO.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RO.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        ecu_ntnode_attach_index(&root, &index2);
 
-        CHECK_TRUE( (is_root(RW.at(3), RW.at(2), RW.at(1))) );
-        CHECK_TRUE( (is_descendant(RO.at(1))) );
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Remove all nodes returned by parent iteration.
- * @warning Test verification requires working postorder iterator.
+ * @brief Moved subtrees and spliced children are removed
+ * from the old parent's index and added to the new one.
  */
-TEST(NtNode, ParentAtIteratorRemoveAll)
+TEST(NtNode, IndexMoveSubtreesAndChildren)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW5.
-        Remove all nodes.
-
-        Before:
-        RW0
+        /* Step 1: Arrange.
+        root
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
-                
-        After:
-        RW0             RW5    RW4     RW3     RW2
-        |               
-        RW1-----RW6
-                |
-                RW7    
+        n1-----n2
+        |      |
+        n3     n4---n5
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        
-        /* Step 2: Action. */
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(5))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
+        rw_ntnode root{0};
+        rw_ntnode n1{1};
+        rw_ntnode n2{2};
+        rw_ntnode n3{3};
+        rw_ntnode n4{4};
+        rw_ntnode n5{5};
+        ecu_ntnode *root_slots[4];
+        ecu_ntnode *n1_slots[8];
+        ecu_ntnode *n2_slots[4];
+        ecu_ntnode_index root_index;
+        ecu_ntnode_index n1_index;
+        ecu_ntnode_index n2_index;
+        add_children(root, n1, n2);
+        add_children(n1, n3);
+        add_children(n2, n4, n5);
+        ecu_ntnode_index_ctor(&root_index, &root_slots[0], 4);
+        ecu_ntnode_index_ctor(&n1_index, &n1_slots[0], 8);
+        ecu_ntnode_index_ctor(&n2_index, &n2_slots[0], 4);
+        ecu_ntnode_attach_index(&root, &root_index);
+        ecu_ntnode_attach_index(&n1, &n1_index);
+        ecu_ntnode_attach_index(&n2, &n2_index);
+
+        /* Step 2: Action. Move n3 under root, then move all
+        of n2's children under n1.
+        root
+        |
+        n1---------n2---n3
+        |
+        n4---n5
+        */
+        ecu_ntnode_move_child_back(&root, &n3);
+        ecu_ntnode_move_children(&n1, &n2);
 
         /* Step 3: Assert. */
-        ecu_ntnode_postorder_iterator postorder_iter;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(7), RW.at(6), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-
-        CHECK_TRUE( (is_root(RW.at(5), RW.at(4), RW.at(3), RW.at(2))) );
+        CHECK_TRUE( (ecu_ntnode_find_child_by_id(&root, 3) == &n3) );
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&n1, 3)) );
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&n2, 4)) );
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&n2, 5)) );
+        CHECK_TRUE( (ecu_ntnode_find_child_by_id(&n1, 4) == &n4) );
+        CHECK_TRUE( (ecu_ntnode_find_child_by_id(&n1, 5) == &n5) );
+        CHECK_FINDS_CHILDREN(root);
+        CHECK_FINDS_CHILDREN(n1);
     }
     catch (const AssertException& e)
     {
@@ -6972,39 +7559,45 @@ TEST(NtNode, ParentAtIteratorRemoveAll)
     }
 }
 
+#endif /* ECU_NTNODE_INDEXED */
+
+#if defined(ECU_NTNODE_FAST_CLEAR)
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - FAST CLEAR --------------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Nothing should happen to tree.
- * @warning Test verification requires working postorder iterator.
+ * @brief Root is empty after a fast clear. Former nodes
+ * report that they are no longer in a tree.
  */
-TEST(NtNode, ParentAtIteratorStartIsRootRemoveRoot)
+TEST(NtNode, FastClearEmptiesTree)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2---RW3
-        |       |
-        RW4     RW5
+        RW1-----RW2
+        |
+        RW3---RW4
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
 
         /* Step 2: Action. */
-        ecu_ntnode_parent_iterator iter;
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            ecu_ntnode_remove(n);
-        }
+        ecu_ntnode_fast_clear(&RW.at(0));
 
         /* Step 3: Assert. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(5), RW.at(2), RW.at(3), RW.at(0));
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        CHECK_TRUE( (not_in_tree(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4))) );
+        CHECK_TRUE( (is_root(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4))) );
+        CHECK_TRUE( (ecu_ntnode_is_leaf(&RW.at(0))) );
+        CHECK_TRUE( (ecu_ntnode_is_leaf(&RW.at(1))) );
+        CHECK_TRUE( (!ecu_ntnode_first_child(&RW.at(0))) );
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntnode_count(&RW.at(0)));
+        UNSIGNED_LONGS_EQUAL(0, ecu_ntnode_size(&RW.at(0)));
     }
     catch (const AssertException& e)
     {
@@ -7014,52 +7607,48 @@ TEST(NtNode, ParentAtIteratorStartIsRootRemoveRoot)
 }
 
 /**
- * @brief Destroy some nodes in the middle of a parent iteration.
- * @warning Test verification requires working postorder iterator.
+ * @brief Former nodes can be added back to the cleared tree
+ * in a different shape without being reconstructed.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ParentAtIteratorDestroySome)
+TEST(NtNode, FastClearReuseNodesInSameTree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at DN2.
-        Destroy DN nodes.
-
-        Before:
+        /* Step 1: Arrange.
         RW0
         |
-        DN0---RW1---RW2
+        RW1-----RW2
         |
         RW3---RW4
-        |
-        DN1---RW5
-        |
-        DN2
+        */
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
+        ecu_ntnode_fast_clear(&RW.at(0));
 
-        After:
+        /* Step 2: Action. Former parent becomes a leaf and
+        former leaves become parents.
         RW0
         |
-        RW1---RW2
+        RW3-----RW2
+        |       |
+        RW1     RW4
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), DN.at(0), RW.at(1), RW.at(2));
-        add_children(DN.at(0), RW.at(3), RW.at(4));
-        add_children(RW.at(3), DN.at(1), RW.at(5));
-        add_children(DN.at(1), DN.at(2));
-        EXPECT_NODES_DESTROYED(DN.at(2), DN.at(1), DN.at(0), RW.at(3), RW.at(4), RW.at(5));
-
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &DN.at(2))
-        {
-            convert(n).accept(node_destroy_visitor);
-        }
+        add_children(RW.at(0), RW.at(3), RW.at(2));
+        add_children(RW.at(3), RW.at(1));
+        add_children(RW.at(2), RW.at(4));
 
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_iterator postorder_iter;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(3), RW.at(4), RW.at(2), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
+        CHECK_COUNTS(RW.at(0));
     }
     catch (const AssertException& e)
     {
@@ -7069,40 +7658,48 @@ TEST(NtNode, ParentAtIteratorDestroySome)
 }
 
 /**
- * @brief Destroy all nodes returned by parent iteration.
+ * @brief Former nodes can be added to a different tree.
+ * Clearing the old tree again does not affect them.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ParentAtIteratorDestroyAll)
+TEST(NtNode, FastClearReuseNodesInOtherTree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at DN4.
-        Destroy DN nodes.
-
-        Before:
-        DN0
-        |
-        DN1---RW0---RW1
-        |
-        DN2---RW2
+        /* Step 1: Arrange.
+        RW0             RW5
         |
-        DN3---RW3
+        RW1-----RW2
         |
-        DN4
+        RW3
+        */
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        ecu_ntnode_fast_clear(&RW.at(0));
 
-        After:
+        /* Step 2: Action.
+        RW0             RW5
+                        |
+                        RW1---RW3
+                              |
+                              RW2
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(DN.at(0), DN.at(1), RW.at(0), RW.at(1));
-        add_children(DN.at(1), DN.at(2), RW.at(2));
-        add_children(DN.at(2), DN.at(3), RW.at(3));
-        add_children(DN.at(3), DN.at(4));
-        EXPECT_NODES_DESTROYED(DN.at(4), DN.at(3), DN.at(2), RW.at(3), DN.at(1), RW.at(2), DN.at(0), RW.at(0), RW.at(1));
+        add_children(RW.at(5), RW.at(1), RW.at(3));
+        add_children(RW.at(3), RW.at(2));
+        ecu_ntnode_fast_clear(&RW.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &DN.at(4))
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(5));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(5))
         {
-            convert(n).accept(node_destroy_visitor);
+            convert(n).accept(node_obj_in_tree_visitor);
         }
+        CHECK_COUNTS(RW.at(5));
+        CHECK_TRUE( (not_in_tree(RW.at(0))) );
     }
     catch (const AssertException& e)
     {
@@ -7112,30 +7709,41 @@ TEST(NtNode, ParentAtIteratorDestroyAll)
 }
 
 /**
- * @brief Iteration should be able to successfully terminate
- * if root node destroyed.
+ * @brief Tree is rebuilt and cleared many times in a
+ * row, as a scratch tree would be every frame.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ParentAtIteratorStartIsRootDestroyRoot)
+TEST(NtNode, FastClearRepeatedly)
 {
     try
     {
-        /* Step 1: Arrange.
-        RW0
-        |
-        RW1-----RW2---RW3
-        |       |
-        RW4     RW5
-        */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(2), RW.at(5));
-        EXPECT_NODES_DESTROYED(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        /* Step 1: Arrange. */
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
 
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_parent_iterator iter;
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
+        /* Steps 2 and 3: Action and assert. Alternate between
+        RW0             RW0
+        |               |
+        RW1             RW2
+        |               |
+        RW2             RW1
+        */
+        for (int i = 0; i < 10; i++)
         {
-            ecu_ntnode_destroy(n);
+            if (i % 2)
+            {
+                add_branch(RW.at(0), RW.at(2), RW.at(1));
+            }
+            else
+            {
+                add_branch(RW.at(0), RW.at(1), RW.at(2));
+            }
+
+            CHECK_TRUE( (is_descendant(RW.at(1), RW.at(2))) );
+            CHECK_COUNTS(RW.at(0));
+            ecu_ntnode_fast_clear(&RW.at(0));
+            CHECK_TRUE( (not_in_tree(RW.at(0), RW.at(1), RW.at(2))) );
         }
     }
     catch (const AssertException& e)
@@ -7146,49 +7754,74 @@ TEST(NtNode, ParentAtIteratorStartIsRootDestroyRoot)
 }
 
 /**
- * @brief Calling next() after an iteration is finished
- * is not allowed.
+ * @brief Generation crosses 2^32, as it would after about 50 days of
+ * clearing every millisecond. Nodes stamped at generation 0 must stay
+ * stale instead of comparing live again on targets with 32-bit size_t.
  */
-TEST(NtNode, ParentAtIteratorNextAfterDone)
+TEST(NtNode, FastClearGenerationPast32Bits)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_parent_iterator iter;
-        EXPECT_ASSERTION();
+        /* Step 1: Arrange. RW1 and RW2 are stamped at generation 0,
+        then the epoch is fast-forwarded to just below 2^32.
+        RW0
+        |
+        RW1-----RW2
+        */
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        ecu_ntnode_fast_clear(&RW.at(0));
+        epoch.generation = UINT32_MAX;
+        RW.at(0).generation = UINT32_MAX;
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            (void)n;
-        }
-        (void)ecu_ntnode_parent_iterator_next(&iter);
+        /* Step 2: Action. */
+        ecu_ntnode_fast_clear(&RW.at(0));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (epoch.generation == (static_cast<std::uint64_t>(UINT32_MAX) + 1U)) );
+        CHECK_TRUE( (not_in_tree(RW.at(0), RW.at(1), RW.at(2))) );
+        CHECK_TRUE( (is_root(RW.at(1), RW.at(2))) );
+        CHECK_TRUE( (!ecu_ntnode_first_child(&RW.at(0))) );
+        add_children(RW.at(0), RW.at(2));
+        CHECK_TRUE( (ecu_ntnode_in_tree(&RW.at(2))) );
+        CHECK_TRUE( (not_in_tree(RW.at(1))) );
+        CHECK_COUNTS(RW.at(0));
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Calling cnext() after an iteration is finished
- * is not allowed.
+ * @brief Not allowed. Epoch starts near its maximum value. The last
+ * generation can be reached, but clearing again would wrap to 0.
  */
-TEST(NtNode, ConstParentAtIteratorNextAfterDone)
+TEST(NtNode, FastClearGenerationExhausted)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_parent_citerator citer;
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1
+        */
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        epoch.generation = UINT64_MAX - 1U;
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1));
+        ecu_ntnode_fast_clear(&RW.at(0));
+        CHECK_TRUE( (not_in_tree(RW.at(1))) );
+
+        /* Step 2: Action. */
         EXPECT_ASSERTION();
+        ecu_ntnode_fast_clear(&RW.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            (void)n;
-        }
-        (void)ecu_ntnode_parent_iterator_cnext(&citer);
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
@@ -7198,30 +7831,58 @@ TEST(NtNode, ConstParentAtIteratorNextAfterDone)
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Subtrees removed or moved out of the tree before it
+ * is cleared are not affected.
+ * @warning Test validation requires working postorder iterator.
  */
-TEST(NtNode, ParentAtIteratorMultipleTimes)
+TEST(NtNode, FastClearSubtreesTakenOutSurvive)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_parent_iterator iter;
-        CHECK_TRUE( (is_root(RW.at(0))) ); /* Precondition. */
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
+        /* Step 1: Arrange.
+        RW0                         RW9
+        |
+        RW1-----------RW2-----RW3
+        |             |
+        RW4---RW5     RW6
+                      |
+                      RW7
+        */
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_branch(RW.at(2), RW.at(6), RW.at(7));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
+        /* Step 2: Action. Remove RW1 and move RW2 under RW9,
+        then clear.
+        RW0         RW1             RW9
+                    |               |
+                    RW4---RW5       RW2
+                                    |
+                                    RW6
+                                    |
+                                    RW7
+        */
+        ecu_ntnode_remove(&RW.at(1));
+        ecu_ntnode_move_child_back(&RW.at(9), &RW.at(2));
+        ecu_ntnode_fast_clear(&RW.at(0));
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(7), RW.at(6), RW.at(2), RW.at(9));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
-        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(9))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
+        CHECK_COUNTS(RW.at(1));
+        CHECK_COUNTS(RW.at(9));
+        CHECK_TRUE( (not_in_tree(RW.at(0), RW.at(3))) );
     }
     catch (const AssertException& e)
     {
@@ -7231,30 +7892,44 @@ TEST(NtNode, ParentAtIteratorMultipleTimes)
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Subtrees built separately and then inserted into
+ * the tree are cleared with it. Same for nodes that were in
+ * the tree before the epoch was attached.
  */
-TEST(NtNode, ConstParentAtIteratorMultipleTimes)
+TEST(NtNode, FastClearSubtreesBroughtIn)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_parent_citerator citer;
-        CHECK_TRUE( (is_root(RW.at(0))) ); /* Precondition. */
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
+        /* Step 1: Arrange.
+        RW0             RW4
+        |               |
+        RW1             RW5---RW6
+        |                     |
+        RW2---RW3             RW7
+        */
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        add_branch(RW.at(0), RW.at(1));
+        add_children(RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(4), RW.at(5), RW.at(6));
+        add_children(RW.at(6), RW.at(7));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action.
+        RW0
+        |
+        RW1-----------RW4
+        |             |
+        RW2---RW3     RW5---RW6
+                            |
+                            RW7
+        */
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        ecu_ntnode_insert_sibling_after(&RW.at(1), &RW.at(4));
+        ecu_ntnode_fast_clear(&RW.at(0));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (not_in_tree(RW.at(0), RW.at(1), RW.at(2), RW.at(3))) );
+        CHECK_TRUE( (not_in_tree(RW.at(4), RW.at(5), RW.at(6), RW.at(7))) );
     }
     catch (const AssertException& e)
     {
@@ -7263,40 +7938,40 @@ TEST(NtNode, ConstParentAtIteratorMultipleTimes)
     }
 }
 
-/*------------------------------------------------------------*/
-/*------------------- TESTS - PARENT ITERATOR ----------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief General iteration test where starting node
- * is a leaf.
+ * @brief Cleared nodes can be removed, cleared and destroyed
+ * without visiting their old children. Only the destroyed
+ * node's callback executes.
  */
-TEST(NtNode, ParentIteratorStartIsLeaf)
+TEST(NtNode, FastClearRemoveClearAndDestroyFormerNodes)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW5.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
+        RW1-----DN0
+        |       |
+        RW2     DN1
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(3), RW.at(2), RW.at(0));
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), DN.at(0));
+        add_children(RW.at(1), RW.at(2));
+        add_children(DN.at(0), DN.at(1));
+        ecu_ntnode_fast_clear(&RW.at(0));
+        EXPECT_NODES_DESTROYED(DN.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(5))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        ecu_ntnode_remove(&RW.at(2));
+        ecu_ntnode_clear(&RW.at(1));
+        ecu_ntnode_destroy(&DN.at(0));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (not_in_tree(RW.at(0), RW.at(1), RW.at(2), DN.at(1))) );
+        CHECK_TRUE( (ecu_ntnode_is_leaf(&RW.at(1))) );
+        CHECK_TRUE( (!ecu_ntnode_first_child(&RW.at(1))) );
     }
     catch (const AssertException& e)
     {
@@ -7306,361 +7981,351 @@ TEST(NtNode, ParentIteratorStartIsLeaf)
 }
 
 /**
- * @brief General iteration test where starting node
- * is a leaf.
+ * @brief Normal clear of the root keeps its epoch so it can
+ * still be fast cleared. Cleared nodes leave the epoch.
  */
-TEST(NtNode, ConstParentIteratorStartIsLeaf)
+TEST(NtNode, FastClearAfterClear)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW5.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
+        RW1
+        |
+        RW2
         */
-        ecu_ntnode_parent_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(3), RW.at(2), RW.at(0));
+        ecu_ntnode_epoch epoch1;
+        ecu_ntnode_epoch epoch2;
+        ecu_ntnode_epoch_ctor(&epoch1);
+        ecu_ntnode_epoch_ctor(&epoch2);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch1);
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(5))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-    }
-    catch (const AssertException& e)
-    {
-        /* FAIL. */
+        /* Step 2: Action.
+        RW0             RW1
+        |               |
+        RW3             RW2
+        */
+        ecu_ntnode_clear(&RW.at(0));
+        ecu_ntnode_attach_epoch(&RW.at(1), &epoch2);
+        add_children(RW.at(1), RW.at(2));
+        add_children(RW.at(0), RW.at(3));
+        ecu_ntnode_fast_clear(&RW.at(0));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (not_in_tree(RW.at(0), RW.at(3))) );
+        CHECK_TRUE( (is_descendant(RW.at(2))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief General iteration test where starting node
- * is a middle child.
+ * @brief Cleared node is not in a tree so siblings
+ * cannot be inserted next to it.
  */
-TEST(NtNode, ParentIteratorStartIsMiddleChild)
+TEST(NtNode, FastClearInsertSiblingOfFormerNode)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW3.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
+        RW1
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(0));
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1));
+        ecu_ntnode_fast_clear(&RW.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(3))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        EXPECT_ASSERTION();
+        ecu_ntnode_insert_sibling_after(&RW.at(1), &RW.at(2));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief General iteration test where starting node
- * is a middle child.
+ * @brief Only a tree with an epoch can be fast cleared.
  */
-TEST(NtNode, ConstParentIteratorStartIsMiddleChild)
+TEST(NtNode, FastClearWithoutEpoch)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW3.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
+        RW1
         */
-        ecu_ntnode_parent_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(0));
+        add_children(RW.at(0), RW.at(1));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(3))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        EXPECT_ASSERTION();
+        ecu_ntnode_fast_clear(&RW.at(0));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Perform a parent iteration on a node that has
- * one parent (direct child of a root).
+ * @brief Only the root the epoch was attached to can be
+ * fast cleared.
  */
-TEST(NtNode, ParentIteratorStartsParentIsRoot)
+TEST(NtNode, FastClearNodeIsDescendant)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
+        RW1
+        |
+        RW2
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(0));
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        EXPECT_ASSERTION();
+        ecu_ntnode_fast_clear(&RW.at(1));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Perform a parent iteration on a node that has
- * one parent (direct child of a root).
+ * @brief Not allowed. A former node's parent link still
+ * points into the cleared tree so @ref ecu_ntnode_parent() cannot
+ * follow it until the node is detached.
  */
-TEST(NtNode, ConstParentIteratorStartsParentIsRoot)
+TEST(NtNode, FastClearFormerNodeParent)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
+        RW1-----RW2
+        |
+        RW3---RW4
         */
-        ecu_ntnode_parent_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_IN_TREE(RW.at(0));
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
+        ecu_ntnode_fast_clear(&RW.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        EXPECT_ASSERTION();
+        ecu_ntnode_parent(&RW.at(3));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Perform a parent iteration on a node that has
- * no parent. Iteration should end immediately.
+ * @brief Not allowed. A former node's next sibling link still
+ * points into the cleared tree so @ref ecu_ntnode_next() cannot
+ * follow it until the node is detached.
  */
-TEST(NtNode, ParentIteratorStartIsRoot)
+TEST(NtNode, FastClearFormerNodeNext)
 {
     try
     {
-        /* Step 1: Arrrange. Start iteration at RW0.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1 
+        RW1-----RW2
+        |
+        RW3---RW4
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1));
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
+        ecu_ntnode_fast_clear(&RW.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        EXPECT_ASSERTION();
+        ecu_ntnode_next(&RW.at(3));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Perform a parent iteration on a node that has
- * no parent. Iteration should end immediately.
+ * @brief Not allowed. A former node's first child link still
+ * points into the cleared tree so @ref ecu_ntnode_first_child() cannot
+ * follow it until the node is detached.
  */
-TEST(NtNode, ConstParentIteratorStartIsRoot)
+TEST(NtNode, FastClearFormerNodeFirstChild)
 {
     try
     {
-        /* Step 1: Arrrange. Start iteration at RW0.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1 
+        RW1-----RW2
+        |
+        RW3---RW4
         */
-        ecu_ntnode_parent_citerator citer;
-        add_children(RW.at(0), RW.at(1));
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
+        ecu_ntnode_fast_clear(&RW.at(0));
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 2: Action. */
+        EXPECT_ASSERTION();
+        ecu_ntnode_first_child(&RW.at(1));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Remove some nodes in the middle of a parent iteration.
- * @warning Test verification requires working postorder iterator.
+ * @brief Not allowed. A former node's children link still
+ * points into the cleared tree so iterators cannot
+ * follow it until the node is detached.
  */
-TEST(NtNode, ParentIteratorRemoveSome)
+TEST(NtNode, FastClearFormerNodeIterator)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW3.
-        Remove read-write nodes.
-
-        Before:
-        RO0
+        /* Step 1: Arrange.
+        RW0
         |
-        RW0-----RW1-----RW4
-                |       |
-                RO1     RW5
-                |
-                RW2
-                |
-                RW3 
-                
-        After:
-        RO0                 RW2         RW1
-        |                   |           |
-        RW0-----RW4         RW3         RO1
-                |
-                RW5 
+        RW1-----RW2
+        |
+        RW3---RW4
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RO.at(0), RW.at(0), RW.at(1), RW.at(4));
-        add_branch(RW.at(1), RO.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(4), RW.at(5));
+        ecu_ntnode_preorder_iterator iter;
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
+        ecu_ntnode_fast_clear(&RW.at(0));
 
         /* Step 2: Action. */
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(3))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
-
-        /* Step 3: Assert. */
-        ecu_ntnode_postorder_iterator postorder_iter;
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(5), RW.at(4), RO.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RO.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        EXPECT_ASSERTION();
+        ecu_ntnode_preorder_iterator_begin(&iter, &RW.at(1));
 
-        CHECK_TRUE( (is_root(RW.at(2), RW.at(1))) );
-        CHECK_TRUE( (is_descendant(RW.at(3), RO.at(1))) );
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Remove all nodes returned by parent iteration.
- * @warning Test verification requires working postorder iterator.
+ * @brief Epoch cannot be attached to a tree that
+ * already has one.
  */
-TEST(NtNode, ParentIteratorRemoveAll)
+TEST(NtNode, FastClearAttachEpochTwice)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW5.
-        Remove all nodes.
+        /* Step 1: Arrange. */
+        ecu_ntnode_epoch epoch1;
+        ecu_ntnode_epoch epoch2;
+        ecu_ntnode_epoch_ctor(&epoch1);
+        ecu_ntnode_epoch_ctor(&epoch2);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch1);
 
-        Before:
-        RW0
-        |
-        RW1-----RW2-----RW6
-                |       |
-                RW3     RW7
-                |
-                RW4
-                |
-                RW5 
-                
-        After:
-        RW0             RW4     RW3     RW2
-        |               |
-        RW1-----RW6     RW5
-                |
-                RW7
-        */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
-        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(6), RW.at(7));
-        
         /* Step 2: Action. */
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(5))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
+        EXPECT_ASSERTION();
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch2);
 
-        /* Step 3: Assert. */
-        ecu_ntnode_postorder_iterator postorder_iter;
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(7), RW.at(6), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
 
-        CHECK_TRUE( (is_root(RW.at(4), RW.at(3), RW.at(2))) );
-        CHECK_TRUE( (is_descendant(RW.at(5))) );
+/**
+ * @brief Cleared root and reused nodes start with
+ * no children. Positions are counted from scratch.
+ */
+TEST(NtNode, FastClearResetsPositions)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2---RW3
+        |
+        RW4---RW5
+        */
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+
+        /* Step 2: Action.
+        RW0
+        |
+        RW3---RW1
+              |
+              RW2
+        */
+        ecu_ntnode_fast_clear(&RW.at(0));
+        CHECK_TRUE( (ecu_ntnode_nth_child(&RW.at(0), 0) == nullptr) );
+        ecu_ntnode_insert_child_at(&RW.at(0), &RW.at(1), 0);
+        ecu_ntnode_insert_child_at(&RW.at(0), &RW.at(3), 0);
+        ecu_ntnode_insert_child_at(&RW.at(1), &RW.at(2), 0);
+
+        /* Step 3: Assert. */
+        CHECK_CHILDREN(RW.at(0), {&RW.at(3), &RW.at(1)});
+        CHECK_CHILDREN(RW.at(1), {&RW.at(2)});
     }
     catch (const AssertException& e)
     {
@@ -7669,49 +8334,155 @@ TEST(NtNode, ParentIteratorRemoveAll)
     }
 }
 
+#if defined(ECU_NTNODE_DIRTY)
 /**
- * @brief Destroy some nodes in the middle of a parent iteration.
- * @warning Test verification requires working postorder iterator.
+ * @brief Cleared root and reused nodes are dirty.
  */
-TEST(NtNode, ParentIteratorDestroySome)
+TEST(NtNode, FastClearMarksDirty)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW5.
-        Destroy DN nodes.
-
-        Before:
+        /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2---RW3
+        RW1
         |
-        DN0---RW4
+        RW2
+        */
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        add_branch(RW.at(0), RW.at(1), RW.at(2));
+        (void)ecu_ntnode_refresh(&RW.at(0), &combine_unused, ECU_NTNODE_OBJ_UNUSED);
+
+        /* Step 2: Action. */
+        ecu_ntnode_fast_clear(&RW.at(0));
+        add_children(RW.at(3), RW.at(1));
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_dirty(RW.at(0), RW.at(1), RW.at(3))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+#endif /* ECU_NTNODE_DIRTY */
+
+#if defined(ECU_NTNODE_INDEXED)
+/**
+ * @brief Child indexes of the root and of reused
+ * nodes are emptied.
+ */
+TEST(NtNode, FastClearEmptiesIndexes)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
         |
-        RW5
+        RW1
+        |
+        RW2
+        */
+        ecu_ntnode *root_slots[4];
+        ecu_ntnode *n1_slots[4];
+        ecu_ntnode_index root_index;
+        ecu_ntnode_index n1_index;
+        ecu_ntnode_epoch epoch;
+        ecu_ntnode_index_ctor(&root_index, &root_slots[0], 4);
+        ecu_ntnode_index_ctor(&n1_index, &n1_slots[0], 4);
+        ecu_ntnode_epoch_ctor(&epoch);
+        ecu_ntnode_attach_index(&RW.at(0), &root_index);
+        ecu_ntnode_attach_index(&RW.at(1), &n1_index);
+        ecu_ntnode_attach_epoch(&RW.at(0), &epoch);
+        rw_ntnode n2{2};
+        add_branch(RW.at(0), RW.at(1), n2);
 
-        After:
+        /* Step 2: Action.
         RW0
         |
-        RW1---RW2---RW3
+        n2
+        */
+        ecu_ntnode_fast_clear(&RW.at(0));
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&RW.at(0), 2)) );
+        add_children(RW.at(0), n2);
+        add_children(RW.at(3), RW.at(1));
+
+        /* Step 3: Assert. */
+        CHECK_FINDS_CHILDREN(RW.at(0));
+        CHECK_TRUE( (!ecu_ntnode_find_child_by_id(&RW.at(1), 2)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+#endif /* ECU_NTNODE_INDEXED */
+
+#endif /* ECU_NTNODE_FAST_CLEAR */
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - CHILD ITERATOR -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief General iteration test. Verify all children
+ * iterated over.
+ */
+TEST(NtNode, ChildIterator)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW0.
+        RW0
         |
-        RW4
+        RW1-----RW2------RW3----RW4
+                |
+                RW5 
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), DN.at(0), RW.at(4));
-        add_children(DN.at(0), RW.at(5));
-        EXPECT_NODES_DESTROYED(DN.at(0), RW.at(5));
+        ecu_ntnode_child_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(4));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(5))
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_destroy_visitor);
+            convert(n).accept(node_obj_in_tree_visitor);
         }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
 
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_iterator postorder_iter;
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(2), RW.at(3), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
+/**
+ * @brief General iteration test. Verify all children
+ * iterated over.
+ */
+TEST(NtNode, ConstChildIterator)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW0.
+        RW0
+        |
+        RW1-----RW2------RW3----RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_child_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -7724,39 +8495,62 @@ TEST(NtNode, ParentIteratorDestroySome)
 }
 
 /**
- * @brief Destroy all nodes returned by parent iteration.
+ * @brief Perform a child iteration on a node that has
+ * one child.
  */
-TEST(NtNode, ParentIteratorDestroyAll)
+TEST(NtNode, ChildIteratorParentHasOneChild)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at DN4.
-        Destroy DN nodes.
-
-        Before:
-        DN0
-        |
-        DN1---RW0---RW1
-        |
-        DN2---RW2
-        |
-        DN3---RW3
+        /* Step 1: Arrange. Start iteration at RW2.
+        RW0
         |
-        DN4
+        RW1-----RW2------RW3----RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_child_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+        EXPECT_NODES_IN_TREE(RW.at(5));
 
-        After:
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(2))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform a child iteration on a node that has
+ * one child.
+ */
+TEST(NtNode, ConstChildIteratorParentHasOneChild)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW2.
+        RW0
+        |
+        RW1-----RW2------RW3----RW4
+                |
+                RW5 
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(DN.at(0), DN.at(1), RW.at(0), RW.at(1));
-        add_children(DN.at(1), DN.at(2), RW.at(2));
-        add_children(DN.at(2), DN.at(3), RW.at(3));
-        add_children(DN.at(3), DN.at(4));
-        EXPECT_NODES_DESTROYED(DN.at(4), DN.at(3), DN.at(2), RW.at(3), DN.at(1), RW.at(2), DN.at(0), RW.at(0), RW.at(1));
+        ecu_ntnode_child_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+        EXPECT_NODES_IN_TREE(RW.at(5));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &DN.at(4))
+        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(2))
         {
-            convert(n).accept(node_destroy_visitor);
+            convert(n).accept(node_obj_in_tree_visitor);
         }
     }
     catch (const AssertException& e)
@@ -7767,83 +8561,4785 @@ TEST(NtNode, ParentIteratorDestroyAll)
 }
 
 /**
- * @brief Calling next() after an iteration is finished
- * is not allowed.
+ * @brief Perform a child iteration on a node that has
+ * no children. Iteration should end immediately.
  */
-TEST(NtNode, ParentIteratorNextAfterDone)
+TEST(NtNode, ChildIteratorParentHasNoChildren)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_parent_iterator iter;
-        EXPECT_ASSERTION();
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1 
+        */
+        ecu_ntnode_child_iterator iter;
+        add_children(RW.at(0), RW.at(1));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(0))
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform a child iteration on a node that has
+ * no children. Iteration should end immediately.
+ */
+TEST(NtNode, ConstChildIteratorParentHasNoChildren)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1 
+        */
+        ecu_ntnode_child_citerator citer;
+        add_children(RW.at(0), RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove some nodes in the middle of a child iteration.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ChildIteratorRemoveSome)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW0.
+        Remove RW1 and RW2.
+
+        Before:
+        RW0
+        |
+        RW1----RO0----RW2---RO1
+                                        
+        After:
+        RW0             RW1         RW2
+        |
+        RO0-----RO1
+        */
+        ecu_ntnode_child_iterator iter;
+        add_children(RW.at(0), RW.at(1), RO.at(0), RW.at(2), RO.at(1));
+
+        /* Step 2: Action. */
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_root(RW.at(1), RW.at(2))) );
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_iterator postorder_iter;
+        EXPECT_NODES_IN_TREE(RO.at(0), RO.at(1), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove all nodes returned by child iteration.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ChildIteratorRemoveAll)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW2.
+        Remove all children.
+
+        Before:
+        RW0
+        |
+        RW1-----RW2---RW3---RW4
+                |
+                RW5---RW6---RW7
+                                        
+        After:
+        RW0                         RW5  RW6  RW7
+        |
+        RW1-----RW2---RW3---RW4
+        */
+        ecu_ntnode_child_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6), RW.at(7));
+
+        /* Step 2: Action. */
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(2))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_root(RW.at(5), RW.at(6), RW.at(7))) );
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_iterator postorder_iter;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy some nodes in the middle of a child iteration.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ChildIteratorDestroySome)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW0.
+        Destroy DN nodes.
+
+        Before:
+        RW0
+        |
+        RW1---DN0---RW2---DN1
+                                        
+        After:
+        RW0
+        |
+        RW1---RW2
+        */
+        ecu_ntnode_child_iterator iter;
+        add_children(RW.at(0), RW.at(1), DN.at(0), RW.at(2), DN.at(1));
+        EXPECT_NODES_DESTROYED(DN.at(0), DN.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_iterator postorder_iter;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy all nodes returned by child iteration.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ChildIteratorDestroyAll)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW2.
+        Destroy DN nodes.
+
+        Before:
+        RW0
+        |
+        RW1-----RW2---RW3
+                |
+                DN0---DN1---DN2
+                                        
+        After:
+        RW0
+        |
+        RW1-----RW2----RW3
+        */
+        ecu_ntnode_child_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(2), DN.at(0), DN.at(1), DN.at(2));
+        EXPECT_NODES_DESTROYED(DN.at(0), DN.at(1), DN.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(2))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_iterator postorder_iter;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling next() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, ChildIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_child_iterator iter;
+        EXPECT_ASSERTION();
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_child_iterator_next(&iter);
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling cnext() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, ConstChildIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_child_citerator citer;
+        EXPECT_ASSERTION();
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_child_iterator_cnext(&citer);
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, ChildIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2
+        */
+        ecu_ntnode_child_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(1), RW.at(2), RW.at(1), RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CHILD_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, ConstChildIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2
+        */
+        ecu_ntnode_child_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(1), RW.at(2), RW.at(1), RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_CHILD_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------- TESTS - NEXT SIBLING AT ITERATOR ------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Verify correct nodes in iteration returned.
+ */
+TEST(NtNode, NextSiblingAtIteratorStartIsFirstSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2---------------------RW3
+        |       |                       |
+        RW4     RW5---RW6---RW7---RW8   RW9---RW10
+                |           |
+                RW11        RW12
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6), RW.at(7), RW.at(8));
+        add_children(RW.at(3), RW.at(9), RW.at(10));
+        add_children(RW.at(5), RW.at(11));
+        add_children(RW.at(7), RW.at(12));
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6), RW.at(7), RW.at(8));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(5))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Verify correct nodes in iteration returned.
+ */
+TEST(NtNode, ConstNextSiblingAtIteratorStartIsFirstSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2---------------------RW3
+        |       |                       |
+        RW4     RW5---RW6---RW7---RW8   RW9---RW10
+                |           |
+                RW11        RW12
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6), RW.at(7), RW.at(8));
+        add_children(RW.at(3), RW.at(9), RW.at(10));
+        add_children(RW.at(5), RW.at(11));
+        add_children(RW.at(7), RW.at(12));
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6), RW.at(7), RW.at(8));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(5))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Verify correct nodes in iteration returned.
+ */
+TEST(NtNode, NextSiblingAtIteratorStartIsMiddleSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3---RW4---RW5---RW6
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(6));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Verify correct nodes in iteration returned.
+ */
+TEST(NtNode, ConstNextSiblingAtIteratorStartIsMiddleSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3---RW4---RW5---RW6
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(6));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Last sibling returned then iteration ends.
+ */
+TEST(NtNode, NextSiblingAtIteratorStartIsLastSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(2))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Last sibling returned then iteration ends.
+ */
+TEST(NtNode, ConstNextSiblingAtIteratorStartIsLastSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(2))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Root returned then iteration ends.
+ */
+TEST(NtNode, NextSiblingAtIteratorStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        EXPECT_NODES_IN_TREE(empty_root);
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &empty_root)
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Root returned then iteration ends.
+ */
+TEST(NtNode, ConstNextSiblingAtIteratorStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        EXPECT_NODES_IN_TREE(empty_root);
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &empty_root)
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Verify correct nodes in iteration returned.
+ */
+TEST(NtNode, NextSiblingAtIteratorStartHasOneSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2
+        |
+        RW3
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Verify correct nodes in iteration returned.
+ */
+TEST(NtNode, ConstNextSiblingAtIteratorStartHasOneSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2
+        |
+        RW3
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove some nodes in the middle of an iteration. 
+ * Verify trees intact.
+ * @warning Test validation requires working postorder iterator.
+ */
+TEST(NtNode, NextSiblingAtIteratorRemoveSome)
+{
+    try
+    {
+        /* Step 1: Arrange.
+
+        Before:
+        RW0
+        |
+        RW1---RW2---RO0-----RO1
+        |           |       |
+        RW3---RW4   RW5     RW6---RW7
+        
+        After:
+        RW0                 RW1         RW2
+        |                   |
+        RO0-----RO1         RW3---RW4
+        |       |
+        RW5     RW6---RW7
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RO.at(0), RO.at(1));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
+        add_children(RO.at(0), RW.at(5));
+        add_children(RO.at(1), RW.at(6), RW.at(7));
+
+        /* Step 2: Action. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(5), RO.at(0), RW.at(6), RW.at(7), RO.at(1), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        /* Step 3: Assert. Verify removed trees intact. */
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(4), RW.at(1));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        CHECK_TRUE( (not_in_tree(RW.at(2))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove all nodes in the iteration. Verify
+ * trees intact.
+ * @warning Test validation requires working postorder iterator.
+ */
+TEST(NtNode, NextSiblingAtIteratorRemoveAll)
+{
+    try
+    {
+        /* Step 1: Arrange.
+
+        Before:
+        RW0
+        |
+        RW1---RW2---RW3-----RW4
+        |                   |
+        RW5---RW6           RW8---RW9
+        
+        After:
+        RW0     RW1         RW2     RW3     RW4
+                |                           |
+                RW5---RW6                   RW8---RW9
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(1), RW.at(5), RW.at(6));
+        add_children(RW.at(4), RW.at(8), RW.at(9));
+
+        /* Step 2: Action. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        CHECK_TRUE( (not_in_tree(RW.at(0))) );
+
+        /* Step 3: Assert. Verify removed trees intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6), RW.at(1));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        EXPECT_NODES_IN_TREE(RW.at(8), RW.at(9), RW.at(4));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        CHECK_TRUE( (not_in_tree(RW.at(2), RW.at(3))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Nothing happens to tree.
+ * @warning Test validation requires working postorder iterator.
+ */
+TEST(NtNode, NextSiblingAtIteratorStartIsRootRemoveRoot)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+
+        /* Step 2: Action. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy some nodes in the middle of an iteration. 
+ * Verify remaining tree intact.
+ * @warning Test validation requires working postorder iterator.
+ */
+TEST(NtNode, NextSiblingAtIteratorDestroySome)
+{
+    try
+    {
+        /* Step 1: Arrange.
+
+        Before:
+        RW0
+        |
+        DN0-----DN1---------DN2-----DN3
+        |       |           |       |
+        RW1     RW2---RW3   RW4     RW5
+        |
+        RW6 
+        
+        After:
+        RW0
+        |
+        DN0-----DN1
+        |       |
+        RW1     RW2---RW3
+        |
+        RW6
+        */
+        add_children(RW.at(0), DN.at(0), DN.at(1), DN.at(2), DN.at(3));
+        add_children(DN.at(0), RW.at(1));
+        add_children(DN.at(1), RW.at(2), RW.at(3));
+        add_children(DN.at(2), RW.at(4));
+        add_children(DN.at(3), RW.at(5));
+        add_children(RW.at(1), RW.at(6));
+        EXPECT_NODES_DESTROYED(DN.at(2), RW.at(4), DN.at(3), RW.at(5));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &DN.at(2))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(1), DN.at(0), RW.at(2), RW.at(3), DN.at(1), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy all nodes in the iteration. Verify
+ * remaining tree intact.
+ * @warning Test validation requires working postorder iterator.
+ */
+TEST(NtNode, NextSiblingAtIteratorDestroyAll)
+{
+    try
+    {
+        /* Step 1: Arrange.
+
+        Before:
+        RW0
+        |
+        RW1
+        |
+        DN0-----DN1---------DN2-----DN3
+        |       |           |       |
+        RW2     RW3---RW4   RW5     RW6
+        |
+        RW7 
+        
+        After:
+        RW0
+        |
+        RW1
+        */
+        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(1), DN.at(0), DN.at(1), DN.at(2), DN.at(3));
+        add_children(DN.at(0), RW.at(2));
+        add_children(DN.at(1), RW.at(3), RW.at(4));
+        add_children(DN.at(2), RW.at(5));
+        add_children(DN.at(3), RW.at(6));
+        add_children(RW.at(2), RW.at(7));
+        EXPECT_NODES_DESTROYED(DN.at(0), RW.at(2), RW.at(7), DN.at(1), RW.at(3), RW.at(4), DN.at(2),
+                               RW.at(5), DN.at(3), RW.at(6));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &DN.at(0))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration should be able to exit after root destroyed.
+ */
+TEST(NtNode, NextSiblingAtIteratorStartIsRootDestroyRoot)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        EXPECT_NODES_DESTROYED(RW.at(0), RW.at(1), RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            ecu_ntnode_destroy(n);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling next() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, NextSiblingAtIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &empty_root)
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_next_sibling_iterator_next(&iter);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling cnext() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, ConstNextSiblingAtIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &empty_root)
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_next_sibling_iterator_cnext(&citer);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, NextSiblingAtIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2---RW3
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(2), RW.at(3), RW.at(3));
+        ecu_ntnode_next_sibling_iterator iter;
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(2))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(n, &iter, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, ConstNextSiblingAtIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2---RW3
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(3), RW.at(2), RW.at(3), RW.at(3));
+        ecu_ntnode_next_sibling_citerator citer;
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(2))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_NEXT_SIBLING_AT_FOR_EACH(n, &citer, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*--------------- TESTS - NEXT SIBLING ITERATOR --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Verify correct nodes in iteration returned.
+ */
+TEST(NtNode, NextSiblingIteratorStartIsFirstSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2---------------------RW3
+        |       |                       |
+        RW4     RW5---RW6---RW7---RW8   RW9---RW10
+                |           |
+                RW11        RW12
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6), RW.at(7), RW.at(8));
+        add_children(RW.at(3), RW.at(9), RW.at(10));
+        add_children(RW.at(5), RW.at(11));
+        add_children(RW.at(7), RW.at(12));
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(8));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(5))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Verify correct nodes in iteration returned.
+ */
+TEST(NtNode, ConstNextSiblingIteratorStartIsFirstSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2---------------------RW3
+        |       |                       |
+        RW4     RW5---RW6---RW7---RW8   RW9---RW10
+                |           |
+                RW11        RW12
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6), RW.at(7), RW.at(8));
+        add_children(RW.at(3), RW.at(9), RW.at(10));
+        add_children(RW.at(5), RW.at(11));
+        add_children(RW.at(7), RW.at(12));
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(8));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(5))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Verify correct nodes in iteration returned.
+ */
+TEST(NtNode, NextSiblingIteratorStartIsMiddleSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3---RW4---RW5---RW6
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6));
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Verify correct nodes in iteration returned.
+ */
+TEST(NtNode, ConstNextSiblingIteratorStartIsMiddleSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3---RW4---RW5---RW6
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6));
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration immediately exits.
+ */
+TEST(NtNode, NextSiblingIteratorStartIsLastSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(2))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration immediately exits.
+ */
+TEST(NtNode, ConstNextSiblingIteratorStartIsLastSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(2))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration immediately exits.
+ */
+TEST(NtNode, NextSiblingIteratorStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &empty_root)
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration immediately exits.
+ */
+TEST(NtNode, ConstNextSiblingIteratorStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &empty_root)
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Next sibling returned then iteration exits.
+ */
+TEST(NtNode, NextSiblingIteratorStartHasOneSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2
+        |
+        RW3
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Next sibling returned then iteration exits.
+ */
+TEST(NtNode, ConstNextSiblingIteratorStartHasOneSibling)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2
+        |
+        RW3
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(2));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove some nodes in the middle of an iteration. 
+ * Verify trees intact.
+ * @warning Test validation requires working postorder iterator.
+ */
+TEST(NtNode, NextSiblingIteratorRemoveSome)
+{
+    try
+    {
+        /* Step 1: Arrange.
+
+        Before:
+        RW0
+        |
+        RW1---RW2---RO0-----RW3
+        |           |       |
+        RW4---RW5   RW6     RW7---RW8
+        
+        After:
+        RW0                 RW2     RW3
+        |                           |
+        RW1---------RO0             RW7---RW8
+        |           |
+        RW4---RW5   RW6
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RO.at(0), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RO.at(0), RW.at(6));
+        add_children(RW.at(3), RW.at(7), RW.at(8));
+
+        /* Step 2: Action. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(1), RW.at(6), RO.at(0), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        /* Step 3: Assert. Verify removed trees intact. */
+        CHECK_TRUE( (not_in_tree(RW.at(2))) );
+        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(8), RW.at(3));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove all nodes in the iteration. Verify
+ * trees intact.
+ * @warning Test validation requires working postorder iterator.
+ */
+TEST(NtNode, NextSiblingIteratorRemoveAll)
+{
+    try
+    {
+        /* Step 1: Arrange.
+
+        Before:
+        RW0
+        |
+        RW1---RW2---RW3-----RW4
+        |           |       |
+        RW5---RW6   RW7     RW8---RW9
+        
+        After:
+        RW0         RW2     RW3     RW4
+        |                   |       |
+        RW1                 RW7     RW8---RW9
+        |
+        RW5---RW6
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_children(RW.at(1), RW.at(5), RW.at(6));
+        add_children(RW.at(3), RW.at(7));
+        add_children(RW.at(4), RW.at(8), RW.at(9));
+
+        /* Step 2: Action. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(6), RW.at(1), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        /* Step 3: Assert. Verify removed trees intact. */
+        CHECK_TRUE( (not_in_tree(RW.at(2))) );
+        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(3));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        EXPECT_NODES_IN_TREE(RW.at(8), RW.at(9), RW.at(4));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy some nodes in the middle of an iteration. 
+ * Verify remaining tree intact.
+ * @warning Test validation requires working postorder iterator.
+ */
+TEST(NtNode, NextSiblingIteratorDestroySome)
+{
+    try
+    {
+        /* Step 1: Arrange.
+
+        Before:
+        RW0
+        |
+        DN0-----DN1---------DN2-----DN3
+        |       |           |       |
+        RW1     RW2---RW3   RW4     RW5
+        |
+        RW6 
+        
+        After:
+        RW0
+        |
+        DN0-----DN1
+        |       |
+        RW1     RW2---RW3
+        |
+        RW6
+        */
+        add_children(RW.at(0), DN.at(0), DN.at(1), DN.at(2), DN.at(3));
+        add_children(DN.at(0), RW.at(1));
+        add_children(DN.at(1), RW.at(2), RW.at(3));
+        add_children(DN.at(2), RW.at(4));
+        add_children(DN.at(3), RW.at(5));
+        add_children(RW.at(1), RW.at(6));
+        EXPECT_NODES_DESTROYED(DN.at(2), RW.at(4), DN.at(3), RW.at(5));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &DN.at(1))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(1), DN.at(0), RW.at(2), RW.at(3), DN.at(1), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy all nodes in the iteration. Verify
+ * remaining tree intact.
+ * @warning Test validation requires working postorder iterator.
+ */
+TEST(NtNode, NextSiblingIteratorDestroyAll)
+{
+    try
+    {
+        /* Step 1: Arrange.
+
+        Before:
+        RW0
+        |
+        RW1
+        |
+        DN0-----DN1---------DN2-----DN3
+        |       |           |       |
+        RW2     RW3---RW4   RW5     RW6
+        |
+        RW7 
+        
+        After:
+        RW0
+        |
+        RW1
+        |
+        DN0
+        |
+        RW2
+        |
+        RW7
+        */
+        add_children(RW.at(0), RW.at(1));
+        add_children(RW.at(1), DN.at(0), DN.at(1), DN.at(2), DN.at(3));
+        add_children(DN.at(0), RW.at(2));
+        add_children(DN.at(1), RW.at(3), RW.at(4));
+        add_children(DN.at(2), RW.at(5));
+        add_children(DN.at(3), RW.at(6));
+        add_children(RW.at(2), RW.at(7));
+        EXPECT_NODES_DESTROYED(DN.at(1), RW.at(3), RW.at(4), DN.at(2), RW.at(5), DN.at(3), RW.at(6));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &DN.at(0))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(2), DN.at(0), RW.at(1), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling next() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, NextSiblingIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntnode_next_sibling_iterator iter;
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &empty_root)
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_next_sibling_iterator_next(&iter);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling cnext() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, ConstNextSiblingIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntnode_next_sibling_citerator citer;
+        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &empty_root)
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_next_sibling_iterator_cnext(&citer);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, NextSiblingIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2---RW3---RW4
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(3), RW.at(4), RW.at(3), RW.at(4), RW.at(4));
+        ecu_ntnode_next_sibling_iterator iter;
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(2))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_NEXT_SIBLING_FOR_EACH(n, &iter, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, ConstNextSiblingIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---RW2---RW3---RW4
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(3), RW.at(4), RW.at(3), RW.at(4), RW.at(4));
+        ecu_ntnode_next_sibling_citerator citer;
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(2))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_NEXT_SIBLING_FOR_EACH(n, &citer, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------ TESTS - PARENT AT ITERATOR --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief General iteration test where starting node
+ * is a leaf.
+ */
+TEST(NtNode, ParentAtIteratorStartIsLeaf)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW5.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(4), RW.at(3), RW.at(2), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(5))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General iteration test where starting node
+ * is a leaf.
+ */
+TEST(NtNode, ConstParentAtIteratorStartIsLeaf)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW5.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(4), RW.at(3), RW.at(2), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(5))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General iteration test where starting node
+ * is a middle child.
+ */
+TEST(NtNode, ParentAtIteratorStartIsMiddleChild)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW3.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General iteration test where starting node
+ * is a middle child.
+ */
+TEST(NtNode, ConstParentAtIteratorStartIsMiddleChild)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW3.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform a parent iteration on a node that has
+ * one parent (direct child of a root).
+ */
+TEST(NtNode, ParentAtIteratorStartsParentIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform a parent iteration on a node that has
+ * one parent (direct child of a root).
+ */
+TEST(NtNode, ConstParentAtIteratorStartsParentIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform a parent iteration on a node that has
+ * no parent. Iteration should return only root node.
+ */
+TEST(NtNode, ParentAtIteratorStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrrange. Start iteration at RW0.
+        RW0
+        |
+        RW1 
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1));
+        EXPECT_NODES_IN_TREE(RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform a parent iteration on a node that has
+ * no parent. Iteration should return only root node.
+ */
+TEST(NtNode, ConstParentAtIteratorStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrrange. Start iteration at RW0.
+        RW0
+        |
+        RW1 
+        */
+        ecu_ntnode_parent_citerator citer;
+        add_children(RW.at(0), RW.at(1));
+        EXPECT_NODES_IN_TREE(RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove some nodes in the middle of a parent iteration.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ParentAtIteratorRemoveSome)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW3.
+        Remove read-write nodes.
+
+        Before:
+        RO0
+        |
+        RW0-----RW1-----RW4
+                |       |
+                RO1     RW5
+                |
+                RW2
+                |
+                RW3 
+                
+        After:
+        RO0             RW3     RW2     RW1
+        |                               |
+        RW0-----RW4                     RO1
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RO.at(0), RW.at(0), RW.at(1), RW.at(4));
+        add_branch(RW.at(1), RO.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(4), RW.at(5));
+
+        /* Step 2: Action. */
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(3))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_iterator postorder_iter;
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(5), RW.at(4), RO.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RO.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        CHECK_TRUE( (is_root(RW.at(3), RW.at(2), RW.at(1))) );
+        CHECK_TRUE( (is_descendant(RO.at(1))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove all nodes returned by parent iteration.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ParentAtIteratorRemoveAll)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW5.
+        Remove all nodes.
+
+        Before:
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+                
+        After:
+        RW0             RW5    RW4     RW3     RW2
+        |               
+        RW1-----RW6
+                |
+                RW7    
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        
+        /* Step 2: Action. */
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(5))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_iterator postorder_iter;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(7), RW.at(6), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        CHECK_TRUE( (is_root(RW.at(5), RW.at(4), RW.at(3), RW.at(2))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Nothing should happen to tree.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ParentAtIteratorStartIsRootRemoveRoot)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2---RW3
+        |       |
+        RW4     RW5
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+
+        /* Step 2: Action. */
+        ecu_ntnode_parent_iterator iter;
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            ecu_ntnode_remove(n);
+        }
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(5), RW.at(2), RW.at(3), RW.at(0));
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy some nodes in the middle of a parent iteration.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ParentAtIteratorDestroySome)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at DN2.
+        Destroy DN nodes.
+
+        Before:
+        RW0
+        |
+        DN0---RW1---RW2
+        |
+        RW3---RW4
+        |
+        DN1---RW5
+        |
+        DN2
+
+        After:
+        RW0
+        |
+        RW1---RW2
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), DN.at(0), RW.at(1), RW.at(2));
+        add_children(DN.at(0), RW.at(3), RW.at(4));
+        add_children(RW.at(3), DN.at(1), RW.at(5));
+        add_children(DN.at(1), DN.at(2));
+        EXPECT_NODES_DESTROYED(DN.at(2), DN.at(1), DN.at(0), RW.at(3), RW.at(4), RW.at(5));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &DN.at(2))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_iterator postorder_iter;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(2), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy all nodes returned by parent iteration.
+ */
+TEST(NtNode, ParentAtIteratorDestroyAll)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at DN4.
+        Destroy DN nodes.
+
+        Before:
+        DN0
+        |
+        DN1---RW0---RW1
+        |
+        DN2---RW2
+        |
+        DN3---RW3
+        |
+        DN4
+
+        After:
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(DN.at(0), DN.at(1), RW.at(0), RW.at(1));
+        add_children(DN.at(1), DN.at(2), RW.at(2));
+        add_children(DN.at(2), DN.at(3), RW.at(3));
+        add_children(DN.at(3), DN.at(4));
+        EXPECT_NODES_DESTROYED(DN.at(4), DN.at(3), DN.at(2), RW.at(3), DN.at(1), RW.at(2), DN.at(0), RW.at(0), RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &DN.at(4))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration should be able to successfully terminate
+ * if root node destroyed.
+ */
+TEST(NtNode, ParentAtIteratorStartIsRootDestroyRoot)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2---RW3
+        |       |
+        RW4     RW5
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5));
+        EXPECT_NODES_DESTROYED(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_parent_iterator iter;
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            ecu_ntnode_destroy(n);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling next() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, ParentAtIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_parent_iterator iter;
+        EXPECT_ASSERTION();
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_parent_iterator_next(&iter);
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling cnext() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, ConstParentAtIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_parent_citerator citer;
+        EXPECT_ASSERTION();
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_parent_iterator_cnext(&citer);
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, ParentAtIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_parent_iterator iter;
+        CHECK_TRUE( (is_root(RW.at(0))) ); /* Precondition. */
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_PARENT_AT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, ConstParentAtIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_parent_citerator citer;
+        CHECK_TRUE( (is_root(RW.at(0))) ); /* Precondition. */
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_PARENT_AT_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - PARENT ITERATOR ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief General iteration test where starting node
+ * is a leaf.
+ */
+TEST(NtNode, ParentIteratorStartIsLeaf)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW5.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(3), RW.at(2), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(5))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General iteration test where starting node
+ * is a leaf.
+ */
+TEST(NtNode, ConstParentIteratorStartIsLeaf)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW5.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(3), RW.at(2), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(5))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General iteration test where starting node
+ * is a middle child.
+ */
+TEST(NtNode, ParentIteratorStartIsMiddleChild)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW3.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General iteration test where starting node
+ * is a middle child.
+ */
+TEST(NtNode, ConstParentIteratorStartIsMiddleChild)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW3.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform a parent iteration on a node that has
+ * one parent (direct child of a root).
+ */
+TEST(NtNode, ParentIteratorStartsParentIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform a parent iteration on a node that has
+ * one parent (direct child of a root).
+ */
+TEST(NtNode, ConstParentIteratorStartsParentIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform a parent iteration on a node that has
+ * no parent. Iteration should end immediately.
+ */
+TEST(NtNode, ParentIteratorStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrrange. Start iteration at RW0.
+        RW0
+        |
+        RW1 
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform a parent iteration on a node that has
+ * no parent. Iteration should end immediately.
+ */
+TEST(NtNode, ConstParentIteratorStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrrange. Start iteration at RW0.
+        RW0
+        |
+        RW1 
+        */
+        ecu_ntnode_parent_citerator citer;
+        add_children(RW.at(0), RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove some nodes in the middle of a parent iteration.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ParentIteratorRemoveSome)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW3.
+        Remove read-write nodes.
+
+        Before:
+        RO0
+        |
+        RW0-----RW1-----RW4
+                |       |
+                RO1     RW5
+                |
+                RW2
+                |
+                RW3 
+                
+        After:
+        RO0                 RW2         RW1
+        |                   |           |
+        RW0-----RW4         RW3         RO1
+                |
+                RW5 
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RO.at(0), RW.at(0), RW.at(1), RW.at(4));
+        add_branch(RW.at(1), RO.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(4), RW.at(5));
+
+        /* Step 2: Action. */
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(3))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_iterator postorder_iter;
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(5), RW.at(4), RO.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RO.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        CHECK_TRUE( (is_root(RW.at(2), RW.at(1))) );
+        CHECK_TRUE( (is_descendant(RW.at(3), RO.at(1))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Remove all nodes returned by parent iteration.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ParentIteratorRemoveAll)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW5.
+        Remove all nodes.
+
+        Before:
+        RW0
+        |
+        RW1-----RW2-----RW6
+                |       |
+                RW3     RW7
+                |
+                RW4
+                |
+                RW5 
+                
+        After:
+        RW0             RW4     RW3     RW2
+        |               |
+        RW1-----RW6     RW5
+                |
+                RW7
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(6));
+        add_branch(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(6), RW.at(7));
+        
+        /* Step 2: Action. */
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(5))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. */
+        ecu_ntnode_postorder_iterator postorder_iter;
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(7), RW.at(6), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+
+        CHECK_TRUE( (is_root(RW.at(4), RW.at(3), RW.at(2))) );
+        CHECK_TRUE( (is_descendant(RW.at(5))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy some nodes in the middle of a parent iteration.
+ * @warning Test verification requires working postorder iterator.
+ */
+TEST(NtNode, ParentIteratorDestroySome)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW5.
+        Destroy DN nodes.
+
+        Before:
+        RW0
+        |
+        RW1---RW2---RW3
+        |
+        DN0---RW4
+        |
+        RW5
+
+        After:
+        RW0
+        |
+        RW1---RW2---RW3
+        |
+        RW4
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), DN.at(0), RW.at(4));
+        add_children(DN.at(0), RW.at(5));
+        EXPECT_NODES_DESTROYED(DN.at(0), RW.at(5));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(5))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_iterator postorder_iter;
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(2), RW.at(3), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &postorder_iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy all nodes returned by parent iteration.
+ */
+TEST(NtNode, ParentIteratorDestroyAll)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at DN4.
+        Destroy DN nodes.
+
+        Before:
+        DN0
+        |
+        DN1---RW0---RW1
+        |
+        DN2---RW2
+        |
+        DN3---RW3
+        |
+        DN4
+
+        After:
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(DN.at(0), DN.at(1), RW.at(0), RW.at(1));
+        add_children(DN.at(1), DN.at(2), RW.at(2));
+        add_children(DN.at(2), DN.at(3), RW.at(3));
+        add_children(DN.at(3), DN.at(4));
+        EXPECT_NODES_DESTROYED(DN.at(4), DN.at(3), DN.at(2), RW.at(3), DN.at(1), RW.at(2), DN.at(0), RW.at(0), RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &DN.at(4))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling next() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, ParentIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_parent_iterator iter;
+        EXPECT_ASSERTION();
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_parent_iterator_next(&iter);
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling cnext() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, ConstParentIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_parent_citerator citer;
+        EXPECT_ASSERTION();
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_parent_iterator_cnext(&citer);
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, ParentIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange. 
+        RW0
+        |
+        RW1
+        */
+        ecu_ntnode_parent_iterator iter;
+        add_children(RW.at(0), RW.at(1));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, ConstParentIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange. 
+        RW0
+        |
+        RW1
+        */
+        ecu_ntnode_parent_citerator citer;
+        add_children(RW.at(0), RW.at(1));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------- TESTS - POSTORDER ITERATOR ---------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief General iteration test. Start at root. 
+ * Verify all nodes iterated over.
+ */
+TEST(NtNode, PostorderIterator)
+{
+    try
+    {
+        /* Step 1: Arrange. 
+        RW0
+        |
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(15), RW.at(12), RW.at(6), 
+                             RW.at(7), RW.at(1), RW.at(13), RW.at(8), RW.at(9), 
+                             RW.at(10), RW.at(2), RW.at(17), RW.at(16), RW.at(14), 
+                             RW.at(11), RW.at(3), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General iteration test. Start at root.
+ * Verify all nodes iterated over.
+ */
+TEST(NtNode, ConstPostorderIterator)
+{
+    try
+    {
+        /* Step 1: Arrange. 
+        RW0
+        |
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
+        */
+        ecu_ntnode_postorder_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(15), RW.at(12), RW.at(6), 
+                             RW.at(7), RW.at(1), RW.at(13), RW.at(8), RW.at(9), 
+                             RW.at(10), RW.at(2), RW.at(17), RW.at(16), RW.at(14), 
+                             RW.at(11), RW.at(3), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at subroot node in a left-most subtree.
+ */
+TEST(NtNode, PostorderIteratorStartIsLeftMostSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1---RW2---RW3
+        |
+        RW4
+        |
+        RW5---RW6
+        |
+        RW7
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_branch(RW.at(1), RW.at(4), RW.at(5), RW.at(7));
+        add_siblings_after(RW.at(5), RW.at(6));
+        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(5), RW.at(6), RW.at(4), RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at subroot node in a left-most subtree.
+ */
+TEST(NtNode, ConstPostorderIteratorStartIsLeftMostSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1---RW2---RW3
+        |
+        RW4
+        |
+        RW5---RW6
+        |
+        RW7
+        */
+        ecu_ntnode_postorder_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_branch(RW.at(1), RW.at(4), RW.at(5), RW.at(7));
+        add_siblings_after(RW.at(5), RW.at(6));
+        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(5), RW.at(6), RW.at(4), RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at subroot node in a middle subtree.
+ */
+TEST(NtNode, PostorderIteratorStartIsMiddleSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW3.
+        RW0
+        |
+        RW1-----RW2-----RW3-----------------RW4
+                |       |                   |
+                RW5     RW6---RW7---RW8     RW9
+                |                   |       |
+                RW10                RW11    RW12
+        
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_branch(RW.at(2), RW.at(5), RW.at(10));
+        add_children(RW.at(3), RW.at(6), RW.at(7), RW.at(8));
+        add_branch(RW.at(4), RW.at(9), RW.at(12));
+        add_children(RW.at(8), RW.at(11));
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(11), RW.at(8), RW.at(3));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at subroot node in a middle subtree.
+ */
+TEST(NtNode, ConstPostorderIteratorStartIsMiddleSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW3.
+        RW0
+        |
+        RW1-----RW2-----RW3-----------------RW4
+                |       |                   |
+                RW5     RW6---RW7---RW8     RW9
+                |                   |       |
+                RW10                RW11    RW12
+        
+        */
+        ecu_ntnode_postorder_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_branch(RW.at(2), RW.at(5), RW.at(10));
+        add_children(RW.at(3), RW.at(6), RW.at(7), RW.at(8));
+        add_branch(RW.at(4), RW.at(9), RW.at(12));
+        add_children(RW.at(8), RW.at(11));
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(11), RW.at(8), RW.at(3));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(3))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at node in a right-most subtree.
+ */
+TEST(NtNode, PostorderIteratorStartIsRightMostSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW4.
+        RW0
+        |
+        RW1-----RW2
+        |       |
+        RW3     RW4
+        |       |
+        RW5     RW6---RW7---RW8
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_branch(RW.at(1), RW.at(3), RW.at(5));
+        add_branch(RW.at(2), RW.at(4), RW.at(6));
+        add_siblings_after(RW.at(6), RW.at(7), RW.at(8));
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(8), RW.at(4));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at node in a right-most subtree.
+ */
+TEST(NtNode, ConstPostorderIteratorStartIsRightMostSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW4.
+        RW0
+        |
+        RW1-----RW2
+        |       |
+        RW3     RW4
+        |       |
+        RW5     RW6---RW7---RW8
+        */
+        ecu_ntnode_postorder_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_branch(RW.at(1), RW.at(3), RW.at(5));
+        add_branch(RW.at(2), RW.at(4), RW.at(6));
+        add_siblings_after(RW.at(6), RW.at(7), RW.at(8));
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(8), RW.at(4));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at a leaf node. Only the leaf
+ * should be returned in the iteration.
+ */
+TEST(NtNode, PostorderIteratorStartIsLeaf)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3---RW4
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3), RW.at(4));
+        EXPECT_NODES_IN_TREE(RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at a leaf node. Only the leaf
+ * should be returned in the iteration.
+ */
+TEST(NtNode, ConstPostorderIteratorStartIsLeaf)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3---RW4
+        */
+        ecu_ntnode_postorder_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3), RW.at(4));
+        EXPECT_NODES_IN_TREE(RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform iteration on empty tree. Only root
+ * node should be returned in the iteration.
+ */
+TEST(NtNode, PostorderIteratorStartIsEmptyRoot)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        */
+        ecu_ntnode_postorder_iterator iter;
+        EXPECT_NODES_IN_TREE(RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Perform iteration on empty tree. Only root
+ * node should be returned in the iteration.
+ */
+TEST(NtNode, ConstPostorderIteratorStartIsEmptyRoot)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at middle node of degenerate tree.
+ */
+TEST(NtNode, PostorderIteratorStartIsMiddleChildInDegenerateTree)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1
+        |
+        RW2
+        |
+        RW3
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at middle node of degenerate tree.
+ */
+TEST(NtNode, ConstPostorderIteratorStartIsMiddleChildInDegenerateTree)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+        RW0
+        |
+        RW1
+        |
+        RW2
+        |
+        RW3
+        */
+        ecu_ntnode_postorder_citerator citer;
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at root node of degenerate tree.
+ */
+TEST(NtNode, PostorderIteratorStartIsRootOfDegenerateTree)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW0.
+        RW0
+        |
+        RW1
+        |
+        RW2
+        |
+        RW3
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at root node of degenerate tree.
+ */
+TEST(NtNode, ConstPostorderIteratorStartIsRootOfDegenerateTree)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW0.
+        RW0
+        |
+        RW1
+        |
+        RW2
+        |
+        RW3
+        */
+        ecu_ntnode_postorder_citerator citer;
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1), RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at root. Remove some nodes.
+ */
+TEST(NtNode, PostorderIteratorRemoveSomeStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RO0.
+
+        Before:
+        RO0
+        |
+        RW0-----RO1-----------------RO2
+                |                   |
+                RW1---RO3           RO4
+                |                   |
+                RO5---RW2---RW3     RW4
+                                    |
+                                    RO6
+        
+        After:
+        RO0             RW0     RW1     RW2     RW3     RW4
+        |                       |                       |
+        RO1-----RO2             RO5                     RO6
+        |       |
+        RO3     RO4
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RO.at(0), RW.at(0), RO.at(1), RO.at(2));
+        add_children(RO.at(1), RW.at(1), RO.at(3));
+        add_children(RW.at(1), RO.at(5), RW.at(2), RW.at(3));
+        add_branch(RO.at(2), RO.at(4), RW.at(4), RO.at(6));
+
+        /* Step 2: Action. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RO.at(0))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_root(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4))) );
+        CHECK_TRUE( (is_descendant(RO.at(5), RO.at(6))) );
+
+        /* Step 3: Assert. Verify tree intact. */
+        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
+        EXPECT_NODES_IN_TREE(RO.at(3), RO.at(1), RO.at(4), RO.at(2), RO.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &RO.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at subroot. Remove some nodes.
+ */
+TEST(NtNode, PostorderIteratorRemoveSomeStartIsSubroot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW1.
+
+        Before:
+        RO0
+        |
+        RW0-----RO1-----------------RO2
+                |                   |
+                RW1---RO3           RO4
+                |                   |
+                RO5---RW2---RW3     RW4
+                                    |
+                                    RO6
+        
+        After:
+        RO0                     RW1     RW2     RW3
+        |                       |
+        RW0-----RO1-----RO2     RO5
+                |       |
+                RO3     RO4
+                        |
+                        RW4
+                        |
+                        RO6
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RO.at(0), RW.at(0), RO.at(1), RO.at(2));
+        add_children(RO.at(1), RW.at(1), RO.at(3));
+        add_children(RW.at(1), RO.at(5), RW.at(2), RW.at(3));
+        add_branch(RO.at(2), RO.at(4), RW.at(4), RO.at(6));
+
+        /* Step 2: Action. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(1))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_root(RW.at(1), RW.at(2), RW.at(3))) );
+        CHECK_TRUE( (is_descendant(RO.at(5))) );
+
+        /* Step 3: Assert. Verify tree intact. */
+        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
+        EXPECT_NODES_IN_TREE(RW.at(0), RO.at(3), RO.at(1), RO.at(6), RW.at(4), RO.at(4), RO.at(2), RO.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &RO.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at root. Remove all nodes.
+ */
+TEST(NtNode, PostorderIteratorRemoveAllStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW0.
+        
+        Before:
+        RW0
+        |
+        RW1---RW2---RW3
+        |           |
+        RW4         RW5-----RW6---RW7
+                            |
+                            RW8
+                            |
+                            RW9-----RW10
+                                    |
+                                    RW11
+        
+        After:
+        All nodes roots.
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(3), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(6), RW.at(8));
+        add_children(RW.at(8), RW.at(9), RW.at(10));
+        add_children(RW.at(10), RW.at(11));
+
+        /* Step 2: Action. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_root(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5),
+                             RW.at(6), RW.at(7), RW.at(8), RW.at(9), RW.at(10), RW.at(11))) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at subroot. Remove all nodes.
+ */
+TEST(NtNode, PostorderIteratorRemoveAllStartIsSubroot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW6.
+        
+        Before:
+        RW0
+        |
+        RW1---RW2---RW3
+        |           |
+        RW4         RW5-----RW6---RW7
+                            |
+                            RW8
+                            |
+                            RW9-----RW10
+                                    |
+                                    RW11
+        
+        After:
+        RW0                     RW6  RW8  RW9  RW10  RW11
+        |
+        RW1---RW2---RW3
+        |           |
+        RW4         RW5---RW7
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(3), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(6), RW.at(8));
+        add_children(RW.at(8), RW.at(9), RW.at(10));
+        add_children(RW.at(10), RW.at(11));
+
+        /* Step 2: Action. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(6))
+        {
+            convert(n).accept(node_remove_visitor);
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (is_root(RW.at(6), RW.at(8), RW.at(9), RW.at(10), RW.at(11))) );
+
+        /* Step 3: Assert. Verify tree intact. */
+        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(2), RW.at(5), RW.at(7), RW.at(3), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at root. Destroy some nodes.
+ */
+TEST(NtNode, PostorderIteratorDestroySomeStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW0.
+        
+        Before:
+        RW0
+        |
+        RW1---DN0---RW2
+        |           |
+        DN1         RW3-----RW4---RW5
+                            |
+                            DN2
+                            |
+                            RW6-----RW7
+                                    |
+                                    RW8
+        
+        After:
+        RW0
+        |
+        RW1-----RW2
+                |
+                RW3---RW4---RW5
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), DN.at(0), RW.at(2));
+        add_children(RW.at(1), DN.at(1));
+        add_children(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
+        add_children(RW.at(4), DN.at(2));
+        add_children(DN.at(2), RW.at(6), RW.at(7));
+        add_children(RW.at(7), RW.at(8));
+        EXPECT_NODES_DESTROYED(DN.at(1), DN.at(0), DN.at(2), RW.at(6), RW.at(7), RW.at(8));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree still intact. */
+        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
+        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(3), RW.at(4), RW.at(5), RW.at(2), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at subroot. Destroy some nodes.
+ */
+TEST(NtNode, PostorderIteratorDestroySomeStartIsSubroot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at RW2.
+        
+        Before:
+        RW0
+        |
+        RW1---DN0---RW2
+        |           |
+        DN1         DN2-----RW3---DN3
+                            |
+                            DN4-----RW4
+                            |
+                            RW5-----RW6
+                                    |
+                                    RW7
+        
+        After:
+        RW0
+        |
+        RW1---DN0---RW2
+        |           |
+        DN1         RW3
+                    |
+                    RW4
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), DN.at(0), RW.at(2));
+        add_children(RW.at(1), DN.at(1));
+        add_children(RW.at(2), DN.at(2), RW.at(3), DN.at(3));
+        add_children(RW.at(3), DN.at(4), RW.at(4));
+        add_children(DN.at(4), RW.at(5), RW.at(6));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_DESTROYED(DN.at(2), DN.at(3), DN.at(4), RW.at(5), RW.at(6), RW.at(7));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(2))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree still intact. */
+        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
+        EXPECT_NODES_IN_TREE(DN.at(1), RW.at(1), DN.at(0), RW.at(4), RW.at(3), RW.at(2), RW.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at root. Destroy all nodes.
+ */
+TEST(NtNode, PostorderIteratorDestroyAllStartIsRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at DN0.
+        
+        Before:
+        DN0
+        |
+        DN1---DN2---DN3
+        |           |
+        DN4         DN5-----DN6---DN7
+                            |
+                            DN8
+                            |
+                            DN9-----DN10
+                                    |
+                                    DN11
+        
+        After:
+        All nodes destroyed.
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(DN.at(0), DN.at(1), DN.at(2), DN.at(3));
+        add_children(DN.at(1), DN.at(4));
+        add_children(DN.at(3), DN.at(5), DN.at(6), DN.at(7));
+        add_children(DN.at(6), DN.at(8));
+        add_children(DN.at(8), DN.at(9), DN.at(10));
+        add_children(DN.at(10), DN.at(11));
+        EXPECT_NODES_DESTROYED(DN.at(0), DN.at(1), DN.at(2), DN.at(3), DN.at(4), DN.at(5), DN.at(6),
+                               DN.at(7), DN.at(8), DN.at(9), DN.at(10), DN.at(11));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &DN.at(0))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at subroot. Destroy all nodes.
+ */
+TEST(NtNode, PostorderIteratorDestroyAllStartIsSubroot)
+{
+    try
+    {
+        /* Step 1: Arrange. Start iteration at DN6.
+        
+        Before:
+        DN0
+        |
+        DN1---DN2---DN3
+        |           |
+        DN4         DN5-----DN6---DN7
+                            |
+                            DN8
+                            |
+                            DN9-----DN10
+                                    |
+                                    DN11
+        
+        After:
+        DN0
+        |
+        DN1---DN2---DN3
+        |           |
+        DN4         DN5---DN7
+        */
+        ecu_ntnode_postorder_iterator iter;
+        add_children(DN.at(0), DN.at(1), DN.at(2), DN.at(3));
+        add_children(DN.at(1), DN.at(4));
+        add_children(DN.at(3), DN.at(5), DN.at(6), DN.at(7));
+        add_children(DN.at(6), DN.at(8));
+        add_children(DN.at(8), DN.at(9), DN.at(10));
+        add_children(DN.at(10), DN.at(11));
+        EXPECT_NODES_DESTROYED(DN.at(6), DN.at(8), DN.at(9), DN.at(10), DN.at(11));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &DN.at(6))
+        {
+            convert(n).accept(node_destroy_visitor);
+        }
+
+        /* Step 3: Assert. Verify remaining tree intact. */
+        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
+        EXPECT_NODES_IN_TREE(DN.at(4), DN.at(1), DN.at(2), DN.at(5), DN.at(7), DN.at(3), DN.at(0));
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &DN.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling next() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, PostorderIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_postorder_iterator iter;
+        EXPECT_ASSERTION();
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_postorder_iterator_next(&iter);
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Calling cnext() after an iteration is finished
+ * is not allowed.
+ */
+TEST(NtNode, ConstPostorderIteratorNextAfterDone)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_ASSERTION();
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            (void)n;
+        }
+        (void)ecu_ntnode_postorder_iterator_cnext(&citer);
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, PostorderIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_postorder_iterator iter;
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
+        CHECK_TRUE( (is_root(RW.at(0))) ); /* Precondition. */
+        
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Iteration can be conducted multiple times in a row.
+ */
+TEST(NtNode, ConstPostorderIteratorMultipleTimes)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntnode_postorder_citerator citer;
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
+        CHECK_TRUE( (is_root(RW.at(0))) ); /* Precondition. */
+        
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------ TESTS - PREORDER ITERATOR ---------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief General iteration test. Verify all nodes iterated
+ * over.
+ */
+TEST(NtNode, PreorderIterator)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2---RW3-------RW4
+        |       |               |
+        RW5     RW6-----RW7     RW8
+        |               |
+        RW9             RW10---RW11
+        |               |
+        RW12            RW13
+        |
+        RW14
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_branch(RW.at(1), RW.at(5), RW.at(9), RW.at(12), RW.at(14));
+        add_children(RW.at(2), RW.at(6), RW.at(7));
+        add_children(RW.at(4), RW.at(8));
+        add_children(RW.at(7), RW.at(10), RW.at(11));
+        add_children(RW.at(10), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(5), RW.at(9), RW.at(12), RW.at(14),
+                             RW.at(2), RW.at(6), RW.at(7), RW.at(10), RW.at(13),
+                             RW.at(11), RW.at(3), RW.at(4), RW.at(8));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General iteration test. Verify all nodes iterated
+ * over.
+ */
+TEST(NtNode, ConstPreorderIterator)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-----RW2---RW3-------RW4
+        |       |               |
+        RW5     RW6-----RW7     RW8
+        |               |
+        RW9             RW10---RW11
+        |               |
+        RW12            RW13
+        |
+        RW14
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_branch(RW.at(1), RW.at(5), RW.at(9), RW.at(12), RW.at(14));
+        add_children(RW.at(2), RW.at(6), RW.at(7));
+        add_children(RW.at(4), RW.at(8));
+        add_children(RW.at(7), RW.at(10), RW.at(11));
+        add_children(RW.at(10), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(5), RW.at(9), RW.at(12), RW.at(14),
+                             RW.at(2), RW.at(6), RW.at(7), RW.at(10), RW.at(13),
+                             RW.at(11), RW.at(3), RW.at(4), RW.at(8));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_preorder_citerator citer;
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General iteration test. Verify all nodes iterated
+ * over.
+ */
+TEST(NtNode, PreorderIterator2)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---------------------------------RW2---RW3
+        |                                   |
+        RW4-------------------------RW5     RW6
+        |                           |
+        RW7-----RW8---RW9           RW10----RW11
+        |       |                           |
+        RW12    RW13                        RW14----RW15
+                                                    |
+                                                    RW16
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
+        add_children(RW.at(5), RW.at(10), RW.at(11));
+        add_children(RW.at(7), RW.at(12));
+        add_children(RW.at(8), RW.at(13));
+        add_children(RW.at(11), RW.at(14), RW.at(15));
+        add_children(RW.at(15), RW.at(16));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(7), RW.at(12), RW.at(8), RW.at(13),
+                             RW.at(9), RW.at(5), RW.at(10), RW.at(11), RW.at(14), RW.at(15), RW.at(16),
+                             RW.at(2), RW.at(6), RW.at(3));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief General iteration test. Verify all nodes iterated
+ * over.
+ */
+TEST(NtNode, ConstPreorderIterator2)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---------------------------------RW2---RW3
+        |                                   |
+        RW4-------------------------RW5     RW6
+        |                           |
+        RW7-----RW8---RW9           RW10----RW11
+        |       |                           |
+        RW12    RW13                        RW14----RW15
+                                                    |
+                                                    RW16
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
+        add_children(RW.at(5), RW.at(10), RW.at(11));
+        add_children(RW.at(7), RW.at(12));
+        add_children(RW.at(8), RW.at(13));
+        add_children(RW.at(11), RW.at(14), RW.at(15));
+        add_children(RW.at(15), RW.at(16));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(7), RW.at(12), RW.at(8), RW.at(13),
+                             RW.at(9), RW.at(5), RW.at(10), RW.at(11), RW.at(14), RW.at(15), RW.at(16),
+                             RW.at(2), RW.at(6), RW.at(3));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_preorder_citerator citer;
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at node in a left-most subtree.
+ */
+TEST(NtNode, PreorderIteratorStartIsLeftMostSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---------------------------------RW2---RW3
+        |                                   |
+        RW4-------------------------RW5     RW6
+        |                           |
+        RW7-----RW8---RW9           RW10
+        |       |
+        RW11    RW12
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
+        add_children(RW.at(5), RW.at(10));
+        add_children(RW.at(7), RW.at(11));
+        add_children(RW.at(8), RW.at(12));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(7), RW.at(11), RW.at(8), RW.at(12), RW.at(9));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at node in a left-most subtree.
+ */
+TEST(NtNode, ConstPreorderIteratorStartIsLeftMostSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---------------------------------RW2---RW3
+        |                                   |
+        RW4-------------------------RW5     RW6
+        |                           |
+        RW7-----RW8---RW9           RW10
+        |       |
+        RW11    RW12
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
+        add_children(RW.at(5), RW.at(10));
+        add_children(RW.at(7), RW.at(11));
+        add_children(RW.at(8), RW.at(12));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(7), RW.at(11), RW.at(8), RW.at(12), RW.at(9));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_preorder_citerator citer;
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(4))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at node in a middle subtree.
+ */
+TEST(NtNode, PreorderIteratorStartIsMiddleSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---------------------------------RW2---RW3
+        |                                   |
+        RW4-------------------------RW5     RW6
+        |                           |
+        RW7-----RW8---RW9           RW10----RW11
+        |       |                           |
+        RW12    RW13                        RW14----RW15
+                                                    |
+                                                    RW16
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
+        add_children(RW.at(5), RW.at(10), RW.at(11));
+        add_children(RW.at(7), RW.at(12));
+        add_children(RW.at(8), RW.at(13));
+        add_children(RW.at(11), RW.at(14), RW.at(15));
+        add_children(RW.at(15), RW.at(16));
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(10), RW.at(11), RW.at(14), RW.at(15), RW.at(16));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(5))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at node in a middle subtree.
+ */
+TEST(NtNode, ConstPreorderIteratorStartIsMiddleSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1---------------------------------RW2---RW3
+        |                                   |
+        RW4-------------------------RW5     RW6
+        |                           |
+        RW7-----RW8---RW9           RW10----RW11
+        |       |                           |
+        RW12    RW13                        RW14----RW15
+                                                    |
+                                                    RW16
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5));
+        add_children(RW.at(2), RW.at(6));
+        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
+        add_children(RW.at(5), RW.at(10), RW.at(11));
+        add_children(RW.at(7), RW.at(12));
+        add_children(RW.at(8), RW.at(13));
+        add_children(RW.at(11), RW.at(14), RW.at(15));
+        add_children(RW.at(15), RW.at(16));
+        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(10), RW.at(11), RW.at(14), RW.at(15), RW.at(16));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_preorder_citerator citer;
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(5))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Start iteration at node in a right-most subtree.
+ */
+TEST(NtNode, PreorderIteratorStartIsRightMostSubtree)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-------------RW2
+        |               |
+        RW3-----RW4     RW5---RW6
+                |       |
+                RW7     RW8---RW9
+                        |
+                        RW10----RW11
+                        |       |
+                        RW12    RW13
+                                |
+                                RW14
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6));
+        add_children(RW.at(4), RW.at(7));
+        add_children(RW.at(5), RW.at(8), RW.at(9));
+        add_children(RW.at(8), RW.at(10), RW.at(11));
+        add_children(RW.at(10), RW.at(12));
+        add_branch(RW.at(11), RW.at(13), RW.at(14));
+        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(5), RW.at(8), RW.at(10), RW.at(12), RW.at(11),
+                             RW.at(13), RW.at(14), RW.at(9), RW.at(6));
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(2))
         {
-            (void)n;
+            convert(n).accept(node_obj_in_tree_visitor);
         }
-        (void)ecu_ntnode_parent_iterator_next(&iter);
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Calling cnext() after an iteration is finished
- * is not allowed.
+ * @brief Start iteration at node in a right-most subtree.
  */
-TEST(NtNode, ConstParentIteratorNextAfterDone)
+TEST(NtNode, ConstPreorderIteratorStartIsRightMostSubtree)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_parent_citerator citer;
-        EXPECT_ASSERTION();
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1-------------RW2
+        |               |
+        RW3-----RW4     RW5---RW6
+                |       |
+                RW7     RW8---RW9
+                        |
+                        RW10----RW11
+                        |       |
+                        RW12    RW13
+                                |
+                                RW14
+        */
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(1), RW.at(3), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6));
+        add_children(RW.at(4), RW.at(7));
+        add_children(RW.at(5), RW.at(8), RW.at(9));
+        add_children(RW.at(8), RW.at(10), RW.at(11));
+        add_children(RW.at(10), RW.at(12));
+        add_branch(RW.at(11), RW.at(13), RW.at(14));
+        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(5), RW.at(8), RW.at(10), RW.at(12), RW.at(11),
+                             RW.at(13), RW.at(14), RW.at(9), RW.at(6));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(0))
+        ecu_ntnode_preorder_citerator citer;
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(2))
         {
-            (void)n;
+            convert(n).accept(node_obj_in_tree_visitor);
         }
-        (void)ecu_ntnode_parent_iterator_cnext(&citer);
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Start iteration at a leaf node. Only the leaf
+ * should be returned in the iteration.
  */
-TEST(NtNode, ParentIteratorMultipleTimes)
+TEST(NtNode, PreorderIteratorStartIsLeaf)
 {
     try
     {
-        /* Step 1: Arrange. 
+        /* Step 1: Arrange.
         RW0
         |
-        RW1
+        RW1---RW2
         */
-        ecu_ntnode_parent_iterator iter;
-        add_children(RW.at(0), RW.at(1));
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        EXPECT_NODES_IN_TREE(RW.at(1));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_PARENT_FOR_EACH(n, &iter, &RW.at(1))
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(1))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -7856,31 +13352,24 @@ TEST(NtNode, ParentIteratorMultipleTimes)
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Start iteration at a leaf node. Only the leaf
+ * should be returned in the iteration.
  */
-TEST(NtNode, ConstParentIteratorMultipleTimes)
+TEST(NtNode, ConstPreorderIteratorStartIsLeaf)
 {
     try
     {
-        /* Step 1: Arrange. 
+        /* Step 1: Arrange.
         RW0
         |
-        RW1
+        RW1---RW2
         */
-        ecu_ntnode_parent_citerator citer;
-        add_children(RW.at(0), RW.at(1));
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        EXPECT_NODES_IN_TREE(RW.at(1));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(1))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_PARENT_FOR_EACH(n, &citer, &RW.at(1))
+        ecu_ntnode_preorder_citerator citer;
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(1))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -7892,45 +13381,21 @@ TEST(NtNode, ConstParentIteratorMultipleTimes)
     }
 }
 
-/*------------------------------------------------------------*/
-/*----------------- TESTS - POSTORDER ITERATOR ---------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief General iteration test. Start at root. 
- * Verify all nodes iterated over.
+ * @brief Perform iteration on empty tree. Only root
+ * node should be returned in the iteration.
  */
-TEST(NtNode, PostorderIterator)
+TEST(NtNode, PreorderIteratorStartIsEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange. 
-        RW0
-        |
-        RW1-------------------------RW2---------------------RW3
-        |                           |                       |
-        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
-                    |               |                       |
-                    RW12            RW13                    RW14
-                    |                                       |
-                    RW15                                    RW16
-                                                            |
-                                                            RW17
-        */
-        ecu_ntnode_postorder_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
-        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
-        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
-        add_branch(RW.at(6), RW.at(12), RW.at(15));
-        add_children(RW.at(8), RW.at(13));
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(15), RW.at(12), RW.at(6), 
-                             RW.at(7), RW.at(1), RW.at(13), RW.at(8), RW.at(9), 
-                             RW.at(10), RW.at(2), RW.at(17), RW.at(16), RW.at(14), 
-                             RW.at(11), RW.at(3), RW.at(0));
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        EXPECT_NODES_IN_TREE(empty_root);
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &empty_root)
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -7943,40 +13408,20 @@ TEST(NtNode, PostorderIterator)
 }
 
 /**
- * @brief General iteration test. Start at root.
- * Verify all nodes iterated over.
+ * @brief Perform iteration on empty tree. Only root
+ * node should be returned in the iteration.
  */
-TEST(NtNode, ConstPostorderIterator)
+TEST(NtNode, ConstPreorderIteratorStartIsEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange. 
-        RW0
-        |
-        RW1-------------------------RW2---------------------RW3
-        |                           |                       |
-        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
-                    |               |                       |
-                    RW12            RW13                    RW14
-                    |                                       |
-                    RW15                                    RW16
-                                                            |
-                                                            RW17
-        */
-        ecu_ntnode_postorder_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
-        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
-        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
-        add_branch(RW.at(6), RW.at(12), RW.at(15));
-        add_children(RW.at(8), RW.at(13));
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(15), RW.at(12), RW.at(6), 
-                             RW.at(7), RW.at(1), RW.at(13), RW.at(8), RW.at(9), 
-                             RW.at(10), RW.at(2), RW.at(17), RW.at(16), RW.at(14), 
-                             RW.at(11), RW.at(3), RW.at(0));
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        EXPECT_NODES_IN_TREE(empty_root);
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        ecu_ntnode_preorder_citerator citer;
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &empty_root)
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -7989,31 +13434,29 @@ TEST(NtNode, ConstPostorderIterator)
 }
 
 /**
- * @brief Start iteration at subroot node in a left-most subtree.
+ * @brief Start iteration at middle node of degenerate tree.
  */
-TEST(NtNode, PostorderIteratorStartIsLeftMostSubtree)
+TEST(NtNode, PreorderIteratorStartIsMiddleChildInDegenerateTree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2---RW3
+        RW1
         |
-        RW4
+        RW2
         |
-        RW5---RW6
+        RW3
         |
-        RW7
+        RW4
         */
-        ecu_ntnode_postorder_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_branch(RW.at(1), RW.at(4), RW.at(5), RW.at(7));
-        add_siblings_after(RW.at(5), RW.at(6));
-        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(5), RW.at(6), RW.at(4), RW.at(1));
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(3), RW.at(4));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(1))
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(2))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8026,31 +13469,29 @@ TEST(NtNode, PostorderIteratorStartIsLeftMostSubtree)
 }
 
 /**
- * @brief Start iteration at subroot node in a left-most subtree.
+ * @brief Start iteration at middle node of degenerate tree.
  */
-TEST(NtNode, ConstPostorderIteratorStartIsLeftMostSubtree)
+TEST(NtNode, ConstPreorderIteratorStartIsMiddleChildInDegenerateTree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1---RW2---RW3
+        RW1
         |
-        RW4
+        RW2
         |
-        RW5---RW6
+        RW3
         |
-        RW7
+        RW4
         */
-        ecu_ntnode_postorder_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_branch(RW.at(1), RW.at(4), RW.at(5), RW.at(7));
-        add_siblings_after(RW.at(5), RW.at(6));
-        EXPECT_NODES_IN_TREE(RW.at(7), RW.at(5), RW.at(6), RW.at(4), RW.at(1));
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(3), RW.at(4));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
+        ecu_ntnode_preorder_citerator citer;
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(2))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8063,32 +13504,29 @@ TEST(NtNode, ConstPostorderIteratorStartIsLeftMostSubtree)
 }
 
 /**
- * @brief Start iteration at subroot node in a middle subtree.
+ * @brief Start iteration at root node of degenerate tree.
  */
-TEST(NtNode, PostorderIteratorStartIsMiddleSubtree)
+TEST(NtNode, PreorderIteratorStartIsRootOfDegenerateTree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW3.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW3-----------------RW4
-                |       |                   |
-                RW5     RW6---RW7---RW8     RW9
-                |                   |       |
-                RW10                RW11    RW12
-        
+        RW1
+        |
+        RW2
+        |
+        RW3
+        |
+        RW4
         */
-        ecu_ntnode_postorder_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_branch(RW.at(2), RW.at(5), RW.at(10));
-        add_children(RW.at(3), RW.at(6), RW.at(7), RW.at(8));
-        add_branch(RW.at(4), RW.at(9), RW.at(12));
-        add_children(RW.at(8), RW.at(11));
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(11), RW.at(8), RW.at(3));
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(3))
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8101,32 +13539,29 @@ TEST(NtNode, PostorderIteratorStartIsMiddleSubtree)
 }
 
 /**
- * @brief Start iteration at subroot node in a middle subtree.
+ * @brief Start iteration at root node of degenerate tree.
  */
-TEST(NtNode, ConstPostorderIteratorStartIsMiddleSubtree)
+TEST(NtNode, ConstPreorderIteratorStartIsRootOfDegenerateTree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW3.
+        /* Step 1: Arrange.
         RW0
         |
-        RW1-----RW2-----RW3-----------------RW4
-                |       |                   |
-                RW5     RW6---RW7---RW8     RW9
-                |                   |       |
-                RW10                RW11    RW12
-        
+        RW1
+        |
+        RW2
+        |
+        RW3
+        |
+        RW4
         */
-        ecu_ntnode_postorder_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_branch(RW.at(2), RW.at(5), RW.at(10));
-        add_children(RW.at(3), RW.at(6), RW.at(7), RW.at(8));
-        add_branch(RW.at(4), RW.at(9), RW.at(12));
-        add_children(RW.at(8), RW.at(11));
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(11), RW.at(8), RW.at(3));
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(3))
+        ecu_ntnode_preorder_citerator citer;
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8139,159 +13574,170 @@ TEST(NtNode, ConstPostorderIteratorStartIsMiddleSubtree)
 }
 
 /**
- * @brief Start iteration at node in a right-most subtree.
+ * @brief Removing nodes is not allowed in a preorder iteration
+ * since it will corrupt the current iteration.
  */
-TEST(NtNode, PostorderIteratorStartIsRightMostSubtree)
+TEST(NtNode, PreorderIteratorRemoveNodeInNonEmptyTree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW4.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1-----RW2
-        |       |
-        RW3     RW4
-        |       |
-        RW5     RW6---RW7---RW8
+        RW1---RW2
         */
-        ecu_ntnode_postorder_iterator iter;
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_branch(RW.at(1), RW.at(3), RW.at(5));
-        add_branch(RW.at(2), RW.at(4), RW.at(6));
-        add_siblings_after(RW.at(6), RW.at(7), RW.at(8));
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(8), RW.at(4));
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(4))
+        /* Step 2: Action. */
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            ntnode *node = &convert(n);
+            if (node == &RW.at(2))
+            {
+                ecu_ntnode_remove(node);
+            }
         }
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Start iteration at node in a right-most subtree.
+ * @brief Destroying nodes is not allowed in a preorder iteration
+ * since it will corrupt the current iteration.
  */
-TEST(NtNode, ConstPostorderIteratorStartIsRightMostSubtree)
+TEST(NtNode, PreorderIteratorDestroyNodeInNonEmptyTree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW4.
+        /* Step 1: Arrange. N used to make destroy callback unused.
         RW0
         |
-        RW1-----RW2
-        |       |
-        RW3     RW4
-        |       |
-        RW5     RW6---RW7---RW8
+        N----RW1
         */
-        ecu_ntnode_postorder_citerator citer;
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_branch(RW.at(1), RW.at(3), RW.at(5));
-        add_branch(RW.at(2), RW.at(4), RW.at(6));
-        add_siblings_after(RW.at(6), RW.at(7), RW.at(8));
-        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(8), RW.at(4));
+        rw_ntnode N{ECU_NTNODE_DESTROY_UNUSED};
+        add_children(RW.at(0), N, RW.at(2));
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(4))
+        /* Step 2: Action. */
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            ntnode *node = &convert(n);
+            if (node == &N)
+            {
+                ecu_ntnode_destroy(&N);
+            }
         }
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Start iteration at a leaf node. Only the leaf
- * should be returned in the iteration.
+ * @brief Calling next() after an iteration is finished
+ * is not allowed.
  */
-TEST(NtNode, PostorderIteratorStartIsLeaf)
+TEST(NtNode, PreorderIteratorNextAfterDone)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1-----RW2
-                |
-                RW3---RW4
+        RW1---RW2
         */
-        ecu_ntnode_postorder_iterator iter;
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3), RW.at(4));
-        EXPECT_NODES_IN_TREE(RW.at(1));
-
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(1))
+        ecu_ntnode_preorder_iterator iter;
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            (void)n;
         }
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntnode_preorder_iterator_next(&iter);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Start iteration at a leaf node. Only the leaf
- * should be returned in the iteration.
+ * @brief Calling cnext() after an iteration is finished
+ * is not allowed.
  */
-TEST(NtNode, ConstPostorderIteratorStartIsLeaf)
+TEST(NtNode, ConstPreorderIteratorNextAfterDone)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1-----RW2
-                |
-                RW3---RW4
+        RW1---RW2
         */
-        ecu_ntnode_postorder_citerator citer;
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(2), RW.at(3), RW.at(4));
-        EXPECT_NODES_IN_TREE(RW.at(1));
-
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
+        ecu_ntnode_preorder_citerator citer;
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            (void)n;
         }
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntnode_preorder_iterator_cnext(&citer);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Perform iteration on empty tree. Only root
- * node should be returned in the iteration.
+ * @brief Iteration can be conducted multiple times in a row.
  */
-TEST(NtNode, PostorderIteratorStartIsEmptyRoot)
+TEST(NtNode, PreorderIteratorMultipleTimes)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
+        |
+        RW1
         */
-        ecu_ntnode_postorder_iterator iter;
-        EXPECT_NODES_IN_TREE(RW.at(0));
+        add_children(RW.at(0), RW.at(1));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(0), RW.at(1), RW.at(0), RW.at(1));
+        ecu_ntnode_preorder_iterator iter;
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8304,21 +13750,31 @@ TEST(NtNode, PostorderIteratorStartIsEmptyRoot)
 }
 
 /**
- * @brief Perform iteration on empty tree. Only root
- * node should be returned in the iteration.
+ * @brief Iteration can be conducted multiple times in a row.
  */
-TEST(NtNode, ConstPostorderIteratorStartIsEmptyRoot)
+TEST(NtNode, ConstPreorderIteratorMultipleTimes)
 {
     try
     {
         /* Step 1: Arrange.
         RW0
+        |
+        RW1
         */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(0));
+        add_children(RW.at(0), RW.at(1));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(0), RW.at(1), RW.at(0), RW.at(1));
+        ecu_ntnode_preorder_citerator citer;
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
+        {
+            convert(n).accept(node_obj_in_tree_visitor);
+        }
+        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8330,28 +13786,45 @@ TEST(NtNode, ConstPostorderIteratorStartIsEmptyRoot)
     }
 }
 
+/*------------------------------------------------------------*/
+/*----------------- TESTS - COMPACT ITERATORS ----------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Start iteration at middle node of degenerate tree.
+ * @brief General iteration test. Start at root.
+ * Verify all nodes iterated over.
  */
-TEST(NtNode, PostorderIteratorStartIsMiddleChildInDegenerateTree)
+TEST(NtNode, CompactPostorderIterator)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1
-        |
-        RW2
-        |
-        RW3
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
-        ecu_ntnode_postorder_iterator iter;
-        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1));
+        ecu_ntnode_compact_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(15), RW.at(12), RW.at(6), 
+                             RW.at(7), RW.at(1), RW.at(13), RW.at(8), RW.at(9), 
+                             RW.at(10), RW.at(2), RW.at(17), RW.at(16), RW.at(14), 
+                             RW.at(11), RW.at(3), RW.at(0));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(1))
+        ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8364,27 +13837,40 @@ TEST(NtNode, PostorderIteratorStartIsMiddleChildInDegenerateTree)
 }
 
 /**
- * @brief Start iteration at middle node of degenerate tree.
+ * @brief General iteration test. Start at root.
+ * Verify all nodes iterated over.
  */
-TEST(NtNode, ConstPostorderIteratorStartIsMiddleChildInDegenerateTree)
+TEST(NtNode, ConstCompactPostorderIterator)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1
-        |
-        RW2
-        |
-        RW3
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
-        ecu_ntnode_postorder_citerator citer;
-        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1));
+        ecu_ntnode_compact_postorder_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(5), RW.at(15), RW.at(12), RW.at(6), 
+                             RW.at(7), RW.at(1), RW.at(13), RW.at(8), RW.at(9), 
+                             RW.at(10), RW.at(2), RW.at(17), RW.at(16), RW.at(14), 
+                             RW.at(11), RW.at(3), RW.at(0));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(1))
+        ECU_NTNODE_CONST_COMPACT_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8397,27 +13883,34 @@ TEST(NtNode, ConstPostorderIteratorStartIsMiddleChildInDegenerateTree)
 }
 
 /**
- * @brief Start iteration at root node of degenerate tree.
+ * @brief Start iteration at subroot node in a middle subtree.
+ * Iteration must end at the subroot even though it has
+ * siblings and a parent.
  */
-TEST(NtNode, PostorderIteratorStartIsRootOfDegenerateTree)
+TEST(NtNode, CompactPostorderIteratorStartIsMiddleSubtree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW0.
+        /* Step 1: Arrange. Start iteration at RW3.
         RW0
         |
-        RW1
-        |
-        RW2
-        |
-        RW3
+        RW1-----RW2-----RW3-----------------RW4
+                |       |                   |
+                RW5     RW6---RW7---RW8     RW9
+                |                   |       |
+                RW10                RW11    RW12
+        
         */
-        ecu_ntnode_postorder_iterator iter;
-        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1), RW.at(0));
+        ecu_ntnode_compact_postorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_branch(RW.at(2), RW.at(5), RW.at(10));
+        add_children(RW.at(3), RW.at(6), RW.at(7), RW.at(8));
+        add_branch(RW.at(4), RW.at(9), RW.at(12));
+        add_children(RW.at(8), RW.at(11));
+        EXPECT_NODES_IN_TREE(RW.at(6), RW.at(7), RW.at(11), RW.at(8), RW.at(3));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(n, &iter, &RW.at(3))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8430,27 +13923,20 @@ TEST(NtNode, PostorderIteratorStartIsRootOfDegenerateTree)
 }
 
 /**
- * @brief Start iteration at root node of degenerate tree.
+ * @brief Perform iteration on empty tree. Only root
+ * node should be returned in the iteration.
  */
-TEST(NtNode, ConstPostorderIteratorStartIsRootOfDegenerateTree)
+TEST(NtNode, CompactPostorderIteratorStartIsEmptyRoot)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW0.
-        RW0
-        |
-        RW1
-        |
-        RW2
-        |
-        RW3
-        */
-        ecu_ntnode_postorder_citerator citer;
-        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(2), RW.at(1), RW.at(0));
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        EXPECT_NODES_IN_TREE(empty_root);
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        ecu_ntnode_compact_postorder_iterator iter;
+        ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(n, &iter, &empty_root)
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8465,7 +13951,7 @@ TEST(NtNode, ConstPostorderIteratorStartIsRootOfDegenerateTree)
 /**
  * @brief Start iteration at root. Remove some nodes.
  */
-TEST(NtNode, PostorderIteratorRemoveSomeStartIsRoot)
+TEST(NtNode, CompactPostorderIteratorRemoveSomeStartIsRoot)
 {
     try
     {
@@ -8489,14 +13975,14 @@ TEST(NtNode, PostorderIteratorRemoveSomeStartIsRoot)
         |       |
         RO3     RO4
         */
-        ecu_ntnode_postorder_iterator iter;
+        ecu_ntnode_compact_postorder_iterator iter;
         add_children(RO.at(0), RW.at(0), RO.at(1), RO.at(2));
         add_children(RO.at(1), RW.at(1), RO.at(3));
         add_children(RW.at(1), RO.at(5), RW.at(2), RW.at(3));
         add_branch(RO.at(2), RO.at(4), RW.at(4), RO.at(6));
 
         /* Step 2: Action. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RO.at(0))
+        ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(n, &iter, &RO.at(0))
         {
             convert(n).accept(node_remove_visitor);
         }
@@ -8506,9 +13992,9 @@ TEST(NtNode, PostorderIteratorRemoveSomeStartIsRoot)
         CHECK_TRUE( (is_descendant(RO.at(5), RO.at(6))) );
 
         /* Step 3: Assert. Verify tree intact. */
-        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
+        ecu_ntnode_compact_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
         EXPECT_NODES_IN_TREE(RO.at(3), RO.at(1), RO.at(4), RO.at(2), RO.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &RO.at(0))
+        ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(n, &iter2, &RO.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8521,58 +14007,44 @@ TEST(NtNode, PostorderIteratorRemoveSomeStartIsRoot)
 }
 
 /**
- * @brief Start iteration at subroot. Remove some nodes.
+ * @brief Start iteration at root. Destroy all nodes.
  */
-TEST(NtNode, PostorderIteratorRemoveSomeStartIsSubroot)
+TEST(NtNode, CompactPostorderIteratorDestroyAllStartIsRoot)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW1.
-
+        /* Step 1: Arrange. Start iteration at DN0.
+        
         Before:
-        RO0
+        DN0
         |
-        RW0-----RO1-----------------RO2
-                |                   |
-                RW1---RO3           RO4
-                |                   |
-                RO5---RW2---RW3     RW4
+        DN1---DN2---DN3
+        |           |
+        DN4         DN5-----DN6---DN7
+                            |
+                            DN8
+                            |
+                            DN9-----DN10
                                     |
-                                    RO6
+                                    DN11
         
         After:
-        RO0                     RW1     RW2     RW3
-        |                       |
-        RW0-----RO1-----RO2     RO5
-                |       |
-                RO3     RO4
-                        |
-                        RW4
-                        |
-                        RO6
+        All nodes destroyed.
         */
-        ecu_ntnode_postorder_iterator iter;
-        add_children(RO.at(0), RW.at(0), RO.at(1), RO.at(2));
-        add_children(RO.at(1), RW.at(1), RO.at(3));
-        add_children(RW.at(1), RO.at(5), RW.at(2), RW.at(3));
-        add_branch(RO.at(2), RO.at(4), RW.at(4), RO.at(6));
-
-        /* Step 2: Action. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(1))
-        {
-            convert(n).accept(node_remove_visitor);
-        }
-
-        /* Step 3: Assert. */
-        CHECK_TRUE( (is_root(RW.at(1), RW.at(2), RW.at(3))) );
-        CHECK_TRUE( (is_descendant(RO.at(5))) );
+        ecu_ntnode_compact_postorder_iterator iter;
+        add_children(DN.at(0), DN.at(1), DN.at(2), DN.at(3));
+        add_children(DN.at(1), DN.at(4));
+        add_children(DN.at(3), DN.at(5), DN.at(6), DN.at(7));
+        add_children(DN.at(6), DN.at(8));
+        add_children(DN.at(8), DN.at(9), DN.at(10));
+        add_children(DN.at(10), DN.at(11));
+        EXPECT_NODES_DESTROYED(DN.at(0), DN.at(1), DN.at(2), DN.at(3), DN.at(4), DN.at(5), DN.at(6),
+                               DN.at(7), DN.at(8), DN.at(9), DN.at(10), DN.at(11));
 
-        /* Step 3: Assert. Verify tree intact. */
-        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
-        EXPECT_NODES_IN_TREE(RW.at(0), RO.at(3), RO.at(1), RO.at(6), RW.at(4), RO.at(4), RO.at(2), RO.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &RO.at(0))
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(n, &iter, &DN.at(0))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            convert(n).accept(node_destroy_visitor);
         }
     }
     catch (const AssertException& e)
@@ -8583,105 +14055,119 @@ TEST(NtNode, PostorderIteratorRemoveSomeStartIsSubroot)
 }
 
 /**
- * @brief Start iteration at root. Remove all nodes.
+ * @brief Calling next() after an iteration is finished
+ * is not allowed.
  */
-TEST(NtNode, PostorderIteratorRemoveAllStartIsRoot)
+TEST(NtNode, CompactPostorderIteratorNextAfterDone)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW0.
-        
-        Before:
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1---RW2---RW3
-        |           |
-        RW4         RW5-----RW6---RW7
-                            |
-                            RW8
-                            |
-                            RW9-----RW10
-                                    |
-                                    RW11
-        
-        After:
-        All nodes roots.
+        RW1---RW2
         */
-        ecu_ntnode_postorder_iterator iter;
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(3), RW.at(5), RW.at(6), RW.at(7));
-        add_children(RW.at(6), RW.at(8));
-        add_children(RW.at(8), RW.at(9), RW.at(10));
-        add_children(RW.at(10), RW.at(11));
-
-        /* Step 2: Action. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        ecu_ntnode_compact_postorder_iterator iter;
+        ECU_NTNODE_COMPACT_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_remove_visitor);
+            (void)n;
         }
+        EXPECT_ASSERTION();
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (is_root(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5),
-                             RW.at(6), RW.at(7), RW.at(8), RW.at(9), RW.at(10), RW.at(11))) );
+        /* Step 2: Action. */
+        ecu_ntnode_compact_postorder_iterator_next(&iter);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Start iteration at subroot. Remove all nodes.
+ * @brief General iteration test. Start at root.
+ * Verify all nodes iterated over.
  */
-TEST(NtNode, PostorderIteratorRemoveAllStartIsSubroot)
+TEST(NtNode, CompactPreorderIterator)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW6.
-        
-        Before:
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1---RW2---RW3
-        |           |
-        RW4         RW5-----RW6---RW7
-                            |
-                            RW8
-                            |
-                            RW9-----RW10
-                                    |
-                                    RW11
-        
-        After:
-        RW0                     RW6  RW8  RW9  RW10  RW11
-        |
-        RW1---RW2---RW3
-        |           |
-        RW4         RW5---RW7
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
-        ecu_ntnode_postorder_iterator iter;
+        ecu_ntnode_compact_preorder_iterator iter;
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4));
-        add_children(RW.at(3), RW.at(5), RW.at(6), RW.at(7));
-        add_children(RW.at(6), RW.at(8));
-        add_children(RW.at(8), RW.at(9), RW.at(10));
-        add_children(RW.at(10), RW.at(11));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(5), RW.at(6), 
+                             RW.at(12), RW.at(15), RW.at(7), RW.at(2), RW.at(8), 
+                             RW.at(13), RW.at(9), RW.at(10), RW.at(3), RW.at(11), 
+                             RW.at(14), RW.at(16), RW.at(17));
 
-        /* Step 2: Action. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(6))
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_COMPACT_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_remove_visitor);
+            convert(n).accept(node_obj_in_tree_visitor);
         }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
 
-        /* Step 3: Assert. */
-        CHECK_TRUE( (is_root(RW.at(6), RW.at(8), RW.at(9), RW.at(10), RW.at(11))) );
+/**
+ * @brief General iteration test. Start at root.
+ * Verify all nodes iterated over.
+ */
+TEST(NtNode, ConstCompactPreorderIterator)
+{
+    try
+    {
+        /* Step 1: Arrange. 
+        RW0
+        |
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
+        */
+        ecu_ntnode_compact_preorder_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(5), RW.at(6), 
+                             RW.at(12), RW.at(15), RW.at(7), RW.at(2), RW.at(8), 
+                             RW.at(13), RW.at(9), RW.at(10), RW.at(3), RW.at(11), 
+                             RW.at(14), RW.at(16), RW.at(17));
 
-        /* Step 3: Assert. Verify tree intact. */
-        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(1), RW.at(2), RW.at(5), RW.at(7), RW.at(3), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &RW.at(0))
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_COMPACT_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8694,53 +14180,60 @@ TEST(NtNode, PostorderIteratorRemoveAllStartIsSubroot)
 }
 
 /**
- * @brief Start iteration at root. Destroy some nodes.
+ * @brief Start iteration at subroot node in a middle subtree.
+ * Iteration must end at the subroot's last descendant
+ * even though the subroot has siblings.
  */
-TEST(NtNode, PostorderIteratorDestroySomeStartIsRoot)
+TEST(NtNode, CompactPreorderIteratorStartIsMiddleSubtree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW0.
-        
-        Before:
+        /* Step 1: Arrange. Start iteration at RW3.
         RW0
         |
-        RW1---DN0---RW2
-        |           |
-        DN1         RW3-----RW4---RW5
-                            |
-                            DN2
-                            |
-                            RW6-----RW7
-                                    |
-                                    RW8
+        RW1-----RW2-----RW3-----------------RW4
+                |       |                   |
+                RW5     RW6---RW7---RW8     RW9
+                |                   |       |
+                RW10                RW11    RW12
         
-        After:
-        RW0
-        |
-        RW1-----RW2
-                |
-                RW3---RW4---RW5
         */
-        ecu_ntnode_postorder_iterator iter;
-        add_children(RW.at(0), RW.at(1), DN.at(0), RW.at(2));
-        add_children(RW.at(1), DN.at(1));
-        add_children(RW.at(2), RW.at(3), RW.at(4), RW.at(5));
-        add_children(RW.at(4), DN.at(2));
-        add_children(DN.at(2), RW.at(6), RW.at(7));
-        add_children(RW.at(7), RW.at(8));
-        EXPECT_NODES_DESTROYED(DN.at(1), DN.at(0), DN.at(2), RW.at(6), RW.at(7), RW.at(8));
+        ecu_ntnode_compact_preorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_branch(RW.at(2), RW.at(5), RW.at(10));
+        add_children(RW.at(3), RW.at(6), RW.at(7), RW.at(8));
+        add_branch(RW.at(4), RW.at(9), RW.at(12));
+        add_children(RW.at(8), RW.at(11));
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(6), RW.at(7), RW.at(8), RW.at(11));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        ECU_NTNODE_COMPACT_PREORDER_FOR_EACH(n, &iter, &RW.at(3))
         {
-            convert(n).accept(node_destroy_visitor);
+            convert(n).accept(node_obj_in_tree_visitor);
         }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
 
-        /* Step 3: Assert. Verify remaining tree still intact. */
-        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
-        EXPECT_NODES_IN_TREE(RW.at(1), RW.at(3), RW.at(4), RW.at(5), RW.at(2), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &RW.at(0))
+/**
+ * @brief Perform iteration on empty tree. Only root
+ * node should be returned in the iteration.
+ */
+TEST(NtNode, CompactPreorderIteratorStartIsEmptyRoot)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rw_ntnode empty_root;
+        EXPECT_NODES_IN_TREE(empty_root);
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_ntnode_compact_preorder_iterator iter;
+        ECU_NTNODE_COMPACT_PREORDER_FOR_EACH(n, &iter, &empty_root)
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8753,162 +14246,105 @@ TEST(NtNode, PostorderIteratorDestroySomeStartIsRoot)
 }
 
 /**
- * @brief Start iteration at subroot. Destroy some nodes.
+ * @brief Removing nodes is not allowed in a compact preorder
+ * iteration since it will corrupt the current iteration.
  */
-TEST(NtNode, PostorderIteratorDestroySomeStartIsSubroot)
+TEST(NtNode, CompactPreorderIteratorRemoveNodeInNonEmptyTree)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at RW2.
-        
-        Before:
-        RW0
-        |
-        RW1---DN0---RW2
-        |           |
-        DN1         DN2-----RW3---DN3
-                            |
-                            DN4-----RW4
-                            |
-                            RW5-----RW6
-                                    |
-                                    RW7
-        
-        After:
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1---DN0---RW2
-        |           |
-        DN1         RW3
-                    |
-                    RW4
+        RW1---RW2
         */
-        ecu_ntnode_postorder_iterator iter;
-        add_children(RW.at(0), RW.at(1), DN.at(0), RW.at(2));
-        add_children(RW.at(1), DN.at(1));
-        add_children(RW.at(2), DN.at(2), RW.at(3), DN.at(3));
-        add_children(RW.at(3), DN.at(4), RW.at(4));
-        add_children(DN.at(4), RW.at(5), RW.at(6));
-        add_children(RW.at(6), RW.at(7));
-        EXPECT_NODES_DESTROYED(DN.at(2), DN.at(3), DN.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(2))
+        /* Step 2: Action. */
+        ecu_ntnode_compact_preorder_iterator iter;
+        ECU_NTNODE_COMPACT_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_destroy_visitor);
+            ntnode *node = &convert(n);
+            if (node == &RW.at(2))
+            {
+                ecu_ntnode_remove(node);
+            }
         }
 
-        /* Step 3: Assert. Verify remaining tree still intact. */
-        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
-        EXPECT_NODES_IN_TREE(DN.at(1), RW.at(1), DN.at(0), RW.at(4), RW.at(3), RW.at(2), RW.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Start iteration at root. Destroy all nodes.
+ * @brief Calling next() after an iteration is finished
+ * is not allowed.
  */
-TEST(NtNode, PostorderIteratorDestroyAllStartIsRoot)
+TEST(NtNode, CompactPreorderIteratorNextAfterDone)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at DN0.
-        
-        Before:
-        DN0
+        /* Step 1: Arrange. 
+        RW0
         |
-        DN1---DN2---DN3
-        |           |
-        DN4         DN5-----DN6---DN7
-                            |
-                            DN8
-                            |
-                            DN9-----DN10
-                                    |
-                                    DN11
-        
-        After:
-        All nodes destroyed.
+        RW1---RW2
         */
-        ecu_ntnode_postorder_iterator iter;
-        add_children(DN.at(0), DN.at(1), DN.at(2), DN.at(3));
-        add_children(DN.at(1), DN.at(4));
-        add_children(DN.at(3), DN.at(5), DN.at(6), DN.at(7));
-        add_children(DN.at(6), DN.at(8));
-        add_children(DN.at(8), DN.at(9), DN.at(10));
-        add_children(DN.at(10), DN.at(11));
-        EXPECT_NODES_DESTROYED(DN.at(0), DN.at(1), DN.at(2), DN.at(3), DN.at(4), DN.at(5), DN.at(6),
-                               DN.at(7), DN.at(8), DN.at(9), DN.at(10), DN.at(11));
-
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &DN.at(0))
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        ecu_ntnode_compact_preorder_iterator iter;
+        ECU_NTNODE_COMPACT_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_destroy_visitor);
+            (void)n;
         }
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntnode_compact_preorder_iterator_next(&iter);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
+/*------------------------------------------------------------*/
+/*-------------- TESTS - PRUNED PREORDER ITERATOR ------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Start iteration at subroot. Destroy all nodes.
+ * @brief Without skipping or a limit, nodes are returned
+ * in the same order as the preorder iterator.
  */
-TEST(NtNode, PostorderIteratorDestroyAllStartIsSubroot)
+TEST(NtNode, PrunedPreorderIteratorNoSkip)
 {
     try
     {
-        /* Step 1: Arrange. Start iteration at DN6.
-        
-        Before:
-        DN0
-        |
-        DN1---DN2---DN3
-        |           |
-        DN4         DN5-----DN6---DN7
-                            |
-                            DN8
-                            |
-                            DN9-----DN10
-                                    |
-                                    DN11
-        
-        After:
-        DN0
+        /* Step 1: Arrange.
+        RW0
         |
-        DN1---DN2---DN3
-        |           |
-        DN4         DN5---DN7
+        RW1-----RW2-----RW3
+        |       |
+        RW4     RW5---RW6
+                      |
+                      RW7
         */
-        ecu_ntnode_postorder_iterator iter;
-        add_children(DN.at(0), DN.at(1), DN.at(2), DN.at(3));
-        add_children(DN.at(1), DN.at(4));
-        add_children(DN.at(3), DN.at(5), DN.at(6), DN.at(7));
-        add_children(DN.at(6), DN.at(8));
-        add_children(DN.at(8), DN.at(9), DN.at(10));
-        add_children(DN.at(10), DN.at(11));
-        EXPECT_NODES_DESTROYED(DN.at(6), DN.at(8), DN.at(9), DN.at(10), DN.at(11));
+        ecu_ntnode_pruned_preorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4));
+        add_children(RW.at(2), RW.at(5), RW.at(6));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(2), RW.at(5),
+                             RW.at(6), RW.at(7), RW.at(3));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &DN.at(6))
-        {
-            convert(n).accept(node_destroy_visitor);
-        }
-
-        /* Step 3: Assert. Verify remaining tree intact. */
-        ecu_ntnode_postorder_iterator iter2; /* Do not reuse old iterator. That functionality is tested elsewhere. */
-        EXPECT_NODES_IN_TREE(DN.at(4), DN.at(1), DN.at(2), DN.at(5), DN.at(7), DN.at(3), DN.at(0));
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter2, &DN.at(0))
+        ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -8921,49 +14357,63 @@ TEST(NtNode, PostorderIteratorDestroyAllStartIsSubroot)
 }
 
 /**
- * @brief Calling next() after an iteration is finished
- * is not allowed.
+ * @brief Iterating over a subtree stops at the subtree's
+ * root instead of continuing with its siblings.
  */
-TEST(NtNode, PostorderIteratorNextAfterDone)
+TEST(NtNode, PrunedPreorderIteratorStartIsMiddleSubtree)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_postorder_iterator iter;
-        EXPECT_ASSERTION();
+        /* Step 1: Arrange. Start at RW2.
+        RW0
+        |
+        RW1-----RW2-----RW3
+                |
+                RW4---RW5
+        */
+        ecu_ntnode_pruned_preorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(2), RW.at(4), RW.at(5));
+        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(4), RW.at(5));
 
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(n, &iter, &RW.at(2))
         {
-            (void)n;
+            convert(n).accept(node_obj_in_tree_visitor);
         }
-        (void)ecu_ntnode_postorder_iterator_next(&iter);
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Calling cnext() after an iteration is finished
+ * @brief Calling next() after an iteration is finished
  * is not allowed.
  */
-TEST(NtNode, ConstPostorderIteratorNextAfterDone)
+TEST(NtNode, PrunedPreorderIteratorNextAfterDone)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_ASSERTION();
-
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        /* Step 1: Arrange.
+        RW0
+        |
+        RW1
+        */
+        add_children(RW.at(0), RW.at(1));
+        ecu_ntnode_pruned_preorder_iterator iter;
+        ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             (void)n;
         }
-        (void)ecu_ntnode_postorder_iterator_cnext(&citer);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_ntnode_pruned_preorder_iterator_next(&iter);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
@@ -8973,29 +14423,46 @@ TEST(NtNode, ConstPostorderIteratorNextAfterDone)
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Skip subtree in the middle of the iteration.
+ * Descendants of the skipped node are not returned.
  */
-TEST(NtNode, PostorderIteratorMultipleTimes)
+TEST(NtNode, PrunedPreorderIteratorSkipSubtree)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_postorder_iterator iter;
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
-        CHECK_TRUE( (is_root(RW.at(0))) ); /* Precondition. */
-        
+        /* Step 1: Arrange. Skip RW1.
+        RW0
+        |
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
+        */
+        ecu_ntnode_pruned_preorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(8), RW.at(13), 
+                             RW.at(9), RW.at(10), RW.at(3), RW.at(11), RW.at(14), 
+                             RW.at(16), RW.at(17));
+
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iter, &RW.at(0))
+        ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
+
+            if (n == &RW.at(1))
+            {
+                ecu_ntnode_pruned_preorder_iterator_skip(&iter);
+            }
         }
     }
     catch (const AssertException& e)
@@ -9006,29 +14473,46 @@ TEST(NtNode, PostorderIteratorMultipleTimes)
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Skip subtree in the middle of the iteration.
+ * Descendants of the skipped node are not returned.
  */
-TEST(NtNode, ConstPostorderIteratorMultipleTimes)
+TEST(NtNode, ConstPrunedPreorderIteratorSkipSubtree)
 {
     try
     {
-        /* Step 1: Arrange. */
-        ecu_ntnode_postorder_citerator citer;
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(0), RW.at(0));
-        CHECK_TRUE( (is_root(RW.at(0))) ); /* Precondition. */
-        
+        /* Step 1: Arrange. Skip RW1.
+        RW0
+        |
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
+        */
+        ecu_ntnode_pruned_preorder_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(8), RW.at(13), 
+                             RW.at(9), RW.at(10), RW.at(3), RW.at(11), RW.at(14), 
+                             RW.at(16), RW.at(17));
+
         /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_POSTORDER_FOR_EACH(n, &citer, &RW.at(0))
+        ECU_NTNODE_CONST_PRUNED_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
+
+            if (n == &RW.at(1))
+            {
+                ecu_ntnode_pruned_preorder_iterator_cskip(&citer);
+            }
         }
     }
     catch (const AssertException& e)
@@ -9038,46 +14522,46 @@ TEST(NtNode, ConstPostorderIteratorMultipleTimes)
     }
 }
 
-/*------------------------------------------------------------*/
-/*------------------ TESTS - PREORDER ITERATOR ---------------*/
-/*------------------------------------------------------------*/
-
 /**
- * @brief General iteration test. Verify all nodes iterated
- * over.
+ * @brief Skipping the last subtree ends the iteration.
  */
-TEST(NtNode, PreorderIterator)
+TEST(NtNode, PrunedPreorderIteratorSkipLastSubtree)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. Skip RW3.
         RW0
         |
-        RW1-----RW2---RW3-------RW4
-        |       |               |
-        RW5     RW6-----RW7     RW8
-        |               |
-        RW9             RW10---RW11
-        |               |
-        RW12            RW13
-        |
-        RW14
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_branch(RW.at(1), RW.at(5), RW.at(9), RW.at(12), RW.at(14));
-        add_children(RW.at(2), RW.at(6), RW.at(7));
-        add_children(RW.at(4), RW.at(8));
-        add_children(RW.at(7), RW.at(10), RW.at(11));
-        add_children(RW.at(10), RW.at(13));
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(5), RW.at(9), RW.at(12), RW.at(14),
-                             RW.at(2), RW.at(6), RW.at(7), RW.at(10), RW.at(13),
-                             RW.at(11), RW.at(3), RW.at(4), RW.at(8));
+        ecu_ntnode_pruned_preorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(5), RW.at(6), 
+                             RW.at(12), RW.at(15), RW.at(7), RW.at(2), RW.at(8), 
+                             RW.at(13), RW.at(9), RW.at(10), RW.at(3));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
+
+            if (n == &RW.at(3))
+            {
+                ecu_ntnode_pruned_preorder_iterator_skip(&iter);
+            }
         }
     }
     catch (const AssertException& e)
@@ -9088,41 +14572,34 @@ TEST(NtNode, PreorderIterator)
 }
 
 /**
- * @brief General iteration test. Verify all nodes iterated
- * over.
+ * @brief Skipping a leaf has no effect since it
+ * has no descendants.
  */
-TEST(NtNode, ConstPreorderIterator)
+TEST(NtNode, PrunedPreorderIteratorSkipLeaf)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. Skip RW1.
         RW0
         |
-        RW1-----RW2---RW3-------RW4
-        |       |               |
-        RW5     RW6-----RW7     RW8
-        |               |
-        RW9             RW10---RW11
-        |               |
-        RW12            RW13
-        |
-        RW14
+        RW1---RW2
+              |
+              RW3
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        add_branch(RW.at(1), RW.at(5), RW.at(9), RW.at(12), RW.at(14));
-        add_children(RW.at(2), RW.at(6), RW.at(7));
-        add_children(RW.at(4), RW.at(8));
-        add_children(RW.at(7), RW.at(10), RW.at(11));
-        add_children(RW.at(10), RW.at(13));
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(5), RW.at(9), RW.at(12), RW.at(14),
-                             RW.at(2), RW.at(6), RW.at(7), RW.at(10), RW.at(13),
-                             RW.at(11), RW.at(3), RW.at(4), RW.at(8));
+        ecu_ntnode_pruned_preorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        add_children(RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_citerator citer;
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
+        ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
+
+            if (n == &RW.at(1))
+            {
+                ecu_ntnode_pruned_preorder_iterator_skip(&iter);
+            }
         }
     }
     catch (const AssertException& e)
@@ -9133,44 +14610,30 @@ TEST(NtNode, ConstPreorderIterator)
 }
 
 /**
- * @brief General iteration test. Verify all nodes iterated
- * over.
+ * @brief Skipping the root only returns the root.
  */
-TEST(NtNode, PreorderIterator2)
+TEST(NtNode, PrunedPreorderIteratorSkipRoot)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. Skip RW0.
         RW0
         |
-        RW1---------------------------------RW2---RW3
-        |                                   |
-        RW4-------------------------RW5     RW6
-        |                           |
-        RW7-----RW8---RW9           RW10----RW11
-        |       |                           |
-        RW12    RW13                        RW14----RW15
-                                                    |
-                                                    RW16
+        RW1---RW2
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
-        add_children(RW.at(5), RW.at(10), RW.at(11));
-        add_children(RW.at(7), RW.at(12));
-        add_children(RW.at(8), RW.at(13));
-        add_children(RW.at(11), RW.at(14), RW.at(15));
-        add_children(RW.at(15), RW.at(16));
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(7), RW.at(12), RW.at(8), RW.at(13),
-                             RW.at(9), RW.at(5), RW.at(10), RW.at(11), RW.at(14), RW.at(15), RW.at(16),
-                             RW.at(2), RW.at(6), RW.at(3));
+        ecu_ntnode_pruned_preorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        EXPECT_NODES_IN_TREE(RW.at(0));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
+
+            if (n == &RW.at(0))
+            {
+                ecu_ntnode_pruned_preorder_iterator_skip(&iter);
+            }
         }
     }
     catch (const AssertException& e)
@@ -9181,86 +14644,74 @@ TEST(NtNode, PreorderIterator2)
 }
 
 /**
- * @brief General iteration test. Verify all nodes iterated
- * over.
+ * @brief Calling skip() after an iteration is finished
+ * is not allowed.
  */
-TEST(NtNode, ConstPreorderIterator2)
+TEST(NtNode, PrunedPreorderIteratorSkipAfterDone)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1---------------------------------RW2---RW3
-        |                                   |
-        RW4-------------------------RW5     RW6
-        |                           |
-        RW7-----RW8---RW9           RW10----RW11
-        |       |                           |
-        RW12    RW13                        RW14----RW15
-                                                    |
-                                                    RW16
+        RW1---RW2
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
-        add_children(RW.at(5), RW.at(10), RW.at(11));
-        add_children(RW.at(7), RW.at(12));
-        add_children(RW.at(8), RW.at(13));
-        add_children(RW.at(11), RW.at(14), RW.at(15));
-        add_children(RW.at(15), RW.at(16));
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(7), RW.at(12), RW.at(8), RW.at(13),
-                             RW.at(9), RW.at(5), RW.at(10), RW.at(11), RW.at(14), RW.at(15), RW.at(16),
-                             RW.at(2), RW.at(6), RW.at(3));
-
-        /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_citerator citer;
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        ecu_ntnode_pruned_preorder_iterator iter;
+        ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            (void)n;
         }
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntnode_pruned_preorder_iterator_skip(&iter);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Start iteration at node in a left-most subtree.
+ * @brief Verify level of each returned node is
+ * relative to the root of the iteration.
  */
-TEST(NtNode, PreorderIteratorStartIsLeftMostSubtree)
+TEST(NtNode, PrunedPreorderIteratorLevel)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. Start iteration at RW3.
         RW0
         |
-        RW1---------------------------------RW2---RW3
-        |                                   |
-        RW4-------------------------RW5     RW6
-        |                           |
-        RW7-----RW8---RW9           RW10
-        |       |
-        RW11    RW12
-        */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
-        add_children(RW.at(5), RW.at(10));
-        add_children(RW.at(7), RW.at(11));
-        add_children(RW.at(8), RW.at(12));
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(7), RW.at(11), RW.at(8), RW.at(12), RW.at(9));
+        RW1-----RW2-----RW3-----------------RW4
+                |       |                   |
+                RW5     RW6---RW7---RW8     RW9
+                |                   |       |
+                RW10                RW11    RW12
+        
+        */
+        static constexpr std::size_t LEVELS[] = {0, 1, 1, 1, 2};
+        ecu_ntnode_pruned_preorder_iterator iter;
+        std::size_t i = 0;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_branch(RW.at(2), RW.at(5), RW.at(10));
+        add_children(RW.at(3), RW.at(6), RW.at(7), RW.at(8));
+        add_branch(RW.at(4), RW.at(9), RW.at(12));
+        add_children(RW.at(8), RW.at(11));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(4))
+        ECU_NTNODE_PRUNED_PREORDER_FOR_EACH(n, &iter, &RW.at(3))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            CHECK_TRUE( (i < sizeof(LEVELS) / sizeof(LEVELS[0])) );
+            UNSIGNED_LONGS_EQUAL(LEVELS[i], ecu_ntnode_pruned_preorder_iterator_level(&iter));
+            UNSIGNED_LONGS_EQUAL(ecu_ntnode_level(n) - 1, ecu_ntnode_pruned_preorder_iterator_level(&iter));
+            i++;
         }
+        UNSIGNED_LONGS_EQUAL(5, i);
     }
     catch (const AssertException& e)
     {
@@ -9270,38 +14721,41 @@ TEST(NtNode, PreorderIteratorStartIsLeftMostSubtree)
 }
 
 /**
- * @brief Start iteration at node in a left-most subtree.
+ * @brief Verify level of each returned node is
+ * relative to the root of the iteration.
  */
-TEST(NtNode, ConstPreorderIteratorStartIsLeftMostSubtree)
+TEST(NtNode, ConstPrunedPreorderIteratorLevel)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. Start iteration at RW3.
         RW0
         |
-        RW1---------------------------------RW2---RW3
-        |                                   |
-        RW4-------------------------RW5     RW6
-        |                           |
-        RW7-----RW8---RW9           RW10
-        |       |
-        RW11    RW12
+        RW1-----RW2-----RW3-----------------RW4
+                |       |                   |
+                RW5     RW6---RW7---RW8     RW9
+                |                   |       |
+                RW10                RW11    RW12
+        
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
-        add_children(RW.at(5), RW.at(10));
-        add_children(RW.at(7), RW.at(11));
-        add_children(RW.at(8), RW.at(12));
-        EXPECT_NODES_IN_TREE(RW.at(4), RW.at(7), RW.at(11), RW.at(8), RW.at(12), RW.at(9));
+        static constexpr std::size_t LEVELS[] = {0, 1, 1, 1, 2};
+        ecu_ntnode_pruned_preorder_citerator citer;
+        std::size_t i = 0;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_branch(RW.at(2), RW.at(5), RW.at(10));
+        add_children(RW.at(3), RW.at(6), RW.at(7), RW.at(8));
+        add_branch(RW.at(4), RW.at(9), RW.at(12));
+        add_children(RW.at(8), RW.at(11));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_citerator citer;
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(4))
+        ECU_NTNODE_CONST_PRUNED_PREORDER_FOR_EACH(n, &citer, &RW.at(3))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            CHECK_TRUE( (i < sizeof(LEVELS) / sizeof(LEVELS[0])) );
+            UNSIGNED_LONGS_EQUAL(LEVELS[i], ecu_ntnode_pruned_preorder_iterator_clevel(&citer));
+            UNSIGNED_LONGS_EQUAL(ecu_ntnode_level(n) - 1, ecu_ntnode_pruned_preorder_iterator_clevel(&citer));
+            i++;
         }
+        UNSIGNED_LONGS_EQUAL(5, i);
     }
     catch (const AssertException& e)
     {
@@ -9311,39 +14765,38 @@ TEST(NtNode, ConstPreorderIteratorStartIsLeftMostSubtree)
 }
 
 /**
- * @brief Start iteration at node in a middle subtree.
+ * @brief Stop descending after level 2.
  */
-TEST(NtNode, PreorderIteratorStartIsMiddleSubtree)
+TEST(NtNode, PrunedPreorderLimitIterator)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1---------------------------------RW2---RW3
-        |                                   |
-        RW4-------------------------RW5     RW6
-        |                           |
-        RW7-----RW8---RW9           RW10----RW11
-        |       |                           |
-        RW12    RW13                        RW14----RW15
-                                                    |
-                                                    RW16
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
+        ecu_ntnode_pruned_preorder_iterator iter;
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
-        add_children(RW.at(5), RW.at(10), RW.at(11));
-        add_children(RW.at(7), RW.at(12));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
         add_children(RW.at(8), RW.at(13));
-        add_children(RW.at(11), RW.at(14), RW.at(15));
-        add_children(RW.at(15), RW.at(16));
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(10), RW.at(11), RW.at(14), RW.at(15), RW.at(16));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(5), RW.at(6), 
+                             RW.at(7), RW.at(2), RW.at(8), RW.at(9), RW.at(10), 
+                             RW.at(3), RW.at(11));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(5))
+        ECU_NTNODE_PRUNED_PREORDER_LIMIT_FOR_EACH(n, &iter, &RW.at(0), 2)
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -9356,39 +14809,38 @@ TEST(NtNode, PreorderIteratorStartIsMiddleSubtree)
 }
 
 /**
- * @brief Start iteration at node in a middle subtree.
+ * @brief Stop descending after level 2.
  */
-TEST(NtNode, ConstPreorderIteratorStartIsMiddleSubtree)
+TEST(NtNode, ConstPrunedPreorderLimitIterator)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1---------------------------------RW2---RW3
-        |                                   |
-        RW4-------------------------RW5     RW6
-        |                           |
-        RW7-----RW8---RW9           RW10----RW11
-        |       |                           |
-        RW12    RW13                        RW14----RW15
-                                                    |
-                                                    RW16
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
+        ecu_ntnode_pruned_preorder_citerator citer;
         add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
-        add_children(RW.at(1), RW.at(4), RW.at(5));
-        add_children(RW.at(2), RW.at(6));
-        add_children(RW.at(4), RW.at(7), RW.at(8), RW.at(9));
-        add_children(RW.at(5), RW.at(10), RW.at(11));
-        add_children(RW.at(7), RW.at(12));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
         add_children(RW.at(8), RW.at(13));
-        add_children(RW.at(11), RW.at(14), RW.at(15));
-        add_children(RW.at(15), RW.at(16));
-        EXPECT_NODES_IN_TREE(RW.at(5), RW.at(10), RW.at(11), RW.at(14), RW.at(15), RW.at(16));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(5), RW.at(6), 
+                             RW.at(7), RW.at(2), RW.at(8), RW.at(9), RW.at(10), 
+                             RW.at(3), RW.at(11));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_citerator citer;
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(5))
+        ECU_NTNODE_CONST_PRUNED_PREORDER_LIMIT_FOR_EACH(n, &citer, &RW.at(0), 2)
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -9401,41 +14853,23 @@ TEST(NtNode, ConstPreorderIteratorStartIsMiddleSubtree)
 }
 
 /**
- * @brief Start iteration at node in a right-most subtree.
+ * @brief Max level of 0 only returns the root.
  */
-TEST(NtNode, PreorderIteratorStartIsRightMostSubtree)
+TEST(NtNode, PrunedPreorderLimitIteratorMaxLevelIsZero)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1-------------RW2
-        |               |
-        RW3-----RW4     RW5---RW6
-                |       |
-                RW7     RW8---RW9
-                        |
-                        RW10----RW11
-                        |       |
-                        RW12    RW13
-                                |
-                                RW14
+        RW1---RW2
         */
+        ecu_ntnode_pruned_preorder_iterator iter;
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3), RW.at(4));
-        add_children(RW.at(2), RW.at(5), RW.at(6));
-        add_children(RW.at(4), RW.at(7));
-        add_children(RW.at(5), RW.at(8), RW.at(9));
-        add_children(RW.at(8), RW.at(10), RW.at(11));
-        add_children(RW.at(10), RW.at(12));
-        add_branch(RW.at(11), RW.at(13), RW.at(14));
-        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(5), RW.at(8), RW.at(10), RW.at(12), RW.at(11),
-                             RW.at(13), RW.at(14), RW.at(9), RW.at(6));
+        EXPECT_NODES_IN_TREE(RW.at(0));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(2))
+        ECU_NTNODE_PRUNED_PREORDER_LIMIT_FOR_EACH(n, &iter, &RW.at(0), 0)
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -9448,43 +14882,44 @@ TEST(NtNode, PreorderIteratorStartIsRightMostSubtree)
 }
 
 /**
- * @brief Start iteration at node in a right-most subtree.
+ * @brief Skip a subtree in a depth-bounded iteration.
  */
-TEST(NtNode, ConstPreorderIteratorStartIsRightMostSubtree)
+TEST(NtNode, PrunedPreorderLimitIteratorSkipSubtree)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. Skip RW2. Max level 2.
         RW0
         |
-        RW1-------------RW2
-        |               |
-        RW3-----RW4     RW5---RW6
-                |       |
-                RW7     RW8---RW9
-                        |
-                        RW10----RW11
-                        |       |
-                        RW12    RW13
-                                |
-                                RW14
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        add_children(RW.at(1), RW.at(3), RW.at(4));
-        add_children(RW.at(2), RW.at(5), RW.at(6));
-        add_children(RW.at(4), RW.at(7));
-        add_children(RW.at(5), RW.at(8), RW.at(9));
-        add_children(RW.at(8), RW.at(10), RW.at(11));
-        add_children(RW.at(10), RW.at(12));
-        add_branch(RW.at(11), RW.at(13), RW.at(14));
-        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(5), RW.at(8), RW.at(10), RW.at(12), RW.at(11),
-                             RW.at(13), RW.at(14), RW.at(9), RW.at(6));
+        ecu_ntnode_pruned_preorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(4), RW.at(5), RW.at(6), 
+                             RW.at(7), RW.at(2), RW.at(3), RW.at(11));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_citerator citer;
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(2))
+        ECU_NTNODE_PRUNED_PREORDER_LIMIT_FOR_EACH(n, &iter, &RW.at(0), 2)
         {
             convert(n).accept(node_obj_in_tree_visitor);
+
+            if (n == &RW.at(2))
+            {
+                ecu_ntnode_pruned_preorder_iterator_skip(&iter);
+            }
         }
     }
     catch (const AssertException& e)
@@ -9494,25 +14929,45 @@ TEST(NtNode, ConstPreorderIteratorStartIsRightMostSubtree)
     }
 }
 
+/*------------------------------------------------------------*/
+/*---------------- TESTS - LEVELORDER ITERATOR ---------------*/
+/*------------------------------------------------------------*/
+
 /**
- * @brief Start iteration at a leaf node. Only the leaf
- * should be returned in the iteration.
+ * @brief General iteration test. Start at root.
+ * Verify all nodes iterated over one level at a time.
  */
-TEST(NtNode, PreorderIteratorStartIsLeaf)
+TEST(NtNode, LevelorderIterator)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1---RW2
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        EXPECT_NODES_IN_TREE(RW.at(1));
+        ecu_ntnode_levelorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), 
+                             RW.at(5), RW.at(6), RW.at(7), RW.at(8), RW.at(9), 
+                             RW.at(10), RW.at(11), RW.at(12), RW.at(13), RW.at(14), 
+                             RW.at(15), RW.at(16), RW.at(17));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(1))
+        ECU_NTNODE_LEVELORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -9525,24 +14980,40 @@ TEST(NtNode, PreorderIteratorStartIsLeaf)
 }
 
 /**
- * @brief Start iteration at a leaf node. Only the leaf
- * should be returned in the iteration.
+ * @brief General iteration test. Start at root.
+ * Verify all nodes iterated over one level at a time.
  */
-TEST(NtNode, ConstPreorderIteratorStartIsLeaf)
+TEST(NtNode, ConstLevelorderIterator)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1---RW2
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        EXPECT_NODES_IN_TREE(RW.at(1));
+        ecu_ntnode_levelorder_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), 
+                             RW.at(5), RW.at(6), RW.at(7), RW.at(8), RW.at(9), 
+                             RW.at(10), RW.at(11), RW.at(12), RW.at(13), RW.at(14), 
+                             RW.at(15), RW.at(16), RW.at(17));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_citerator citer;
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(1))
+        ECU_NTNODE_CONST_LEVELORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -9555,20 +15026,33 @@ TEST(NtNode, ConstPreorderIteratorStartIsLeaf)
 }
 
 /**
- * @brief Perform iteration on empty tree. Only root
- * node should be returned in the iteration.
+ * @brief Start iteration at subroot node in a middle subtree.
+ * Siblings of the subroot must not be iterated over.
  */
-TEST(NtNode, PreorderIteratorStartIsEmptyRoot)
+TEST(NtNode, LevelorderIteratorStartIsMiddleSubtree)
 {
     try
     {
-        /* Step 1: Arrange. */
-        rw_ntnode empty_root;
-        EXPECT_NODES_IN_TREE(empty_root);
+        /* Step 1: Arrange. Start iteration at RW3.
+        RW0
+        |
+        RW1-----RW2-----RW3-----------------RW4
+                |       |                   |
+                RW5     RW6---RW7---RW8     RW9
+                |                   |       |
+                RW10                RW11    RW12
+        
+        */
+        ecu_ntnode_levelorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        add_branch(RW.at(2), RW.at(5), RW.at(10));
+        add_children(RW.at(3), RW.at(6), RW.at(7), RW.at(8));
+        add_branch(RW.at(4), RW.at(9), RW.at(12));
+        add_children(RW.at(8), RW.at(11));
+        EXPECT_NODES_IN_TREE(RW.at(3), RW.at(6), RW.at(7), RW.at(8), RW.at(11));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &empty_root)
+        ECU_NTNODE_LEVELORDER_FOR_EACH(n, &iter, &RW.at(3))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -9584,7 +15068,7 @@ TEST(NtNode, PreorderIteratorStartIsEmptyRoot)
  * @brief Perform iteration on empty tree. Only root
  * node should be returned in the iteration.
  */
-TEST(NtNode, ConstPreorderIteratorStartIsEmptyRoot)
+TEST(NtNode, LevelorderIteratorStartIsEmptyRoot)
 {
     try
     {
@@ -9593,8 +15077,8 @@ TEST(NtNode, ConstPreorderIteratorStartIsEmptyRoot)
         EXPECT_NODES_IN_TREE(empty_root);
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_citerator citer;
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &empty_root)
+        ecu_ntnode_levelorder_iterator iter;
+        ECU_NTNODE_LEVELORDER_FOR_EACH(n, &iter, &empty_root)
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -9607,13 +15091,14 @@ TEST(NtNode, ConstPreorderIteratorStartIsEmptyRoot)
 }
 
 /**
- * @brief Start iteration at middle node of degenerate tree.
+ * @brief Start iteration at root of degenerate tree.
+ * Every level has one node.
  */
-TEST(NtNode, PreorderIteratorStartIsMiddleChildInDegenerateTree)
+TEST(NtNode, LevelorderIteratorStartIsRootOfDegenerateTree)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
         RW1
@@ -9621,15 +15106,13 @@ TEST(NtNode, PreorderIteratorStartIsMiddleChildInDegenerateTree)
         RW2
         |
         RW3
-        |
-        RW4
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(3), RW.at(4));
+        ecu_ntnode_levelorder_iterator iter;
+        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(2))
+        ECU_NTNODE_LEVELORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -9642,29 +15125,32 @@ TEST(NtNode, PreorderIteratorStartIsMiddleChildInDegenerateTree)
 }
 
 /**
- * @brief Start iteration at middle node of degenerate tree.
+ * @brief Every level after the root starts below a node
+ * that is not the first node in the previous level.
  */
-TEST(NtNode, ConstPreorderIteratorStartIsMiddleChildInDegenerateTree)
+TEST(NtNode, LevelorderIteratorLevelStartsInLaterSubtree)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. First nodes in each level are leaves so
+        every level starts in a later subtree.
         RW0
         |
-        RW1
-        |
-        RW2
-        |
-        RW3
-        |
-        RW4
+        RW1---RW2---RW3
+              |     |
+              RW4   RW5---RW6
+                          |
+                          RW7
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        EXPECT_NODES_IN_TREE(RW.at(2), RW.at(3), RW.at(4));
+        ecu_ntnode_levelorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(2), RW.at(4));
+        add_children(RW.at(3), RW.at(5), RW.at(6));
+        add_children(RW.at(6), RW.at(7));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_citerator citer;
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(2))
+        ECU_NTNODE_LEVELORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
             convert(n).accept(node_obj_in_tree_visitor);
         }
@@ -9677,32 +15163,40 @@ TEST(NtNode, ConstPreorderIteratorStartIsMiddleChildInDegenerateTree)
 }
 
 /**
- * @brief Start iteration at root node of degenerate tree.
+ * @brief Verify level of each returned node is
+ * relative to the root of the iteration.
  */
-TEST(NtNode, PreorderIteratorStartIsRootOfDegenerateTree)
+TEST(NtNode, LevelorderIteratorLevel)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. First nodes in each level are leaves so
+        every level starts in a later subtree.
         RW0
         |
-        RW1
-        |
-        RW2
-        |
-        RW3
-        |
-        RW4
+        RW1---RW2---RW3
+              |     |
+              RW4   RW5---RW6
+                          |
+                          RW7
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        static constexpr std::size_t LEVELS[] = {0, 1, 1, 1, 2, 2, 2, 3};
+        ecu_ntnode_levelorder_iterator iter;
+        std::size_t i = 0;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(2), RW.at(4));
+        add_children(RW.at(3), RW.at(5), RW.at(6));
+        add_children(RW.at(6), RW.at(7));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        ECU_NTNODE_LEVELORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            CHECK_TRUE( (i < sizeof(LEVELS) / sizeof(LEVELS[0])) );
+            UNSIGNED_LONGS_EQUAL(LEVELS[i], ecu_ntnode_levelorder_iterator_level(&iter));
+            UNSIGNED_LONGS_EQUAL(ecu_ntnode_level(n), ecu_ntnode_levelorder_iterator_level(&iter));
+            i++;
         }
+        UNSIGNED_LONGS_EQUAL(8, i);
     }
     catch (const AssertException& e)
     {
@@ -9712,32 +15206,40 @@ TEST(NtNode, PreorderIteratorStartIsRootOfDegenerateTree)
 }
 
 /**
- * @brief Start iteration at root node of degenerate tree.
+ * @brief Verify level of each returned node is
+ * relative to the root of the iteration.
  */
-TEST(NtNode, ConstPreorderIteratorStartIsRootOfDegenerateTree)
+TEST(NtNode, ConstLevelorderIteratorLevel)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. First nodes in each level are leaves so
+        every level starts in a later subtree.
         RW0
         |
-        RW1
-        |
-        RW2
-        |
-        RW3
-        |
-        RW4
+        RW1---RW2---RW3
+              |     |
+              RW4   RW5---RW6
+                          |
+                          RW7
         */
-        add_branch(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4));
+        static constexpr std::size_t LEVELS[] = {0, 1, 1, 1, 2, 2, 2, 3};
+        ecu_ntnode_levelorder_citerator citer;
+        std::size_t i = 0;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(2), RW.at(4));
+        add_children(RW.at(3), RW.at(5), RW.at(6));
+        add_children(RW.at(6), RW.at(7));
 
         /* Steps 2 and 3: Action and assert. */
-        ecu_ntnode_preorder_citerator citer;
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
+        ECU_NTNODE_CONST_LEVELORDER_FOR_EACH(n, &citer, &RW.at(0))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            CHECK_TRUE( (i < sizeof(LEVELS) / sizeof(LEVELS[0])) );
+            UNSIGNED_LONGS_EQUAL(LEVELS[i], ecu_ntnode_levelorder_iterator_clevel(&citer));
+            UNSIGNED_LONGS_EQUAL(ecu_ntnode_level(n), ecu_ntnode_levelorder_iterator_clevel(&citer));
+            i++;
         }
+        UNSIGNED_LONGS_EQUAL(8, i);
     }
     catch (const AssertException& e)
     {
@@ -9747,83 +15249,97 @@ TEST(NtNode, ConstPreorderIteratorStartIsRootOfDegenerateTree)
 }
 
 /**
- * @brief Removing nodes is not allowed in a preorder iteration
- * since it will corrupt the current iteration.
+ * @brief Stop iteration after level 2.
  */
-TEST(NtNode, PreorderIteratorRemoveNodeInNonEmptyTree)
+TEST(NtNode, LevelorderLimitIterator)
 {
     try
     {
         /* Step 1: Arrange. 
         RW0
         |
-        RW1---RW2
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
-        add_children(RW.at(0), RW.at(1), RW.at(2));
-        EXPECT_ASSERTION();
+        ecu_ntnode_levelorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), 
+                             RW.at(5), RW.at(6), RW.at(7), RW.at(8), RW.at(9), 
+                             RW.at(10), RW.at(11));
 
-        /* Step 2: Action. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_LEVELORDER_LIMIT_FOR_EACH(n, &iter, &RW.at(0), 2)
         {
-            ntnode *node = &convert(n);
-            if (node == &RW.at(2))
-            {
-                ecu_ntnode_remove(node);
-            }
+            convert(n).accept(node_obj_in_tree_visitor);
         }
-
-        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Destroying nodes is not allowed in a preorder iteration
- * since it will corrupt the current iteration.
+ * @brief Stop iteration after level 2.
  */
-TEST(NtNode, PreorderIteratorDestroyNodeInNonEmptyTree)
+TEST(NtNode, ConstLevelorderLimitIterator)
 {
     try
     {
-        /* Step 1: Arrange. N used to make destroy callback unused.
+        /* Step 1: Arrange. 
         RW0
         |
-        N----RW1
+        RW1-------------------------RW2---------------------RW3
+        |                           |                       |
+        RW4---RW5---RW6---RW7       RW8---RW9---RW10        RW11
+                    |               |                       |
+                    RW12            RW13                    RW14
+                    |                                       |
+                    RW15                                    RW16
+                                                            |
+                                                            RW17
         */
-        rw_ntnode N{ECU_NTNODE_DESTROY_UNUSED};
-        add_children(RW.at(0), N, RW.at(2));
-        EXPECT_ASSERTION();
+        ecu_ntnode_levelorder_citerator citer;
+        add_children(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+        add_children(RW.at(1), RW.at(4), RW.at(5), RW.at(6), RW.at(7));
+        add_children(RW.at(2), RW.at(8), RW.at(9), RW.at(10));
+        add_branch(RW.at(3), RW.at(11), RW.at(14), RW.at(16), RW.at(17));
+        add_branch(RW.at(6), RW.at(12), RW.at(15));
+        add_children(RW.at(8), RW.at(13));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3), RW.at(4), 
+                             RW.at(5), RW.at(6), RW.at(7), RW.at(8), RW.at(9), 
+                             RW.at(10), RW.at(11));
 
-        /* Step 2: Action. */
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_CONST_LEVELORDER_LIMIT_FOR_EACH(n, &citer, &RW.at(0), 2)
         {
-            ntnode *node = &convert(n);
-            if (node == &N)
-            {
-                ecu_ntnode_destroy(&N);
-            }
+            convert(n).accept(node_obj_in_tree_visitor);
         }
-
-        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Calling next() after an iteration is finished
- * is not allowed.
+ * @brief Max level of 0 only returns the root.
  */
-TEST(NtNode, PreorderIteratorNextAfterDone)
+TEST(NtNode, LevelorderLimitIteratorMaxLevelIsZero)
 {
     try
     {
@@ -9832,31 +15348,28 @@ TEST(NtNode, PreorderIteratorNextAfterDone)
         |
         RW1---RW2
         */
+        ecu_ntnode_levelorder_iterator iter;
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        ecu_ntnode_preorder_iterator iter;
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        EXPECT_NODES_IN_TREE(RW.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_LEVELORDER_LIMIT_FOR_EACH(n, &iter, &RW.at(0), 0)
         {
-            (void)n;
+            convert(n).accept(node_obj_in_tree_visitor);
         }
-        EXPECT_ASSERTION();
-
-        /* Step 2: Action. */
-        ecu_ntnode_preorder_iterator_next(&iter);
-
-        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Calling cnext() after an iteration is finished
- * is not allowed.
+ * @brief Max level deeper than the tree returns
+ * every node.
  */
-TEST(NtNode, ConstPreorderIteratorNextAfterDone)
+TEST(NtNode, LevelorderLimitIteratorMaxLevelPastLeaves)
 {
     try
     {
@@ -9864,97 +15377,92 @@ TEST(NtNode, ConstPreorderIteratorNextAfterDone)
         RW0
         |
         RW1---RW2
+              |
+              RW3
         */
+        ecu_ntnode_levelorder_iterator iter;
         add_children(RW.at(0), RW.at(1), RW.at(2));
-        ecu_ntnode_preorder_citerator citer;
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
+        add_children(RW.at(2), RW.at(3));
+        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(2), RW.at(3));
+
+        /* Steps 2 and 3: Action and assert. */
+        ECU_NTNODE_LEVELORDER_LIMIT_FOR_EACH(n, &iter, &RW.at(0), 10)
         {
-            (void)n;
+            convert(n).accept(node_obj_in_tree_visitor);
         }
-        EXPECT_ASSERTION();
-
-        /* Step 2: Action. */
-        ecu_ntnode_preorder_iterator_cnext(&citer);
-
-        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* OK. */
+        /* FAIL. */
         (void)e;
     }
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Removing nodes is not allowed in a level-order
+ * iteration since it will corrupt the current iteration.
  */
-TEST(NtNode, PreorderIteratorMultipleTimes)
+TEST(NtNode, LevelorderIteratorRemoveNodeInNonEmptyTree)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1
+        RW1---RW2
         */
-        add_children(RW.at(0), RW.at(1));
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(0), RW.at(1), RW.at(0), RW.at(1));
-        ecu_ntnode_preorder_iterator iter;
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        EXPECT_ASSERTION();
 
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_PREORDER_FOR_EACH(n, &iter, &RW.at(0))
+        /* Step 2: Action. */
+        ecu_ntnode_levelorder_iterator iter;
+        ECU_NTNODE_LEVELORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            ntnode *node = &convert(n);
+            if (node == &RW.at(1))
+            {
+                ecu_ntnode_remove(node);
+            }
         }
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
 
 /**
- * @brief Iteration can be conducted multiple times in a row.
+ * @brief Calling next() after an iteration is finished
+ * is not allowed.
  */
-TEST(NtNode, ConstPreorderIteratorMultipleTimes)
+TEST(NtNode, LevelorderIteratorNextAfterDone)
 {
     try
     {
-        /* Step 1: Arrange.
+        /* Step 1: Arrange. 
         RW0
         |
-        RW1
+        RW1---RW2
         */
-        add_children(RW.at(0), RW.at(1));
-        EXPECT_NODES_IN_TREE(RW.at(0), RW.at(1), RW.at(0), RW.at(1), RW.at(0), RW.at(1));
-        ecu_ntnode_preorder_citerator citer;
-
-        /* Steps 2 and 3: Action and assert. */
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
-        {
-            convert(n).accept(node_obj_in_tree_visitor);
-        }
-        ECU_NTNODE_CONST_PREORDER_FOR_EACH(n, &citer, &RW.at(0))
+        add_children(RW.at(0), RW.at(1), RW.at(2));
+        ecu_ntnode_levelorder_iterator iter;
+        ECU_NTNODE_LEVELORDER_FOR_EACH(n, &iter, &RW.at(0))
         {
-            convert(n).accept(node_obj_in_tree_visitor);
+            (void)n;
         }
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntnode_levelorder_iterator_next(&iter);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
     }
     catch (const AssertException& e)
     {
-        /* FAIL. */
+        /* OK. */
         (void)e;
     }
 }
@@ -0,0 +1,721 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref ntrank.h.
+ * Test summary:
+ *
+ * @ref ecu_ntrank_ctor()
+ *      - TEST(NtRank, CtorCapacityNotPowerOfTwo)
+ *
+ * @ref ecu_ntrank_build(), @ref ecu_ntrank_count()
+ *      - TEST(NtRank, BuildRanksChildrenInOrder)
+ *      - TEST(NtRank, BuildParentHasNoChildren)
+ *      - TEST(NtRank, BuildReplacesPreviousContents)
+ *      - TEST(NtRank, BuildExceedsCapacity)
+ *      - TEST(NtRank, QueryBeforeBuild)
+ *
+ * @ref ecu_ntrank_nth_child(), @ref ecu_ntrank_index_of()
+ *      - TEST(NtRank, NthChildIndexOutOfRange)
+ *      - TEST(NtRank, IndexOfNodeIsNotChild)
+ *
+ * @ref ecu_ntrank_insert_child_at()
+ *      - TEST(NtRank, InsertChildAtFront)
+ *      - TEST(NtRank, InsertChildAtMiddle)
+ *      - TEST(NtRank, InsertChildAtBack)
+ *      - TEST(NtRank, InsertChildAtIndexOutOfRange)
+ *      - TEST(NtRank, InsertChildAtChildInTree)
+ *      - TEST(NtRank, InsertChildAtExceedsCapacity)
+ *
+ * @ref ecu_ntrank_remove()
+ *      - TEST(NtRank, RemoveChild)
+ *      - TEST(NtRank, RemoveEveryChild)
+ *      - TEST(NtRank, RemoveNodeIsNotChild)
+ *
+ * All functions
+ *      - TEST(NtRank, RandomInsertsAndRemoves)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ntrank.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <deque>
+#include <random>
+#include <vector>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief C++ wrapper around tree node (@ref ecu_ntnode).
+ */
+struct node : public ecu_ntnode
+{
+    /// @brief Constructor.
+    node()
+    {
+        ecu_ntnode_ctor(this, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+    }
+};
+
+/**
+ * @brief C++ wrapper around C structure under test (@ref ecu_ntrank).
+ * Owns its slots.
+ */
+struct ntrank : public ecu_ntrank
+{
+    /// @brief Constructor.
+    ///
+    /// @param cap Number of slots. Must be a power of two.
+    explicit ntrank(std::size_t cap)
+        : slots_storage(cap)
+    {
+        ecu_ntrank_ctor(this, slots_storage.data(), cap);
+    }
+
+    /// @brief Slot array.
+    std::vector<ecu_ntrank_slot> slots_storage;
+};
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(NtRank)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Verifies @p parent's children are exactly @p expected,
+    /// in order, and that @p rank reports the same positions.
+    static void check_positions(const ecu_ntrank& rank, ecu_ntnode& parent, const std::vector<ecu_ntnode *>& expected)
+    {
+        ecu_ntnode_child_iterator iter;
+        std::size_t i = 0;
+
+        ECU_NTNODE_CHILD_FOR_EACH(c, &iter, &parent)
+        {
+            CHECK_TRUE( (i < expected.size()) );
+            POINTERS_EQUAL(expected.at(i), c);
+            POINTERS_EQUAL(c, ecu_ntrank_nth_child(&rank, i));
+            UNSIGNED_LONGS_EQUAL(i, ecu_ntrank_index_of(&rank, c));
+            i++;
+        }
+
+        UNSIGNED_LONGS_EQUAL(expected.size(), i);
+        UNSIGNED_LONGS_EQUAL(i, ecu_ntrank_count(&rank));
+        POINTERS_EQUAL(nullptr, ecu_ntrank_nth_child(&rank, i));
+    }
+};
+
+/*------------------------------------------------------------*/
+/*-------------------------- TESTS - CTOR --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Slots are found by masking the hash, so the
+ * capacity must be a power of two.
+ */
+TEST(NtRank, CtorCapacityNotPowerOfTwo)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntrank rank;
+        ecu_ntrank_slot slots[6];
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntrank_ctor(&rank, slots, 6);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - BUILD ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Every existing child is ranked at its position in
+ * the sibling list.
+ */
+TEST(NtRank, BuildRanksChildrenInOrder)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node parent;
+        std::deque<node> children(100);
+        std::vector<ecu_ntnode *> expected;
+        ntrank rank{256};
+
+        for (auto& c : children)
+        {
+            ecu_ntnode_push_child_back(&parent, &c);
+            expected.push_back(&c);
+        }
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntrank_build(&rank, &parent);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(100, count);
+        check_positions(rank, parent, expected);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Leaf can be ranked. Nothing is found by position.
+ */
+TEST(NtRank, BuildParentHasNoChildren)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node parent;
+        ntrank rank{4};
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntrank_build(&rank, &parent);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, count);
+        check_positions(rank, parent, {});
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Rebuilding over another node drops every child
+ * of the previous node.
+ */
+TEST(NtRank, BuildReplacesPreviousContents)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        N0             N3
+        |              |
+        N1-----N2      N4
+        */
+        std::deque<node> n(5);
+        ntrank rank{8};
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(2));
+        ecu_ntnode_push_child_back(&n.at(3), &n.at(4));
+        ecu_ntrank_build(&rank, &n.at(0));
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntrank_build(&rank, &n.at(3));
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(1, count);
+        check_positions(rank, n.at(3), {&n.at(4)});
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief One slot must always stay empty so lookups terminate.
+ */
+TEST(NtRank, BuildExceedsCapacity)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node parent;
+        std::deque<node> children(4);
+        ntrank rank{4};
+
+        for (auto& c : children)
+        {
+            ecu_ntnode_push_child_back(&parent, &c);
+        }
+
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntrank_build(&rank, &parent);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Rank has no node to query until it is built.
+ */
+TEST(NtRank, QueryBeforeBuild)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ntrank rank{4};
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_ntrank_nth_child(&rank, 0);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*---------------- TESTS - NTH CHILD AND INDEX OF ------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Positions past the last child return NULL.
+ */
+TEST(NtRank, NthChildIndexOutOfRange)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> n(3);
+        ntrank rank{4};
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(2));
+        ecu_ntrank_build(&rank, &n.at(0));
+
+        /* Steps 2 and 3: Action and assert. */
+        POINTERS_EQUAL(&n.at(2), ecu_ntrank_nth_child(&rank, 1));
+        POINTERS_EQUAL(nullptr, ecu_ntrank_nth_child(&rank, 2));
+        POINTERS_EQUAL(nullptr, ecu_ntrank_nth_child(&rank, 1000));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Only children of the ranked node have a position.
+ */
+TEST(NtRank, IndexOfNodeIsNotChild)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        N0
+        |
+        N1
+        |
+        N2
+        */
+        std::deque<node> n(3);
+        ntrank rank{4};
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(1), &n.at(2));
+        ecu_ntrank_build(&rank, &n.at(0));
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_ntrank_index_of(&rank, &n.at(2));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - INSERT CHILD AT ---------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Every existing child moves one position to the right.
+ */
+TEST(NtRank, InsertChildAtFront)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> n(4);
+        ntrank rank{8};
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(2));
+        ecu_ntrank_build(&rank, &n.at(0));
+
+        /* Step 2: Action. */
+        ecu_ntrank_insert_child_at(&rank, &n.at(3), 0);
+
+        /* Step 3: Assert. */
+        check_positions(rank, n.at(0), {&n.at(3), &n.at(1), &n.at(2)});
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Only children at or after the position move.
+ */
+TEST(NtRank, InsertChildAtMiddle)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> n(5);
+        ntrank rank{8};
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(2));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(3));
+        ecu_ntrank_build(&rank, &n.at(0));
+
+        /* Step 2: Action. */
+        ecu_ntrank_insert_child_at(&rank, &n.at(4), 2);
+
+        /* Step 3: Assert. */
+        check_positions(rank, n.at(0), {&n.at(1), &n.at(2), &n.at(4), &n.at(3)});
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Position equal to the number of children appends.
+ * Works on an empty rank too.
+ */
+TEST(NtRank, InsertChildAtBack)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> n(3);
+        ntrank rank{4};
+        ecu_ntrank_build(&rank, &n.at(0));
+
+        /* Step 2: Action. */
+        ecu_ntrank_insert_child_at(&rank, &n.at(1), 0);
+        ecu_ntrank_insert_child_at(&rank, &n.at(2), 1);
+
+        /* Step 3: Assert. */
+        check_positions(rank, n.at(0), {&n.at(1), &n.at(2)});
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Position cannot be past the end.
+ */
+TEST(NtRank, InsertChildAtIndexOutOfRange)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> n(3);
+        ntrank rank{4};
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntrank_build(&rank, &n.at(0));
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntrank_insert_child_at(&rank, &n.at(2), 2);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Same rules as @ref ecu_ntnode_insert_sibling_before().
+ * Node already in a tree cannot be inserted.
+ */
+TEST(NtRank, InsertChildAtChildInTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> n(3);
+        ntrank rank{4};
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(2));
+        ecu_ntrank_build(&rank, &n.at(0));
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntrank_insert_child_at(&rank, &n.at(2), 0);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief One slot must always stay empty so lookups terminate.
+ */
+TEST(NtRank, InsertChildAtExceedsCapacity)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> n(5);
+        ntrank rank{4};
+        ecu_ntrank_build(&rank, &n.at(0));
+        ecu_ntrank_insert_child_at(&rank, &n.at(1), 0);
+        ecu_ntrank_insert_child_at(&rank, &n.at(2), 1);
+        ecu_ntrank_insert_child_at(&rank, &n.at(3), 2);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntrank_insert_child_at(&rank, &n.at(4), 3);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - REMOVE --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Child leaves the tree with its subtree intact, and
+ * every later child moves one position to the left.
+ */
+TEST(NtRank, RemoveChild)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        N0
+        |
+        N1-----N2-----N3
+               |
+               N4
+        */
+        std::deque<node> n(5);
+        ntrank rank{8};
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(2));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(3));
+        ecu_ntnode_push_child_back(&n.at(2), &n.at(4));
+        ecu_ntrank_build(&rank, &n.at(0));
+
+        /* Step 2: Action. */
+        ecu_ntrank_remove(&rank, &n.at(2));
+
+        /* Step 3: Assert. */
+        check_positions(rank, n.at(0), {&n.at(1), &n.at(3)});
+        CHECK_TRUE( (ecu_ntnode_is_root(&n.at(2))) );
+        POINTERS_EQUAL(&n.at(2), ecu_ntnode_parent(&n.at(4)));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Rank can be emptied and reused.
+ */
+TEST(NtRank, RemoveEveryChild)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node parent;
+        std::deque<node> children(30);
+        ntrank rank{32};
+
+        for (auto& c : children)
+        {
+            ecu_ntnode_push_child_back(&parent, &c);
+        }
+
+        ecu_ntrank_build(&rank, &parent);
+
+        /* Step 2: Action. */
+        for (auto& c : children)
+        {
+            ecu_ntrank_remove(&rank, &c);
+        }
+
+        ecu_ntrank_insert_child_at(&rank, &children.at(5), 0);
+
+        /* Step 3: Assert. */
+        check_positions(rank, parent, {&children.at(5)});
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Only children of the ranked node can be removed.
+ */
+TEST(NtRank, RemoveNodeIsNotChild)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> n(3);
+        ntrank rank{4};
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(1), &n.at(2));
+        ecu_ntrank_build(&rank, &n.at(0));
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntrank_remove(&rank, &n.at(2));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - MIXED ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Random inserts and removes on a nearly full table, which
+ * causes long probe runs that are shifted back on every removal.
+ * Positions are compared against a plain array after every step.
+ */
+TEST(NtRank, RandomInsertsAndRemoves)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node parent;
+        std::deque<node> nodes(200);
+        std::vector<ecu_ntnode *> expected;
+        std::vector<ecu_ntnode *> spare;
+        std::mt19937 rng(7U);
+        ntrank rank{128};
+        ecu_ntrank_build(&rank, &parent);
+
+        for (auto& n : nodes)
+        {
+            spare.push_back(&n);
+        }
+
+        /* Steps 2 and 3: Action and assert. */
+        for (std::size_t step = 0; step < 2000; step++)
+        {
+            /* Fills up to 120 of 128 slots, then hovers there. */
+            bool insert = expected.empty() || ((expected.size() < 120) && ((rng() % 3) != 0));
+
+            if (insert)
+            {
+                std::size_t index = static_cast<std::size_t>(rng() % (expected.size() + 1));
+                ecu_ntnode *n = spare.back();
+                spare.pop_back();
+                ecu_ntrank_insert_child_at(&rank, n, index);
+                expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(index), n);
+            }
+            else
+            {
+                std::size_t index = static_cast<std::size_t>(rng() % expected.size());
+                ecu_ntnode *n = expected.at(index);
+                UNSIGNED_LONGS_EQUAL(index, ecu_ntrank_index_of(&rank, n));
+                ecu_ntrank_remove(&rank, n);
+                expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(index));
+                spare.push_back(n);
+            }
+
+            check_positions(rank, parent, expected);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
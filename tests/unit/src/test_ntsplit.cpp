@@ -0,0 +1,727 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref ntsplit.h.
+ * Test summary:
+ *
+ * @ref ecu_ntsplit_ctor()
+ *      - TEST(NtSplit, CtorZeroCapacity)
+ *
+ * @ref ecu_ntsplit_build(), @ref ecu_ntsplit_count()
+ *      - TEST(NtSplit, BuildWholeTreeIsOneTask)
+ *      - TEST(NtSplit, BuildSingleNode)
+ *      - TEST(NtSplit, BuildPacksSmallSiblings)
+ *      - TEST(NtSplit, BuildSplitsLargeSubtrees)
+ *      - TEST(NtSplit, BuildTasksWithinGrain)
+ *      - TEST(NtSplit, BuildReplacesPreviousTasks)
+ *      - TEST(NtSplit, BuildCapacityExhausted)
+ *      - TEST(NtSplit, BuildZeroGrain)
+ *
+ * @ref ecu_ntsplit_run(), @ref ecu_ntsplit_finish()
+ *      - TEST(NtSplit, RunAndFinishVisitEveryNodeOnce)
+ *      - TEST(NtSplit, RunOutOfRange)
+ *      - TEST(NtSplit, FinishBeforeBuild)
+ *      - TEST(NtSplit, ParallelRunMatchesSequential)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ntsplit.h"
+
+/* STDLib. */
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief C++ wrapper around tree node (@ref ecu_ntnode) that
+ * stores the results of a bottom-up aggregation.
+ */
+struct node : public ecu_ntnode
+{
+    /// @brief Constructor.
+    node()
+    {
+        ecu_ntnode_ctor(this, ECU_NTNODE_DESTROY_UNUSED, ECU_OBJECT_ID_UNUSED);
+    }
+
+    /// @brief Node's own value.
+    std::size_t value{0};
+
+    /// @brief Sum of values in this node's subtree.
+    std::size_t sum{0};
+
+    /// @brief Subtree written out in postorder. Concatenation is
+    /// associative but not commutative, so this only matches the
+    /// sequential result if children are combined in order.
+    std::string text;
+
+    /// @brief Number of times this node was visited.
+    std::size_t visits{0};
+
+    /// @brief When this node was visited, relative to other nodes.
+    std::size_t order{0};
+};
+
+/**
+ * @brief Visit callback passed to @ref ecu_ntsplit_run() and
+ * @ref ecu_ntsplit_finish(). Combines the node's children into the
+ * node. @p obj is an optional clock used to record visit order, which
+ * must be @ref ECU_NTSPLIT_OBJ_UNUSED if multiple threads are running.
+ */
+void aggregate(ecu_ntnode *me, void *obj)
+{
+    node *n = static_cast<node *>(me);
+    ecu_ntnode_child_iterator iterator;
+
+    n->sum = n->value;
+    n->text = "(";
+
+    ECU_NTNODE_CHILD_FOR_EACH(c, &iterator, me)
+    {
+        n->sum += static_cast<node *>(c)->sum;
+        n->text += static_cast<node *>(c)->text;
+    }
+
+    n->text += std::to_string(n->value) + ")";
+    n->visits++;
+
+    if (obj)
+    {
+        std::size_t *clock = static_cast<std::size_t *>(obj);
+        n->order = (*clock)++;
+    }
+}
+
+/**
+ * @brief C++ wrapper around C structure under test (@ref ecu_ntsplit).
+ * Owns its task array.
+ */
+struct ntsplit : public ecu_ntsplit
+{
+    /// @brief Constructor.
+    ///
+    /// @param cap Number of tasks that can be stored.
+    explicit ntsplit(std::size_t cap)
+        : tasks_storage(cap)
+    {
+        ecu_ntsplit_ctor(this, tasks_storage.data(), cap);
+    }
+
+    /// @brief Task array.
+    std::vector<ecu_ntsplit_task> tasks_storage;
+};
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(NtSplit)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Builds a random tree out of @p count nodes rooted at
+    /// nodes[0]. Half of all nodes extend the previous node so the
+    /// tree also has long branches. Every node's value is its position.
+    static void random_tree(std::deque<node>& nodes, std::size_t count, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        nodes.resize(count);
+
+        for (std::size_t i = 1; i < count; i++)
+        {
+            std::size_t parent = i - 1;
+
+            if (rng() % 2)
+            {
+                parent = static_cast<std::size_t>(rng() % i);
+            }
+
+            nodes.at(i).value = i;
+            ecu_ntnode_push_child_back(&nodes.at(parent), &nodes.at(i));
+        }
+    }
+
+    /// @brief Returns the number of nodes in task @p i.
+    static std::size_t task_size(const ecu_ntsplit& split, std::size_t i)
+    {
+        std::size_t total = 0;
+        ecu_ntnode_next_sibling_iterator iterator;
+
+        ECU_NTNODE_NEXT_SIBLING_AT_FOR_EACH(s, &iterator, split.tasks[i].first)
+        {
+            total += ecu_ntnode_size(s) + 1;
+
+            if (s == split.tasks[i].last)
+            {
+                break;
+            }
+        }
+
+        return total;
+    }
+
+    /// @brief Runs every task in order, then finishes the split,
+    /// all on the calling thread.
+    static void run_all(const ecu_ntsplit& split, void *obj)
+    {
+        for (std::size_t i = 0; i < ecu_ntsplit_count(&split); i++)
+        {
+            ecu_ntsplit_run(&split, i, &aggregate, obj);
+        }
+
+        ecu_ntsplit_finish(&split, &aggregate, obj);
+    }
+
+    /// @brief Verifies every node was visited exactly once and after
+    /// all of its children, and that the aggregation matches a
+    /// sequential postorder walk of the tree.
+    static void check_aggregation(std::deque<node>& nodes, bool check_order)
+    {
+        ecu_ntnode_postorder_iterator iterator;
+
+        ECU_NTNODE_POSTORDER_FOR_EACH(n, &iterator, &nodes.at(0))
+        {
+            node *actual = static_cast<node *>(n);
+            ecu_ntnode_child_iterator citerator;
+            std::size_t sum = actual->value;
+            std::string text = "(";
+
+            ECU_NTNODE_CHILD_FOR_EACH(c, &citerator, n)
+            {
+                sum += static_cast<node *>(c)->sum;
+                text += static_cast<node *>(c)->text;
+
+                if (check_order)
+                {
+                    CHECK_TRUE( (static_cast<node *>(c)->order < actual->order) );
+                }
+            }
+
+            text += std::to_string(actual->value) + ")";
+
+            UNSIGNED_LONGS_EQUAL(1, actual->visits);
+            UNSIGNED_LONGS_EQUAL(sum, actual->sum);
+            STRCMP_EQUAL(text.c_str(), actual->text.c_str());
+        }
+    }
+};
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - CTOR ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Task array must hold at least one task.
+ */
+TEST(NtSplit, CtorZeroCapacity)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ntsplit split;
+        ecu_ntsplit_task tasks[1];
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntsplit_ctor(&split, tasks, 0);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - BUILD ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Tree no bigger than the grain is a single task, and
+ * finish has nothing left to visit.
+ */
+TEST(NtSplit, BuildWholeTreeIsOneTask)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        N0
+        |
+        N1-----N2
+        */
+        std::deque<node> n(3);
+        ntsplit split{4};
+        std::size_t clock = 0;
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(2));
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntsplit_build(&split, &n.at(0), 3);
+        ecu_ntsplit_finish(&split, &aggregate, &clock);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(1, count);
+        UNSIGNED_LONGS_EQUAL(1, ecu_ntsplit_count(&split));
+        POINTERS_EQUAL(&n.at(0), split.tasks[0].first);
+        POINTERS_EQUAL(&n.at(0), split.tasks[0].last);
+        UNSIGNED_LONGS_EQUAL(0, clock);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Lone node is a single task.
+ */
+TEST(NtSplit, BuildSingleNode)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node root;
+        ntsplit split{1};
+        std::size_t clock = 0;
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntsplit_build(&split, &root, 1);
+        ecu_ntsplit_run(&split, 0, &aggregate, &clock);
+        ecu_ntsplit_finish(&split, &aggregate, &clock);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(1, count);
+        POINTERS_EQUAL(&root, split.tasks[0].first);
+        POINTERS_EQUAL(&root, split.tasks[0].last);
+        UNSIGNED_LONGS_EQUAL(1, root.visits);
+        UNSIGNED_LONGS_EQUAL(1, clock);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Consecutive siblings are packed into the same task
+ * until the task would exceed the grain.
+ */
+TEST(NtSplit, BuildPacksSmallSiblings)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        N0
+        |
+        N1-----N2-----N3-----N4-----N5
+        */
+        std::deque<node> n(6);
+        ntsplit split{4};
+        std::size_t clock = 0;
+
+        for (std::size_t i = 1; i < 6; i++)
+        {
+            n.at(i).value = i;
+            ecu_ntnode_push_child_back(&n.at(0), &n.at(i));
+        }
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntsplit_build(&split, &n.at(0), 2);
+        run_all(split, &clock);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(3, count);
+        POINTERS_EQUAL(&n.at(1), split.tasks[0].first);
+        POINTERS_EQUAL(&n.at(2), split.tasks[0].last);
+        POINTERS_EQUAL(&n.at(3), split.tasks[1].first);
+        POINTERS_EQUAL(&n.at(4), split.tasks[1].last);
+        POINTERS_EQUAL(&n.at(5), split.tasks[2].first);
+        POINTERS_EQUAL(&n.at(5), split.tasks[2].last);
+        check_aggregation(n, true);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Subtrees bigger than the grain are not tasks. Their
+ * children are split instead and the subtree root is left for
+ * finish, which visits it after its children.
+ */
+TEST(NtSplit, BuildSplitsLargeSubtrees)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        N0
+        |
+        N1-------------N4-----N5
+        |                     |
+        N2-----N3             N6
+        */
+        std::deque<node> n(7);
+        ntsplit split{4};
+        std::size_t clock = 0;
+
+        for (std::size_t i = 0; i < 7; i++)
+        {
+            n.at(i).value = i;
+        }
+
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(1));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(4));
+        ecu_ntnode_push_child_back(&n.at(0), &n.at(5));
+        ecu_ntnode_push_child_back(&n.at(1), &n.at(2));
+        ecu_ntnode_push_child_back(&n.at(1), &n.at(3));
+        ecu_ntnode_push_child_back(&n.at(5), &n.at(6));
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntsplit_build(&split, &n.at(0), 2);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            ecu_ntsplit_run(&split, i, &aggregate, &clock);
+        }
+
+        std::size_t before_finish = clock;
+        ecu_ntsplit_finish(&split, &aggregate, &clock);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(3, count);
+        POINTERS_EQUAL(&n.at(2), split.tasks[0].first);
+        POINTERS_EQUAL(&n.at(3), split.tasks[0].last);
+        POINTERS_EQUAL(&n.at(4), split.tasks[1].first);
+        POINTERS_EQUAL(&n.at(4), split.tasks[1].last);
+        POINTERS_EQUAL(&n.at(5), split.tasks[2].first);
+        POINTERS_EQUAL(&n.at(5), split.tasks[2].last);
+        UNSIGNED_LONGS_EQUAL(before_finish, n.at(1).order);
+        UNSIGNED_LONGS_EQUAL(before_finish + 1, n.at(0).order);
+        check_aggregation(n, true);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief No task has more nodes than the grain, and tasks are
+ * stored in preorder of their first node.
+ */
+TEST(NtSplit, BuildTasksWithinGrain)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 300, 1U);
+        ntsplit split{300};
+
+        for (std::size_t grain : {1U, 2U, 5U, 17U, 64U})
+        {
+            ecu_ntnode_preorder_iterator iterator;
+            std::size_t next = 0;
+
+            /* Step 2: Action. */
+            std::size_t count = ecu_ntsplit_build(&split, &nodes.at(0), grain);
+
+            /* Step 3: Assert. */
+            CHECK_TRUE( (count > 0) );
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                CHECK_TRUE( (task_size(split, i) <= grain) );
+            }
+
+            ECU_NTNODE_PREORDER_FOR_EACH(n, &iterator, &nodes.at(0))
+            {
+                if ((next < count) && (n == split.tasks[next].first))
+                {
+                    next++;
+                }
+            }
+
+            UNSIGNED_LONGS_EQUAL(count, next);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Rebuilding discards the previous tasks.
+ */
+TEST(NtSplit, BuildReplacesPreviousTasks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::deque<node> nodes;
+        random_tree(nodes, 50, 2U);
+        ntsplit split{50};
+        std::size_t clock = 0;
+        CHECK_TRUE( (ecu_ntsplit_build(&split, &nodes.at(0), 1) > 1) );
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntsplit_build(&split, &nodes.at(0), 50);
+        run_all(split, &clock);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(1, count);
+        POINTERS_EQUAL(&nodes.at(0), split.tasks[0].first);
+        check_aggregation(nodes, true);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Once the task array is full, the remaining nodes are
+ * left for finish so every node is still visited once.
+ */
+TEST(NtSplit, BuildCapacityExhausted)
+{
+    try
+    {
+        /* Step 1: Arrange.
+        N0
+        |
+        N1-----N2-----N3-----N4-----N5
+        */
+        std::deque<node> n(6);
+        ntsplit split{2};
+        std::size_t clock = 0;
+
+        for (std::size_t i = 1; i < 6; i++)
+        {
+            n.at(i).value = i;
+            ecu_ntnode_push_child_back(&n.at(0), &n.at(i));
+        }
+
+        /* Step 2: Action. */
+        std::size_t count = ecu_ntsplit_build(&split, &n.at(0), 1);
+        run_all(split, &clock);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(2, count);
+        POINTERS_EQUAL(&n.at(1), split.tasks[0].first);
+        POINTERS_EQUAL(&n.at(2), split.tasks[1].first);
+        UNSIGNED_LONGS_EQUAL(6, clock);
+        check_aggregation(n, true);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Grain must allow at least one node per task.
+ */
+TEST(NtSplit, BuildZeroGrain)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node root;
+        ntsplit split{1};
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        (void)ecu_ntsplit_build(&split, &root, 0);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - RUN AND FINISH ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Tasks plus finish visit every node exactly once, always
+ * after its children, for every grain.
+ */
+TEST(NtSplit, RunAndFinishVisitEveryNodeOnce)
+{
+    try
+    {
+        for (std::size_t grain : {1U, 3U, 8U, 40U, 500U})
+        {
+            /* Step 1: Arrange. */
+            std::deque<node> nodes;
+            random_tree(nodes, 400, static_cast<unsigned>(grain));
+            ntsplit split{400};
+            std::size_t clock = 0;
+
+            /* Step 2: Action. */
+            (void)ecu_ntsplit_build(&split, &nodes.at(0), grain);
+            run_all(split, &clock);
+
+            /* Step 3: Assert. */
+            UNSIGNED_LONGS_EQUAL(400, clock);
+            check_aggregation(nodes, true);
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Task index must be less than the task count.
+ */
+TEST(NtSplit, RunOutOfRange)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        node root;
+        ntsplit split{2};
+        (void)ecu_ntsplit_build(&split, &root, 1);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntsplit_run(&split, 1, &aggregate, ECU_NTSPLIT_OBJ_UNUSED);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Split must be built before it is finished.
+ */
+TEST(NtSplit, FinishBeforeBuild)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ntsplit split{1};
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ntsplit_finish(&split, &aggregate, ECU_NTSPLIT_OBJ_UNUSED);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Worker threads pull task indices from a shared counter,
+ * so tasks finish in an arbitrary order. Results still match a
+ * sequential walk exactly, including the order-sensitive text.
+ */
+TEST(NtSplit, ParallelRunMatchesSequential)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        static constexpr std::size_t THREADS = 4;
+        std::deque<node> nodes;
+        random_tree(nodes, 2000, 3U);
+        ntsplit split{256};
+        std::atomic<std::size_t> next{0};
+        std::vector<std::thread> workers;
+        std::size_t count = ecu_ntsplit_build(&split, &nodes.at(0), 50);
+        CHECK_TRUE( (count > THREADS) );
+
+        /* Step 2: Action. */
+        for (std::size_t t = 0; t < THREADS; t++)
+        {
+            workers.emplace_back([&]() {
+                for (std::size_t i = next++; i < count; i = next++)
+                {
+                    ecu_ntsplit_run(&split, i, &aggregate, ECU_NTSPLIT_OBJ_UNUSED);
+                }
+            });
+        }
+
+        for (auto& w : workers)
+        {
+            w.join();
+        }
+
+        ecu_ntsplit_finish(&split, &aggregate, ECU_NTSPLIT_OBJ_UNUSED);
+
+        /* Step 3: Assert. */
+        check_aggregation(nodes, false);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
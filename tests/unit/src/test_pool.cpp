@@ -0,0 +1,909 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref pool.h.
+ * Test summary:
+ *
+ * @ref ecu_pool_ctor()
+ *      - TEST(Pool, CtorAlignsBlocks)
+ *      - TEST(Pool, CtorRoundsUpBlockSize)
+ *      - TEST(Pool, CtorBufferTooSmall)
+ *      - TEST(Pool, CtorClearsStats)
+ *
+ * @ref ecu_pool_alloc(), @ref ecu_pool_available()
+ *      - TEST(Pool, AllocUntilEmpty)
+ *      - TEST(Pool, AllocDoesNotOverlap)
+ *
+ * @ref ecu_pool_free()
+ *      - TEST(Pool, FreeThenAllocReusesBlock)
+ *      - TEST(Pool, FreeInteriorPointer)
+ *      - TEST(Pool, FreeForeignPointer)
+ *      - TEST(Pool, FreeWhenNothingAllocated)
+ *
+ * @ref ecu_pool_owns()
+ *      - TEST(Pool, Owns)
+ *
+ * Statistics:
+ *      - TEST(Pool, StatsHighWaterAndFailures)
+ *
+ * Destroy callback integration:
+ *      - TEST(Pool, NtNodeDestroyReturnsTreeToPool)
+ *      - TEST(Pool, DListDestroyReturnsNodesToPool)
+ *
+ * @ref ecu_lfpool_ctor(), @ref ecu_lfpool_alloc(), @ref ecu_lfpool_free(),
+ * @ref ecu_lfpool_owns()
+ *      - TEST(Pool, LfpoolAllocUntilEmpty)
+ *      - TEST(Pool, LfpoolLinksOutsideBlocks)
+ *      - TEST(Pool, LfpoolFreeInteriorPointer)
+ *      - TEST(Pool, LfpoolFreeForeignPointer)
+ *      - TEST(Pool, LfpoolStats)
+ *
+ * Concurrency stress tests. Build with the linux_tsan preset to also
+ * run these under ThreadSanitizer:
+ *      - TEST(Pool, LfpoolStressAllocFree)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/pool.h"
+
+/* STDLib. */
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <set>
+#include <thread>
+#include <vector>
+
+/* ECU. */
+#include "ecu/dlist.h"
+#include "ecu/ntnode.h"
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief Destroy callbacks do not take a context so they
+ * reach the pool through this.
+ */
+ecu_pool *node_pool = nullptr;
+
+/**
+ * @brief User-defined tree node allocated from a pool.
+ * Node is intentionally the first member so the pool's free
+ * list overwrites it when the block is freed.
+ */
+struct tree_node
+{
+    /// @brief Intrusive tree node.
+    ecu_ntnode node;
+
+    /// @brief User data.
+    int data{0};
+};
+
+/**
+ * @brief User-defined list node allocated from a pool.
+ */
+struct list_node
+{
+    /// @brief User data.
+    int data{0};
+
+    /// @brief Intrusive list node.
+    ecu_dnode dnode;
+};
+
+/**
+ * @brief Returns destroyed tree nodes to @ref node_pool.
+ */
+void tree_node_destroy(ecu_ntnode *me, ecu_object_id_t id)
+{
+    (void)id;
+    ecu_pool_free(node_pool, me);
+}
+
+/**
+ * @brief Returns destroyed list nodes to @ref node_pool.
+ */
+void list_node_destroy(ecu_dnode *me, ecu_object_id_t id)
+{
+    (void)id;
+    ecu_pool_free(node_pool, me);
+}
+
+/**
+ * @brief Returns true if @p ptr is aligned to @ref ECU_POOL_ALIGNMENT.
+ */
+bool aligned(const void *ptr)
+{
+    return ((reinterpret_cast<std::uintptr_t>(ptr) % ECU_POOL_ALIGNMENT) == 0);
+}
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(Pool)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+        node_pool = &pool;
+    }
+
+    void teardown() override
+    {
+        node_pool = nullptr;
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Allocates every block in @p me and verifies they are
+    /// aligned, distinct, and handed out in address order.
+    static std::vector<void *> ALLOC_ALL(ecu_pool *me)
+    {
+        std::vector<void *> blocks;
+        void *block = ecu_pool_alloc(me);
+
+        while (block)
+        {
+            CHECK_TRUE( (aligned(block)) );
+            CHECK_TRUE( (blocks.empty() || (block > blocks.back())) );
+            blocks.push_back(block);
+            block = ecu_pool_alloc(me);
+        }
+
+        UNSIGNED_LONGS_EQUAL(ecu_pool_capacity(me), blocks.size());
+        UNSIGNED_LONGS_EQUAL(0, ecu_pool_available(me));
+        return blocks;
+    }
+
+    /// @brief Number of blocks in the test pools.
+    static constexpr std::size_t BLOCKS{8};
+
+    /// @brief Bytes requested per block. Deliberately not a
+    /// multiple of @ref ECU_POOL_ALIGNMENT.
+    static constexpr std::size_t BLOCK_SIZE{24};
+
+    /// @brief Backing memory of @ref pool. Over-aligned so tests can
+    /// offset it by a known amount.
+    alignas(ECU_POOL_ALIGNMENT) std::uint8_t buffer[ECU_POOL_BUFFER_SIZE(BLOCK_SIZE, BLOCKS)];
+
+    /// @brief Backing memory of @ref lfpool.
+    alignas(ECU_POOL_ALIGNMENT) std::uint8_t lfbuffer[ECU_LFPOOL_BUFFER_SIZE(BLOCK_SIZE, BLOCKS)];
+
+    /// @brief Pool under test.
+    ecu_pool pool;
+
+    /// @brief Lock-free pool under test.
+    ecu_lfpool lfpool;
+
+    /// @brief Statistics under test.
+    ecu_pool_stats stats;
+};
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - POOL CTOR ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Misaligned buffer is aligned before blocks are carved
+ * from it. @ref ECU_POOL_BUFFER_SIZE() leaves enough room for
+ * the worst case padding.
+ */
+TEST(Pool, CtorAlignsBlocks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::size_t size = ECU_POOL_BUFFER_SIZE(BLOCK_SIZE, BLOCKS - 1);
+
+        /* Step 2: Action. */
+        ecu_pool_ctor(&pool, &buffer[1], size, BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(BLOCKS - 1, ecu_pool_capacity(&pool));
+        UNSIGNED_LONGS_EQUAL(BLOCKS - 1, ecu_pool_available(&pool));
+        std::vector<void *> blocks = ALLOC_ALL(&pool);
+        POINTERS_EQUAL(&buffer[ECU_POOL_ALIGNMENT], blocks.front());
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Blocks never share a cache line, even if the user
+ * requests less than one.
+ */
+TEST(Pool, CtorRoundsUpBlockSize)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_pool_ctor(&pool, &buffer[0], sizeof(buffer), 1, ECU_POOL_STATS_UNUSED);
+
+        /* Step 2: Action. */
+        std::vector<void *> blocks = ALLOC_ALL(&pool);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(sizeof(buffer) / ECU_POOL_ALIGNMENT, blocks.size());
+
+        for (std::size_t i = 1; i < blocks.size(); i++)
+        {
+            UNSIGNED_LONGS_EQUAL(ECU_POOL_ALIGNMENT,
+                                 static_cast<std::uint8_t *>(blocks.at(i)) - static_cast<std::uint8_t *>(blocks.at(i - 1)));
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Buffer must hold at least one
+ * block after it is aligned.
+ */
+TEST(Pool, CtorBufferTooSmall)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_pool_ctor(&pool, &buffer[1], ECU_POOL_ALIGNMENT, BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Statistics are reset when passed into the constructor.
+ */
+TEST(Pool, CtorClearsStats)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        stats.in_use = 1;
+        stats.high_water = 2;
+        stats.failures = 3;
+
+        /* Step 2: Action. */
+        ecu_pool_ctor(&pool, &buffer[0], sizeof(buffer), BLOCK_SIZE, &stats);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, stats.in_use);
+        UNSIGNED_LONGS_EQUAL(0, stats.high_water);
+        UNSIGNED_LONGS_EQUAL(0, stats.failures);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - POOL ALLOC ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Every block is handed out once. NULL returned
+ * afterwards.
+ */
+TEST(Pool, AllocUntilEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_pool_ctor(&pool, &buffer[0], sizeof(buffer), BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+
+        /* Step 2: Action. */
+        for (std::size_t i = 0; i < BLOCKS; i++)
+        {
+            CHECK_TRUE( (ecu_pool_alloc(&pool) != nullptr) );
+            UNSIGNED_LONGS_EQUAL(BLOCKS - i - 1, ecu_pool_available(&pool));
+        }
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(nullptr, ecu_pool_alloc(&pool));
+        POINTERS_EQUAL(nullptr, ecu_pool_alloc(&pool));
+        UNSIGNED_LONGS_EQUAL(0, ecu_pool_available(&pool));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Writing every byte of a block does not corrupt
+ * other blocks or the pool.
+ */
+TEST(Pool, AllocDoesNotOverlap)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_pool_ctor(&pool, &buffer[0], sizeof(buffer), BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+        std::vector<void *> blocks = ALLOC_ALL(&pool);
+
+        /* Step 2: Action. */
+        for (std::size_t i = 0; i < blocks.size(); i++)
+        {
+            std::memset(blocks.at(i), static_cast<int>(i), BLOCK_SIZE);
+        }
+
+        /* Step 3: Assert. Free in reverse so blocks are reallocated in address order. */
+        for (std::size_t i = blocks.size(); i > 0; i--)
+        {
+            const std::uint8_t *b = static_cast<const std::uint8_t *>(blocks.at(i - 1));
+            CHECK_TRUE( (std::all_of(b, b + BLOCK_SIZE, [i](std::uint8_t v) { return v == (i - 1); })) );
+            ecu_pool_free(&pool, blocks.at(i - 1));
+        }
+
+        UNSIGNED_LONGS_EQUAL(BLOCKS, ecu_pool_available(&pool));
+        (void)ALLOC_ALL(&pool);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - POOL FREE ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Most recently freed block is allocated next
+ * since it is most likely still in cache.
+ */
+TEST(Pool, FreeThenAllocReusesBlock)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_pool_ctor(&pool, &buffer[0], sizeof(buffer), BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+        void *b0 = ecu_pool_alloc(&pool);
+        void *b1 = ecu_pool_alloc(&pool);
+        void *b2 = ecu_pool_alloc(&pool);
+
+        /* Step 2: Action. */
+        ecu_pool_free(&pool, b0);
+        ecu_pool_free(&pool, b2);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(BLOCKS - 1, ecu_pool_available(&pool));
+        POINTERS_EQUAL(b2, ecu_pool_alloc(&pool));
+        POINTERS_EQUAL(b0, ecu_pool_alloc(&pool));
+        CHECK_TRUE( (ecu_pool_alloc(&pool) > b1) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Pointer anywhere inside a block frees the whole
+ * block. Lets destroy callbacks pass their intrusive node.
+ */
+TEST(Pool, FreeInteriorPointer)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_pool_ctor(&pool, &buffer[0], sizeof(buffer), BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+        std::uint8_t *block = static_cast<std::uint8_t *>(ecu_pool_alloc(&pool));
+
+        /* Step 2: Action. */
+        ecu_pool_free(&pool, &block[ECU_POOL_BLOCK_SIZE(BLOCK_SIZE) - 1]);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(BLOCKS, ecu_pool_available(&pool));
+        POINTERS_EQUAL(block, ecu_pool_alloc(&pool));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Pointer does not belong to the pool.
+ */
+TEST(Pool, FreeForeignPointer)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_pool_ctor(&pool, &buffer[0], sizeof(buffer), BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+        (void)ecu_pool_alloc(&pool);
+        int other = 0;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_pool_free(&pool, &other);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Catches double frees once every
+ * block is back in the pool.
+ */
+TEST(Pool, FreeWhenNothingAllocated)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_pool_ctor(&pool, &buffer[0], sizeof(buffer), BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+        void *block = ecu_pool_alloc(&pool);
+        ecu_pool_free(&pool, block);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_pool_free(&pool, block);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - POOL OWNS ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Only pointers into blocks are owned. Alignment
+ * padding before the first block is not.
+ */
+TEST(Pool, Owns)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_pool_ctor(&pool, &buffer[1], sizeof(buffer) - 1, BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+        std::vector<void *> blocks = ALLOC_ALL(&pool);
+        const std::uint8_t *last = static_cast<const std::uint8_t *>(blocks.back());
+        int other = 0;
+
+        /* Steps 2 and 3: Action and assert. */
+        for (void *b : blocks)
+        {
+            CHECK_TRUE( (ecu_pool_owns(&pool, b)) );
+        }
+
+        CHECK_TRUE( (ecu_pool_owns(&pool, &last[ECU_POOL_BLOCK_SIZE(BLOCK_SIZE) - 1])) );
+        CHECK_FALSE( (ecu_pool_owns(&pool, &last[ECU_POOL_BLOCK_SIZE(BLOCK_SIZE)])) );
+        CHECK_FALSE( (ecu_pool_owns(&pool, &buffer[1])) );
+        CHECK_FALSE( (ecu_pool_owns(&pool, &other)) );
+        CHECK_FALSE( (ecu_pool_owns(&pool, nullptr)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - POOL STATS --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief High-water mark keeps the peak after blocks are
+ * freed. Every allocation from an empty pool is a failure.
+ */
+TEST(Pool, StatsHighWaterAndFailures)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_pool_ctor(&pool, &buffer[0], sizeof(buffer), BLOCK_SIZE, &stats);
+        std::vector<void *> blocks = ALLOC_ALL(&pool);
+
+        /* Step 2: Action. */
+        POINTERS_EQUAL(nullptr, ecu_pool_alloc(&pool));
+
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            ecu_pool_free(&pool, blocks.at(i));
+        }
+
+        (void)ecu_pool_alloc(&pool);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(BLOCKS - 2, stats.in_use);
+        UNSIGNED_LONGS_EQUAL(BLOCKS, stats.high_water);
+        UNSIGNED_LONGS_EQUAL(2, stats.failures);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*---------------- TESTS - DESTROY INTEGRATION ---------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Destroying a tree returns every node to the pool
+ * through the nodes' destroy callbacks.
+ *
+ * @verbatim
+ *          n0
+ *          |
+ *          n1-----n2
+ *          |
+ *          n3
+ * @endverbatim
+ */
+TEST(Pool, NtNodeDestroyReturnsTreeToPool)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        alignas(ECU_POOL_ALIGNMENT) std::uint8_t tree_buffer[ECU_POOL_BUFFER_SIZE(sizeof(tree_node), 4)];
+        ecu_pool_ctor(&pool, &tree_buffer[0], sizeof(tree_buffer), sizeof(tree_node), &stats);
+        std::vector<tree_node *> n;
+
+        for (std::size_t i = 0; i < 4; i++)
+        {
+            n.push_back(new (ecu_pool_alloc(&pool)) tree_node);
+            ecu_ntnode_ctor(&n.back()->node, &tree_node_destroy, static_cast<ecu_object_id_t>(i));
+        }
+
+        ecu_ntnode_push_child_back(&n.at(0)->node, &n.at(1)->node);
+        ecu_ntnode_push_child_back(&n.at(0)->node, &n.at(2)->node);
+        ecu_ntnode_push_child_back(&n.at(1)->node, &n.at(3)->node);
+
+        /* Step 2: Action. */
+        ecu_ntnode_destroy(&n.at(0)->node);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(4, ecu_pool_available(&pool));
+        UNSIGNED_LONGS_EQUAL(0, stats.in_use);
+        UNSIGNED_LONGS_EQUAL(4, stats.high_water);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroying a list returns every node to the pool
+ * through the nodes' destroy callbacks.
+ */
+TEST(Pool, DListDestroyReturnsNodesToPool)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_pool_ctor(&pool, &buffer[0], sizeof(buffer), sizeof(list_node), ECU_POOL_STATS_UNUSED);
+        ecu_dlist list;
+        ecu_dlist_ctor(&list);
+        void *block = ecu_pool_alloc(&pool);
+
+        while (block)
+        {
+            list_node *n = new (block) list_node;
+            ecu_dnode_ctor(&n->dnode, &list_node_destroy, ECU_OBJECT_ID_UNUSED);
+            ecu_dlist_push_back(&list, &n->dnode);
+            block = ecu_pool_alloc(&pool);
+        }
+
+        /* Step 2: Action. */
+        ecu_dlist_destroy(&list);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(ecu_pool_capacity(&pool), ecu_pool_available(&pool));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------------- TESTS - LFPOOL ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Every block is handed out once. NULL returned
+ * afterwards. Freed blocks can be allocated again.
+ */
+TEST(Pool, LfpoolAllocUntilEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_lfpool_ctor(&lfpool, &lfbuffer[0], sizeof(lfbuffer), BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+        std::set<void *> blocks;
+
+        /* Step 2: Action. */
+        for (std::size_t i = 0; i < BLOCKS; i++)
+        {
+            void *block = ecu_lfpool_alloc(&lfpool);
+            CHECK_TRUE( (block != nullptr) );
+            CHECK_TRUE( (aligned(block)) );
+            CHECK_TRUE( (blocks.insert(block).second) );
+        }
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(BLOCKS, ecu_lfpool_capacity(&lfpool));
+        POINTERS_EQUAL(nullptr, ecu_lfpool_alloc(&lfpool));
+        ecu_lfpool_free(&lfpool, *blocks.begin());
+        POINTERS_EQUAL(*blocks.begin(), ecu_lfpool_alloc(&lfpool));
+        POINTERS_EQUAL(nullptr, ecu_lfpool_alloc(&lfpool));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Free list links are stored outside of the blocks,
+ * so user data in a freed block is left untouched.
+ */
+TEST(Pool, LfpoolLinksOutsideBlocks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_lfpool_ctor(&lfpool, &lfbuffer[0], sizeof(lfbuffer), BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+        std::vector<void *> blocks;
+
+        for (std::size_t i = 0; i < BLOCKS; i++)
+        {
+            blocks.push_back(ecu_lfpool_alloc(&lfpool));
+            std::memset(blocks.back(), 0xA5, ECU_POOL_BLOCK_SIZE(BLOCK_SIZE));
+        }
+
+        /* Step 2: Action. */
+        for (void *b : blocks)
+        {
+            ecu_lfpool_free(&lfpool, b);
+        }
+
+        /* Step 3: Assert. */
+        for (void *b : blocks)
+        {
+            const std::uint8_t *p = static_cast<const std::uint8_t *>(b);
+            CHECK_TRUE( (std::all_of(p, p + ECU_POOL_BLOCK_SIZE(BLOCK_SIZE), [](std::uint8_t v) { return v == 0xA5; })) );
+        }
+
+        for (std::size_t i = 0; i < BLOCKS; i++)
+        {
+            CHECK_TRUE( (ecu_lfpool_alloc(&lfpool) != nullptr) );
+        }
+
+        POINTERS_EQUAL(nullptr, ecu_lfpool_alloc(&lfpool));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Pointer anywhere inside a block frees the whole block.
+ */
+TEST(Pool, LfpoolFreeInteriorPointer)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_lfpool_ctor(&lfpool, &lfbuffer[0], sizeof(lfbuffer), BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+        std::uint8_t *block = static_cast<std::uint8_t *>(ecu_lfpool_alloc(&lfpool));
+
+        /* Step 2: Action. */
+        ecu_lfpool_free(&lfpool, &block[BLOCK_SIZE]);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (ecu_lfpool_owns(&lfpool, &block[BLOCK_SIZE])) );
+        POINTERS_EQUAL(block, ecu_lfpool_alloc(&lfpool));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Pointer does not belong to the pool.
+ * Links stored after the blocks are not owned either.
+ */
+TEST(Pool, LfpoolFreeForeignPointer)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_lfpool_ctor(&lfpool, &lfbuffer[0], sizeof(lfbuffer), BLOCK_SIZE, ECU_POOL_STATS_UNUSED);
+        (void)ecu_lfpool_alloc(&lfpool);
+        CHECK_FALSE( (ecu_lfpool_owns(&lfpool, &lfbuffer[sizeof(lfbuffer) - 1])) );
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_lfpool_free(&lfpool, &lfbuffer[sizeof(lfbuffer) - 1]);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Same statistics as @ref ecu_pool.
+ */
+TEST(Pool, LfpoolStats)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_lfpool_ctor(&lfpool, &lfbuffer[0], sizeof(lfbuffer), BLOCK_SIZE, &stats);
+        std::vector<void *> blocks;
+
+        for (std::size_t i = 0; i < BLOCKS; i++)
+        {
+            blocks.push_back(ecu_lfpool_alloc(&lfpool));
+        }
+
+        /* Step 2: Action. */
+        POINTERS_EQUAL(nullptr, ecu_lfpool_alloc(&lfpool));
+        ecu_lfpool_free(&lfpool, blocks.at(0));
+        ecu_lfpool_free(&lfpool, blocks.at(1));
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(BLOCKS - 2, stats.in_use);
+        UNSIGNED_LONGS_EQUAL(BLOCKS, stats.high_water);
+        UNSIGNED_LONGS_EQUAL(1, stats.failures);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*---------------- TESTS - LFPOOL CONCURRENCY ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief More threads than blocks repeatedly allocate, write,
+ * and free. A block is never handed to two threads at once
+ * and every block is back in the pool afterwards.
+ */
+TEST(Pool, LfpoolStressAllocFree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        constexpr std::size_t THREADS{8};
+        constexpr std::size_t ITERATIONS{20000};
+        ecu_lfpool_ctor(&lfpool, &lfbuffer[0], sizeof(lfbuffer), BLOCK_SIZE, &stats);
+        std::vector<std::thread> threads;
+        std::atomic<bool> go{false};
+        std::atomic<std::size_t> collisions{0};
+
+        /* Step 2: Action. */
+        for (std::size_t t = 0; t < THREADS; t++)
+        {
+            threads.emplace_back([&, t]() {
+                while (!go.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (std::size_t i = 0; i < ITERATIONS; i++)
+                {
+                    std::size_t *block = static_cast<std::size_t *>(ecu_lfpool_alloc(&lfpool));
+
+                    if (block)
+                    {
+                        *block = t;
+                        std::this_thread::yield();
+
+                        if (*block != t)
+                        {
+                            collisions.fetch_add(1, std::memory_order_relaxed);
+                        }
+
+                        ecu_lfpool_free(&lfpool, block);
+                    }
+                }
+            });
+        }
+
+        go.store(true, std::memory_order_release);
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, collisions.load());
+        UNSIGNED_LONGS_EQUAL(0, stats.in_use);
+        CHECK_TRUE( (stats.high_water <= BLOCKS) );
+
+        for (std::size_t i = 0; i < BLOCKS; i++)
+        {
+            CHECK_TRUE( (ecu_lfpool_alloc(&lfpool) != nullptr) );
+        }
+
+        POINTERS_EQUAL(nullptr, ecu_lfpool_alloc(&lfpool));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
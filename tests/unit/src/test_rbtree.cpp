@@ -0,0 +1,1131 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref rbtree.h.
+ * Test summary:
+ *
+ * @ref ecu_rbnode_ctor(), @ref ecu_rbtree_ctor()
+ *      - TEST(RBTree, NodeCtorInvalidId)
+ *      - TEST(RBTree, CtorNoCondition)
+ *
+ * @ref ecu_rbtree_insert()
+ *      - TEST(RBTree, InsertAscending)
+ *      - TEST(RBTree, InsertDescending)
+ *      - TEST(RBTree, InsertDuplicatesStable)
+ *      - TEST(RBTree, InsertNodeAlreadyInTree)
+ *
+ * @ref ecu_rbnode_remove(), @ref ecu_rbtree_pop_min()
+ *      - TEST(RBTree, RemoveUpdatesMinAndMax)
+ *      - TEST(RBTree, RemoveNodeNotInTree)
+ *      - TEST(RBTree, RandomInsertAndRemove)
+ *      - TEST(RBTree, PopMinSortedOrder)
+ *      - TEST(RBTree, PopMinEmptyTree)
+ *
+ * @ref ecu_rbtree_find(), @ref ecu_rbtree_lower_bound(), @ref ecu_rbtree_upper_bound()
+ *      - TEST(RBTree, Find)
+ *      - TEST(RBTree, FindDuplicatesReturnsFirst)
+ *      - TEST(RBTree, LowerAndUpperBound)
+ *      - TEST(RBTree, BoundsEmptyTree)
+ *
+ * @ref ecu_rbnode_next(), @ref ecu_rbnode_prev()
+ *      - TEST(RBTree, NextAndPrev)
+ *      - TEST(RBTree, NextAndPrevNodeNotInTree)
+ *
+ * @ref ECU_RBTREE_FOR_EACH(), @ref ECU_RBTREE_CONST_FOR_EACH(), @ref ECU_RBTREE_AT_FOR_EACH()
+ *      - TEST(RBTree, IteratorEmptyTree)
+ *      - TEST(RBTree, ConstIterator)
+ *      - TEST(RBTree, IteratorRemoveSome)
+ *      - TEST(RBTree, IteratorRemoveAll)
+ *      - TEST(RBTree, AtIteratorRange)
+ *      - TEST(RBTree, AtIteratorNodeNotInTree)
+ *
+ * @ref ecu_rbtree_clear(), @ref ecu_rbtree_destroy(), @ref ecu_rbnode_destroy()
+ *      - TEST(RBTree, ClearDetachesNodes)
+ *      - TEST(RBTree, DestroyCallsCallbacks)
+ *      - TEST(RBTree, NodeDestroyRemovesFromTree)
+ *      - TEST(RBTree, UseTreeAfterDestroy)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/rbtree.h"
+
+/* STDLib. */
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <random>
+#include <set>
+#include <vector>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief Mock destroy callback passed to @ref ecu_rbnode_ctor().
+ */
+void node_destroy(ecu_rbnode *me, ecu_object_id_t id)
+{
+    (void)me;
+    mock().actualCall("node_destroy")
+          .withParameter("id", id);
+}
+
+/**
+ * @brief C++ wrapper around C structure under test (@ref ecu_rbnode).
+ * Only @ref key is compared. @ref sequence records insertion order.
+ */
+struct entry : public ecu_rbnode
+{
+    /// @brief Constructor.
+    ///
+    /// @param k Sorting key.
+    /// @param seq Order the entry was inserted in.
+    /// @param destroy_cb Optional destroy callback.
+    /// @param node_id Optional node ID.
+    explicit entry(int k,
+                   int seq = 0,
+                   void (*destroy_cb)(ecu_rbnode *, ecu_object_id_t) = ECU_RBNODE_DESTROY_UNUSED,
+                   ecu_object_id_t node_id = ECU_VALID_OBJECT_ID_BEGIN)
+        : key(k),
+          sequence(seq)
+    {
+        ecu_rbnode_ctor(this, destroy_cb, node_id);
+    }
+
+    /// @brief Sorting key.
+    int key;
+
+    /// @brief Order the entry was inserted in.
+    int sequence;
+};
+
+/**
+ * @brief Sorting condition for @ref entry nodes.
+ */
+bool key_less_than(const ecu_rbnode *lhs, const ecu_rbnode *rhs, void *data)
+{
+    (void)data;
+    return (static_cast<const entry *>(lhs)->key < static_cast<const entry *>(rhs)->key);
+}
+
+/**
+ * @brief C++ wrapper around C structure under test (@ref ecu_rbtree).
+ */
+struct rbtree : public ecu_rbtree
+{
+    /// @brief Constructor.
+    rbtree()
+    {
+        ecu_rbtree_ctor(this, &key_less_than, ECU_RBNODE_OBJ_UNUSED);
+    }
+};
+
+/**
+ * @brief Recursively verifies red-black properties of the subtree
+ * rooted at @p node and returns its black height. Recursion is fine
+ * in tests.
+ */
+int black_height(const ecu_rbtree& t, const ecu_rbnode *node, const ecu_rbnode *parent, std::size_t& count)
+{
+    int height = 1; /* NULL leaves are black. */
+
+    if (node)
+    {
+        count++;
+        POINTERS_EQUAL(parent, node->parent);
+        POINTERS_EQUAL(&t, node->tree);
+
+        if (node->red)
+        {
+            CHECK_TRUE( (!node->left || !node->left->red) );
+            CHECK_TRUE( (!node->right || !node->right->red) );
+        }
+
+        int left = black_height(t, node->left, node, count);
+        int right = black_height(t, node->right, node, count);
+        LONGS_EQUAL(left, right);
+        height = left + (node->red ? 0 : 1);
+    }
+
+    return height;
+}
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(RBTree)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Verifies tree structure, coloring, ordering, and cached
+    /// min, max, and size.
+    static void check_invariants(const ecu_rbtree& t)
+    {
+        std::size_t count = 0;
+        CHECK_TRUE( (!t.root || !t.root->red) );
+        (void)black_height(t, t.root, nullptr, count);
+        UNSIGNED_LONGS_EQUAL(count, ecu_rbtree_size(&t));
+
+        const ecu_rbnode *prev = nullptr;
+        ecu_rbtree_citerator citerator;
+
+        ECU_RBTREE_CONST_FOR_EACH(n, &citerator, &t)
+        {
+            if (prev)
+            {
+                CHECK_FALSE( (key_less_than(n, prev, nullptr)) );
+            }
+
+            prev = n;
+        }
+
+        if (t.root)
+        {
+            const ecu_rbnode *min = t.root;
+            const ecu_rbnode *max = t.root;
+
+            while (min->left)
+            {
+                min = min->left;
+            }
+
+            while (max->right)
+            {
+                max = max->right;
+            }
+
+            POINTERS_EQUAL(min, ecu_rbtree_cmin(&t));
+            POINTERS_EQUAL(max, ecu_rbtree_cmax(&t));
+        }
+        else
+        {
+            POINTERS_EQUAL(nullptr, ecu_rbtree_cmin(&t));
+            POINTERS_EQUAL(nullptr, ecu_rbtree_cmax(&t));
+        }
+    }
+
+    /// @brief Returns all keys in the tree, in iteration order.
+    static std::vector<int> keys(const ecu_rbtree& t)
+    {
+        std::vector<int> result;
+        ecu_rbtree_citerator citerator;
+
+        ECU_RBTREE_CONST_FOR_EACH(n, &citerator, &t)
+        {
+            result.push_back(static_cast<const entry *>(n)->key);
+        }
+
+        return result;
+    }
+
+    /// @brief Returns a vector of ints from @p begin to @p end (exclusive),
+    /// incrementing by @p step.
+    static std::vector<int> range(int begin, int end, int step = 1)
+    {
+        std::vector<int> result;
+
+        for (int i = begin; i < end; i += step)
+        {
+            result.push_back(i);
+        }
+
+        return result;
+    }
+
+    /// @brief Creates entries with keys from @p begin to @p end (exclusive),
+    /// incrementing by @p step, and inserts them into the tree.
+    void insert_range(int begin, int end, int step = 1)
+    {
+        for (int i = begin; i < end; i += step)
+        {
+            entries.emplace_back(i);
+            ecu_rbtree_insert(&tree, &entries.back());
+        }
+    }
+
+    /// @brief Returns entry that has key @p k. Fails if not found.
+    entry& get(int k)
+    {
+        auto it = std::find_if(entries.begin(), entries.end(), [k](const entry& e) { return e.key == k; });
+        CHECK_TRUE( (it != entries.end()) );
+        return *it;
+    }
+
+    /// @brief Node storage. Deque so addresses stay stable.
+    std::deque<entry> entries;
+
+    /// @brief Tree under test.
+    rbtree tree;
+};
+
+/*------------------------------------------------------------*/
+/*------------------------- TESTS - CTOR ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Not allowed. Node ID must be greater than or equal
+ * to @ref ECU_VALID_OBJECT_ID_BEGIN.
+ */
+TEST(RBTree, NodeCtorInvalidId)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_rbnode n;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_rbnode_ctor(&n, ECU_RBNODE_DESTROY_UNUSED, ECU_OBJECT_ID_RESERVED);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Sorting condition is mandatory.
+ */
+TEST(RBTree, CtorNoCondition)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_rbtree t;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_rbtree_ctor(&t, nullptr, ECU_RBNODE_OBJ_UNUSED);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - INSERT --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Sorted input is the worst case for an unbalanced tree.
+ * Tree stays balanced and sorted.
+ */
+TEST(RBTree, InsertAscending)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        CHECK_TRUE( (ecu_rbtree_empty(&tree)) );
+
+        /* Step 2: Action. */
+        insert_range(0, 512);
+
+        /* Step 3: Assert. */
+        check_invariants(tree);
+        CHECK_TRUE( (range(0, 512) == keys(tree)) );
+        CHECK_FALSE( (ecu_rbtree_empty(&tree)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Tree stays balanced and sorted.
+ */
+TEST(RBTree, InsertDescending)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::vector<int> expected = range(0, 512);
+
+        /* Step 2: Action. */
+        for (int i = 511; i >= 0; i--)
+        {
+            entries.emplace_back(i);
+            ecu_rbtree_insert(&tree, &entries.back());
+        }
+
+        /* Step 3: Assert. */
+        check_invariants(tree);
+        CHECK_TRUE( (expected == keys(tree)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Equal nodes are kept in the order they were inserted.
+ */
+TEST(RBTree, InsertDuplicatesStable)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::vector<int> sequences;
+        ecu_rbtree_citerator citerator;
+
+        /* Step 2: Action. Keys 0, 1, 2, 0, 1, 2, ... */
+        for (int i = 0; i < 60; i++)
+        {
+            entries.emplace_back(i % 3, i);
+            ecu_rbtree_insert(&tree, &entries.back());
+        }
+
+        /* Step 3: Assert. */
+        check_invariants(tree);
+
+        ECU_RBTREE_CONST_FOR_EACH(n, &citerator, &tree)
+        {
+            sequences.push_back(static_cast<const entry *>(n)->sequence);
+        }
+
+        CHECK_TRUE( (sequences.size() == 60) );
+
+        for (std::size_t i = 1; i < sequences.size(); i++)
+        {
+            if ((sequences.at(i) % 3) == (sequences.at(i - 1) % 3))
+            {
+                CHECK_TRUE( (sequences.at(i) > sequences.at(i - 1)) );
+            }
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Node must be removed before it is inserted again.
+ */
+TEST(RBTree, InsertNodeAlreadyInTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        rbtree other;
+        insert_range(0, 3);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_rbtree_insert(&other, &get(1));
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - REMOVE --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Cached min and max are updated in O(1) when they are removed.
+ */
+TEST(RBTree, RemoveUpdatesMinAndMax)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        insert_range(0, 10);
+
+        /* Step 2: Action. */
+        ecu_rbnode_remove(&get(0));
+        ecu_rbnode_remove(&get(9));
+
+        /* Step 3: Assert. */
+        check_invariants(tree);
+        POINTERS_EQUAL(&get(1), ecu_rbtree_min(&tree));
+        POINTERS_EQUAL(&get(8), ecu_rbtree_max(&tree));
+        CHECK_FALSE( (ecu_rbnode_in_tree(&get(0))) );
+        CHECK_FALSE( (ecu_rbnode_in_tree(&get(9))) );
+        CHECK_TRUE( (range(1, 9) == keys(tree)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Removing a node that is not in a tree does nothing.
+ */
+TEST(RBTree, RemoveNodeNotInTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        entry n{5};
+
+        /* Step 2: Action. */
+        ecu_rbnode_remove(&n);
+
+        /* Step 3: Assert. */
+        CHECK_FALSE( (ecu_rbnode_in_tree(&n)) );
+        CHECK_TRUE( (ecu_rbnode_valid(&n)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Randomized inserts and removes, including duplicates.
+ * Red-black properties and cached values hold after every operation.
+ */
+TEST(RBTree, RandomInsertAndRemove)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::mt19937 rng{1234};
+        std::uniform_int_distribution<int> key_dist{0, 99};
+        std::vector<entry *> inserted;
+        std::multiset<int> expected;
+
+        for (int i = 0; i < 300; i++)
+        {
+            entries.emplace_back(key_dist(rng), i);
+        }
+
+        /* Steps 2 and 3: Action and assert. */
+        for (entry& e : entries)
+        {
+            ecu_rbtree_insert(&tree, &e);
+            inserted.push_back(&e);
+            expected.insert(e.key);
+
+            /* Remove a random node every third insert. */
+            if ((e.sequence % 3) == 2)
+            {
+                std::size_t index = static_cast<std::size_t>(rng() % inserted.size());
+                entry *victim = inserted.at(index);
+                ecu_rbnode_remove(victim);
+                expected.erase(expected.find(victim->key));
+                inserted.erase(inserted.begin() + static_cast<std::ptrdiff_t>(index));
+            }
+
+            check_invariants(tree);
+        }
+
+        CHECK_TRUE( (std::vector<int>(expected.begin(), expected.end()) == keys(tree)) );
+
+        while (!inserted.empty())
+        {
+            std::size_t index = static_cast<std::size_t>(rng() % inserted.size());
+            ecu_rbnode_remove(inserted.at(index));
+            inserted.erase(inserted.begin() + static_cast<std::ptrdiff_t>(index));
+            check_invariants(tree);
+        }
+
+        CHECK_TRUE( (ecu_rbtree_empty(&tree)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Nodes are popped in sorted order, making the tree usable
+ * as a priority queue (e.g. deadline-ordered timers).
+ */
+TEST(RBTree, PopMinSortedOrder)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::vector<int> popped;
+        insert_range(0, 50, 3);
+        insert_range(1, 50, 3);
+        insert_range(2, 50, 3);
+
+        /* Step 2: Action. */
+        for (ecu_rbnode *n = ecu_rbtree_pop_min(&tree); n; n = ecu_rbtree_pop_min(&tree))
+        {
+            CHECK_FALSE( (ecu_rbnode_in_tree(n)) );
+            popped.push_back(static_cast<entry *>(n)->key);
+            check_invariants(tree);
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (range(0, 50) == popped) );
+        CHECK_TRUE( (ecu_rbtree_empty(&tree)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief NULL returned.
+ */
+TEST(RBTree, PopMinEmptyTree)
+{
+    try
+    {
+        /* Steps 2 and 3: Action and assert. */
+        POINTERS_EQUAL(nullptr, ecu_rbtree_pop_min(&tree));
+        UNSIGNED_LONGS_EQUAL(0, ecu_rbtree_size(&tree));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - SEARCH --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Matching node returned if it exists. NULL otherwise.
+ */
+TEST(RBTree, Find)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        insert_range(0, 100, 2);
+        entry present{42};
+        entry missing{43};
+        entry too_large{1000};
+
+        /* Steps 2 and 3: Action and assert. */
+        POINTERS_EQUAL(&get(42), ecu_rbtree_find(&tree, &present));
+        POINTERS_EQUAL(&get(42), ecu_rbtree_cfind(&tree, &present));
+        POINTERS_EQUAL(nullptr, ecu_rbtree_find(&tree, &missing));
+        POINTERS_EQUAL(nullptr, ecu_rbtree_find(&tree, &too_large));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief First inserted node returned when there are equal nodes.
+ */
+TEST(RBTree, FindDuplicatesReturnsFirst)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        entry key{7};
+
+        for (int i = 0; i < 20; i++)
+        {
+            entries.emplace_back(i % 10, i);
+            ecu_rbtree_insert(&tree, &entries.back());
+        }
+
+        /* Step 2: Action. */
+        const ecu_rbnode *found = ecu_rbtree_cfind(&tree, &key);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (found != nullptr) );
+        LONGS_EQUAL(7, static_cast<const entry *>(found)->key);
+        LONGS_EQUAL(7, static_cast<const entry *>(found)->sequence);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Lower bound returns first node not less than key. Upper bound
+ * returns first node greater than key. NULL if none.
+ */
+TEST(RBTree, LowerAndUpperBound)
+{
+    try
+    {
+        /* Step 1: Arrange. Keys = 0, 10, 20, ..., 90. */
+        insert_range(0, 100, 10);
+        entry k20{20};
+        entry k25{25};
+        entry k_neg{-5};
+        entry k90{90};
+        entry k95{95};
+
+        /* Steps 2 and 3: Action and assert. */
+        POINTERS_EQUAL(&get(20), ecu_rbtree_lower_bound(&tree, &k20));
+        POINTERS_EQUAL(&get(30), ecu_rbtree_upper_bound(&tree, &k20));
+        POINTERS_EQUAL(&get(30), ecu_rbtree_lower_bound(&tree, &k25));
+        POINTERS_EQUAL(&get(30), ecu_rbtree_cupper_bound(&tree, &k25));
+        POINTERS_EQUAL(&get(0), ecu_rbtree_clower_bound(&tree, &k_neg));
+        POINTERS_EQUAL(&get(0), ecu_rbtree_upper_bound(&tree, &k_neg));
+        POINTERS_EQUAL(&get(90), ecu_rbtree_lower_bound(&tree, &k90));
+        POINTERS_EQUAL(nullptr, ecu_rbtree_upper_bound(&tree, &k90));
+        POINTERS_EQUAL(nullptr, ecu_rbtree_lower_bound(&tree, &k95));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief NULL returned.
+ */
+TEST(RBTree, BoundsEmptyTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        entry key{0};
+
+        /* Steps 2 and 3: Action and assert. */
+        POINTERS_EQUAL(nullptr, ecu_rbtree_find(&tree, &key));
+        POINTERS_EQUAL(nullptr, ecu_rbtree_lower_bound(&tree, &key));
+        POINTERS_EQUAL(nullptr, ecu_rbtree_upper_bound(&tree, &key));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*---------------------- TESTS - NEXT, PREV ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Walks the whole tree forwards and backwards.
+ */
+TEST(RBTree, NextAndPrev)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::vector<int> forwards;
+        std::vector<int> backwards;
+        insert_range(0, 64);
+
+        /* Step 2: Action. */
+        for (ecu_rbnode *n = ecu_rbtree_min(&tree); n; n = ecu_rbnode_next(n))
+        {
+            forwards.push_back(static_cast<entry *>(n)->key);
+        }
+
+        for (const ecu_rbnode *n = ecu_rbtree_cmax(&tree); n; n = ecu_rbnode_cprev(n))
+        {
+            backwards.push_back(static_cast<const entry *>(n)->key);
+        }
+
+        /* Step 3: Assert. */
+        std::reverse(backwards.begin(), backwards.end());
+        CHECK_TRUE( (range(0, 64) == forwards) );
+        CHECK_TRUE( (range(0, 64) == backwards) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief NULL returned.
+ */
+TEST(RBTree, NextAndPrevNodeNotInTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        entry n{1};
+
+        /* Steps 2 and 3: Action and assert. */
+        POINTERS_EQUAL(nullptr, ecu_rbnode_next(&n));
+        POINTERS_EQUAL(nullptr, ecu_rbnode_cprev(&n));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------------- TESTS - ITERATORS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Iteration immediately exits.
+ */
+TEST(RBTree, IteratorEmptyTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::size_t count = 0;
+        ecu_rbtree_iterator iterator;
+
+        /* Step 2: Action. */
+        ECU_RBTREE_FOR_EACH(n, &iterator, &tree)
+        {
+            (void)n;
+            count++;
+        }
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, count);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Nodes visited in sorted order.
+ */
+TEST(RBTree, ConstIterator)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        insert_range(50, 100);
+        insert_range(0, 50);
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (range(0, 100) == keys(tree)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Removing current node does not affect iteration, even
+ * though the removal rebalances the tree.
+ */
+TEST(RBTree, IteratorRemoveSome)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::vector<int> visited;
+        ecu_rbtree_iterator iterator;
+        insert_range(0, 100);
+
+        /* Step 2: Action. */
+        ECU_RBTREE_FOR_EACH(n, &iterator, &tree)
+        {
+            int key = static_cast<entry *>(n)->key;
+            visited.push_back(key);
+
+            if ((key % 2) == 0)
+            {
+                ecu_rbnode_remove(n);
+            }
+        }
+
+        /* Step 3: Assert. */
+        check_invariants(tree);
+        CHECK_TRUE( (range(0, 100) == visited) );
+        CHECK_TRUE( (range(1, 100, 2) == keys(tree)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief All nodes removed. Tree is empty.
+ */
+TEST(RBTree, IteratorRemoveAll)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::size_t count = 0;
+        ecu_rbtree_iterator iterator;
+        insert_range(0, 100);
+
+        /* Step 2: Action. */
+        ECU_RBTREE_FOR_EACH(n, &iterator, &tree)
+        {
+            ecu_rbnode_remove(n);
+            count++;
+        }
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(100, count);
+        CHECK_TRUE( (ecu_rbtree_empty(&tree)) );
+        check_invariants(tree);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Range query. Iteration starts at the lower bound and
+ * stops once nodes exceed the upper limit.
+ */
+TEST(RBTree, AtIteratorRange)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::vector<int> visited;
+        ecu_rbtree_iterator iterator;
+        entry low{25};
+        insert_range(0, 100, 5);
+        ecu_rbnode *start = ecu_rbtree_lower_bound(&tree, &low);
+        CHECK_TRUE( (start != nullptr) );
+
+        /* Step 2: Action. */
+        ECU_RBTREE_AT_FOR_EACH(n, &iterator, &tree, start)
+        {
+            int key = static_cast<entry *>(n)->key;
+
+            if (key > 50)
+            {
+                break;
+            }
+
+            visited.push_back(key);
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (range(25, 51, 5) == visited) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Starting node must be in the iterated tree.
+ */
+TEST(RBTree, AtIteratorNodeNotInTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_rbtree_citerator citerator;
+        entry outside{3};
+        insert_range(0, 5);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ECU_RBTREE_CONST_AT_FOR_EACH(n, &citerator, &tree, &outside)
+        {
+            (void)n;
+        }
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - CLEAR, DESTROY ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief All nodes detached without calling destroy callbacks.
+ * Nodes and tree can be reused.
+ */
+TEST(RBTree, ClearDetachesNodes)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        for (int i = 0; i < 40; i++)
+        {
+            entries.emplace_back(i, i, &node_destroy);
+            ecu_rbtree_insert(&tree, &entries.back());
+        }
+
+        mock().expectNCalls(0, "node_destroy");
+
+        /* Step 2: Action. */
+        ecu_rbtree_clear(&tree);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (ecu_rbtree_empty(&tree)) );
+        check_invariants(tree);
+
+        for (entry& e : entries)
+        {
+            CHECK_FALSE( (ecu_rbnode_in_tree(&e)) );
+            ecu_rbtree_insert(&tree, &e);
+        }
+
+        check_invariants(tree);
+        CHECK_TRUE( (range(0, 40) == keys(tree)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroy callback of every node executes once. Tree
+ * and nodes must be reconstructed afterwards.
+ */
+TEST(RBTree, DestroyCallsCallbacks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        for (int i = 0; i < 20; i++)
+        {
+            ecu_object_id_t id = static_cast<ecu_object_id_t>(ECU_VALID_OBJECT_ID_BEGIN + i);
+            entries.emplace_back(i, i, &node_destroy, id);
+            ecu_rbtree_insert(&tree, &entries.back());
+            mock().expectOneCall("node_destroy")
+                  .withParameter("id", id);
+        }
+
+        /* Step 2: Action. */
+        ecu_rbtree_destroy(&tree);
+
+        /* Step 3: Assert. */
+        CHECK_FALSE( (ecu_rbtree_valid(&tree)) );
+
+        for (entry& e : entries)
+        {
+            CHECK_FALSE( (ecu_rbnode_valid(&e)) );
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Destroyed node is removed from its tree first.
+ */
+TEST(RBTree, NodeDestroyRemovesFromTree)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        insert_range(0, 10);
+        entry& victim = get(4);
+
+        /* Step 2: Action. */
+        ecu_rbnode_destroy(&victim);
+
+        /* Step 3: Assert. */
+        CHECK_FALSE( (ecu_rbnode_valid(&victim)) );
+        UNSIGNED_LONGS_EQUAL(9, ecu_rbtree_size(&tree));
+        check_invariants(tree);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Tree must be reconstructed.
+ */
+TEST(RBTree, UseTreeAfterDestroy)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        entry n{1};
+        ecu_rbtree_destroy(&tree);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_rbtree_insert(&tree, &n);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
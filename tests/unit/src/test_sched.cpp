@@ -0,0 +1,715 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref sched.h.
+ * Test summary:
+ *
+ * @ref ecu_sched_ctor(), @ref ecu_sched_add(), @ref ecu_sched_ready()
+ *      - TEST(Sched, CtorNotReady)
+ *      - TEST(Sched, AddInvalidPriority)
+ *      - TEST(Sched, AddPriorityInUse)
+ *      - TEST(Sched, AddWithQueuedEvents)
+ *      - TEST(Sched, PostMakesReady)
+ *
+ * @ref ecu_sched_run_once()
+ *      - TEST(Sched, RunOnceEmpty)
+ *      - TEST(Sched, RunOnceHighestPriorityFirst)
+ *      - TEST(Sched, RunOnceOneEventAtATime)
+ *      - TEST(Sched, RunOnceHigherPriorityPostedByHandler)
+ *
+ * @ref ecu_sched_run_until_idle()
+ *      - TEST(Sched, RunUntilIdleDispatchesEverything)
+ *      - TEST(Sched, RunUntilIdleNoTimers)
+ *      - TEST(Sched, RunUntilIdleNextTimeout)
+ *
+ * @ref ecu_sched_start()
+ *      - TEST(Sched, StartHighestPriorityFirst)
+ *
+ * @ref ecu_sched_tick(), @ref ecu_sched_timer_ctor(), @ref ecu_sched_timer_arm(),
+ * @ref ecu_sched_timer_disarm(), @ref ecu_sched_timer_active()
+ *      - TEST(Sched, TimerPostsOnExpiry)
+ *      - TEST(Sched, TimerPeriodic)
+ *      - TEST(Sched, TimerRetriedWhenQueueFull)
+ *      - TEST(Sched, TimerDisarm)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/sched.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief What the state handlers do with an event.
+ */
+enum event_id
+{
+    RECORD,     /**< Only records the event. */
+    FORWARD     /**< Records, then posts a RECORD event to the object at priority value. */
+};
+
+/**
+ * @brief Event posted in every test.
+ */
+struct test_event
+{
+    /// @brief Base class. Must be first.
+    ecu_event base;
+
+    /// @brief Payload recorded by the handlers.
+    int value;
+};
+
+/**
+ * @brief Number of events each test object can queue.
+ */
+constexpr std::size_t EVENTS = 2;
+
+/**
+ * @brief Active object whose state machine records every
+ * event together with its priority.
+ */
+struct test_ao
+{
+    /// @brief State machine run by @ref ao.
+    ecu_fsm fsm;
+
+    /// @brief Object under test.
+    ecu_ao ao;
+
+    /// @brief Priority this object is added at.
+    int priority;
+
+    /// @brief Queue memory.
+    std::uint8_t buffer[ECU_AO_BUFFER_SIZE(sizeof(test_event), EVENTS)];
+};
+
+/**
+ * @brief Objects indexed by priority so handlers can forward events.
+ */
+test_ao aos[ECU_SCHED_PRIORITIES];
+
+/**
+ * @brief Returns a constructed event.
+ */
+test_event make_event(event_id id, int value)
+{
+    test_event e;
+    ecu_event_ctor(&e.base, id, sizeof(test_event));
+    e.value = value;
+    return e;
+}
+
+/**
+ * @brief Entry handler. Records the object's priority.
+ */
+void entry(ecu_fsm *me)
+{
+    const test_ao *t = ECU_FSM_GET_CONTEXT(me, test_ao, fsm);
+    mock().actualCall("entry").withParameter("priority", t->priority);
+}
+
+/**
+ * @brief Records the event and the priority it was dispatched at.
+ */
+void handler(ecu_fsm *me, const void *event)
+{
+    const test_ao *t = ECU_FSM_GET_CONTEXT(me, test_ao, fsm);
+    const test_event *e = static_cast<const test_event *>(event);
+    mock().actualCall("handler").withParameter("priority", t->priority).withParameter("value", e->value);
+
+    if (e->base.id == FORWARD)
+    {
+        test_event next = make_event(RECORD, e->value);
+        (void)ecu_ao_post(&aos[e->value].ao, &next.base);
+    }
+}
+
+/**
+ * @brief Idle hook that records the timeout it was given.
+ */
+void idle(ecu_sched *me, ecu_tick_t timeout, void *obj)
+{
+    (void)me;
+    mock().actualCall("idle").withParameter("timeout", timeout).withParameter("obj", obj);
+}
+
+const ecu_fsm_state STATE = ECU_FSM_STATE_CTOR(
+    &entry, ECU_FSM_STATE_EXIT_UNUSED, &handler
+);
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(Sched)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+        mock().strictOrder();
+        ecu_sched_ctor(&me, &idle, &obj);
+
+        for (std::size_t i = 0; i < ECU_SCHED_PRIORITIES; i++)
+        {
+            aos[i].priority = static_cast<int>(i);
+            ecu_fsm_ctor(&aos[i].fsm, &STATE);
+            ecu_ao_fsm_ctor(&aos[i].ao, &aos[i].fsm, &aos[i].buffer[0], sizeof(aos[i].buffer), sizeof(test_event));
+        }
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Adds the object at @p priority to the scheduler.
+    void ADD(std::size_t priority)
+    {
+        ecu_sched_add(&me, &aos[priority].ao, priority);
+    }
+
+    /// @brief Posts an event to the object at @p priority and
+    /// asserts it was queued.
+    static void POST(std::size_t priority, event_id id, int value)
+    {
+        test_event e = make_event(id, value);
+        CHECK_TRUE( (ecu_ao_post(&aos[priority].ao, &e.base)) );
+    }
+
+    /// @brief Expects the object at @p priority to handle an event.
+    static void EXPECT_HANDLED(std::size_t priority, int value)
+    {
+        mock().expectOneCall("handler").withParameter("priority", static_cast<int>(priority)).withParameter("value", value);
+    }
+
+    /// @brief Expects the idle hook to run with @p timeout.
+    void EXPECT_IDLE(ecu_tick_t timeout)
+    {
+        mock().expectOneCall("idle").withParameter("timeout", timeout).withParameter("obj", static_cast<void *>(&obj));
+    }
+
+    /// @brief Scheduler under test.
+    ecu_sched me;
+
+    /// @brief Object passed to the idle hook.
+    int obj{0};
+};
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - ECU_SCHED_ADD -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Nothing is ready after construction.
+ */
+TEST(Sched, CtorNotReady)
+{
+    try
+    {
+        /* Steps 1, 2, and 3: Arrange, action, and assert. */
+        CHECK_FALSE( (ecu_sched_ready(&me)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Priority out of range.
+ */
+TEST(Sched, AddInvalidPriority)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_sched_add(&me, &aos[0].ao, ECU_SCHED_PRIORITIES);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Only one object per priority.
+ */
+TEST(Sched, AddPriorityInUse)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ADD(1);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_sched_add(&me, &aos[2].ao, 1);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Events queued before the object was added are kept
+ * and make it ready.
+ */
+TEST(Sched, AddWithQueuedEvents)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        POST(5, RECORD, 1);
+
+        /* Step 2: Action. */
+        ADD(5);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (ecu_sched_ready(&me)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Posting directly to an added object makes it ready.
+ */
+TEST(Sched, PostMakesReady)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ADD(5);
+        CHECK_FALSE( (ecu_sched_ready(&me)) );
+
+        /* Step 2: Action. */
+        POST(5, RECORD, 1);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (ecu_sched_ready(&me)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------ TESTS - ECU_SCHED_RUN_ONCE --------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Nothing is dispatched if no object is ready.
+ */
+TEST(Sched, RunOnceEmpty)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ADD(0);
+
+        /* Steps 2 and 3: Action and assert. No mock calls expected. */
+        CHECK_FALSE( (ecu_sched_run_once(&me)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Highest ready priority runs first, including across
+ * words of the ready bitmap.
+ */
+TEST(Sched, RunOnceHighestPriorityFirst)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        const std::size_t top = ECU_SCHED_PRIORITIES - 1;
+        ADD(0);
+        ADD(3);
+        ADD(top);
+        POST(3, RECORD, 30);
+        POST(0, RECORD, 0);
+        POST(top, RECORD, 99);
+        EXPECT_HANDLED(top, 99);
+        EXPECT_HANDLED(3, 30);
+        EXPECT_HANDLED(0, 0);
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+        CHECK_FALSE( (ecu_sched_run_once(&me)) );
+        CHECK_FALSE( (ecu_sched_ready(&me)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Only one event is dispatched per call. Object stays
+ * ready until its queue is empty.
+ */
+TEST(Sched, RunOnceOneEventAtATime)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ADD(1);
+        ADD(2);
+        POST(2, RECORD, 1);
+        POST(2, RECORD, 2);
+        POST(1, RECORD, 3);
+        EXPECT_HANDLED(2, 1);
+
+        /* Step 2: Action. */
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(1, ecu_ao_count(&aos[2].ao));
+        UNSIGNED_LONGS_EQUAL(1, ecu_ao_count(&aos[1].ao));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Low-priority handler posts to a higher-priority object.
+ * It runs before the low-priority object's next event.
+ */
+TEST(Sched, RunOnceHigherPriorityPostedByHandler)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ADD(1);
+        ADD(40);
+        POST(1, FORWARD, 40);
+        POST(1, RECORD, 2);
+        EXPECT_HANDLED(1, 40);
+        EXPECT_HANDLED(40, 40);
+        EXPECT_HANDLED(1, 2);
+
+        /* Step 2: Action. */
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+
+        /* Step 3: Assert. */
+        CHECK_FALSE( (ecu_sched_ready(&me)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*--------------- TESTS - ECU_SCHED_RUN_UNTIL_IDLE -----------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Every event is dispatched in priority order, then
+ * the idle hook runs once.
+ */
+TEST(Sched, RunUntilIdleDispatchesEverything)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ADD(1);
+        ADD(2);
+        POST(1, RECORD, 1);
+        POST(1, FORWARD, 2);
+        POST(2, RECORD, 2);
+        EXPECT_HANDLED(2, 2);
+        EXPECT_HANDLED(1, 1);
+        EXPECT_HANDLED(1, 2);
+        EXPECT_HANDLED(2, 2);
+        EXPECT_IDLE(ECU_TICK_MAX);
+
+        /* Step 2: Action. */
+        std::size_t dispatched = ecu_sched_run_until_idle(&me);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(4, dispatched);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Idle hook is told nothing will time out if no
+ * time events are armed.
+ */
+TEST(Sched, RunUntilIdleNoTimers)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ADD(1);
+        EXPECT_IDLE(ECU_TICK_MAX);
+
+        /* Step 2: Action. */
+        std::size_t dispatched = ecu_sched_run_until_idle(&me);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, dispatched);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Idle hook receives the ticks until the earliest
+ * time event expires.
+ */
+TEST(Sched, RunUntilIdleNextTimeout)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_sched_timer t1;
+        ecu_sched_timer t2;
+        test_event e = make_event(RECORD, 1);
+        ADD(1);
+        ecu_sched_timer_ctor(&t1, &aos[1].ao, &e.base);
+        ecu_sched_timer_ctor(&t2, &aos[1].ao, &e.base);
+        ecu_sched_timer_arm(&me, &t1, 50, ECU_TIMER_TYPE_ONE_SHOT);
+        ecu_sched_timer_arm(&me, &t2, 30, ECU_TIMER_TYPE_ONE_SHOT);
+        ecu_sched_tick(&me, 10);
+        EXPECT_IDLE(20);
+
+        /* Step 2: Action. */
+        (void)ecu_sched_run_until_idle(&me);
+
+        /* Step 3: Assert. Done by mock expectations. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - ECU_SCHED_START ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Every added object is started, highest priority first.
+ */
+TEST(Sched, StartHighestPriorityFirst)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ADD(2);
+        ADD(50);
+        ADD(7);
+        mock().expectOneCall("entry").withParameter("priority", 50);
+        mock().expectOneCall("entry").withParameter("priority", 7);
+        mock().expectOneCall("entry").withParameter("priority", 2);
+
+        /* Step 2: Action. */
+        ecu_sched_start(&me);
+
+        /* Step 3: Assert. Done by mock expectations. */
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------ TESTS - ECU_SCHED_TIMER -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Time event posts its event once it expires.
+ */
+TEST(Sched, TimerPostsOnExpiry)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_sched_timer t;
+        test_event e = make_event(RECORD, 7);
+        ADD(3);
+        ecu_sched_timer_ctor(&t, &aos[3].ao, &e.base);
+        ecu_sched_timer_arm(&me, &t, 10, ECU_TIMER_TYPE_ONE_SHOT);
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_sched_tick(&me, 9);
+        CHECK_FALSE( (ecu_sched_ready(&me)) );
+        ecu_sched_tick(&me, 1);
+        CHECK_TRUE( (ecu_sched_ready(&me)) );
+        CHECK_FALSE( (ecu_sched_timer_active(&t)) );
+        EXPECT_HANDLED(3, 7);
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Periodic time event posts every period.
+ */
+TEST(Sched, TimerPeriodic)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_sched_timer t;
+        test_event e = make_event(RECORD, 7);
+        ADD(3);
+        ecu_sched_timer_ctor(&t, &aos[3].ao, &e.base);
+        ecu_sched_timer_arm(&me, &t, 10, ECU_TIMER_TYPE_PERIODIC);
+        EXPECT_HANDLED(3, 7);
+        EXPECT_HANDLED(3, 7);
+
+        /* Steps 2 and 3: Action and assert. */
+        ecu_sched_tick(&me, 10);
+        ecu_sched_tick(&me, 10);
+        UNSIGNED_LONGS_EQUAL(2, ecu_ao_count(&aos[3].ao));
+        CHECK_TRUE( (ecu_sched_timer_active(&t)) );
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Post that fails because the queue is full is
+ * retried on the next tick.
+ */
+TEST(Sched, TimerRetriedWhenQueueFull)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_sched_timer t;
+        test_event e = make_event(RECORD, 7);
+        ADD(3);
+        POST(3, RECORD, 1);
+        POST(3, RECORD, 2);
+        ecu_sched_timer_ctor(&t, &aos[3].ao, &e.base);
+        ecu_sched_timer_arm(&me, &t, 10, ECU_TIMER_TYPE_ONE_SHOT);
+        ecu_sched_tick(&me, 10);
+        UNSIGNED_LONGS_EQUAL(EVENTS, ecu_ao_count(&aos[3].ao));
+        EXPECT_HANDLED(3, 1);
+
+        /* Step 2: Action. */
+        CHECK_TRUE( (ecu_sched_run_once(&me)) );
+        ecu_sched_tick(&me, 1);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(EVENTS, ecu_ao_count(&aos[3].ao));
+        CHECK_FALSE( (ecu_sched_timer_active(&t)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Disarmed time event never posts.
+ */
+TEST(Sched, TimerDisarm)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_sched_timer t;
+        test_event e = make_event(RECORD, 7);
+        ADD(3);
+        ecu_sched_timer_ctor(&t, &aos[3].ao, &e.base);
+        ecu_sched_timer_arm(&me, &t, 10, ECU_TIMER_TYPE_PERIODIC);
+
+        /* Step 2: Action. */
+        ecu_sched_timer_disarm(&t);
+        ecu_sched_tick(&me, 100);
+
+        /* Step 3: Assert. */
+        CHECK_FALSE( (ecu_sched_timer_active(&t)) );
+        CHECK_FALSE( (ecu_sched_ready(&me)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
@@ -0,0 +1,726 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref tfsm.h.
+ * Test summary:
+ *
+ * @ref ECU_TFSM_GET_CONTEXT()
+ *      - TEST(Tfsm, GetContext)
+ *
+ * @ref ECU_TFSM_TABLE_DEFINE()
+ *      - TEST(Tfsm, TableDefineLayout)
+ *
+ * @ref ecu_tfsm_ctor()
+ *      - TEST(Tfsm, CtorInvalidState)
+ *
+ * @ref ecu_tfsm_dispatch(), @ref ecu_tfsm_change_state()
+ *      - TEST(Tfsm, DispatchIgnoredEvent)
+ *      - TEST(Tfsm, DispatchInternalAction)
+ *      - TEST(Tfsm, DispatchSelfTransition)
+ *      - TEST(Tfsm, DispatchStateTransition)
+ *      - TEST(Tfsm, DispatchTransitionWithoutAction)
+ *      - TEST(Tfsm, DispatchGuardInAction)
+ *      - TEST(Tfsm, DispatchActionTransitionsWithTarget)
+ *      - TEST(Tfsm, DispatchTransitionOnEntry)
+ *      - TEST(Tfsm, DispatchSelfTransitionOnEntry)
+ *      - TEST(Tfsm, DispatchTransitionOnExit)
+ *      - TEST(Tfsm, DispatchEventOutOfRange)
+ *      - TEST(Tfsm, DispatchSharedTable)
+ *
+ * @ref ecu_tfsm_start()
+ *      - TEST(Tfsm, StartRunsEntry)
+ *      - TEST(Tfsm, StartTransitionOnEntry)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/tfsm.h"
+
+/* STDLib. */
+#include <cstddef>
+#include <cstdint>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief Columns of every test table.
+ */
+enum event_id
+{
+    IGNORED,
+    INTERNAL,
+    SELF,
+    NEXT,
+    GUARD,
+    /********************/
+    EVENT_COUNT
+};
+
+/**
+ * @brief Entry handler that only records it ran.
+ */
+template<int STATE>
+void on_entry(ecu_tfsm *me)
+{
+    (void)me;
+    mock().actualCall("entry").withParameter("state", STATE);
+}
+
+/**
+ * @brief Exit handler that only records it ran.
+ */
+template<int STATE>
+void on_exit(ecu_tfsm *me)
+{
+    (void)me;
+    mock().actualCall("exit").withParameter("state", STATE);
+}
+
+/**
+ * @brief Action that records the state it ran in and its data.
+ */
+void action(ecu_tfsm *me, const void *data)
+{
+    mock().actualCall("action")
+        .withParameter("state", static_cast<int>(ecu_tfsm_current_state(me)))
+        .withParameter("data", data);
+}
+
+/**
+ * @brief Action with a run-time transition. Goes to
+ * state 2 of whichever table it is used in.
+ */
+void guard(ecu_tfsm *me, const void *data)
+{
+    action(me, data);
+    ecu_tfsm_change_state(me, 2);
+}
+
+/**
+ * @brief Entry handler that immediately transitions to
+ * state 2 of whichever table it is used in.
+ */
+void entry_then_transition(ecu_tfsm *me)
+{
+    on_entry<1>(me);
+    ecu_tfsm_change_state(me, 2);
+}
+
+/**
+ * @brief Entry handler that self-transitions. Not allowed.
+ */
+void entry_then_self_transition(ecu_tfsm *me)
+{
+    on_entry<1>(me);
+    ecu_tfsm_change_state(me, ecu_tfsm_current_state(me));
+}
+
+/**
+ * @brief Exit handler that transitions. Not allowed.
+ */
+void exit_then_transition(ecu_tfsm *me)
+{
+    on_exit<0>(me);
+    ecu_tfsm_change_state(me, 0);
+}
+
+/**
+ * @brief Main test table. Columns are IGNORED, INTERNAL, SELF, NEXT, GUARD.
+ */
+#define MAIN_TABLE(X)                                                                             \
+    X(M0, &on_entry<0>, &on_exit<0>,                                                              \
+      ECU_TFSM_IGNORE, ECU_TFSM_ACTION(&action), ECU_TFSM_TRANSITION(&action, M0),                \
+      ECU_TFSM_TRANSITION(&action, M1), ECU_TFSM_ACTION(&guard))                                  \
+    X(M1, &on_entry<1>, &on_exit<1>,                                                              \
+      ECU_TFSM_IGNORE, ECU_TFSM_ACTION(&action), ECU_TFSM_TRANSITION(ECU_TFSM_ACTION_UNUSED, M1), \
+      ECU_TFSM_TRANSITION(&action, M2), ECU_TFSM_IGNORE)                                          \
+    X(M2, &on_entry<2>, &on_exit<2>,                                                              \
+      ECU_TFSM_IGNORE, ECU_TFSM_IGNORE, ECU_TFSM_IGNORE,                                          \
+      ECU_TFSM_TRANSITION(&action, M0), ECU_TFSM_TRANSITION(&guard, M0))
+
+/**
+ * @brief State 1's entry handler transitions to state 2.
+ */
+#define CHAIN_TABLE(X)                                                  \
+    X(C0, &on_entry<0>, &on_exit<0>,                                    \
+      ECU_TFSM_IGNORE, ECU_TFSM_IGNORE, ECU_TFSM_IGNORE,                \
+      ECU_TFSM_TRANSITION(ECU_TFSM_ACTION_UNUSED, C1), ECU_TFSM_IGNORE) \
+    X(C1, &entry_then_transition, &on_exit<1>,                          \
+      ECU_TFSM_IGNORE, ECU_TFSM_IGNORE, ECU_TFSM_IGNORE,                \
+      ECU_TFSM_IGNORE, ECU_TFSM_IGNORE)                                 \
+    X(C2, &on_entry<2>, ECU_TFSM_EXIT_UNUSED,                           \
+      ECU_TFSM_IGNORE, ECU_TFSM_IGNORE, ECU_TFSM_IGNORE,                \
+      ECU_TFSM_IGNORE, ECU_TFSM_IGNORE)
+
+/**
+ * @brief Handlers that break the transition rules.
+ */
+#define BAD_TABLE(X)                                                    \
+    X(B0, ECU_TFSM_ENTRY_UNUSED, &exit_then_transition,                 \
+      ECU_TFSM_IGNORE, ECU_TFSM_IGNORE, ECU_TFSM_IGNORE,                \
+      ECU_TFSM_TRANSITION(ECU_TFSM_ACTION_UNUSED, B1), ECU_TFSM_IGNORE) \
+    X(B1, &entry_then_self_transition, ECU_TFSM_EXIT_UNUSED,            \
+      ECU_TFSM_IGNORE, ECU_TFSM_IGNORE, ECU_TFSM_IGNORE,                \
+      ECU_TFSM_IGNORE, ECU_TFSM_IGNORE)
+
+/**
+ * @brief States of @ref MAIN_TABLE.
+ */
+enum main_state
+{
+    MAIN_TABLE(ECU_TFSM_X_STATE_ID)
+    /********************/
+    MAIN_STATE_COUNT
+};
+
+/**
+ * @brief States of @ref CHAIN_TABLE.
+ */
+enum chain_state
+{
+    CHAIN_TABLE(ECU_TFSM_X_STATE_ID)
+    /********************/
+    CHAIN_STATE_COUNT
+};
+
+/**
+ * @brief States of @ref BAD_TABLE.
+ */
+enum bad_state
+{
+    BAD_TABLE(ECU_TFSM_X_STATE_ID)
+    /********************/
+    BAD_STATE_COUNT
+};
+
+ECU_TFSM_TABLE_DEFINE(MAIN, MAIN_TABLE, EVENT_COUNT);
+ECU_TFSM_TABLE_DEFINE(CHAIN, CHAIN_TABLE, EVENT_COUNT);
+ECU_TFSM_TABLE_DEFINE(BAD, BAD_TABLE, EVENT_COUNT);
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(Tfsm)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+        mock().strictOrder();
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Expects an entry handler to run.
+    static void EXPECT_ENTRY(int state)
+    {
+        mock().expectOneCall("entry").withParameter("state", state);
+    }
+
+    /// @brief Expects an exit handler to run.
+    static void EXPECT_EXIT(int state)
+    {
+        mock().expectOneCall("exit").withParameter("state", state);
+    }
+
+    /// @brief Expects an action to run in @p state with @ref DATA.
+    static void EXPECT_ACTION(int state)
+    {
+        mock().expectOneCall("action").withParameter("state", state).withParameter("data", static_cast<const void *>(&DATA));
+    }
+
+    /// @brief Event data passed to every dispatch.
+    static constexpr int DATA{5};
+
+    /// @brief FSM under test.
+    ecu_tfsm me;
+};
+
+/*------------------------------------------------------------*/
+/*----------------- TESTS - ECU_TFSM_GET_CONTEXT -------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Convert intrusive fsm into application fsm type.
+ * Verifies returned pointer points to start of user's type.
+ */
+TEST(Tfsm, GetContext)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        struct app_fsm_t
+        {
+            std::uint8_t a;
+            ecu_tfsm fsm;
+            int b;
+        } app_fsm;
+
+        /* Step 2: Action. */
+        app_fsm_t *app_fsm_ptr = ECU_TFSM_GET_CONTEXT(&app_fsm.fsm, app_fsm_t, fsm);
+
+        /* Step 3: Assert. */
+        POINTERS_EQUAL(&app_fsm, app_fsm_ptr);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*---------------- TESTS - ECU_TFSM_TABLE_DEFINE -------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief States are numbered in row order and cells are
+ * stored row-major, one per event.
+ */
+TEST(Tfsm, TableDefineLayout)
+{
+    try
+    {
+        /* Steps 1, 2, and 3: Arrange, action, and assert. */
+        UNSIGNED_LONGS_EQUAL(3, MAIN_STATE_COUNT);
+        UNSIGNED_LONGS_EQUAL(MAIN_STATE_COUNT, MAIN.state_count);
+        UNSIGNED_LONGS_EQUAL(EVENT_COUNT, MAIN.event_count);
+        UNSIGNED_LONGS_EQUAL(M2, MAIN.cells[(static_cast<std::size_t>(M1) * EVENT_COUNT) + NEXT].target);
+        UNSIGNED_LONGS_EQUAL(ECU_TFSM_NO_TRANSITION, MAIN.cells[(static_cast<std::size_t>(M0) * EVENT_COUNT) + IGNORED].target);
+        CHECK_TRUE( (MAIN.cells[(static_cast<std::size_t>(M0) * EVENT_COUNT) + IGNORED].action == ECU_TFSM_ACTION_UNUSED) );
+        CHECK_TRUE( (MAIN.cells[(static_cast<std::size_t>(M2) * EVENT_COUNT) + GUARD].action == &guard) );
+        CHECK_TRUE( (MAIN.states[M1].entry == &on_entry<1>) );
+        CHECK_TRUE( (CHAIN.states[C2].exit == ECU_TFSM_EXIT_UNUSED) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*-------------------- TESTS - ECU_TFSM_CTOR -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Not allowed. Initial state must be a row of the table.
+ */
+TEST(Tfsm, CtorInvalidState)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_tfsm_ctor(&me, &MAIN, MAIN_STATE_COUNT);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------ TESTS - ECU_TFSM_DISPATCH ---------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Nothing runs for an ignored event.
+ */
+TEST(Tfsm, DispatchIgnoredEvent)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &MAIN, M0);
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, IGNORED, &DATA);
+
+        /* Step 3: Assert. No mock calls expected. */
+        UNSIGNED_LONGS_EQUAL(M0, ecu_tfsm_current_state(&me));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Action runs without exiting the state.
+ */
+TEST(Tfsm, DispatchInternalAction)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &MAIN, M1);
+        EXPECT_ACTION(M1);
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, INTERNAL, &DATA);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(M1, ecu_tfsm_current_state(&me));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Same as @ref ecu_fsm_dispatch(). Action, then the
+ * state is exited and entered again.
+ */
+TEST(Tfsm, DispatchSelfTransition)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &MAIN, M0);
+        EXPECT_ACTION(M0);
+        EXPECT_EXIT(M0);
+        EXPECT_ENTRY(M0);
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, SELF, &DATA);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(M0, ecu_tfsm_current_state(&me));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Same as @ref ecu_fsm_dispatch(). Action runs in the
+ * source state, then source exits and target enters.
+ */
+TEST(Tfsm, DispatchStateTransition)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &MAIN, M0);
+        EXPECT_ACTION(M0);
+        EXPECT_EXIT(M0);
+        EXPECT_ENTRY(M1);
+        EXPECT_ACTION(M1);
+        EXPECT_EXIT(M1);
+        EXPECT_ENTRY(M2);
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, NEXT, &DATA);
+        ecu_tfsm_dispatch(&me, NEXT, &DATA);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(M2, ecu_tfsm_current_state(&me));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Transition cells do not need an action.
+ */
+TEST(Tfsm, DispatchTransitionWithoutAction)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &MAIN, M1);
+        EXPECT_EXIT(M1);
+        EXPECT_ENTRY(M1);
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, SELF, &DATA);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(M1, ecu_tfsm_current_state(&me));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Action of a cell without a target decides the
+ * transition at run-time.
+ */
+TEST(Tfsm, DispatchGuardInAction)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &MAIN, M0);
+        EXPECT_ACTION(M0);
+        EXPECT_EXIT(M0);
+        EXPECT_ENTRY(M2);
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, GUARD, &DATA);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(M2, ecu_tfsm_current_state(&me));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Only one transition per dispatch, so
+ * an action of a cell with a target cannot transition.
+ */
+TEST(Tfsm, DispatchActionTransitionsWithTarget)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &MAIN, M2);
+        EXPECT_ACTION(M2);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, GUARD, &DATA);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Same as @ref ecu_fsm_dispatch(). Entry handler can
+ * transition again. Every state exits before the next enters.
+ */
+TEST(Tfsm, DispatchTransitionOnEntry)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &CHAIN, C0);
+        EXPECT_EXIT(C0);
+        EXPECT_ENTRY(C1);
+        EXPECT_EXIT(C1);
+        EXPECT_ENTRY(C2);
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, NEXT, &DATA);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(C2, ecu_tfsm_current_state(&me));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Self-transition in entry handler would
+ * loop forever.
+ */
+TEST(Tfsm, DispatchSelfTransitionOnEntry)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &BAD, B1);
+        EXPECT_ENTRY(1);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_tfsm_start(&me);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. State is already being exited.
+ */
+TEST(Tfsm, DispatchTransitionOnExit)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &BAD, B0);
+        EXPECT_EXIT(0);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, NEXT, &DATA);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Event must be a column of the table.
+ */
+TEST(Tfsm, DispatchEventOutOfRange)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &MAIN, M0);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, EVENT_COUNT, &DATA);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Machines sharing a table keep their own state.
+ */
+TEST(Tfsm, DispatchSharedTable)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm other;
+        ecu_tfsm_ctor(&me, &MAIN, M0);
+        ecu_tfsm_ctor(&other, &MAIN, M0);
+        mock().disable();
+
+        /* Step 2: Action. */
+        ecu_tfsm_dispatch(&me, NEXT, &DATA);
+        ecu_tfsm_dispatch(&me, NEXT, &DATA);
+        ecu_tfsm_dispatch(&other, NEXT, &DATA);
+        mock().enable();
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(M2, ecu_tfsm_current_state(&me));
+        UNSIGNED_LONGS_EQUAL(M1, ecu_tfsm_current_state(&other));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - ECU_TFSM_START -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Only the initial state's entry handler runs.
+ */
+TEST(Tfsm, StartRunsEntry)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &MAIN, M1);
+        EXPECT_ENTRY(M1);
+
+        /* Step 2: Action. */
+        ecu_tfsm_start(&me);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(M1, ecu_tfsm_current_state(&me));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Same as @ref ecu_fsm_start(). Initial state's entry
+ * handler can transition.
+ */
+TEST(Tfsm, StartTransitionOnEntry)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tfsm_ctor(&me, &CHAIN, C1);
+        EXPECT_ENTRY(C1);
+        EXPECT_EXIT(C1);
+        EXPECT_ENTRY(C2);
+
+        /* Step 2: Action. */
+        ecu_tfsm_start(&me);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(C2, ecu_tfsm_current_state(&me));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
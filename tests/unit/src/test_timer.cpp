@@ -10,6 +10,12 @@
  * @ref ecu_timer_set()
  *      - TEST(Timer, TimerSetDisarmsTimer)
  * 
+ * @ref ecu_tlist_next_timeout()
+ *      - TEST(Timer, NextTimeoutNoTimers)
+ *      - TEST(Timer, NextTimeoutEarliestTimer)
+ *      - TEST(Timer, NextTimeoutCallbackReturnFalse)
+ *      - TEST(Timer, NextTimeoutTickWraparound)
+ * 
  * The remaining tests verify tlist servicing under different conditions.
  * They test the remaining functions under test:
  * @ref ecu_tlist_service(), @ref ecu_tlist_timer_arm(), @ref ecu_tlist_timer_rearm():
@@ -342,6 +348,102 @@ TEST(Timer, TimerSetDisarmsTimer)
     }
 }
 
+/*------------------------------------------------------------*/
+/*---------------- TESTS - TLIST NEXT TIMEOUT ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Empty list never times out.
+ */
+TEST(Timer, NextTimeoutNoTimers)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tlist_service(&tlist, 100);
+
+        /* Steps 2 and 3: Action and assert. */
+        UNSIGNED_LONGS_EQUAL(MAX, ecu_tlist_next_timeout(&tlist));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Returns ticks remaining on the timer that expires
+ * first, regardless of the order timers were armed in.
+ */
+TEST(Timer, NextTimeoutEarliestTimer)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tlist_service(&tlist, 100);
+        ecu_tlist_timer_arm(&tlist, &t1, 50, ECU_TIMER_TYPE_ONE_SHOT);
+        ecu_tlist_timer_arm(&tlist, &t2, 30, ECU_TIMER_TYPE_PERIODIC);
+        ecu_tlist_service(&tlist, 10);
+
+        /* Steps 2 and 3: Action and assert. */
+        UNSIGNED_LONGS_EQUAL(20, ecu_tlist_next_timeout(&tlist));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Timer whose callback failed is retried on the
+ * next service so it is already due.
+ */
+TEST(Timer, NextTimeoutCallbackReturnFalse)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tlist_timer_arm(&tlist, &t1, 10, ECU_TIMER_TYPE_ONE_SHOT);
+        ecu_tlist_timer_arm(&tlist, &t2, 50, ECU_TIMER_TYPE_ONE_SHOT);
+        t1.callback_successful(false);
+        EXPECT_TIMER_EXPIRED(t1, 1);
+        ecu_tlist_service(&tlist, 10);
+
+        /* Steps 2 and 3: Action and assert. */
+        UNSIGNED_LONGS_EQUAL(0, ecu_tlist_next_timeout(&tlist));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Timer that expires after the tick counter wraps
+ * around still reports the ticks remaining.
+ */
+TEST(Timer, NextTimeoutTickWraparound)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_tlist_service(&tlist, MAX-20);
+        ecu_tlist_timer_arm(&tlist, &t1, 50, ECU_TIMER_TYPE_ONE_SHOT);
+        ecu_tlist_service(&tlist, 5);
+
+        /* Steps 2 and 3: Action and assert. */
+        UNSIGNED_LONGS_EQUAL(45, ecu_tlist_next_timeout(&tlist));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
 /*------------------------------------------------------------*/
 /*----------- TESTS - TLIST SERVICE NORMAL OPERATION ---------*/
 /*------------------------------------------------------------*/
@@ -0,0 +1,1030 @@
+/**
+ * @file
+ * @brief Unit tests for public API functions in @ref ulist.h.
+ * Test summary:
+ *
+ * @ref ecu_ulist_ctor()
+ *      - TEST(UList, CtorZeroElementSize)
+ *      - TEST(UList, CtorNoAllocator)
+ *      - TEST(UList, ElementsAligned)
+ *
+ * @ref ecu_ulist_destroy(), @ref ecu_ulist_clear()
+ *      - TEST(UList, ClearReleasesBlocks)
+ *      - TEST(UList, DestroyReleasesBlocks)
+ *
+ * @ref ecu_ulist_push_back(), @ref ecu_ulist_push_front()
+ *      - TEST(UList, PushBackMultipleBlocks)
+ *      - TEST(UList, PushFrontMultipleBlocks)
+ *      - TEST(UList, PushAllocationFails)
+ *
+ * @ref ecu_ulist_pop_back(), @ref ecu_ulist_pop_front()
+ *      - TEST(UList, PopFrontAndBack)
+ *      - TEST(UList, PopReleasesBlocks)
+ *      - TEST(UList, PopEmptyList)
+ *
+ * @ref ecu_ulist_front(), @ref ecu_ulist_back()
+ *      - TEST(UList, FrontAndBack)
+ *      - TEST(UList, FrontAndBackEmptyList)
+ *
+ * @ref ecu_ulist_insert()
+ *      - TEST(UList, InsertSorted)
+ *      - TEST(UList, InsertStable)
+ *      - TEST(UList, InsertSplitsFullBlock)
+ *      - TEST(UList, InsertSequentialFillsBlocks)
+ *      - TEST(UList, InsertAllocationFails)
+ *
+ * @ref ecu_ulist_compact()
+ *      - TEST(UList, Compact)
+ *      - TEST(UList, CompactEmptyList)
+ *
+ * @ref ECU_ULIST_FOR_EACH(), @ref ECU_ULIST_CONST_FOR_EACH(), @ref ecu_ulist_iterator_remove()
+ *      - TEST(UList, IteratorEmptyList)
+ *      - TEST(UList, ConstIterator)
+ *      - TEST(UList, IteratorRemoveSome)
+ *      - TEST(UList, IteratorRemoveAll)
+ *      - TEST(UList, IteratorRemoveAbsorbsNextBlock)
+ *      - TEST(UList, IteratorRemoveTwice)
+ *
+ * @author Ian Ress
+ * @version 0.1
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2026
+ */
+
+/*------------------------------------------------------------*/
+/*------------------------- INCLUDES -------------------------*/
+/*------------------------------------------------------------*/
+
+/* Files under test. */
+#include "ecu/ulist.h"
+
+/* STDLib. */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/* Stubs and helpers. */
+#include "stubs/stub_asserter.hpp"
+
+/* CppUTest. */
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTest/TestHarness.h"
+
+/*------------------------------------------------------------*/
+/*------------------------- NAMESPACES -----------------------*/
+/*------------------------------------------------------------*/
+
+using namespace stubs;
+
+/*------------------------------------------------------------*/
+/*----------------------- FILE-SCOPE TYPES -------------------*/
+/*------------------------------------------------------------*/
+
+namespace
+{
+/**
+ * @brief Element used to verify ordered inserts are stable.
+ * Only @ref key is compared.
+ */
+struct keyed
+{
+    /// @brief Sorting key.
+    int key;
+
+    /// @brief Order the element was inserted in.
+    int sequence;
+};
+
+/**
+ * @brief Fixed-capacity block allocator supplied to the list.
+ * Tracks the number of blocks in use so tests can verify
+ * blocks are split, merged, and released.
+ */
+struct block_pool
+{
+    /// @brief Constructor.
+    ///
+    /// @param elem_size Size of one element in bytes.
+    /// @param capacity Elements per block.
+    /// @param blocks Maximum number of blocks that can be allocated.
+    block_pool(std::size_t elem_size, std::size_t capacity, std::size_t blocks)
+        : units(ECU_ULIST_BLOCK_UNITS(elem_size, capacity)),
+          storage(units * blocks)
+    {
+        for (std::size_t i = blocks; i > 0; i--)
+        {
+            available.push_back(&storage.at((i - 1) * units));
+        }
+    }
+
+    /// @brief Block allocator passed to @ref ecu_ulist_ctor().
+    static void *alloc(void *obj)
+    {
+        block_pool *me = static_cast<block_pool *>(obj);
+        void *block = nullptr;
+
+        if (!me->available.empty())
+        {
+            block = me->available.back();
+            me->available.pop_back();
+            me->in_use++;
+        }
+
+        return block;
+    }
+
+    /// @brief Block deallocator passed to @ref ecu_ulist_ctor().
+    static void free(void *block, void *obj)
+    {
+        block_pool *me = static_cast<block_pool *>(obj);
+        me->available.push_back(static_cast<ecu_ulist_max_align *>(block));
+        me->in_use--;
+    }
+
+    /// @brief Number of @ref ecu_ulist_max_align units per block.
+    std::size_t units;
+
+    /// @brief Memory for all blocks.
+    std::vector<ecu_ulist_max_align> storage;
+
+    /// @brief Blocks that can be allocated.
+    std::vector<ecu_ulist_max_align *> available;
+
+    /// @brief Number of blocks currently allocated.
+    std::size_t in_use{0};
+};
+
+/**
+ * @brief C++ wrapper around C structure under test (@ref ecu_ulist).
+ */
+struct ulist : public ecu_ulist
+{
+    /// @brief Constructor.
+    ///
+    /// @param pool Allocator that supplies blocks.
+    /// @param elem_bytes Size of one element in bytes.
+    /// @param elems_per_block Elements per block.
+    ulist(block_pool& pool, std::size_t elem_bytes, std::size_t elems_per_block)
+    {
+        ecu_ulist_ctor(this, elem_bytes, elems_per_block, &block_pool::alloc, &block_pool::free, &pool);
+    }
+};
+
+/**
+ * @brief Sorting condition for int elements.
+ */
+bool int_less_than(const void *lhs, const void *rhs, void *data)
+{
+    (void)data;
+    return (*static_cast<const int *>(lhs) < *static_cast<const int *>(rhs));
+}
+
+/**
+ * @brief Sorting condition for @ref keyed elements.
+ */
+bool keyed_less_than(const void *lhs, const void *rhs, void *data)
+{
+    (void)data;
+    return (static_cast<const keyed *>(lhs)->key < static_cast<const keyed *>(rhs)->key);
+}
+} /* namespace. */
+
+/*------------------------------------------------------------*/
+/*----------------------- TEST GROUPS ------------------------*/
+/*------------------------------------------------------------*/
+
+TEST_GROUP(UList)
+{
+    void setup() override
+    {
+        set_assert_handler(AssertResponse::FAIL);
+    }
+
+    void teardown() override
+    {
+        mock().checkExpectations();
+        mock().clear();
+    }
+
+    /// @brief Returns all int elements in the list, in iteration order.
+    static std::vector<int> contents(const ecu_ulist& l)
+    {
+        std::vector<int> result;
+        ecu_ulist_citerator citerator;
+
+        ECU_ULIST_CONST_FOR_EACH(i, &citerator, &l, int)
+        {
+            result.push_back(*i);
+        }
+
+        return result;
+    }
+
+    /// @brief Returns a vector of ints from @p begin to @p end (exclusive),
+    /// incrementing by @p step.
+    static std::vector<int> range(int begin, int end, int step = 1)
+    {
+        std::vector<int> result;
+
+        for (int i = begin; i < end; i += step)
+        {
+            result.push_back(i);
+        }
+
+        return result;
+    }
+
+    /// @brief Pushes ints from @p begin to @p end (exclusive) to the back of the list.
+    static void push_back_range(ecu_ulist& l, int begin, int end)
+    {
+        for (int i = begin; i < end; i++)
+        {
+            CHECK_TRUE( (ecu_ulist_push_back(&l, &i)) );
+        }
+    }
+
+    /// @brief Elements per block used in most tests. Small so that
+    /// multiple blocks are exercised.
+    static constexpr std::size_t CAPACITY{4};
+
+    /// @brief Block allocator for int lists.
+    block_pool pool{sizeof(int), CAPACITY, 32};
+
+    /// @brief List of ints under test.
+    ulist list{pool, sizeof(int), CAPACITY};
+};
+
+/*------------------------------------------------------------*/
+/*------------------------- TESTS - CTOR ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Not allowed. Element size must be greater than 0.
+ */
+TEST(UList, CtorZeroElementSize)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ulist me;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ulist_ctor(&me, 0, CAPACITY, &block_pool::alloc, &block_pool::free, &pool);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Block allocator is mandatory.
+ */
+TEST(UList, CtorNoAllocator)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        ecu_ulist me;
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ulist_ctor(&me, sizeof(int), CAPACITY, nullptr, &block_pool::free, &pool);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Elements stored in a block are aligned for any type.
+ */
+TEST(UList, ElementsAligned)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        block_pool ld_pool{sizeof(long double), 3, 1};
+        ulist ld_list{ld_pool, sizeof(long double), 3};
+        long double value = 1.5L;
+
+        /* Step 2: Action. */
+        ecu_ulist_push_back(&ld_list, &value);
+        ecu_ulist_push_back(&ld_list, &value);
+
+        /* Step 3: Assert. */
+        ecu_ulist_iterator iterator;
+        ECU_ULIST_FOR_EACH(i, &iterator, &ld_list, long double)
+        {
+            UNSIGNED_LONGS_EQUAL(0, reinterpret_cast<std::uintptr_t>(i) % alignof(long double));
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------- TESTS - DESTROY AND CLEAR ----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief All blocks are released and the list can be reused.
+ */
+TEST(UList, ClearReleasesBlocks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        push_back_range(list, 0, 10);
+
+        /* Step 2: Action. */
+        ecu_ulist_clear(&list);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, pool.in_use);
+        UNSIGNED_LONGS_EQUAL(0, ecu_ulist_size(&list));
+        CHECK_TRUE( (ecu_ulist_empty(&list)) );
+        push_back_range(list, 0, 3);
+        CHECK_TRUE( (range(0, 3) == contents(list)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief All blocks are released. List must be reconstructed
+ * to be used again.
+ */
+TEST(UList, DestroyReleasesBlocks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        push_back_range(list, 0, 10);
+
+        /* Step 2: Action. */
+        ecu_ulist_destroy(&list);
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, pool.in_use);
+        CHECK_FALSE( (ecu_ulist_valid(&list)) );
+        EXPECT_ASSERTION();
+        ecu_ulist_size(&list);
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------- TESTS - PUSH ---------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Elements are kept in order across blocks. Blocks
+ * are filled before a new one is allocated.
+ */
+TEST(UList, PushBackMultipleBlocks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        CHECK_TRUE( (ecu_ulist_empty(&list)) );
+
+        /* Step 2: Action. */
+        push_back_range(list, 0, 10);
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (range(0, 10) == contents(list)) );
+        UNSIGNED_LONGS_EQUAL(10, ecu_ulist_size(&list));
+        UNSIGNED_LONGS_EQUAL(3, pool.in_use);
+        CHECK_FALSE( (ecu_ulist_empty(&list)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Elements are kept in order across blocks. Blocks
+ * are filled before a new one is allocated.
+ */
+TEST(UList, PushFrontMultipleBlocks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::vector<int> expected = range(0, 10);
+        std::reverse(expected.begin(), expected.end());
+
+        /* Step 2: Action. */
+        for (int i = 0; i < 10; i++)
+        {
+            CHECK_TRUE( (ecu_ulist_push_front(&list, &i)) );
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (expected == contents(list)) );
+        UNSIGNED_LONGS_EQUAL(10, ecu_ulist_size(&list));
+        UNSIGNED_LONGS_EQUAL(3, pool.in_use);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief False returned and list unchanged if a block is
+ * needed but the allocator has no memory.
+ */
+TEST(UList, PushAllocationFails)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        block_pool small_pool{sizeof(int), CAPACITY, 1};
+        ulist small_list{small_pool, sizeof(int), CAPACITY};
+        push_back_range(small_list, 0, 4);
+        int value = 100;
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_FALSE( (ecu_ulist_push_back(&small_list, &value)) );
+        CHECK_FALSE( (ecu_ulist_push_front(&small_list, &value)) );
+        CHECK_TRUE( (range(0, 4) == contents(small_list)) );
+        UNSIGNED_LONGS_EQUAL(4, ecu_ulist_size(&small_list));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------- TESTS - POP ----------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Correct elements removed and copied out.
+ */
+TEST(UList, PopFrontAndBack)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        push_back_range(list, 0, 10);
+        int out = -1;
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (ecu_ulist_pop_front(&list, &out)) );
+        LONGS_EQUAL(0, out);
+        CHECK_TRUE( (ecu_ulist_pop_back(&list, &out)) );
+        LONGS_EQUAL(9, out);
+        CHECK_TRUE( (ecu_ulist_pop_front(&list, nullptr)) );
+        CHECK_TRUE( (range(2, 9) == contents(list)) );
+        UNSIGNED_LONGS_EQUAL(7, ecu_ulist_size(&list));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Blocks are released once they become empty.
+ */
+TEST(UList, PopReleasesBlocks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        push_back_range(list, 0, 10);
+
+        /* Step 2: Action. */
+        for (int i = 0; i < 5; i++)
+        {
+            ecu_ulist_pop_front(&list, nullptr);
+        }
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(2, pool.in_use);
+
+        while (ecu_ulist_pop_back(&list, nullptr))
+        {
+        }
+
+        UNSIGNED_LONGS_EQUAL(0, pool.in_use);
+        CHECK_TRUE( (ecu_ulist_empty(&list)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief False returned and output not written if list
+ * is empty.
+ */
+TEST(UList, PopEmptyList)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        int out = -1;
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_FALSE( (ecu_ulist_pop_front(&list, &out)) );
+        CHECK_FALSE( (ecu_ulist_pop_back(&list, &out)) );
+        LONGS_EQUAL(-1, out);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------- TESTS - FRONT AND BACK -----------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Front and back elements returned without being removed.
+ */
+TEST(UList, FrontAndBack)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        push_back_range(list, 0, 10);
+
+        /* Steps 2 and 3: Action and assert. */
+        LONGS_EQUAL(0, *static_cast<int *>(ecu_ulist_front(&list)));
+        LONGS_EQUAL(9, *static_cast<int *>(ecu_ulist_back(&list)));
+        LONGS_EQUAL(0, *static_cast<const int *>(ecu_ulist_cfront(&list)));
+        LONGS_EQUAL(9, *static_cast<const int *>(ecu_ulist_cback(&list)));
+        UNSIGNED_LONGS_EQUAL(10, ecu_ulist_size(&list));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief NULL returned if list is empty.
+ */
+TEST(UList, FrontAndBackEmptyList)
+{
+    try
+    {
+        /* Steps 1, 2, and 3: Arrange, action, and assert. */
+        POINTERS_EQUAL(nullptr, ecu_ulist_front(&list));
+        POINTERS_EQUAL(nullptr, ecu_ulist_back(&list));
+        POINTERS_EQUAL(nullptr, ecu_ulist_cfront(&list));
+        POINTERS_EQUAL(nullptr, ecu_ulist_cback(&list));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - INSERT --------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Elements inserted in random order end up sorted.
+ */
+TEST(UList, InsertSorted)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::vector<int> values = range(0, 50);
+        std::shuffle(values.begin(), values.end(), std::mt19937{42});
+
+        /* Step 2: Action. */
+        for (int v : values)
+        {
+            CHECK_TRUE( (ecu_ulist_insert(&list, &v, &int_less_than, ECU_ULIST_OBJ_UNUSED)) );
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (range(0, 50) == contents(list)) );
+        UNSIGNED_LONGS_EQUAL(50, ecu_ulist_size(&list));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Equal elements keep the order they were inserted in.
+ */
+TEST(UList, InsertStable)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        block_pool keyed_pool{sizeof(keyed), CAPACITY, 16};
+        ulist keyed_list{keyed_pool, sizeof(keyed), CAPACITY};
+        const int keys[] = {3, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 2};
+
+        /* Step 2: Action. */
+        for (int i = 0; i < static_cast<int>(sizeof(keys) / sizeof(keys[0])); i++)
+        {
+            keyed k{keys[i], i};
+            CHECK_TRUE( (ecu_ulist_insert(&keyed_list, &k, &keyed_less_than, ECU_ULIST_OBJ_UNUSED)) );
+        }
+
+        /* Step 3: Assert. */
+        const keyed *prev = nullptr;
+        ecu_ulist_citerator citerator;
+
+        ECU_ULIST_CONST_FOR_EACH(k, &citerator, &keyed_list, keyed)
+        {
+            if (prev)
+            {
+                CHECK_TRUE( (prev->key < k->key || (prev->key == k->key && prev->sequence < k->sequence)) );
+            }
+
+            prev = k;
+        }
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Inserting into the middle of a full block splits it.
+ */
+TEST(UList, InsertSplitsFullBlock)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        for (int v : {0, 2, 4, 6})
+        {
+            ecu_ulist_push_back(&list, &v);
+        }
+
+        UNSIGNED_LONGS_EQUAL(1, pool.in_use);
+        int value = 3;
+
+        /* Step 2: Action. */
+        CHECK_TRUE( (ecu_ulist_insert(&list, &value, &int_less_than, ECU_ULIST_OBJ_UNUSED)) );
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(2, pool.in_use);
+        CHECK_TRUE( (std::vector<int>({0, 2, 3, 4, 6}) == contents(list)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Inserting in ascending order appends to the back,
+ * so every block is full instead of half full after a split.
+ */
+TEST(UList, InsertSequentialFillsBlocks)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+
+        /* Step 2: Action. */
+        for (int i = 0; i < 16; i++)
+        {
+            CHECK_TRUE( (ecu_ulist_insert(&list, &i, &int_less_than, ECU_ULIST_OBJ_UNUSED)) );
+        }
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(4, pool.in_use);
+        CHECK_TRUE( (range(0, 16) == contents(list)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief False returned and list unchanged if a full block
+ * needs to be split but the allocator has no memory.
+ */
+TEST(UList, InsertAllocationFails)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        block_pool small_pool{sizeof(int), CAPACITY, 1};
+        ulist small_list{small_pool, sizeof(int), CAPACITY};
+
+        for (int v : {0, 2, 4, 6})
+        {
+            ecu_ulist_push_back(&small_list, &v);
+        }
+
+        int value = 3;
+
+        /* Step 2: Action. */
+        CHECK_FALSE( (ecu_ulist_insert(&small_list, &value, &int_less_than, ECU_ULIST_OBJ_UNUSED)) );
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (std::vector<int>({0, 2, 4, 6}) == contents(small_list)) );
+        UNSIGNED_LONGS_EQUAL(4, ecu_ulist_size(&small_list));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*------------------------ TESTS - COMPACT -------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Elements packed into the minimum number of blocks.
+ * Order preserved.
+ */
+TEST(UList, Compact)
+{
+    try
+    {
+        /* Step 1: Arrange. Remove the first two elements of every
+        block so all blocks are half full. */
+        push_back_range(list, 0, 32);
+        UNSIGNED_LONGS_EQUAL(8, pool.in_use);
+
+        ecu_ulist_iterator iterator;
+        ECU_ULIST_FOR_EACH(i, &iterator, &list, int)
+        {
+            if (*i % 4 == 0 || *i % 4 == 1)
+            {
+                ecu_ulist_iterator_remove(&iterator);
+            }
+        }
+
+        /* Step 2: Action. */
+        ecu_ulist_compact(&list);
+
+        /* Step 3: Assert. */
+        std::vector<int> expected;
+        for (int i = 0; i < 32; i++)
+        {
+            if (i % 4 == 2 || i % 4 == 3)
+            {
+                expected.push_back(i);
+            }
+        }
+
+        CHECK_TRUE( (expected == contents(list)) );
+        UNSIGNED_LONGS_EQUAL(4, pool.in_use);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Nothing happens if list is empty.
+ */
+TEST(UList, CompactEmptyList)
+{
+    try
+    {
+        /* Steps 1, 2, and 3: Arrange, action, and assert. */
+        ecu_ulist_compact(&list);
+        CHECK_TRUE( (ecu_ulist_empty(&list)) );
+        UNSIGNED_LONGS_EQUAL(0, pool.in_use);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/*------------------------------------------------------------*/
+/*----------------------- TESTS - ITERATORS ------------------*/
+/*------------------------------------------------------------*/
+
+/**
+ * @brief Iteration immediately exits.
+ */
+TEST(UList, IteratorEmptyList)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        std::size_t visited = 0;
+        ecu_ulist_iterator iterator;
+
+        /* Step 2: Action. */
+        ECU_ULIST_FOR_EACH(i, &iterator, &list, int)
+        {
+            (void)i;
+            visited++;
+        }
+
+        /* Step 3: Assert. */
+        UNSIGNED_LONGS_EQUAL(0, visited);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief All elements visited in order.
+ */
+TEST(UList, ConstIterator)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        push_back_range(list, 0, 13);
+
+        /* Steps 2 and 3: Action and assert. */
+        CHECK_TRUE( (range(0, 13) == contents(list)) );
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Removing the current element does not affect
+ * which elements are visited.
+ */
+TEST(UList, IteratorRemoveSome)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        push_back_range(list, 0, 20);
+        std::vector<int> visited;
+        ecu_ulist_iterator iterator;
+
+        /* Step 2: Action. */
+        ECU_ULIST_FOR_EACH(i, &iterator, &list, int)
+        {
+            visited.push_back(*i);
+
+            if (*i % 2 == 0)
+            {
+                ecu_ulist_iterator_remove(&iterator);
+            }
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (range(0, 20) == visited) );
+        CHECK_TRUE( (range(1, 20, 2) == contents(list)) );
+        UNSIGNED_LONGS_EQUAL(10, ecu_ulist_size(&list));
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief All elements visited and removed. All blocks released.
+ */
+TEST(UList, IteratorRemoveAll)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        push_back_range(list, 0, 10);
+        std::vector<int> visited;
+        ecu_ulist_iterator iterator;
+
+        /* Step 2: Action. */
+        ECU_ULIST_FOR_EACH(i, &iterator, &list, int)
+        {
+            visited.push_back(*i);
+            ecu_ulist_iterator_remove(&iterator);
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (range(0, 10) == visited) );
+        CHECK_TRUE( (ecu_ulist_empty(&list)) );
+        UNSIGNED_LONGS_EQUAL(0, pool.in_use);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Block that falls under half capacity absorbs the
+ * next block when both fit. Iteration continues correctly.
+ */
+TEST(UList, IteratorRemoveAbsorbsNextBlock)
+{
+    try
+    {
+        /* Step 1: Arrange. Blocks = [0, 1, 2, 3], [4, 5]. */
+        push_back_range(list, 0, 6);
+        UNSIGNED_LONGS_EQUAL(2, pool.in_use);
+        std::vector<int> visited;
+        ecu_ulist_iterator iterator;
+
+        /* Step 2: Action. */
+        ECU_ULIST_FOR_EACH(i, &iterator, &list, int)
+        {
+            visited.push_back(*i);
+
+            if (*i < 3)
+            {
+                ecu_ulist_iterator_remove(&iterator);
+            }
+        }
+
+        /* Step 3: Assert. */
+        CHECK_TRUE( (range(0, 6) == visited) );
+        CHECK_TRUE( (range(3, 6) == contents(list)) );
+        UNSIGNED_LONGS_EQUAL(1, pool.in_use);
+    }
+    catch (const AssertException& e)
+    {
+        /* FAIL. */
+        (void)e;
+    }
+}
+
+/**
+ * @brief Not allowed. Current element already removed.
+ */
+TEST(UList, IteratorRemoveTwice)
+{
+    try
+    {
+        /* Step 1: Arrange. */
+        push_back_range(list, 0, 3);
+        ecu_ulist_iterator iterator;
+        ecu_ulist_iterator_begin(&iterator, &list);
+        ecu_ulist_iterator_remove(&iterator);
+        EXPECT_ASSERTION();
+
+        /* Step 2: Action. */
+        ecu_ulist_iterator_remove(&iterator);
+
+        /* Step 3: Assert. Test fails if assertion does not fire. */
+    }
+    catch (const AssertException& e)
+    {
+        /* OK. */
+        (void)e;
+    }
+}